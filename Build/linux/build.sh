@@ -74,6 +74,9 @@ Usage: $0 [OPTION] ... -- [OPTIONS FOR CMAKE]
     disable-avx512
     --enable-avx512,    Enable building avx512 code (if supported)
     enable-avx512
+    --enable-lockfree-fifo,
+    enable-lockfree-fifo
+                        Use lock-free rings for the encoder process hand-offs
     --shared, shared    Build shared libs
 -x, --static, static    Build static libs
 -g, --gen, gen=*        Set CMake generator
@@ -243,6 +246,7 @@ parse_options() {
         disable*)
             case ${1#disable-} in
             avx512) CMAKE_EXTRA_FLAGS="$CMAKE_EXTRA_FLAGS -DENABLE_AVX512=OFF" ;;
+            lockfree-fifo) CMAKE_EXTRA_FLAGS="$CMAKE_EXTRA_FLAGS -DENABLE_LOCKFREE_FIFO=OFF" ;;
             *) print_message "Unknown option: $1" ;;
             esac
             shift
@@ -250,6 +254,7 @@ parse_options() {
         enable*)
             case ${1#enable-} in
             avx512) CMAKE_EXTRA_FLAGS="$CMAKE_EXTRA_FLAGS -DENABLE_AVX512=ON" ;;
+            lockfree-fifo) CMAKE_EXTRA_FLAGS="$CMAKE_EXTRA_FLAGS -DENABLE_LOCKFREE_FIFO=ON" ;;
             *) print_message "Unknown option: $1" ;;
             esac
             shift
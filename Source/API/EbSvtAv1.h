@@ -79,6 +79,59 @@ EbBool is a 32 bit quantity and is aligned on a 32 bit word boundary.
 #define EB_FALSE 0
 #define EB_TRUE 1
 
+/* Encoder pipeline stages whose start is timed in EbFrameStats */
+typedef enum EbFrameStatsStage {
+    EB_FRAME_STATS_PICTURE_ANALYSIS = 0,
+    EB_FRAME_STATS_MOTION_ESTIMATION,
+    EB_FRAME_STATS_RATE_CONTROL,
+    EB_FRAME_STATS_ENC_DEC,
+    EB_FRAME_STATS_LOOP_FILTER,
+    EB_FRAME_STATS_ENTROPY_CODING,
+    EB_FRAME_STATS_PACKETIZATION,
+    EB_FRAME_STATS_STAGE_COUNT
+} EbFrameStatsStage;
+
+/* Statistics of a coded superblock */
+typedef struct EbSbStats {
+    uint32_t bits;
+    uint8_t  qindex;
+} EbSbStats;
+
+/* Statistics of a coded frame, exported when frame_stats is enabled in the
+ * encoder configuration. */
+typedef struct EbFrameStats {
+    uint64_t picture_number; // display order
+    uint64_t decode_order;
+    int64_t  pts;
+    uint32_t pic_type; // EbAv1PictureType
+    uint8_t  temporal_layer_index;
+    uint8_t  show_frame;
+    uint32_t qp;
+    uint32_t base_qindex;
+    uint64_t bits;
+
+    // Distortion, only set when stat_report is enabled
+    uint64_t luma_sse;
+    uint64_t cb_sse;
+    uint64_t cr_sse;
+    double   luma_psnr;
+    double   cb_psnr;
+    double   cr_psnr;
+    double   luma_ssim;
+    double   cb_ssim;
+    double   cr_ssim;
+
+    // Timings in microseconds since the picture was received by the encoder
+    uint32_t stage_start_us[EB_FRAME_STATS_STAGE_COUNT];
+    uint32_t output_us;
+
+    // Superblock map in raster order, only set when frame_stats is 2
+    uint32_t   sb_size;
+    uint32_t   sb_cols;
+    uint32_t   sb_rows;
+    EbSbStats *sb_stats;
+} EbFrameStats;
+
 typedef struct EbBufferHeaderType {
     // EbBufferHeaderType size
     uint32_t size;
@@ -109,6 +162,11 @@ typedef struct EbBufferHeaderType {
     double luma_ssim;
     double cr_ssim;
     double cb_ssim;
+
+    // statistics of the frames coded in the packet, in decode order,
+    // NULL unless frame_stats is enabled
+    EbFrameStats *frame_stats;
+    uint32_t      frame_stats_count;
 } EbBufferHeaderType;
 
 typedef struct EbComponentType {
@@ -123,6 +181,7 @@ typedef enum EbErrorType {
     EB_DecNoOutputPicture          = (int32_t)0x40001004,
     EB_DecDecodingError            = (int32_t)0x40001008,
     EB_Corrupt_Frame               = (int32_t)0x4000100C,
+    EB_DecOutputQueueFull          = (int32_t)0x40001010,
     EB_ErrorInsufficientResources  = (int32_t)0x80001000,
     EB_ErrorUndefined              = (int32_t)0x80001001,
     EB_ErrorInvalidComponent       = (int32_t)0x80001004,
@@ -311,7 +370,8 @@ typedef uint64_t CPU_FLAGS;
 #define CPU_FLAGS_AVX512PF (1 << 13)
 #define CPU_FLAGS_AVX512BW (1 << 14)
 #define CPU_FLAGS_AVX512VL (1 << 15)
-#define CPU_FLAGS_ALL ((CPU_FLAGS_AVX512VL << 1) - 1)
+#define CPU_FLAGS_NEON (1 << 16)
+#define CPU_FLAGS_ALL ((CPU_FLAGS_NEON << 1) - 1)
 #define CPU_FLAGS_INVALID (1ULL << (sizeof(CPU_FLAGS) * 8ULL - 1ULL))
 
 #ifdef __cplusplus
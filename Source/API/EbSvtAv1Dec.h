@@ -112,10 +112,29 @@ typedef struct EbSvtAv1DecConfiguration {
      * Default is 1. */
     uint32_t threads;
 
-    /* Number of frames that can be processed
-       in parallel. Default is 1 */
+    /* Number of frames in flight in the parse / reconstruction pipeline, up
+       to 8. Above 1, the caller thread parses a frame while one internal
+       thread reconstructs and post-filters the previous ones: decoding uses
+       two threads, threads is set to 1 and output pictures are delayed by up
+       to num_p_frames - 1 frames. Frames are not decoded in parallel.
+       Default is 1 */
     uint32_t num_p_frames;
 
+    /* Number of times a decoder thread polls a pending dependency (stage start,
+     * neighbouring SB row progress) before blocking on it. Larger values trade
+     * CPU time for wake-up latency; 0 blocks immediately.
+     *
+     * Default is 1000. */
+    uint32_t thread_spin_count;
+
+    /* Only parse the tiles: the entropy decoding of the syntax elements is done
+     * but not the reconstruction, in-loop filtering and output of the pictures.
+     * Meant to measure the bitstream parsing throughput, threads and
+     * num_p_frames are set to 1.
+     *
+     * Default is 0. */
+    EbBool parse_only;
+
     // Application Specific parameters
 
     /* ID assigned to each channel when multiple instances are running within the
@@ -165,6 +184,13 @@ EB_API EbErrorType svt_av1_dec_init(EbComponentType *svt_dec_component);
      * @ *data                  Buffer with data
      * @ data_size              Data size in bytes
      *
+     * A data_size of 0 signals the end of the stream : the pictures still in
+     * flight (num_p_frames > 1) can then be retrieved with svt_av1_dec_get_picture().
+     *
+     * With num_p_frames > 1, returns EB_DecOutputQueueFull without taking the
+     * data when num_p_frames pictures wait to be retrieved: call
+     * svt_av1_dec_get_picture() and send the same data again.
+     *
      *  Returns EB_ErrorNone if the coded data has been processed successfully. */
 EB_API EbErrorType svt_av1_dec_frame(EbComponentType *svt_dec_component, const uint8_t *data,
                                      const size_t data_size, uint32_t is_annexb);
@@ -35,8 +35,10 @@ extern "C" {
     0x00000002 // signals that the packet contains a show existing frame at the end
 #define EB_BUFFERFLAG_HAS_TD 0x00000004 // signals that the packet contains a TD
 #define EB_BUFFERFLAG_IS_ALT_REF 0x00000008 // signals that the packet contains an ALT_REF frame
+#define EB_BUFFERFLAG_PARTIAL \
+    0x00000010 // signals that the packet is a part of a temporal unit, more packets of the unit follow
 #define EB_BUFFERFLAG_ERROR_MASK \
-    0xFFFFFFF0 // mask for signalling error assuming top flags fit in 4 bits. To be changed, if more flags are added.
+    0xFFFFFFE0 // mask for signalling error assuming top flags fit in 5 bits. To be changed, if more flags are added.
 
 /************************************************
  * Prediction Structure Config Entry
@@ -70,6 +72,28 @@ typedef enum {
     // 2. call this when you got EB_BUFFERFLAG_EOS
     SVT_AV1_STREAM_INFO_FIRST_PASS_STATS_OUT = SVT_AV1_STREAM_INFO_START,
 
+    // The output is SvtAv1InputLayout*
+    // Call this after svt_av1_enc_init() to get the layout of the picture
+    // buffers to send when EbSvtAv1EncConfiguration.zero_copy_input is set
+    SVT_AV1_STREAM_INFO_INPUT_LAYOUT,
+
+    // The output is SvtAv1MemoryLocality*
+    // Call this after svt_av1_enc_init() to get the NUMA node placement of
+    // the encoder threads and picture buffers
+    SVT_AV1_STREAM_INFO_MEMORY_LOCALITY,
+
+    // The output is SvtAv1PipelineProfile*
+    // Needs EbSvtAv1EncConfiguration.pipeline_profile, call this when you
+    // got EB_BUFFERFLAG_EOS to get the activity of the pipeline stages
+    SVT_AV1_STREAM_INFO_PIPELINE_PROFILE,
+
+    // The output is SvtAv1FixedBuf*, a Chrome trace event JSON of the busy
+    // and stall periods of each encoder thread, to be opened in
+    // chrome://tracing or Perfetto. Needs pipeline_profile set to 2, call
+    // this when you got EB_BUFFERFLAG_EOS. The buffer is owned by the
+    // encoder and valid until the next call or svt_av1_enc_deinit().
+    SVT_AV1_STREAM_INFO_PIPELINE_TRACE,
+
     SVT_AV1_STREAM_INFO_END,
 } SVT_AV1_STREAM_INFO_ID;
 
@@ -82,6 +106,96 @@ typedef struct SvtAv1FixedBuf {
     uint64_t sz; /**< Length of the buffer, in chars */
 } SvtAv1FixedBuf; /**< alias for struct aom_fixed_buf */
 
+/*!\brief Layout of the input picture buffers in zero-copy mode
+ *
+ * Each plane is allocated with its padding around the picture: the luma
+ * (resp. cb and cr) pointer sent in EbSvtIOFormat points luma_offset
+ * (resp. chroma_offset) samples past the start of a buffer of luma_size
+ * (resp. chroma_size) bytes, aligned on alignment bytes, and the strides sent
+ * must be y_stride and chroma_stride. 10-bit input is sent split: luma, cb
+ * and cr hold the 8 MSBs of the samples, and luma_ext, cb_ext and cr_ext hold
+ * the 2 LSBs in the 2 upper bits of one byte per sample, in buffers laid out
+ * the same way as the MSBs ones.
+ */
+typedef struct SvtAv1InputLayout {
+    uint32_t y_stride; /**< Luma stride, in samples */
+    uint32_t chroma_stride; /**< Cb and cr stride, in samples */
+    uint32_t luma_offset; /**< Offset of the picture in the luma buffer */
+    uint32_t chroma_offset; /**< Offset of the picture in the chroma buffers */
+    uint32_t alignment; /**< Required alignment of the start of each buffer */
+    uint64_t luma_size; /**< Size of the luma buffer, padding included */
+    uint64_t chroma_size; /**< Size of each chroma buffer, padding included */
+    uint64_t luma_ext_size; /**< Size of the luma 2 LSBs buffer, 0 in 8-bit */
+    uint64_t chroma_ext_size; /**< Size of each chroma 2 LSBs buffer, 0 in 8-bit */
+} SvtAv1InputLayout;
+
+#define SVT_AV1_MAX_NUMA_NODES 16
+
+/*!\brief NUMA placement of the encoder
+ *
+ * The pages of the picture buffer pools (input, reference and PA reference
+ * pictures) are counted on the node they reside on. Pages that were not yet
+ * touched have no node and are counted as unplaced. Only the first
+ * SVT_AV1_MAX_NUMA_NODES nodes are reported, the pages of the other nodes are
+ * counted as remote.
+ */
+typedef struct SvtAv1MemoryLocality {
+    uint32_t num_nodes; /**< Number of NUMA nodes of the system */
+    uint32_t numa_policy; /**< numa_policy in use, 0 when NUMA is not supported */
+    uint32_t threads[SVT_AV1_MAX_NUMA_NODES]; /**< Encoder threads placed on each node */
+    uint64_t pages[SVT_AV1_MAX_NUMA_NODES]; /**< Picture buffer pages on each node */
+    uint64_t local_pages; /**< Pages on a node running encoder threads */
+    uint64_t remote_pages; /**< Pages on a node running no encoder thread */
+    uint64_t unplaced_pages; /**< Pages not touched yet */
+} SvtAv1MemoryLocality;
+
+#define SVT_AV1_MAX_PIPELINE_STAGES 32
+
+/*!\brief Activity of the threads of a pipeline stage
+ *
+ * The times are summed over the threads of the stage. A thread is idle while
+ * it waits for an input object, stalled while it waits for an empty output
+ * object, i.e. while the next stages hold all of them, and busy otherwise.
+ * The queue depth is the number of input objects ready when a thread asks
+ * for one, 0 meaning that the thread starves.
+ */
+typedef struct SvtAv1StageProfile {
+    const char *name; /**< Name of the stage, e.g. "enc_dec" */
+    uint32_t    thread_count; /**< Number of threads of the stage */
+    uint64_t    objects; /**< Input objects processed */
+    uint64_t    busy_us; /**< Time spent processing the objects */
+    uint64_t    idle_us; /**< Time spent waiting for input objects */
+    uint64_t    stall_us; /**< Time spent waiting for empty output objects */
+    double      avg_queue_depth; /**< Average input queue depth */
+    uint32_t    max_queue_depth; /**< Maximum input queue depth */
+} SvtAv1StageProfile;
+
+/*!\brief Activity of the encoder pipeline, see pipeline_profile */
+typedef struct SvtAv1PipelineProfile {
+    uint64_t           elapsed_us; /**< Time since the threads were created */
+    uint32_t           num_stages; /**< Number of stages, in pipeline order */
+    uint64_t           dropped_events; /**< Trace events dropped for lack of memory */
+    SvtAv1StageProfile stages[SVT_AV1_MAX_PIPELINE_STAGES];
+} SvtAv1PipelineProfile;
+
+/*!\brief Encoder context shared by several encoder handles
+ *
+ * The handles attached to a context, e.g. the renditions of an ABR ladder,
+ * run their processing threads on the workers of the context instead of
+ * each oversubscribing the cores, and use the CPU dispatch and the static
+ * tables set up once by the context. See svt_av1_enc_context_create() and
+ * EbSvtAv1EncConfiguration.shared_context.
+ */
+typedef struct SvtAv1EncContext SvtAv1EncContext;
+
+typedef struct SvtAv1EncContextConfig {
+    /* Number of processing threads of all the attached handles that run at
+     * the same time, 0 for the number of logical processors. */
+    uint32_t worker_count;
+    /* CPU FLAGS of the attached handles, their use_cpu_flags is ignored. */
+    CPU_FLAGS use_cpu_flags;
+} SvtAv1EncContextConfig;
+
 // Will contain the EbEncApi which will live in the EncHandle class
 // Only modifiable during config-time.
 typedef struct EbSvtAv1EncConfiguration {
@@ -196,6 +310,27 @@ typedef struct EbSvtAv1EncConfiguration {
      * Default is 0. */
     uint32_t compressed_ten_bit_format;
 
+    /* Zero-copy input: svt_av1_enc_send_picture() references the planes of
+     * the caller instead of copying them. The planes must follow the layout
+     * returned for SVT_AV1_STREAM_INFO_INPUT_LAYOUT, 10-bit input being split
+     * in 8 MSBs and 2 LSBs planes. The encoder owns the planes until it calls
+     * input_release_cb with the p_app_private of the buffer header they were
+     * sent with, and writes into them:
+     * - the padding around the picture, always;
+     * - the picture itself when temporal filtering filters it in place
+     *   (tf_level other than 0) or film grain denoising is on
+     *   (film_grain_denoise_strength other than 0).
+     * With both off, the picture is unchanged when the planes are released.
+     *
+     * Default is 0. */
+    EbBool zero_copy_input;
+    /* Called from an encoder thread once per picture sent in zero-copy mode,
+     * when the encoder no longer references its planes. Must be set when
+     * zero_copy_input is 1. */
+    void (*input_release_cb)(void *input_release_cb_data, void *p_app_private);
+    /* Passed back to input_release_cb. */
+    void *input_release_cb_data;
+
     /* Super block size for motion estimation
     *
     * Default is 64. */
@@ -214,6 +349,12 @@ typedef struct EbSvtAv1EncConfiguration {
     *
     * Default is 0.*/
     uint32_t stat_report;
+    /* Attach the statistics of the coded frames to the output packets, see
+     * EbFrameStats. The distortion statistics also need stat_report.
+     * 0 = OFF, 1 = frame statistics, 2 = frame and superblock statistics.
+     *
+     * Default is 0.*/
+    uint8_t frame_stats;
 
     // Quantization
     /* Initial quantization parameter for the Intra pictures used under constant
@@ -647,6 +788,81 @@ typedef struct EbSvtAv1EncConfiguration {
      * Default is -1. */
     int32_t target_socket;
 
+    /* Cap the runnable processing threads at one per logical processor
+     * used by the encoder. A processing thread needs one of these workers
+     * to run and gives it back whenever it waits for input or for another
+     * thread, so the cores go to the stages that have work instead of being
+     * time-sliced among all the threads. The threads and the fifos between
+     * them are unchanged, it is not a task scheduler.
+     *
+     * 0 = OFF, every processing thread is scheduled by the OS.
+     * 1 = ON.
+     *
+     * Default is 0. */
+    EbBool enable_worker_pool;
+
+    /* Encoder context to attach the handle to, see SvtAv1EncContext. The
+     * workers of the context are shared fairly among the attached handles: a
+     * freed worker goes to the handle holding the fewest, so a stream with
+     * many runnable threads cannot starve the others. All the handles
+     * attached at the same time must use the same super block size.
+     * enable_worker_pool is ignored.
+     *
+     * NULL = the handle runs on its own threads.
+     *
+     * Default is NULL. */
+    SvtAv1EncContext *shared_context;
+
+    /* Share the look-ahead analysis among the renditions of an ABR ladder
+     * attached to shared_context and encoding the same input. The source
+     * rendition, normally the one of highest resolution, publishes its scene
+     * change decisions and the TPL costs of its base layer pictures. The
+     * other renditions take the scene changes as they are and project the
+     * TPL costs onto their own block grid instead of running the scene
+     * change detection and the TPL motion search. A rendition runs its own
+     * analysis of the pictures the source has nothing for. The source must
+     * be initialized before the renditions, and a context has one source.
+     *
+     * 0 = OFF.
+     * 1 = source rendition.
+     * 2 = rendition reusing the analysis of the source.
+     *
+     * Default is 0. */
+    uint8_t ladder_analysis;
+
+    /* NUMA placement of the encoder threads and memory. Linux only.
+     *
+     * 0 = OFF, the memory is placed by the OS on the node of the thread
+     *     touching it first.
+     * 1 = Node, the threads run on numa_node and the picture pools, the
+     *     contexts and the memory of the threads are allocated from it, to
+     *     pin each encoder instance to a node.
+     * 2 = Shard, the pipeline stages are spread across the nodes: the threads
+     *     and the context of each stage are placed on one node and the picture
+     *     pools, shared by all the stages, are interleaved across the nodes.
+     *
+     * Default is 0. */
+    uint32_t numa_policy;
+
+    /* NUMA node the encoder runs on when numa_policy is 1.
+     *
+     * -1 = The node of the thread calling svt_av1_enc_init().
+     *
+     * Default is -1. */
+    int32_t numa_node;
+
+    // Memory management
+
+    /* Memory budget in MB for the picture buffer pools of the encoder. When
+     * set, the pools are sized down towards the minimum needed to sustain the
+     * pipeline until their estimated footprint fits the budget. The memory of
+     * the processing threads is not part of the budget, see logical_processors.
+     *
+     * 0 = No budget, the pools are sized from the core count.
+     *
+     * Default is 0. */
+    uint32_t max_memory_mb;
+
     // Debug tools
 
     /* Output reconstructed yuv used for debug purposes. The value is set through
@@ -654,6 +870,18 @@ typedef struct EbSvtAv1EncConfiguration {
      *
      * Default is 0. */
     uint32_t recon_enabled;
+
+    /* Profile the pipeline: the time each encoder thread spends processing,
+     * waiting for input and waiting for room in its output, and the depth of
+     * the input queues, see SVT_AV1_STREAM_INFO_PIPELINE_PROFILE.
+     *
+     * 0 = OFF.
+     * 1 = Counters of each stage.
+     * 2 = Counters and trace of each thread, see
+     *     SVT_AV1_STREAM_INFO_PIPELINE_TRACE.
+     *
+     * Default is 0. */
+    uint8_t pipeline_profile;
     /* Log 2 Tile Rows and colums . 0 means no tiling,1 means that we split the dimension
         * into 2
         * Default is 0. */
@@ -720,8 +948,37 @@ typedef struct EbSvtAv1EncConfiguration {
    *
    * Default is 0. */
     int32_t manual_pred_struct_entry_num;
+
+    // New parameters are added at the end to keep the layout of the
+    // parameters above
+
+    /* Low latency mode for interactive use. Pictures are coded in input order
+     * as soon as they arrive: a flat prediction structure is used and no
+     * picture is held back for look ahead, temporal filtering or TPL. Each
+     * tile is output through svt_av1_enc_get_packet() as soon as it is coded,
+     * in a tile group OBU. Every packet of a temporal unit but the last one
+     * carries EB_BUFFERFLAG_PARTIAL.
+     *
+     * Default is 0. */
+    EbBool low_latency_mode;
 } EbSvtAv1EncConfiguration;
 
+/* OPTIONAL: Create an encoder context to share among several handles, before
+     * calling svt_av1_enc_set_parameter() on them.
+     *
+     * Parameter:
+     * @ **context  Created context.
+     * @ *config    Configuration of the context. */
+EB_API EbErrorType svt_av1_enc_context_create(SvtAv1EncContext **           context,
+                                              const SvtAv1EncContextConfig *config);
+
+/* OPTIONAL: Destroy an encoder context once all the handles attached to it
+     * are deconstructed.
+     *
+     * Parameter:
+     * @ *context  Context. */
+EB_API EbErrorType svt_av1_enc_context_destroy(SvtAv1EncContext *context);
+
 /* STEP 1: Call the library to construct a Component Handle.
      *
      * Parameter:
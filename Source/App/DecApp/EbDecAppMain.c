@@ -126,6 +126,23 @@ static void show_progress(int in_frame, uint64_t dx_time) {
             (double)in_frame * 1000000.0 / (double)dx_time);
 }
 
+static void show_parse_rate(int in_frame, uint64_t parsed_bytes, uint64_t dx_time) {
+    /* The tiles are parsed by a single thread in parse only mode, the rate is
+       the one of the tile group data */
+    fprintf(stderr,
+            "%d frames parsed in %" PRId64 " us (%.2f Mbit/s of tile data per thread)\n",
+            in_frame,
+            dx_time,
+            dx_time ? (double)parsed_bytes * 8 / (double)dx_time : 0.0);
+}
+
+static void show_cpu_usage(int in_frame, uint64_t cpu_time) {
+    fprintf(stderr,
+            "CPU time: %" PRId64 " us (%.2f ms per frame)\n",
+            cpu_time,
+            in_frame ? (double)cpu_time / 1000.0 / in_frame : 0.0);
+}
+
 /***************************************
  * Decoder App Main
  ***************************************/
@@ -152,14 +169,16 @@ int32_t main(int32_t argc, char *argv[]) {
     input.cli_ctx              = &cli;
     input.obu_ctx              = &obu_ctx;
 
-    uint64_t stop_after = 0;
-    uint32_t in_frame   = 0;
+    uint64_t stop_after   = 0;
+    uint32_t in_frame     = 0;
+    uint64_t parsed_bytes = 0;
 
     Md5Context    md5_ctx;
     unsigned char md5_digest[16];
 
     struct EbDecTimer timer;
     uint64_t          dx_time     = 0;
+    int64_t           cpu_start   = 0;
     int               fps_frm     = 0;
     int               fps_summary = 0;
 
@@ -224,21 +243,41 @@ int32_t main(int32_t argc, char *argv[]) {
             stop_after = config_ptr->frames_to_be_decoded;
             if (enable_md5)
                 md5_init(&md5_ctx);
+            cpu_start = dec_process_cpu_time();
             // Input Loop Thread
             while (read_input_frame(&input, &buf, &bytes_in_buffer, &buffer_size, NULL)) {
                 if (!stop_after || in_frame < stop_after) {
+                    /* Outside of the timed decode */
+                    if (config_ptr->parse_only)
+                        parsed_bytes += obu_tile_data_size(buf, bytes_in_buffer, obu_ctx.is_annexb);
                     dec_timer_start(&timer);
 
-                    return_error |= svt_av1_dec_frame(
+                    EbErrorType dec_status = svt_av1_dec_frame(
                         p_handle, buf, bytes_in_buffer, obu_ctx.is_annexb);
+                    /* Parallel frames : make room in the output queue and send again */
+                    while (dec_status == EB_DecOutputQueueFull &&
+                           svt_av1_dec_get_picture(
+                               p_handle, recon_buffer, stream_info, frame_info) !=
+                               EB_DecNoOutputPicture) {
+                        if (enable_md5)
+                            write_md5(recon_buffer, &md5_ctx);
+                        if (cli.out_file != NULL)
+                            write_frame(recon_buffer, &cli);
+                        dec_status = svt_av1_dec_frame(
+                            p_handle, buf, bytes_in_buffer, obu_ctx.is_annexb);
+                    }
+                    return_error |= dec_status;
+
+                    in_frame++;
+
+                    /* With parallel frames the picture may only be available later */
+                    EbErrorType pic_status = svt_av1_dec_get_picture(
+                        p_handle, recon_buffer, stream_info, frame_info);
 
                     dec_timer_mark(&timer);
                     dx_time += dec_timer_elapsed(&timer);
 
-                    in_frame++;
-
-                    if (svt_av1_dec_get_picture(p_handle, recon_buffer, stream_info, frame_info) !=
-                        EB_DecNoOutputPicture) {
+                    if (pic_status != EB_DecNoOutputPicture) {
                         if (fps_frm)
                             show_progress(in_frame, dx_time);
 
@@ -250,10 +289,28 @@ int32_t main(int32_t argc, char *argv[]) {
                 } else
                     break;
             }
-            if (fps_summary || fps_frm) {
+            if (config_ptr->num_p_frames > 1) {
+                /* End of stream : get the pictures still in flight */
+                dec_timer_start(&timer);
+                return_error |= svt_av1_dec_frame(p_handle, NULL, 0, obu_ctx.is_annexb);
+                while (svt_av1_dec_get_picture(p_handle, recon_buffer, stream_info, frame_info) !=
+                       EB_DecNoOutputPicture) {
+                    dec_timer_mark(&timer);
+                    dx_time += dec_timer_elapsed(&timer);
+                    if (enable_md5)
+                        write_md5(recon_buffer, &md5_ctx);
+                    if (cli.out_file != NULL)
+                        write_frame(recon_buffer, &cli);
+                    dec_timer_start(&timer);
+                }
+            }
+            if (config_ptr->parse_only)
+                show_parse_rate(in_frame, parsed_bytes, dx_time);
+            else if (fps_summary || fps_frm) {
                 assert(dx_time > 0);
                 show_progress(in_frame, dx_time);
                 fprintf(stderr, "\n");
+                show_cpu_usage(in_frame, dec_process_cpu_time() - cpu_start);
             }
 
             if (enable_md5) {
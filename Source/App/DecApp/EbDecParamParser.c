@@ -58,14 +58,20 @@ static void set_num_thread(const char *value, EbSvtAv1DecConfiguration *cfg) {
 };
 static void set_num_pframes(const char *value, EbSvtAv1DecConfiguration *cfg) {
     cfg->num_p_frames = strtoul(value, NULL, 0);
-    if (cfg->num_p_frames != 1) {
-        fprintf(
-            stderr,
-            "Warning : Multi frame parallelism not supported. Setting parallel frames to 1. \n");
+    if (cfg->num_p_frames == 0) {
+        fprintf(stderr, "Warning : Invalid value for parallel frames, setting value to 1. \n");
         cfg->num_p_frames = 1;
     }
 };
 
+static void set_thread_spin_count(const char *value, EbSvtAv1DecConfiguration *cfg) {
+    cfg->thread_spin_count = strtoul(value, NULL, 0);
+};
+
+static void set_parse_only(const char *value, EbSvtAv1DecConfiguration *cfg) {
+    cfg->parse_only = (EbBool)strtoul(value, NULL, 0);
+};
+
 /**********************************
   * Config Entry Array
   **********************************/
@@ -81,6 +87,8 @@ ConfigEntry config_entry[] = {
     {COLOUR_SPACE_TOKEN, "InputColourSpace", 1, set_colour_space},
     {THREADS_TOKEN, "ThreadCount", 1, set_num_thread},
     {FRAME_PLL_TOKEN, "PllFrameCount", 1, set_num_pframes},
+    {SPIN_COUNT_TOKEN, "ThreadSpinCount", 1, set_thread_spin_count},
+    {PARSE_ONLY_TOKEN, "ParseOnly", 0, set_parse_only},
     // Termination
     {NULL, NULL, 0, NULL}};
 
@@ -97,10 +105,12 @@ static void show_help() {
     H0(" -h <arg>                  Input picture height \n");
     H0(" -colour-space <arg>       Input picture colour space. [400, 420, 422, 444]\n");
     H0(" -threads <arg>            Number of threads to be launched \n");
-    H0(" -parallel-frames <arg>    Number of frames to be processed in parallel \n");
+    H0(" -parallel-frames <arg>    Frames in flight in the parse / reconstruction pipeline \n");
+    H0(" -spin-count <arg>         Polls on a pending dependency before a thread blocks \n");
+    H0(" -parse-only               Only parse the tiles, report the tile data Mbit/s per thread \n");
     H0(" -md5                      MD5 support flag \n");
     H0(" -fps-frm                  Show fps after each frame decoded\n");
-    H0(" -fps-summary              Show fps summary");
+    H0(" -fps-summary              Show fps and CPU time per frame summary");
     H0(" -skip-film-grain          Disable Film Grain");
     H0(" -16bit-pipeline           Enable 16b pipeline. [1 - enable, 0 - disable]");
 
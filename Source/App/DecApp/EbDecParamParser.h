@@ -46,6 +46,8 @@
 #define COLOUR_SPACE_TOKEN "-colour-space"
 #define THREADS_TOKEN "-threads"
 #define FRAME_PLL_TOKEN "-parallel-frames"
+#define SPIN_COUNT_TOKEN "-spin-count"
+#define PARSE_ONLY_TOKEN "-parse-only"
 #define MD5_SUPPORT_TOKEN "-md5"
 #define FPS_FRM_TOKEN "-fps-frm"
 #define FPS_SUMMARY_TOKEN "-fps-summary"
@@ -43,3 +43,25 @@ int64_t dec_timer_elapsed(struct EbDecTimer *t) {
     return ((int64_t)diff.tv_sec) * 1000000 + diff.tv_usec;
 #endif
 }
+
+int64_t dec_process_cpu_time(void) {
+#if defined(_WIN32)
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (!GetProcessTimes(
+            GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time))
+        return 0;
+    ULARGE_INTEGER kernel, user;
+    kernel.LowPart  = kernel_time.dwLowDateTime;
+    kernel.HighPart = kernel_time.dwHighDateTime;
+    user.LowPart    = user_time.dwLowDateTime;
+    user.HighPart   = user_time.dwHighDateTime;
+    /* FILETIME is expressed in 100 ns units */
+    return (int64_t)((kernel.QuadPart + user.QuadPart) / 10);
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage))
+        return 0;
+    return ((int64_t)usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000 +
+        usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+#endif
+}
@@ -27,6 +27,7 @@
   * POSIX specific includes
   */
 #include <sys/time.h>
+#include <sys/resource.h>
 
 /* timersub is not provided by msys at this time. */
 #ifndef timersub
@@ -53,3 +54,5 @@ struct EbDecTimer {
 void    dec_timer_start(struct EbDecTimer *t);
 void    dec_timer_mark(struct EbDecTimer *t);
 int64_t dec_timer_elapsed(struct EbDecTimer *t);
+/* CPU time (user + system) consumed by all threads of the process, in us */
+int64_t dec_process_cpu_time(void);
@@ -209,6 +209,54 @@ int svt_read_obu_header(uint8_t *buffer, size_t buffer_length, size_t *consumed,
     return parse_result;
 }
 
+// Returns the size of the OBU_TILE_GROUP and OBU_FRAME payloads of the
+// temporal unit in 'buffer', the data of the tiles plus the frame header of
+// the OBU_FRAMEs. The walk stops at the first OBU which does not fit.
+size_t obu_tile_data_size(uint8_t *buffer, size_t buffer_length, uint32_t is_annexb) {
+    size_t tile_data_size = 0;
+
+    while (buffer_length > 0) {
+        uint64_t  obu_length  = 0;
+        uint64_t  payload_size;
+        size_t    length_size = 0;
+        size_t    header_size = 0;
+        ObuHeader obu_header;
+
+        if (is_annexb) {
+            if (uleb_decode(buffer, buffer_length, &obu_length, &length_size) != 0)
+                break;
+            buffer += length_size;
+            buffer_length -= length_size;
+            if (obu_length > buffer_length)
+                break;
+        }
+        if (svt_read_obu_header(buffer, buffer_length, &header_size, &obu_header, is_annexb) !=
+            0)
+            break;
+        if (obu_header.has_size_field) {
+            if (uleb_decode(buffer + header_size,
+                            buffer_length - header_size,
+                            &payload_size,
+                            &length_size) != 0)
+                break;
+            header_size += length_size;
+        } else if (obu_length >= header_size)
+            payload_size = obu_length - header_size;
+        else
+            break;
+        if (payload_size > buffer_length - header_size)
+            break;
+
+        if (obu_header.type == OBU_TILE_GROUP || obu_header.type == OBU_FRAME)
+            tile_data_size += (size_t)payload_size;
+
+        const size_t obu_size = is_annexb ? (size_t)obu_length : header_size + (size_t)payload_size;
+        buffer += obu_size;
+        buffer_length -= obu_size;
+    }
+    return tile_data_size;
+}
+
 // Reads OBU header from 'f'. The 'buffer_capacity' passed in must be large
 // enough to store an OBU header with extension (2 bytes). Raw OBU data is
 // written to 'obu_data', parsed OBU header values are written to 'obu_header',
@@ -111,6 +111,8 @@ int file_is_obu(CliInput *cli, ObuDecInputContext *obu_ctx);
 int obudec_read_temporal_unit(DecInputContext *input, uint8_t **buffer, size_t *bytes_read,
                               size_t *buffer_size);
 
+size_t obu_tile_data_size(uint8_t *buffer, size_t buffer_length, uint32_t is_annexb);
+
 int file_is_ivf(CliInput *cli);
 int read_ivf_frame(FILE *infile, uint8_t **buffer, size_t *bytes_read, size_t *buffer_size,
                    int64_t *pts);
@@ -17,6 +17,7 @@
 #include "EbAppConfig.h"
 #include "EbAppContext.h"
 #include "EbAppInputy4m.h"
+#include "EbAppInputReader.h"
 #ifdef _WIN32
 #include <windows.h>
 #include <io.h>
@@ -51,11 +52,15 @@
 #define INPUT_STAT_FILE_TOKEN "-input-stat-file"
 #define OUTPUT_STAT_FILE_TOKEN "-output-stat-file"
 #define STAT_FILE_TOKEN "-stat-file"
+#define FRAME_STATS_FILE_TOKEN "-frame-stats-file"
+#define FRAME_STATS_FORMAT_TOKEN "-frame-stats-format"
+#define PIPELINE_TRACE_FILE_TOKEN "-pipeline-trace-file"
 #define INPUT_PREDSTRUCT_FILE_TOKEN "-pred-struct-file"
 #define WIDTH_TOKEN "-w"
 #define HEIGHT_TOKEN "-h"
 #define NUMBER_OF_PICTURES_TOKEN "-n"
 #define BUFFERED_INPUT_TOKEN "-nb"
+#define READ_AHEAD_TOKEN "-read-ahead"
 #define NO_PROGRESS_TOKEN "--no-progress" // tbd if it should be removed
 #define PROGRESS_TOKEN "--progress"
 #define BASE_LAYER_SWITCH_MODE_TOKEN "-base-layer-switch-mode" // no Eval
@@ -69,6 +74,7 @@
 #define CHROMA_QINDEX_OFFSETS_TOKEN "-chroma-qindex-offsets"
 #endif
 #define STAT_REPORT_TOKEN "-stat-report"
+#define FRAME_STATS_TOKEN "-frame-stats"
 #define FRAME_RATE_TOKEN "-fps"
 #define FRAME_RATE_NUMERATOR_TOKEN "-fps-num"
 #define FRAME_RATE_DENOMINATOR_TOKEN "-fps-denom"
@@ -79,6 +85,7 @@
 #define ENCMODE_TOKEN "-enc-mode"
 #define HIERARCHICAL_LEVELS_TOKEN "-hierarchical-levels" // no Eval
 #define PRED_STRUCT_TOKEN "-pred-struct"
+#define LOW_LATENCY_TOKEN "-low-latency"
 #define INTRA_PERIOD_TOKEN "-intra-period"
 #define PROFILE_TOKEN "-profile"
 #define TIER_TOKEN "-tier"
@@ -167,6 +174,13 @@
 #define THREAD_MGMNT "-lp"
 #define UNPIN_TOKEN "-unpin"
 #define TARGET_SOCKET "-ss"
+#define MAX_MEMORY_TOKEN "-max-memory"
+#define WORKER_POOL_TOKEN "-worker-pool"
+#define PIPELINE_PROFILE_TOKEN "-pipeline-profile"
+#define SHARED_CONTEXT_TOKEN "-shared-context"
+#define LADDER_ANALYSIS_TOKEN "-ladder-analysis"
+#define NUMA_POLICY_TOKEN "-numa-policy"
+#define NUMA_NODE_TOKEN "-numa-node"
 #define UNRESTRICTED_MOTION_VECTOR "-umv"
 #define CONFIG_FILE_COMMENT_CHAR '#'
 #define CONFIG_FILE_NEWLINE_CHAR '\n'
@@ -358,6 +372,34 @@ static void set_cfg_stat_file(const char *value, EbConfig *cfg) {
 static void set_stat_report(const char *value, EbConfig *cfg) {
     cfg->config.stat_report = (uint8_t)strtoul(value, NULL, 0);
 };
+static void set_cfg_frame_stats_file(const char *value, EbConfig *cfg) {
+    if (cfg->frame_stats_file) {
+        fclose(cfg->frame_stats_file);
+    }
+    FOPEN(cfg->frame_stats_file, value, "w");
+    // the frame statistics are needed to fill the file, --frame-stats can ask for more
+    if (!cfg->config.frame_stats)
+        cfg->config.frame_stats = 1;
+};
+static void set_frame_stats_format(const char *value, EbConfig *cfg) {
+    if (!strcmp(value, "csv"))
+        cfg->frame_stats_format = FRAME_STATS_CSV;
+    else if (!strcmp(value, "json"))
+        cfg->frame_stats_format = FRAME_STATS_JSON;
+    else
+        cfg->frame_stats_format = FRAME_STATS_FORMAT_INVALID;
+};
+static void set_cfg_pipeline_trace_file(const char *value, EbConfig *cfg) {
+    if (cfg->pipeline_trace_file) {
+        fclose(cfg->pipeline_trace_file);
+    }
+    FOPEN(cfg->pipeline_trace_file, value, "wb");
+    // The trace needs the events of the threads
+    cfg->config.pipeline_profile = 2;
+};
+static void set_frame_stats(const char *value, EbConfig *cfg) {
+    cfg->config.frame_stats = (uint8_t)strtoul(value, NULL, 0);
+};
 static void set_cfg_source_width(const char *value, EbConfig *cfg) {
     cfg->config.source_width = strtoul(value, NULL, 0);
 };
@@ -370,6 +412,9 @@ static void set_cfg_frames_to_be_encoded(const char *value, EbConfig *cfg) {
 static void set_buffered_input(const char *value, EbConfig *cfg) {
     cfg->buffered_input = strtol(value, NULL, 0);
 };
+static void set_read_ahead(const char *value, EbConfig *cfg) {
+    cfg->read_ahead = strtol(value, NULL, 0);
+};
 static void set_no_progress(const char *value, EbConfig *cfg) {
     switch (value ? *value : '1') {
     case '0': cfg->progress = 1; break; // equal to --progress 1
@@ -422,6 +467,9 @@ static void set_hierarchical_levels(const char *value, EbConfig *cfg) {
 static void set_cfg_pred_structure(const char *value, EbConfig *cfg) {
     cfg->config.pred_structure = (uint8_t)strtol(value, NULL, 0);
 };
+static void set_low_latency_mode(const char *value, EbConfig *cfg) {
+    cfg->config.low_latency_mode = (EbBool)strtol(value, NULL, 0);
+};
 static void set_cfg_qp(const char *value, EbConfig *cfg) {
     cfg->config.qp = strtoul(value, NULL, 0);
 };
@@ -744,6 +792,7 @@ static void set_asm_type(const char *value, EbConfig *cfg) {
         {"9", (CPU_FLAGS_AVX2 << 1) - 1},
         {"avx512", (CPU_FLAGS_AVX512VL << 1) - 1},
         {"10", (CPU_FLAGS_AVX512VL << 1) - 1},
+        {"neon", (CPU_FLAGS_NEON << 1) - 1},
         {"max", CPU_FLAGS_ALL},
         {"11", CPU_FLAGS_ALL},
     };
@@ -768,6 +817,27 @@ static void set_unpin_execution(const char *value, EbConfig *cfg) {
 static void set_target_socket(const char *value, EbConfig *cfg) {
     cfg->config.target_socket = (int32_t)strtol(value, NULL, 0);
 };
+static void set_worker_pool(const char *value, EbConfig *cfg) {
+    cfg->config.enable_worker_pool = (EbBool)strtol(value, NULL, 0);
+};
+static void set_pipeline_profile(const char *value, EbConfig *cfg) {
+    cfg->config.pipeline_profile = (uint8_t)strtoul(value, NULL, 0);
+};
+static void set_shared_context(const char *value, EbConfig *cfg) {
+    cfg->shared_context = (EbBool)strtol(value, NULL, 0);
+};
+static void set_ladder_analysis(const char *value, EbConfig *cfg) {
+    cfg->config.ladder_analysis = (uint8_t)strtoul(value, NULL, 0);
+};
+static void set_numa_policy(const char *value, EbConfig *cfg) {
+    cfg->config.numa_policy = (uint32_t)strtoul(value, NULL, 0);
+};
+static void set_numa_node(const char *value, EbConfig *cfg) {
+    cfg->config.numa_node = (int32_t)strtol(value, NULL, 0);
+};
+static void set_max_memory(const char *value, EbConfig *cfg) {
+    cfg->config.max_memory_mb = (uint32_t)strtoul(value, NULL, 0);
+};
 static void set_unrestricted_motion_vector(const char *value, EbConfig *cfg) {
     cfg->config.unrestricted_motion_vector = (EbBool)strtol(value, NULL, 0);
 };
@@ -804,6 +874,18 @@ ConfigEntry config_entry_options[] = {
     {SINGLE_INPUT, OUTPUT_RECON_LONG_TOKEN, "Recon filename", set_cfg_recon_file},
 
     {SINGLE_INPUT, STAT_FILE_TOKEN, "Stat filename", set_cfg_stat_file},
+    {SINGLE_INPUT,
+     FRAME_STATS_FILE_TOKEN,
+     "Frame statistics filename, one line per coded frame",
+     set_cfg_frame_stats_file},
+    {SINGLE_INPUT,
+     FRAME_STATS_FORMAT_TOKEN,
+     "Format of the frame statistics file (csv[default], json: JSON lines)",
+     set_frame_stats_format},
+    {SINGLE_INPUT,
+     PIPELINE_TRACE_FILE_TOKEN,
+     "Pipeline trace filename, Chrome trace event JSON of the encoder threads",
+     set_cfg_pipeline_trace_file},
     {SINGLE_INPUT, NULL, NULL, NULL}};
 
 ConfigEntry config_entry_global_options[] = {
@@ -824,6 +906,10 @@ ConfigEntry config_entry_global_options[] = {
      set_cfg_frames_to_be_encoded},
 
     {SINGLE_INPUT, BUFFERED_INPUT_TOKEN, "Buffer n input frames", set_buffered_input},
+    {SINGLE_INPUT,
+     READ_AHEAD_TOKEN,
+     "Read n input frames ahead of the encoder in the background",
+     set_read_ahead},
     {SINGLE_INPUT,
      PROGRESS_TOKEN,
      "Change verbosity of the output (0: no progress is printed, 1: default, 2: aomenc style "
@@ -867,6 +953,10 @@ ConfigEntry config_entry_global_options[] = {
      PRED_STRUCT_TOKEN,
      "Set prediction structure( 0: low delay P, 1: low delay B, 2: random access [default])",
      set_cfg_pred_structure},
+    {SINGLE_INPUT,
+     LOW_LATENCY_TOKEN,
+     "Code the pictures in input order and output each tile as soon as it is coded (0: OFF[default], 1: ON)",
+     set_low_latency_mode},
     //{SINGLE_INPUT,
     // HDR_INPUT_TOKEN,
     // "Enable high dynamic range(0: OFF[default], ON: 1)",
@@ -879,7 +969,7 @@ ConfigEntry config_entry_global_options[] = {
     {SINGLE_INPUT,
      ASM_TYPE_TOKEN,
      "Limit assembly instruction set [0 - 11] or [c, mmx, sse, sse2, sse3, ssse3, sse4_1, sse4_2,"
-     " avx, avx2, avx512, max], by default highest level supported by CPU",
+     " avx, avx2, avx512, neon, max], by default highest level supported by CPU",
      set_asm_type},
     {SINGLE_INPUT, THREAD_MGMNT, "number of logical processors to be used", set_logical_processors},
     {SINGLE_INPUT,
@@ -898,6 +988,40 @@ ConfigEntry config_entry_global_options[] = {
      "Specify  which socket the encoder runs on"
      "--unpin is overwritten to 0 when --ss is set to 0 or 1",
      set_target_socket},
+    {SINGLE_INPUT,
+     WORKER_POOL_TOKEN,
+     "Cap the runnable processing threads at one per logical processor, a thread gives its "
+     "worker back while it waits (0: OFF [default], 1: ON)",
+     set_worker_pool},
+    {SINGLE_INPUT,
+     PIPELINE_PROFILE_TOKEN,
+     "Profile the busy, idle and stalled time of the pipeline stages (0: OFF [default], "
+     "1: counters, 2: counters and trace)",
+     set_pipeline_profile},
+    {SINGLE_INPUT,
+     SHARED_CONTEXT_TOKEN,
+     "Share the workers and the tables of the channels having it set, e.g. the renditions of a "
+     "ladder encoded with -nch (0: OFF [default], 1: ON)",
+     set_shared_context},
+    {SINGLE_INPUT,
+     LADDER_ANALYSIS_TOKEN,
+     "Share the scene changes and the TPL analysis among the channels of a shared context "
+     "encoding the same input (0: OFF [default], 1: source, 2: rendition)",
+     set_ladder_analysis},
+    {SINGLE_INPUT,
+     NUMA_POLICY_TOKEN,
+     "NUMA placement of the threads and memory (0: OFF [default], 1: run on --numa-node, "
+     "2: spread the pipeline stages across the nodes)",
+     set_numa_policy},
+    {SINGLE_INPUT,
+     NUMA_NODE_TOKEN,
+     "NUMA node to run on with --numa-policy 1 (-1: node of the calling thread [default])",
+     set_numa_node},
+    {SINGLE_INPUT,
+     MAX_MEMORY_TOKEN,
+     "Memory budget in MB for the picture buffers, the buffer pools are reduced to fit it "
+     "(0: no budget [default])",
+     set_max_memory},
     // Termination
     {SINGLE_INPUT, NULL, NULL, NULL}};
 
@@ -1236,6 +1360,11 @@ ConfigEntry config_entry_specific[] = {
      set_enable_overlays},
     // --- end: ALTREF_FILTERING_SUPPORT
     {SINGLE_INPUT, STAT_REPORT_NEW_TOKEN, "Stat Report", set_stat_report},
+    {SINGLE_INPUT,
+     FRAME_STATS_TOKEN,
+     "Attach the statistics of the coded frames to the output packets (0: OFF[default], 1: "
+     "frames, 2: frames and superblocks)",
+     set_frame_stats},
     {SINGLE_INPUT,
      INTRA_ANGLE_DELTA_NEW_TOKEN,
      "Enable intra angle delta filtering filtering (0: OFF, 1: ON, -1: DEFAULT)",
@@ -1258,6 +1387,9 @@ ConfigEntry config_entry[] = {
     {SINGLE_INPUT, OUTPUT_RECON_TOKEN, "ReconFile", set_cfg_recon_file},
     {SINGLE_INPUT, QP_FILE_TOKEN, "QpFile", set_cfg_qp_file},
     {SINGLE_INPUT, STAT_FILE_TOKEN, "StatFile", set_cfg_stat_file},
+    {SINGLE_INPUT, FRAME_STATS_FILE_TOKEN, "FrameStatsFile", set_cfg_frame_stats_file},
+    {SINGLE_INPUT, FRAME_STATS_FORMAT_TOKEN, "FrameStatsFormat", set_frame_stats_format},
+    {SINGLE_INPUT, PIPELINE_TRACE_FILE_TOKEN, "PipelineTraceFile", set_cfg_pipeline_trace_file},
 
     // two pass
     {SINGLE_INPUT, PASS_TOKEN, "Pass", set_pass},
@@ -1270,6 +1402,7 @@ ConfigEntry config_entry[] = {
     // Prediction Structure
     {SINGLE_INPUT, NUMBER_OF_PICTURES_TOKEN, "FrameToBeEncoded", set_cfg_frames_to_be_encoded},
     {SINGLE_INPUT, BUFFERED_INPUT_TOKEN, "BufferedInput", set_buffered_input},
+    {SINGLE_INPUT, READ_AHEAD_TOKEN, "ReadAhead", set_read_ahead},
     {SINGLE_INPUT, PROGRESS_TOKEN, "Progress", set_progress},
     {SINGLE_INPUT, NO_PROGRESS_TOKEN, "NoProgress", set_no_progress},
     {SINGLE_INPUT, ENCMODE_TOKEN, "EncoderMode", set_enc_mode},
@@ -1290,6 +1423,7 @@ ConfigEntry config_entry[] = {
      set_compressed_ten_bit_format},
     {SINGLE_INPUT, HIERARCHICAL_LEVELS_TOKEN, "HierarchicalLevels", set_hierarchical_levels},
     {SINGLE_INPUT, PRED_STRUCT_TOKEN, "PredStructure", set_cfg_pred_structure},
+    {SINGLE_INPUT, LOW_LATENCY_TOKEN, "LowLatency", set_low_latency_mode},
     {SINGLE_INPUT, TILE_ROW_TOKEN, "TileRow", set_tile_row},
     {SINGLE_INPUT, TILE_COL_TOKEN, "TileCol", set_tile_col},
     // Rate Control
@@ -1416,6 +1550,13 @@ ConfigEntry config_entry[] = {
     {SINGLE_INPUT, THREAD_MGMNT, "LogicalProcessors", set_logical_processors},
     {SINGLE_INPUT, UNPIN_TOKEN, "UnpinExecution", set_unpin_execution},
     {SINGLE_INPUT, TARGET_SOCKET, "TargetSocket", set_target_socket},
+    {SINGLE_INPUT, WORKER_POOL_TOKEN, "WorkerPool", set_worker_pool},
+    {SINGLE_INPUT, PIPELINE_PROFILE_TOKEN, "PipelineProfile", set_pipeline_profile},
+    {SINGLE_INPUT, SHARED_CONTEXT_TOKEN, "SharedContext", set_shared_context},
+    {SINGLE_INPUT, LADDER_ANALYSIS_TOKEN, "LadderAnalysis", set_ladder_analysis},
+    {SINGLE_INPUT, NUMA_POLICY_TOKEN, "NumaPolicy", set_numa_policy},
+    {SINGLE_INPUT, NUMA_NODE_TOKEN, "NumaNode", set_numa_node},
+    {SINGLE_INPUT, MAX_MEMORY_TOKEN, "MaxMemory", set_max_memory},
     // Optional Features
     {SINGLE_INPUT,
      UNRESTRICTED_MOTION_VECTOR,
@@ -1462,6 +1603,7 @@ ConfigEntry config_entry[] = {
      set_look_ahead_distance},
 
     {SINGLE_INPUT, STAT_REPORT_NEW_TOKEN, "Stat Report", set_stat_report},
+    {SINGLE_INPUT, FRAME_STATS_TOKEN, "FrameStats", set_frame_stats},
     {SINGLE_INPUT,
      RESTORATION_ENABLE_NEW_TOKEN,
      "Restoration Filter",
@@ -1558,6 +1700,7 @@ void svt_config_dtor(EbConfig *config_ptr) {
         config_ptr->config_file = (FILE *)NULL;
     }
 
+    input_reader_close(config_ptr);
     if (config_ptr->input_file) {
         if (!config_ptr->input_file_is_fifo)
             fclose(config_ptr->input_file);
@@ -1569,6 +1712,9 @@ void svt_config_dtor(EbConfig *config_ptr) {
         config_ptr->bitstream_file = (FILE *)NULL;
     }
 
+    free(config_ptr->partial_frame);
+    config_ptr->partial_frame = NULL;
+
     if (config_ptr->recon_file) {
         fclose(config_ptr->recon_file);
         config_ptr->recon_file = (FILE *)NULL;
@@ -1598,6 +1744,16 @@ void svt_config_dtor(EbConfig *config_ptr) {
         fclose(config_ptr->stat_file);
         config_ptr->stat_file = (FILE *)NULL;
     }
+
+    if (config_ptr->frame_stats_file) {
+        fclose(config_ptr->frame_stats_file);
+        config_ptr->frame_stats_file = (FILE *)NULL;
+    }
+
+    if (config_ptr->pipeline_trace_file) {
+        fclose(config_ptr->pipeline_trace_file);
+        config_ptr->pipeline_trace_file = (FILE *)NULL;
+    }
     free((void *)config_ptr->stats);
     free(config_ptr);
     return;
@@ -1973,6 +2129,20 @@ static EbErrorType verify_settings(EbConfig *config, uint32_t channel_number) {
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->read_ahead < 0) {
+        fprintf(config->error_log_file,
+                "Error instance %u: Invalid ReadAhead. ReadAhead must be greater or equal to 0\n",
+                channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->buffered_input != -1 && config->read_ahead) {
+        fprintf(config->error_log_file,
+                "Error instance %u: ReadAhead cannot be used with BufferedInput\n",
+                channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (config->config.use_qp_file == EB_TRUE && config->qp_file == NULL) {
         fprintf(config->error_log_file,
                 "Error instance %u: Could not find QP file, UseQpFile is set to 1\n",
@@ -2017,6 +2187,20 @@ static EbErrorType verify_settings(EbConfig *config, uint32_t channel_number) {
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->frame_stats_format == FRAME_STATS_FORMAT_INVALID) {
+        fprintf(config->error_log_file,
+                "Error instance %u: Invalid frame statistics format, it must be csv or json\n",
+                channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->pipeline_trace_file && config->config.pipeline_profile != 2) {
+        fprintf(config->error_log_file,
+                "Error instance %u: The pipeline trace file needs --pipeline-profile 2\n",
+                channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (config->input_stat_file && config->output_stat_file) {
         fprintf(config->error_log_file,
                 "Error instance %u: do not set input_stat_file and output_stat_file at same time\n",
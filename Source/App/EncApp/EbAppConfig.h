@@ -51,6 +51,13 @@ typedef void *EbPtr;
 
 #define WARNING_LENGTH 100
 
+// format of the frame statistics file
+typedef enum FrameStatsFormat {
+    FRAME_STATS_CSV = 0, // comma separated values with a header line
+    FRAME_STATS_JSON, // one JSON object per line
+    FRAME_STATS_FORMAT_INVALID
+} FrameStatsFormat;
+
 // memory map to be removed and replaced by malloc / free
 typedef enum EbPtrType {
     EB_N_PTR     = 0, // malloc'd pointer
@@ -145,6 +152,10 @@ typedef struct EbPerformanceContext {
     double average_speed;
     double average_latency;
 
+    // low latency mode: time to the first packet of each picture
+    uint64_t total_first_packet_latency;
+    uint32_t max_first_packet_latency;
+
     uint64_t byte_count;
     double   sum_luma_psnr;
     double   sum_cr_psnr;
@@ -173,6 +184,8 @@ typedef struct EbConfig {
     FILE * recon_file;
     FILE * error_log_file;
     FILE * stat_file;
+    FILE * frame_stats_file;
+    FILE * pipeline_trace_file;
     FILE * buffer_file;
     FILE * qp_file;
     /* two pass */
@@ -186,7 +199,17 @@ typedef struct EbConfig {
     EbBool        y4m_input;
     unsigned char y4m_buf[9];
 
+    uint8_t frame_stats_format; // FrameStatsFormat
+    EbBool  frame_stats_header_written;
+
+    // low latency mode: packets of the current picture, written out once the picture is complete
+    uint8_t *partial_frame;
+    uint32_t partial_frame_size;
+    uint32_t partial_frame_alloc;
+
     uint8_t progress; // 0 = no progress output, 1 = normal, 2 = aomenc style verbose progress
+    // attach the encoder to the context shared by the channels, see SharedContext
+    EbBool shared_context;
     /****************************************
      * Computational Performance Data
      ****************************************/
@@ -201,6 +224,9 @@ typedef struct EbConfig {
     int32_t   frames_encoded;
     int32_t   buffered_input;
     uint8_t **sequence_buffer;
+    // read-ahead of the input frames, see EbAppInputReader.h
+    int32_t             read_ahead;
+    struct InputReader *input_reader;
 
     uint32_t injector_frame_rate;
     uint32_t injector;
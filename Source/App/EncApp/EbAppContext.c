@@ -18,6 +18,7 @@
 
 #include "EbAppContext.h"
 #include "EbAppConfig.h"
+#include "EbAppInputReader.h"
 
 #define IS_16_BIT(bit_depth) (bit_depth == 10 ? 1 : 0)
 
@@ -169,7 +170,7 @@ EbErrorType allocate_input_buffers(EbConfig *config, EbAppContext *callback_data
                   EB_ErrorInsufficientResources);
 
     // Allocate frame buffer for the p_buffer
-    if (config->buffered_input == -1)
+    if (config->buffered_input == -1 && !config->input_reader)
         allocate_frame_buffer(config, callback_data->input_buffer_pool->p_buffer);
 
     // Assign the variables
@@ -288,7 +289,12 @@ EbErrorType init_encoder(EbConfig *config, EbAppContext *callback_data, uint32_t
 
     ///********************** APPLICATION INIT [START] ******************///
 
-    // STEP 6: Allocate input buffers carrying the yuv frames in
+    // STEP 6: Start the input reader and allocate input buffers carrying the yuv frames in
+    if (config->buffered_input == -1) {
+        return_error = input_reader_open(config);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
     return_error = allocate_input_buffers(config, callback_data);
 
     if (return_error != EB_ErrorNone)
@@ -0,0 +1,245 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "EbAppInputReader.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+typedef struct InputFrameSlot {
+    EbSvtIOFormat planes;
+    uint8_t *     buffer;
+    uint32_t      filled_len;
+    EbBool        end_of_input;
+} InputFrameSlot;
+
+struct InputReader {
+    EbConfig *config;
+    uint8_t   is_16bit;
+    uint64_t  frame_size;
+    uint64_t  luma_size;
+    uint64_t  chroma_size;
+
+    // Read-ahead ring: slots [head, head + filled) are read, the one at head
+    // is held by the encoding loop while held is set
+    InputFrameSlot *slots;
+    uint32_t        slot_count;
+    uint32_t        head;
+    uint32_t        filled;
+    EbBool          held;
+    EbBool          stop;
+    EbBool          done;
+#ifdef _WIN32
+    HANDLE             thread;
+    CRITICAL_SECTION   lock;
+    CONDITION_VARIABLE cond;
+#else
+    pthread_t       thread;
+    pthread_mutex_t lock;
+    pthread_cond_t  cond;
+#endif
+};
+
+#ifdef _WIN32
+#define READER_LOCK(r) EnterCriticalSection(&(r)->lock)
+#define READER_UNLOCK(r) LeaveCriticalSection(&(r)->lock)
+#define READER_WAIT(r) SleepConditionVariableCS(&(r)->cond, &(r)->lock, INFINITE)
+#define READER_SIGNAL(r) WakeAllConditionVariable(&(r)->cond)
+#else
+#define READER_LOCK(r) pthread_mutex_lock(&(r)->lock)
+#define READER_UNLOCK(r) pthread_mutex_unlock(&(r)->lock)
+#define READER_WAIT(r) pthread_cond_wait(&(r)->cond, &(r)->lock)
+#define READER_SIGNAL(r) pthread_cond_broadcast(&(r)->cond)
+#endif
+
+static void set_frame_planes(const InputReader *reader, uint8_t *frame, EbSvtIOFormat *planes) {
+    planes->luma = frame;
+    planes->cb   = frame + reader->luma_size;
+    planes->cr   = frame + reader->luma_size + reader->chroma_size;
+}
+
+/***************************************
+ * Read-ahead thread
+ ***************************************/
+static void *read_ahead_kernel(void *input_ptr) {
+    InputReader *reader = (InputReader *)input_ptr;
+    EbConfig *   config = reader->config;
+
+    for (uint64_t frame_index = 0;; frame_index++) {
+        READER_LOCK(reader);
+        while (!reader->stop && reader->filled == reader->slot_count) READER_WAIT(reader);
+        if (reader->stop) {
+            READER_UNLOCK(reader);
+            break;
+        }
+        InputFrameSlot *slot = &reader->slots[(reader->head + reader->filled) % reader->slot_count];
+        READER_UNLOCK(reader);
+
+        slot->end_of_input = EB_FALSE;
+        slot->filled_len   = read_frame_from_file(
+            config, reader->is_16bit, &slot->planes, frame_index, &slot->end_of_input);
+
+        READER_LOCK(reader);
+        reader->filled++;
+        READER_SIGNAL(reader);
+        READER_UNLOCK(reader);
+        if (slot->end_of_input ||
+            (config->frames_to_be_encoded > 0 &&
+             frame_index + 1 >= (uint64_t)config->frames_to_be_encoded))
+            break;
+    }
+
+    READER_LOCK(reader);
+    reader->done = EB_TRUE;
+    READER_SIGNAL(reader);
+    READER_UNLOCK(reader);
+    return NULL;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI read_ahead_thread(LPVOID input_ptr) {
+    read_ahead_kernel(input_ptr);
+    return 0;
+}
+#endif
+
+static EbErrorType start_read_ahead(InputReader *reader) {
+    reader->slot_count = (uint32_t)reader->config->read_ahead;
+    reader->slots      = (InputFrameSlot *)calloc(reader->slot_count, sizeof(*reader->slots));
+    if (!reader->slots)
+        return EB_ErrorInsufficientResources;
+    for (uint32_t i = 0; i < reader->slot_count; i++) {
+        reader->slots[i].buffer = (uint8_t *)malloc((size_t)reader->frame_size);
+        if (!reader->slots[i].buffer)
+            return EB_ErrorInsufficientResources;
+        set_frame_planes(reader, reader->slots[i].buffer, &reader->slots[i].planes);
+    }
+#ifdef _WIN32
+    InitializeCriticalSection(&reader->lock);
+    InitializeConditionVariable(&reader->cond);
+    reader->thread = CreateThread(NULL, 0, read_ahead_thread, reader, 0, NULL);
+    if (!reader->thread) {
+        DeleteCriticalSection(&reader->lock);
+        return EB_ErrorInsufficientResources;
+    }
+#else
+    pthread_mutex_init(&reader->lock, NULL);
+    pthread_cond_init(&reader->cond, NULL);
+    if (pthread_create(&reader->thread, NULL, read_ahead_kernel, reader)) {
+        pthread_cond_destroy(&reader->cond);
+        pthread_mutex_destroy(&reader->lock);
+        return EB_ErrorInsufficientResources;
+    }
+#endif
+    return EB_ErrorNone;
+}
+
+static void stop_read_ahead(InputReader *reader) {
+    READER_LOCK(reader);
+    reader->stop = EB_TRUE;
+    READER_SIGNAL(reader);
+    READER_UNLOCK(reader);
+#ifdef _WIN32
+    WaitForSingleObject(reader->thread, INFINITE);
+    CloseHandle(reader->thread);
+    DeleteCriticalSection(&reader->lock);
+#else
+    pthread_join(reader->thread, NULL);
+    pthread_cond_destroy(&reader->cond);
+    pthread_mutex_destroy(&reader->lock);
+#endif
+}
+
+static uint32_t get_read_ahead_frame(InputReader *reader, EbSvtIOFormat *input_ptr,
+                                     EbBool *end_of_input) {
+    InputFrameSlot *slot;
+
+    READER_LOCK(reader);
+    // The previous frame was sent, give its slot back to the thread
+    if (reader->held) {
+        reader->head = (reader->head + 1) % reader->slot_count;
+        reader->filled--;
+        reader->held = EB_FALSE;
+        READER_SIGNAL(reader);
+    }
+    while (!reader->filled && !reader->done) READER_WAIT(reader);
+    if (!reader->filled) {
+        READER_UNLOCK(reader);
+        return 0;
+    }
+    slot         = &reader->slots[reader->head];
+    reader->held = EB_TRUE;
+    READER_UNLOCK(reader);
+
+    input_ptr->luma = slot->planes.luma;
+    input_ptr->cb   = slot->planes.cb;
+    input_ptr->cr   = slot->planes.cr;
+    if (slot->end_of_input)
+        *end_of_input = EB_TRUE;
+    return slot->filled_len;
+}
+
+/***************************************
+ * Reader
+ ***************************************/
+static void free_input_reader(InputReader *reader) {
+    if (reader->slots) {
+        for (uint32_t i = 0; i < reader->slot_count; i++) free(reader->slots[i].buffer);
+        free(reader->slots);
+    }
+    free(reader);
+}
+
+EbErrorType input_reader_open(EbConfig *config) {
+    InputReader *reader;
+
+    config->input_reader = NULL;
+    // The compressed 10-bit planes are not contiguous, read them in the encoding loop
+    if (config->config.compressed_ten_bit_format)
+        return EB_ErrorNone;
+    if (!config->read_ahead)
+        return EB_ErrorNone;
+
+    reader = (InputReader *)calloc(1, sizeof(*reader));
+    if (!reader)
+        return EB_ErrorInsufficientResources;
+    reader->config      = config;
+    reader->is_16bit    = (uint8_t)(config->config.encoder_bit_depth > 8);
+    reader->luma_size   = (uint64_t)config->input_padded_width * config->input_padded_height
+        << reader->is_16bit;
+    reader->chroma_size = reader->luma_size >> (3 - config->config.encoder_color_format);
+    reader->frame_size  = reader->luma_size + 2 * reader->chroma_size;
+
+    if (start_read_ahead(reader) != EB_ErrorNone) {
+        free_input_reader(reader);
+        return EB_ErrorInsufficientResources;
+    }
+    config->input_reader = reader;
+    return EB_ErrorNone;
+}
+
+void input_reader_close(EbConfig *config) {
+    InputReader *reader = config->input_reader;
+    if (!reader)
+        return;
+    stop_read_ahead(reader);
+    free_input_reader(reader);
+    config->input_reader = NULL;
+}
+
+uint32_t input_reader_get_frame(EbConfig *config, EbSvtIOFormat *input_ptr, EbBool *end_of_input) {
+    return get_read_ahead_frame(config->input_reader, input_ptr, end_of_input);
+}
@@ -0,0 +1,35 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#ifndef EbAppInputReader_h
+#define EbAppInputReader_h
+
+#include "EbAppConfig.h"
+
+/*
+ * Input reader, taking the frame reads off the encoding loop: with read_ahead,
+ * a thread reads the frames ahead into a ring of read_ahead buffers.
+ */
+typedef struct InputReader InputReader;
+
+/* Starts the reader of the input file. config->input_reader is left NULL
+ * when the input is read by the encoding loop. */
+EbErrorType input_reader_open(EbConfig *config);
+void        input_reader_close(EbConfig *config);
+/* Points the planes of input_ptr at the next frame and returns its size. The
+ * frame stays valid until the next call. */
+uint32_t input_reader_get_frame(EbConfig *config, EbSvtIOFormat *input_ptr, EbBool *end_of_input);
+
+/* Reads a frame of the input file (EbAppProcessCmd.c) */
+uint32_t read_frame_from_file(EbConfig *config, uint8_t is_16bit, EbSvtIOFormat *input_ptr,
+                              uint64_t frame_index, EbBool *end_of_input);
+
+#endif // EbAppInputReader_h
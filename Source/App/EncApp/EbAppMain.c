@@ -83,8 +83,30 @@ typedef struct EncContext {
 
     EncodePass pass;
     int32_t    total_frames;
+    // context of the channels having SharedContext set
+    SvtAv1EncContext* shared_context;
 } EncContext;
 
+static EbErrorType create_shared_context(EncContext* enc_context) {
+    for (uint32_t inst_cnt = 0; inst_cnt < enc_context->num_channels; ++inst_cnt) {
+        EncChannel* c = enc_context->channels + inst_cnt;
+        if (c->return_error != EB_ErrorNone || !c->config->shared_context)
+            continue;
+        if (!enc_context->shared_context) {
+            // the first channel sharing the context sets its workers and asm level
+            SvtAv1EncContextConfig context_config;
+            context_config.worker_count  = c->config->config.logical_processors;
+            context_config.use_cpu_flags = c->config->config.use_cpu_flags;
+            EbErrorType return_error =
+                svt_av1_enc_context_create(&enc_context->shared_context, &context_config);
+            if (return_error != EB_ErrorNone)
+                return return_error;
+        }
+        c->config->config.shared_context = enc_context->shared_context;
+    }
+    return EB_ErrorNone;
+}
+
 static EbErrorType enc_context_ctor(EncApp* enc_app, EncContext* enc_context, int32_t argc,
                                     char* argv[], EncodePass pass) {
     memset(enc_context, 0, sizeof(*enc_context));
@@ -123,6 +145,12 @@ static EbErrorType enc_context_ctor(EncApp* enc_app, EncContext* enc_context, in
     if (enc_context->channels[0].config->config.target_socket != -1)
         assign_app_thread_group(enc_context->channels[0].config->config.target_socket);
 
+    return_error = create_shared_context(enc_context);
+    if (return_error != EB_ErrorNone) {
+        fprintf(stderr, "Could not create the shared encoder context\n");
+        return return_error;
+    }
+
     // Init the Encoder
     for (uint32_t inst_cnt = 0; inst_cnt < num_channels; ++inst_cnt) {
         EncChannel* c = enc_context->channels + inst_cnt;
@@ -153,6 +181,8 @@ static void enc_context_dctor(EncContext* enc_context) {
         EncChannel* c = enc_context->channels + inst_cnt;
         enc_channel_dctor(c, inst_cnt);
     }
+    if (enc_context->shared_context)
+        svt_av1_enc_context_destroy(enc_context->shared_context);
 
     for (uint32_t warning_id = 0; warning_id < MAX_NUM_TOKENS; warning_id++)
         free(enc_context->warning[warning_id]);
@@ -274,6 +304,80 @@ static void print_summary(const EncContext* const enc_context) {
     fflush(stdout);
 }
 
+static void print_memory_locality(EbComponentType* component_handle) {
+    SvtAv1MemoryLocality locality;
+    if (svt_av1_enc_get_stream_info(
+            component_handle, SVT_AV1_STREAM_INFO_MEMORY_LOCALITY, &locality) != EB_ErrorNone)
+        return;
+    const uint64_t total_pages = locality.local_pages + locality.remote_pages;
+    fprintf(stderr,
+            "\nNUMA placement (policy %u, %u nodes)\n",
+            locality.numa_policy,
+            locality.num_nodes);
+    fprintf(stderr, "Node\tThreads\tPicture pages\n");
+    for (uint32_t node = 0; node < locality.num_nodes && node < SVT_AV1_MAX_NUMA_NODES; node++)
+        fprintf(stderr,
+                "%4u\t%7u\t%13llu\n",
+                node,
+                locality.threads[node],
+                (unsigned long long)locality.pages[node]);
+    fprintf(stderr,
+            "Local pages: %llu (%.1f%%), remote pages: %llu, untouched pages: %llu\n",
+            (unsigned long long)locality.local_pages,
+            total_pages ? 100.0 * locality.local_pages / total_pages : 100.0,
+            (unsigned long long)locality.remote_pages,
+            (unsigned long long)locality.unplaced_pages);
+}
+
+static void print_pipeline_profile(EbComponentType* component_handle) {
+    SvtAv1PipelineProfile profile;
+    if (svt_av1_enc_get_stream_info(
+            component_handle, SVT_AV1_STREAM_INFO_PIPELINE_PROFILE, &profile) != EB_ErrorNone)
+        return;
+    // Shares of the time of the threads of each stage, the busiest stage
+    // being the bottleneck of the pipeline
+    uint32_t busiest = 0;
+    double   max_busy = -1;
+    fprintf(stderr, "\nPipeline profile (%.0f ms)\n", profile.elapsed_us / 1000.0);
+    fprintf(stderr,
+            "%-28s %7s %8s %10s %6s %6s %6s %9s %9s\n",
+            "Stage",
+            "Threads",
+            "Objects",
+            "Busy ms",
+            "Busy",
+            "Idle",
+            "Stall",
+            "Avg queue",
+            "Max queue");
+    for (uint32_t i = 0; i < profile.num_stages; i++) {
+        const SvtAv1StageProfile* stage = &profile.stages[i];
+        const double total = (double)stage->thread_count * profile.elapsed_us;
+        const double busy  = total ? 100.0 * stage->busy_us / total : 0;
+        if (busy > max_busy) {
+            max_busy = busy;
+            busiest  = i;
+        }
+        fprintf(stderr,
+                "%-28s %7u %8llu %10.0f %5.1f%% %5.1f%% %5.1f%% %9.2f %9u\n",
+                stage->name,
+                stage->thread_count,
+                (unsigned long long)stage->objects,
+                stage->busy_us / 1000.0,
+                busy,
+                total ? 100.0 * stage->idle_us / total : 0,
+                total ? 100.0 * stage->stall_us / total : 0,
+                stage->avg_queue_depth,
+                stage->max_queue_depth);
+    }
+    if (profile.num_stages)
+        fprintf(stderr, "Busiest stage: %s\n", profile.stages[busiest].name);
+    if (profile.dropped_events)
+        fprintf(stderr,
+                "Trace events dropped: %llu\n",
+                (unsigned long long)profile.dropped_events);
+}
+
 static void print_performance(const EncContext* const enc_context) {
     for (uint32_t inst_cnt = 0; inst_cnt < enc_context->num_channels; ++inst_cnt) {
         const EncChannel* c = enc_context->channels + inst_cnt;
@@ -290,6 +394,17 @@ static void print_performance(const EncContext* const enc_context) {
                         config->performance_context.total_execution_time * 1000,
                         config->performance_context.average_latency,
                         (uint32_t)(config->performance_context.max_latency));
+                if (config->config.low_latency_mode)
+                    fprintf(stderr,
+                            "Average First Packet Latency:\t%.0f ms\nMax First Packet "
+                            "Latency:\t%u ms\n",
+                            (double)config->performance_context.total_first_packet_latency /
+                                config->performance_context.frame_count,
+                            config->performance_context.max_first_packet_latency);
+                if (config->config.numa_policy)
+                    print_memory_locality(c->app_callback->svt_encoder_handle);
+                if (config->config.pipeline_profile)
+                    print_pipeline_profile(c->app_callback->svt_encoder_handle);
             } else
                 fprintf(stderr, "\nChannel %u Encoding Interrupted\n", (uint32_t)(inst_cnt + 1));
         } else if (c->return_error == EB_ErrorInsufficientResources)
@@ -17,10 +17,12 @@
 #include <string.h>
 #include <math.h>
 #include <ctype.h>
+#include <inttypes.h>
 #include "EbAppContext.h"
 #include "EbAppConfig.h"
 #include "EbSvtAv1ErrorCodes.h"
 #include "EbAppInputy4m.h"
+#include "EbAppInputReader.h"
 #include "EbTime.h"
 /***************************************
  * Macros
@@ -634,121 +636,126 @@ void log_error_output(FILE *error_log_file, uint32_t error_code) {
     return;
 }
 
-void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *header_ptr) {
+/*
+ * Reads frame frame_index of the input file into the planes of input_ptr and
+ * returns its size. At the end of a pipe, end_of_input is set.
+ */
+uint32_t read_frame_from_file(EbConfig *config, uint8_t is_16bit, EbSvtIOFormat *input_ptr,
+                              uint64_t frame_index, EbBool *end_of_input) {
     const uint32_t input_padded_width  = config->input_padded_width;
     const uint32_t input_padded_height = config->input_padded_height;
     FILE *         input_file          = config->input_file;
-    EbSvtIOFormat *input_ptr           = (EbSvtIOFormat *)header_ptr->p_buffer;
-
-    const uint8_t color_format  = config->config.encoder_color_format;
-    const uint8_t subsampling_x = (color_format == EB_YUV444 ? 1 : 2) - 1;
-
-    input_ptr->y_stride  = input_padded_width;
-    input_ptr->cr_stride = input_padded_width >> subsampling_x;
-    input_ptr->cb_stride = input_padded_width >> subsampling_x;
-
-    if (config->buffered_input == -1) {
-        uint64_t read_size;
-        if (is_16bit == 0 || (is_16bit == 1 && config->config.compressed_ten_bit_format == 0)) {
-            read_size = (uint64_t)SIZE_OF_ONE_FRAME_IN_BYTES(
-                input_padded_width, input_padded_height, color_format, is_16bit);
-
-            header_ptr->n_filled_len = 0;
-            /* if input is a y4m file, read next line which contains "FRAME" */
-            if (config->y4m_input == EB_TRUE)
+    const uint8_t  color_format        = config->config.encoder_color_format;
+    uint32_t       filled_len;
+
+    uint64_t read_size;
+    if (is_16bit == 0 || (is_16bit == 1 && config->config.compressed_ten_bit_format == 0)) {
+        read_size = (uint64_t)SIZE_OF_ONE_FRAME_IN_BYTES(
+            input_padded_width, input_padded_height, color_format, is_16bit);
+
+        filled_len = 0;
+        /* if input is a y4m file, read next line which contains "FRAME" */
+        if (config->y4m_input == EB_TRUE)
+            read_y4m_frame_delimiter(config->input_file, config->error_log_file);
+        uint64_t luma_read_size = (uint64_t)input_padded_width * input_padded_height
+            << is_16bit;
+        uint8_t *eb_input_ptr = input_ptr->luma;
+        if (!config->y4m_input && frame_index == 0 &&
+            (config->input_file == stdin || config->input_file_is_fifo)) {
+            /* 9 bytes were already buffered during the the YUV4MPEG2 header probe */
+            memcpy(eb_input_ptr, config->y4m_buf, YUV4MPEG2_IND_SIZE);
+            filled_len += YUV4MPEG2_IND_SIZE;
+            eb_input_ptr += YUV4MPEG2_IND_SIZE;
+            filled_len += (uint32_t)fread(
+                eb_input_ptr, 1, luma_read_size - YUV4MPEG2_IND_SIZE, input_file);
+        } else {
+            filled_len += (uint32_t)fread(input_ptr->luma, 1, luma_read_size, input_file);
+        }
+        filled_len += (uint32_t)fread(
+            input_ptr->cb, 1, luma_read_size >> (3 - color_format), input_file);
+        filled_len += (uint32_t)fread(
+            input_ptr->cr, 1, luma_read_size >> (3 - color_format), input_file);
+
+        if (read_size != filled_len) {
+            fseek(input_file, 0, SEEK_SET);
+            if (config->y4m_input == EB_TRUE) {
+                read_and_skip_y4m_header(config->input_file);
                 read_y4m_frame_delimiter(config->input_file, config->error_log_file);
-            uint64_t luma_read_size = (uint64_t)input_padded_width * input_padded_height
-                << is_16bit;
-            uint8_t *eb_input_ptr = input_ptr->luma;
-            if (!config->y4m_input && config->processed_frame_count == 0 &&
-                (config->input_file == stdin || config->input_file_is_fifo)) {
-                /* 9 bytes were already buffered during the the YUV4MPEG2 header probe */
-                memcpy(eb_input_ptr, config->y4m_buf, YUV4MPEG2_IND_SIZE);
-                header_ptr->n_filled_len += YUV4MPEG2_IND_SIZE;
-                eb_input_ptr += YUV4MPEG2_IND_SIZE;
-                header_ptr->n_filled_len += (uint32_t)fread(
-                    eb_input_ptr, 1, luma_read_size - YUV4MPEG2_IND_SIZE, input_file);
-            } else {
-                header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->luma, 1, luma_read_size, input_file);
             }
-            header_ptr->n_filled_len += (uint32_t)fread(
+            filled_len = (uint32_t)fread(input_ptr->luma, 1, luma_read_size, input_file);
+            filled_len += (uint32_t)fread(
                 input_ptr->cb, 1, luma_read_size >> (3 - color_format), input_file);
-            header_ptr->n_filled_len += (uint32_t)fread(
+            filled_len += (uint32_t)fread(
                 input_ptr->cr, 1, luma_read_size >> (3 - color_format), input_file);
+        }
+    } else {
+        assert(is_16bit == 1 && config->config.compressed_ten_bit_format == 1);
+        // 10-bit Compressed Unpacked Mode
+        const uint32_t luma_read_size        = input_padded_width * input_padded_height;
+        const uint32_t chroma_read_size      = luma_read_size >> (3 - color_format);
+        const uint32_t nbit_luma_read_size   = (input_padded_width / 4) * input_padded_height;
+        const uint32_t nbit_chroma_read_size = nbit_luma_read_size >> (3 - color_format);
+
+        // Fill the buffer with a complete frame
+        filled_len = 0;
+
+        filled_len += (uint32_t)fread(input_ptr->luma, 1, luma_read_size, input_file);
+        filled_len += (uint32_t)fread(input_ptr->cb, 1, chroma_read_size, input_file);
+        filled_len += (uint32_t)fread(input_ptr->cr, 1, chroma_read_size, input_file);
+
+        filled_len += (uint32_t)fread(input_ptr->luma_ext, 1, nbit_luma_read_size, input_file);
+        filled_len += (uint32_t)fread(input_ptr->cb_ext, 1, nbit_chroma_read_size, input_file);
+        filled_len += (uint32_t)fread(input_ptr->cr_ext, 1, nbit_chroma_read_size, input_file);
+
+        read_size = luma_read_size + nbit_luma_read_size +
+            2 * (chroma_read_size + nbit_chroma_read_size);
+
+        if (read_size != filled_len) {
+            fseek(input_file, 0, SEEK_SET);
+            filled_len += (uint32_t)fread(input_ptr->luma, 1, luma_read_size, input_file);
+            filled_len += (uint32_t)fread(input_ptr->cb, 1, chroma_read_size, input_file);
+            filled_len += (uint32_t)fread(input_ptr->cr, 1, chroma_read_size, input_file);
+            filled_len += (uint32_t)fread(input_ptr->luma_ext, 1, nbit_luma_read_size, input_file);
+            filled_len += (uint32_t)fread(input_ptr->cb_ext, 1, nbit_chroma_read_size, input_file);
+            filled_len += (uint32_t)fread(input_ptr->cr_ext, 1, nbit_chroma_read_size, input_file);
+        }
+    }
 
-            if (read_size != header_ptr->n_filled_len) {
-                fseek(input_file, 0, SEEK_SET);
-                if (config->y4m_input == EB_TRUE) {
-                    read_and_skip_y4m_header(config->input_file);
-                    read_y4m_frame_delimiter(config->input_file, config->error_log_file);
-                }
-                header_ptr->n_filled_len = (uint32_t)fread(
-                    input_ptr->luma, 1, luma_read_size, input_file);
-                header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->cb, 1, luma_read_size >> (3 - color_format), input_file);
-                header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->cr, 1, luma_read_size >> (3 - color_format), input_file);
+    if (feof(input_file) != 0) {
+        if ((input_file == stdin) || (config->input_file_is_fifo)) {
+            //for a fifo, we only know this when we reach eof
+            *end_of_input = EB_TRUE;
+            if (filled_len != read_size) {
+                // not a completed frame
+                filled_len = 0;
             }
         } else {
-            assert(is_16bit == 1 && config->config.compressed_ten_bit_format == 1);
-            // 10-bit Compressed Unpacked Mode
-            const uint32_t luma_read_size        = input_padded_width * input_padded_height;
-            const uint32_t chroma_read_size      = luma_read_size >> (3 - color_format);
-            const uint32_t nbit_luma_read_size   = (input_padded_width / 4) * input_padded_height;
-            const uint32_t nbit_chroma_read_size = nbit_luma_read_size >> (3 - color_format);
-
-            // Fill the buffer with a complete frame
-            header_ptr->n_filled_len = 0;
-
-            header_ptr->n_filled_len += (uint32_t)fread(
-                input_ptr->luma, 1, luma_read_size, input_file);
-            header_ptr->n_filled_len += (uint32_t)fread(
-                input_ptr->cb, 1, chroma_read_size, input_file);
-            header_ptr->n_filled_len += (uint32_t)fread(
-                input_ptr->cr, 1, chroma_read_size, input_file);
-
-            header_ptr->n_filled_len += (uint32_t)fread(
-                input_ptr->luma_ext, 1, nbit_luma_read_size, input_file);
-            header_ptr->n_filled_len += (uint32_t)fread(
-                input_ptr->cb_ext, 1, nbit_chroma_read_size, input_file);
-            header_ptr->n_filled_len += (uint32_t)fread(
-                input_ptr->cr_ext, 1, nbit_chroma_read_size, input_file);
-
-            read_size = luma_read_size + nbit_luma_read_size +
-                2 * (chroma_read_size + nbit_chroma_read_size);
-
-            if (read_size != header_ptr->n_filled_len) {
-                fseek(input_file, 0, SEEK_SET);
-                header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->luma, 1, luma_read_size, input_file);
-                header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->cb, 1, chroma_read_size, input_file);
-                header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->cr, 1, chroma_read_size, input_file);
-                header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->luma_ext, 1, nbit_luma_read_size, input_file);
-                header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->cb_ext, 1, nbit_chroma_read_size, input_file);
-                header_ptr->n_filled_len += (uint32_t)fread(
-                    input_ptr->cr_ext, 1, nbit_chroma_read_size, input_file);
-            }
+            // If we reached the end of file, loop over again
+            fseek(input_file, 0, SEEK_SET);
         }
+    }
 
-        if (feof(input_file) != 0) {
-            if ((input_file == stdin) || (config->input_file_is_fifo)) {
-                //for a fifo, we only know this when we reach eof
-                config->frames_to_be_encoded = config->frames_encoded;
-                if (header_ptr->n_filled_len != read_size) {
-                    // not a completed frame
-                    header_ptr->n_filled_len = 0;
-                }
-            } else {
-                // If we reached the end of file, loop over again
-                fseek(input_file, 0, SEEK_SET);
-            }
-        }
+    return filled_len;
+}
+
+void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *header_ptr) {
+    const uint32_t input_padded_width  = config->input_padded_width;
+    const uint32_t input_padded_height = config->input_padded_height;
+    EbSvtIOFormat *input_ptr           = (EbSvtIOFormat *)header_ptr->p_buffer;
+    EbBool         end_of_input        = EB_FALSE;
+
+    const uint8_t color_format  = config->config.encoder_color_format;
+    const uint8_t subsampling_x = (color_format == EB_YUV444 ? 1 : 2) - 1;
 
+    input_ptr->y_stride  = input_padded_width;
+    input_ptr->cr_stride = input_padded_width >> subsampling_x;
+    input_ptr->cb_stride = input_padded_width >> subsampling_x;
+
+    if (config->input_reader) {
+        header_ptr->n_filled_len = input_reader_get_frame(config, input_ptr, &end_of_input);
+    } else if (config->buffered_input == -1) {
+        header_ptr->n_filled_len = read_frame_from_file(
+            config, is_16bit, input_ptr, config->processed_frame_count, &end_of_input);
     } else {
         if (is_16bit && config->config.compressed_ten_bit_format == 1) {
             // Determine size of each plane
@@ -806,6 +813,9 @@ void read_input_frames(EbConfig *config, uint8_t is_16bit, EbBufferHeaderType *h
             header_ptr->n_filled_len = (uint32_t)(luma_size + 2 * chroma_size);
         }
     }
+    //for a fifo, we only know this when we reach eof
+    if (end_of_input)
+        config->frames_to_be_encoded = config->frames_encoded;
 
     return;
 }
@@ -1120,6 +1130,141 @@ void process_output_statistics_buffer(EbBufferHeaderType *header_ptr, EbConfig *
     return;
 }
 
+static const char *const frame_stats_stage_names[EB_FRAME_STATS_STAGE_COUNT] = {
+    "picture_analysis",
+    "motion_estimation",
+    "rate_control",
+    "enc_dec",
+    "loop_filter",
+    "entropy_coding",
+    "packetization",
+};
+
+static void write_frame_stats_csv_header(FILE *f) {
+    fprintf(f,
+            "picture_number,decode_order,pts,pic_type,temporal_layer,show_frame,qp,base_qindex,"
+            "bits,luma_sse,cb_sse,cr_sse,luma_psnr,cb_psnr,cr_psnr,luma_ssim,cb_ssim,cr_ssim");
+    for (int i = 0; i < EB_FRAME_STATS_STAGE_COUNT; i++)
+        fprintf(f, ",%s_us", frame_stats_stage_names[i]);
+    fprintf(f, ",output_us,sb_size,sb_cols,sb_rows,sb_qindex,sb_bits\n");
+}
+
+// The superblock maps are written as space separated lists in raster order
+static void write_frame_stats_csv(FILE *f, const EbFrameStats *stats) {
+    const uint32_t sb_count = stats->sb_stats ? stats->sb_cols * stats->sb_rows : 0;
+    fprintf(f,
+            "%" PRIu64 ",%" PRIu64 ",%" PRId64 ",%u,%u,%u,%u,%u,%" PRIu64 ",%" PRIu64 ",%" PRIu64
+            ",%" PRIu64 ",%.4f,%.4f,%.4f,%.6f,%.6f,%.6f",
+            stats->picture_number,
+            stats->decode_order,
+            stats->pts,
+            stats->pic_type,
+            stats->temporal_layer_index,
+            stats->show_frame,
+            stats->qp,
+            stats->base_qindex,
+            stats->bits,
+            stats->luma_sse,
+            stats->cb_sse,
+            stats->cr_sse,
+            stats->luma_psnr,
+            stats->cb_psnr,
+            stats->cr_psnr,
+            stats->luma_ssim,
+            stats->cb_ssim,
+            stats->cr_ssim);
+    for (int i = 0; i < EB_FRAME_STATS_STAGE_COUNT; i++)
+        fprintf(f, ",%u", stats->stage_start_us[i]);
+    fprintf(f, ",%u,%u,%u,%u,", stats->output_us, stats->sb_size, stats->sb_cols, stats->sb_rows);
+    for (uint32_t i = 0; i < sb_count; i++)
+        fprintf(f, i ? " %u" : "%u", stats->sb_stats[i].qindex);
+    fprintf(f, ",");
+    for (uint32_t i = 0; i < sb_count; i++)
+        fprintf(f, i ? " %u" : "%u", stats->sb_stats[i].bits);
+    fprintf(f, "\n");
+}
+
+static void write_frame_stats_json(FILE *f, const EbFrameStats *stats) {
+    fprintf(f,
+            "{\"picture_number\":%" PRIu64 ",\"decode_order\":%" PRIu64 ",\"pts\":%" PRId64
+            ",\"pic_type\":%u,\"temporal_layer\":%u,\"show_frame\":%u,\"qp\":%u,"
+            "\"base_qindex\":%u,\"bits\":%" PRIu64 ",\"sse\":[%" PRIu64 ",%" PRIu64 ",%" PRIu64
+            "],\"psnr\":[%.4f,%.4f,%.4f],\"ssim\":[%.6f,%.6f,%.6f],\"stage_start_us\":{",
+            stats->picture_number,
+            stats->decode_order,
+            stats->pts,
+            stats->pic_type,
+            stats->temporal_layer_index,
+            stats->show_frame,
+            stats->qp,
+            stats->base_qindex,
+            stats->bits,
+            stats->luma_sse,
+            stats->cb_sse,
+            stats->cr_sse,
+            stats->luma_psnr,
+            stats->cb_psnr,
+            stats->cr_psnr,
+            stats->luma_ssim,
+            stats->cb_ssim,
+            stats->cr_ssim);
+    for (int i = 0; i < EB_FRAME_STATS_STAGE_COUNT; i++)
+        fprintf(f, i ? ",\"%s\":%u" : "\"%s\":%u", frame_stats_stage_names[i], stats->stage_start_us[i]);
+    fprintf(f, "},\"output_us\":%u", stats->output_us);
+    if (stats->sb_stats) {
+        const uint32_t sb_count = stats->sb_cols * stats->sb_rows;
+        fprintf(f,
+                ",\"sb\":{\"size\":%u,\"cols\":%u,\"rows\":%u,\"qindex\":[",
+                stats->sb_size,
+                stats->sb_cols,
+                stats->sb_rows);
+        for (uint32_t i = 0; i < sb_count; i++)
+            fprintf(f, i ? ",%u" : "%u", stats->sb_stats[i].qindex);
+        fprintf(f, "],\"bits\":[");
+        for (uint32_t i = 0; i < sb_count; i++)
+            fprintf(f, i ? ",%u" : "%u", stats->sb_stats[i].bits);
+        fprintf(f, "]}");
+    }
+    fprintf(f, "}\n");
+}
+
+/* Writes the statistics of the frames coded in a packet, one line per frame */
+static void write_frame_stats(EbConfig *config, const EbBufferHeaderType *header_ptr) {
+    FILE *f = config->frame_stats_file;
+    if (config->frame_stats_format == FRAME_STATS_CSV && !config->frame_stats_header_written) {
+        write_frame_stats_csv_header(f);
+        config->frame_stats_header_written = EB_TRUE;
+    }
+    for (uint32_t i = 0; i < header_ptr->frame_stats_count; i++) {
+        if (config->frame_stats_format == FRAME_STATS_JSON)
+            write_frame_stats_json(f, &header_ptr->frame_stats[i]);
+        else
+            write_frame_stats_csv(f, &header_ptr->frame_stats[i]);
+    }
+}
+
+static void record_first_packet_latency(EbConfig *config, uint32_t latency) {
+    config->performance_context.total_first_packet_latency += latency;
+    if (latency > config->performance_context.max_first_packet_latency)
+        config->performance_context.max_first_packet_latency = latency;
+}
+
+static EbErrorType append_partial_frame(EbConfig *config, const EbBufferHeaderType *header_ptr) {
+    const uint32_t size = config->partial_frame_size + header_ptr->n_filled_len;
+    if (size > config->partial_frame_alloc) {
+        uint8_t *buf = (uint8_t *)realloc(config->partial_frame, size);
+        if (!buf)
+            return EB_ErrorInsufficientResources;
+        config->partial_frame       = buf;
+        config->partial_frame_alloc = size;
+    }
+    memcpy(config->partial_frame + config->partial_frame_size,
+           header_ptr->p_buffer,
+           header_ptr->n_filled_len);
+    config->partial_frame_size = size;
+    return EB_ErrorNone;
+}
+
 void process_output_stream_buffer(EncChannel *channel, EncApp *enc_app, int32_t *frame_count) {
     EbConfig *           config        = channel->config;
     EbAppContext *       app_call_back = channel->app_callback;
@@ -1137,14 +1282,17 @@ void process_output_stream_buffer(EncChannel *channel, EncApp *enc_app, int32_t
     uint64_t finish_s_time = 0;
     uint64_t finish_u_time = 0;
     uint8_t  is_alt_ref    = 1;
+    // a partial picture is followed by the rest of its packets
+    uint8_t  is_partial    = 0;
     if (channel->exit_cond_output != APP_ExitConditionNone)
         return;
     uint8_t pic_send_done = (channel->exit_cond_input == APP_ExitConditionNone) ||
             (channel->exit_cond_recon == APP_ExitConditionNone)
         ? 0
         : 1;
-    while (is_alt_ref) {
+    while (is_alt_ref || is_partial) {
         is_alt_ref = 0;
+        is_partial = 0;
         // non-blocking call until all input frames are sent
         EbErrorType stream_status = svt_av1_enc_get_packet(
             component_handle, &header_ptr, pic_send_done);
@@ -1154,8 +1302,22 @@ void process_output_stream_buffer(EncChannel *channel, EncApp *enc_app, int32_t
             log_error_output(config->error_log_file, header_ptr->flags);
             channel->exit_cond_output = APP_ExitConditionError;
             return;
+        } else if (stream_status != EB_NoErrorEmptyQueue &&
+                   (header_ptr->flags & EB_BUFFERFLAG_PARTIAL)) {
+            // Low latency mode: the picture is not complete yet, hold its packets
+            if (header_ptr->flags & EB_BUFFERFLAG_HAS_TD)
+                record_first_packet_latency(config, header_ptr->n_tick_count);
+            if (append_partial_frame(config, header_ptr) != EB_ErrorNone) {
+                svt_av1_enc_release_out_buffer(&header_ptr);
+                channel->exit_cond_output = APP_ExitConditionError;
+                return;
+            }
+            svt_av1_enc_release_out_buffer(&header_ptr);
+            is_partial = 1;
         } else if (stream_status != EB_NoErrorEmptyQueue) {
             uint32_t flags = header_ptr->flags;
+            if (config->config.low_latency_mode && config->partial_frame_size == 0)
+                record_first_packet_latency(config, header_ptr->n_tick_count);
             is_alt_ref     = (flags & EB_BUFFERFLAG_IS_ALT_REF);
             if (!(flags & EB_BUFFERFLAG_IS_ALT_REF))
                 ++(config->performance_context.frame_count);
@@ -1187,15 +1349,22 @@ void process_output_stream_buffer(EncChannel *channel, EncApp *enc_app, int32_t
                     !(flags & EB_BUFFERFLAG_IS_ALT_REF)) {
                     write_ivf_stream_header(config);
                 }
-                write_ivf_frame_header(config, header_ptr->n_filled_len);
+                write_ivf_frame_header(
+                    config, config->partial_frame_size + header_ptr->n_filled_len);
+                fwrite(config->partial_frame, 1, config->partial_frame_size, stream_file);
                 fwrite(header_ptr->p_buffer, 1, header_ptr->n_filled_len, stream_file);
             }
 
-            config->performance_context.byte_count += header_ptr->n_filled_len;
+            config->performance_context.byte_count += config->partial_frame_size +
+                header_ptr->n_filled_len;
+            config->partial_frame_size = 0;
 
             if (config->config.stat_report && !(flags & EB_BUFFERFLAG_IS_ALT_REF))
                 process_output_statistics_buffer(header_ptr, config);
 
+            if (config->frame_stats_file && header_ptr->frame_stats_count)
+                write_frame_stats(config, header_ptr);
+
             // Update Output Port Activity State
             *port_state  = (flags & EB_BUFFERFLAG_EOS) ? APP_PortInactive : *port_state;
             return_value = (flags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionFinished
@@ -1204,6 +1373,13 @@ void process_output_stream_buffer(EncChannel *channel, EncApp *enc_app, int32_t
             svt_av1_enc_release_out_buffer(&header_ptr);
 
             if (flags & EB_BUFFERFLAG_EOS) {
+                if (config->pipeline_trace_file) {
+                    SvtAv1FixedBuf trace;
+                    if (svt_av1_enc_get_stream_info(component_handle,
+                                                    SVT_AV1_STREAM_INFO_PIPELINE_TRACE,
+                                                    &trace) == EB_ErrorNone)
+                        fwrite(trace.buf, 1, trace.sz, config->pipeline_trace_file);
+                }
                 if (config->config.rc_firstpass_stats_out) {
                     SvtAv1FixedBuf first_pass_stat;
                     EbErrorType    ret = svt_av1_enc_get_stream_info(
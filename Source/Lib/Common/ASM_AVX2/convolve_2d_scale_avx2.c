@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2020, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <immintrin.h>
+#include <assert.h>
+
+#include "EbDefinitions.h"
+#include "common_dsp_rtcd.h"
+#include "convolve.h"
+#include "synonyms.h"
+#include "synonyms_avx2.h"
+
+// The filter phase and the source position change from one pixel to the next
+// with scaled references, so both passes work on 8 columns at a time, each
+// column with its own filter. The column positions and horizontal filters do
+// not depend on the row and are loaded once per group of 8 columns; the
+// vertical filter is loaded once per output row. Narrow blocks repeat their
+// last column up to 8 columns, which only ever reads the pixels of the block.
+
+// Horizontal filters of 8 columns, the filters of columns i and i + 1 being
+// in the low and high lanes of coeffs[i / 2]
+static INLINE void prepare_coeffs_x_8(const InterpFilterParams *const filter_params_x,
+                                      const int32_t subpel_x_qn, const int32_t x_step_qn,
+                                      const int32_t x, const int32_t w, int32_t offsets[8],
+                                      __m256i coeffs[4]) {
+    __m128i f[8];
+
+    for (int32_t i = 0; i < 8; i++) {
+        const int32_t x_qn = subpel_x_qn + AOMMIN(x + i, w - 1) * x_step_qn;
+        const int32_t idx  = (x_qn & SCALE_SUBPEL_MASK) >> SCALE_EXTRA_BITS;
+        assert(idx < SUBPEL_SHIFTS);
+        offsets[i] = (x_qn >> SCALE_SUBPEL_BITS) - (SUBPEL_TAPS / 2 - 1);
+        f[i]       = xx_loadu_128(av1_get_interp_filter_subpel_kernel(*filter_params_x, idx));
+    }
+    for (int32_t i = 0; i < 4; i++) coeffs[i] = yy_set_m128i(f[2 * i + 1], f[2 * i]);
+}
+
+// Vertical filter of a row, as pairs of taps broadcast to all the columns
+static INLINE void prepare_coeffs_y(const InterpFilterParams *const filter_params_y,
+                                    const int32_t y_qn, __m256i coeffs[4]) {
+    const int32_t idx = (y_qn & SCALE_SUBPEL_MASK) >> SCALE_EXTRA_BITS;
+    assert(idx < SUBPEL_SHIFTS);
+    const __m256i f = _mm256_broadcastsi128_si256(
+        xx_loadu_128(av1_get_interp_filter_subpel_kernel(*filter_params_y, idx)));
+
+    coeffs[0] = _mm256_shuffle_epi32(f, 0x00);
+    coeffs[1] = _mm256_shuffle_epi32(f, 0x55);
+    coeffs[2] = _mm256_shuffle_epi32(f, 0xaa);
+    coeffs[3] = _mm256_shuffle_epi32(f, 0xff);
+}
+
+// Filters the 8 taps of 8 columns, s[i] holding the taps of columns 2 * i and
+// 2 * i + 1, and returns the rounded sums in column order
+static INLINE __m128i x_convolve_8(const __m256i s[4], const __m256i coeffs[4],
+                                   const __m128i offset, const int32_t round_0) {
+    const __m256i m0 = _mm256_madd_epi16(s[0], coeffs[0]);
+    const __m256i m1 = _mm256_madd_epi16(s[1], coeffs[1]);
+    const __m256i m2 = _mm256_madd_epi16(s[2], coeffs[2]);
+    const __m256i m3 = _mm256_madd_epi16(s[3], coeffs[3]);
+    // columns 0, 2, 4, 6 in the low lane and 1, 3, 5, 7 in the high lane
+    const __m256i sum =
+        _mm256_hadd_epi32(_mm256_hadd_epi32(m0, m1), _mm256_hadd_epi32(m2, m3));
+    const __m128i even = _mm256_castsi256_si128(sum);
+    const __m128i odd  = _mm256_extracti128_si256(sum, 1);
+    const __m128i r0   = _mm_add_epi32(_mm_unpacklo_epi32(even, odd), offset);
+    const __m128i r1   = _mm_add_epi32(_mm_unpackhi_epi32(even, odd), offset);
+
+    return _mm_packs_epi32(_mm_srai_epi32(r0, round_0), _mm_srai_epi32(r1, round_0));
+}
+
+static void convolve_2d_scale_hor_avx2(const uint8_t *const src, const int32_t src_stride,
+                                       const int32_t w, const int32_t im_h,
+                                       const InterpFilterParams *const filter_params_x,
+                                       const int32_t subpel_x_qn, const int32_t x_step_qn,
+                                       const int32_t round_0, int16_t *const im_block,
+                                       const int32_t im_stride) {
+    const int32_t bd     = 8;
+    const __m128i offset = _mm_set1_epi32((1 << (bd + FILTER_BITS - 1)) + ((1 << round_0) >> 1));
+
+    for (int32_t x = 0; x < w; x += 8) {
+        const uint8_t *src_ptr = src;
+        int16_t *      im      = im_block + x;
+        int32_t        offsets[8];
+        __m256i        coeffs[4], s[4];
+
+        prepare_coeffs_x_8(filter_params_x, subpel_x_qn, x_step_qn, x, w, offsets, coeffs);
+
+        for (int32_t y = 0; y < im_h; y++) {
+            for (int32_t i = 0; i < 4; i++) {
+                const __m128i s0 = _mm_cvtepu8_epi16(xx_loadl_64(src_ptr + offsets[2 * i]));
+                const __m128i s1 = _mm_cvtepu8_epi16(xx_loadl_64(src_ptr + offsets[2 * i + 1]));
+                s[i]             = yy_set_m128i(s1, s0);
+            }
+            xx_storeu_128(im, x_convolve_8(s, coeffs, offset, round_0));
+            src_ptr += src_stride;
+            im += im_stride;
+        }
+    }
+}
+
+static void highbd_convolve_2d_scale_hor_avx2(const uint16_t *const src, const int32_t src_stride,
+                                              const int32_t w, const int32_t im_h,
+                                              const InterpFilterParams *const filter_params_x,
+                                              const int32_t subpel_x_qn, const int32_t x_step_qn,
+                                              const int32_t round_0, int16_t *const im_block,
+                                              const int32_t im_stride, const int32_t bd) {
+    const __m128i offset = _mm_set1_epi32((1 << (bd + FILTER_BITS - 1)) + ((1 << round_0) >> 1));
+
+    for (int32_t x = 0; x < w; x += 8) {
+        const uint16_t *src_ptr = src;
+        int16_t *       im      = im_block + x;
+        int32_t         offsets[8];
+        __m256i         coeffs[4], s[4];
+
+        prepare_coeffs_x_8(filter_params_x, subpel_x_qn, x_step_qn, x, w, offsets, coeffs);
+
+        for (int32_t y = 0; y < im_h; y++) {
+            for (int32_t i = 0; i < 4; i++) {
+                s[i] = yy_loadu2_128(src_ptr + offsets[2 * i + 1], src_ptr + offsets[2 * i]);
+            }
+            xx_storeu_128(im, x_convolve_8(s, coeffs, offset, round_0));
+            src_ptr += src_stride;
+            im += im_stride;
+        }
+    }
+}
+
+// Filters 8 columns of the 8 rows of im starting at row src_y, and returns the
+// sums rounded by round_1 in column order
+static INLINE __m256i y_convolve_8(const int16_t *const src_y, const int32_t im_stride,
+                                   const __m256i coeffs[4], const __m256i offset,
+                                   const int32_t round_1) {
+    __m256i sum = offset;
+
+    for (int32_t k = 0; k < 4; k++) {
+        const __m128i r0 = xx_loadu_128(src_y + (2 * k) * im_stride);
+        const __m128i r1 = xx_loadu_128(src_y + (2 * k + 1) * im_stride);
+        const __m256i s  = yy_set_m128i(_mm_unpackhi_epi16(r0, r1), _mm_unpacklo_epi16(r0, r1));
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(s, coeffs[k]));
+    }
+    return _mm256_srai_epi32(sum, round_1);
+}
+
+// Average of the compound prediction in dst16 with res, or res alone, less the
+// rounding offsets and rounded by bits
+static INLINE __m256i round_dst_8(const __m256i res, const ConvBufType *const dst16,
+                                  const int32_t w, const ConvolveParams *const conv_params,
+                                  const __m256i round_offset, const __m256i round_bits,
+                                  const int32_t bits) {
+    __m256i tmp = res;
+
+    if (conv_params->is_compound) {
+        const __m128i d = w >= 8 ? xx_loadu_128(dst16)
+                                 : w == 4 ? xx_loadl_64(dst16) : xx_loadl_32(dst16);
+        const __m256i d32 = _mm256_cvtepu16_epi32(d);
+
+        if (conv_params->use_dist_wtd_comp_avg) {
+            tmp = _mm256_add_epi32(
+                _mm256_mullo_epi32(d32, _mm256_set1_epi32(conv_params->fwd_offset)),
+                _mm256_mullo_epi32(res, _mm256_set1_epi32(conv_params->bck_offset)));
+            tmp = _mm256_srai_epi32(tmp, DIST_PRECISION_BITS);
+        } else
+            tmp = _mm256_srai_epi32(_mm256_add_epi32(d32, res), 1);
+    }
+    tmp = _mm256_sub_epi32(tmp, round_offset);
+    return _mm256_sra_epi32(_mm256_add_epi32(tmp, round_bits), _mm_cvtsi32_si128(bits));
+}
+
+static INLINE void store_dst16_8(const __m256i res, ConvBufType *const dst16, const int32_t w) {
+    const __m128i d = _mm_packus_epi32(_mm256_castsi256_si128(res),
+                                       _mm256_extracti128_si256(res, 1));
+
+    if (w >= 8)
+        xx_storeu_128(dst16, d);
+    else if (w == 4)
+        xx_storel_64(dst16, d);
+    else
+        xx_storel_32(dst16, d);
+}
+
+void svt_av1_convolve_2d_scale_avx2(const uint8_t *src, int src_stride, uint8_t *dst8,
+                                    int dst8_stride, int w, int h,
+                                    const InterpFilterParams *filter_params_x,
+                                    const InterpFilterParams *filter_params_y,
+                                    const int subpel_x_qn, const int x_step_qn,
+                                    const int subpel_y_qn, const int y_step_qn,
+                                    ConvolveParams *conv_params) {
+    DECLARE_ALIGNED(32, int16_t, im_block[(2 * MAX_SB_SIZE + MAX_FILTER_TAP) * MAX_SB_SIZE]);
+    const int32_t im_h =
+        (((h - 1) * y_step_qn + subpel_y_qn) >> SCALE_SUBPEL_BITS) + filter_params_y->taps;
+    const int32_t im_stride    = AOMMAX(w, 8);
+    const int32_t fo_vert      = filter_params_y->taps / 2 - 1;
+    ConvBufType * dst16        = conv_params->dst;
+    const int32_t dst16_stride = conv_params->dst_stride;
+    const int32_t bd           = 8;
+    const int32_t offset_bits  = bd + 2 * FILTER_BITS - conv_params->round_0;
+    const int32_t bits         = 2 * FILTER_BITS - conv_params->round_0 - conv_params->round_1;
+    const __m256i offset =
+        _mm256_set1_epi32((1 << offset_bits) + ((1 << conv_params->round_1) >> 1));
+    const __m256i round_offset = _mm256_set1_epi32((1 << (offset_bits - conv_params->round_1)) +
+                                                   (1 << (offset_bits - conv_params->round_1 - 1)));
+    const __m256i round_bits   = _mm256_set1_epi32((1 << bits) >> 1);
+
+    assert(bits >= 0);
+    assert(filter_params_x->taps == SUBPEL_TAPS && filter_params_y->taps == SUBPEL_TAPS);
+
+    convolve_2d_scale_hor_avx2(src - fo_vert * src_stride,
+                               src_stride,
+                               w,
+                               im_h,
+                               filter_params_x,
+                               subpel_x_qn,
+                               x_step_qn,
+                               conv_params->round_0,
+                               im_block,
+                               im_stride);
+
+    int32_t y_qn = subpel_y_qn;
+    for (int32_t y = 0; y < h; y++, y_qn += y_step_qn) {
+        const int16_t *src_y = im_block + (y_qn >> SCALE_SUBPEL_BITS) * im_stride;
+        __m256i        coeffs[4];
+
+        prepare_coeffs_y(filter_params_y, y_qn, coeffs);
+
+        for (int32_t x = 0; x < w; x += 8) {
+            const __m256i res =
+                y_convolve_8(src_y + x, im_stride, coeffs, offset, conv_params->round_1);
+
+            if (conv_params->is_compound && !conv_params->do_average)
+                store_dst16_8(res, dst16 + y * dst16_stride + x, w);
+            else {
+                const __m256i r = round_dst_8(res,
+                                              dst16 + y * dst16_stride + x,
+                                              w,
+                                              conv_params,
+                                              round_offset,
+                                              round_bits,
+                                              bits);
+                const __m128i r16 =
+                    _mm_packs_epi32(_mm256_castsi256_si128(r), _mm256_extracti128_si256(r, 1));
+                const __m128i  d   = _mm_packus_epi16(r16, r16);
+                uint8_t *const dst = dst8 + y * dst8_stride + x;
+
+                if (w >= 8)
+                    xx_storel_64(dst, d);
+                else if (w == 4)
+                    xx_storel_32(dst, d);
+                else
+                    *(uint16_t *)dst = (uint16_t)_mm_cvtsi128_si32(d);
+            }
+        }
+    }
+}
+
+void svt_av1_highbd_convolve_2d_scale_avx2(const uint16_t *src, int src_stride, uint16_t *dst,
+                                           int dst_stride, int w, int h,
+                                           const InterpFilterParams *filter_params_x,
+                                           const InterpFilterParams *filter_params_y,
+                                           const int subpel_x_qn, const int x_step_qn,
+                                           const int subpel_y_qn, const int y_step_qn,
+                                           ConvolveParams *conv_params, int bd) {
+    DECLARE_ALIGNED(32, int16_t, im_block[(2 * MAX_SB_SIZE + MAX_FILTER_TAP) * MAX_SB_SIZE]);
+    const int32_t im_h =
+        (((h - 1) * y_step_qn + subpel_y_qn) >> SCALE_SUBPEL_BITS) + filter_params_y->taps;
+    const int32_t im_stride    = AOMMAX(w, 8);
+    const int32_t fo_vert      = filter_params_y->taps / 2 - 1;
+    ConvBufType * dst16        = conv_params->dst;
+    const int32_t dst16_stride = conv_params->dst_stride;
+    const int32_t offset_bits  = bd + 2 * FILTER_BITS - conv_params->round_0;
+    const int32_t bits         = 2 * FILTER_BITS - conv_params->round_0 - conv_params->round_1;
+    const __m256i offset =
+        _mm256_set1_epi32((1 << offset_bits) + ((1 << conv_params->round_1) >> 1));
+    const __m256i round_offset = _mm256_set1_epi32((1 << (offset_bits - conv_params->round_1)) +
+                                                   (1 << (offset_bits - conv_params->round_1 - 1)));
+    const __m256i round_bits   = _mm256_set1_epi32((1 << bits) >> 1);
+    const __m256i max          = _mm256_set1_epi32((1 << bd) - 1);
+
+    assert(bits >= 0);
+    assert(filter_params_x->taps == SUBPEL_TAPS && filter_params_y->taps == SUBPEL_TAPS);
+
+    highbd_convolve_2d_scale_hor_avx2(src - fo_vert * src_stride,
+                                      src_stride,
+                                      w,
+                                      im_h,
+                                      filter_params_x,
+                                      subpel_x_qn,
+                                      x_step_qn,
+                                      conv_params->round_0,
+                                      im_block,
+                                      im_stride,
+                                      bd);
+
+    int32_t y_qn = subpel_y_qn;
+    for (int32_t y = 0; y < h; y++, y_qn += y_step_qn) {
+        const int16_t *src_y = im_block + (y_qn >> SCALE_SUBPEL_BITS) * im_stride;
+        __m256i        coeffs[4];
+
+        prepare_coeffs_y(filter_params_y, y_qn, coeffs);
+
+        for (int32_t x = 0; x < w; x += 8) {
+            const __m256i res =
+                y_convolve_8(src_y + x, im_stride, coeffs, offset, conv_params->round_1);
+
+            if (conv_params->is_compound && !conv_params->do_average)
+                store_dst16_8(res, dst16 + y * dst16_stride + x, w);
+            else {
+                const __m256i r = round_dst_8(res,
+                                              dst16 + y * dst16_stride + x,
+                                              w,
+                                              conv_params,
+                                              round_offset,
+                                              round_bits,
+                                              bits);
+                const __m256i c =
+                    _mm256_min_epi32(_mm256_max_epi32(r, _mm256_setzero_si256()), max);
+
+                store_dst16_8(c, dst + y * dst_stride + x, w);
+            }
+        }
+    }
+}
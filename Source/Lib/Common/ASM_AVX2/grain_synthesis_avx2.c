@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <immintrin.h>
+
+#include "EbDefinitions.h"
+#include "common_dsp_rtcd.h"
+
+// Film grain application, 8 samples per iteration. The scaling function is
+// looked up with gathers. Each output sample only depends on its own input
+// sample, so the partial vector at the end of the rows is replaced by the last
+// 8 samples of the row, computed before the rest of the row is written.
+// Blocks narrower than 8 samples (the overlap columns) are left to the C code.
+
+typedef struct GrainScalingAvx2 {
+    const int32_t *lut;
+    __m256i        rounding;
+    __m256i        min_val;
+    __m256i        max_val;
+    __m256i        mult;
+    __m256i        luma_mult;
+    __m256i        offset;
+    __m256i        max_idx;
+    __m256i        frac_mask; // hbd only
+    __m256i        frac_rnd; // hbd only
+    __m128i        shift;
+    __m128i        frac_bits; // hbd only
+} GrainScalingAvx2;
+
+static INLINE void init_scaling_avx2(const GrainScaling *gs, int32_t bit_depth,
+                                     GrainScalingAvx2 *s) {
+    s->lut       = gs->scaling_lut;
+    s->rounding  = _mm256_set1_epi32(1 << (gs->scaling_shift - 1));
+    s->min_val   = _mm256_set1_epi32(gs->min_val);
+    s->max_val   = _mm256_set1_epi32(gs->max_val);
+    s->mult      = _mm256_set1_epi32(gs->mult);
+    s->luma_mult = _mm256_set1_epi32(gs->luma_mult);
+    s->offset    = _mm256_set1_epi32(gs->offset);
+    s->max_idx   = _mm256_set1_epi32((256 << (bit_depth - 8)) - 1);
+    s->frac_mask = _mm256_set1_epi32((1 << (bit_depth - 8)) - 1);
+    s->frac_rnd  = _mm256_set1_epi32(bit_depth > 8 ? 1 << (bit_depth - 9) : 0);
+    s->shift     = _mm_cvtsi32_si128(gs->scaling_shift);
+    s->frac_bits = _mm_cvtsi32_si128(bit_depth - 8);
+}
+
+static INLINE __m256i scale_lut_avx2(const GrainScalingAvx2 *s, const __m256i index) {
+    return _mm256_i32gather_epi32(s->lut, index, 4);
+}
+
+// Interpolates between the 256 entries of the lut for 10 and 12 bit samples,
+// the entry after 255 is 255 itself which gives the same result as scale_lut().
+static INLINE __m256i scale_lut_hbd_avx2(const GrainScalingAvx2 *s, const __m256i index) {
+    const __m256i x     = _mm256_srl_epi32(index, s->frac_bits);
+    const __m256i x1    = _mm256_min_epi32(_mm256_add_epi32(x, _mm256_set1_epi32(1)),
+                                        _mm256_set1_epi32(255));
+    const __m256i lut_0 = _mm256_i32gather_epi32(s->lut, x, 4);
+    const __m256i lut_1 = _mm256_i32gather_epi32(s->lut, x1, 4);
+    const __m256i delta = _mm256_mullo_epi32(_mm256_sub_epi32(lut_1, lut_0),
+                                             _mm256_and_si256(index, s->frac_mask));
+    return _mm256_add_epi32(lut_0,
+                            _mm256_sra_epi32(_mm256_add_epi32(delta, s->frac_rnd), s->frac_bits));
+}
+
+static INLINE __m256i add_grain_avx2(const GrainScalingAvx2 *s, const __m256i pix,
+                                     const __m256i scale, const int32_t *grain) {
+    const __m256i g     = _mm256_loadu_si256((const __m256i *)grain);
+    const __m256i noise = _mm256_sra_epi32(
+        _mm256_add_epi32(_mm256_mullo_epi32(scale, g), s->rounding), s->shift);
+    return _mm256_min_epi32(_mm256_max_epi32(_mm256_add_epi32(pix, noise), s->min_val),
+                            s->max_val);
+}
+
+// ((average_luma * luma_mult + mult * chroma) >> 6) + offset, clamped to the lut range
+static INLINE __m256i chroma_index_avx2(const GrainScalingAvx2 *s, const __m256i luma,
+                                        const __m256i chroma) {
+    const __m256i idx = _mm256_add_epi32(
+        _mm256_srai_epi32(_mm256_add_epi32(_mm256_mullo_epi32(luma, s->luma_mult),
+                                           _mm256_mullo_epi32(chroma, s->mult)),
+                          6),
+        s->offset);
+    return _mm256_min_epi32(_mm256_max_epi32(idx, _mm256_setzero_si256()), s->max_idx);
+}
+
+static INLINE void store_8x8(uint8_t *dst, const __m256i v) {
+    const __m128i w = _mm_packus_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(w, w));
+}
+
+static INLINE void store_16x8(uint16_t *dst, const __m256i v) {
+    _mm_storeu_si128((__m128i *)dst,
+                     _mm_packus_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+}
+
+// Average of the co-located luma samples of 8 chroma samples
+static INLINE __m256i load_luma_8x8(const uint8_t *luma, int32_t chroma_subsamp_x) {
+    if (chroma_subsamp_x) {
+        const __m256i l = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)luma));
+        const __m256i sum = _mm256_madd_epi16(l, _mm256_set1_epi16(1));
+        return _mm256_srai_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(1)), 1);
+    }
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)luma));
+}
+
+static INLINE __m256i load_luma_16x8(const uint16_t *luma, int32_t chroma_subsamp_x) {
+    if (chroma_subsamp_x) {
+        const __m256i l   = _mm256_loadu_si256((const __m256i *)luma);
+        const __m256i sum = _mm256_madd_epi16(l, _mm256_set1_epi16(1));
+        return _mm256_srai_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(1)), 1);
+    }
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)luma));
+}
+
+static INLINE __m256i add_luma_grain_8(const GrainScalingAvx2 *s, const uint8_t *luma,
+                                       const int32_t *grain) {
+    const __m256i pix = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)luma));
+    return add_grain_avx2(s, pix, scale_lut_avx2(s, pix), grain);
+}
+
+static INLINE __m256i highbd_add_luma_grain_8(const GrainScalingAvx2 *s, const uint16_t *luma,
+                                              const int32_t *grain) {
+    const __m256i pix = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)luma));
+    return add_grain_avx2(s, pix, scale_lut_hbd_avx2(s, pix), grain);
+}
+
+static INLINE __m256i add_chroma_grain_8(const GrainScalingAvx2 *s, const uint8_t *chroma,
+                                         const uint8_t *luma, const int32_t *grain,
+                                         int32_t chroma_subsamp_x) {
+    const __m256i pix = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)chroma));
+    const __m256i idx = chroma_index_avx2(s, load_luma_8x8(luma, chroma_subsamp_x), pix);
+    return add_grain_avx2(s, pix, scale_lut_avx2(s, idx), grain);
+}
+
+static INLINE __m256i highbd_add_chroma_grain_8(const GrainScalingAvx2 *s, const uint16_t *chroma,
+                                                const uint16_t *luma, const int32_t *grain,
+                                                int32_t chroma_subsamp_x) {
+    const __m256i pix = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)chroma));
+    const __m256i idx = chroma_index_avx2(s, load_luma_16x8(luma, chroma_subsamp_x), pix);
+    return add_grain_avx2(s, pix, scale_lut_hbd_avx2(s, idx), grain);
+}
+
+void svt_av1_add_luma_grain_avx2(uint8_t *luma, int32_t luma_stride, const int32_t *grain,
+                                 int32_t grain_stride, int32_t width, int32_t height,
+                                 const GrainScaling *gs) {
+    GrainScalingAvx2 s;
+    const int32_t    last = width - 8;
+
+    if (width < 8) {
+        svt_av1_add_luma_grain_c(luma, luma_stride, grain, grain_stride, width, height, gs);
+        return;
+    }
+    init_scaling_avx2(gs, 8, &s);
+
+    for (int32_t i = 0; i < height; i++) {
+        const __m256i tail = add_luma_grain_8(&s, luma + last, grain + last);
+        for (int32_t j = 0; j < last; j += 8)
+            store_8x8(luma + j, add_luma_grain_8(&s, luma + j, grain + j));
+        store_8x8(luma + last, tail);
+        luma += luma_stride;
+        grain += grain_stride;
+    }
+}
+
+void svt_av1_highbd_add_luma_grain_avx2(uint16_t *luma, int32_t luma_stride, const int32_t *grain,
+                                        int32_t grain_stride, int32_t width, int32_t height,
+                                        const GrainScaling *gs) {
+    GrainScalingAvx2 s;
+    const int32_t    last = width - 8;
+
+    if (width < 8) {
+        svt_av1_highbd_add_luma_grain_c(luma, luma_stride, grain, grain_stride, width, height, gs);
+        return;
+    }
+    init_scaling_avx2(gs, gs->bit_depth, &s);
+
+    for (int32_t i = 0; i < height; i++) {
+        const __m256i tail = highbd_add_luma_grain_8(&s, luma + last, grain + last);
+        for (int32_t j = 0; j < last; j += 8)
+            store_16x8(luma + j, highbd_add_luma_grain_8(&s, luma + j, grain + j));
+        store_16x8(luma + last, tail);
+        luma += luma_stride;
+        grain += grain_stride;
+    }
+}
+
+void svt_av1_add_chroma_grain_avx2(uint8_t *chroma, int32_t chroma_stride, const uint8_t *luma,
+                                   int32_t luma_stride, const int32_t *grain, int32_t grain_stride,
+                                   int32_t width, int32_t height, int32_t chroma_subsamp_x,
+                                   int32_t chroma_subsamp_y, const GrainScaling *gs) {
+    GrainScalingAvx2 s;
+    const int32_t    last = width - 8;
+
+    if (width < 8) {
+        svt_av1_add_chroma_grain_c(chroma, chroma_stride, luma, luma_stride, grain, grain_stride,
+                                   width, height, chroma_subsamp_x, chroma_subsamp_y, gs);
+        return;
+    }
+    init_scaling_avx2(gs, 8, &s);
+
+    for (int32_t i = 0; i < height; i++) {
+        const __m256i tail = add_chroma_grain_8(
+            &s, chroma + last, luma + (last << chroma_subsamp_x), grain + last, chroma_subsamp_x);
+        for (int32_t j = 0; j < last; j += 8)
+            store_8x8(chroma + j,
+                      add_chroma_grain_8(&s,
+                                         chroma + j,
+                                         luma + (j << chroma_subsamp_x),
+                                         grain + j,
+                                         chroma_subsamp_x));
+        store_8x8(chroma + last, tail);
+        chroma += chroma_stride;
+        luma += luma_stride << chroma_subsamp_y;
+        grain += grain_stride;
+    }
+}
+
+void svt_av1_highbd_add_chroma_grain_avx2(uint16_t *chroma, int32_t chroma_stride,
+                                          const uint16_t *luma, int32_t luma_stride,
+                                          const int32_t *grain, int32_t grain_stride,
+                                          int32_t width, int32_t height, int32_t chroma_subsamp_x,
+                                          int32_t chroma_subsamp_y, const GrainScaling *gs) {
+    GrainScalingAvx2 s;
+    const int32_t    last = width - 8;
+
+    if (width < 8) {
+        svt_av1_highbd_add_chroma_grain_c(chroma, chroma_stride, luma, luma_stride, grain,
+                                          grain_stride, width, height, chroma_subsamp_x,
+                                          chroma_subsamp_y, gs);
+        return;
+    }
+    init_scaling_avx2(gs, gs->bit_depth, &s);
+
+    for (int32_t i = 0; i < height; i++) {
+        const __m256i tail = highbd_add_chroma_grain_8(
+            &s, chroma + last, luma + (last << chroma_subsamp_x), grain + last, chroma_subsamp_x);
+        for (int32_t j = 0; j < last; j += 8)
+            store_16x8(chroma + j,
+                       highbd_add_chroma_grain_8(&s,
+                                                 chroma + j,
+                                                 luma + (j << chroma_subsamp_x),
+                                                 grain + j,
+                                                 chroma_subsamp_x));
+        store_16x8(chroma + last, tail);
+        chroma += chroma_stride;
+        luma += luma_stride << chroma_subsamp_y;
+        grain += grain_stride;
+    }
+}
+
+static INLINE __m256i blend_grain_avx2(const __m256i top, const __m256i bottom,
+                                       const __m256i w_top, const __m256i w_bottom,
+                                       const __m256i grain_min, const __m256i grain_max) {
+    const __m256i sum = _mm256_add_epi32(
+        _mm256_add_epi32(_mm256_mullo_epi32(top, w_top), _mm256_mullo_epi32(bottom, w_bottom)),
+        _mm256_set1_epi32(16));
+    return _mm256_min_epi32(_mm256_max_epi32(_mm256_srai_epi32(sum, 5), grain_min), grain_max);
+}
+
+void svt_av1_grain_hor_boundary_overlap_avx2(const int32_t *top_block, int32_t top_stride,
+                                             const int32_t *bottom_block, int32_t bottom_stride,
+                                             int32_t *dst_block, int32_t dst_stride,
+                                             int32_t width, int32_t height, int32_t grain_min,
+                                             int32_t grain_max) {
+    const __m256i g_min = _mm256_set1_epi32(grain_min);
+    const __m256i g_max = _mm256_set1_epi32(grain_max);
+    // weights of the first and of the second row of the overlap
+    const __m256i w_0 = _mm256_set1_epi32(height == 1 ? 23 : 27);
+    const __m256i w_1 = _mm256_set1_epi32(height == 1 ? 22 : 17);
+
+    if (height != 1 && height != 2)
+        return;
+
+    for (int32_t j = 0; j < width; j += 8) {
+        // the blocks are int32_t, masked loads and stores cover the last vector
+        const __m256i mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(width - j),
+                                                _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        const __m256i top    = _mm256_maskload_epi32(top_block + j, mask);
+        const __m256i bottom = _mm256_maskload_epi32(bottom_block + j, mask);
+        _mm256_maskstore_epi32(
+            dst_block + j, mask, blend_grain_avx2(top, bottom, w_0, w_1, g_min, g_max));
+        if (height == 2) {
+            const __m256i top_1    = _mm256_maskload_epi32(top_block + top_stride + j, mask);
+            const __m256i bottom_1 = _mm256_maskload_epi32(bottom_block + bottom_stride + j,
+                                                           mask);
+            _mm256_maskstore_epi32(dst_block + dst_stride + j,
+                                   mask,
+                                   blend_grain_avx2(top_1, bottom_1, w_1, w_0, g_min, g_max));
+        }
+    }
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2018, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "EbDefinitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "common_dsp_rtcd.h"
+
+static INLINE __m512i zz_roundn_epu16(__m512i v_val_w, int bits) {
+    const __m512i v_s_w = _mm512_srli_epi16(v_val_w, bits - 1);
+    return _mm512_avg_epu16(v_s_w, _mm512_setzero_si512());
+}
+
+// Narrows two vectors of 16 bit mask values (<= 64) to one vector of bytes,
+// keeping the order.
+static INLINE __m512i pack_mask_avx512(const __m512i lo_w, const __m512i hi_w) {
+    return _mm512_inserti64x4(
+        _mm512_castsi256_si512(_mm512_cvtepi16_epi8(lo_w)), _mm512_cvtepi16_epi8(hi_w), 1);
+}
+
+static INLINE void blend_64_u8_avx512(uint8_t *dst, const uint8_t *src0, const uint8_t *src1,
+                                      const __m512i v_m0_b) {
+    const __m512i v_m1_b = _mm512_sub_epi8(_mm512_set1_epi8(AOM_BLEND_A64_MAX_ALPHA), v_m0_b);
+    const __m512i v_s0_b = _mm512_loadu_si512((const __m512i *)src0);
+    const __m512i v_s1_b = _mm512_loadu_si512((const __m512i *)src1);
+
+    const __m512i v_p0_w = _mm512_maddubs_epi16(_mm512_unpacklo_epi8(v_s0_b, v_s1_b),
+                                                _mm512_unpacklo_epi8(v_m0_b, v_m1_b));
+    const __m512i v_p1_w = _mm512_maddubs_epi16(_mm512_unpackhi_epi8(v_s0_b, v_s1_b),
+                                                _mm512_unpackhi_epi8(v_m0_b, v_m1_b));
+
+    const __m512i v_res0_w = zz_roundn_epu16(v_p0_w, AOM_BLEND_A64_ROUND_BITS);
+    const __m512i v_res1_w = zz_roundn_epu16(v_p1_w, AOM_BLEND_A64_ROUND_BITS);
+    _mm512_storeu_si512((__m512i *)dst, _mm512_packus_epi16(v_res0_w, v_res1_w));
+}
+
+static INLINE void blend_a64_mask_w64n_avx512(uint8_t *dst, uint32_t dst_stride,
+                                              const uint8_t *src0, uint32_t src0_stride,
+                                              const uint8_t *src1, uint32_t src1_stride,
+                                              const uint8_t *mask, uint32_t mask_stride, int w,
+                                              int h) {
+    do {
+        for (int c = 0; c < w; c += 64) {
+            const __m512i v_m0_b = _mm512_loadu_si512((const __m512i *)(mask + c));
+            blend_64_u8_avx512(dst + c, src0 + c, src1 + c, v_m0_b);
+        }
+        dst += dst_stride;
+        src0 += src0_stride;
+        src1 += src1_stride;
+        mask += mask_stride;
+    } while (--h);
+}
+
+static INLINE void blend_a64_mask_sx_w64n_avx512(uint8_t *dst, uint32_t dst_stride,
+                                                 const uint8_t *src0, uint32_t src0_stride,
+                                                 const uint8_t *src1, uint32_t src1_stride,
+                                                 const uint8_t *mask, uint32_t mask_stride, int w,
+                                                 int h) {
+    const __m512i v_one_b = _mm512_set1_epi8(1);
+    do {
+        for (int c = 0; c < w; c += 64) {
+            const __m512i v_r0_b = _mm512_loadu_si512((const __m512i *)(mask + 2 * c));
+            const __m512i v_r1_b = _mm512_loadu_si512((const __m512i *)(mask + 2 * c + 64));
+            // horizontal pair sums
+            const __m512i v_s0_w = _mm512_maddubs_epi16(v_r0_b, v_one_b);
+            const __m512i v_s1_w = _mm512_maddubs_epi16(v_r1_b, v_one_b);
+            const __m512i v_m0_b = pack_mask_avx512(zz_roundn_epu16(v_s0_w, 1),
+                                                    zz_roundn_epu16(v_s1_w, 1));
+            blend_64_u8_avx512(dst + c, src0 + c, src1 + c, v_m0_b);
+        }
+        dst += dst_stride;
+        src0 += src0_stride;
+        src1 += src1_stride;
+        mask += mask_stride;
+    } while (--h);
+}
+
+static INLINE void blend_a64_mask_sy_w64n_avx512(uint8_t *dst, uint32_t dst_stride,
+                                                 const uint8_t *src0, uint32_t src0_stride,
+                                                 const uint8_t *src1, uint32_t src1_stride,
+                                                 const uint8_t *mask, uint32_t mask_stride, int w,
+                                                 int h) {
+    do {
+        for (int c = 0; c < w; c += 64) {
+            const __m512i v_ra_b = _mm512_loadu_si512((const __m512i *)(mask + c));
+            const __m512i v_rb_b = _mm512_loadu_si512((const __m512i *)(mask + c + mask_stride));
+            blend_64_u8_avx512(dst + c, src0 + c, src1 + c, _mm512_avg_epu8(v_ra_b, v_rb_b));
+        }
+        dst += dst_stride;
+        src0 += src0_stride;
+        src1 += src1_stride;
+        mask += 2 * mask_stride;
+    } while (--h);
+}
+
+static INLINE void blend_a64_mask_sx_sy_w64n_avx512(uint8_t *dst, uint32_t dst_stride,
+                                                    const uint8_t *src0, uint32_t src0_stride,
+                                                    const uint8_t *src1, uint32_t src1_stride,
+                                                    const uint8_t *mask, uint32_t mask_stride,
+                                                    int w, int h) {
+    const __m512i v_one_b = _mm512_set1_epi8(1);
+    do {
+        for (int c = 0; c < w; c += 64) {
+            const __m512i v_ra0_b = _mm512_loadu_si512((const __m512i *)(mask + 2 * c));
+            const __m512i v_ra1_b = _mm512_loadu_si512((const __m512i *)(mask + 2 * c + 64));
+            const __m512i v_rb0_b = _mm512_loadu_si512(
+                (const __m512i *)(mask + mask_stride + 2 * c));
+            const __m512i v_rb1_b = _mm512_loadu_si512(
+                (const __m512i *)(mask + mask_stride + 2 * c + 64));
+            // vertical sums fit in a byte (<= 128), then add horizontal pairs
+            const __m512i v_s0_w = _mm512_maddubs_epi16(_mm512_add_epi8(v_ra0_b, v_rb0_b),
+                                                        v_one_b);
+            const __m512i v_s1_w = _mm512_maddubs_epi16(_mm512_add_epi8(v_ra1_b, v_rb1_b),
+                                                        v_one_b);
+            const __m512i v_m0_b = pack_mask_avx512(zz_roundn_epu16(v_s0_w, 2),
+                                                    zz_roundn_epu16(v_s1_w, 2));
+            blend_64_u8_avx512(dst + c, src0 + c, src1 + c, v_m0_b);
+        }
+        dst += dst_stride;
+        src0 += src0_stride;
+        src1 += src1_stride;
+        mask += 2 * mask_stride;
+    } while (--h);
+}
+
+void svt_aom_blend_a64_mask_avx512(uint8_t *dst, uint32_t dst_stride, const uint8_t *src0,
+                                   uint32_t src0_stride, const uint8_t *src1,
+                                   uint32_t src1_stride, const uint8_t *mask, uint32_t mask_stride,
+                                   int w, int h, int subx, int suby) {
+    assert(IMPLIES(src0 == dst, src0_stride == dst_stride));
+    assert(IMPLIES(src1 == dst, src1_stride == dst_stride));
+
+    assert(h >= 1);
+    assert(w >= 1);
+    assert(IS_POWER_OF_TWO(h));
+    assert(IS_POWER_OF_TWO(w));
+
+    if (w < 64) {
+        svt_aom_blend_a64_mask_avx2(dst,
+                                    dst_stride,
+                                    src0,
+                                    src0_stride,
+                                    src1,
+                                    src1_stride,
+                                    mask,
+                                    mask_stride,
+                                    w,
+                                    h,
+                                    subx,
+                                    suby);
+    } else if (subx & suby) {
+        blend_a64_mask_sx_sy_w64n_avx512(
+            dst, dst_stride, src0, src0_stride, src1, src1_stride, mask, mask_stride, w, h);
+    } else if (subx) {
+        blend_a64_mask_sx_w64n_avx512(
+            dst, dst_stride, src0, src0_stride, src1, src1_stride, mask, mask_stride, w, h);
+    } else if (suby) {
+        blend_a64_mask_sy_w64n_avx512(
+            dst, dst_stride, src0, src0_stride, src1, src1_stride, mask, mask_stride, w, h);
+    } else {
+        blend_a64_mask_w64n_avx512(
+            dst, dst_stride, src0, src0_stride, src1, src1_stride, mask, mask_stride, w, h);
+    }
+}
+
+#endif // EN_AVX512_SUPPORT
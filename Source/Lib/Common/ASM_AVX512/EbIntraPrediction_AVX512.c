@@ -0,0 +1,122 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include "EbDefinitions.h"
+
+#if EN_AVX512_SUPPORT
+#include <immintrin.h>
+#include "common_dsp_rtcd.h"
+#include "EbIntraPrediction_AVX2.h"
+
+// Smooth predictors of 64 wide blocks. Every output pixel is a sum of
+// weight/pixel pairs (w, 256 - w) x (p0, p1), which are kept interleaved in the
+// 16 bit halves of 32 bit lanes so that pmaddwd evaluates one pair per lane.
+
+// Packs the 16 bit (lo, hi) pairs of 64 consecutive positions.
+static INLINE void load_pairs_64(const uint8_t *lo, const __m512i hi, __m512i *pairs) {
+    for (int i = 0; i < 4; i++) {
+        const __m128i p = _mm_loadu_si128((const __m128i *)(lo + 16 * i));
+        pairs[i]        = _mm512_or_si512(_mm512_cvtepu8_epi32(p), hi);
+    }
+}
+
+// Weights (w, 256 - w) of 64 consecutive positions.
+static INLINE void load_weights_64(const uint8_t *weights, __m512i *pairs) {
+    const __m512i scale = _mm512_set1_epi32(1 << sm_weight_log2_scale);
+    for (int i = 0; i < 4; i++) {
+        const __m512i w = _mm512_cvtepu8_epi32(
+            _mm_loadu_si128((const __m128i *)(weights + 16 * i)));
+        pairs[i] = _mm512_or_si512(w, _mm512_slli_epi32(_mm512_sub_epi32(scale, w), 16));
+    }
+}
+
+static INLINE __m512i pair_epi32(const int32_t lo, const int32_t hi) {
+    return _mm512_set1_epi32(lo | (hi << 16));
+}
+
+// Rounds 64 32 bit predictions by 'shift' bits and stores them as one row of bytes.
+static INLINE void store_row_64(uint8_t *dst, const __m512i *sum, const int shift) {
+    const __m512i idx = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i rnd = _mm512_set1_epi32(1 << (shift - 1));
+    __m512i       r[4];
+    for (int i = 0; i < 4; i++) r[i] = _mm512_srli_epi32(_mm512_add_epi32(sum[i], rnd), shift);
+    const __m512i p01 = _mm512_packus_epi32(r[0], r[1]);
+    const __m512i p23 = _mm512_packus_epi32(r[2], r[3]);
+    _mm512_storeu_si512((__m512i *)dst,
+                        _mm512_permutexvar_epi32(idx, _mm512_packus_epi16(p01, p23)));
+}
+
+static INLINE void smooth_predictor_64xh(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                         const uint8_t *left, const int32_t bh) {
+    const uint8_t *const sm_weights_h = sm_weight_arrays + bh;
+    __m512i              ab[4], wx[4];
+
+    // (above[c], below_pred) and (w_x[c], 256 - w_x[c])
+    load_pairs_64(above, _mm512_set1_epi32(left[bh - 1] << 16), ab);
+    load_weights_64(sm_weight_arrays + 64, wx);
+
+    for (int32_t r = 0; r < bh; ++r, dst += stride) {
+        const __m512i wy = pair_epi32(sm_weights_h[r],
+                                      (1 << sm_weight_log2_scale) - sm_weights_h[r]);
+        const __m512i lr = pair_epi32(left[r], above[63]);
+        __m512i       sum[4];
+        for (int i = 0; i < 4; i++)
+            sum[i] = _mm512_add_epi32(_mm512_madd_epi16(ab[i], wy), _mm512_madd_epi16(lr, wx[i]));
+        store_row_64(dst, sum, 1 + sm_weight_log2_scale);
+    }
+}
+
+static INLINE void smooth_v_predictor_64xh(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                           const uint8_t *left, const int32_t bh) {
+    const uint8_t *const sm_weights = sm_weight_arrays + bh;
+    __m512i              ab[4];
+
+    load_pairs_64(above, _mm512_set1_epi32(left[bh - 1] << 16), ab);
+
+    for (int32_t r = 0; r < bh; ++r, dst += stride) {
+        const __m512i wy = pair_epi32(sm_weights[r], (1 << sm_weight_log2_scale) - sm_weights[r]);
+        __m512i       sum[4];
+        for (int i = 0; i < 4; i++) sum[i] = _mm512_madd_epi16(ab[i], wy);
+        store_row_64(dst, sum, sm_weight_log2_scale);
+    }
+}
+
+static INLINE void smooth_h_predictor_64xh(uint8_t *dst, ptrdiff_t stride, const uint8_t *above,
+                                           const uint8_t *left, const int32_t bh) {
+    __m512i wx[4];
+
+    load_weights_64(sm_weight_arrays + 64, wx);
+
+    for (int32_t r = 0; r < bh; ++r, dst += stride) {
+        const __m512i lr = pair_epi32(left[r], above[63]);
+        __m512i       sum[4];
+        for (int i = 0; i < 4; i++) sum[i] = _mm512_madd_epi16(lr, wx[i]);
+        store_row_64(dst, sum, sm_weight_log2_scale);
+    }
+}
+
+#define SMOOTH_PRED_64XH(type, h)                                                        \
+    void svt_aom_##type##_predictor_64x##h##_avx512(                                     \
+        uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left) {     \
+        type##_predictor_64xh(dst, stride, above, left, h);                              \
+    }
+
+SMOOTH_PRED_64XH(smooth, 16)
+SMOOTH_PRED_64XH(smooth, 32)
+SMOOTH_PRED_64XH(smooth, 64)
+SMOOTH_PRED_64XH(smooth_v, 16)
+SMOOTH_PRED_64XH(smooth_v, 32)
+SMOOTH_PRED_64XH(smooth_v, 64)
+SMOOTH_PRED_64XH(smooth_h, 16)
+SMOOTH_PRED_64XH(smooth_h, 32)
+SMOOTH_PRED_64XH(smooth_h, 64)
+
+#endif // EN_AVX512_SUPPORT
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2017, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "EbDefinitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <immintrin.h>
+#include <stdlib.h>
+
+#include "common_dsp_rtcd.h"
+
+static INLINE __m512i predict_unclipped_avx512(const int16_t *input, __m512i alpha_q12,
+                                               __mmask32 alpha_neg, __m512i dc_q0) {
+    const __m512i ac_q3 = _mm512_loadu_si512((const __m512i *)input);
+    // sign(alpha) * sign(ac), zero lanes need no special care as |ac| * alpha is then 0
+    const __mmask32 neg            = _mm512_movepi16_mask(ac_q3) ^ alpha_neg;
+    __m512i         scaled_luma_q0 = _mm512_mulhrs_epi16(_mm512_abs_epi16(ac_q3), alpha_q12);
+    scaled_luma_q0 = _mm512_mask_sub_epi16(scaled_luma_q0, neg, _mm512_setzero_si512(),
+                                           scaled_luma_q0);
+    return _mm512_add_epi16(scaled_luma_q0, dc_q0);
+}
+
+void svt_cfl_predict_lbd_avx512(const int16_t *pred_buf_q3, uint8_t *pred, int32_t pred_stride,
+                                uint8_t *dst, int32_t dst_stride, int32_t alpha_q3,
+                                int32_t bit_depth, int32_t width, int32_t height) {
+    if (width < 32) {
+        svt_cfl_predict_lbd_avx2(pred_buf_q3,
+                                 pred,
+                                 pred_stride,
+                                 dst,
+                                 dst_stride,
+                                 alpha_q3,
+                                 bit_depth,
+                                 width,
+                                 height);
+        return;
+    }
+
+    // A row of 32 predictions in the CfL buffer is exactly one zmm register.
+    const __m512i   alpha_q12 = _mm512_slli_epi16(_mm512_set1_epi16(abs(alpha_q3)), 9);
+    const __mmask32 alpha_neg = alpha_q3 < 0 ? (__mmask32)-1 : 0;
+    const __m512i   dc_q0     = _mm512_set1_epi16(*pred);
+    const __m512i   zero      = _mm512_setzero_si512();
+
+    for (int32_t i = 0; i < height; i++) {
+        const __m512i res = predict_unclipped_avx512(pred_buf_q3, alpha_q12, alpha_neg, dc_q0);
+        // clamp to [0, 255]: negatives are zeroed, the rest saturate when narrowed
+        _mm256_storeu_si256((__m256i *)dst, _mm512_cvtusepi16_epi8(_mm512_max_epi16(res, zero)));
+        pred_buf_q3 += CFL_BUF_LINE;
+        dst += dst_stride;
+    }
+}
+
+#endif // EN_AVX512_SUPPORT
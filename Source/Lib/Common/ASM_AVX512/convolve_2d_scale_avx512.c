@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2020, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "EbDefinitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <immintrin.h>
+#include <assert.h>
+
+#include "common_dsp_rtcd.h"
+#include "convolve.h"
+#include "synonyms.h"
+#include "synonyms_avx2.h"
+#include "synonyms_avx512.h"
+
+// Same scheme as convolve_2d_scale_avx2.c on 16 columns at a time. In the
+// horizontal pass lane j of s[k] holds the 8 taps of column 4 * j + k, so that
+// a 4x4 transpose of the partial sums in each lane puts the columns in order.
+// Blocks narrower than 16 use the AVX2 kernels.
+
+// Horizontal filters of 16 columns, lane j of coeffs[k] being the filter of
+// column 4 * j + k
+static INLINE void prepare_coeffs_x_16(const InterpFilterParams *const filter_params_x,
+                                       const int32_t subpel_x_qn, const int32_t x_step_qn,
+                                       const int32_t x, int32_t offsets[16], __m512i coeffs[4]) {
+    __m128i f[16];
+
+    for (int32_t i = 0; i < 16; i++) {
+        const int32_t x_qn = subpel_x_qn + (x + i) * x_step_qn;
+        const int32_t idx  = (x_qn & SCALE_SUBPEL_MASK) >> SCALE_EXTRA_BITS;
+        assert(idx < SUBPEL_SHIFTS);
+        offsets[i] = (x_qn >> SCALE_SUBPEL_BITS) - (SUBPEL_TAPS / 2 - 1);
+        f[i]       = xx_loadu_128(av1_get_interp_filter_subpel_kernel(*filter_params_x, idx));
+    }
+    for (int32_t k = 0; k < 4; k++) {
+        const __m512i c = _mm512_inserti32x4(_mm512_castsi128_si512(f[k]), f[4 + k], 1);
+        coeffs[k] = _mm512_inserti32x4(_mm512_inserti32x4(c, f[8 + k], 2), f[12 + k], 3);
+    }
+}
+
+// Vertical filter of a row, as pairs of taps broadcast to all the columns
+static INLINE void prepare_coeffs_y_avx512(const InterpFilterParams *const filter_params_y,
+                                           const int32_t y_qn, __m512i coeffs[4]) {
+    const int32_t idx = (y_qn & SCALE_SUBPEL_MASK) >> SCALE_EXTRA_BITS;
+    assert(idx < SUBPEL_SHIFTS);
+    const __m512i f = _mm512_broadcast_i32x4(
+        xx_loadu_128(av1_get_interp_filter_subpel_kernel(*filter_params_y, idx)));
+
+    coeffs[0] = _mm512_shuffle_epi32(f, 0x00);
+    coeffs[1] = _mm512_shuffle_epi32(f, 0x55);
+    coeffs[2] = _mm512_shuffle_epi32(f, 0xaa);
+    coeffs[3] = _mm512_shuffle_epi32(f, 0xff);
+}
+
+// Filters the 8 taps of 16 columns and returns the rounded sums in column order
+static INLINE __m256i x_convolve_16(const __m512i s[4], const __m512i coeffs[4],
+                                    const __m512i offset, const int32_t round_0) {
+    const __m512i m0  = _mm512_madd_epi16(s[0], coeffs[0]);
+    const __m512i m1  = _mm512_madd_epi16(s[1], coeffs[1]);
+    const __m512i m2  = _mm512_madd_epi16(s[2], coeffs[2]);
+    const __m512i m3  = _mm512_madd_epi16(s[3], coeffs[3]);
+    const __m512i s01 = _mm512_add_epi32(_mm512_unpacklo_epi32(m0, m1),
+                                         _mm512_unpackhi_epi32(m0, m1));
+    const __m512i s23 = _mm512_add_epi32(_mm512_unpacklo_epi32(m2, m3),
+                                         _mm512_unpackhi_epi32(m2, m3));
+    const __m512i sum = _mm512_add_epi32(_mm512_unpacklo_epi64(s01, s23),
+                                         _mm512_unpackhi_epi64(s01, s23));
+
+    return _mm512_cvtsepi32_epi16(_mm512_srai_epi32(_mm512_add_epi32(sum, offset), round_0));
+}
+
+static void convolve_2d_scale_hor_avx512(const uint8_t *const src, const int32_t src_stride,
+                                         const int32_t w, const int32_t im_h,
+                                         const InterpFilterParams *const filter_params_x,
+                                         const int32_t subpel_x_qn, const int32_t x_step_qn,
+                                         const int32_t round_0, int16_t *const im_block,
+                                         const int32_t im_stride) {
+    const int32_t bd     = 8;
+    const __m512i offset = _mm512_set1_epi32((1 << (bd + FILTER_BITS - 1)) + ((1 << round_0) >> 1));
+
+    for (int32_t x = 0; x < w; x += 16) {
+        const uint8_t *src_ptr = src;
+        int16_t *      im      = im_block + x;
+        int32_t        offsets[16];
+        __m512i        coeffs[4], s[4];
+
+        prepare_coeffs_x_16(filter_params_x, subpel_x_qn, x_step_qn, x, offsets, coeffs);
+
+        for (int32_t y = 0; y < im_h; y++) {
+            for (int32_t k = 0; k < 4; k++) {
+                const __m128i l0 = _mm_unpacklo_epi64(xx_loadl_64(src_ptr + offsets[k]),
+                                                      xx_loadl_64(src_ptr + offsets[4 + k]));
+                const __m128i l1 = _mm_unpacklo_epi64(xx_loadl_64(src_ptr + offsets[8 + k]),
+                                                      xx_loadl_64(src_ptr + offsets[12 + k]));
+                s[k]             = _mm512_cvtepu8_epi16(yy_set_m128i(l1, l0));
+            }
+            yy_storeu_256(im, x_convolve_16(s, coeffs, offset, round_0));
+            src_ptr += src_stride;
+            im += im_stride;
+        }
+    }
+}
+
+static void highbd_convolve_2d_scale_hor_avx512(const uint16_t *const src,
+                                                const int32_t src_stride, const int32_t w,
+                                                const int32_t im_h,
+                                                const InterpFilterParams *const filter_params_x,
+                                                const int32_t subpel_x_qn, const int32_t x_step_qn,
+                                                const int32_t round_0, int16_t *const im_block,
+                                                const int32_t im_stride, const int32_t bd) {
+    const __m512i offset = _mm512_set1_epi32((1 << (bd + FILTER_BITS - 1)) + ((1 << round_0) >> 1));
+
+    for (int32_t x = 0; x < w; x += 16) {
+        const uint16_t *src_ptr = src;
+        int16_t *       im      = im_block + x;
+        int32_t         offsets[16];
+        __m512i         coeffs[4], s[4];
+
+        prepare_coeffs_x_16(filter_params_x, subpel_x_qn, x_step_qn, x, offsets, coeffs);
+
+        for (int32_t y = 0; y < im_h; y++) {
+            for (int32_t k = 0; k < 4; k++) {
+                const __m512i c = _mm512_inserti32x4(
+                    _mm512_castsi128_si512(xx_loadu_128(src_ptr + offsets[k])),
+                    xx_loadu_128(src_ptr + offsets[4 + k]),
+                    1);
+                s[k] = _mm512_inserti32x4(
+                    _mm512_inserti32x4(c, xx_loadu_128(src_ptr + offsets[8 + k]), 2),
+                    xx_loadu_128(src_ptr + offsets[12 + k]),
+                    3);
+            }
+            yy_storeu_256(im, x_convolve_16(s, coeffs, offset, round_0));
+            src_ptr += src_stride;
+            im += im_stride;
+        }
+    }
+}
+
+// Filters 16 columns of the 8 rows of im starting at row src_y, and returns the
+// sums rounded by round_1 in column order
+static INLINE __m512i y_convolve_16(const int16_t *const src_y, const int32_t im_stride,
+                                    const __m512i coeffs[4], const __m512i offset,
+                                    const int32_t round_1) {
+    __m512i sum = offset;
+
+    for (int32_t k = 0; k < 4; k++) {
+        const __m256i r0 = yy_loadu_256(src_y + (2 * k) * im_stride);
+        const __m256i r1 = yy_loadu_256(src_y + (2 * k + 1) * im_stride);
+        // columns 0-3, 8-11, 4-7 and 12-15 in the 4 lanes
+        const __m512i s = _mm512_inserti64x4(
+            _mm512_castsi256_si512(_mm256_unpacklo_epi16(r0, r1)), _mm256_unpackhi_epi16(r0, r1), 1);
+        sum = _mm512_add_epi32(sum, _mm512_madd_epi16(s, coeffs[k]));
+    }
+    sum = _mm512_shuffle_i64x2(sum, sum, 0xd8);
+    return _mm512_srai_epi32(sum, round_1);
+}
+
+// Average of the compound prediction in dst16 with res, or res alone, less the
+// rounding offsets and rounded by bits
+static INLINE __m512i round_dst_16(const __m512i res, const ConvBufType *const dst16,
+                                   const ConvolveParams *const conv_params,
+                                   const __m512i round_offset, const __m512i round_bits,
+                                   const int32_t bits) {
+    __m512i tmp = res;
+
+    if (conv_params->is_compound) {
+        const __m512i d32 = _mm512_cvtepu16_epi32(yy_loadu_256(dst16));
+
+        if (conv_params->use_dist_wtd_comp_avg) {
+            tmp = _mm512_add_epi32(
+                _mm512_mullo_epi32(d32, _mm512_set1_epi32(conv_params->fwd_offset)),
+                _mm512_mullo_epi32(res, _mm512_set1_epi32(conv_params->bck_offset)));
+            tmp = _mm512_srai_epi32(tmp, DIST_PRECISION_BITS);
+        } else
+            tmp = _mm512_srai_epi32(_mm512_add_epi32(d32, res), 1);
+    }
+    tmp = _mm512_sub_epi32(tmp, round_offset);
+    return _mm512_sra_epi32(_mm512_add_epi32(tmp, round_bits), _mm_cvtsi32_si128(bits));
+}
+
+// Stores 16 sums clamped to [0, 65535], as _mm_packus_epi32() does
+static INLINE void store_dst16_16(const __m512i res, ConvBufType *const dst16) {
+    yy_storeu_256(dst16, _mm512_cvtusepi32_epi16(_mm512_max_epi32(res, _mm512_setzero_si512())));
+}
+
+void svt_av1_convolve_2d_scale_avx512(const uint8_t *src, int src_stride, uint8_t *dst8,
+                                      int dst8_stride, int w, int h,
+                                      const InterpFilterParams *filter_params_x,
+                                      const InterpFilterParams *filter_params_y,
+                                      const int subpel_x_qn, const int x_step_qn,
+                                      const int subpel_y_qn, const int y_step_qn,
+                                      ConvolveParams *conv_params) {
+    if (w < 16) {
+        svt_av1_convolve_2d_scale_avx2(src,
+                                       src_stride,
+                                       dst8,
+                                       dst8_stride,
+                                       w,
+                                       h,
+                                       filter_params_x,
+                                       filter_params_y,
+                                       subpel_x_qn,
+                                       x_step_qn,
+                                       subpel_y_qn,
+                                       y_step_qn,
+                                       conv_params);
+        return;
+    }
+
+    DECLARE_ALIGNED(64, int16_t, im_block[(2 * MAX_SB_SIZE + MAX_FILTER_TAP) * MAX_SB_SIZE]);
+    const int32_t im_h =
+        (((h - 1) * y_step_qn + subpel_y_qn) >> SCALE_SUBPEL_BITS) + filter_params_y->taps;
+    const int32_t im_stride    = w;
+    const int32_t fo_vert      = filter_params_y->taps / 2 - 1;
+    ConvBufType * dst16        = conv_params->dst;
+    const int32_t dst16_stride = conv_params->dst_stride;
+    const int32_t bd           = 8;
+    const int32_t offset_bits  = bd + 2 * FILTER_BITS - conv_params->round_0;
+    const int32_t bits         = 2 * FILTER_BITS - conv_params->round_0 - conv_params->round_1;
+    const __m512i offset =
+        _mm512_set1_epi32((1 << offset_bits) + ((1 << conv_params->round_1) >> 1));
+    const __m512i round_offset = _mm512_set1_epi32(
+        (1 << (offset_bits - conv_params->round_1)) +
+        (1 << (offset_bits - conv_params->round_1 - 1)));
+    const __m512i round_bits = _mm512_set1_epi32((1 << bits) >> 1);
+
+    assert(bits >= 0);
+    assert(filter_params_x->taps == SUBPEL_TAPS && filter_params_y->taps == SUBPEL_TAPS);
+
+    convolve_2d_scale_hor_avx512(src - fo_vert * src_stride,
+                                 src_stride,
+                                 w,
+                                 im_h,
+                                 filter_params_x,
+                                 subpel_x_qn,
+                                 x_step_qn,
+                                 conv_params->round_0,
+                                 im_block,
+                                 im_stride);
+
+    int32_t y_qn = subpel_y_qn;
+    for (int32_t y = 0; y < h; y++, y_qn += y_step_qn) {
+        const int16_t *src_y = im_block + (y_qn >> SCALE_SUBPEL_BITS) * im_stride;
+        __m512i        coeffs[4];
+
+        prepare_coeffs_y_avx512(filter_params_y, y_qn, coeffs);
+
+        for (int32_t x = 0; x < w; x += 16) {
+            const __m512i res =
+                y_convolve_16(src_y + x, im_stride, coeffs, offset, conv_params->round_1);
+
+            if (conv_params->is_compound && !conv_params->do_average)
+                store_dst16_16(res, dst16 + y * dst16_stride + x);
+            else {
+                const __m512i r = round_dst_16(
+                    res, dst16 + y * dst16_stride + x, conv_params, round_offset, round_bits, bits);
+
+                xx_storeu_128(dst8 + y * dst8_stride + x,
+                              _mm512_cvtusepi32_epi8(_mm512_max_epi32(r, _mm512_setzero_si512())));
+            }
+        }
+    }
+}
+
+void svt_av1_highbd_convolve_2d_scale_avx512(const uint16_t *src, int src_stride, uint16_t *dst,
+                                             int dst_stride, int w, int h,
+                                             const InterpFilterParams *filter_params_x,
+                                             const InterpFilterParams *filter_params_y,
+                                             const int subpel_x_qn, const int x_step_qn,
+                                             const int subpel_y_qn, const int y_step_qn,
+                                             ConvolveParams *conv_params, int bd) {
+    if (w < 16) {
+        svt_av1_highbd_convolve_2d_scale_avx2(src,
+                                              src_stride,
+                                              dst,
+                                              dst_stride,
+                                              w,
+                                              h,
+                                              filter_params_x,
+                                              filter_params_y,
+                                              subpel_x_qn,
+                                              x_step_qn,
+                                              subpel_y_qn,
+                                              y_step_qn,
+                                              conv_params,
+                                              bd);
+        return;
+    }
+
+    DECLARE_ALIGNED(64, int16_t, im_block[(2 * MAX_SB_SIZE + MAX_FILTER_TAP) * MAX_SB_SIZE]);
+    const int32_t im_h =
+        (((h - 1) * y_step_qn + subpel_y_qn) >> SCALE_SUBPEL_BITS) + filter_params_y->taps;
+    const int32_t im_stride    = w;
+    const int32_t fo_vert      = filter_params_y->taps / 2 - 1;
+    ConvBufType * dst16        = conv_params->dst;
+    const int32_t dst16_stride = conv_params->dst_stride;
+    const int32_t offset_bits  = bd + 2 * FILTER_BITS - conv_params->round_0;
+    const int32_t bits         = 2 * FILTER_BITS - conv_params->round_0 - conv_params->round_1;
+    const __m512i offset =
+        _mm512_set1_epi32((1 << offset_bits) + ((1 << conv_params->round_1) >> 1));
+    const __m512i round_offset = _mm512_set1_epi32(
+        (1 << (offset_bits - conv_params->round_1)) +
+        (1 << (offset_bits - conv_params->round_1 - 1)));
+    const __m512i round_bits = _mm512_set1_epi32((1 << bits) >> 1);
+    const __m512i max        = _mm512_set1_epi32((1 << bd) - 1);
+
+    assert(bits >= 0);
+    assert(filter_params_x->taps == SUBPEL_TAPS && filter_params_y->taps == SUBPEL_TAPS);
+
+    highbd_convolve_2d_scale_hor_avx512(src - fo_vert * src_stride,
+                                        src_stride,
+                                        w,
+                                        im_h,
+                                        filter_params_x,
+                                        subpel_x_qn,
+                                        x_step_qn,
+                                        conv_params->round_0,
+                                        im_block,
+                                        im_stride,
+                                        bd);
+
+    int32_t y_qn = subpel_y_qn;
+    for (int32_t y = 0; y < h; y++, y_qn += y_step_qn) {
+        const int16_t *src_y = im_block + (y_qn >> SCALE_SUBPEL_BITS) * im_stride;
+        __m512i        coeffs[4];
+
+        prepare_coeffs_y_avx512(filter_params_y, y_qn, coeffs);
+
+        for (int32_t x = 0; x < w; x += 16) {
+            const __m512i res =
+                y_convolve_16(src_y + x, im_stride, coeffs, offset, conv_params->round_1);
+
+            if (conv_params->is_compound && !conv_params->do_average)
+                store_dst16_16(res, dst16 + y * dst16_stride + x);
+            else {
+                const __m512i r = round_dst_16(
+                    res, dst16 + y * dst16_stride + x, conv_params, round_offset, round_bits, bits);
+                const __m512i c =
+                    _mm512_min_epi32(_mm512_max_epi32(r, _mm512_setzero_si512()), max);
+
+                yy_storeu_256(dst + y * dst_stride + x, _mm512_cvtepi32_epi16(c));
+            }
+        }
+    }
+}
+
+#endif // EN_AVX512_SUPPORT
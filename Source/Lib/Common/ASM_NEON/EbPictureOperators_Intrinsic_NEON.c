@@ -0,0 +1,45 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include "common_dsp_rtcd.h"
+#include "synonyms_neon.h"
+
+void svt_residual_kernel8bit_neon(uint8_t *input, uint32_t input_stride, uint8_t *pred,
+                                  uint32_t pred_stride, int16_t *residual,
+                                  uint32_t residual_stride, uint32_t area_width,
+                                  uint32_t area_height) {
+    for (uint32_t y = 0; y < area_height; ++y) {
+        uint32_t x = 0;
+        for (; x + 16 <= area_width; x += 16) {
+            const uint8x16_t in = vld1q_u8(input + x);
+            const uint8x16_t pr = vld1q_u8(pred + x);
+            vst1q_s16(residual + x,
+                      vreinterpretq_s16_u16(vsubl_u8(vget_low_u8(in), vget_low_u8(pr))));
+            vst1q_s16(residual + x + 8,
+                      vreinterpretq_s16_u16(vsubl_u8(vget_high_u8(in), vget_high_u8(pr))));
+        }
+        if (x + 8 <= area_width) {
+            vst1q_s16(residual + x,
+                      vreinterpretq_s16_u16(vsubl_u8(vld1_u8(input + x), vld1_u8(pred + x))));
+            x += 8;
+        }
+        if (x + 4 <= area_width) {
+            const uint16x8_t d = vsubl_u8(load_u8_4x1(input + x), load_u8_4x1(pred + x));
+            vst1_s16(residual + x, vreinterpret_s16_u16(vget_low_u16(d)));
+            x += 4;
+        }
+        for (; x < area_width; ++x) residual[x] = (int16_t)input[x] - (int16_t)pred[x];
+
+        input += input_stride;
+        pred += pred_stride;
+        residual += residual_stride;
+    }
+}
@@ -0,0 +1,458 @@
+/*
+ * Copyright (c) 2018, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <assert.h>
+#include "common_dsp_rtcd.h"
+#include "convolve.h"
+#include "synonyms_neon.h"
+
+// The 8 tap filter of 8 pixels, the taps of the pixel i are s[i..i+7].
+static INLINE int32x4x2_t convolve8_8_neon(const int16x8_t s0, const int16x8_t s1,
+                                           const int16x8_t s2, const int16x8_t s3,
+                                           const int16x8_t s4, const int16x8_t s5,
+                                           const int16x8_t s6, const int16x8_t s7,
+                                           const int16x8_t f) {
+    const int16x4_t f_lo = vget_low_s16(f);
+    const int16x4_t f_hi = vget_high_s16(f);
+    int32x4x2_t     sum;
+    sum.val[0] = vmull_lane_s16(vget_low_s16(s0), f_lo, 0);
+    sum.val[0] = vmlal_lane_s16(sum.val[0], vget_low_s16(s1), f_lo, 1);
+    sum.val[0] = vmlal_lane_s16(sum.val[0], vget_low_s16(s2), f_lo, 2);
+    sum.val[0] = vmlal_lane_s16(sum.val[0], vget_low_s16(s3), f_lo, 3);
+    sum.val[0] = vmlal_lane_s16(sum.val[0], vget_low_s16(s4), f_hi, 0);
+    sum.val[0] = vmlal_lane_s16(sum.val[0], vget_low_s16(s5), f_hi, 1);
+    sum.val[0] = vmlal_lane_s16(sum.val[0], vget_low_s16(s6), f_hi, 2);
+    sum.val[0] = vmlal_lane_s16(sum.val[0], vget_low_s16(s7), f_hi, 3);
+    sum.val[1] = vmull_lane_s16(vget_high_s16(s0), f_lo, 0);
+    sum.val[1] = vmlal_lane_s16(sum.val[1], vget_high_s16(s1), f_lo, 1);
+    sum.val[1] = vmlal_lane_s16(sum.val[1], vget_high_s16(s2), f_lo, 2);
+    sum.val[1] = vmlal_lane_s16(sum.val[1], vget_high_s16(s3), f_lo, 3);
+    sum.val[1] = vmlal_lane_s16(sum.val[1], vget_high_s16(s4), f_hi, 0);
+    sum.val[1] = vmlal_lane_s16(sum.val[1], vget_high_s16(s5), f_hi, 1);
+    sum.val[1] = vmlal_lane_s16(sum.val[1], vget_high_s16(s6), f_hi, 2);
+    sum.val[1] = vmlal_lane_s16(sum.val[1], vget_high_s16(s7), f_hi, 3);
+    return sum;
+}
+
+// Rounds the two halves by (1 << shift0) then (1 << shift1) and clips to 8 bits
+static INLINE uint8x8_t round_clip_u8(int32x4x2_t sum, const int32x4_t shift0,
+                                      const int32x4_t shift1) {
+    sum.val[0] = vrshlq_s32(vrshlq_s32(sum.val[0], shift0), shift1);
+    sum.val[1] = vrshlq_s32(vrshlq_s32(sum.val[1], shift0), shift1);
+    return vqmovn_u16(vcombine_u16(vqmovun_s32(sum.val[0]), vqmovun_s32(sum.val[1])));
+}
+
+static INLINE int16x8_t u8_to_s16(const uint8x8_t a) { return vreinterpretq_s16_u16(vmovl_u8(a)); }
+
+// The 8 tap horizontal filter of 8 pixels. The taps are s[0..14], s[15] is not
+// loaded as it is past the C footprint at the right edge of the block.
+static INLINE int32x4x2_t convolve8_x_8_neon(const uint8_t *s, const int16x8_t f) {
+    const int16x8_t lo = u8_to_s16(vld1_u8(s));
+    const int16x8_t hi = u8_to_s16(vext_u8(vld1_u8(s + 7), vdup_n_u8(0), 1));
+    return convolve8_8_neon(lo,
+                            vextq_s16(lo, hi, 1),
+                            vextq_s16(lo, hi, 2),
+                            vextq_s16(lo, hi, 3),
+                            vextq_s16(lo, hi, 4),
+                            vextq_s16(lo, hi, 5),
+                            vextq_s16(lo, hi, 6),
+                            vextq_s16(lo, hi, 7),
+                            f);
+}
+
+// Writes res, the compound values of 8 pixels, to the compound buffer, or
+// averages them with it into dst8 as the C of the jnt convolutions does.
+static INLINE void jnt_store_8(const uint16x8_t res, ConvBufType *dst, uint8_t *dst8,
+                               const ConvolveParams *conv_params, const int32_t round_offset,
+                               const int32_t round_bits) {
+    if (!conv_params->do_average) {
+        vst1q_u16(dst, res);
+        return;
+    }
+    const uint16x8_t d = vld1q_u16(dst);
+    uint32x4_t       lo, hi;
+    int32x4_t        avg_shift;
+    if (conv_params->use_jnt_comp_avg) {
+        const uint16x4_t fwd = vdup_n_u16(conv_params->fwd_offset);
+        const uint16x4_t bck = vdup_n_u16(conv_params->bck_offset);
+        lo        = vmlal_u16(vmull_u16(vget_low_u16(d), fwd), vget_low_u16(res), bck);
+        hi        = vmlal_u16(vmull_u16(vget_high_u16(d), fwd), vget_high_u16(res), bck);
+        avg_shift = vdupq_n_s32(-DIST_PRECISION_BITS);
+    } else {
+        lo        = vaddl_u16(vget_low_u16(d), vget_low_u16(res));
+        hi        = vaddl_u16(vget_high_u16(d), vget_high_u16(res));
+        avg_shift = vdupq_n_s32(-1);
+    }
+    // The averages are positive, the arithmetic shifts match the C
+    const int32x4_t offset = vdupq_n_s32(round_offset);
+    int32x4x2_t     tmp;
+    tmp.val[0] = vsubq_s32(vshlq_s32(vreinterpretq_s32_u32(lo), avg_shift), offset);
+    tmp.val[1] = vsubq_s32(vshlq_s32(vreinterpretq_s32_u32(hi), avg_shift), offset);
+    vst1_u8(dst8, round_clip_u8(tmp, vdupq_n_s32(-round_bits), vdupq_n_s32(0)));
+}
+
+void svt_av1_convolve_2d_copy_sr_neon(const uint8_t *src, int32_t src_stride, uint8_t *dst,
+                                      int32_t dst_stride, int32_t w, int32_t h,
+                                      InterpFilterParams *filter_params_x,
+                                      InterpFilterParams *filter_params_y,
+                                      const int32_t subpel_x_q4, const int32_t subpel_y_q4,
+                                      ConvolveParams *conv_params) {
+    (void)filter_params_x;
+    (void)filter_params_y;
+    (void)subpel_x_q4;
+    (void)subpel_y_q4;
+    (void)conv_params;
+
+    if (w < 16) {
+        for (int32_t y = 0; y < h; ++y, src += src_stride, dst += dst_stride) memcpy(dst, src, w);
+        return;
+    }
+    for (int32_t y = 0; y < h; ++y, src += src_stride, dst += dst_stride)
+        for (int32_t x = 0; x < w; x += 16) vst1q_u8(dst + x, vld1q_u8(src + x));
+}
+
+void svt_av1_convolve_x_sr_neon(const uint8_t *src, int32_t src_stride, uint8_t *dst,
+                                int32_t dst_stride, int32_t w, int32_t h,
+                                InterpFilterParams *filter_params_x,
+                                InterpFilterParams *filter_params_y, const int32_t subpel_x_q4,
+                                const int32_t subpel_y_q4, ConvolveParams *conv_params) {
+    const int32_t fo_horiz = filter_params_x->taps / 2 - 1;
+    const int32_t bits     = FILTER_BITS - conv_params->round_0;
+    (void)filter_params_y;
+    (void)subpel_y_q4;
+
+    assert(bits >= 0);
+    assert(filter_params_x->taps == 8);
+
+    const int16_t *x_filter =
+        av1_get_interp_filter_subpel_kernel(*filter_params_x, subpel_x_q4 & SUBPEL_MASK);
+    const int16x8_t f      = vld1q_s16(x_filter);
+    const int32x4_t shift0 = vdupq_n_s32(-conv_params->round_0);
+    const int32x4_t shift1 = vdupq_n_s32(-bits);
+    const int32_t   w8     = w & ~7;
+
+    src -= fo_horiz;
+    for (int32_t y = 0; y < h; ++y, src += src_stride, dst += dst_stride) {
+        int32_t x = 0;
+        for (; x < w8; x += 8)
+            vst1_u8(dst + x, round_clip_u8(convolve8_x_8_neon(src + x, f), shift0, shift1));
+        for (; x < w; ++x) {
+            int32_t res = 0;
+            for (int32_t k = 0; k < 8; ++k) res += x_filter[k] * src[x + k];
+            res    = ROUND_POWER_OF_TWO(res, conv_params->round_0);
+            dst[x] = (uint8_t)clip_pixel_highbd(ROUND_POWER_OF_TWO(res, bits), 8);
+        }
+    }
+}
+
+void svt_av1_convolve_y_sr_neon(const uint8_t *src, int32_t src_stride, uint8_t *dst,
+                                int32_t dst_stride, int32_t w, int32_t h,
+                                InterpFilterParams *filter_params_x,
+                                InterpFilterParams *filter_params_y, const int32_t subpel_x_q4,
+                                const int32_t subpel_y_q4, ConvolveParams *conv_params) {
+    const int32_t fo_vert = filter_params_y->taps / 2 - 1;
+    (void)filter_params_x;
+    (void)subpel_x_q4;
+    (void)conv_params;
+
+    assert(filter_params_y->taps == 8);
+
+    const int16_t *y_filter =
+        av1_get_interp_filter_subpel_kernel(*filter_params_y, subpel_y_q4 & SUBPEL_MASK);
+    const int16x8_t f      = vld1q_s16(y_filter);
+    const int32x4_t shift0 = vdupq_n_s32(-FILTER_BITS);
+    const int32x4_t shift1 = vdupq_n_s32(0);
+
+    src -= fo_vert * src_stride;
+    if (w == 2) {
+        for (int32_t y = 0; y < h; ++y)
+            for (int32_t x = 0; x < w; ++x) {
+                int32_t res = 0;
+                for (int32_t k = 0; k < 8; ++k) res += y_filter[k] * src[(y + k) * src_stride + x];
+                dst[y * dst_stride + x] =
+                    (uint8_t)clip_pixel_highbd(ROUND_POWER_OF_TWO(res, FILTER_BITS), 8);
+            }
+        return;
+    }
+
+    // Two rows of 4 pixels, or one row of 8 pixels, per vector. The 8 source
+    // rows of the taps slide down the block.
+    if (w == 4) {
+        assert(!(h & 1));
+        const uint8_t *s = src;
+        int16x8_t      r[8];
+        for (int32_t k = 0; k < 6; ++k, s += src_stride)
+            r[k] = u8_to_s16(load_u8_4x2(s, src_stride));
+        for (int32_t y = 0; y < h; y += 2, s += 2 * src_stride, dst += 2 * dst_stride) {
+            r[6]                  = u8_to_s16(load_u8_4x2(s, src_stride));
+            r[7]                  = u8_to_s16(load_u8_4x2(s + src_stride, src_stride));
+            const int32x4x2_t sum = convolve8_8_neon(
+                r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], f);
+            const uint8x8_t d = round_clip_u8(sum, shift0, shift1);
+            store_u8_4x1(dst, d);
+            store_u8_4x1(dst + dst_stride, vext_u8(d, d, 4));
+            for (int32_t k = 0; k < 6; ++k) r[k] = r[k + 2];
+        }
+        return;
+    }
+
+    for (int32_t x = 0; x < w; x += 8) {
+        const uint8_t *s = src + x;
+        uint8_t *      d = dst + x;
+        int16x8_t      r[8];
+        for (int32_t k = 0; k < 7; ++k, s += src_stride) r[k] = u8_to_s16(vld1_u8(s));
+        for (int32_t y = 0; y < h; ++y, s += src_stride, d += dst_stride) {
+            r[7]                  = u8_to_s16(vld1_u8(s));
+            const int32x4x2_t sum = convolve8_8_neon(
+                r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], f);
+            vst1_u8(d, round_clip_u8(sum, shift0, shift1));
+            for (int32_t k = 0; k < 7; ++k) r[k] = r[k + 1];
+        }
+    }
+}
+
+void svt_av1_jnt_convolve_2d_copy_neon(const uint8_t *src, int32_t src_stride, uint8_t *dst8,
+                                       int32_t dst8_stride, int32_t w, int32_t h,
+                                       InterpFilterParams *filter_params_x,
+                                       InterpFilterParams *filter_params_y,
+                                       const int32_t subpel_x_q4, const int32_t subpel_y_q4,
+                                       ConvolveParams *conv_params) {
+    ConvBufType * dst          = conv_params->dst;
+    int32_t       dst_stride   = conv_params->dst_stride;
+    const int32_t bits         = FILTER_BITS * 2 - conv_params->round_1 - conv_params->round_0;
+    const int32_t bd           = 8;
+    const int32_t offset_bits  = bd + 2 * FILTER_BITS - conv_params->round_0;
+    const int32_t round_offset = (1 << (offset_bits - conv_params->round_1)) +
+                                 (1 << (offset_bits - conv_params->round_1 - 1));
+    (void)filter_params_x;
+    (void)filter_params_y;
+    (void)subpel_x_q4;
+    (void)subpel_y_q4;
+
+    if (w < 8) {
+        svt_av1_jnt_convolve_2d_copy_c(src,
+                                       src_stride,
+                                       dst8,
+                                       dst8_stride,
+                                       w,
+                                       h,
+                                       filter_params_x,
+                                       filter_params_y,
+                                       subpel_x_q4,
+                                       subpel_y_q4,
+                                       conv_params);
+        return;
+    }
+
+    const int16x8_t  left_shift = vdupq_n_s16(bits);
+    const uint16x8_t offset     = vdupq_n_u16(round_offset);
+
+    for (int32_t y = 0; y < h; ++y, src += src_stride, dst += dst_stride, dst8 += dst8_stride) {
+        for (int32_t x = 0; x < w; x += 8) {
+            const uint16x8_t res = vaddq_u16(vshlq_u16(vmovl_u8(vld1_u8(src + x)), left_shift),
+                                             offset);
+            jnt_store_8(res, dst + x, dst8 + x, conv_params, round_offset, bits);
+        }
+    }
+}
+
+void svt_av1_jnt_convolve_x_neon(const uint8_t *src, int32_t src_stride, uint8_t *dst8,
+                                 int32_t dst8_stride, int32_t w, int32_t h,
+                                 InterpFilterParams *filter_params_x,
+                                 InterpFilterParams *filter_params_y, const int32_t subpel_x_q4,
+                                 const int32_t subpel_y_q4, ConvolveParams *conv_params) {
+    ConvBufType * dst          = conv_params->dst;
+    int32_t       dst_stride   = conv_params->dst_stride;
+    const int32_t fo_horiz     = filter_params_x->taps / 2 - 1;
+    const int32_t bits         = FILTER_BITS - conv_params->round_1;
+    const int32_t bd           = 8;
+    const int32_t offset_bits  = bd + 2 * FILTER_BITS - conv_params->round_0;
+    const int32_t round_offset = (1 << (offset_bits - conv_params->round_1)) +
+                                 (1 << (offset_bits - conv_params->round_1 - 1));
+    const int32_t round_bits = 2 * FILTER_BITS - conv_params->round_0 - conv_params->round_1;
+
+    if (w < 8) {
+        svt_av1_jnt_convolve_x_c(src,
+                                 src_stride,
+                                 dst8,
+                                 dst8_stride,
+                                 w,
+                                 h,
+                                 filter_params_x,
+                                 filter_params_y,
+                                 subpel_x_q4,
+                                 subpel_y_q4,
+                                 conv_params);
+        return;
+    }
+    assert(filter_params_x->taps == 8);
+
+    const int16_t *x_filter =
+        av1_get_interp_filter_subpel_kernel(*filter_params_x, subpel_x_q4 & SUBPEL_MASK);
+    const int16x8_t f      = vld1q_s16(x_filter);
+    const int32x4_t shift0 = vdupq_n_s32(-conv_params->round_0);
+    const int32x4_t shift1 = vdupq_n_s32(bits);
+    const int32x4_t offset = vdupq_n_s32(round_offset);
+
+    src -= fo_horiz;
+    for (int32_t y = 0; y < h; ++y, src += src_stride, dst += dst_stride, dst8 += dst8_stride) {
+        for (int32_t x = 0; x < w; x += 8) {
+            int32x4x2_t sum = convolve8_x_8_neon(src + x, f);
+            sum.val[0] = vaddq_s32(vshlq_s32(vrshlq_s32(sum.val[0], shift0), shift1), offset);
+            sum.val[1] = vaddq_s32(vshlq_s32(vrshlq_s32(sum.val[1], shift0), shift1), offset);
+            jnt_store_8(vcombine_u16(vqmovun_s32(sum.val[0]), vqmovun_s32(sum.val[1])),
+                        dst + x,
+                        dst8 + x,
+                        conv_params,
+                        round_offset,
+                        round_bits);
+        }
+    }
+}
+
+void svt_av1_jnt_convolve_y_neon(const uint8_t *src, int32_t src_stride, uint8_t *dst8,
+                                 int32_t dst8_stride, int32_t w, int32_t h,
+                                 InterpFilterParams *filter_params_x,
+                                 InterpFilterParams *filter_params_y, const int32_t subpel_x_q4,
+                                 const int32_t subpel_y_q4, ConvolveParams *conv_params) {
+    ConvBufType * dst          = conv_params->dst;
+    int32_t       dst_stride   = conv_params->dst_stride;
+    const int32_t fo_vert      = filter_params_y->taps / 2 - 1;
+    const int32_t bits         = FILTER_BITS - conv_params->round_0;
+    const int32_t bd           = 8;
+    const int32_t offset_bits  = bd + 2 * FILTER_BITS - conv_params->round_0;
+    const int32_t round_offset = (1 << (offset_bits - conv_params->round_1)) +
+                                 (1 << (offset_bits - conv_params->round_1 - 1));
+    const int32_t round_bits = 2 * FILTER_BITS - conv_params->round_0 - conv_params->round_1;
+
+    if (w < 8) {
+        svt_av1_jnt_convolve_y_c(src,
+                                 src_stride,
+                                 dst8,
+                                 dst8_stride,
+                                 w,
+                                 h,
+                                 filter_params_x,
+                                 filter_params_y,
+                                 subpel_x_q4,
+                                 subpel_y_q4,
+                                 conv_params);
+        return;
+    }
+    assert(filter_params_y->taps == 8);
+
+    const int16_t *y_filter =
+        av1_get_interp_filter_subpel_kernel(*filter_params_y, subpel_y_q4 & SUBPEL_MASK);
+    const int16x8_t f      = vld1q_s16(y_filter);
+    const int32x4_t shift0 = vdupq_n_s32(bits);
+    const int32x4_t shift1 = vdupq_n_s32(-conv_params->round_1);
+    const int32x4_t offset = vdupq_n_s32(round_offset);
+
+    src -= fo_vert * src_stride;
+    for (int32_t x = 0; x < w; x += 8) {
+        const uint8_t *s  = src + x;
+        ConvBufType *  d  = dst + x;
+        uint8_t *      d8 = dst8 + x;
+        int16x8_t      r[8];
+        for (int32_t k = 0; k < 7; ++k, s += src_stride) r[k] = u8_to_s16(vld1_u8(s));
+        for (int32_t y = 0; y < h; ++y, s += src_stride, d += dst_stride, d8 += dst8_stride) {
+            r[7]            = u8_to_s16(vld1_u8(s));
+            int32x4x2_t sum = convolve8_8_neon(r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], f);
+            sum.val[0] = vaddq_s32(vrshlq_s32(vshlq_s32(sum.val[0], shift0), shift1), offset);
+            sum.val[1] = vaddq_s32(vrshlq_s32(vshlq_s32(sum.val[1], shift0), shift1), offset);
+            jnt_store_8(vcombine_u16(vqmovun_s32(sum.val[0]), vqmovun_s32(sum.val[1])),
+                        d,
+                        d8,
+                        conv_params,
+                        round_offset,
+                        round_bits);
+            for (int32_t k = 0; k < 7; ++k) r[k] = r[k + 1];
+        }
+    }
+}
+
+void svt_av1_jnt_convolve_2d_neon(const uint8_t *src, int32_t src_stride, uint8_t *dst8,
+                                  int32_t dst8_stride, int32_t w, int32_t h,
+                                  InterpFilterParams *filter_params_x,
+                                  InterpFilterParams *filter_params_y, const int32_t subpel_x_q4,
+                                  const int32_t subpel_y_q4, ConvolveParams *conv_params) {
+    DECLARE_ALIGNED(16, int16_t, im_block[(MAX_SB_SIZE + MAX_FILTER_TAP - 1) * MAX_SB_SIZE]);
+    ConvBufType * dst          = conv_params->dst;
+    int32_t       dst_stride   = conv_params->dst_stride;
+    const int32_t im_h         = h + filter_params_y->taps - 1;
+    const int32_t im_stride    = w;
+    const int32_t fo_vert      = filter_params_y->taps / 2 - 1;
+    const int32_t fo_horiz     = filter_params_x->taps / 2 - 1;
+    const int32_t bd           = 8;
+    const int32_t offset_bits  = bd + 2 * FILTER_BITS - conv_params->round_0;
+    const int32_t round_offset = (1 << (offset_bits - conv_params->round_1)) +
+                                 (1 << (offset_bits - conv_params->round_1 - 1));
+    const int32_t round_bits = 2 * FILTER_BITS - conv_params->round_0 - conv_params->round_1;
+
+    if (w < 8) {
+        svt_av1_jnt_convolve_2d_c(src,
+                                  src_stride,
+                                  dst8,
+                                  dst8_stride,
+                                  w,
+                                  h,
+                                  filter_params_x,
+                                  filter_params_y,
+                                  subpel_x_q4,
+                                  subpel_y_q4,
+                                  conv_params);
+        return;
+    }
+    assert(filter_params_x->taps == 8 && filter_params_y->taps == 8);
+
+    // horizontal filter, the values fit in 16 bits after the first rounding
+    const int16_t *x_filter =
+        av1_get_interp_filter_subpel_kernel(*filter_params_x, subpel_x_q4 & SUBPEL_MASK);
+    const int16x8_t fx        = vld1q_s16(x_filter);
+    const int32x4_t offset_x  = vdupq_n_s32(1 << (bd + FILTER_BITS - 1));
+    const int32x4_t shift_x   = vdupq_n_s32(-conv_params->round_0);
+    const uint8_t * src_horiz = src - fo_vert * src_stride - fo_horiz;
+    for (int32_t y = 0; y < im_h; ++y, src_horiz += src_stride) {
+        for (int32_t x = 0; x < w; x += 8) {
+            const int32x4x2_t sum = convolve8_x_8_neon(src_horiz + x, fx);
+            vst1q_s16(im_block + y * im_stride + x,
+                      vcombine_s16(vmovn_s32(vrshlq_s32(vaddq_s32(sum.val[0], offset_x), shift_x)),
+                                   vmovn_s32(vrshlq_s32(vaddq_s32(sum.val[1], offset_x), shift_x))));
+        }
+    }
+
+    // vertical filter
+    const int16_t *y_filter =
+        av1_get_interp_filter_subpel_kernel(*filter_params_y, subpel_y_q4 & SUBPEL_MASK);
+    const int16x8_t fy       = vld1q_s16(y_filter);
+    const int32x4_t offset_y = vdupq_n_s32(1 << offset_bits);
+    const int32x4_t shift_y  = vdupq_n_s32(-conv_params->round_1);
+    for (int32_t x = 0; x < w; x += 8) {
+        const int16_t *s  = im_block + x;
+        ConvBufType *  d  = dst + x;
+        uint8_t *      d8 = dst8 + x;
+        int16x8_t      r[8];
+        for (int32_t k = 0; k < 7; ++k, s += im_stride) r[k] = vld1q_s16(s);
+        for (int32_t y = 0; y < h; ++y, s += im_stride, d += dst_stride, d8 += dst8_stride) {
+            r[7]            = vld1q_s16(s);
+            int32x4x2_t sum = convolve8_8_neon(r[0], r[1], r[2], r[3], r[4], r[5], r[6], r[7], fy);
+            sum.val[0]      = vrshlq_s32(vaddq_s32(sum.val[0], offset_y), shift_y);
+            sum.val[1]      = vrshlq_s32(vaddq_s32(sum.val[1], offset_y), shift_y);
+            jnt_store_8(vcombine_u16(vqmovun_s32(sum.val[0]), vqmovun_s32(sum.val[1])),
+                        d,
+                        d8,
+                        conv_params,
+                        round_offset,
+                        round_bits);
+            for (int32_t k = 0; k < 7; ++k) r[k] = r[k + 1];
+        }
+    }
+}
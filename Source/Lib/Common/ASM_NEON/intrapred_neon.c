@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "common_dsp_rtcd.h"
+#include "synonyms_neon.h"
+
+// Sum of the n (4, 8, 16, 32 or 64) neighbouring pixels of a block edge
+static INLINE uint32_t sum_edge_neon(const uint8_t *p, int32_t n) {
+    if (n == 4)
+        return vaddlv_u8(load_u8_4x1(p));
+    if (n == 8)
+        return vaddlv_u8(vld1_u8(p));
+    uint16x8_t sum = vdupq_n_u16(0);
+    for (int32_t i = 0; i < n; i += 16) sum = vpadalq_u8(sum, vld1q_u8(p + i));
+    return horizontal_add_u16x8(sum);
+}
+
+static INLINE void fill_block_neon(uint8_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                                   const uint8x16_t v) {
+    for (int32_t r = 0; r < bh; r++, dst += stride) {
+        if (bw == 4)
+            store_u8_4x1(dst, vget_low_u8(v));
+        else if (bw == 8)
+            vst1_u8(dst, vget_low_u8(v));
+        else
+            for (int32_t c = 0; c < bw; c += 16) vst1q_u8(dst + c, v);
+    }
+}
+
+static INLINE void dc_128_predictor_neon(uint8_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                                         const uint8_t *above, const uint8_t *left) {
+    (void)above;
+    (void)left;
+    fill_block_neon(dst, stride, bw, bh, vdupq_n_u8(128));
+}
+
+static INLINE void dc_left_predictor_neon(uint8_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                                          const uint8_t *above, const uint8_t *left) {
+    (void)above;
+    const uint32_t sum = sum_edge_neon(left, bh);
+    fill_block_neon(dst, stride, bw, bh, vdupq_n_u8((uint8_t)((sum + (bh >> 1)) / bh)));
+}
+
+static INLINE void dc_top_predictor_neon(uint8_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                                         const uint8_t *above, const uint8_t *left) {
+    (void)left;
+    const uint32_t sum = sum_edge_neon(above, bw);
+    fill_block_neon(dst, stride, bw, bh, vdupq_n_u8((uint8_t)((sum + (bw >> 1)) / bw)));
+}
+
+static INLINE void dc_predictor_neon(uint8_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                                     const uint8_t *above, const uint8_t *left) {
+    const uint32_t sum   = sum_edge_neon(above, bw) + sum_edge_neon(left, bh);
+    const uint32_t count = bw + bh;
+    fill_block_neon(dst, stride, bw, bh, vdupq_n_u8((uint8_t)((sum + (count >> 1)) / count)));
+}
+
+static INLINE void v_predictor_neon(uint8_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                                    const uint8_t *above, const uint8_t *left) {
+    (void)left;
+    if (bw == 4) {
+        const uint8x8_t a = load_u8_4x1(above);
+        for (int32_t r = 0; r < bh; r++, dst += stride) store_u8_4x1(dst, a);
+    } else if (bw == 8) {
+        const uint8x8_t a = vld1_u8(above);
+        for (int32_t r = 0; r < bh; r++, dst += stride) vst1_u8(dst, a);
+    } else {
+        for (int32_t c = 0; c < bw; c += 16) {
+            const uint8x16_t a = vld1q_u8(above + c);
+            uint8_t *        d = dst + c;
+            for (int32_t r = 0; r < bh; r++, d += stride) vst1q_u8(d, a);
+        }
+    }
+}
+
+static INLINE void h_predictor_neon(uint8_t *dst, ptrdiff_t stride, int32_t bw, int32_t bh,
+                                    const uint8_t *above, const uint8_t *left) {
+    (void)above;
+    for (int32_t r = 0; r < bh; r++, dst += stride) {
+        const uint8x16_t l = vdupq_n_u8(left[r]);
+        if (bw == 4)
+            store_u8_4x1(dst, vget_low_u8(l));
+        else if (bw == 8)
+            vst1_u8(dst, vget_low_u8(l));
+        else
+            for (int32_t c = 0; c < bw; c += 16) vst1q_u8(dst + c, l);
+    }
+}
+
+#define INTRA_PRED_NEON(type, W, H)                                                              \
+    void svt_aom_##type##_predictor_##W##x##H##_neon(                                          \
+        uint8_t *dst, ptrdiff_t stride, const uint8_t *above, const uint8_t *left) {          \
+        type##_predictor_neon(dst, stride, W, H, above, left);                                 \
+    }
+
+#define INTRA_PRED_NEON_ALL_SIZES(type) \
+    INTRA_PRED_NEON(type, 4, 4)         \
+    INTRA_PRED_NEON(type, 4, 8)         \
+    INTRA_PRED_NEON(type, 4, 16)        \
+    INTRA_PRED_NEON(type, 8, 4)         \
+    INTRA_PRED_NEON(type, 8, 8)         \
+    INTRA_PRED_NEON(type, 8, 16)        \
+    INTRA_PRED_NEON(type, 8, 32)        \
+    INTRA_PRED_NEON(type, 16, 4)        \
+    INTRA_PRED_NEON(type, 16, 8)        \
+    INTRA_PRED_NEON(type, 16, 16)       \
+    INTRA_PRED_NEON(type, 16, 32)       \
+    INTRA_PRED_NEON(type, 16, 64)       \
+    INTRA_PRED_NEON(type, 32, 8)        \
+    INTRA_PRED_NEON(type, 32, 16)       \
+    INTRA_PRED_NEON(type, 32, 32)       \
+    INTRA_PRED_NEON(type, 32, 64)       \
+    INTRA_PRED_NEON(type, 64, 16)       \
+    INTRA_PRED_NEON(type, 64, 32)       \
+    INTRA_PRED_NEON(type, 64, 64)
+
+INTRA_PRED_NEON_ALL_SIZES(dc)
+INTRA_PRED_NEON_ALL_SIZES(dc_top)
+INTRA_PRED_NEON_ALL_SIZES(dc_left)
+INTRA_PRED_NEON_ALL_SIZES(dc_128)
+INTRA_PRED_NEON_ALL_SIZES(v)
+INTRA_PRED_NEON_ALL_SIZES(h)
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#ifndef AOM_DSP_ARM_SYNONYMS_NEON_H_
+#define AOM_DSP_ARM_SYNONYMS_NEON_H_
+
+#include <arm_neon.h>
+#include <string.h>
+#include "EbDefinitions.h"
+
+/**
+  * Various reusable shorthands for AArch64 Advanced SIMD intrinsics.
+  */
+
+// Loads 4 bytes from an address of any alignment to the low half, the upper
+// lanes are zeroed.
+static INLINE uint8x8_t load_u8_4x1(const uint8_t *p) {
+    uint32_t a;
+    memcpy(&a, p, sizeof(a));
+    return vreinterpret_u8_u32(vset_lane_u32(a, vdup_n_u32(0), 0));
+}
+
+// Loads 4 bytes of 2 rows.
+static INLINE uint8x8_t load_u8_4x2(const uint8_t *p, ptrdiff_t stride) {
+    uint32_t a, b;
+    memcpy(&a, p, sizeof(a));
+    memcpy(&b, p + stride, sizeof(b));
+    return vreinterpret_u8_u32(vset_lane_u32(b, vset_lane_u32(a, vdup_n_u32(0), 0), 1));
+}
+
+static INLINE void store_u8_4x1(uint8_t *p, const uint8x8_t a) {
+    const uint32_t v = vget_lane_u32(vreinterpret_u32_u8(a), 0);
+    memcpy(p, &v, sizeof(v));
+}
+
+static INLINE uint32_t horizontal_add_u16x8(const uint16x8_t a) { return vaddlvq_u16(a); }
+
+static INLINE uint32_t horizontal_add_u32x4(const uint32x4_t a) { return vaddvq_u32(a); }
+
+static INLINE int32_t horizontal_add_s32x4(const int32x4_t a) { return vaddvq_s32(a); }
+
+static INLINE int64_t horizontal_add_s64x2(const int64x2_t a) { return vaddvq_s64(a); }
+
+#endif // AOM_DSP_ARM_SYNONYMS_NEON_H_
@@ -425,6 +425,14 @@ void svt_aom_highbd_dc_top_predictor_8x16_sse2(uint16_t *dst, ptrdiff_t stride,
     dc_top_predictor_8xh(dst, stride, 16, above);
 }
 
+void svt_aom_highbd_dc_top_predictor_8x32_sse2(uint16_t *dst, ptrdiff_t stride,
+                                               const uint16_t *above, const uint16_t *left,
+                                               int32_t bd) {
+    (void)left;
+    (void)bd;
+    dc_top_predictor_8xh(dst, stride, 32, above);
+}
+
 // -----------------------------------------------------------------------------
 // DC_LEFT
 
@@ -259,3 +259,82 @@ void svt_av1_upsample_intra_edge_sse4_1(uint8_t *p, int32_t sz) {
         n -= 16;
     }
 }
+
+// =============================================================================
+// 2x2 high bit depth predictors
+
+static const int32_t sm_weight_log2_scale = 8;
+
+// bs = 2, pairs of (weight, scale - weight) of the 4 pixels
+EB_ALIGN(16) static const uint16_t sm_weights_2x2[8] = {255, 1, 255, 1, 128, 128, 128, 128};
+
+static INLINE __m128i load_u16_2(const uint16_t *p) { return _mm_cvtsi32_si128(*(const int32_t *)p); }
+
+// Stores the lanes 0, 1 to the first row and the lanes 2, 3 to the second row
+static INLINE void store_2x2(uint16_t *dst, ptrdiff_t stride, const __m128i pred) {
+    *(int32_t *)dst            = _mm_cvtsi128_si32(pred);
+    *(int32_t *)(dst + stride) = _mm_extract_epi32(pred, 1);
+}
+
+static INLINE void dc_store_2x2(uint16_t *dst, ptrdiff_t stride, const __m128i dc) {
+    store_2x2(dst, stride, _mm_shufflelo_epi16(dc, 0));
+}
+
+void svt_aom_highbd_dc_left_predictor_2x2_sse4_1(uint16_t *dst, ptrdiff_t stride,
+                                                 const uint16_t *above, const uint16_t *left,
+                                                 int32_t bd) {
+    (void)above;
+    (void)bd;
+    const __m128i l = load_u16_2(left);
+    // (left[0] + left[1] + 1) >> 1
+    dc_store_2x2(dst, stride, _mm_avg_epu16(l, _mm_srli_epi32(l, 16)));
+}
+
+void svt_aom_highbd_dc_predictor_2x2_sse4_1(uint16_t *dst, ptrdiff_t stride, const uint16_t *above,
+                                            const uint16_t *left, int32_t bd) {
+    (void)bd;
+    const __m128i al  = _mm_unpacklo_epi32(load_u16_2(above), load_u16_2(left));
+    __m128i       sum = _mm_madd_epi16(al, _mm_set1_epi16(1));
+    sum               = _mm_add_epi32(sum, _mm_srli_si128(sum, 4));
+    sum               = _mm_srli_epi32(_mm_add_epi32(sum, _mm_cvtsi32_si128(2)), 2);
+    dc_store_2x2(dst, stride, sum);
+}
+
+// Vertical smoothing of the 4 pixels, rows in the lanes 0, 1 and 2, 3
+static INLINE __m128i smooth_v_sum_2x2(const uint16_t *above, const uint16_t *left,
+                                       const __m128i weights) {
+    const __m128i below = _mm_set1_epi16((int16_t)left[1]);
+    // above[0], below, above[1], below
+    const __m128i ab = _mm_unpacklo_epi16(load_u16_2(above), below);
+    // rows use the weights (255, 1) and (128, 128)
+    return _mm_madd_epi16(_mm_unpacklo_epi64(ab, ab), weights);
+}
+
+void svt_aom_highbd_smooth_v_predictor_2x2_sse4_1(uint16_t *dst, ptrdiff_t stride,
+                                                  const uint16_t *above, const uint16_t *left,
+                                                  int32_t bd) {
+    (void)bd;
+    const __m128i weights = _mm_load_si128((const __m128i *)sm_weights_2x2);
+    __m128i       sum     = smooth_v_sum_2x2(above, left, weights);
+    sum = _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1 << (sm_weight_log2_scale - 1))),
+                         sm_weight_log2_scale);
+    store_2x2(dst, stride, _mm_packus_epi32(sum, sum));
+}
+
+void svt_aom_highbd_smooth_predictor_2x2_sse4_1(uint16_t *dst, ptrdiff_t stride,
+                                                const uint16_t *above, const uint16_t *left,
+                                                int32_t bd) {
+    (void)bd;
+    const __m128i weights = _mm_load_si128((const __m128i *)sm_weights_2x2);
+    const __m128i right   = _mm_set1_epi16((int16_t)above[1]);
+    // left[0], right, left[0], right, left[1], right, left[1], right
+    const __m128i l  = _mm_unpacklo_epi16(load_u16_2(left), load_u16_2(left));
+    const __m128i lr = _mm_unpacklo_epi16(l, right);
+    // columns use the weights (255, 1) and (128, 128)
+    const __m128i w = _mm_unpacklo_epi32(weights, _mm_srli_si128(weights, 8));
+    __m128i       sum =
+        _mm_add_epi32(smooth_v_sum_2x2(above, left, weights), _mm_madd_epi16(lr, w));
+    sum = _mm_srli_epi32(_mm_add_epi32(sum, _mm_set1_epi32(1 << sm_weight_log2_scale)),
+                         1 + sm_weight_log2_scale);
+    store_2x2(dst, stride, _mm_packus_epi32(sum, sum));
+}
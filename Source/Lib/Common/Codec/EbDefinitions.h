@@ -2963,6 +2963,30 @@ typedef enum HmeDecimation
     ONE_DECIMATION_HME = 1, // HME search on quarter-res picture; 1 refinement level
     TWO_DECIMATION_HME = 2, // HME search on sixteenth-res picture; 2 refinement level
 } HmeDecimation;
+
+// Search area of a batched full pel SAD search (svt_sad_loop_kernel_multi)
+typedef struct SadLoopSearchArea {
+    uint8_t *ref; // input parameter, top left sample of the search area
+    uint32_t ref_stride; // input parameter, reference stride (with line skipping)
+    uint32_t ref_stride_raw; // input parameter, reference stride (no line skipping)
+    int16_t  width; // input parameter, search area width
+    int16_t  height; // input parameter, search area height
+    int16_t  x_best; // output parameter, best position in the search area
+    int16_t  y_best; // output parameter, best position in the search area
+    uint64_t best_sad; // output parameter, SAD at the best position
+} SadLoopSearchArea;
+
+// Scaling of the film grain added to one plane (svt_av1_add_luma_grain / svt_av1_add_chroma_grain)
+typedef struct GrainScaling {
+    const int32_t *scaling_lut; // 256 entries piecewise linear scaling function
+    int32_t        scaling_shift;
+    int32_t        mult; // chroma only, weight of the chroma sample in the lut index
+    int32_t        luma_mult; // chroma only, weight of the average luma sample in the lut index
+    int32_t        offset; // chroma only, offset of the lut index
+    int32_t        min_val; // output clipping range
+    int32_t        max_val;
+    int32_t        bit_depth;
+} GrainScaling;
 static const uint16_t ep_to_pa_block_index[BLOCK_MAX_COUNT_SB_64] = {
     0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,
     1 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,0 ,
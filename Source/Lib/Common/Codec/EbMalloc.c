@@ -16,10 +16,38 @@
 #define LOG_TAG "SvtMalloc"
 #include "EbLog.h"
 
+#ifdef _WIN32
+#include <windows.h>
+// GetProcessMemoryInfo() from kernel32, without linking psapi
+#define PSAPI_VERSION 2
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
 void svt_print_alloc_fail(const char* file, int line) {
     SVT_FATAL("allocate memory failed, at %s, L%d\n", file, line);
 }
 
+uint64_t svt_get_peak_resident_memory(void) {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage))
+        return 0;
+#ifdef __APPLE__
+    return (uint64_t)usage.ru_maxrss;
+#else
+    // in kilobytes
+    return (uint64_t)usage.ru_maxrss << 10;
+#endif
+#endif
+}
+
 #ifdef DEBUG_MEMORY_USAGE
 
 static EbHandle g_malloc_mutex;
@@ -79,6 +107,14 @@ static MemoryEntry g_mem_entry[MEM_ENTRY_SIZE];
 static EbBool g_add_mem_entry_warning    = EB_TRUE;
 static EbBool g_remove_mem_entry_warning = EB_TRUE;
 
+// Allocated memory, current and peak, updated with the mem entries
+static size_t g_mem_usage;
+static size_t g_mem_peak_usage;
+
+static inline EbBool is_memory_type(EbPtrType type) {
+    return type == EB_N_PTR || type == EB_C_PTR || type == EB_A_PTR;
+}
+
 /*********************************************************************************
 *
 * @brief
@@ -152,6 +188,11 @@ static const char* mem_type_name(EbPtrType type) {
 static EbBool add_mem_entry(MemoryEntry* e, void* param) {
     if (!e->ptr) {
         EB_MEMCPY(e, param, sizeof(*e));
+        if (is_memory_type(e->type)) {
+            g_mem_usage += e->count;
+            if (g_mem_usage > g_mem_peak_usage)
+                g_mem_peak_usage = g_mem_usage;
+        }
         return EB_TRUE;
     }
     return EB_FALSE;
@@ -162,6 +203,8 @@ static EbBool remove_mem_entry(MemoryEntry* e, void* param) {
     if (e->ptr == item->ptr) {
         // The second case is a special case, we use EB_FREE to free calloced memory
         if (e->type == item->type || (e->type == EB_C_PTR && item->type == EB_N_PTR)) {
+            if (is_memory_type(e->type))
+                g_mem_usage -= e->count;
             e->ptr = NULL;
             return EB_TRUE;
         }
@@ -278,6 +321,8 @@ void svt_print_memory_usage() {
     get_memory_usage_and_scale(
         sum.amount[EB_N_PTR] + sum.amount[EB_C_PTR] + sum.amount[EB_A_PTR], &usage, &scale);
     SVT_INFO("    total allocated memory:       %.2lf %cB\n", usage, scale);
+    get_memory_usage_and_scale(g_mem_peak_usage, &usage, &scale);
+    SVT_INFO("    peak allocated memory:        %.2lf %cB\n", usage, scale);
     get_memory_usage_and_scale(sum.amount[EB_N_PTR], &usage, &scale);
     SVT_INFO("        malloced memory:          %.2lf %cB\n", usage, scale);
     get_memory_usage_and_scale(sum.amount[EB_C_PTR], &usage, &scale);
@@ -296,6 +341,16 @@ void svt_print_memory_usage() {
 #endif
 }
 
+void svt_print_memory_peak_usage() {
+    double usage;
+    char   scale;
+    EbHandle m = get_malloc_mutex();
+    svt_block_on_mutex(m);
+    get_memory_usage_and_scale(g_mem_peak_usage, &usage, &scale);
+    svt_release_mutex(m);
+    SVT_INFO("SVT peak allocated memory: %.2lf %cB\n", usage, scale);
+}
+
 void svt_increase_component_count() {
     EbHandle m = get_malloc_mutex();
     svt_block_on_mutex(m);
@@ -22,8 +22,13 @@
 
 void svt_print_alloc_fail(const char* file, int line);
 
+/* Peak resident memory of the process in bytes, 0 when unknown. Available
+ * in every build, unlike the DEBUG_MEMORY_USAGE tracking below. */
+uint64_t svt_get_peak_resident_memory(void);
+
 #ifdef DEBUG_MEMORY_USAGE
 void svt_print_memory_usage(void);
+void svt_print_memory_peak_usage(void);
 void svt_increase_component_count(void);
 void svt_decrease_component_count(void);
 void svt_add_mem_entry(void* ptr, EbPtrType type, size_t count, const char* file, uint32_t line);
@@ -37,6 +42,9 @@ void svt_remove_mem_entry(void* ptr, EbPtrType type);
 #define svt_print_memory_usage() \
     do {                         \
     } while (0)
+#define svt_print_memory_peak_usage() \
+    do {                              \
+    } while (0)
 #define svt_increase_component_count() \
     do {                               \
     } while (0)
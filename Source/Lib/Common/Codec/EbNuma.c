@@ -0,0 +1,195 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "EbNuma.h"
+
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_set_mempolicy) && defined(SYS_get_mempolicy) && \
+    defined(SYS_move_pages) && defined(SYS_getcpu)
+
+// Memory policy modes of <linux/mempolicy.h>
+#define NUMA_MPOL_DEFAULT 0
+#define NUMA_MPOL_PREFERRED 1
+#define NUMA_MPOL_INTERLEAVE 3
+
+#define NUMA_PAGE_BATCH 1024
+// Nodes of the node masks passed to the kernel
+#define NUMA_MASK_BITS (sizeof(unsigned long) * 8)
+
+/* Calls fn for each number of a "0-3,8,10-11" list read from path */
+static uint32_t read_list(const char *path, void (*fn)(uint32_t, void *), void *arg) {
+    FILE *fin = fopen(path, "r");
+    if (!fin)
+        return 0;
+    uint32_t count = 0;
+    char     line[4096];
+    if (fgets(line, sizeof(line), fin)) {
+        char *p = line;
+        while (*p >= '0' && *p <= '9') {
+            uint32_t first = (uint32_t)strtoul(p, &p, 10);
+            uint32_t last  = first;
+            if (*p == '-')
+                last = (uint32_t)strtoul(p + 1, &p, 10);
+            for (uint32_t i = first; i <= last; i++, count++) fn(i, arg);
+            if (*p == ',')
+                p++;
+        }
+    }
+    fclose(fin);
+    return count;
+}
+
+static void max_of(uint32_t n, void *arg) {
+    uint32_t *max = (uint32_t *)arg;
+    if (n + 1 > *max)
+        *max = n + 1;
+}
+
+typedef struct CpuList {
+    uint32_t *cpus;
+    uint32_t  max_cpus;
+    uint32_t  num;
+} CpuList;
+
+static void add_cpu(uint32_t n, void *arg) {
+    CpuList *list = (CpuList *)arg;
+    if (list->num < list->max_cpus)
+        list->cpus[list->num++] = n;
+}
+
+EbBool svt_numa_supported(void) {
+    int mode;
+    return syscall(SYS_get_mempolicy, &mode, NULL, 0, NULL, 0) == 0 ? EB_TRUE : EB_FALSE;
+}
+
+uint32_t svt_numa_node_count(void) {
+    uint32_t count = 0;
+    read_list("/sys/devices/system/node/online", max_of, &count);
+    if (count == 0)
+        return 1;
+    return count < NUMA_MASK_BITS ? count : NUMA_MASK_BITS;
+}
+
+uint32_t svt_numa_current_node(void) {
+    unsigned cpu, node;
+    if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0 || node >= NUMA_MASK_BITS)
+        return 0;
+    return node;
+}
+
+uint32_t svt_numa_node_cpus(uint32_t node, uint32_t *cpus, uint32_t max_cpus) {
+    char    path[64];
+    CpuList list = {cpus, max_cpus, 0};
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+    return read_list(path, add_cpu, &list);
+}
+
+void svt_numa_get_policy(SvtNumaPolicy *policy) {
+    int           mode  = NUMA_MPOL_DEFAULT;
+    unsigned long nodes = 0;
+    if (syscall(SYS_get_mempolicy, &mode, &nodes, NUMA_MASK_BITS, NULL, 0) != 0) {
+        mode  = NUMA_MPOL_DEFAULT;
+        nodes = 0;
+    }
+    policy->mode  = mode;
+    policy->nodes = nodes;
+}
+
+// The kernel reads maxnode - 1 bits of the node mask
+static void set_policy(int mode, unsigned long nodes) {
+    syscall(SYS_set_mempolicy, mode, nodes ? &nodes : NULL, nodes ? NUMA_MASK_BITS + 1 : 0);
+}
+
+void svt_numa_set_policy(const SvtNumaPolicy *policy) {
+    set_policy(policy->mode, (unsigned long)policy->nodes);
+}
+
+void svt_numa_prefer_node(uint32_t node) {
+    set_policy(NUMA_MPOL_PREFERRED, 1UL << node);
+}
+
+void svt_numa_interleave(void) {
+    const uint32_t node_count = svt_numa_node_count();
+    set_policy(NUMA_MPOL_INTERLEAVE,
+               node_count == NUMA_MASK_BITS ? ~0UL : (1UL << node_count) - 1);
+}
+
+void svt_numa_count_pages(const void *ptr, size_t size, uint64_t *pages, uint32_t max_nodes,
+                          uint64_t *other_pages, uint64_t *unplaced_pages) {
+    if (!ptr || !size)
+        return;
+    const uintptr_t page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t       addr      = (uintptr_t)ptr & ~(page_size - 1);
+    const uintptr_t end       = (uintptr_t)ptr + size;
+    void *          batch[NUMA_PAGE_BATCH];
+    int             status[NUMA_PAGE_BATCH];
+    while (addr < end) {
+        unsigned long count = 0;
+        for (; addr < end && count < NUMA_PAGE_BATCH; addr += page_size)
+            batch[count++] = (void *)addr;
+        if (syscall(SYS_move_pages, 0, count, batch, NULL, status, 0) != 0) {
+            *unplaced_pages += count;
+            continue;
+        }
+        for (unsigned long i = 0; i < count; i++) {
+            if (status[i] < 0)
+                (*unplaced_pages)++;
+            else if ((uint32_t)status[i] < max_nodes)
+                pages[status[i]]++;
+            else
+                (*other_pages)++;
+        }
+    }
+}
+
+#else
+
+EbBool svt_numa_supported(void) { return EB_FALSE; }
+
+uint32_t svt_numa_node_count(void) { return 1; }
+
+uint32_t svt_numa_current_node(void) { return 0; }
+
+uint32_t svt_numa_node_cpus(uint32_t node, uint32_t *cpus, uint32_t max_cpus) {
+    UNUSED(node);
+    UNUSED(cpus);
+    UNUSED(max_cpus);
+    return 0;
+}
+
+void svt_numa_get_policy(SvtNumaPolicy *policy) {
+    policy->mode  = 0;
+    policy->nodes = 0;
+}
+
+void svt_numa_set_policy(const SvtNumaPolicy *policy) { UNUSED(policy); }
+
+void svt_numa_prefer_node(uint32_t node) { UNUSED(node); }
+
+void svt_numa_interleave(void) {}
+
+void svt_numa_count_pages(const void *ptr, size_t size, uint64_t *pages, uint32_t max_nodes,
+                          uint64_t *other_pages, uint64_t *unplaced_pages) {
+    UNUSED(ptr);
+    UNUSED(size);
+    UNUSED(pages);
+    UNUSED(max_nodes);
+    UNUSED(other_pages);
+    UNUSED(unplaced_pages);
+}
+
+#endif
@@ -0,0 +1,63 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#ifndef EbNuma_h
+#define EbNuma_h
+
+#include <stddef.h>
+#include "EbDefinitions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Wrappers of the NUMA memory policy system calls. They are only implemented
+// on Linux, where they talk to the kernel directly so that no libnuma is
+// needed; elsewhere the system is seen as a single node.
+
+/* Memory policy of a thread, as returned by svt_numa_get_policy() */
+typedef struct SvtNumaPolicy {
+    int32_t  mode;
+    uint64_t nodes;
+} SvtNumaPolicy;
+
+/* EB_TRUE when the memory policy of the threads can be set */
+EbBool svt_numa_supported(void);
+/* Number of NUMA nodes, at least 1 */
+uint32_t svt_numa_node_count(void);
+/* Node of the processor the calling thread runs on */
+uint32_t svt_numa_current_node(void);
+/* Returns the number of logical processors of node and fills cpus with the
+ * first max_cpus of them. cpus may be NULL when max_cpus is 0. */
+uint32_t svt_numa_node_cpus(uint32_t node, uint32_t *cpus, uint32_t max_cpus);
+
+/* Save and restore the memory policy of the calling thread. The threads
+ * created by a thread start with its memory policy. */
+void svt_numa_get_policy(SvtNumaPolicy *policy);
+void svt_numa_set_policy(const SvtNumaPolicy *policy);
+/* Allocate the memory first touched by the calling thread from node, or from
+ * the other nodes when node is full */
+void svt_numa_prefer_node(uint32_t node);
+/* Allocate the memory first touched by the calling thread page by page from
+ * each node in turn */
+void svt_numa_interleave(void);
+
+/* Adds the pages of [ptr, ptr + size) to the page count of the node they
+ * reside on. Pages of the nodes past max_nodes are added to *other_pages, the
+ * pages not touched yet to *unplaced_pages. */
+void svt_numa_count_pages(const void *ptr, size_t size, uint64_t *pages, uint32_t max_nodes,
+                          uint64_t *other_pages, uint64_t *unplaced_pages);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EbNuma_h
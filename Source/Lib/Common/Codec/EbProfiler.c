@@ -0,0 +1,274 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "EbProfiler.h"
+#include "EbTime.h"
+#include "EbUtility.h"
+
+// The events of a thread past this count are dropped
+#define PROFILER_MAX_EVENTS (1 << 20)
+#define PROFILER_MIN_EVENTS 1024
+// Shorter stalls are only counted, not traced
+#define PROFILER_MIN_STALL_US 10
+// Upper bound of the size of one event in the trace
+#define PROFILER_EVENT_JSON_SIZE 160
+
+// Profile of the calling thread
+static EB_THREAD_LOCAL EbProfilerThread *current_thread;
+
+static uint64_t get_time_us(void) {
+    uint64_t seconds, useconds;
+    svt_av1_get_time(&seconds, &useconds);
+    return seconds * 1000000 + useconds;
+}
+
+static uint64_t profiler_time_us(const EbProfiler *profiler) {
+    return get_time_us() - profiler->start_us;
+}
+
+static void svt_profiler_dctor(EbPtr p) {
+    EbProfiler *obj = (EbProfiler *)p;
+    if (obj->threads) {
+        for (uint32_t i = 0; i < obj->max_thread_count; i++) {
+            if (obj->threads[i])
+                free(obj->threads[i]->events);
+        }
+    }
+    EB_FREE_PTR_ARRAY(obj->threads, obj->max_thread_count);
+    free(obj->trace);
+}
+
+EbErrorType svt_profiler_ctor(EbProfiler *profiler, uint8_t level, uint32_t max_thread_count,
+                              const char *const *stage_names, uint32_t stage_count) {
+    profiler->dctor            = svt_profiler_dctor;
+    profiler->level            = level;
+    profiler->start_us         = get_time_us();
+    profiler->stage_names      = stage_names;
+    profiler->stage_count      = stage_count;
+    profiler->max_thread_count = max_thread_count;
+    EB_ALLOC_PTR_ARRAY(profiler->threads, max_thread_count);
+    // One allocation per thread, so that the threads do not write to the
+    // same cache lines
+    for (uint32_t i = 0; i < max_thread_count; i++) {
+        EB_CALLOC(profiler->threads[i], 1, sizeof(EbProfilerThread));
+        profiler->threads[i]->profiler = profiler;
+    }
+    return EB_ErrorNone;
+}
+
+typedef struct ProfiledThreadStart {
+    EbProfilerThread *thread;
+    void *(*thread_function)(void *);
+    void *thread_context;
+} ProfiledThreadStart;
+
+static void *profiled_thread_kernel(void *input_ptr) {
+    ProfiledThreadStart start = *(ProfiledThreadStart *)input_ptr;
+    free(input_ptr);
+
+    current_thread                = start.thread;
+    start.thread->period_start_us = profiler_time_us(start.thread->profiler);
+    void *ret                     = start.thread_function(start.thread_context);
+    current_thread                = NULL;
+    return ret;
+}
+
+EbHandle svt_profiler_create_thread(EbProfiler *profiler, uint32_t stage, EbHandle group_handle,
+                                    void *thread_function(void *), void *thread_context) {
+    if (profiler == NULL || profiler->thread_count == profiler->max_thread_count)
+        return svt_create_pool_thread(group_handle, thread_function, thread_context);
+
+    EbProfilerThread *thread = profiler->threads[profiler->thread_count];
+    thread->stage            = stage;
+    thread->index            = 0;
+    for (uint32_t i = 0; i < profiler->thread_count; i++)
+        thread->index += profiler->threads[i]->stage == stage;
+
+    ProfiledThreadStart *start = (ProfiledThreadStart *)malloc(sizeof(*start));
+    if (start == NULL)
+        return NULL;
+    start->thread          = thread;
+    start->thread_function = thread_function;
+    start->thread_context  = thread_context;
+
+    EbHandle thread_handle = svt_create_pool_thread(group_handle, profiled_thread_kernel, start);
+    if (thread_handle == NULL)
+        free(start);
+    else
+        profiler->thread_count++;
+    return thread_handle;
+}
+
+EbProfilerThread *svt_profiler_current_thread(void) { return current_thread; }
+
+static void add_event(EbProfilerThread *thread, EbProfilerEventType type, uint64_t start_us,
+                      uint64_t duration_us, uint32_t queue_depth) {
+    if (thread->profiler->level < 2)
+        return;
+    if (thread->event_count == thread->event_capacity) {
+        const uint32_t capacity = thread->event_capacity ? thread->event_capacity * 2
+                                                         : PROFILER_MIN_EVENTS;
+        EbProfilerEvent *events = capacity <= PROFILER_MAX_EVENTS
+            ? (EbProfilerEvent *)realloc(thread->events, capacity * sizeof(*events))
+            : NULL;
+        if (events == NULL) {
+            thread->dropped_events++;
+            return;
+        }
+        thread->events         = events;
+        thread->event_capacity = capacity;
+    }
+    EbProfilerEvent *event = &thread->events[thread->event_count++];
+    event->start_us        = start_us;
+    event->duration_us     = (uint32_t)duration_us;
+    event->queue_depth     = (uint16_t)(queue_depth < UINT16_MAX ? queue_depth : UINT16_MAX);
+    event->type            = (uint16_t)type;
+}
+
+void svt_profiler_input_wait(EbProfilerThread *thread, uint32_t queue_depth) {
+    const uint64_t now = profiler_time_us(thread->profiler);
+    if (thread->busy) {
+        const uint64_t duration = now - thread->period_start_us;
+        thread->busy_us += duration - thread->period_stall_us;
+        add_event(thread, PROFILER_EVENT_BUSY, thread->period_start_us, duration,
+                  thread->queue_depth);
+        thread->busy = EB_FALSE;
+    }
+    thread->period_start_us = now;
+    thread->queue_depth     = queue_depth;
+    thread->waiting         = EB_TRUE;
+}
+
+void svt_profiler_input_ready(EbProfilerThread *thread, EbBool got_object) {
+    const uint64_t now = profiler_time_us(thread->profiler);
+    thread->idle_us += now - thread->period_start_us;
+    thread->period_start_us = now;
+    thread->period_stall_us = 0;
+    thread->waiting         = EB_FALSE;
+    if (got_object) {
+        thread->busy = EB_TRUE;
+        thread->objects++;
+        thread->queue_depth_sum += thread->queue_depth;
+        thread->max_queue_depth = MAX(thread->max_queue_depth, thread->queue_depth);
+    }
+}
+
+void svt_profiler_output_wait(EbProfilerThread *thread) {
+    thread->stall_start_us = profiler_time_us(thread->profiler);
+}
+
+void svt_profiler_output_ready(EbProfilerThread *thread) {
+    const uint64_t duration = profiler_time_us(thread->profiler) - thread->stall_start_us;
+    thread->stall_us += duration;
+    thread->period_stall_us += duration;
+    if (duration >= PROFILER_MIN_STALL_US)
+        add_event(thread, PROFILER_EVENT_STALL, thread->stall_start_us, duration, 0);
+}
+
+void svt_profiler_get_profile(const EbProfiler *profiler, SvtAv1PipelineProfile *profile) {
+    // Stage of each slot of profile->stages
+    uint32_t stage_of_slot[SVT_AV1_MAX_PIPELINE_STAGES];
+    uint64_t queue_depth_sum[SVT_AV1_MAX_PIPELINE_STAGES] = {0};
+
+    memset(profile, 0, sizeof(*profile));
+    profile->elapsed_us = profiler_time_us(profiler);
+    for (uint32_t i = 0; i < profiler->thread_count; i++) {
+        const EbProfilerThread *thread = profiler->threads[i];
+        uint32_t                slot   = 0;
+        while (slot < profile->num_stages && stage_of_slot[slot] != thread->stage) slot++;
+        if (slot == SVT_AV1_MAX_PIPELINE_STAGES)
+            continue;
+        SvtAv1StageProfile *stage = &profile->stages[slot];
+        if (slot == profile->num_stages) {
+            stage_of_slot[profile->num_stages++] = thread->stage;
+            stage->name = thread->stage < profiler->stage_count ? profiler->stage_names[thread->stage]
+                                                                : "unknown";
+        }
+        stage->thread_count++;
+        stage->objects += thread->objects;
+        stage->busy_us += thread->busy_us;
+        stage->idle_us += thread->idle_us;
+        // The threads drained of their input are still waiting for more
+        if (thread->waiting && thread->period_start_us < profile->elapsed_us)
+            stage->idle_us += profile->elapsed_us - thread->period_start_us;
+        stage->stall_us += thread->stall_us;
+        stage->max_queue_depth = MAX(stage->max_queue_depth, thread->max_queue_depth);
+        queue_depth_sum[slot] += thread->queue_depth_sum;
+        profile->dropped_events += thread->dropped_events;
+    }
+    for (uint32_t slot = 0; slot < profile->num_stages; slot++) {
+        SvtAv1StageProfile *stage = &profile->stages[slot];
+        if (stage->objects)
+            stage->avg_queue_depth = (double)queue_depth_sum[slot] / stage->objects;
+    }
+}
+
+EbErrorType svt_profiler_build_trace(EbProfiler *profiler) {
+    uint64_t size = 256;
+    for (uint32_t i = 0; i < profiler->thread_count; i++)
+        size += (uint64_t)(profiler->threads[i]->event_count + 2) * PROFILER_EVENT_JSON_SIZE;
+
+    free(profiler->trace);
+    profiler->trace_size = 0;
+    profiler->trace      = (char *)malloc(size);
+    if (profiler->trace == NULL)
+        return EB_ErrorInsufficientResources;
+
+    char *p = profiler->trace;
+    p += sprintf(p,
+                 "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+                 "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"SVT-AV1 "
+                 "encoder\"}}");
+    for (uint32_t i = 0; i < profiler->thread_count; i++) {
+        const EbProfilerThread *thread = profiler->threads[i];
+        const char *            name   = thread->stage < profiler->stage_count
+                       ? profiler->stage_names[thread->stage]
+                       : "unknown";
+        // Thread names and sort indices keep the threads in pipeline order
+        p += sprintf(p,
+                     ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,"
+                     "\"args\":{\"name\":\"%s %u\"}}",
+                     i,
+                     name,
+                     thread->index);
+        p += sprintf(p,
+                     ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,"
+                     "\"args\":{\"sort_index\":%u}}",
+                     i,
+                     i);
+        for (uint32_t j = 0; j < thread->event_count; j++) {
+            const EbProfilerEvent *event = &thread->events[j];
+            if (event->type == PROFILER_EVENT_BUSY)
+                p += sprintf(p,
+                             ",\n{\"name\":\"%s\",\"cat\":\"busy\",\"ph\":\"X\",\"pid\":0,"
+                             "\"tid\":%u,\"ts\":%" PRIu64 ",\"dur\":%u,\"args\":{\"queue\":%u}}",
+                             name,
+                             i,
+                             event->start_us,
+                             event->duration_us,
+                             event->queue_depth);
+            else
+                p += sprintf(p,
+                             ",\n{\"name\":\"stall\",\"cat\":\"stall\",\"ph\":\"X\",\"pid\":0,"
+                             "\"tid\":%u,\"ts\":%" PRIu64 ",\"dur\":%u}",
+                             i,
+                             event->start_us,
+                             event->duration_us);
+        }
+    }
+    p += sprintf(p, "\n]}\n");
+    profiler->trace_size = (uint64_t)(p - profiler->trace);
+    return EB_ErrorNone;
+}
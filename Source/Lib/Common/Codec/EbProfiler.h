@@ -0,0 +1,137 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#ifndef EbProfiler_h
+#define EbProfiler_h
+
+#include "EbDefinitions.h"
+#include "EbObject.h"
+#include "EbThreads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************************************************************
+ * Pipeline profiler
+ *   Accounts the time each processing thread spends waiting for its
+ *   input (idle), waiting for an empty object of its output (stall)
+ *   and processing its objects (busy). The periods are delimited in
+ *   svt_get_full_object() and svt_get_empty_object(), so the kernels
+ *   only have to be created with EB_CREATE_PROFILED_THREAD. Each
+ *   thread updates its own EbProfilerThread only; the counters are
+ *   meant to be read once the threads have drained their input.
+ *********************************************************************/
+typedef enum EbProfilerEventType {
+    PROFILER_EVENT_BUSY,
+    PROFILER_EVENT_STALL,
+} EbProfilerEventType;
+
+// Busy or stall period of a thread, kept for the trace when level is 2
+typedef struct EbProfilerEvent {
+    uint64_t start_us;
+    uint32_t duration_us;
+    uint16_t queue_depth;
+    uint16_t type;
+} EbProfilerEvent;
+
+typedef struct EbProfilerThread {
+    struct EbProfiler *profiler;
+    uint32_t           stage;
+    uint32_t           index; // index of the thread in its stage
+
+    // Current period
+    EbBool   busy;
+    EbBool   waiting;
+    uint64_t period_start_us;
+    uint64_t period_stall_us;
+    uint64_t stall_start_us;
+    uint32_t queue_depth;
+
+    uint64_t objects;
+    uint64_t busy_us;
+    uint64_t idle_us;
+    uint64_t stall_us;
+    uint64_t queue_depth_sum;
+    uint32_t max_queue_depth;
+
+    EbProfilerEvent *events;
+    uint32_t         event_count;
+    uint32_t         event_capacity;
+    uint64_t         dropped_events;
+} EbProfilerThread;
+
+typedef struct EbProfiler {
+    EbDctor dctor;
+    // 1: counters, 2: counters and trace events
+    uint8_t             level;
+    uint64_t            start_us;
+    const char *const * stage_names;
+    uint32_t            stage_count;
+    uint32_t            thread_count;
+    uint32_t            max_thread_count;
+    EbProfilerThread ** threads;
+    // Chrome trace of the last svt_profiler_build_trace() call
+    char *   trace;
+    uint64_t trace_size;
+} EbProfiler;
+
+extern EbErrorType svt_profiler_ctor(EbProfiler *profiler, uint8_t level,
+                                     uint32_t max_thread_count, const char *const *stage_names,
+                                     uint32_t stage_count);
+
+/* Creates a thread of stage running thread_function on the workers of
+ * group_handle, see svt_create_pool_thread(). The thread is profiled when
+ * profiler is not NULL. */
+extern EbHandle svt_profiler_create_thread(EbProfiler *profiler, uint32_t stage,
+                                           EbHandle group_handle, void *thread_function(void *),
+                                           void *thread_context);
+
+/* Profile of the calling thread, NULL when it is not profiled */
+extern EbProfilerThread *svt_profiler_current_thread(void);
+
+/* The calling thread waits for an input object, queue_depth objects being
+ * ready in its input queue */
+extern void svt_profiler_input_wait(EbProfilerThread *thread, uint32_t queue_depth);
+/* The calling thread got an input object, or is shut down when got_object
+ * is EB_FALSE */
+extern void svt_profiler_input_ready(EbProfilerThread *thread, EbBool got_object);
+/* The calling thread waits for an empty output object */
+extern void svt_profiler_output_wait(EbProfilerThread *thread);
+extern void svt_profiler_output_ready(EbProfilerThread *thread);
+
+/* Sums the counters of the threads of each stage */
+extern void svt_profiler_get_profile(const EbProfiler *profiler, SvtAv1PipelineProfile *profile);
+/* Writes the events of all the threads as Chrome trace event JSON to
+ * profiler->trace */
+extern EbErrorType svt_profiler_build_trace(EbProfiler *profiler);
+
+#define EB_CREATE_PROFILED_THREAD(pointer, profiler, stage, group_handle, thread_function, \
+                                  thread_context)                                          \
+    EB_PLACE_THREAD(                                                                       \
+        pointer,                                                                           \
+        svt_profiler_create_thread(profiler, stage, group_handle, thread_function, thread_context))
+
+#define EB_CREATE_PROFILED_THREAD_ARRAY(                                                    \
+    pa, count, profiler, stage, group_handle, thread_function, thread_contexts)             \
+    do {                                                                                    \
+        EB_ALLOC_PTR_ARRAY(pa, count);                                                      \
+        for (uint32_t i = 0; i < count; i++)                                                \
+            EB_CREATE_PROFILED_THREAD(                                                      \
+                pa[i], profiler, stage, group_handle, thread_function, thread_contexts[i]); \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EbProfiler_h
+/* File EOF */
@@ -15,6 +15,7 @@
 #include "EbSystemResourceManager.h"
 #include "EbDefinitions.h"
 #include "EbThreads.h"
+#include "EbProfiler.h"
 
 static void svt_fifo_dctor(EbPtr p) {
     EbFifo *obj = (EbFifo *)p;
@@ -44,6 +45,7 @@ static EbErrorType svt_fifo_ctor(EbFifo *fifoPtr, uint32_t initial_count, uint32
     return EB_ErrorNone;
 }
 
+#if !EN_LOCKFREE_FIFO
 /**************************************
  * svt_fifo_push_back
  **************************************/
@@ -97,6 +99,8 @@ static EbErrorType svt_fifo_shutdown(EbFifo *fifo_ptr) {
     return return_error;
 }
 
+#endif
+
 static void svt_circular_buffer_dctor(EbPtr p) {
     EbCircularBuffer *obj = (EbCircularBuffer *)p;
     EB_FREE(obj->array_ptr);
@@ -116,6 +120,7 @@ static EbErrorType svt_circular_buffer_ctor(EbCircularBuffer *bufferPtr,
     return EB_ErrorNone;
 }
 
+#if !EN_LOCKFREE_FIFO
 /**************************************
  * svt_circular_buffer_empty_check
  **************************************/
@@ -186,8 +191,161 @@ static EbErrorType svt_circular_buffer_push_front(EbCircularBuffer *bufferPtr, E
     return return_error;
 }
 
+#endif
+
+#if EN_LOCKFREE_FIFO
+#define LOCKFREE_FIFO_SPIN_COUNT 64
+
+static void svt_lockfree_ring_dctor(EbPtr p) {
+    EbLockFreeRing *obj = (EbLockFreeRing *)p;
+    EB_FREE_ARRAY(obj->cell_array);
+}
+
+/**************************************
+ * svt_lockfree_ring_ctor
+ **************************************/
+static EbErrorType svt_lockfree_ring_ctor(EbLockFreeRing *ring_ptr, uint32_t object_total_count) {
+    uint32_t cell_count = 1;
+
+    ring_ptr->dctor = svt_lockfree_ring_dctor;
+
+    // The cell count is a power of 2 so the indices can wrap around
+    while (cell_count < object_total_count) cell_count <<= 1;
+    ring_ptr->index_mask = cell_count - 1;
+
+    EB_MALLOC_ARRAY(ring_ptr->cell_array, cell_count);
+    for (uint32_t cell_index = 0; cell_index < cell_count; ++cell_index) {
+        ring_ptr->cell_array[cell_index].sequence   = cell_index;
+        ring_ptr->cell_array[cell_index].object_ptr = NULL;
+    }
+
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * svt_lockfree_ring_push_back
+ *   Returns EB_FALSE when the ring is full
+ **************************************/
+static EbBool svt_lockfree_ring_push_back(EbLockFreeRing *ring_ptr, EbPtr object_ptr) {
+    uint32_t tail_index = svt_atomic_load_u32(&ring_ptr->tail_index);
+
+    for (;;) {
+        EbLockFreeRingCell *cell_ptr = &ring_ptr->cell_array[tail_index & ring_ptr->index_mask];
+        const int32_t       lap = (int32_t)(svt_atomic_load_u32(&cell_ptr->sequence) - tail_index);
+
+        if (lap == 0) {
+            // The cell is free, claim it
+            if (svt_atomic_cas_u32(&ring_ptr->tail_index, tail_index, tail_index + 1)) {
+                cell_ptr->object_ptr = object_ptr;
+                // Publish the object to the consumers
+                svt_atomic_store_u32(&cell_ptr->sequence, tail_index + 1);
+                return EB_TRUE;
+            }
+        } else if (lap < 0)
+            // The cell still holds the object of the previous lap
+            return EB_FALSE;
+        tail_index = svt_atomic_load_u32(&ring_ptr->tail_index);
+    }
+}
+
+/**************************************
+ * svt_lockfree_ring_pop_front
+ *   Returns EB_FALSE when the ring is empty
+ **************************************/
+static EbBool svt_lockfree_ring_pop_front(EbLockFreeRing *ring_ptr, EbPtr *object_ptr) {
+    uint32_t head_index = svt_atomic_load_u32(&ring_ptr->head_index);
+
+    for (;;) {
+        EbLockFreeRingCell *cell_ptr = &ring_ptr->cell_array[head_index & ring_ptr->index_mask];
+        const int32_t       lap =
+            (int32_t)(svt_atomic_load_u32(&cell_ptr->sequence) - (head_index + 1));
+
+        if (lap == 0) {
+            // The cell holds a published object, claim it
+            if (svt_atomic_cas_u32(&ring_ptr->head_index, head_index, head_index + 1)) {
+                *object_ptr = cell_ptr->object_ptr;
+                // Hand the cell over to the producers of the next lap
+                svt_atomic_store_u32(&cell_ptr->sequence, head_index + ring_ptr->index_mask + 1);
+                return EB_TRUE;
+            }
+        } else if (lap < 0)
+            // The object is not published yet
+            return EB_FALSE;
+        head_index = svt_atomic_load_u32(&ring_ptr->head_index);
+    }
+}
+
+/**************************************
+ * svt_muxing_queue_post_object
+ *   Pushes an object to the ring and wakes up a waiting process if any
+ **************************************/
+static void svt_muxing_queue_post_object(EbMuxingQueue *queue_ptr, EbObjectWrapper *wrapper_ptr) {
+    // The ring has a cell for every object of the SystemResource, so it is
+    // never full. Should it ever be, wait for a pop rather than lose the
+    // object.
+    while (!svt_lockfree_ring_push_back(queue_ptr->object_ring, wrapper_ptr)) {
+        assert(0);
+        svt_thread_yield();
+    }
+
+    if ((int32_t)svt_atomic_fetch_add_u32(&queue_ptr->object_count, 1) < 0)
+        svt_post_semaphore(queue_ptr->object_semaphore);
+}
+
+/**************************************
+ * svt_muxing_queue_wait_object
+ *   Accounts an object of the ring to the caller, blocking only when
+ *   the ring is empty
+ **************************************/
+static void svt_muxing_queue_wait_object(EbMuxingQueue *queue_ptr) {
+    if ((int32_t)svt_atomic_fetch_add_u32(&queue_ptr->object_count, (uint32_t)-1) <= 0)
+        svt_block_on_semaphore(queue_ptr->object_semaphore);
+}
+
+/**************************************
+ * svt_muxing_queue_try_wait_object
+ *   Returns EB_FALSE instead of blocking when the ring is empty
+ **************************************/
+static EbBool svt_muxing_queue_try_wait_object(EbMuxingQueue *queue_ptr) {
+    uint32_t object_count = svt_atomic_load_u32(&queue_ptr->object_count);
+
+    while ((int32_t)object_count > 0) {
+        if (svt_atomic_cas_u32(&queue_ptr->object_count, object_count, object_count - 1))
+            return EB_TRUE;
+        object_count = svt_atomic_load_u32(&queue_ptr->object_count);
+    }
+    return EB_FALSE;
+}
+
+/**************************************
+ * svt_muxing_queue_pop_object
+ *   Pops the object accounted by a successful wait
+ **************************************/
+static EbObjectWrapper *svt_muxing_queue_pop_object(EbMuxingQueue *queue_ptr) {
+    EbPtr    object_ptr;
+    uint32_t spin_count = 0;
+
+    // The object is counted once published, but an earlier push may still
+    // be in flight at the head of the ring. Yield when the producer of
+    // that push does not get to run, e.g. with more threads than cores or
+    // another thread waiting for the worker of the caller.
+    while (!svt_lockfree_ring_pop_front(queue_ptr->object_ring, &object_ptr)) {
+        if (++spin_count < LOCKFREE_FIFO_SPIN_COUNT && !svt_worker_pool_contended())
+            svt_cpu_pause();
+        else
+            svt_thread_yield();
+    }
+
+    return (EbObjectWrapper *)object_ptr;
+}
+#endif
+
 void svt_muxing_queue_dctor(EbPtr p) {
     EbMuxingQueue *obj = (EbMuxingQueue *)p;
+#if EN_LOCKFREE_FIFO
+    EB_DELETE(obj->object_ring);
+    EB_DESTROY_SEMAPHORE(obj->object_semaphore);
+#endif
     EB_DELETE_PTR_ARRAY(obj->process_fifo_ptr_array, obj->process_total_count);
     EB_DELETE(obj->object_queue);
     EB_DELETE(obj->process_queue);
@@ -212,6 +370,14 @@ static EbErrorType svt_muxing_queue_ctor(EbMuxingQueue *queue_ptr, uint32_t obje
     EB_NEW(queue_ptr->object_queue, svt_circular_buffer_ctor, object_total_count);
     // Construct Process Circular Buffer
     EB_NEW(queue_ptr->process_queue, svt_circular_buffer_ctor, queue_ptr->process_total_count);
+#if EN_LOCKFREE_FIFO
+    // Construct the Object Ring
+    EB_NEW(queue_ptr->object_ring, svt_lockfree_ring_ctor, object_total_count);
+    assert(queue_ptr->object_ring->index_mask + 1 >= object_total_count);
+    EB_CREATE_SEMAPHORE(queue_ptr->object_semaphore,
+                        0,
+                        object_total_count + queue_ptr->process_total_count);
+#endif
     // Construct the Process Fifos
     EB_ALLOC_PTR_ARRAY(queue_ptr->process_fifo_ptr_array, queue_ptr->process_total_count);
 
@@ -228,6 +394,7 @@ static EbErrorType svt_muxing_queue_ctor(EbMuxingQueue *queue_ptr, uint32_t obje
     return return_error;
 }
 
+#if !EN_LOCKFREE_FIFO
 /**************************************
  * svt_muxing_queue_assignation
  **************************************/
@@ -289,11 +456,27 @@ static EbErrorType svt_muxing_queue_object_push_front(EbMuxingQueue *  queue_ptr
     return return_error;
 }
 
+#endif
+
 static EbFifo *svt_muxing_queue_get_fifo(EbMuxingQueue *queue_ptr, uint32_t index) {
     assert(queue_ptr->process_fifo_ptr_array && (queue_ptr->process_total_count > index));
     return queue_ptr->process_fifo_ptr_array[index];
 }
 
+/**************************************
+ * svt_muxing_queue_depth
+ *   Number of objects of the queue no process has taken yet, read
+ *   without locking for the profiler
+ **************************************/
+static uint32_t svt_muxing_queue_depth(EbMuxingQueue *queue_ptr) {
+#if EN_LOCKFREE_FIFO
+    const int32_t object_count = (int32_t)svt_atomic_load_u32(&queue_ptr->object_count);
+    return object_count > 0 ? (uint32_t)object_count : 0;
+#else
+    return *(volatile uint32_t *)&queue_ptr->object_queue->current_count;
+#endif
+}
+
 /*********************************************************************
  * svt_object_release_enable
  *   Enables the release_enable member of EbObjectWrapper.  Used by
@@ -405,11 +588,82 @@ static EbErrorType svt_object_wrapper_ctor(EbObjectWrapper *wrapper, EbSystemRes
     return EB_ErrorNone;
 }
 
+static EbErrorType svt_object_wrapper_new(EbObjectWrapper **wrapper_dbl_ptr,
+                                          EbSystemResource *resource_ptr) {
+    EB_NEW(*wrapper_dbl_ptr,
+           svt_object_wrapper_ctor,
+           resource_ptr,
+           resource_ptr->object_creator,
+           resource_ptr->object_init_data_ptr,
+           resource_ptr->object_destroyer);
+    return EB_ErrorNone;
+}
+
 static void svt_system_resource_dctor(EbPtr p) {
     EbSystemResource *obj = (EbSystemResource *)p;
     EB_DELETE(obj->full_queue);
     EB_DELETE(obj->empty_queue);
     EB_DELETE_PTR_ARRAY(obj->wrapper_ptr_pool, obj->object_total_count);
+    if (obj->object_init_data_size)
+        EB_FREE(obj->object_init_data_ptr);
+}
+
+static EbErrorType svt_system_resource_init(EbSystemResource *resource_ptr,
+                                            uint32_t object_init_count, uint32_t object_max_count,
+                                            uint32_t  producer_process_total_count,
+                                            uint32_t  consumer_process_total_count,
+                                            EbCreator object_creator, EbPtr object_init_data_ptr,
+                                            EbDctor object_destroyer) {
+    uint32_t    wrapper_index;
+    EbErrorType return_error = EB_ErrorNone;
+    resource_ptr->dctor      = svt_system_resource_dctor;
+
+    resource_ptr->object_total_count   = object_init_count;
+    resource_ptr->object_max_count     = object_max_count;
+    resource_ptr->object_creator       = object_creator;
+    resource_ptr->object_init_data_ptr = object_init_data_ptr;
+    resource_ptr->object_destroyer     = object_destroyer;
+
+    // Allocate array for wrapper pointers
+    EB_ALLOC_PTR_ARRAY(resource_ptr->wrapper_ptr_pool, resource_ptr->object_max_count);
+
+    // Initialize each wrapper
+    for (wrapper_index = 0; wrapper_index < resource_ptr->object_total_count; ++wrapper_index) {
+        return_error =
+            svt_object_wrapper_new(&resource_ptr->wrapper_ptr_pool[wrapper_index], resource_ptr);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
+
+    // Initialize the Empty Queue
+    EB_NEW(resource_ptr->empty_queue,
+           svt_muxing_queue_ctor,
+           resource_ptr->object_max_count,
+           producer_process_total_count);
+    resource_ptr->empty_queue->system_resource_ptr = resource_ptr;
+    // Fill the Empty Fifo with every ObjectWrapper
+    for (wrapper_index = 0; wrapper_index < resource_ptr->object_total_count; ++wrapper_index) {
+#if EN_LOCKFREE_FIFO
+        svt_muxing_queue_post_object(resource_ptr->empty_queue,
+                                     resource_ptr->wrapper_ptr_pool[wrapper_index]);
+#else
+        svt_muxing_queue_object_push_back(resource_ptr->empty_queue,
+                                          resource_ptr->wrapper_ptr_pool[wrapper_index]);
+#endif
+    }
+
+    // Initialize the Full Queue
+    if (consumer_process_total_count) {
+        EB_NEW(resource_ptr->full_queue,
+               svt_muxing_queue_ctor,
+               resource_ptr->object_max_count,
+               consumer_process_total_count);
+        resource_ptr->full_queue->system_resource_ptr = resource_ptr;
+    } else {
+        resource_ptr->full_queue = (EbMuxingQueue *)NULL;
+    }
+
+    return return_error;
 }
 
 /*********************************************************************
@@ -442,47 +696,93 @@ EbErrorType svt_system_resource_ctor(EbSystemResource *resource_ptr, uint32_t ob
                                      uint32_t  consumer_process_total_count,
                                      EbCreator object_creator, EbPtr object_init_data_ptr,
                                      EbDctor object_destroyer) {
-    uint32_t    wrapper_index;
-    EbErrorType return_error = EB_ErrorNone;
-    resource_ptr->dctor      = svt_system_resource_dctor;
-
-    resource_ptr->object_total_count = object_total_count;
-
-    // Allocate array for wrapper pointers
-    EB_ALLOC_PTR_ARRAY(resource_ptr->wrapper_ptr_pool, resource_ptr->object_total_count);
+    return svt_system_resource_init(resource_ptr,
+                                    object_total_count,
+                                    object_total_count,
+                                    producer_process_total_count,
+                                    consumer_process_total_count,
+                                    object_creator,
+                                    object_init_data_ptr,
+                                    object_destroyer);
+}
 
-    // Initialize each wrapper
-    for (wrapper_index = 0; wrapper_index < resource_ptr->object_total_count; ++wrapper_index) {
-        EB_NEW(resource_ptr->wrapper_ptr_pool[wrapper_index],
-               svt_object_wrapper_ctor,
-               resource_ptr,
-               object_creator,
-               object_init_data_ptr,
-               object_destroyer);
+/*********************************************************************
+ * svt_system_resource_lazy_ctor
+ *   Constructor for a lazy EbSystemResource. One object is constructed
+ *   per producer and consumer process, the others are constructed on
+ *   demand by svt_get_empty_object.
+ *
+ *   object_init_data_size
+ *     size of the data block pointed by object_init_data_ptr. The data
+ *     block is copied and kept until the SystemResource is destructed.
+ *********************************************************************/
+EbErrorType svt_system_resource_lazy_ctor(EbSystemResource *resource_ptr, uint32_t object_max_count,
+                                          uint32_t  producer_process_total_count,
+                                          uint32_t  consumer_process_total_count,
+                                          EbCreator object_creator, EbPtr object_init_data_ptr,
+                                          size_t object_init_data_size, EbDctor object_destroyer) {
+    uint32_t object_init_count = producer_process_total_count + consumer_process_total_count;
+    if (object_init_count > object_max_count)
+        object_init_count = object_max_count;
+
+    resource_ptr->dctor = svt_system_resource_dctor;
+
+    if (object_init_data_size) {
+        EB_MALLOC(resource_ptr->object_init_data_ptr, object_init_data_size);
+        resource_ptr->object_init_data_size = object_init_data_size;
+        EB_MEMCPY(resource_ptr->object_init_data_ptr, object_init_data_ptr, object_init_data_size);
+        object_init_data_ptr = resource_ptr->object_init_data_ptr;
     }
 
-    // Initialize the Empty Queue
-    EB_NEW(resource_ptr->empty_queue,
-           svt_muxing_queue_ctor,
-           resource_ptr->object_total_count,
-           producer_process_total_count);
-    // Fill the Empty Fifo with every ObjectWrapper
-    for (wrapper_index = 0; wrapper_index < resource_ptr->object_total_count; ++wrapper_index) {
-        svt_muxing_queue_object_push_back(resource_ptr->empty_queue,
-                                          resource_ptr->wrapper_ptr_pool[wrapper_index]);
-    }
+    return svt_system_resource_init(resource_ptr,
+                                    object_init_count,
+                                    object_max_count,
+                                    producer_process_total_count,
+                                    consumer_process_total_count,
+                                    object_creator,
+                                    object_init_data_ptr,
+                                    object_destroyer);
+}
 
-    // Initialize the Full Queue
-    if (consumer_process_total_count) {
-        EB_NEW(resource_ptr->full_queue,
-               svt_muxing_queue_ctor,
-               resource_ptr->object_total_count,
-               consumer_process_total_count);
-    } else {
-        resource_ptr->full_queue = (EbMuxingQueue *)NULL;
+/*********************************************************************
+ * svt_system_resource_empty
+ *   Returns EB_TRUE when the empty queue has no object left
+ *********************************************************************/
+static EbBool svt_system_resource_empty(EbSystemResource *resource_ptr) {
+#if EN_LOCKFREE_FIFO
+    return (int32_t)svt_atomic_load_u32(&resource_ptr->empty_queue->object_count) <= 0;
+#else
+    return svt_circular_buffer_empty_check(resource_ptr->empty_queue->object_queue);
+#endif
+}
+
+/*********************************************************************
+ * svt_system_resource_grow
+ *   Constructs one new object for a lazy SystemResource when its empty
+ *   queue has no object left. If the construction fails, the request
+ *   waits for an object to be released.
+ *********************************************************************/
+static void svt_system_resource_grow(EbSystemResource *resource_ptr) {
+    EbMuxingQueue *queue_ptr = resource_ptr->empty_queue;
+
+    svt_block_on_mutex(queue_ptr->lockout_mutex);
+
+    if (resource_ptr->object_total_count < resource_ptr->object_max_count &&
+        svt_system_resource_empty(resource_ptr)) {
+        EbObjectWrapper **wrapper_dbl_ptr =
+            &resource_ptr->wrapper_ptr_pool[resource_ptr->object_total_count];
+
+        if (svt_object_wrapper_new(wrapper_dbl_ptr, resource_ptr) == EB_ErrorNone) {
+            svt_atomic_fetch_add_u32(&resource_ptr->object_total_count, 1);
+#if EN_LOCKFREE_FIFO
+            svt_muxing_queue_post_object(queue_ptr, *wrapper_dbl_ptr);
+#else
+            svt_circular_buffer_push_back(queue_ptr->object_queue, *wrapper_dbl_ptr);
+#endif
+        }
     }
 
-    return return_error;
+    svt_release_mutex(queue_ptr->lockout_mutex);
 }
 
 EbFifo *svt_system_resource_get_producer_fifo(const EbSystemResource *resource_ptr,
@@ -500,14 +800,26 @@ EbErrorType svt_shutdown_process(const EbSystemResource *resource_ptr) {
     if (!resource_ptr || !resource_ptr->full_queue)
         return EB_ErrorNone;
 
+#if EN_LOCKFREE_FIFO
+    // The consumers share the object ring: raise every quit signal before
+    // waking them up, so whichever consumer is woken up quits
+    for (unsigned int i = 0; i < resource_ptr->full_queue->process_total_count; i++)
+        svt_system_resource_get_consumer_fifo(resource_ptr, i)->quit_signal = EB_TRUE;
+    for (unsigned int i = 0; i < resource_ptr->full_queue->process_total_count; i++) {
+        if ((int32_t)svt_atomic_fetch_add_u32(&resource_ptr->full_queue->object_count, 1) < 0)
+            svt_post_semaphore(resource_ptr->full_queue->object_semaphore);
+    }
+#else
     //notify all consumers we are shutting down
     for (unsigned int i = 0; i < resource_ptr->full_queue->process_total_count; i++) {
         EbFifo *fifo_ptr = svt_system_resource_get_consumer_fifo(resource_ptr, i);
         svt_fifo_shutdown(fifo_ptr);
     }
+#endif
     return EB_ErrorNone;
 }
 
+#if !EN_LOCKFREE_FIFO
 /*********************************************************************
  * EbSystemResourceReleaseProcess
  *********************************************************************/
@@ -525,6 +837,8 @@ static EbErrorType svt_release_process(EbFifo *process_fifo_ptr) {
     return return_error;
 }
 
+#endif
+
 /*********************************************************************
  * EbSystemResourcePostObject
  *   Queues a full EbObjectWrapper to the SystemResource. This
@@ -542,11 +856,15 @@ static EbErrorType svt_release_process(EbFifo *process_fifo_ptr) {
 EbErrorType svt_post_full_object(EbObjectWrapper *object_ptr) {
     EbErrorType return_error = EB_ErrorNone;
 
+#if EN_LOCKFREE_FIFO
+    svt_muxing_queue_post_object(object_ptr->system_resource_ptr->full_queue, object_ptr);
+#else
     svt_block_on_mutex(object_ptr->system_resource_ptr->full_queue->lockout_mutex);
 
     svt_muxing_queue_object_push_back(object_ptr->system_resource_ptr->full_queue, object_ptr);
 
     svt_release_mutex(object_ptr->system_resource_ptr->full_queue->lockout_mutex);
+#endif
 
     return return_error;
 }
@@ -563,6 +881,9 @@ EbErrorType svt_post_full_object(EbObjectWrapper *object_ptr) {
  *********************************************************************/
 EbErrorType svt_release_object(EbObjectWrapper *object_ptr) {
     EbErrorType return_error = EB_ErrorNone;
+#if EN_LOCKFREE_FIFO
+    EbBool release = EB_FALSE;
+#endif
 
     svt_block_on_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
@@ -574,12 +895,21 @@ EbErrorType svt_release_object(EbObjectWrapper *object_ptr) {
         // Set live_count to EB_ObjectWrapperReleasedValue
         object_ptr->live_count = EB_ObjectWrapperReleasedValue;
 
+#if EN_LOCKFREE_FIFO
+        release = EB_TRUE;
+#else
         svt_muxing_queue_object_push_front(object_ptr->system_resource_ptr->empty_queue,
                                            object_ptr);
+#endif
     }
 
     svt_release_mutex(object_ptr->system_resource_ptr->empty_queue->lockout_mutex);
 
+#if EN_LOCKFREE_FIFO
+    // The mutex only protects live_count, the hand-off itself is lock-free
+    if (release)
+        svt_muxing_queue_post_object(object_ptr->system_resource_ptr->empty_queue, object_ptr);
+#endif
     return return_error;
 }
 
@@ -599,8 +929,31 @@ EbErrorType svt_release_object(EbObjectWrapper *object_ptr) {
  *      EbObjectWrapper pointer.
  *********************************************************************/
 EbErrorType svt_get_empty_object(EbFifo *empty_fifo_ptr, EbObjectWrapper **wrapper_dbl_ptr) {
-    EbErrorType return_error = EB_ErrorNone;
+    EbErrorType       return_error = EB_ErrorNone;
+    EbSystemResource *resource_ptr = empty_fifo_ptr->queue_ptr->system_resource_ptr;
+    EbProfilerThread *profile      = svt_profiler_current_thread();
+
+    if (profile)
+        svt_profiler_output_wait(profile);
+
+    // Construct a new object if a lazy SystemResource has none left.
+    // object_max_count never changes and object_total_count only grows.
+    if (svt_atomic_load_u32(&resource_ptr->object_total_count) < resource_ptr->object_max_count &&
+        svt_system_resource_empty(resource_ptr)) {
+        // A consumer is often about to release an object, let it run first
+        // so the resource only grows when the objects are still all in use
+        svt_thread_yield();
+        svt_system_resource_grow(resource_ptr);
+    }
+
+#if EN_LOCKFREE_FIFO
+    svt_muxing_queue_wait_object(empty_fifo_ptr->queue_ptr);
+    *wrapper_dbl_ptr = svt_muxing_queue_pop_object(empty_fifo_ptr->queue_ptr);
 
+    // The object is owned by the caller from now on
+    (*wrapper_dbl_ptr)->live_count     = 0;
+    (*wrapper_dbl_ptr)->release_enable = EB_TRUE;
+#else
     // Queue the Fifo requesting the empty fifo
     svt_release_process(empty_fifo_ptr);
 
@@ -621,6 +974,10 @@ EbErrorType svt_get_empty_object(EbFifo *empty_fifo_ptr, EbObjectWrapper **wrapp
 
     // Release Mutex
     svt_release_mutex(empty_fifo_ptr->lockout_mutex);
+#endif
+
+    if (profile)
+        svt_profiler_output_ready(profile);
 
     return return_error;
 }
@@ -641,8 +998,24 @@ EbErrorType svt_get_empty_object(EbFifo *empty_fifo_ptr, EbObjectWrapper **wrapp
  *      EbObjectWrapper pointer.
  *********************************************************************/
 EbErrorType svt_get_full_object(EbFifo *full_fifo_ptr, EbObjectWrapper **wrapper_dbl_ptr) {
-    EbErrorType return_error = EB_ErrorNone;
+    EbErrorType       return_error = EB_ErrorNone;
+    EbProfilerThread *profile      = svt_profiler_current_thread();
+
+    // The processing of the previous object of the calling kernel is over
+    if (profile)
+        svt_profiler_input_wait(profile, svt_muxing_queue_depth(full_fifo_ptr->queue_ptr));
+
+#if EN_LOCKFREE_FIFO
+    svt_muxing_queue_wait_object(full_fifo_ptr->queue_ptr);
 
+    // The quit signals are raised before the shutdown wakes the consumers up
+    if (!*(volatile EbBool *)&full_fifo_ptr->quit_signal) {
+        *wrapper_dbl_ptr = svt_muxing_queue_pop_object(full_fifo_ptr->queue_ptr);
+    } else {
+        *wrapper_dbl_ptr = NULL;
+        return_error     = EB_NoErrorFifoShutdown;
+    }
+#else
     // Queue the Fifo requesting the full fifo
     svt_release_process(full_fifo_ptr);
 
@@ -661,10 +1034,15 @@ EbErrorType svt_get_full_object(EbFifo *full_fifo_ptr, EbObjectWrapper **wrapper
 
     // Release Mutex
     svt_release_mutex(full_fifo_ptr->lockout_mutex);
+#endif
+
+    if (profile)
+        svt_profiler_input_ready(profile, return_error == EB_ErrorNone);
 
     return return_error;
 }
 
+#if !EN_LOCKFREE_FIFO
 /**************************************
 * svt_fifo_pop_front
 **************************************/
@@ -676,10 +1054,24 @@ static EbBool svt_fifo_peak_front(EbFifo *fifoPtr) {
         return EB_FALSE;
 }
 
+#endif
+
 EbErrorType svt_get_full_object_non_blocking(EbFifo *          full_fifo_ptr,
                                              EbObjectWrapper **wrapper_dbl_ptr) {
     EbErrorType return_error = EB_ErrorNone;
     EbBool      fifo_empty;
+#if EN_LOCKFREE_FIFO
+    //if the fifo is shutting down, we will not give any buffer to caller
+    if (!*(volatile EbBool *)&full_fifo_ptr->quit_signal)
+        fifo_empty = !svt_muxing_queue_try_wait_object(full_fifo_ptr->queue_ptr);
+    else
+        fifo_empty = EB_TRUE;
+
+    if (fifo_empty == EB_FALSE)
+        *wrapper_dbl_ptr = svt_muxing_queue_pop_object(full_fifo_ptr->queue_ptr);
+    else
+        *wrapper_dbl_ptr = (EbObjectWrapper *)NULL;
+#else
     // Queue the Fifo requesting the full fifo
     svt_release_process(full_fifo_ptr);
 
@@ -699,6 +1091,7 @@ EbErrorType svt_get_full_object_non_blocking(EbFifo *          full_fifo_ptr,
         svt_get_full_object(full_fifo_ptr, wrapper_dbl_ptr);
     else
         *wrapper_dbl_ptr = (EbObjectWrapper *)NULL;
+#endif
 
     return return_error;
 }
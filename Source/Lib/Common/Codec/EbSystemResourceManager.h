@@ -99,6 +99,30 @@ typedef struct EbCircularBuffer {
     uint32_t current_count;
 } EbCircularBuffer;
 
+#if EN_LOCKFREE_FIFO
+/*********************************************************************
+     * LockFreeRing
+     *   Bounded multi-producer multi-consumer ring. The sequence of each
+     *   cell tells whether the cell can be written or read in the current
+     *   lap of the ring, so producers only contend on tail_index and
+     *   consumers only contend on head_index.
+     *********************************************************************/
+typedef struct EbLockFreeRingCell {
+    volatile uint32_t sequence;
+    EbPtr             object_ptr;
+} EbLockFreeRingCell;
+
+typedef struct EbLockFreeRing {
+    EbDctor             dctor;
+    EbLockFreeRingCell *cell_array;
+    uint32_t            index_mask;
+    uint8_t             tail_padding[64];
+    volatile uint32_t   tail_index;
+    uint8_t             head_padding[64];
+    volatile uint32_t   head_index;
+} EbLockFreeRing;
+#endif
+
 /*********************************************************************
      * MuxingQueue
      *********************************************************************/
@@ -109,6 +133,19 @@ typedef struct EbMuxingQueue {
     EbCircularBuffer *process_queue;
     uint32_t          process_total_count;
     EbFifo **         process_fifo_ptr_array;
+#if EN_LOCKFREE_FIFO
+    // object_ring - the objects of the queue, shared by all the process
+    //   fifos instead of being assigned to them under lockout_mutex.
+    EbLockFreeRing *object_ring;
+    // object_count - the number of objects in object_ring minus the number
+    //   of processes waiting for one. A process only blocks on
+    //   object_semaphore when no object is left.
+    volatile uint32_t object_count;
+    EbHandle          object_semaphore;
+#endif
+    // system_resource_ptr - pointer to the SystemResource that the
+    //   MuxingQueue belongs to.
+    struct EbSystemResource *system_resource_ptr;
 } EbMuxingQueue;
 
 /*********************************************************************
@@ -119,6 +156,8 @@ typedef struct EbMuxingQueue {
      *   only used to construct and destruct the SystemResource.  The
      *   fullFifo provides downstream pipeline data flow control.  The
      *   emptyFifo provides upstream pipeline backpressure flow control.
+     *   A lazy SystemResource starts with a few objects and constructs new
+     *   ones, up to object_max_count, when no empty object is left.
      *********************************************************************/
 typedef struct EbSystemResource {
     EbDctor dctor;
@@ -126,10 +165,22 @@ typedef struct EbSystemResource {
     //   System Resoruce.
     uint32_t object_total_count;
 
+    // object_max_count - The number of objects the System Resource can
+    //   grow to. Equal to object_total_count for a non lazy System Resource.
+    uint32_t object_max_count;
+
     // wrapper_ptr_pool - An array of pointers to the EbObjectWrappers used
     //   to construct and destruct the SystemResource.
     EbObjectWrapper **wrapper_ptr_pool;
 
+    // Object construction parameters, kept to grow a lazy System Resource.
+    //   object_init_data_ptr is a copy owned by the System Resource when
+    //   object_init_data_size is not 0.
+    EbCreator object_creator;
+    EbPtr     object_init_data_ptr;
+    size_t    object_init_data_size;
+    EbDctor   object_destroyer;
+
     // The empty FIFO contains a queue of empty buffers
     EbMuxingQueue *empty_queue;
 
@@ -218,6 +269,29 @@ extern EbErrorType svt_system_resource_ctor(EbSystemResource *resource_ptr,
                                             EbCreator object_ctor, EbPtr object_init_data_ptr,
                                             EbDctor object_destroyer);
 
+/*********************************************************************
+     * svt_system_resource_lazy_ctor
+     *   Constructor for a lazy EbSystemResource. The SystemResource starts
+     *   with one object per producer and consumer process and constructs
+     *   a new object when a producer asks for an empty object while none
+     *   is left, until object_max_count objects exist.
+     *
+     *   object_max_count
+     *     Maximum number of objects to be managed by the SystemResource.
+     *
+     *   object_init_data_size
+     *     Size of the data block pointed by object_init_data_ptr. The data
+     *     block is copied so that objects can be constructed after the
+     *     caller returns.
+     *
+     *   See svt_system_resource_ctor for the other parameters.
+     *********************************************************************/
+extern EbErrorType svt_system_resource_lazy_ctor(
+    EbSystemResource *resource_ptr, uint32_t object_max_count,
+    uint32_t producer_process_total_count, uint32_t consumer_process_total_count,
+    EbCreator object_ctor, EbPtr object_init_data_ptr, size_t object_init_data_size,
+    EbDctor object_destroyer);
+
 /*********************************************************************
      * svt_system_resource_get_producer_fifo
      *   get producer fifo
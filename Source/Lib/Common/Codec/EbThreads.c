@@ -43,6 +43,9 @@
 #ifdef __APPLE__
 #include <dispatch/dispatch.h>
 #endif
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#endif
 #if PRINTF_TIME
 #include <time.h>
 #ifdef _WIN32
@@ -56,6 +59,34 @@ void printfTime(const char *fmt, ...) {
 #endif
 #endif
 
+typedef struct WorkerGroup {
+    struct WorkerPool * pool;
+    struct WorkerGroup *next;
+    // Posted when a worker is handed to one of the waiting threads
+    EbHandle          wake_semaphore;
+    uint32_t          waiting; // threads of the group waiting for a worker, under the pool mutex
+    volatile uint32_t holding; // workers held by the threads of the group
+    volatile uint32_t grants;
+} WorkerGroup;
+
+typedef struct WorkerPool {
+    EbHandle mutex;
+    // Free workers minus the threads waiting for one. Taking or giving
+    // back a worker only takes the mutex when a thread waits for one.
+    volatile uint32_t available;
+    // Workers given back for the waiting threads not registered in their
+    // group yet, under the mutex
+    uint32_t     handoffs;
+    WorkerGroup *groups;
+} WorkerPool;
+
+// Worker group the calling thread belongs to, and whether it currently holds one of its workers
+static EB_THREAD_LOCAL WorkerGroup *thread_worker_group;
+static EB_THREAD_LOCAL EbBool       thread_holds_worker;
+
+static EbBool worker_pool_leave(void);
+static void   worker_pool_enter(void);
+
 /****************************************
  * svt_create_thread
  ****************************************/
@@ -233,10 +264,7 @@ EbErrorType svt_post_semaphore(EbHandle semaphore_handle) {
     return return_error;
 }
 
-/***************************************
- * svt_block_on_semaphore
- ***************************************/
-EbErrorType svt_block_on_semaphore(EbHandle semaphore_handle) {
+static EbErrorType wait_on_semaphore(EbHandle semaphore_handle) {
     EbErrorType return_error;
 
 #ifdef _WIN32
@@ -257,6 +285,37 @@ EbErrorType svt_block_on_semaphore(EbHandle semaphore_handle) {
     return return_error;
 }
 
+static EbBool try_wait_on_semaphore(EbHandle semaphore_handle) {
+#ifdef _WIN32
+    return WaitForSingleObject((HANDLE)semaphore_handle, 0) == WAIT_OBJECT_0 ? EB_TRUE : EB_FALSE;
+#elif defined(__APPLE__)
+    return dispatch_semaphore_wait((dispatch_semaphore_t)semaphore_handle, DISPATCH_TIME_NOW)
+        ? EB_FALSE
+        : EB_TRUE;
+#else
+    int ret;
+    do { ret = sem_trywait((sem_t *)semaphore_handle); } while (ret == -1 && errno == EINTR);
+    return ret ? EB_FALSE : EB_TRUE;
+#endif
+}
+
+/***************************************
+ * svt_block_on_semaphore
+ ***************************************/
+EbErrorType svt_block_on_semaphore(EbHandle semaphore_handle) {
+    if (!thread_holds_worker)
+        return wait_on_semaphore(semaphore_handle);
+    if (try_wait_on_semaphore(semaphore_handle))
+        return EB_ErrorNone;
+
+    // Give the worker to another thread of the pool while sleeping
+    worker_pool_leave();
+    const EbErrorType return_error = wait_on_semaphore(semaphore_handle);
+    worker_pool_enter();
+
+    return return_error;
+}
+
 /***************************************
  * svt_destroy_semaphore
  ***************************************/
@@ -317,20 +376,35 @@ EbErrorType svt_release_mutex(EbHandle mutex_handle) {
     return return_error;
 }
 
+static EbErrorType lock_mutex(EbHandle mutex_handle) {
+#ifdef _WIN32
+    return WaitForSingleObject((HANDLE)mutex_handle, INFINITE) ? EB_ErrorMutexUnresponsive
+                                                               : EB_ErrorNone;
+#else
+    return pthread_mutex_lock((pthread_mutex_t *)mutex_handle) ? EB_ErrorMutexUnresponsive
+                                                               : EB_ErrorNone;
+#endif
+}
+
 /***************************************
  * svt_block_on_mutex
  ***************************************/
 EbErrorType svt_block_on_mutex(EbHandle mutex_handle) {
     EbErrorType return_error;
 
+    if (thread_holds_worker) {
 #ifdef _WIN32
-    return_error = WaitForSingleObject((HANDLE)mutex_handle, INFINITE) ? EB_ErrorMutexUnresponsive
-                                                                       : EB_ErrorNone;
+        if (WaitForSingleObject((HANDLE)mutex_handle, 0) == WAIT_OBJECT_0)
+            return EB_ErrorNone;
 #else
-    return_error = pthread_mutex_lock((pthread_mutex_t *)mutex_handle) ? EB_ErrorMutexUnresponsive
-                                                                       : EB_ErrorNone;
+        if (!pthread_mutex_trylock((pthread_mutex_t *)mutex_handle))
+            return EB_ErrorNone;
 #endif
-
+    }
+    const EbBool held_worker = worker_pool_leave();
+    return_error             = lock_mutex(mutex_handle);
+    if (held_worker)
+        worker_pool_enter();
     return return_error;
 }
 
@@ -360,6 +434,193 @@ void atomic_set_u32(AtomicVarU32 *var, uint32_t in) {
     svt_release_mutex(var->mutex);
 }
 
+/***************************************
+ * svt_create_worker_pool
+ ***************************************/
+EbHandle svt_create_worker_pool(uint32_t worker_count) {
+    WorkerPool *pool = (WorkerPool *)calloc(1, sizeof(*pool));
+    if (pool == NULL)
+        return NULL;
+    pool->mutex = svt_create_mutex();
+    if (pool->mutex == NULL) {
+        free(pool);
+        return NULL;
+    }
+    pool->available = worker_count;
+    return (EbHandle)pool;
+}
+
+/***************************************
+ * svt_destroy_worker_pool
+ ***************************************/
+EbErrorType svt_destroy_worker_pool(EbHandle pool_handle) {
+    WorkerPool *pool = (WorkerPool *)pool_handle;
+    EbErrorType return_error = EB_ErrorNone;
+    while (pool->groups) {
+        WorkerGroup *group = pool->groups;
+        pool->groups       = group->next;
+        return_error |= svt_destroy_semaphore(group->wake_semaphore);
+        free(group);
+    }
+    return_error |= svt_destroy_mutex(pool->mutex);
+    free(pool);
+    return return_error;
+}
+
+/***************************************
+ * svt_create_worker_group
+ ***************************************/
+EbHandle svt_create_worker_group(EbHandle pool_handle) {
+    WorkerPool * pool  = (WorkerPool *)pool_handle;
+    WorkerGroup *group = (WorkerGroup *)calloc(1, sizeof(*group));
+    if (group == NULL)
+        return NULL;
+    group->pool           = pool;
+    group->wake_semaphore = svt_create_semaphore(0, INT32_MAX);
+    if (group->wake_semaphore == NULL) {
+        free(group);
+        return NULL;
+    }
+    lock_mutex(pool->mutex);
+    group->next  = pool->groups;
+    pool->groups = group;
+    svt_release_mutex(pool->mutex);
+    return (EbHandle)group;
+}
+
+/***************************************
+ * svt_destroy_worker_group
+ ***************************************/
+EbErrorType svt_destroy_worker_group(EbHandle group_handle) {
+    WorkerGroup *group = (WorkerGroup *)group_handle;
+    WorkerPool * pool  = group->pool;
+    lock_mutex(pool->mutex);
+    WorkerGroup **link = &pool->groups;
+    while (*link != group) link = &(*link)->next;
+    *link = group->next;
+    svt_release_mutex(pool->mutex);
+    EbErrorType return_error = svt_destroy_semaphore(group->wake_semaphore);
+    free(group);
+    return return_error;
+}
+
+/*
+    give the worker held by the calling thread back to its pool,
+    returns whether the thread was holding one
+
+    The worker goes to a waiting thread of the group holding the
+    fewest workers, the group served the least breaking the ties,
+    so a stream with many runnable threads cannot starve the other
+    streams sharing the pool.
+*/
+static EbBool worker_pool_leave(void) {
+    if (!thread_holds_worker)
+        return EB_FALSE;
+    thread_holds_worker = EB_FALSE;
+
+    WorkerPool *pool = thread_worker_group->pool;
+    svt_atomic_fetch_add_u32(&thread_worker_group->holding, (uint32_t)-1);
+    // No thread waits for a worker
+    if ((int32_t)svt_atomic_fetch_add_u32(&pool->available, 1) >= 0)
+        return EB_TRUE;
+
+    lock_mutex(pool->mutex);
+    WorkerGroup *next = NULL;
+    for (WorkerGroup *group = pool->groups; group; group = group->next) {
+        if (group->waiting &&
+            (next == NULL || group->holding < next->holding ||
+             (group->holding == next->holding && group->grants < next->grants)))
+            next = group;
+    }
+    if (next) {
+        next->waiting--;
+        svt_atomic_fetch_add_u32(&next->holding, 1);
+        svt_atomic_fetch_add_u32(&next->grants, 1);
+        svt_post_semaphore(next->wake_semaphore);
+    } else
+        // The waiting thread is about to register, it takes the worker then
+        pool->handoffs++;
+    svt_release_mutex(pool->mutex);
+    return EB_TRUE;
+}
+/*
+    wait until a worker of the pool of the calling thread is free and take it
+*/
+static void worker_pool_enter(void) {
+    WorkerGroup *group = thread_worker_group;
+    WorkerPool * pool  = group->pool;
+    if ((int32_t)svt_atomic_fetch_add_u32(&pool->available, (uint32_t)-1) > 0) {
+        svt_atomic_fetch_add_u32(&group->holding, 1);
+        svt_atomic_fetch_add_u32(&group->grants, 1);
+    } else {
+        lock_mutex(pool->mutex);
+        if (pool->handoffs) {
+            pool->handoffs--;
+            svt_release_mutex(pool->mutex);
+            svt_atomic_fetch_add_u32(&group->holding, 1);
+            svt_atomic_fetch_add_u32(&group->grants, 1);
+        } else {
+            // The worker is handed over by worker_pool_leave()
+            group->waiting++;
+            svt_release_mutex(pool->mutex);
+            wait_on_semaphore(group->wake_semaphore);
+        }
+    }
+    thread_holds_worker = EB_TRUE;
+}
+
+/*
+    whether the calling thread holds a worker another thread waits for,
+    a spin-wait then blocks at once to give the worker back
+*/
+EbBool svt_worker_pool_contended(void) {
+    return thread_holds_worker &&
+        (int32_t)svt_atomic_load_u32(&thread_worker_group->pool->available) < 0;
+}
+
+typedef struct PoolThreadStart {
+    WorkerGroup *group;
+    void *(*thread_function)(void *);
+    void *thread_context;
+} PoolThreadStart;
+
+static void *pool_thread_kernel(void *input_ptr) {
+    PoolThreadStart start = *(PoolThreadStart *)input_ptr;
+    free(input_ptr);
+
+    thread_worker_group = start.group;
+    worker_pool_enter();
+    void *ret = start.thread_function(start.thread_context);
+    worker_pool_leave();
+    thread_worker_group = NULL;
+    return ret;
+}
+
+/***************************************
+ * svt_create_pool_thread
+ *
+ * Create a thread of the worker group running
+ * thread_function on the workers of its pool, or a
+ * plain thread when no group is given
+ ***************************************/
+EbHandle svt_create_pool_thread(EbHandle group_handle, void *thread_function(void *),
+                                void *thread_context) {
+    if (group_handle == NULL)
+        return svt_create_thread(thread_function, thread_context);
+
+    PoolThreadStart *start = (PoolThreadStart *)malloc(sizeof(*start));
+    if (start == NULL)
+        return NULL;
+    start->group           = (WorkerGroup *)group_handle;
+    start->thread_function = thread_function;
+    start->thread_context  = thread_context;
+
+    EbHandle thread_handle = svt_create_thread(pool_thread_kernel, start);
+    if (thread_handle == NULL)
+        free(start);
+    return thread_handle;
+}
+
 #if FIX_DDL
 /*
     create condition variable
@@ -372,7 +633,8 @@ void atomic_set_u32(AtomicVarU32 *var, uint32_t in) {
 */
 void svt_create_cond_var(CondVar *cond_var)
 {
-    cond_var->val = 0;
+    cond_var->val         = 0;
+    cond_var->num_waiters = 0;
 #ifdef _WIN32
     InitializeCriticalSection(&cond_var->cs);
     InitializeConditionVariable(&cond_var->cv);
@@ -405,6 +667,7 @@ void svt_set_cond_var(CondVar *cond_var, int32_t newval)
 
 void svt_wait_cond_var(CondVar *cond_var, int32_t input)
 {
+    const EbBool held_worker = worker_pool_leave();
 
 #ifdef _WIN32
 
@@ -419,5 +682,102 @@ void svt_wait_cond_var(CondVar *cond_var, int32_t input)
         pthread_cond_wait(&cond_var->m_cond, &cond_var->m_mutex);
     pthread_mutex_unlock(&cond_var->m_mutex);
 #endif
+    if (held_worker)
+        worker_pool_enter();
+}
+/*
+    hint the processor that the calling thread is in a spin-wait loop
+*/
+void svt_cpu_pause(void) {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+/*
+    full memory fence: no load or store is reordered across it
+*/
+void svt_memory_barrier(void) {
+#ifdef _WIN32
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+#endif
+}
+/*
+    give the rest of the time slice to another thread
+*/
+void svt_thread_yield(void) {
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+/*
+    wake all the threads sleeping on the condition variable
+
+    Must be called after the shared state tested by the waiters
+    has been updated. Cheap when nobody is sleeping: the lock is
+    only taken when a waiter has registered itself.
+*/
+void svt_notify_cond_var(CondVar *cond_var) {
+    svt_memory_barrier();
+    if (!cond_var->num_waiters)
+        return;
+#ifdef _WIN32
+    EnterCriticalSection(&cond_var->cs);
+    cond_var->val++;
+    WakeAllConditionVariable(&cond_var->cv);
+    LeaveCriticalSection(&cond_var->cs);
+#else
+    pthread_mutex_lock(&cond_var->m_mutex);
+    cond_var->val++;
+    pthread_cond_broadcast(&cond_var->m_cond);
+    pthread_mutex_unlock(&cond_var->m_mutex);
+#endif
+}
+/*
+    register the calling thread as a waiter and return the current
+    notification sequence. The caller must re-check its condition
+    before calling svt_end_wait_cond_var()
+*/
+int32_t svt_begin_wait_cond_var(CondVar *cond_var) {
+    int32_t seq;
+#ifdef _WIN32
+    EnterCriticalSection(&cond_var->cs);
+    cond_var->num_waiters++;
+    seq = cond_var->val;
+    LeaveCriticalSection(&cond_var->cs);
+#else
+    pthread_mutex_lock(&cond_var->m_mutex);
+    cond_var->num_waiters++;
+    seq = cond_var->val;
+    pthread_mutex_unlock(&cond_var->m_mutex);
+#endif
+    svt_memory_barrier();
+    return seq;
+}
+/*
+    sleep until a notification newer than seq arrives (when block is set)
+    and unregister the calling thread
+*/
+void svt_end_wait_cond_var(CondVar *cond_var, int32_t seq, EbBool block) {
+    const EbBool held_worker = block ? worker_pool_leave() : EB_FALSE;
+#ifdef _WIN32
+    EnterCriticalSection(&cond_var->cs);
+    while (block && cond_var->val == seq)
+        SleepConditionVariableCS(&cond_var->cv, &cond_var->cs, INFINITE);
+    cond_var->num_waiters--;
+    LeaveCriticalSection(&cond_var->cs);
+#else
+    pthread_mutex_lock(&cond_var->m_mutex);
+    while (block && cond_var->val == seq) pthread_cond_wait(&cond_var->m_cond, &cond_var->m_mutex);
+    cond_var->num_waiters--;
+    pthread_mutex_unlock(&cond_var->m_mutex);
+#endif
+    if (held_worker)
+        worker_pool_enter();
 }
 #endif
@@ -30,12 +30,22 @@ extern "C" {
      **************************************/
 extern EbHandle svt_create_thread(void *thread_function(void *), void *thread_context);
 
+extern EbHandle svt_create_pool_thread(EbHandle group_handle, void *thread_function(void *),
+                                       void *thread_context);
+
 extern EbErrorType svt_start_thread(EbHandle thread_handle);
 
 extern EbErrorType svt_stop_thread(EbHandle thread_handle);
 
 extern EbErrorType svt_destroy_thread(EbHandle thread_handle);
 
+// Storage class of the variables with one instance per thread
+#ifdef _WIN32
+#define EB_THREAD_LOCAL __declspec(thread)
+#else
+#define EB_THREAD_LOCAL __thread
+#endif
+
 /**************************************
      * Semaphores
      **************************************/
@@ -54,22 +64,50 @@ extern EbHandle          svt_create_mutex(void);
 extern EbErrorType       svt_release_mutex(EbHandle mutex_handle);
 extern EbErrorType       svt_block_on_mutex(EbHandle mutex_handle);
 extern EbErrorType       svt_destroy_mutex(EbHandle mutex_handle);
+
+/**************************************
+     * Worker Pool
+     *
+     * A worker pool bounds the number of threads of the pool that run at
+     * the same time to its worker count. A thread created with
+     * svt_create_pool_thread() must hold one of the workers to run and gives
+     * it back whenever it blocks on a semaphore, a mutex or a condition
+     * variable, so the threads that have work share the workers and the
+     * waiting ones cost nothing.
+     *
+     * The threads are created in worker groups, one per stream when several
+     * encoders share a pool. A freed worker goes to the waiting group
+     * holding the fewest workers. A group is destroyed once its threads
+     * have exited.
+     *
+     * This is a cap on the runnable threads, not a task scheduler: the
+     * kernels keep their own threads and fifos. While no thread waits for
+     * a worker, taking and giving back one is a single atomic operation.
+     **************************************/
+extern EbHandle    svt_create_worker_pool(uint32_t worker_count);
+extern EbErrorType svt_destroy_worker_pool(EbHandle pool_handle);
+extern EbHandle    svt_create_worker_group(EbHandle pool_handle);
+extern EbErrorType svt_destroy_worker_group(EbHandle group_handle);
+extern EbBool      svt_worker_pool_contended(void);
 extern EbMemoryMapEntry *memory_map; // library Memory table
 extern uint32_t *        memory_map_index; // library memory index
 extern uint64_t *        total_lib_memory; // library Memory malloc'd
+
+// EB_PLACE_THREAD creates a thread with create_call and runs it on the
+// logical processors of the encoder
 #ifdef _WIN32
 
-#define EB_CREATE_THREAD(pointer, thread_function, thread_context)    \
-    do {                                                              \
-        pointer = svt_create_thread(thread_function, thread_context); \
-        EB_ADD_MEM(pointer, 1, EB_THREAD);                            \
-        if (num_groups == 1)                                          \
-            SetThreadAffinityMask(pointer, group_affinity.Mask);      \
-        else if (num_groups == 2 && alternate_groups) {               \
-            group_affinity.Group = 1 - group_affinity.Group;          \
-            SetThreadGroupAffinity(pointer, &group_affinity, NULL);   \
-        } else if (num_groups == 2 && !alternate_groups)              \
-            SetThreadGroupAffinity(pointer, &group_affinity, NULL);   \
+#define EB_PLACE_THREAD(pointer, create_call)                        \
+    do {                                                             \
+        pointer = create_call;                                       \
+        EB_ADD_MEM(pointer, 1, EB_THREAD);                           \
+        if (num_groups == 1)                                         \
+            SetThreadAffinityMask(pointer, group_affinity.Mask);     \
+        else if (num_groups == 2 && alternate_groups) {              \
+            group_affinity.Group = 1 - group_affinity.Group;         \
+            SetThreadGroupAffinity(pointer, &group_affinity, NULL);  \
+        } else if (num_groups == 2 && !alternate_groups)             \
+            SetThreadGroupAffinity(pointer, &group_affinity, NULL);  \
     } while (0)
 
 #else
@@ -82,20 +120,25 @@ extern uint64_t *        total_lib_memory; // library Memory malloc'd
 #include <sched.h>
 #include <pthread.h>
 #if defined(__linux__)
-#define EB_CREATE_THREAD(pointer, thread_function, thread_context)                           \
+#define EB_PLACE_THREAD(pointer, create_call)                                                \
     do {                                                                                     \
-        pointer = svt_create_thread(thread_function, thread_context);                        \
+        pointer = create_call;                                                               \
         EB_ADD_MEM(pointer, 1, EB_THREAD);                                                   \
         pthread_setaffinity_np(*((pthread_t *)pointer), sizeof(cpu_set_t), &group_affinity); \
     } while (0)
 #else
-#define EB_CREATE_THREAD(pointer, thread_function, thread_context)    \
-    do {                                                              \
-        pointer = svt_create_thread(thread_function, thread_context); \
-        EB_ADD_MEM(pointer, 1, EB_THREAD);                            \
+#define EB_PLACE_THREAD(pointer, create_call) \
+    do {                                      \
+        pointer = create_call;                \
+        EB_ADD_MEM(pointer, 1, EB_THREAD);    \
     } while (0)
 #endif
 #endif
+#define EB_CREATE_POOL_THREAD(pointer, group_handle, thread_function, thread_context) \
+    EB_PLACE_THREAD(pointer, svt_create_pool_thread(group_handle, thread_function, thread_context))
+#define EB_CREATE_THREAD(pointer, thread_function, thread_context) \
+    EB_CREATE_POOL_THREAD(pointer, NULL, thread_function, thread_context)
+
 #define EB_DESTROY_THREAD(pointer)                   \
     do {                                             \
         if (pointer) {                               \
@@ -112,6 +155,13 @@ extern uint64_t *        total_lib_memory; // library Memory malloc'd
             EB_CREATE_THREAD(pa[i], thread_function, thread_contexts[i]);   \
     } while (0)
 
+#define EB_CREATE_POOL_THREAD_ARRAY(pa, count, group_handle, thread_function, thread_contexts) \
+    do {                                                                                      \
+        EB_ALLOC_PTR_ARRAY(pa, count);                                                        \
+        for (uint32_t i = 0; i < count; i++)                                                  \
+            EB_CREATE_POOL_THREAD(pa[i], group_handle, thread_function, thread_contexts[i]);  \
+    } while (0)
+
 #define EB_DESTROY_THREAD_ARRAY(pa, count)                                 \
     do {                                                                   \
         if (pa) {                                                          \
@@ -122,12 +172,53 @@ extern uint64_t *        total_lib_memory; // library Memory malloc'd
 
 void atomic_set_u32(AtomicVarU32 *var, uint32_t in);
 
+/*
+ Lock-free operations on 32 bit variables shared between threads.
+ Loads have acquire semantics, stores have release semantics and
+ read-modify-write operations are full barriers.
+*/
+#ifdef _WIN32
+static INLINE uint32_t svt_atomic_load_u32(volatile uint32_t *ptr) {
+    return (uint32_t)InterlockedCompareExchange((volatile LONG *)ptr, 0, 0);
+}
+static INLINE void svt_atomic_store_u32(volatile uint32_t *ptr, uint32_t val) {
+    InterlockedExchange((volatile LONG *)ptr, (LONG)val);
+}
+static INLINE uint32_t svt_atomic_fetch_add_u32(volatile uint32_t *ptr, uint32_t val) {
+    return (uint32_t)InterlockedExchangeAdd((volatile LONG *)ptr, (LONG)val);
+}
+static INLINE EbBool svt_atomic_cas_u32(volatile uint32_t *ptr, uint32_t expected,
+                                        uint32_t desired) {
+    return InterlockedCompareExchange((volatile LONG *)ptr, (LONG)desired, (LONG)expected) ==
+        (LONG)expected;
+}
+#else
+static INLINE uint32_t svt_atomic_load_u32(volatile uint32_t *ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+static INLINE void svt_atomic_store_u32(volatile uint32_t *ptr, uint32_t val) {
+    __atomic_store_n(ptr, val, __ATOMIC_RELEASE);
+}
+static INLINE uint32_t svt_atomic_fetch_add_u32(volatile uint32_t *ptr, uint32_t val) {
+    return __atomic_fetch_add(ptr, val, __ATOMIC_SEQ_CST);
+}
+static INLINE EbBool svt_atomic_cas_u32(volatile uint32_t *ptr, uint32_t expected,
+                                        uint32_t desired) {
+    return __atomic_compare_exchange_n(
+               ptr, &expected, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)
+        ? EB_TRUE
+        : EB_FALSE;
+}
+#endif
+
 #if FIX_DDL
 /*
  Condition variable
 */
 typedef struct CondVar {
     int32_t val;
+    /* number of threads registered through svt_begin_wait_cond_var() */
+    volatile int32_t num_waiters;
 #ifdef _WIN32
     CRITICAL_SECTION   cs;
     CONDITION_VARIABLE cv;
@@ -140,6 +231,36 @@ typedef struct CondVar {
 void svt_set_cond_var(CondVar *cond_var, int32_t newval);
 void svt_wait_cond_var(CondVar *cond_var, int32_t input);
 void svt_create_cond_var(CondVar *cond_var);
+
+/*
+ Spin-then-block waiting on a condition published through a CondVar.
+ The producer updates its shared state and then calls svt_notify_cond_var(),
+ which only takes the lock when some thread is actually sleeping.
+ The consumer uses SVT_SPIN_WAIT_COND_VAR(), which polls the condition for
+ spin_count iterations before blocking on the condition variable. It blocks
+ at once when it holds the worker of a pool another thread waits for.
+*/
+void    svt_cpu_pause(void);
+void    svt_memory_barrier(void);
+void    svt_thread_yield(void);
+void    svt_notify_cond_var(CondVar *cond_var);
+int32_t svt_begin_wait_cond_var(CondVar *cond_var);
+void    svt_end_wait_cond_var(CondVar *cond_var, int32_t seq, EbBool block);
+
+#define SVT_SPIN_WAIT_COND_VAR(cond_var, spin_count, cond)                  \
+    do {                                                                    \
+        uint32_t spin_iter_ = 0;                                            \
+        while (!(cond)) {                                                   \
+            if (spin_iter_ < (uint32_t)(spin_count) &&                      \
+                !svt_worker_pool_contended()) {                             \
+                spin_iter_++;                                               \
+                svt_cpu_pause();                                            \
+            } else {                                                        \
+                int32_t wait_seq_ = svt_begin_wait_cond_var(cond_var);      \
+                svt_end_wait_cond_var(cond_var, wait_seq_, (EbBool)!(cond)); \
+            }                                                               \
+        }                                                                   \
+    } while (0)
 #endif
 
 #ifdef __cplusplus
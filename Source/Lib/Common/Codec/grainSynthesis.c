@@ -574,7 +574,7 @@ static void init_scaling_function(int32_t scaling_points[][2], int32_t num_point
 
 // function that extracts samples from a lut (and interpolates intemediate
 // frames for 10- and 12-bit video)
-static int32_t scale_lut(int32_t *scaling_lut, int32_t index, int32_t bit_depth) {
+static int32_t scale_lut(const int32_t *scaling_lut, int32_t index, int32_t bit_depth) {
     int32_t x = index >> (bit_depth - 8);
 
     if (!(bit_depth - 8) || x == 255)
@@ -586,112 +586,206 @@ static int32_t scale_lut(int32_t *scaling_lut, int32_t index, int32_t bit_depth)
              (bit_depth - 8));
 }
 
+void svt_av1_add_luma_grain_c(uint8_t *luma, int32_t luma_stride, const int32_t *grain,
+                              int32_t grain_stride, int32_t width, int32_t height,
+                              const GrainScaling *gs) {
+    const int32_t rounding_offset = (1 << (gs->scaling_shift - 1));
+
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            luma[i * luma_stride + j] = clamp(
+                luma[i * luma_stride + j] +
+                    ((scale_lut(gs->scaling_lut, luma[i * luma_stride + j], 8) *
+                          grain[i * grain_stride + j] +
+                      rounding_offset) >>
+                     gs->scaling_shift),
+                gs->min_val,
+                gs->max_val);
+        }
+    }
+}
+
+void svt_av1_highbd_add_luma_grain_c(uint16_t *luma, int32_t luma_stride, const int32_t *grain,
+                                     int32_t grain_stride, int32_t width, int32_t height,
+                                     const GrainScaling *gs) {
+    const int32_t rounding_offset = (1 << (gs->scaling_shift - 1));
+
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            luma[i * luma_stride + j] = clamp(
+                luma[i * luma_stride + j] +
+                    ((scale_lut(gs->scaling_lut, luma[i * luma_stride + j], gs->bit_depth) *
+                          grain[i * grain_stride + j] +
+                      rounding_offset) >>
+                     gs->scaling_shift),
+                gs->min_val,
+                gs->max_val);
+        }
+    }
+}
+
+// The chroma grain is scaled by a function of the chroma sample and of the
+// co-located (averaged) luma sample, the luma plane must not be noised yet.
+void svt_av1_add_chroma_grain_c(uint8_t *chroma, int32_t chroma_stride, const uint8_t *luma,
+                                int32_t luma_stride, const int32_t *grain, int32_t grain_stride,
+                                int32_t width, int32_t height, int32_t chroma_subsamp_x,
+                                int32_t chroma_subsamp_y, const GrainScaling *gs) {
+    const int32_t rounding_offset = (1 << (gs->scaling_shift - 1));
+
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            int32_t average_luma = 0;
+            if (chroma_subsamp_x) {
+                average_luma =
+                    (luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x)] +
+                     luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x) + 1] +
+                     1) >>
+                    1;
+            } else
+                average_luma = luma[(i << chroma_subsamp_y) * luma_stride + j];
+            chroma[i * chroma_stride + j] = clamp(
+                chroma[i * chroma_stride + j] +
+                    ((scale_lut(gs->scaling_lut,
+                                clamp(((average_luma * gs->luma_mult +
+                                        gs->mult * chroma[i * chroma_stride + j]) >>
+                                       6) +
+                                          gs->offset,
+                                      0,
+                                      255),
+                                8) *
+                          grain[i * grain_stride + j] +
+                      rounding_offset) >>
+                     gs->scaling_shift),
+                gs->min_val,
+                gs->max_val);
+        }
+    }
+}
+
+void svt_av1_highbd_add_chroma_grain_c(uint16_t *chroma, int32_t chroma_stride,
+                                       const uint16_t *luma, int32_t luma_stride,
+                                       const int32_t *grain, int32_t grain_stride, int32_t width,
+                                       int32_t height, int32_t chroma_subsamp_x,
+                                       int32_t chroma_subsamp_y, const GrainScaling *gs) {
+    const int32_t rounding_offset = (1 << (gs->scaling_shift - 1));
+
+    for (int32_t i = 0; i < height; i++) {
+        for (int32_t j = 0; j < width; j++) {
+            int32_t average_luma = 0;
+            if (chroma_subsamp_x) {
+                average_luma =
+                    (luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x)] +
+                     luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x) + 1] +
+                     1) >>
+                    1;
+            } else
+                average_luma = luma[(i << chroma_subsamp_y) * luma_stride + j];
+            chroma[i * chroma_stride + j] = clamp(
+                chroma[i * chroma_stride + j] +
+                    ((scale_lut(gs->scaling_lut,
+                                clamp(((average_luma * gs->luma_mult +
+                                        gs->mult * chroma[i * chroma_stride + j]) >>
+                                       6) +
+                                          gs->offset,
+                                      0,
+                                      (256 << (gs->bit_depth - 8)) - 1),
+                                gs->bit_depth) *
+                          grain[i * grain_stride + j] +
+                      rounding_offset) >>
+                     gs->scaling_shift),
+                gs->min_val,
+                gs->max_val);
+        }
+    }
+}
+
 static void add_noise_to_block(AomFilmGrain *params, uint8_t *luma, uint8_t *cb, uint8_t *cr,
                                int32_t luma_stride, int32_t chroma_stride, int32_t *luma_grain,
                                int32_t *cb_grain, int32_t *cr_grain, int32_t luma_grain_stride,
                                int32_t chroma_grain_stride, int32_t half_luma_height,
                                int32_t half_luma_width, int32_t bit_depth, int32_t chroma_subsamp_y,
                                int32_t chroma_subsamp_x) {
-    int32_t cb_mult      = params->cb_mult - 128; // fixed scale
-    int32_t cb_luma_mult = params->cb_luma_mult - 128; // fixed scale
-    int32_t cb_offset    = params->cb_offset - 256;
+    GrainScaling y_scaling, cb_scaling, cr_scaling;
+    (void)bit_depth;
 
-    int32_t cr_mult      = params->cr_mult - 128; // fixed scale
-    int32_t cr_luma_mult = params->cr_luma_mult - 128; // fixed scale
-    int32_t cr_offset    = params->cr_offset - 256;
+    cb_scaling.scaling_lut = scaling_lut_cb;
+    cb_scaling.mult        = params->cb_mult - 128; // fixed scale
+    cb_scaling.luma_mult   = params->cb_luma_mult - 128; // fixed scale
+    cb_scaling.offset      = params->cb_offset - 256;
 
-    int32_t rounding_offset = (1 << (params->scaling_shift - 1));
+    cr_scaling.scaling_lut = scaling_lut_cr;
+    cr_scaling.mult        = params->cr_mult - 128; // fixed scale
+    cr_scaling.luma_mult   = params->cr_luma_mult - 128; // fixed scale
+    cr_scaling.offset      = params->cr_offset - 256;
 
     int32_t apply_y  = params->num_y_points > 0 ? 1 : 0;
     int32_t apply_cb = (params->num_cb_points > 0 || params->chroma_scaling_from_luma) ? 1 : 0;
     int32_t apply_cr = (params->num_cr_points > 0 || params->chroma_scaling_from_luma) ? 1 : 0;
 
     if (params->chroma_scaling_from_luma) {
-        cb_mult      = 0; // fixed scale
-        cb_luma_mult = 64; // fixed scale
-        cb_offset    = 0;
+        cb_scaling.mult      = 0; // fixed scale
+        cb_scaling.luma_mult = 64; // fixed scale
+        cb_scaling.offset    = 0;
 
-        cr_mult      = 0; // fixed scale
-        cr_luma_mult = 64; // fixed scale
-        cr_offset    = 0;
+        cr_scaling.mult      = 0; // fixed scale
+        cr_scaling.luma_mult = 64; // fixed scale
+        cr_scaling.offset    = 0;
     }
 
-    int32_t min_luma, max_luma, min_chroma, max_chroma;
-
     if (params->clip_to_restricted_range) {
-        min_luma = min_luma_legal_range;
-        max_luma = max_luma_legal_range;
+        y_scaling.min_val = min_luma_legal_range;
+        y_scaling.max_val = max_luma_legal_range;
 
-        min_chroma = min_chroma_legal_range;
-        max_chroma = max_chroma_legal_range;
+        cb_scaling.min_val = min_chroma_legal_range;
+        cb_scaling.max_val = max_chroma_legal_range;
     } else {
-        min_luma = min_chroma = 0;
-        max_luma = max_chroma = 255;
-    }
-
-    for (int32_t i = 0; i < (half_luma_height << (1 - chroma_subsamp_y)); i++) {
-        for (int32_t j = 0; j < (half_luma_width << (1 - chroma_subsamp_x)); j++) {
-            int32_t average_luma = 0;
-            if (chroma_subsamp_x) {
-                average_luma =
-                    (luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x)] +
-                     luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x) + 1] +
-                     1) >>
-                    1;
-            } else
-                average_luma = luma[(i << chroma_subsamp_y) * luma_stride + j];
-            if (apply_cb) {
-                cb[i * chroma_stride + j] = clamp(
-                    cb[i * chroma_stride + j] +
-                        ((scale_lut(scaling_lut_cb,
-                                    clamp(((average_luma * cb_luma_mult +
-                                            cb_mult * cb[i * chroma_stride + j]) >>
-                                           6) +
-                                              cb_offset,
-                                          0,
-                                          (256 << (bit_depth - 8)) - 1),
-                                    8) *
-                              cb_grain[i * chroma_grain_stride + j] +
-                          rounding_offset) >>
-                         params->scaling_shift),
-                    min_chroma,
-                    max_chroma);
-            }
-
-            if (apply_cr) {
-                cr[i * chroma_stride + j] = clamp(
-                    cr[i * chroma_stride + j] +
-                        ((scale_lut(scaling_lut_cr,
-                                    clamp(((average_luma * cr_luma_mult +
-                                            cr_mult * cr[i * chroma_stride + j]) >>
-                                           6) +
-                                              cr_offset,
-                                          0,
-                                          (256 << (bit_depth - 8)) - 1),
-                                    8) *
-                              cr_grain[i * chroma_grain_stride + j] +
-                          rounding_offset) >>
-                         params->scaling_shift),
-                    min_chroma,
-                    max_chroma);
-            }
-        }
-    }
-
-    if (apply_y) {
-        for (int32_t i = 0; i < (half_luma_height << 1); i++) {
-            for (int32_t j = 0; j < (half_luma_width << 1); j++) {
-                luma[i * luma_stride + j] = clamp(
-                    luma[i * luma_stride + j] +
-                        ((scale_lut(scaling_lut_y, luma[i * luma_stride + j], 8) *
-                              luma_grain[i * luma_grain_stride + j] +
-                          rounding_offset) >>
-                         params->scaling_shift),
-                    min_luma,
-                    max_luma);
-            }
-        }
+        y_scaling.min_val = cb_scaling.min_val = 0;
+        y_scaling.max_val = cb_scaling.max_val = 255;
     }
+    cr_scaling.min_val = cb_scaling.min_val;
+    cr_scaling.max_val = cb_scaling.max_val;
+
+    y_scaling.scaling_lut = scaling_lut_y;
+    y_scaling.mult = y_scaling.luma_mult = y_scaling.offset = 0;
+    y_scaling.scaling_shift = cb_scaling.scaling_shift = cr_scaling.scaling_shift =
+        params->scaling_shift;
+    y_scaling.bit_depth = cb_scaling.bit_depth = cr_scaling.bit_depth = 8;
+
+    const int32_t chroma_height = half_luma_height << (1 - chroma_subsamp_y);
+    const int32_t chroma_width  = half_luma_width << (1 - chroma_subsamp_x);
+
+    if (apply_cb)
+        svt_av1_add_chroma_grain(cb,
+                                 chroma_stride,
+                                 luma,
+                                 luma_stride,
+                                 cb_grain,
+                                 chroma_grain_stride,
+                                 chroma_width,
+                                 chroma_height,
+                                 chroma_subsamp_x,
+                                 chroma_subsamp_y,
+                                 &cb_scaling);
+    if (apply_cr)
+        svt_av1_add_chroma_grain(cr,
+                                 chroma_stride,
+                                 luma,
+                                 luma_stride,
+                                 cr_grain,
+                                 chroma_grain_stride,
+                                 chroma_width,
+                                 chroma_height,
+                                 chroma_subsamp_x,
+                                 chroma_subsamp_y,
+                                 &cr_scaling);
+    if (apply_y)
+        svt_av1_add_luma_grain(luma,
+                               luma_stride,
+                               luma_grain,
+                               luma_grain_stride,
+                               half_luma_width << 1,
+                               half_luma_height << 1,
+                               &y_scaling);
 }
 
 static void add_noise_to_block_hbd(AomFilmGrain *params, uint16_t *luma, uint16_t *cb, uint16_t *cr,
@@ -700,107 +794,88 @@ static void add_noise_to_block_hbd(AomFilmGrain *params, uint16_t *luma, uint16_
                                    int32_t chroma_grain_stride, int32_t half_luma_height,
                                    int32_t half_luma_width, int32_t bit_depth,
                                    int32_t chroma_subsamp_y, int32_t chroma_subsamp_x) {
-    int32_t cb_mult      = params->cb_mult - 128; // fixed scale
-    int32_t cb_luma_mult = params->cb_luma_mult - 128; // fixed scale
-    // offset value depends on the bit depth
-    int32_t cb_offset = (params->cb_offset << (bit_depth - 8)) - (1 << bit_depth);
+    GrainScaling y_scaling, cb_scaling, cr_scaling;
 
-    int32_t cr_mult      = params->cr_mult - 128; // fixed scale
-    int32_t cr_luma_mult = params->cr_luma_mult - 128; // fixed scale
+    cb_scaling.scaling_lut = scaling_lut_cb;
+    cb_scaling.mult        = params->cb_mult - 128; // fixed scale
+    cb_scaling.luma_mult   = params->cb_luma_mult - 128; // fixed scale
     // offset value depends on the bit depth
-    int32_t cr_offset = (params->cr_offset << (bit_depth - 8)) - (1 << bit_depth);
+    cb_scaling.offset = (params->cb_offset << (bit_depth - 8)) - (1 << bit_depth);
 
-    int32_t rounding_offset = (1 << (params->scaling_shift - 1));
+    cr_scaling.scaling_lut = scaling_lut_cr;
+    cr_scaling.mult        = params->cr_mult - 128; // fixed scale
+    cr_scaling.luma_mult   = params->cr_luma_mult - 128; // fixed scale
+    // offset value depends on the bit depth
+    cr_scaling.offset = (params->cr_offset << (bit_depth - 8)) - (1 << bit_depth);
 
     int32_t apply_y  = params->num_y_points > 0 ? 1 : 0;
     int32_t apply_cb = params->num_cb_points > 0 ? 1 : 0;
     int32_t apply_cr = params->num_cr_points > 0 ? 1 : 0;
 
     if (params->chroma_scaling_from_luma) {
-        cb_mult      = 0; // fixed scale
-        cb_luma_mult = 64; // fixed scale
-        cb_offset    = 0;
+        cb_scaling.mult      = 0; // fixed scale
+        cb_scaling.luma_mult = 64; // fixed scale
+        cb_scaling.offset    = 0;
 
-        cr_mult      = 0; // fixed scale
-        cr_luma_mult = 64; // fixed scale
-        cr_offset    = 0;
+        cr_scaling.mult      = 0; // fixed scale
+        cr_scaling.luma_mult = 64; // fixed scale
+        cr_scaling.offset    = 0;
     }
 
-    int32_t min_luma, max_luma, min_chroma, max_chroma;
-
     if (params->clip_to_restricted_range) {
-        min_luma = min_luma_legal_range << (bit_depth - 8);
-        max_luma = max_luma_legal_range << (bit_depth - 8);
+        y_scaling.min_val = min_luma_legal_range << (bit_depth - 8);
+        y_scaling.max_val = max_luma_legal_range << (bit_depth - 8);
 
-        min_chroma = min_chroma_legal_range << (bit_depth - 8);
-        max_chroma = max_chroma_legal_range << (bit_depth - 8);
+        cb_scaling.min_val = min_chroma_legal_range << (bit_depth - 8);
+        cb_scaling.max_val = max_chroma_legal_range << (bit_depth - 8);
     } else {
-        min_luma = min_chroma = 0;
-        max_luma = max_chroma = (256 << (bit_depth - 8)) - 1;
-    }
-
-    for (int32_t i = 0; i < (half_luma_height << (1 - chroma_subsamp_y)); i++) {
-        for (int32_t j = 0; j < (half_luma_width << (1 - chroma_subsamp_x)); j++) {
-            int32_t average_luma = 0;
-            if (chroma_subsamp_x) {
-                average_luma =
-                    (luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x)] +
-                     luma[(i << chroma_subsamp_y) * luma_stride + (j << chroma_subsamp_x) + 1] +
-                     1) >>
-                    1;
-            } else
-                average_luma = luma[(i << chroma_subsamp_y) * luma_stride + j];
-            if (apply_cb) {
-                cb[i * chroma_stride + j] = clamp(
-                    cb[i * chroma_stride + j] +
-                        ((scale_lut(scaling_lut_cb,
-                                    clamp(((average_luma * cb_luma_mult +
-                                            cb_mult * cb[i * chroma_stride + j]) >>
-                                           6) +
-                                              cb_offset,
-                                          0,
-                                          (256 << (bit_depth - 8)) - 1),
-                                    bit_depth) *
-                              cb_grain[i * chroma_grain_stride + j] +
-                          rounding_offset) >>
-                         params->scaling_shift),
-                    min_chroma,
-                    max_chroma);
-            }
-            if (apply_cr) {
-                cr[i * chroma_stride + j] = clamp(
-                    cr[i * chroma_stride + j] +
-                        ((scale_lut(scaling_lut_cr,
-                                    clamp(((average_luma * cr_luma_mult +
-                                            cr_mult * cr[i * chroma_stride + j]) >>
-                                           6) +
-                                              cr_offset,
-                                          0,
-                                          (256 << (bit_depth - 8)) - 1),
-                                    bit_depth) *
-                              cr_grain[i * chroma_grain_stride + j] +
-                          rounding_offset) >>
-                         params->scaling_shift),
-                    min_chroma,
-                    max_chroma);
-            }
-        }
-    }
-
-    if (apply_y) {
-        for (int32_t i = 0; i < (half_luma_height << 1); i++) {
-            for (int32_t j = 0; j < (half_luma_width << 1); j++) {
-                luma[i * luma_stride + j] = clamp(
-                    luma[i * luma_stride + j] +
-                        ((scale_lut(scaling_lut_y, luma[i * luma_stride + j], bit_depth) *
-                              luma_grain[i * luma_grain_stride + j] +
-                          rounding_offset) >>
-                         params->scaling_shift),
-                    min_luma,
-                    max_luma);
-            }
-        }
+        y_scaling.min_val = cb_scaling.min_val = 0;
+        y_scaling.max_val = cb_scaling.max_val = (256 << (bit_depth - 8)) - 1;
     }
+    cr_scaling.min_val = cb_scaling.min_val;
+    cr_scaling.max_val = cb_scaling.max_val;
+
+    y_scaling.scaling_lut = scaling_lut_y;
+    y_scaling.mult = y_scaling.luma_mult = y_scaling.offset = 0;
+    y_scaling.scaling_shift = cb_scaling.scaling_shift = cr_scaling.scaling_shift =
+        params->scaling_shift;
+    y_scaling.bit_depth = cb_scaling.bit_depth = cr_scaling.bit_depth = bit_depth;
+
+    const int32_t chroma_height = half_luma_height << (1 - chroma_subsamp_y);
+    const int32_t chroma_width  = half_luma_width << (1 - chroma_subsamp_x);
+
+    if (apply_cb)
+        svt_av1_highbd_add_chroma_grain(cb,
+                                        chroma_stride,
+                                        luma,
+                                        luma_stride,
+                                        cb_grain,
+                                        chroma_grain_stride,
+                                        chroma_width,
+                                        chroma_height,
+                                        chroma_subsamp_x,
+                                        chroma_subsamp_y,
+                                        &cb_scaling);
+    if (apply_cr)
+        svt_av1_highbd_add_chroma_grain(cr,
+                                        chroma_stride,
+                                        luma,
+                                        luma_stride,
+                                        cr_grain,
+                                        chroma_grain_stride,
+                                        chroma_width,
+                                        chroma_height,
+                                        chroma_subsamp_x,
+                                        chroma_subsamp_y,
+                                        &cr_scaling);
+    if (apply_y)
+        svt_av1_highbd_add_luma_grain(luma,
+                                      luma_stride,
+                                      luma_grain,
+                                      luma_grain_stride,
+                                      half_luma_width << 1,
+                                      half_luma_height << 1,
+                                      &y_scaling);
 }
 
 int32_t film_grain_params_equal(AomFilmGrain *pars_a, AomFilmGrain *pars_b) {
@@ -923,9 +998,10 @@ static void ver_boundary_overlap(int32_t *left_block, int32_t left_stride, int32
     }
 }
 
-static void hor_boundary_overlap(int32_t *top_block, int32_t top_stride, int32_t *bottom_block,
-                                 int32_t bottom_stride, int32_t *dst_block, int32_t dst_stride,
-                                 int32_t width, int32_t height) {
+void svt_av1_grain_hor_boundary_overlap_c(const int32_t *top_block, int32_t top_stride,
+                                          const int32_t *bottom_block, int32_t bottom_stride,
+                                          int32_t *dst_block, int32_t dst_stride, int32_t width,
+                                          int32_t height, int32_t grain_min, int32_t grain_max) {
     if (height == 1) {
         while (width) {
             *dst_block = clamp(
@@ -953,6 +1029,21 @@ static void hor_boundary_overlap(int32_t *top_block, int32_t top_stride, int32_t
     }
 }
 
+static void hor_boundary_overlap(int32_t *top_block, int32_t top_stride, int32_t *bottom_block,
+                                 int32_t bottom_stride, int32_t *dst_block, int32_t dst_stride,
+                                 int32_t width, int32_t height) {
+    svt_av1_grain_hor_boundary_overlap(top_block,
+                                       top_stride,
+                                       bottom_block,
+                                       bottom_stride,
+                                       dst_block,
+                                       dst_stride,
+                                       width,
+                                       height,
+                                       grain_min,
+                                       grain_max);
+}
+
 void svt_av1_add_film_grain_run(AomFilmGrain *params, uint8_t *luma, uint8_t *cb, uint8_t *cr,
                                 int32_t height, int32_t width, int32_t luma_stride,
                                 int32_t chroma_stride, int32_t use_high_bit_depth,
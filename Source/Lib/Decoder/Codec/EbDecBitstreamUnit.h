@@ -18,6 +18,10 @@
 //Added this EbBitstreamUnit.h because OdEcWindow is defined in it, but
 //we also defining it, so it leads to warning,  so i commented our defination & added EbBitstreamUnit.h file.
 
+#ifdef ARCH_X86_64
+#include <emmintrin.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -37,12 +41,12 @@ extern "C" {
 #define EC_PROB_SHIFT 6
 #define EC_MIN_PROB 4 // must be <= (1<<EC_PROB_SHIFT)/16
 
-/*OPT: OdEcWindow must be at least 32 bits, but if you have fast arithmetic
-   on a larger type, you can speed up the decoder by using it here.*/
-//typedef uint32_t OdEcWindow;
+/*OdEcWindow is shared with the encoder and stays 32 bits, the decoder uses its
+   own 64 bit window: each refill then inserts 6 to 8 bytes instead of 2 to 4.*/
+typedef uint64_t DecEcWindow;
 
-/*The size in bits of OdEcWindow.*/
-//#define OD_EC_WINDOW_SIZE ((int)sizeof(OdEcWindow) * CHAR_BIT)
+/*The size in bits of DecEcWindow.*/
+#define DEC_EC_WINDOW_SIZE ((int)sizeof(DecEcWindow) * CHAR_BIT)
 
 /********************************************************************************************************************************/
 /********************************************************************************************************************************/
@@ -70,6 +74,32 @@ extern int   enable_dump;
   inverse).*/
 #define AOM_ICDF(x) (CDF_PROB_TOP - (x))
 
+#ifdef ARCH_X86_64
+/*SSE2 adaptation of the CDFs of more than 4 symbols, 8 entries at a time.
+  The entries from nsymbs - 1 on are stored back unchanged: they are the
+   counter and the next CDFs of the tile FRAME_CONTEXT, which is only accessed
+   by the thread parsing the tile.*/
+static INLINE void dec_update_cdf_sse2(AomCdfProb *cdf, int8_t val, int nsymbs, int rate) {
+    const __m128i shift = _mm_cvtsi32_si128(rate);
+    const __m128i top   = _mm_set1_epi16((int16_t)AOM_ICDF(0));
+    const __m128i val_v = _mm_set1_epi16(val);
+    const __m128i end_v = _mm_set1_epi16((int16_t)(nsymbs - 1));
+    __m128i       idx   = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+
+    for (int i = 0; i < nsymbs - 1; i += 8) {
+        const __m128i c = _mm_loadu_si128((const __m128i *)(cdf + i));
+        // i < val: cdf += (32768 - cdf) >> rate, otherwise cdf -= cdf >> rate
+        const __m128i inc  = _mm_cmpgt_epi16(val_v, idx);
+        const __m128i up   = _mm_srl_epi16(_mm_sub_epi16(top, c), shift);
+        const __m128i down = _mm_srl_epi16(c, shift);
+        __m128i d = _mm_sub_epi16(_mm_and_si128(inc, up), _mm_andnot_si128(inc, down));
+        d         = _mm_and_si128(d, _mm_cmpgt_epi16(end_v, idx));
+        _mm_storeu_si128((__m128i *)(cdf + i), _mm_add_epi16(c, d));
+        idx = _mm_add_epi16(idx, _mm_set1_epi16(8));
+    }
+}
+#endif
+
 static INLINE void dec_update_cdf(AomCdfProb *cdf, int8_t val, int nsymbs) {
     int rate;
     int i, tmp;
@@ -77,7 +107,14 @@ static INLINE void dec_update_cdf(AomCdfProb *cdf, int8_t val, int nsymbs) {
     static const int nsymbs2speed[17] = {0, 0, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
     assert(nsymbs < 17);
     rate = 3 + (cdf[nsymbs] > 15) + (cdf[nsymbs] > 31) + nsymbs2speed[nsymbs]; // + get_msb(nsymbs);
-    tmp  = AOM_ICDF(0);
+#ifdef ARCH_X86_64
+    if (nsymbs > 4) {
+        dec_update_cdf_sse2(cdf, val, nsymbs, rate);
+        cdf[nsymbs] += (cdf[nsymbs] < 32);
+        return;
+    }
+#endif
+    tmp = AOM_ICDF(0);
 
     // Single loop (faster)
     for (i = 0; i < nsymbs - 1; ++i) {
@@ -114,12 +151,12 @@ typedef struct OdEcDec {
 
     /*The difference between the high end of the current range, (low + rng), and
     the coded value, minus 1.
-    This stores up to OD_EC_WINDOW_SIZE bits of that difference, but the
+    This stores up to DEC_EC_WINDOW_SIZE bits of that difference, but the
     decoder only uses the top 16 bits of the window to decode the next symbol.
     As we shift up during renormalization, if we don't have enough bits left in
     the window to fill the top 16, we'll read in more bits of the coded
     value.*/
-    OdEcWindow dif;
+    DecEcWindow dif;
     /*The number of values in the current range.*/
     uint16_t rng;
     /*The number of bits of data in the current value.*/
@@ -136,7 +173,7 @@ static void od_ec_dec_refill(OdEcDec *dec);
   ret: The value to return.
   Return: ret.
           This allows the compiler to jump to this function via a tail-call.*/
-static int od_ec_dec_normalize(OdEcDec *dec, OdEcWindow dif, unsigned rng, int ret) {
+static int od_ec_dec_normalize(OdEcDec *dec, DecEcWindow dif, unsigned rng, int ret) {
     int d;
     assert(rng <= 65535U);
     /*The number of leading zeros in the 16-bit binary representation of rng.*/
@@ -155,21 +192,21 @@ static int od_ec_dec_normalize(OdEcDec *dec, OdEcWindow dif, unsigned rng, int r
   f: The probability that the bit is one, scaled by 32768.
   Return: The value decoded (0 or 1).*/
 static int od_ec_decode_bool_q15(OdEcDec *dec, unsigned f) {
-    OdEcWindow dif;
-    OdEcWindow vw;
-    unsigned   r;
-    unsigned   r_new;
-    unsigned   v;
-    int        ret;
+    DecEcWindow dif;
+    DecEcWindow vw;
+    unsigned    r;
+    unsigned    r_new;
+    unsigned    v;
+    int         ret;
     assert(0 < f);
     assert(f < 32768U);
     dif = dec->dif;
     r   = dec->rng;
-    assert(dif >> (OD_EC_WINDOW_SIZE - 16) < r);
+    assert(dif >> (DEC_EC_WINDOW_SIZE - 16) < r);
     assert(32768U <= r);
     v = ((r >> 8) * (uint32_t)(f >> EC_PROB_SHIFT) >> (7 - EC_PROB_SHIFT));
     v += EC_MIN_PROB;
-    vw    = (OdEcWindow)v << (OD_EC_WINDOW_SIZE - 16);
+    vw    = (DecEcWindow)v << (DEC_EC_WINDOW_SIZE - 16);
     ret   = 1;
     r_new = v;
     if (dif >= vw) {
@@ -180,6 +217,43 @@ static int od_ec_decode_bool_q15(OdEcDec *dec, unsigned f) {
     return od_ec_dec_normalize(dec, dif, r_new, ret);
 }
 
+#ifdef ARCH_X86_64
+/*SSE2 search of the symbol decoded by od_ec_decode_cdf_q15() in alphabets of
+   more than 4 symbols: v is computed for 8 symbols at a time (16 above 8
+   symbols) and the symbol is the first one with c >= v.
+  The loads may read past the CDF, up to its 16th entry, but stay within the
+   tile FRAME_CONTEXT; these lanes come after the one of the last symbol, whose
+   v is 0, so they are never selected.
+  The iCDF entries are below 32768, so ((icdf >> 6) << 7) fits in 16 bits and
+   its high product with (r & 0xFF00) is ((r >> 8) * (icdf >> 6)) >> 1.*/
+static INLINE unsigned od_ec_cdf_v(const uint16_t *icdf, int N, unsigned r, int i) {
+    return ((r >> 8) * (uint32_t)(icdf[i] >> EC_PROB_SHIFT) >> (7 - EC_PROB_SHIFT - CDF_SHIFT)) +
+        EC_MIN_PROB * (N - i);
+}
+
+static INLINE int od_ec_cdf_search_sse2(const uint16_t *icdf, int N, unsigned r, unsigned c) {
+    const __m128i rng  = _mm_set1_epi16((int16_t)(r & 0xFF00));
+    const __m128i dif  = _mm_set1_epi16((int16_t)c);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i min_prob = _mm_sub_epi16(_mm_set1_epi16((int16_t)(EC_MIN_PROB * N)),
+                                           _mm_setr_epi16(0, 4, 8, 12, 16, 20, 24, 28));
+    __m128i p = _mm_loadu_si128((const __m128i *)icdf);
+    __m128i v = _mm_add_epi16(
+        _mm_mulhi_epu16(rng, _mm_slli_epi16(_mm_srli_epi16(p, EC_PROB_SHIFT), 7)), min_prob);
+    // c >= v
+    uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_subs_epu16(v, dif), zero));
+    if (N >= 8) {
+        p = _mm_loadu_si128((const __m128i *)(icdf + 8));
+        v = _mm_add_epi16(
+            _mm_mulhi_epu16(rng, _mm_slli_epi16(_mm_srli_epi16(p, EC_PROB_SHIFT), 7)),
+            _mm_sub_epi16(min_prob, _mm_set1_epi16(EC_MIN_PROB * 8)));
+        mask |= (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_subs_epu16(v, dif), zero)) << 16;
+    }
+    assert(mask);
+    return get_msb(mask & (~mask + 1)) >> 1;
+}
+#endif
+
 /*Decodes a symbol given an inverse cumulative distribution function (CDF)
    table in Q15.
   icdf: CDF_PROB_TOP minus the CDF, such that symbol s falls in the range
@@ -190,34 +264,43 @@ static int od_ec_decode_bool_q15(OdEcDec *dec, unsigned f) {
          This should be at most 16.
   Return: The decoded symbol s.*/
 static int od_ec_decode_cdf_q15(OdEcDec *dec, const uint16_t *icdf, int nsyms) {
-    OdEcWindow dif;
-    unsigned   r;
-    unsigned   c;
-    unsigned   u;
-    unsigned   v;
-    int        ret;
+    DecEcWindow dif;
+    unsigned    r;
+    unsigned    c;
+    unsigned    u;
+    unsigned    v;
+    int         ret;
     (void)nsyms;
     dif         = dec->dif;
     r           = dec->rng;
     const int N = nsyms - 1;
 
-    assert(dif >> (OD_EC_WINDOW_SIZE - 16) < r);
+    assert(dif >> (DEC_EC_WINDOW_SIZE - 16) < r);
     assert(icdf[nsyms - 1] == OD_ICDF(CDF_PROB_TOP));
     assert(32768U <= r);
     assert(7 - EC_PROB_SHIFT - CDF_SHIFT >= 0);
-    c   = (unsigned)(dif >> (OD_EC_WINDOW_SIZE - 16));
-    v   = r;
-    ret = -1;
-    do {
-        u = v;
-        v = ((r >> 8) * (uint32_t)(icdf[++ret] >> EC_PROB_SHIFT) >>
-             (7 - EC_PROB_SHIFT - CDF_SHIFT));
-        v += EC_MIN_PROB * (N - ret);
-    } while (c < v);
+    c = (unsigned)(dif >> (DEC_EC_WINDOW_SIZE - 16));
+#ifdef ARCH_X86_64
+    if (N > 3) {
+        ret = od_ec_cdf_search_sse2(icdf, N, r, c);
+        u   = ret ? od_ec_cdf_v(icdf, N, r, ret - 1) : r;
+        v   = od_ec_cdf_v(icdf, N, r, ret);
+    } else
+#endif
+    {
+        v   = r;
+        ret = -1;
+        do {
+            u = v;
+            v = ((r >> 8) * (uint32_t)(icdf[++ret] >> EC_PROB_SHIFT) >>
+                 (7 - EC_PROB_SHIFT - CDF_SHIFT));
+            v += EC_MIN_PROB * (N - ret);
+        } while (c < v);
+    }
     assert(v < u);
     assert(u <= r);
     r = u - v;
-    dif -= (OdEcWindow)v << (OD_EC_WINDOW_SIZE - 16);
+    dif -= (DecEcWindow)v << (DEC_EC_WINDOW_SIZE - 16);
     return od_ec_dec_normalize(dec, dif, r, ret);
 }
 
@@ -232,11 +315,17 @@ static int od_ec_decode_cdf_q15(OdEcDec *dec, const uint16_t *icdf, int nsyms) {
   Even relatively modest values like 100 would work fine.*/
 #define OD_EC_LOTS_OF_BITS (0x4000)
 
+static INLINE DecEcWindow dec_ec_load_be64(const unsigned char *p) {
+    return (DecEcWindow)p[0] << 56 | (DecEcWindow)p[1] << 48 | (DecEcWindow)p[2] << 40 |
+        (DecEcWindow)p[3] << 32 | (DecEcWindow)p[4] << 24 | (DecEcWindow)p[5] << 16 |
+        (DecEcWindow)p[6] << 8 | (DecEcWindow)p[7];
+}
+
 /*The return value of od_ec_dec_tell does not change across an od_ec_dec_refill
    call.*/
 static void od_ec_dec_refill(OdEcDec *dec) {
     int                  s;
-    OdEcWindow           dif;
+    DecEcWindow          dif;
     int16_t              cnt;
     const unsigned char *bptr;
     const unsigned char *end;
@@ -244,13 +333,22 @@ static void od_ec_dec_refill(OdEcDec *dec) {
     cnt  = dec->cnt;
     bptr = dec->bptr;
     end  = dec->end;
-    s    = OD_EC_WINDOW_SIZE - 9 - (cnt + 15);
+    s    = DEC_EC_WINDOW_SIZE - 9 - (cnt + 15);
+    if (s >= 0 && end - bptr >= 8) {
+        /*Insert at once the s / 8 + 1 bytes of the loop below, the first one at
+       bit s, from a big endian 8 bytes load.*/
+        const int n = (s >> 3) + 1;
+        dif ^= (dec_ec_load_be64(bptr) >> (DEC_EC_WINDOW_SIZE - 8 * n)) << (s & 7);
+        cnt += 8 * n;
+        bptr += n;
+        s -= 8 * n;
+    }
     for (; s >= 0 && bptr < end; s -= 8, bptr++) {
         /*Each time a byte is inserted into the window (dif), bptr advances and cnt
        is incremented by 8, so the total number of consumed bits (the return
        value of od_ec_dec_tell) does not change.*/
-        assert(s <= OD_EC_WINDOW_SIZE - 8);
-        dif ^= (OdEcWindow)bptr[0] << s;
+        assert(s <= DEC_EC_WINDOW_SIZE - 8);
+        dif ^= (DecEcWindow)bptr[0] << s;
         cnt += 8;
     }
     if (bptr >= end) {
@@ -278,10 +376,10 @@ static void od_ec_dec_refill(OdEcDec *dec) {
   storage: The size in bytes of the input buffer.*/
 static void od_ec_dec_init(OdEcDec *dec, const unsigned char *buf, uint32_t storage) {
     dec->buf       = buf;
-    dec->tell_offs = 10 - (OD_EC_WINDOW_SIZE - 8);
+    dec->tell_offs = 10 - (DEC_EC_WINDOW_SIZE - 8);
     dec->end       = buf + storage;
     dec->bptr      = buf;
-    dec->dif       = ((OdEcWindow)1 << (OD_EC_WINDOW_SIZE - 1)) - 1;
+    dec->dif       = ((DecEcWindow)1 << (DEC_EC_WINDOW_SIZE - 1)) - 1;
     dec->rng       = 0x8000;
     dec->cnt       = -15;
     od_ec_dec_refill(dec);
@@ -522,9 +522,7 @@ void svt_cdef_sb_row_mt(EbDecHandle *dec_handle, int32_t *mi_wide_l2, int32_t *m
         if (sb_fbr) {
             if (sb_fbc == pic_width_in_sb - 1)
                 nsync = 0;
-            while (*cdef_completed_in_prev_row < (sb_fbc + nsync))
-                ;
-            //Sleep(5); /* ToDo : Change */
+            DEC_MT_WAIT(dec_handle, *cdef_completed_in_prev_row >= (uint32_t)(sb_fbc + nsync));
         }
         /*Curr multi thread implementation of cdef goes through every SB SIZE row*/
         /*If SB SIZE is 128x128, as cdef excepts top right sync,
@@ -584,6 +582,7 @@ void svt_cdef_sb_row_mt(EbDecHandle *dec_handle, int32_t *mi_wide_l2, int32_t *m
         }
         /* Update Top-Right Sync*/
         *cdef_completed_in_row = sb_fbc;
+        DEC_MT_NOTIFY(dec_handle);
     }
 }
 
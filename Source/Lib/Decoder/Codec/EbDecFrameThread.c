@@ -0,0 +1,385 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+// SUMMARY
+//   Contains the parse / reconstruction pipelining functions (num_p_frames > 1)
+
+/**************************************
+ * Includes
+ **************************************/
+
+#include "EbDefinitions.h"
+
+#include "EbSvtAv1Dec.h"
+#include "EbDecHandle.h"
+#include "EbDecMemInit.h"
+#include "EbDecPicMgr.h"
+#include "EbDecFrameThread.h"
+
+#include "EbObuParse.h"
+#include "EbDecParseFrame.h"
+#include "EbDecProcessFrame.h"
+#include "EbDecInverseQuantize.h"
+
+#include "EbUtility.h"
+
+#ifdef _WIN32
+#include <windows.h>
+extern uint8_t        num_groups;
+extern GROUP_AFFINITY group_affinity;
+extern EbBool         alternate_groups;
+#elif defined(__linux__)
+extern cpu_set_t group_affinity;
+#endif
+
+#define DEC_FRAME_WAIT(ctxt, cond) \
+    SVT_SPIN_WAIT_COND_VAR(&(ctxt)->progress_cond, (ctxt)->thread_spin_count, cond)
+
+/* Point the frame level buffers of a handle to a buffer set */
+static void bind_frame_buf_set(EbDecHandle *dec_handle_ptr, DecFrameBufSet *buf_set) {
+    MainFrameBuf *main_frame_buf = &dec_handle_ptr->main_frame_buf;
+    CurFrameBuf * frame_buf      = &main_frame_buf->cur_frame_bufs[0];
+    CurFrameBuf * set_frame_buf  = &buf_set->frame_buf;
+    LrCtxt *      lr_ctxt        = (LrCtxt *)dec_handle_ptr->pv_lr_ctxt;
+
+    frame_buf->sb_info       = set_frame_buf->sb_info;
+    frame_buf->mode_info     = set_frame_buf->mode_info;
+    frame_buf->cdef_strength = set_frame_buf->cdef_strength;
+    frame_buf->delta_q       = set_frame_buf->delta_q;
+    frame_buf->delta_lf      = set_frame_buf->delta_lf;
+    frame_buf->tile_map_sb   = set_frame_buf->tile_map_sb;
+    for (int32_t plane = 0; plane < MAX_MB_PLANE; plane++) {
+        frame_buf->coeff[plane]  = set_frame_buf->coeff[plane];
+        frame_buf->lr_unit[plane] = set_frame_buf->lr_unit[plane];
+        lr_ctxt->lr_unit[plane]   = set_frame_buf->lr_unit[plane];
+    }
+    frame_buf->trans_info[AOM_PLANE_Y] = set_frame_buf->trans_info[AOM_PLANE_Y];
+    frame_buf->trans_info[AOM_PLANE_U] = set_frame_buf->trans_info[AOM_PLANE_U];
+
+    main_frame_buf->frame_mi_map.pps_sb_info = buf_set->pps_sb_info;
+    main_frame_buf->frame_mi_map.p_mi_offset = buf_set->p_mi_offset;
+}
+
+/* Release the picture references held by the completed jobs */
+static void reap_jobs(DecFrameThreadCtxt *ctxt) {
+    uint32_t num_completed = ctxt->num_completed;
+
+    while (ctxt->num_reaped != num_completed) {
+        DecFrameJob *job = &ctxt->jobs[ctxt->num_reaped % ctxt->num_slots];
+
+        dec_pic_mgr_release_pic(job->cur_pic_buf);
+        for (int32_t i = 0; i < REF_FRAMES; i++) dec_pic_mgr_release_pic(job->ref_frame_map[i]);
+        ctxt->num_reaped++;
+    }
+}
+
+static void wait_for_job(DecFrameThreadCtxt *ctxt, uint32_t job_num) {
+    DEC_FRAME_WAIT(ctxt, ctxt->num_completed > job_num);
+    svt_memory_barrier();
+    reap_jobs(ctxt);
+}
+
+static void drain_jobs(DecFrameThreadCtxt *ctxt) {
+    if (ctxt->num_submitted != ctxt->num_reaped)
+        wait_for_job(ctxt, ctxt->num_submitted - 1);
+}
+
+/* Reconstruct all the SBs of the frame, tile by tile in raster order */
+static void decode_frame_sbs(EbDecHandle *dec_handle_ptr, DecModCtxt *dec_mod_ctxt) {
+    SeqHeader *    seq_header     = &dec_handle_ptr->seq_header;
+    FrameHeader *  frame_header   = &dec_handle_ptr->frame_header;
+    TilesInfo *    tiles_info     = &frame_header->tiles_info;
+    MainFrameBuf * main_frame_buf = &dec_handle_ptr->main_frame_buf;
+    CurFrameBuf *  frame_buf      = &main_frame_buf->cur_frame_bufs[0];
+    EbColorConfig *color_config   = &seq_header->color_config;
+
+    for (int32_t tile_row = 0; tile_row < tiles_info->tile_rows; tile_row++) {
+        for (int32_t tile_col = 0; tile_col < tiles_info->tile_cols; tile_col++) {
+            svt_tile_init(&dec_mod_ctxt->cur_tile_info, frame_header, tile_row, tile_col);
+
+            for (uint32_t mi_row = tiles_info->tile_row_start_mi[tile_row];
+                 mi_row < tiles_info->tile_row_start_mi[tile_row + 1];
+                 mi_row += seq_header->sb_mi_size) {
+                int32_t sb_row = (mi_row << MI_SIZE_LOG2) >> seq_header->sb_size_log2;
+
+                svt_cfl_init(&dec_mod_ctxt->cfl_ctx, color_config);
+
+                for (uint32_t mi_col = tiles_info->tile_col_start_mi[tile_col];
+                     mi_col < tiles_info->tile_col_start_mi[tile_col + 1];
+                     mi_col += seq_header->sb_mi_size) {
+                    int32_t sb_col = (mi_col << MI_SIZE_LOG2) >> seq_header->sb_size_log2;
+                    SBInfo *sb_info =
+                        frame_buf->sb_info + (sb_row * main_frame_buf->sb_cols) + sb_col;
+
+                    dec_mod_ctxt->cur_coeff[AOM_PLANE_Y] = sb_info->sb_coeff[AOM_PLANE_Y];
+                    dec_mod_ctxt->cur_coeff[AOM_PLANE_U] = sb_info->sb_coeff[AOM_PLANE_U];
+                    dec_mod_ctxt->cur_coeff[AOM_PLANE_V] = sb_info->sb_coeff[AOM_PLANE_V];
+
+                    decode_super_block(dec_mod_ctxt, mi_row, mi_col, sb_info);
+                }
+            }
+        }
+    }
+}
+
+/* Reconstruct and post-filter one parsed frame on the reconstruction handle */
+static void decode_frame_job(DecFrameThreadCtxt *ctxt, DecFrameJob *job) {
+    EbDecHandle *recon_handle = ctxt->recon_handle;
+
+    recon_handle->seq_header     = job->seq_header;
+    recon_handle->frame_header   = job->frame_header;
+    recon_handle->cm             = job->cm;
+    recon_handle->is_lf_enabled  = job->is_lf_enabled;
+    recon_handle->sf_identity    = job->sf_identity;
+    recon_handle->cur_pic_buf[0] = job->cur_pic_buf;
+    svt_memcpy(recon_handle->ref_frame_map, job->ref_frame_map, sizeof(job->ref_frame_map));
+    svt_memcpy(
+        recon_handle->remapped_ref_idx, job->remapped_ref_idx, sizeof(job->remapped_ref_idx));
+    svt_memcpy(
+        recon_handle->ref_scale_factors, job->ref_scale_factors, sizeof(job->ref_scale_factors));
+
+    bind_frame_buf_set(recon_handle, &ctxt->buf_sets[job->buf_set_idx]);
+    svt_memcpy(recon_handle->main_frame_buf.cur_frame_bufs[0].global_motion_warp,
+               job->global_motion_warp,
+               sizeof(job->global_motion_warp));
+
+    DecModCtxt *dec_mod_ctxt = (DecModCtxt *)recon_handle->pv_dec_mod_ctxt;
+    setup_segmentation_dequant(dec_mod_ctxt);
+
+    decode_frame_sbs(recon_handle, dec_mod_ctxt);
+
+    dec_post_process_frame(recon_handle);
+}
+
+static void *dec_frame_thread_kernel(void *input_ptr) {
+    DecFrameThreadCtxt *ctxt = (DecFrameThreadCtxt *)input_ptr;
+
+    while (1) {
+        DEC_FRAME_WAIT(ctxt, ctxt->num_submitted != ctxt->num_completed || ctxt->end_flag);
+        /* Exit only once all the submitted frames are reconstructed */
+        if (ctxt->num_submitted == ctxt->num_completed)
+            break;
+        svt_memory_barrier();
+
+        decode_frame_job(ctxt, &ctxt->jobs[ctxt->num_completed % ctxt->num_slots]);
+
+        svt_memory_barrier();
+        ctxt->num_completed++;
+        svt_notify_cond_var(&ctxt->progress_cond);
+    }
+    return NULL;
+}
+
+/* Allocate the reconstruction handle and the per frame buffer sets.
+   Called from dec_mem_init(), after the frame buffers of the parse handle. */
+EbErrorType dec_frame_thread_init(EbDecHandle *dec_handle_ptr) {
+    EbErrorType         return_error = EB_ErrorNone;
+    DecFrameThreadCtxt *ctxt         = (DecFrameThreadCtxt *)dec_handle_ptr->pv_frame_thread_ctxt;
+
+    if (ctxt == NULL) {
+        EB_MALLOC_DEC(DecFrameThreadCtxt *, ctxt, sizeof(DecFrameThreadCtxt), EB_N_PTR);
+        memset(ctxt, 0, sizeof(DecFrameThreadCtxt));
+        EB_MALLOC_DEC(EbDecHandle *, ctxt->recon_handle, sizeof(EbDecHandle), EB_N_PTR);
+        svt_create_cond_var(&ctxt->progress_cond);
+        ctxt->num_slots         = dec_handle_ptr->num_frms_prll;
+        ctxt->thread_spin_count = dec_handle_ptr->dec_config.thread_spin_count;
+        dec_handle_ptr->pv_frame_thread_ctxt = ctxt;
+    } else {
+        /* Sequence change : the frames in flight still use the old buffers */
+        drain_jobs(ctxt);
+    }
+
+    /* The reconstruction handle shares the stream level state of the
+       parse handle and owns its reconstruction and post-filter contexts,
+       which are sized from the sequence header like those of the parse
+       handle */
+    EbDecHandle *recon_handle          = ctxt->recon_handle;
+    *recon_handle                      = *dec_handle_ptr;
+    recon_handle->dec_config.threads   = 1;
+    recon_handle->num_frms_prll        = 1;
+    recon_handle->pv_frame_thread_ctxt = NULL;
+
+    return_error |= init_dec_mod_ctxt(recon_handle, &recon_handle->pv_dec_mod_ctxt);
+    return_error |= init_lf_ctxt(recon_handle);
+    return_error |= init_lr_ctxt(recon_handle);
+    if (return_error != EB_ErrorNone)
+        return return_error;
+
+    MainFrameBuf *main_frame_buf = &dec_handle_ptr->main_frame_buf;
+    FrameMiMap *  frame_mi_map   = &main_frame_buf->frame_mi_map;
+    for (uint32_t i = 0; i < ctxt->num_slots; i++) {
+        DecFrameBufSet *buf_set = &ctxt->buf_sets[i];
+
+        buf_set->frame_buf = main_frame_buf->cur_frame_bufs[i];
+        if (i == 0) {
+            buf_set->pps_sb_info = frame_mi_map->pps_sb_info;
+            buf_set->p_mi_offset = frame_mi_map->p_mi_offset;
+        } else {
+            EB_MALLOC_DEC(SBInfo **,
+                          buf_set->pps_sb_info,
+                          frame_mi_map->sb_rows * frame_mi_map->sb_cols * sizeof(SBInfo *),
+                          EB_N_PTR);
+            EB_MALLOC_DEC(uint16_t *,
+                          buf_set->p_mi_offset,
+                          frame_mi_map->mi_rows_algnsb * frame_mi_map->mi_cols_algnsb *
+                              sizeof(uint16_t),
+                          EB_N_PTR);
+        }
+    }
+    bind_frame_buf_set(dec_handle_ptr, &ctxt->buf_sets[ctxt->num_submitted % ctxt->num_slots]);
+
+    if (ctxt->frame_thread_handle == NULL)
+        EB_CREATE_THREAD(ctxt->frame_thread_handle, dec_frame_thread_kernel, ctxt);
+
+    return return_error;
+}
+
+/* Hand the parsed frame over to the reconstruction thread
+   and get the buffers of the next frame to parse */
+EbErrorType dec_frame_thread_submit(EbDecHandle *dec_handle_ptr) {
+    DecFrameThreadCtxt *ctxt    = (DecFrameThreadCtxt *)dec_handle_ptr->pv_frame_thread_ctxt;
+    uint32_t            job_num = ctxt->num_submitted;
+    uint32_t            slot    = job_num % ctxt->num_slots;
+    DecFrameJob *       job     = &ctxt->jobs[slot];
+
+    job->buf_set_idx = slot;
+    job->cur_pic_buf = dec_handle_ptr->cur_pic_buf[0];
+    dec_pic_mgr_add_ref(job->cur_pic_buf);
+    for (int32_t i = 0; i < REF_FRAMES; i++) {
+        job->ref_frame_map[i] = dec_handle_ptr->ref_frame_map[i];
+        dec_pic_mgr_add_ref(job->ref_frame_map[i]);
+    }
+    svt_memcpy(job->remapped_ref_idx,
+               dec_handle_ptr->remapped_ref_idx,
+               sizeof(job->remapped_ref_idx));
+    svt_memcpy(job->ref_scale_factors,
+               dec_handle_ptr->ref_scale_factors,
+               sizeof(job->ref_scale_factors));
+    job->sf_identity   = dec_handle_ptr->sf_identity;
+    job->seq_header    = dec_handle_ptr->seq_header;
+    job->frame_header  = dec_handle_ptr->frame_header;
+    job->cm            = dec_handle_ptr->cm;
+    job->is_lf_enabled = dec_handle_ptr->is_lf_enabled;
+    svt_memcpy(job->global_motion_warp,
+               dec_handle_ptr->main_frame_buf.cur_frame_bufs[0].global_motion_warp,
+               sizeof(job->global_motion_warp));
+
+    svt_memory_barrier();
+    ctxt->num_submitted = job_num + 1;
+    ctxt->flushing      = EB_FALSE;
+    svt_notify_cond_var(&ctxt->progress_cond);
+
+    if (dec_handle_ptr->show_frame)
+        dec_frame_thread_push_output(dec_handle_ptr);
+
+    /* The next frame reuses the slot of the job num_slots behind it */
+    if (job_num + 1 >= ctxt->num_slots)
+        wait_for_job(ctxt, job_num + 1 - ctxt->num_slots);
+    bind_frame_buf_set(dec_handle_ptr, &ctxt->buf_sets[(job_num + 1) % ctxt->num_slots]);
+
+    return EB_ErrorNone;
+}
+
+/* Get a free picture, waiting for the frames in flight to release one */
+EbDecPicBuf *dec_frame_thread_get_cur_pic(EbDecHandle *dec_handle_ptr) {
+    DecFrameThreadCtxt *ctxt = (DecFrameThreadCtxt *)dec_handle_ptr->pv_frame_thread_ctxt;
+
+    reap_jobs(ctxt);
+    EbDecPicBuf *pic_buf = dec_pic_mgr_get_cur_pic(dec_handle_ptr);
+    while (pic_buf == NULL && ctxt->num_reaped != ctxt->num_submitted) {
+        wait_for_job(ctxt, ctxt->num_reaped);
+        pic_buf = dec_pic_mgr_get_cur_pic(dec_handle_ptr);
+    }
+    return pic_buf;
+}
+
+/* The output queue is full : svt_av1_dec_frame() does not take more data
+   until svt_av1_dec_get_picture() returned a picture */
+EbBool dec_frame_thread_output_full(EbDecHandle *dec_handle_ptr) {
+    DecFrameThreadCtxt *ctxt = (DecFrameThreadCtxt *)dec_handle_ptr->pv_frame_thread_ctxt;
+
+    return ctxt != NULL && ctxt->num_out_pics >= ctxt->num_slots;
+}
+
+/* Queue the current picture for output */
+void dec_frame_thread_push_output(EbDecHandle *dec_handle_ptr) {
+    DecFrameThreadCtxt *ctxt    = (DecFrameThreadCtxt *)dec_handle_ptr->pv_frame_thread_ctxt;
+    EbDecPicBuf *       pic_buf = dec_handle_ptr->cur_pic_buf[0];
+
+    /* svt_av1_dec_frame() only takes data with less than num_slots pictures
+       queued, and a temporal unit shows a single frame */
+    assert(ctxt->num_out_pics < DEC_OUT_QUEUE_SIZE);
+
+    DecOutputPic *out_pic =
+        &ctxt->out_pics[(ctxt->out_head + ctxt->num_out_pics) % DEC_OUT_QUEUE_SIZE];
+    out_pic->pic_buf = pic_buf;
+    dec_pic_mgr_add_ref(pic_buf);
+    out_pic->width             = dec_handle_ptr->frame_header.frame_size.superres_upscaled_width;
+    out_pic->height            = dec_handle_ptr->frame_header.frame_size.frame_height;
+    out_pic->film_grain_params = pic_buf->film_grain_params;
+
+    /* Ready once the latest job reconstructing the picture is completed */
+    out_pic->job_cnt = 0;
+    for (uint32_t job_num = ctxt->num_submitted; job_num != ctxt->num_reaped; job_num--) {
+        if (ctxt->jobs[(job_num - 1) % ctxt->num_slots].cur_pic_buf == pic_buf) {
+            out_pic->job_cnt = job_num;
+            break;
+        }
+    }
+    ctxt->num_out_pics++;
+}
+
+/* Pop the next output picture. The caller releases it once copied. */
+int dec_frame_thread_get_output(EbDecHandle *dec_handle_ptr, DecOutputPic *out_pic) {
+    DecFrameThreadCtxt *ctxt = (DecFrameThreadCtxt *)dec_handle_ptr->pv_frame_thread_ctxt;
+
+    if (ctxt == NULL || ctxt->num_out_pics == 0)
+        return 0;
+
+    DecOutputPic *head = &ctxt->out_pics[ctxt->out_head];
+    if (ctxt->num_completed < head->job_cnt) {
+        /* Let up to num_slots pictures be pending unless flushing or full */
+        if (!ctxt->flushing && ctxt->num_out_pics < ctxt->num_slots)
+            return 0;
+        DEC_FRAME_WAIT(ctxt, ctxt->num_completed >= head->job_cnt);
+    }
+    svt_memory_barrier();
+
+    *out_pic       = *head;
+    ctxt->out_head = (ctxt->out_head + 1) % DEC_OUT_QUEUE_SIZE;
+    ctxt->num_out_pics--;
+    return 1;
+}
+
+void dec_frame_thread_release_output(DecOutputPic *out_pic) {
+    dec_pic_mgr_release_pic(out_pic->pic_buf);
+    out_pic->pic_buf = NULL;
+}
+
+/* End of stream : make all the queued pictures available */
+void dec_frame_thread_flush(EbDecHandle *dec_handle_ptr) {
+    DecFrameThreadCtxt *ctxt = (DecFrameThreadCtxt *)dec_handle_ptr->pv_frame_thread_ctxt;
+
+    if (ctxt == NULL)
+        return;
+    drain_jobs(ctxt);
+    ctxt->flushing = EB_TRUE;
+}
+
+void dec_frame_thread_deinit(EbDecHandle *dec_handle_ptr) {
+    DecFrameThreadCtxt *ctxt = (DecFrameThreadCtxt *)dec_handle_ptr->pv_frame_thread_ctxt;
+
+    if (ctxt == NULL)
+        return;
+    ctxt->end_flag = EB_TRUE;
+    svt_notify_cond_var(&ctxt->progress_cond);
+    EB_DESTROY_THREAD(ctxt->frame_thread_handle);
+}
@@ -0,0 +1,113 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#ifndef EbDecFrameThread_h
+#define EbDecFrameThread_h
+
+#include "EbDecHandle.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Parse / reconstruction pipelining (num_p_frames > 1) :
+   The caller thread parses the headers and entropy decodes the tiles of
+   frame N + 1 while a dedicated reconstruction thread reconstructs and
+   post-filters frame N. Frames are reconstructed one at a time in decode
+   order, so every reference is complete before it is used for prediction,
+   and decoding never runs on more than these two threads: this is not
+   frame level parallelism, num_p_frames only sets how far parse may run
+   ahead of reconstruction. */
+
+/* Output queue entries, the queue takes no more data once num_p_frames
+   pictures are queued */
+#define DEC_OUT_QUEUE_SIZE (2 * DEC_MAX_NUM_FRM_PRLL)
+
+/* Frame level buffers written by parse and read by reconstruction */
+typedef struct DecFrameBufSet {
+    CurFrameBuf frame_buf;
+
+    /* SBInfo pointers and ModeInfo offsets for the entire frame */
+    SBInfo **  pps_sb_info;
+    uint16_t *p_mi_offset;
+} DecFrameBufSet;
+
+/* Snapshot of the parse state needed to reconstruct one frame */
+typedef struct DecFrameJob {
+    /* Index of the DecFrameBufSet holding the parsed frame */
+    uint32_t buf_set_idx;
+
+    EbDecPicBuf *cur_pic_buf;
+    EbDecPicBuf *ref_frame_map[REF_FRAMES];
+    int32_t      remapped_ref_idx[REF_FRAMES];
+
+    ScaleFactors ref_scale_factors[REF_FRAMES];
+    ScaleFactors sf_identity;
+
+    SeqHeader   seq_header;
+    FrameHeader frame_header;
+    Av1Common   cm;
+    uint8_t     is_lf_enabled;
+
+    EbWarpedMotionParams global_motion_warp[REF_FRAMES];
+} DecFrameJob;
+
+/* Picture waiting to be returned by svt_av1_dec_get_picture() */
+typedef struct DecOutputPic {
+    EbDecPicBuf *pic_buf;
+    /* The picture is ready once num_completed reaches job_cnt */
+    uint32_t     job_cnt;
+    uint32_t     width;
+    uint32_t     height;
+    AomFilmGrain film_grain_params;
+} DecOutputPic;
+
+typedef struct DecFrameThreadCtxt {
+    /* Internal handle used by the reconstruction thread */
+    EbDecHandle *recon_handle;
+
+    EbHandle frame_thread_handle;
+
+    /* Progress of the pipeline, published through progress_cond */
+    CondVar           progress_cond;
+    uint32_t          thread_spin_count;
+    volatile uint32_t num_submitted;
+    volatile uint32_t num_completed;
+    /* Jobs completed whose picture references are released */
+    uint32_t        num_reaped;
+    volatile EbBool end_flag;
+
+    /* One job slot and one buffer set per frame in flight */
+    uint32_t       num_slots;
+    DecFrameJob    jobs[DEC_MAX_NUM_FRM_PRLL];
+    DecFrameBufSet buf_sets[DEC_MAX_NUM_FRM_PRLL];
+
+    /* Output queue in display order */
+    DecOutputPic out_pics[DEC_OUT_QUEUE_SIZE];
+    uint32_t     out_head;
+    uint32_t     num_out_pics;
+    EbBool       flushing;
+} DecFrameThreadCtxt;
+
+EbErrorType  dec_frame_thread_init(EbDecHandle *dec_handle_ptr);
+EbErrorType  dec_frame_thread_submit(EbDecHandle *dec_handle_ptr);
+EbDecPicBuf *dec_frame_thread_get_cur_pic(EbDecHandle *dec_handle_ptr);
+EbBool       dec_frame_thread_output_full(EbDecHandle *dec_handle_ptr);
+void         dec_frame_thread_push_output(EbDecHandle *dec_handle_ptr);
+int          dec_frame_thread_get_output(EbDecHandle *dec_handle_ptr, DecOutputPic *out_pic);
+void         dec_frame_thread_release_output(DecOutputPic *out_pic);
+void         dec_frame_thread_flush(EbDecHandle *dec_handle_ptr);
+void         dec_frame_thread_deinit(EbDecHandle *dec_handle_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbDecFrameThread_h
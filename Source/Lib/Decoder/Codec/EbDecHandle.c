@@ -25,6 +25,7 @@
 #include "EbDecHandle.h"
 #include "EbDecMemInit.h"
 #include "EbDecPicMgr.h"
+#include "EbDecFrameThread.h"
 #include "grainSynthesis.h"
 #include "EbUtility.h"
 
@@ -142,24 +143,17 @@ static void copy_even(uint8_t *luma, uint32_t wd, uint32_t ht, uint32_t stride,
                    sizeof(*luma) * (wd << use_hbd));
     }
 }
-/* Copy from recon buffer to out buffer! */
-int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
-    EbPictureBufferDesc *recon_picture_buf = dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf;
+/* Copy a wd x ht picture from recon buffer to out buffer, applying the film grain */
+static int copy_out_pic(EbDecHandle *dec_handle_ptr, EbDecPicBuf *pic_buf, uint32_t wd,
+                        uint32_t ht, AomFilmGrain *film_grain_ptr, EbBufferHeaderType *p_buffer) {
+    EbPictureBufferDesc *recon_picture_buf = pic_buf->ps_pic_buf;
     EbSvtIOFormat *      out_img           = (EbSvtIOFormat *)p_buffer->p_buffer;
 
     uint8_t *luma = NULL;
     uint8_t *cb   = NULL;
     uint8_t *cr   = NULL;
 
-    /* TODO: Should add logic for show_existing_frame */
-    if (0 == dec_handle_ptr->show_frame) {
-        assert(0 == dec_handle_ptr->show_existing_frame);
-        return 0;
-    }
-
-    uint32_t wd = dec_handle_ptr->frame_header.frame_size.superres_upscaled_width;
-    uint32_t ht = dec_handle_ptr->frame_header.frame_size.frame_height;
-    int      sx = 0, sy = 0;
+    int sx = 0, sy = 0;
     /* FilmGrain module req. even dim. for internal operation */
     int even_w = (wd & 1) ? (wd + 1) : wd;
     int even_h = (ht & 1) ? (ht + 1) : ht;
@@ -383,7 +377,6 @@ int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
 
     if (!dec_handle_ptr->dec_config.skip_film_grain) {
         /* Need to fill the dst buf with recon data before calling film_grain */
-        AomFilmGrain *film_grain_ptr = &dec_handle_ptr->cur_pic_buf[0]->film_grain_params;
         if (film_grain_ptr->apply_grain) {
             switch (recon_picture_buf->bit_depth) {
             case EB_8BIT: film_grain_ptr->bit_depth = 8; break;
@@ -408,6 +401,22 @@ int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
     return 1;
 }
 
+/* Copy from recon buffer to out buffer! */
+int svt_dec_out_buf(EbDecHandle *dec_handle_ptr, EbBufferHeaderType *p_buffer) {
+    /* TODO: Should add logic for show_existing_frame */
+    if (0 == dec_handle_ptr->show_frame) {
+        assert(0 == dec_handle_ptr->show_existing_frame);
+        return 0;
+    }
+
+    return copy_out_pic(dec_handle_ptr,
+                        dec_handle_ptr->cur_pic_buf[0],
+                        dec_handle_ptr->frame_header.frame_size.superres_upscaled_width,
+                        dec_handle_ptr->frame_header.frame_size.frame_height,
+                        &dec_handle_ptr->cur_pic_buf[0]->film_grain_params,
+                        p_buffer);
+}
+
 /**********************************
 Set Default Library Params
 **********************************/
@@ -438,8 +447,10 @@ EbErrorType svt_svt_dec_set_default_parameter(EbSvtAv1DecConfiguration *config_p
     config_ptr->stat_report          = 0;
 
     /* Multi-thread parameters */
-    config_ptr->threads      = 1;
-    config_ptr->num_p_frames = 1;
+    config_ptr->threads           = 1;
+    config_ptr->num_p_frames      = 1;
+    config_ptr->thread_spin_count = 1000;
+    config_ptr->parse_only        = 0;
 
     return return_error;
 }
@@ -532,15 +543,32 @@ EB_API EbErrorType svt_av1_dec_init(EbComponentType *svt_dec_component) {
         return EB_ErrorBadParameter;
 
     EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
-#ifdef ARCH_X86_64
+#if defined(ARCH_X86_64) || defined(ARCH_AARCH64)
     CPU_FLAGS cpu_flags = get_cpu_flags_to_use();
 #else
     CPU_FLAGS cpu_flags = 0;
 #endif
     dec_handle_ptr->dec_cnt       = -1;
-    dec_handle_ptr->num_frms_prll = 1;
+    dec_handle_ptr->num_frms_prll = dec_handle_ptr->dec_config.num_p_frames > 1
+        ? (int32_t)dec_handle_ptr->dec_config.num_p_frames
+        : 1;
     if (dec_handle_ptr->num_frms_prll > DEC_MAX_NUM_FRM_PRLL)
         dec_handle_ptr->num_frms_prll = DEC_MAX_NUM_FRM_PRLL;
+    /* Parse and reconstruction are pipelined on two threads, the
+       tile / SB row level MT is not used on top of it */
+    if (dec_handle_ptr->num_frms_prll > 1 && dec_handle_ptr->dec_config.threads > 1) {
+        SVT_LOG("SVT [Warning]: parallel frames %d used with threads %u, setting threads to 1\n",
+                dec_handle_ptr->num_frms_prll,
+                dec_handle_ptr->dec_config.threads);
+        dec_handle_ptr->dec_config.threads = 1;
+    }
+    /* Parse only : the tiles are parsed by the main thread, nothing is
+       reconstructed */
+    if (dec_handle_ptr->dec_config.parse_only) {
+        dec_handle_ptr->num_frms_prll      = 1;
+        dec_handle_ptr->dec_config.threads = 1;
+    }
+    dec_handle_ptr->pv_frame_thread_ctxt = NULL;
     dec_handle_ptr->seq_header_done = 0;
     dec_handle_ptr->mem_init_done   = 0;
 
@@ -583,6 +611,15 @@ EB_API EbErrorType svt_av1_dec_frame(EbComponentType *svt_dec_component, const u
     uint8_t *    data_end             = (uint8_t *)data + data_size;
     dec_handle_ptr->seen_frame_header = 0;
 
+    /* No data : end of stream, the pictures still in flight become available */
+    if (data_size == 0) {
+        dec_frame_thread_flush(dec_handle_ptr);
+        return return_error;
+    }
+    /* Backpressure : the pictures queued must be retrieved first */
+    if (dec_handle_ptr->num_frms_prll > 1 && dec_frame_thread_output_full(dec_handle_ptr))
+        return EB_DecOutputQueueFull;
+
     while (data_start < data_end) {
         /*TODO : Remove or move. For Test purpose only */
         dec_handle_ptr->dec_cnt++;
@@ -629,6 +666,21 @@ EB_API EbErrorType svt_av1_dec_get_picture(EbComponentType *   svt_dec_component
         return EB_ErrorBadParameter;
 
     EbDecHandle *dec_handle_ptr = (EbDecHandle *)svt_dec_component->p_component_private;
+    if (dec_handle_ptr->dec_config.parse_only)
+        return EB_DecNoOutputPicture;
+    if (dec_handle_ptr->num_frms_prll > 1) {
+        DecOutputPic out_pic;
+        if (0 == dec_frame_thread_get_output(dec_handle_ptr, &out_pic))
+            return EB_DecNoOutputPicture;
+        copy_out_pic(dec_handle_ptr,
+                     out_pic.pic_buf,
+                     out_pic.width,
+                     out_pic.height,
+                     &out_pic.film_grain_params,
+                     p_buffer);
+        dec_frame_thread_release_output(&out_pic);
+        return return_error;
+    }
     /* Copy from recon pointer and return! TODO: Should remove the svt_memcpy! */
     if (0 == svt_dec_out_buf(dec_handle_ptr, p_buffer))
         return_error = EB_DecNoOutputPicture;
@@ -645,6 +697,8 @@ EB_API EbErrorType svt_av1_dec_deinit(EbComponentType *svt_dec_component) {
         return EB_ErrorNone;
     if (dec_handle_ptr->dec_config.threads > 1)
         dec_sync_all_threads(dec_handle_ptr);
+    if (dec_handle_ptr->num_frms_prll > 1)
+        dec_frame_thread_deinit(dec_handle_ptr);
     if (!svt_dec_memory_map)
         return EB_ErrorNone;
 
@@ -30,9 +30,10 @@ extern "C" {
 #define DEC_PAD_VALUE (DYNIMIC_PAD_VALUE + 8)
 
 /* Maximum number of frames in parallel */
-#define DEC_MAX_NUM_FRM_PRLL 1
-/** Maximum picture buffers needed **/
-#define MAX_PIC_BUFS (REF_FRAMES + 1 + DEC_MAX_NUM_FRM_PRLL)
+#define DEC_MAX_NUM_FRM_PRLL 8
+/** Maximum picture buffers needed : every in-flight frame and
+    every pending output can hold one picture besides the references **/
+#define MAX_PIC_BUFS (REF_FRAMES + 1 + 2 * DEC_MAX_NUM_FRM_PRLL)
 
 /** Picture Structure **/
 typedef struct EbDecPicBuf {
@@ -189,6 +190,9 @@ typedef struct EbDecHandle {
     /** Pointer to Picture manager structure **/
     void *pv_pic_mgr;
 
+    /* Frame parallel (parse / reconstruction pipelining) context */
+    void *pv_frame_thread_ctxt;
+
     // * 'remapped_ref_idx[i - 1]' maps reference type 'i' (range: LAST_FRAME ...
     // EXTREF_FRAME) to a remapped index 'j' (in range: 0 ... REF_FRAMES - 1)
     // * Later, 'cm->ref_frame_map[j]' maps the remapped index 'j' to a pointer to
@@ -242,7 +246,6 @@ typedef struct EbDecHandle {
     // Thread Handles
     EbHandle *            decode_thread_handle_array;
     EbBool                start_thread_process;
-    EbHandle              thread_semaphore;
     struct DecThreadCtxt *thread_ctxt_pa;
 
     EbBool
@@ -253,7 +256,6 @@ typedef struct EbDecHandle {
 typedef struct DecThreadCtxt {
     /* Unique ID for the thread */
     uint32_t thread_cnt;
-    EbHandle thread_semaphore;
     /* Pointer to the decode handle */
     EbDecHandle *dec_handle_ptr;
 
@@ -726,8 +726,9 @@ void dec_loop_filter_row(EbDecHandle *dec_handle_ptr, EbPictureBufferDesc *recon
 
         /* Top-Right Sync*/
         if (y_sb_index) {
-            while (*sb_lf_completed_in_prev_row < MIN((x_sb_index + 2), pic_width_in_sb - 1))
-                ;
+            DEC_MT_WAIT(dec_handle_ptr,
+                        *sb_lf_completed_in_prev_row >=
+                            MIN((x_sb_index + 2), pic_width_in_sb - 1));
         }
         /*LF function for a SB*/
         dec_loop_filter_sb(dec_handle_ptr,
@@ -744,6 +745,7 @@ void dec_loop_filter_row(EbDecHandle *dec_handle_ptr, EbPictureBufferDesc *recon
                            sb_info->sb_delta_lf);
         /* Update Top-Right Sync*/
         *sb_lf_completed_in_row = x_sb_index;
+        DEC_MT_NOTIFY(dec_handle_ptr);
     }
 }
 
@@ -32,6 +32,7 @@
 #include "EbDecInverseQuantize.h"
 
 #include "EbDecPicMgr.h"
+#include "EbDecFrameThread.h"
 #include "EbDecLF.h"
 
 #include "EbUtility.h"
@@ -137,7 +138,10 @@ static EbErrorType init_main_frame_ctxt(EbDecHandle  *dec_handle_ptr) {
     MainFrameBuf  *main_frame_buf = &dec_handle_ptr->main_frame_buf;
     SeqHeader   *seq_header = &dec_handle_ptr->seq_header;
 
-    EbBool is_st = dec_handle_ptr->dec_config.threads == 1 ? EB_TRUE : EB_FALSE;
+    /* SB sized coeff bufs are enough when each SB is reconstructed right after its parse */
+    EbBool is_st = (dec_handle_ptr->dec_config.threads == 1 &&
+        dec_handle_ptr->num_frms_prll == 1 &&
+        !dec_handle_ptr->dec_config.parse_only) ? EB_TRUE : EB_FALSE;
     ///* 8x8 alignment for various tools like CDEF */
     //int32_t aligned_width   = ALIGN_POWER_OF_TWO(seq_header->max_frame_width, 3);
     //int32_t aligned_height  = ALIGN_POWER_OF_TWO(seq_header->max_frame_height, 3);
@@ -397,7 +401,7 @@ EbErrorType init_dec_mod_ctxt(EbDecHandle  *dec_handle_ptr,
 }
 
 /*mem init function for LF params*/
-static EbErrorType init_lf_ctxt(EbDecHandle  *dec_handle_ptr) {
+EbErrorType init_lf_ctxt(EbDecHandle  *dec_handle_ptr) {
 
     EbErrorType return_error = EB_ErrorNone;
 
@@ -425,7 +429,7 @@ static EbErrorType init_lf_ctxt(EbDecHandle  *dec_handle_ptr) {
     return return_error;
 }
 
-static EbErrorType init_lr_ctxt(EbDecHandle  *dec_handle_ptr)
+EbErrorType init_lr_ctxt(EbDecHandle  *dec_handle_ptr)
 {
     EbErrorType return_error = EB_ErrorNone;
     EB_MALLOC_DEC(void *, dec_handle_ptr->pv_lr_ctxt, sizeof(LrCtxt), EB_N_PTR);
@@ -519,6 +523,10 @@ EbErrorType dec_mem_init(EbDecHandle  *dec_handle_ptr) {
     /* init frame buffers */
     return_error |= init_main_frame_ctxt(dec_handle_ptr);
 
+    /* init reconstruction thread of the frame parallel mode */
+    if (dec_handle_ptr->num_frms_prll > 1)
+        return_error |= dec_frame_thread_init(dec_handle_ptr);
+
     /* Initialize the references to NULL */
     for (int i = 0; i < REF_FRAMES; i++) {
         dec_handle_ptr->ref_frame_map[i] = NULL;
@@ -100,6 +100,10 @@ EbErrorType dec_mem_init(EbDecHandle *dec_handle_ptr);
 
 EbErrorType init_dec_mod_ctxt(EbDecHandle *dec_handle_ptr, void **dec_mod_ctxt);
 
+EbErrorType init_lf_ctxt(EbDecHandle *dec_handle_ptr);
+
+EbErrorType init_lr_ctxt(EbDecHandle *dec_handle_ptr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -986,9 +986,8 @@ void svt_setup_motion_field(EbDecHandle *dec_handle, DecThreadCtxt *thread_ctxt)
     if (is_mt) {
         volatile EbBool *start_motion_proj = &dec_mt_frame_data->start_motion_proj;
 
-        while (*start_motion_proj != EB_TRUE)
-            svt_block_on_semaphore(NULL == thread_ctxt ? dec_handle->thread_semaphore
-                                                       : thread_ctxt->thread_semaphore);
+        UNUSED(thread_ctxt);
+        DEC_MT_WAIT(dec_handle, *start_motion_proj == EB_TRUE);
 
         DecMtMotionProjInfo *motion_proj_info = &dec_mt_frame_data->motion_proj_info;
         do_memset                             = EB_FALSE;
@@ -1085,11 +1084,13 @@ void svt_setup_motion_field(EbDecHandle *dec_handle, DecThreadCtxt *thread_ctxt)
             dec_mt_frame_data->start_motion_proj = EB_FALSE;
         }
         svt_release_mutex(dec_mt_frame_data->temp_mutex);
+        DEC_MT_NOTIFY(dec_handle);
 
         volatile uint32_t *num_threads_header = &dec_mt_frame_data->num_threads_header;
-        while (*num_threads_header != dec_handle->dec_config.threads &&
-               (EB_FALSE == dec_mt_frame_data->end_flag))
-            ;
+        volatile EbBool *  end_flag           = &dec_mt_frame_data->end_flag;
+        DEC_MT_WAIT(dec_handle,
+                    *num_threads_header == dec_handle->dec_config.threads ||
+                        EB_FALSE != *end_flag);
     }
 }
 
@@ -178,6 +178,11 @@ EbErrorType parse_tile(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctx, TilesI
         set_default_sgrproj(&lr_unit[p]->sgrproj_info);
     }
 
+    /* In the frame parallel mode the SBs are reconstructed later
+       by the reconstruction thread, so the coeffs are kept for the frame */
+    int32_t is_inline_recon = !is_mt && dec_handle_ptr->num_frms_prll == 1 &&
+        !dec_handle_ptr->dec_config.parse_only;
+
     // to-do access to wiener info that is currently part of PartitionInfo
     int32_t sb_row_tile_start = 0;
     if (is_mt) {
@@ -197,7 +202,7 @@ EbErrorType parse_tile(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctx, TilesI
 
         /*TODO: Move CFL to thread ctxt! We need to access DecModCtxt
           from parse_tile function . Add tile level cfl init. */
-        if (!is_mt) {
+        if (is_inline_recon) {
             svt_cfl_init(&((DecModCtxt *)dec_handle_ptr->pv_dec_mod_ctxt)->cfl_ctx, color_config);
         }
 
@@ -228,7 +233,7 @@ EbErrorType parse_tile(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctx, TilesI
                 ((sb_row * num_mis_in_sb * main_frame_buf->sb_cols >> sy) +
                  (sb_col * num_mis_in_sb >> sx)) *
                     2;
-            if (dec_handle_ptr->dec_config.threads == 1) {
+            if (is_inline_recon) {
                 /*TODO : Change to macro */
                 sb_info->sb_coeff[AOM_PLANE_Y] = frame_buf->coeff[AOM_PLANE_Y];
                 sb_info->sb_coeff[AOM_PLANE_U] = frame_buf->coeff[AOM_PLANE_U];
@@ -272,7 +277,7 @@ EbErrorType parse_tile(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctx, TilesI
             // Bit-stream parsing of the superblock
             parse_super_block(dec_handle_ptr, parse_ctx, mi_row, mi_col, sb_info);
 
-            if (!is_mt) {
+            if (is_inline_recon) {
                 /* Init DecModCtxt */
                 DecModCtxt *dec_mod_ctxt = (DecModCtxt *)dec_handle_ptr->pv_dec_mod_ctxt;
                 dec_mod_ctxt->cur_coeff[AOM_PLANE_Y] = sb_info->sb_coeff[AOM_PLANE_Y];
@@ -293,6 +298,7 @@ EbErrorType parse_tile(EbDecHandle *dec_handle_ptr, ParseCtxt *parse_ctx, TilesI
             assert(sb_row >= sb_row_tile_start);
             dec_mt_frame_data->parse_recon_tile_info_array[tile_num]
                 .sb_recon_row_parsed[sb_row - sb_row_tile_start] = 1;
+            DEC_MT_NOTIFY(dec_handle_ptr);
         }
     }
 
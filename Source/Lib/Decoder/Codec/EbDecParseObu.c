@@ -20,6 +20,7 @@
 #include "EbObuParse.h"
 #include "EbDecMemInit.h"
 #include "EbDecPicMgr.h"
+#include "EbDecFrameThread.h"
 #include "EbDecRestoration.h"
 #include "EbDecParseObuUtil.h"
 #include "EbDecParseFrame.h"
@@ -1789,6 +1790,8 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
             dec_handle_ptr->show_existing_frame = frame_info->show_existing_frame;
             dec_handle_ptr->show_frame          = frame_info->show_frame;
             dec_handle_ptr->showable_frame      = frame_info->showable_frame;
+            if (dec_handle_ptr->num_frms_prll > 1)
+                dec_frame_thread_push_output(dec_handle_ptr);
             return;
         }
 
@@ -2043,7 +2046,9 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
              seq_header->color_config.subsampling_y == 0)
         dec_handle_ptr->dec_config.max_color_format = EB_YUV444;
 
-    dec_handle_ptr->cur_pic_buf[0] = dec_pic_mgr_get_cur_pic(dec_handle_ptr);
+    dec_handle_ptr->cur_pic_buf[0] = dec_handle_ptr->num_frms_prll > 1
+        ? dec_frame_thread_get_cur_pic(dec_handle_ptr)
+        : dec_pic_mgr_get_cur_pic(dec_handle_ptr);
 
     svt_setup_frame_buf_refs(dec_handle_ptr);
     /*Temporal MVs allocation */
@@ -2087,6 +2092,7 @@ void read_uncompressed_header(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuHeade
         if (EB_FALSE == dec_handle_ptr->start_thread_process) {
             dec_system_resource_init(dec_handle_ptr, &tiles_info);
             dec_handle_ptr->start_thread_process = EB_TRUE;
+            DEC_MT_NOTIFY(dec_handle_ptr);
         }
         check_mt_support(dec_handle_ptr);
     }
@@ -2204,6 +2210,86 @@ EbErrorType read_frame_header_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, ObuH
     return status;
 }
 
+/* Post processing of a reconstructed frame : LF, CDEF, SuperRes, LR and padding */
+void dec_post_process_frame(EbDecHandle *dec_handle_ptr) {
+    FrameHeader *frame_header = &dec_handle_ptr->frame_header;
+
+    uint32_t num_threads = dec_handle_ptr->dec_config.threads;
+    int      is_mt       = num_threads != 1;
+
+    /* PPF flags derivation */
+    EbBool no_ibc = !dec_handle_ptr->frame_header.allow_intrabc;
+    /* LF */
+    EbBool do_lf_flag = no_ibc &&
+        (dec_handle_ptr->frame_header.loop_filter_params.filter_level[0] ||
+         dec_handle_ptr->frame_header.loop_filter_params.filter_level[1]);
+    /* CDEF */
+    EbBool do_cdef = no_ibc &&
+        (!frame_header->coded_lossless &&
+         (frame_header->cdef_params.cdef_bits || frame_header->cdef_params.cdef_y_strength[0] ||
+          frame_header->cdef_params.cdef_uv_strength[0]));
+
+    EbBool do_upscale = no_ibc && !av1_superres_unscaled(&dec_handle_ptr->frame_header.frame_size);
+    /* LR */
+    //EbBool opt_lr = !do_cdef && !do_upscale;
+    LrParams *lr_param = dec_handle_ptr->frame_header.lr_params;
+    EbBool    do_lr    = no_ibc &&
+        (lr_param[AOM_PLANE_Y].frame_restoration_type != RESTORE_NONE ||
+         lr_param[AOM_PLANE_U].frame_restoration_type != RESTORE_NONE ||
+         lr_param[AOM_PLANE_V].frame_restoration_type != RESTORE_NONE);
+
+    if (is_mt) {
+        dec_av1_loop_filter_frame_mt(dec_handle_ptr,
+                                     dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf,
+                                     dec_handle_ptr->pv_lf_ctxt,
+                                     AOM_PLANE_Y,
+                                     MAX_MB_PLANE,
+                                     NULL);
+    } else {
+        dec_av1_loop_filter_frame(dec_handle_ptr,
+                                  dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf,
+                                  dec_handle_ptr->pv_lf_ctxt,
+                                  AOM_PLANE_Y,
+                                  MAX_MB_PLANE,
+                                  is_mt,
+                                  do_lf_flag);
+    }
+
+    if (!is_mt && do_lr)
+        dec_av1_loop_restoration_save_boundary_lines(dec_handle_ptr, 0);
+
+    if (is_mt) {
+        svt_cdef_frame_mt(dec_handle_ptr, NULL);
+    } else
+        svt_cdef_frame(dec_handle_ptr, do_cdef);
+
+    svt_av1_superres_upscale(&dec_handle_ptr->cm,
+                             &dec_handle_ptr->frame_header,
+                             &dec_handle_ptr->seq_header,
+                             dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf,
+                             do_upscale);
+
+    if (do_upscale)
+        dec_handle_ptr->cm.frm_size.frame_width =
+            dec_handle_ptr->frame_header.frame_size.frame_width;
+
+    if (do_lr && (!is_mt || do_upscale))
+        dec_av1_loop_restoration_save_boundary_lines(dec_handle_ptr, 1);
+
+    if (is_mt) {
+        if (do_upscale)
+            svt_av1_queue_lr_jobs(dec_handle_ptr);
+        dec_handle_ptr->main_frame_buf.cur_frame_bufs[0].dec_mt_frame_data.start_lr_frame = EB_TRUE;
+        DEC_MT_NOTIFY(dec_handle_ptr);
+        dec_av1_loop_restoration_filter_frame_mt(dec_handle_ptr, NULL);
+    } else
+        dec_av1_loop_restoration_filter_frame(dec_handle_ptr, 0, /*opt_lr*/ do_lr);
+
+    if (!is_mt) {
+        pad_pic(dec_handle_ptr);
+    }
+}
+
 // Read Tile group information
 EbErrorType read_tile_group_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, TilesInfo *tiles_info,
                                 ObuHeader *obu_header, int *is_last_tg) {
@@ -2273,26 +2359,8 @@ EbErrorType read_tile_group_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, TilesI
     uint32_t num_threads = dec_handle_ptr->dec_config.threads;
     int      is_mt       = num_threads != 1;
 
-    /* PPF flags derivation */
-    EbBool no_ibc = !dec_handle_ptr->frame_header.allow_intrabc;
-    /* LF */
-    EbBool do_lf_flag = no_ibc &&
-        (dec_handle_ptr->frame_header.loop_filter_params.filter_level[0] ||
-         dec_handle_ptr->frame_header.loop_filter_params.filter_level[1]);
-    /* CDEF */
-    EbBool do_cdef = no_ibc &&
-        (!frame_header->coded_lossless &&
-         (frame_header->cdef_params.cdef_bits || frame_header->cdef_params.cdef_y_strength[0] ||
-          frame_header->cdef_params.cdef_uv_strength[0]));
-
-    EbBool do_upscale = no_ibc && !av1_superres_unscaled(&dec_handle_ptr->frame_header.frame_size);
-    /* LR */
-    //EbBool opt_lr = !do_cdef && !do_upscale;
-    LrParams *lr_param = dec_handle_ptr->frame_header.lr_params;
-    EbBool    do_lr    = no_ibc &&
-        (lr_param[AOM_PLANE_Y].frame_restoration_type != RESTORE_NONE ||
-         lr_param[AOM_PLANE_U].frame_restoration_type != RESTORE_NONE ||
-         lr_param[AOM_PLANE_V].frame_restoration_type != RESTORE_NONE);
+    EbBool do_upscale = !dec_handle_ptr->frame_header.allow_intrabc &&
+        !av1_superres_unscaled(&dec_handle_ptr->frame_header.frame_size);
 
     /* Set Parse Jobs */
     if (is_mt) {
@@ -2335,9 +2403,7 @@ EbErrorType read_tile_group_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, TilesI
         svt_block_on_mutex(dec_mt_frame_data->temp_mutex);
         dec_mt_frame_data->start_motion_proj = EB_TRUE;
         svt_release_mutex(dec_mt_frame_data->temp_mutex);
-        svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-        for (uint32_t lib_thrd = 0; lib_thrd < num_threads - 1; lib_thrd++)
-            svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
+        DEC_MT_NOTIFY(dec_handle_ptr);
 
         svt_setup_motion_field(dec_handle_ptr, NULL);
 
@@ -2350,24 +2416,16 @@ EbErrorType read_tile_group_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, TilesI
         dec_mt_frame_data->num_threads_lred   = 0;
 
         svt_release_mutex(dec_mt_frame_data->temp_mutex);
-        svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-        for (uint32_t lib_thrd = 0; lib_thrd < num_threads - 1; lib_thrd++)
-            svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
+        DEC_MT_NOTIFY(dec_handle_ptr);
 
         svt_av1_queue_lf_jobs(dec_handle_ptr);
         svt_av1_queue_cdef_jobs(dec_handle_ptr);
         svt_block_on_mutex(dec_mt_frame_data->temp_mutex);
 
-        dec_mt_frame_data->start_lf_frame = EB_TRUE;
-        /*ToDo : Post outside mutex lock */
-        svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-        for (uint32_t lib_thrd = 0; lib_thrd < num_threads - 1; lib_thrd++)
-            svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
+        dec_mt_frame_data->start_lf_frame   = EB_TRUE;
         dec_mt_frame_data->start_cdef_frame = EB_TRUE;
-        svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-        for (uint32_t lib_thrd = 0; lib_thrd < num_threads - 1; lib_thrd++)
-            svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
         svt_release_mutex(dec_mt_frame_data->temp_mutex);
+        DEC_MT_NOTIFY(dec_handle_ptr);
 
         if (!do_upscale)
             svt_av1_queue_lr_jobs(dec_handle_ptr);
@@ -2405,62 +2463,19 @@ EbErrorType read_tile_group_obu(Bitstrm *bs, EbDecHandle *dec_handle_ptr, TilesI
     if ((tg_end + 1) != num_tiles)
         return 0;
 
-    if (is_mt) {
-        dec_av1_loop_filter_frame_mt(dec_handle_ptr,
-                                     dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf,
-                                     dec_handle_ptr->pv_lf_ctxt,
-                                     AOM_PLANE_Y,
-                                     MAX_MB_PLANE,
-                                     NULL);
-    } else {
-        dec_av1_loop_filter_frame(dec_handle_ptr,
-                                  dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf,
-                                  dec_handle_ptr->pv_lf_ctxt,
-                                  AOM_PLANE_Y,
-                                  MAX_MB_PLANE,
-                                  is_mt,
-                                  do_lf_flag);
-    }
-
-    if (!is_mt && do_lr)
-        dec_av1_loop_restoration_save_boundary_lines(dec_handle_ptr, 0);
-
-    if (is_mt) {
-        svt_cdef_frame_mt(dec_handle_ptr, NULL);
-    } else
-        svt_cdef_frame(dec_handle_ptr, do_cdef);
-
-    svt_av1_superres_upscale(&dec_handle_ptr->cm,
-                             &dec_handle_ptr->frame_header,
-                             &dec_handle_ptr->seq_header,
-                             dec_handle_ptr->cur_pic_buf[0]->ps_pic_buf,
-                             do_upscale);
-
-    if (do_upscale)
-        dec_handle_ptr->cm.frm_size.frame_width =
-            dec_handle_ptr->frame_header.frame_size.frame_width;
-
-    if (do_lr && (!is_mt || do_upscale))
-        dec_av1_loop_restoration_save_boundary_lines(dec_handle_ptr, 1);
-
-    if (is_mt) {
-        if (do_upscale)
-            svt_av1_queue_lr_jobs(dec_handle_ptr);
-        dec_handle_ptr->main_frame_buf.cur_frame_bufs[0].dec_mt_frame_data.start_lr_frame = EB_TRUE;
-        svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-        for (uint32_t lib_thrd = 0; lib_thrd < num_threads - 1; lib_thrd++)
-            svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
-        dec_av1_loop_restoration_filter_frame_mt(dec_handle_ptr, NULL);
-    } else
-        dec_av1_loop_restoration_filter_frame(dec_handle_ptr, 0, /*opt_lr*/ do_lr);
-
     /* Save CDF */
     if (frame_header->disable_frame_end_update_cdf)
         dec_handle_ptr->cur_pic_buf[0]->final_frm_ctx = main_parse_ctxt->init_frm_ctx;
 
-    if (!is_mt) {
-        pad_pic(dec_handle_ptr);
-    }
+    /* Parse only mode : no reconstruction nor post processing */
+    if (dec_handle_ptr->dec_config.parse_only)
+        return status;
+
+    /* Frame parallel mode : hand the parsed frame over to the reconstruction thread */
+    if (dec_handle_ptr->num_frms_prll > 1)
+        return dec_frame_thread_submit(dec_handle_ptr);
+
+    dec_post_process_frame(dec_handle_ptr);
 
     return status;
 }
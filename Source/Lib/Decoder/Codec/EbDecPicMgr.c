@@ -191,6 +191,14 @@ static INLINE void dec_ref_count_and_rel(EbDecPicBuf *ps_pic_buf) {
     }
 }
 
+/* Extra references held by frames in flight in the frame parallel mode */
+void dec_pic_mgr_add_ref(EbDecPicBuf *ps_pic_buf) {
+    if (ps_pic_buf != NULL)
+        ps_pic_buf->ref_count++;
+}
+
+void dec_pic_mgr_release_pic(EbDecPicBuf *ps_pic_buf) { dec_ref_count_and_rel(ps_pic_buf); }
+
 /**
 *******************************************************************************
 *
@@ -42,6 +42,9 @@ void dec_pic_mgr_update_ref_pic(EbDecHandle *dec_handle_ptr, int32_t frame_decod
 
 void generate_next_ref_frame_map(EbDecHandle *dec_handle_ptr);
 
+void dec_pic_mgr_add_ref(EbDecPicBuf *ps_pic_buf);
+void dec_pic_mgr_release_pic(EbDecPicBuf *ps_pic_buf);
+
 EbDecPicBuf *get_ref_frame_buf(EbDecHandle *dec_handle_ptr, const MvReferenceFrame ref_frame);
 void         svt_setup_frame_buf_refs(EbDecHandle *dec_handle_ptr);
 
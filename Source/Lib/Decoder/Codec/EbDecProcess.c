@@ -365,9 +365,9 @@ EbErrorType dec_system_resource_init(EbDecHandle *dec_handle_ptr, TilesInfo *til
     /* Use a scratch memory so that the memory allocated within
        init_dec_mod_ctxt reallocated when required */
 
-    DecModCtxt **dec_mod_ctxt_arr;
-    EB_MALLOC_DEC(
-        DecModCtxt **, dec_mod_ctxt_arr, num_lib_threads * sizeof(DecModCtxt *), EB_N_PTR);
+    DecModCtxt **dec_mod_ctxt_arr = (DecModCtxt **)malloc(num_lib_threads * sizeof(DecModCtxt *));
+    if (num_lib_threads && !dec_mod_ctxt_arr)
+        return EB_ErrorInsufficientResources;
 
     for (uint32_t i = 0; i < num_lib_threads; i++) {
         init_dec_mod_ctxt(dec_handle_ptr, (void **)&dec_mod_ctxt_arr[i]);
@@ -378,19 +378,19 @@ EbErrorType dec_system_resource_init(EbDecHandle *dec_handle_ptr, TilesInfo *til
     if (EB_FALSE == dec_handle_ptr->start_thread_process) {
         dec_mt_frame_data->end_flag           = EB_FALSE;
         dec_mt_frame_data->num_threads_exited = 0;
+        /* Created once: library threads may be sleeping on it across reallocations */
+        svt_create_cond_var(&dec_mt_frame_data->progress_cond);
 
         if (num_lib_threads > 0) {
             DecThreadCtxt *thread_ctxt_pa;
             EB_MALLOC_DEC(
                 DecThreadCtxt *, thread_ctxt_pa, num_lib_threads * sizeof(DecThreadCtxt), EB_N_PTR);
             dec_handle_ptr->thread_ctxt_pa = thread_ctxt_pa;
-            EB_CREATE_SEMAPHORE(dec_handle_ptr->thread_semaphore, 0, 100000);
 
             for (uint32_t i = 0; i < num_lib_threads; i++) {
                 thread_ctxt_pa[i].thread_cnt     = i + 1;
                 thread_ctxt_pa[i].dec_handle_ptr = dec_handle_ptr;
                 thread_ctxt_pa[i].dec_mod_ctxt   = dec_mod_ctxt_arr[i];
-                EB_CREATE_SEMAPHORE(thread_ctxt_pa[i].thread_semaphore, 0, 100000);
                 int use_highbd = (dec_handle_ptr->seq_header.color_config.bit_depth > EB_8BIT ||
                                   dec_handle_ptr->is_16bit_pipeline);
                 EB_MALLOC_DEC(uint8_t *,
@@ -484,9 +484,8 @@ void parse_frame_tiles(EbDecHandle *dec_handle_ptr, DecThreadCtxt *thread_ctxt)
     int               th_cnt = NULL == thread_ctxt ? 0 : thread_ctxt->thread_cnt;
     dec_timer_start(&timer);
 #endif
-    while (*start_parse_frame != EB_TRUE)
-        svt_block_on_semaphore(NULL == thread_ctxt ? dec_handle_ptr->thread_semaphore
-                                                   : thread_ctxt->thread_semaphore);
+    UNUSED(thread_ctxt);
+    DEC_MT_WAIT(dec_handle_ptr, *start_parse_frame == EB_TRUE);
 
 #if MT_WAIT_PROFILE
     dec_display_timer("SPF", &timer, th_cnt, fp);
@@ -498,15 +497,11 @@ void parse_frame_tiles(EbDecHandle *dec_handle_ptr, DecThreadCtxt *thread_ctxt)
         int32_t tile_num = get_sb_row_to_process(&dec_mt_frame_data->parse_tile_info);
         if (-1 != tile_num) {
             dec_mt_frame_data->start_decode_frame = EB_TRUE;
+            DEC_MT_NOTIFY(dec_handle_ptr);
             if (EB_ErrorNone != parse_tile_job(dec_handle_ptr, tile_num)) {
                 SVT_LOG("\nParse Issue for Tile %d", tile_num);
                 break;
             }
-            svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-            for (uint32_t lib_thrd = 0; lib_thrd < dec_handle_ptr->dec_config.threads - 1;
-                 lib_thrd++) {
-                svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
-            }
         } else
             break;
     }
@@ -528,9 +523,7 @@ void decode_frame_tiles(EbDecHandle *dec_handle_ptr, DecThreadCtxt *thread_ctxt)
     int               th_cnt = NULL == thread_ctxt ? 0 : thread_ctxt->thread_cnt;
     dec_timer_start(&timer);
 #endif
-    while (*start_decode_frame != EB_TRUE)
-        svt_block_on_semaphore(NULL == thread_ctxt ? dec_handle_ptr->thread_semaphore
-                                                   : thread_ctxt->thread_semaphore);
+    DEC_MT_WAIT(dec_handle_ptr, *start_decode_frame == EB_TRUE);
 
 #if MT_WAIT_PROFILE
     dec_display_timer("SDF", &timer, th_cnt, fp);
@@ -756,6 +749,18 @@ static INLINE void dec_save_CDEF_boundary_lines_SB_row(EbDecHandle *  dec_handle
     }
 }
 
+/* Check that all tile columns of the 3 SB rows in row_index are reconstructed */
+static EbBool sb_rows_recon_done(DecMtFrameData *dec_mt_frame_data, const int32_t *row_index,
+                                 int32_t tile_cols) {
+    volatile uint32_t *sb_recon_row_map = dec_mt_frame_data->sb_recon_row_map;
+    for (int i = 0; i < tile_cols; i++) {
+        if (!sb_recon_row_map[row_index[0] + i] || !sb_recon_row_map[row_index[1] + i] ||
+            !sb_recon_row_map[row_index[2] + i])
+            return EB_FALSE;
+    }
+    return EB_TRUE;
+}
+
 /*Frame level function to trigger loop filter for each superblock*/
 void dec_av1_loop_filter_frame_mt(EbDecHandle *dec_handle, EbPictureBufferDesc *recon_picture_buf,
                                   LfCtxt *lf_ctxt, int32_t plane_start, int32_t plane_end,
@@ -770,9 +775,8 @@ void dec_av1_loop_filter_frame_mt(EbDecHandle *dec_handle, EbPictureBufferDesc *
     int               th_cnt = NULL == thread_ctxt ? 0 : thread_ctxt->thread_cnt;
     dec_timer_start(&timer);
 #endif
-    while (*start_lf_frame != EB_TRUE)
-        svt_block_on_semaphore(NULL == thread_ctxt ? dec_handle->thread_semaphore
-                                                   : thread_ctxt->thread_semaphore);
+    UNUSED(thread_ctxt);
+    DEC_MT_WAIT(dec_handle, *start_lf_frame == EB_TRUE);
 #if MT_WAIT_PROFILE
     dec_display_timer("SLF", &timer, th_cnt, fp);
 #endif
@@ -838,7 +842,6 @@ void dec_av1_loop_filter_frame_mt(EbDecHandle *dec_handle, EbPictureBufferDesc *
             /* row-1 : To ensure line buf copy with TopR sync if LF skips row  */
             /* This prevent issues across Tiles where recon sync is not ensured*/
             /* row+1 : This is for CDEF actually, should be moved to CDEF stage*/
-            int32_t start_lf[3] = {0};
             int32_t row_index[3];
             row_index[0] = (sb_row)*tiles_info->tile_cols;
             row_index[1] = (sb_row - (sb_row == 0 ? 0 : 1)) * tiles_info->tile_cols;
@@ -847,16 +850,8 @@ void dec_av1_loop_filter_frame_mt(EbDecHandle *dec_handle, EbPictureBufferDesc *
 #if MT_WAIT_PROFILE
             dec_timer_start(&timer);
 #endif
-            while ((!start_lf[0]) || (!start_lf[1]) || (!start_lf[2])) {
-                start_lf[0] = 1;
-                start_lf[1] = 1;
-                start_lf[2] = 1;
-                for (int i = 0; i < tiles_info->tile_cols; i++) {
-                    start_lf[0] &= dec_mt_frame_data->sb_recon_row_map[row_index[0] + i];
-                    start_lf[1] &= dec_mt_frame_data->sb_recon_row_map[row_index[1] + i];
-                    start_lf[2] &= dec_mt_frame_data->sb_recon_row_map[row_index[2] + i];
-                }
-            }
+            DEC_MT_WAIT(dec_handle,
+                        sb_rows_recon_done(dec_mt_frame_data, row_index, tiles_info->tile_cols));
 #if MT_WAIT_PROFILE
             dec_display_timer("LFWR", &timer, th_cnt, fp);
 #endif
@@ -878,6 +873,7 @@ void dec_av1_loop_filter_frame_mt(EbDecHandle *dec_handle, EbPictureBufferDesc *
 
                 /* Update LF done map */
                 dec_mt_frame_data1->lf_row_map[sb_row - 1] = 1;
+                DEC_MT_NOTIFY(dec_handle);
             }
             if (sb_row == dec_mt_frame_data->sb_rows - 1) {
                 dec_save_lf_boundary_lines_sb_row(
@@ -885,6 +881,7 @@ void dec_av1_loop_filter_frame_mt(EbDecHandle *dec_handle, EbPictureBufferDesc *
 
                 /* Update LF done map */
                 dec_mt_frame_data1->lf_row_map[sb_row] = 1;
+                DEC_MT_NOTIFY(dec_handle);
             }
         } else
             break;
@@ -922,9 +919,8 @@ void svt_cdef_frame_mt(EbDecHandle *dec_handle_ptr, DecThreadCtxt *thread_ctxt)
     int               th_cnt = NULL == thread_ctxt ? 0 : thread_ctxt->thread_cnt;
     dec_timer_start(&timer);
 #endif
-    while (*start_cdef_frame != EB_TRUE)
-        svt_block_on_semaphore(NULL == thread_ctxt ? dec_handle_ptr->thread_semaphore
-                                                   : thread_ctxt->thread_semaphore);
+    UNUSED(thread_ctxt);
+    DEC_MT_WAIT(dec_handle_ptr, *start_cdef_frame == EB_TRUE);
 
 #if MT_WAIT_PROFILE
     dec_display_timer("SCF", &timer, th_cnt, fp);
@@ -1002,8 +998,7 @@ void svt_cdef_frame_mt(EbDecHandle *dec_handle_ptr, DecThreadCtxt *thread_ctxt)
 #endif
             volatile int32_t *start_cdef =
                 (volatile int32_t *)&dec_mt_frame_data->lf_row_map[sb_row + offset];
-            while (!*start_cdef)
-                ;
+            DEC_MT_WAIT(dec_handle_ptr, *start_cdef);
             assert(*start_cdef == 1);
 #if MT_WAIT_PROFILE
             dec_display_timer("CWLF", &timer, th_cnt, fp);
@@ -1044,6 +1039,7 @@ void svt_cdef_frame_mt(EbDecHandle *dec_handle_ptr, DecThreadCtxt *thread_ctxt)
             }
             /* Update CDEF done map */
             dec_mt_frame_data1->cdef_completed_for_row_map[sb_row] = 1;
+            DEC_MT_NOTIFY(dec_handle_ptr);
 
         } else
             break;
@@ -1058,10 +1054,10 @@ void svt_cdef_frame_mt(EbDecHandle *dec_handle_ptr, DecThreadCtxt *thread_ctxt)
     svt_block_on_mutex(dec_mt_frame_data->temp_mutex);
     dec_mt_frame_data->num_threads_cdefed++;
     svt_release_mutex(dec_mt_frame_data->temp_mutex);
+    DEC_MT_NOTIFY(dec_handle_ptr);
     if (do_upscale) {
         volatile uint32_t *num_threads_cdefed = &dec_mt_frame_data->num_threads_cdefed;
-        while (*num_threads_cdefed != dec_handle_ptr->dec_config.threads)
-            ;
+        DEC_MT_WAIT(dec_handle_ptr, *num_threads_cdefed == dec_handle_ptr->dec_config.threads);
     }
 }
 
@@ -1162,9 +1158,7 @@ void dec_av1_loop_restoration_filter_frame_mt(EbDecHandle *dec_handle, DecThread
     DecMtFrameData *dec_mt_frame_data =
         &dec_handle->main_frame_buf.cur_frame_bufs[0].dec_mt_frame_data;
     volatile EbBool *start_lr_frame = &dec_mt_frame_data->start_lr_frame;
-    while (*start_lr_frame != EB_TRUE)
-        svt_block_on_semaphore(NULL == thread_ctxt ? dec_handle->thread_semaphore
-                                                   : thread_ctxt->thread_semaphore);
+    DEC_MT_WAIT(dec_handle, *start_lr_frame == EB_TRUE);
 
     EbPictureBufferDesc *recon_picture_ptr = dec_handle->cur_pic_buf[0]->ps_pic_buf;
     const int32_t        num_planes        = av1_num_planes(&dec_handle->seq_header.color_config);
@@ -1228,8 +1222,7 @@ void dec_av1_loop_restoration_filter_frame_mt(EbDecHandle *dec_handle, DecThread
             /* Ensure all CDEF jobs are over for row_index row  */
             volatile int32_t *start_lr =
                 (volatile int32_t *)&dec_mt_frame_data->cdef_completed_for_row_map[sb_row];
-            while (!*start_lr)
-                ;
+            DEC_MT_WAIT(dec_handle, *start_lr);
 
             LrCtxt *lr_ctxt = (LrCtxt *)dec_handle->pv_lr_ctxt;
 
@@ -1304,11 +1297,12 @@ void dec_av1_loop_restoration_filter_frame_mt(EbDecHandle *dec_handle, DecThread
         dec_mt_frame_data->start_lr_frame     = EB_FALSE;
     }
     svt_release_mutex(dec_mt_frame_data->temp_mutex);
+    DEC_MT_NOTIFY(dec_handle);
 
     volatile uint32_t *num_threads_lred = &dec_mt_frame_data->num_threads_lred;
-    while (*num_threads_lred != dec_handle->dec_config.threads &&
-           EB_FALSE == dec_mt_frame_data->end_flag)
-        ;
+    volatile EbBool *  end_flag         = &dec_mt_frame_data->end_flag;
+    DEC_MT_WAIT(dec_handle,
+                *num_threads_lred == dec_handle->dec_config.threads || EB_FALSE != *end_flag);
 }
 
 void *dec_all_stage_kernel(void *input_ptr) {
@@ -1318,8 +1312,7 @@ void *dec_all_stage_kernel(void *input_ptr) {
     DecMtFrameData *dec_mt_frame_data =
         &dec_handle_ptr->main_frame_buf.cur_frame_bufs[0].dec_mt_frame_data;
     volatile EbBool *start_thread = (volatile EbBool *)&dec_handle_ptr->start_thread_process;
-    while (*start_thread == EB_FALSE)
-        ;
+    DEC_MT_WAIT(dec_handle_ptr, *start_thread != EB_FALSE);
 
     while (1) {
         /* Motion Field Projection */
@@ -1344,22 +1337,13 @@ void *dec_all_stage_kernel(void *input_ptr) {
             svt_block_on_mutex(dec_mt_frame_data->temp_mutex);
             dec_mt_frame_data->num_threads_exited++;
             svt_release_mutex(dec_mt_frame_data->temp_mutex);
+            DEC_MT_NOTIFY(dec_handle_ptr);
             break;
         }
     }
     return NULL;
 }
 
-static void svt_av1_sleep(const int milliseconds) {
-    if (!milliseconds)
-        return;
-#ifdef _WIN32
-    Sleep(milliseconds);
-#else
-    nanosleep(&(struct timespec){milliseconds / 1000, (milliseconds % 1000) * 1000000}, NULL);
-#endif
-}
-
 void dec_sync_all_threads(EbDecHandle *dec_handle_ptr) {
     DecMtFrameData *dec_mt_frame_data =
         &dec_handle_ptr->main_frame_buf.cur_frame_bufs[0].dec_mt_frame_data;
@@ -1374,29 +1358,15 @@ void dec_sync_all_threads(EbDecHandle *dec_handle_ptr) {
     dec_handle_ptr->frame_header.use_ref_frame_mvs = 0;
     dec_mt_frame_data->start_motion_proj           = EB_TRUE;
 
-    dec_mt_frame_data->start_parse_frame = EB_TRUE;
-    svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-    for (uint32_t lib_thrd = 0; lib_thrd < dec_handle_ptr->dec_config.threads - 1; lib_thrd++)
-        svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
+    dec_mt_frame_data->start_parse_frame  = EB_TRUE;
     dec_mt_frame_data->start_decode_frame = EB_TRUE;
-    svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-    for (uint32_t lib_thrd = 0; lib_thrd < dec_handle_ptr->dec_config.threads - 1; lib_thrd++)
-        svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
-    dec_mt_frame_data->start_lf_frame = EB_TRUE;
-    svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-    for (uint32_t lib_thrd = 0; lib_thrd < dec_handle_ptr->dec_config.threads - 1; lib_thrd++)
-        svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
-    dec_mt_frame_data->start_cdef_frame = EB_TRUE;
-    svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-    for (uint32_t lib_thrd = 0; lib_thrd < dec_handle_ptr->dec_config.threads - 1; lib_thrd++)
-        svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
-    dec_mt_frame_data->start_lr_frame = EB_TRUE;
-    svt_post_semaphore(dec_handle_ptr->thread_semaphore);
-    for (uint32_t lib_thrd = 0; lib_thrd < dec_handle_ptr->dec_config.threads - 1; lib_thrd++)
-        svt_post_semaphore(dec_handle_ptr->thread_ctxt_pa[lib_thrd].thread_semaphore);
-
-    while (dec_mt_frame_data->num_threads_exited != dec_handle_ptr->dec_config.threads - 1)
-        svt_av1_sleep(5);
+    dec_mt_frame_data->start_lf_frame     = EB_TRUE;
+    dec_mt_frame_data->start_cdef_frame   = EB_TRUE;
+    dec_mt_frame_data->start_lr_frame     = EB_TRUE;
+    DEC_MT_NOTIFY(dec_handle_ptr);
+
+    volatile uint32_t *num_threads_exited = &dec_mt_frame_data->num_threads_exited;
+    DEC_MT_WAIT(dec_handle_ptr, *num_threads_exited == dec_handle_ptr->dec_config.threads - 1);
 
     /*Destroying lib created thread's*/
     EB_DESTROY_THREAD_ARRAY(dec_handle_ptr->decode_thread_handle_array,
@@ -17,6 +17,7 @@ extern "C" {
 #endif
 #include "EbDefinitions.h"
 #include "EbSystemResourceManager.h"
+#include "EbThreads.h"
 
 #define MT_WAIT_PROFILE 0
 
@@ -182,6 +183,10 @@ typedef struct DecMTFrameData {
 
     EbHandle temp_mutex;
 
+    /* Signalled whenever a stage flag, a row map or an SB progress
+       counter is updated. Waiting threads spin first, then sleep on it */
+    CondVar progress_cond;
+
     TilesInfo *tiles_info;
 
     /* Motion Field Projection Info*/
@@ -246,6 +251,19 @@ typedef struct DecMTFrameData {
 #endif
 } DecMtFrameData;
 
+/* Wait until cond holds: poll it for dec_config.thread_spin_count
+   iterations, then block on the frame's progress condition variable */
+#define DEC_MT_WAIT(dec_handle, cond)                                                          \
+    SVT_SPIN_WAIT_COND_VAR(                                                                    \
+        &(dec_handle)->main_frame_buf.cur_frame_bufs[0].dec_mt_frame_data.progress_cond,      \
+        (dec_handle)->dec_config.thread_spin_count,                                            \
+        cond)
+
+/* Wake the threads sleeping in DEC_MT_WAIT after publishing progress */
+#define DEC_MT_NOTIFY(dec_handle) \
+    svt_notify_cond_var(          \
+        &(dec_handle)->main_frame_buf.cur_frame_bufs[0].dec_mt_frame_data.progress_cond)
+
 #ifdef __cplusplus
 }
 #endif
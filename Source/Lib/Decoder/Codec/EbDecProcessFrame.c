@@ -111,18 +111,19 @@ EbErrorType decode_tile_row(DecModCtxt *dec_mod_ctxt, TilesInfo *tile_info,
         dec_mod_ctxt->cur_coeff[AOM_PLANE_V] = sb_info->sb_coeff[AOM_PLANE_V];
         /* Top-Right Sync*/
         if (sb_row_in_tile) {
-            while (*sb_completed_in_prev_row < MIN((sb_col + 2), tile_wd_in_sb))
-                ;
-            //Sleep(5); /* ToDo : Change */
+            DEC_MT_WAIT(dec_handle_ptr,
+                        *sb_completed_in_prev_row >= MIN((sb_col + 2), tile_wd_in_sb));
         }
 
         decode_super_block(dec_mod_ctxt, mi_row, mi_col, sb_info);
         *sb_completed_in_row = (uint32_t)(sb_col + 1);
+        DEC_MT_NOTIFY(dec_handle_ptr);
     }
 
     DecMtFrameData *mt_frame_data = &frame_buf->dec_mt_frame_data;
     int             index         = mi_row / dec_mod_ctxt->seq_header->sb_mi_size;
     mt_frame_data->sb_recon_row_map[(index * tile_info->tile_cols) + tile_col] = 1;
+    DEC_MT_NOTIFY(dec_handle_ptr);
     return status;
 }
 EbErrorType decode_tile(DecModCtxt *dec_mod_ctxt, TilesInfo *tile_info,
@@ -153,8 +154,7 @@ EbErrorType decode_tile(DecModCtxt *dec_mod_ctxt, TilesInfo *tile_info,
         if (-1 != sb_row_in_tile) {
             volatile int32_t *sb_row_parsed = (volatile int32_t *)&parse_recon_tile_info_array
                                                   ->sb_recon_row_parsed[sb_row_in_tile];
-            while (0 == *sb_row_parsed)
-                ;
+            DEC_MT_WAIT((EbDecHandle *)dec_mod_ctxt->dec_handle_ptr, 0 != *sb_row_parsed);
 
             int32_t sb_row = sb_row_in_tile + sb_row_tile_start;
 
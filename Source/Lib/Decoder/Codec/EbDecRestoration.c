@@ -319,8 +319,7 @@ void dec_av1_loop_restoration_filter_row(EbDecHandle *dec_handle, int32_t sb_row
             if (sb_row) {
                 if (col_y >= tile_w_y - w_y)
                     nsync = 0;
-                while (*sb_lr_completed_in_prev_row < (sb_col_y + nsync))
-                    ;
+                DEC_MT_WAIT(dec_handle, *sb_lr_completed_in_prev_row >= (sb_col_y + nsync));
             }
         }
         int      sx = 0, sy = 0;
@@ -466,6 +465,7 @@ void dec_av1_loop_restoration_filter_row(EbDecHandle *dec_handle, int32_t sb_row
 
         if (is_mt) {
             *sb_lr_completed_in_row = sb_col_y;
+            DEC_MT_NOTIFY(dec_handle);
         }
     }
 }
@@ -81,28 +81,23 @@ EbErrorType copy_recon(SeqHeader *seq_hdr, EbPictureBufferDesc *recon_picture_sr
                     ? 2
                     : 1;
 
-    // Allocate the Picture Buffers (luma & chroma)
+    // Allocate the Picture Buffers (luma & chroma). Not tracked in the decoder
+    // memory map : freed after the upscale, possibly on a reconstruction thread.
     if (recon_picture_dst->buffer_enable_mask & PICTURE_BUFFER_DESC_Y_FLAG) {
-        EB_ALLIGN_MALLOC_DEC(EbByte,
-                             recon_picture_dst->buffer_y,
-                             recon_picture_dst->luma_size * bytes_per_pixel,
-                             EB_A_PTR);
+        EB_MALLOC_ALIGNED(recon_picture_dst->buffer_y,
+                          recon_picture_dst->luma_size * bytes_per_pixel);
         memset(recon_picture_dst->buffer_y, 0, recon_picture_dst->luma_size * bytes_per_pixel);
     } else
         recon_picture_dst->buffer_y = 0;
     if (recon_picture_dst->buffer_enable_mask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-        EB_ALLIGN_MALLOC_DEC(EbByte,
-                             recon_picture_dst->buffer_cb,
-                             recon_picture_dst->chroma_size * bytes_per_pixel,
-                             EB_A_PTR);
+        EB_MALLOC_ALIGNED(recon_picture_dst->buffer_cb,
+                          recon_picture_dst->chroma_size * bytes_per_pixel);
         memset(recon_picture_dst->buffer_cb, 0, recon_picture_dst->chroma_size * bytes_per_pixel);
     } else
         recon_picture_dst->buffer_cb = 0;
     if (recon_picture_dst->buffer_enable_mask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-        EB_ALLIGN_MALLOC_DEC(EbByte,
-                             recon_picture_dst->buffer_cr,
-                             recon_picture_dst->chroma_size * bytes_per_pixel,
-                             EB_A_PTR);
+        EB_MALLOC_ALIGNED(recon_picture_dst->buffer_cr,
+                          recon_picture_dst->chroma_size * bytes_per_pixel);
         memset(recon_picture_dst->buffer_cr, 0, recon_picture_dst->chroma_size * bytes_per_pixel);
     } else
         recon_picture_dst->buffer_cr = 0;
@@ -168,4 +163,13 @@ void svt_av1_superres_upscale(Av1Common *cm, FrameHeader *frm_hdr, SeqHeader *se
 
     av1_upscale_normative_and_extend_frame(
         cm, frm_hdr, seq_hdr, ps_recon_pic_temp, recon_picture_src);
+
+    if (ps_recon_pic_temp) {
+        if (ps_recon_pic_temp->buffer_y)
+            EB_FREE_ALIGNED(ps_recon_pic_temp->buffer_y);
+        if (ps_recon_pic_temp->buffer_cb)
+            EB_FREE_ALIGNED(ps_recon_pic_temp->buffer_cb);
+        if (ps_recon_pic_temp->buffer_cr)
+            EB_FREE_ALIGNED(ps_recon_pic_temp->buffer_cr);
+    }
 }
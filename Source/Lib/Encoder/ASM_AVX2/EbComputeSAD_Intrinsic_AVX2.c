@@ -3007,6 +3007,143 @@ void svt_sad_loop_kernel_avx2_intrin(
     *y_search_center = y_best;
 }
 
+/*******************************************************************************
+* Full pel search of a 16xh block in one search area, the pairs of source rows
+* are preloaded in src01[] by the caller
+* Requirement: width = 16
+* Requirement: block_height <= 16
+*******************************************************************************/
+static AOM_FORCE_INLINE void sad_loop_kernel_16xh_preloaded_avx2(const __m256i *const src01,
+                                                       const uint32_t      block_height,
+                                                       SadLoopSearchArea *const area) {
+    const uint8_t *ref        = area->ref;
+    const uint32_t ref_stride = area->ref_stride;
+    const __m128i  idx        = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+    uint32_t       low_sum    = 0xffffff;
+    int16_t        x_best = 0, y_best = 0;
+
+    for (int16_t i = 0; i < area->height; i++) {
+        for (int16_t j = 0; j < area->width; j += 8) {
+            const uint8_t *p_ref = ref + j;
+            __m256i        sum0  = _mm256_setzero_si256();
+            __m256i        sum1  = _mm256_setzero_si256();
+            __m256i        sum2  = _mm256_setzero_si256();
+            __m256i        sum3  = _mm256_setzero_si256();
+            uint32_t       k;
+
+            for (k = 0; k + 2 <= block_height; k += 2) {
+                const __m256i rr0 = _mm256_insertf128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128((__m128i *)p_ref)),
+                    _mm_loadu_si128((__m128i *)(p_ref + ref_stride)),
+                    0x1);
+                const __m256i rr1 = _mm256_insertf128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(p_ref + 8))),
+                    _mm_loadu_si128((__m128i *)(p_ref + ref_stride + 8)),
+                    0x1);
+                sum0 = _mm256_adds_epu16(sum0, _mm256_mpsadbw_epu8(rr0, src01[k >> 1], 0));
+                sum1 = _mm256_adds_epu16(sum1, _mm256_mpsadbw_epu8(rr0, src01[k >> 1], 45));
+                sum2 = _mm256_adds_epu16(sum2, _mm256_mpsadbw_epu8(rr1, src01[k >> 1], 18));
+                sum3 = _mm256_adds_epu16(sum3, _mm256_mpsadbw_epu8(rr1, src01[k >> 1], 63));
+                p_ref += 2 * ref_stride;
+            }
+
+            if (k < block_height) {
+                // the upper lane of the last source pair is zero
+                const __m256i rr0 = _mm256_insertf128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128((__m128i *)p_ref)),
+                    _mm_setzero_si128(),
+                    0x1);
+                const __m256i rr1 = _mm256_insertf128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(p_ref + 8))),
+                    _mm_setzero_si128(),
+                    0x1);
+                sum0 = _mm256_adds_epu16(sum0, _mm256_mpsadbw_epu8(rr0, src01[k >> 1], 0));
+                sum1 = _mm256_adds_epu16(sum1, _mm256_mpsadbw_epu8(rr0, src01[k >> 1], 45));
+                sum2 = _mm256_adds_epu16(sum2, _mm256_mpsadbw_epu8(rr1, src01[k >> 1], 18));
+                sum3 = _mm256_adds_epu16(sum3, _mm256_mpsadbw_epu8(rr1, src01[k >> 1], 63));
+            }
+
+            sum0      = _mm256_adds_epu16(_mm256_adds_epu16(sum0, sum1),
+                                     _mm256_adds_epu16(sum2, sum3));
+            __m128i s = _mm_adds_epu16(_mm256_castsi256_si128(sum0),
+                                       _mm256_extracti128_si256(sum0, 1));
+            if (area->width - j < 8)
+                s = _mm_or_si128(s, _mm_cmpgt_epi16(idx, _mm_set1_epi16(area->width - j - 1)));
+            s                  = _mm_minpos_epu16(s);
+            const uint32_t sad = _mm_extract_epi16(s, 0);
+            if (sad < low_sum) {
+                low_sum = sad;
+                x_best  = (int16_t)(j + _mm_extract_epi16(s, 1));
+                y_best  = i;
+            }
+        }
+        ref += area->ref_stride_raw;
+    }
+
+    area->best_sad = low_sum;
+    area->x_best   = x_best;
+    area->y_best   = y_best;
+}
+
+/*******************************************************************************
+* Full pel search of one source block in several search areas. The 16xh blocks
+* of the HME level 0 keep the source in registers across the search areas,
+* the other sizes use svt_sad_loop_kernel_avx2_intrin() for each area: the row
+* pairs of the 32xh and 64xh blocks of the HME levels 1 and 2 take up to 32 and
+* 128 registers, which do not fit in the 16 ymm registers.
+* The search is bound by the mpsadbw throughput, so the preloaded source only
+* saves the reloads of the source rows (about 8% of the level 0 search).
+*******************************************************************************/
+void svt_sad_loop_kernel_multi_avx2_intrin(uint8_t *src, uint32_t src_stride,
+                                           uint32_t block_height, uint32_t block_width,
+                                           SadLoopSearchArea *search_areas,
+                                           uint32_t           num_search_areas) {
+    if (block_width == 16 && block_height <= 16) {
+        __m256i src01[8];
+
+        for (uint32_t k = 0; k < block_height; k += 2) {
+            const __m128i s1 = (k + 1 < block_height)
+                ? _mm_loadu_si128((__m128i *)(src + (k + 1) * src_stride))
+                : _mm_setzero_si128();
+            src01[k >> 1] = _mm256_insertf128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(src + k * src_stride))),
+                s1,
+                0x1);
+        }
+
+        // constant heights of the sixteenth resolution SB with the full and the
+        // sub-sampled search let the rows loop unroll
+        for (uint32_t i = 0; i < num_search_areas; i++) {
+            if (block_height == 16)
+                sad_loop_kernel_16xh_preloaded_avx2(src01, 16, &search_areas[i]);
+            else if (block_height == 8)
+                sad_loop_kernel_16xh_preloaded_avx2(src01, 8, &search_areas[i]);
+            else
+                sad_loop_kernel_16xh_preloaded_avx2(src01, block_height, &search_areas[i]);
+        }
+        return;
+    }
+
+    for (uint32_t i = 0; i < num_search_areas; i++) {
+        SadLoopSearchArea *const area = &search_areas[i];
+
+        area->x_best = 0;
+        area->y_best = 0;
+        svt_sad_loop_kernel_avx2_intrin(src,
+                                        src_stride,
+                                        area->ref,
+                                        area->ref_stride,
+                                        block_height,
+                                        block_width,
+                                        &area->best_sad,
+                                        &area->x_best,
+                                        &area->y_best,
+                                        area->ref_stride_raw,
+                                        area->width,
+                                        area->height);
+    }
+}
+
 /*******************************************************************************
 * Requirement: height % 4 = 0
 *******************************************************************************/
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <immintrin.h>
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+// Circle of 16 pixels of radius 3 around the tested pixel, as (x, y) in ring order.
+static const int circle[16][2] = {{0, 3},
+                                  {1, 3},
+                                  {2, 2},
+                                  {3, 1},
+                                  {3, 0},
+                                  {3, -1},
+                                  {2, -2},
+                                  {1, -3},
+                                  {0, -3},
+                                  {-1, -3},
+                                  {-2, -2},
+                                  {-3, -1},
+                                  {-3, 0},
+                                  {-3, 1},
+                                  {-2, 2},
+                                  {-1, 3}};
+
+// Largest minimum of the saturated differences d[] over an arc of 9 contiguous
+// pixels, built from the minimums over arcs of 2, 4 and 8 pixels.
+static INLINE __m256i arc_strength_avx2(const __m256i *d) {
+    __m256i m2[16], m4[16];
+    __m256i strength = _mm256_setzero_si256();
+    for (int i = 0; i < 16; i++) m2[i] = _mm256_min_epu8(d[i], d[(i + 1) & 15]);
+    for (int i = 0; i < 16; i++) m4[i] = _mm256_min_epu8(m2[i], m2[(i + 2) & 15]);
+    for (int i = 0; i < 16; i++) {
+        const __m256i m8 = _mm256_min_epu8(m4[i], m4[(i + 4) & 15]);
+        strength         = _mm256_max_epu8(strength, _mm256_min_epu8(m8, d[(i + 8) & 15]));
+    }
+    return strength;
+}
+
+// Nonzero in the pixels where both differences are above the threshold.
+static INLINE __m256i both_above(const __m256i d0, const __m256i d1, const __m256i thresh) {
+    return _mm256_min_epu8(_mm256_subs_epu8(d0, thresh), _mm256_subs_epu8(d1, thresh));
+}
+
+// Appends the corners among the 32 pixels at p whose bit is set in keep.
+static INLINE int fast9_detect_32_avx2(const uint8_t *p, const int *offset, const __m256i thresh,
+                                       uint32_t keep, int x, int *corner_x, uint8_t *strength) {
+    const __m256i c = _mm256_loadu_si256((const __m256i *)p);
+    __m256i       bright[16], dark[16], v;
+    DECLARE_ALIGNED(32, uint8_t, s[32]);
+
+    // An arc of 9 pixels always covers two consecutive compass points, which
+    // rejects most pixels before the full circle is loaded.
+    for (int k = 0; k < 16; k += 4) {
+        v         = _mm256_loadu_si256((const __m256i *)(p + offset[k]));
+        bright[k] = _mm256_subs_epu8(v, c);
+        dark[k]   = _mm256_subs_epu8(c, v);
+    }
+    __m256i candidate = _mm256_setzero_si256();
+    for (int k = 0; k < 16; k += 4) {
+        candidate = _mm256_or_si256(candidate,
+                                    both_above(bright[k], bright[(k + 4) & 15], thresh));
+        candidate = _mm256_or_si256(candidate, both_above(dark[k], dark[(k + 4) & 15], thresh));
+    }
+    if (_mm256_testz_si256(candidate, candidate))
+        return 0;
+
+    for (int k = 0; k < 16; k++) {
+        if (!(k & 3))
+            continue;
+        v         = _mm256_loadu_si256((const __m256i *)(p + offset[k]));
+        bright[k] = _mm256_subs_epu8(v, c);
+        dark[k]   = _mm256_subs_epu8(c, v);
+    }
+    const __m256i strength_32   = _mm256_max_epu8(arc_strength_avx2(bright),
+                                                arc_strength_avx2(dark));
+    const __m256i is_not_corner = _mm256_cmpeq_epi8(_mm256_subs_epu8(strength_32, thresh),
+                                                    _mm256_setzero_si256());
+
+    uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(is_not_corner) & keep;
+    int      num  = 0;
+
+    _mm256_store_si256((__m256i *)s, strength_32);
+    for (int j = 0; mask; j++, mask >>= 1) {
+        if (!(mask & 1))
+            continue;
+        corner_x[num]   = x + j;
+        strength[num++] = s[j];
+    }
+    return num;
+}
+
+int svt_av1_fast9_detect_row_avx2(const uint8_t *src, int stride, int width, int b, int *corner_x,
+                                  uint8_t *strength) {
+    int offset[16];
+    int num_corners = 0;
+    int x;
+
+    if (width < 32 || b < 0 || b > 255)
+        return svt_av1_fast9_detect_row_c(src, stride, width, b, corner_x, strength);
+
+    for (int k = 0; k < 16; k++) offset[k] = circle[k][1] * stride + circle[k][0];
+    const __m256i thresh = _mm256_set1_epi8((char)b);
+
+    for (x = 0; x + 32 <= width; x += 32) {
+        num_corners += fast9_detect_32_avx2(src + x,
+                                            offset,
+                                            thresh,
+                                            0xffffffff,
+                                            x,
+                                            corner_x + num_corners,
+                                            strength + num_corners);
+    }
+    // The last pixels are tested in an overlapping block, which does not read
+    // beyond the circles of the row, keeping only the pixels not tested yet.
+    if (x < width) {
+        num_corners += fast9_detect_32_avx2(src + width - 32,
+                                            offset,
+                                            thresh,
+                                            0xffffffff << (32 - (width - x)),
+                                            width - 32,
+                                            corner_x + num_corners,
+                                            strength + num_corners);
+    }
+    return num_corners;
+}
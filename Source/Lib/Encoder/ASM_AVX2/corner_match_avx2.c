@@ -73,3 +73,59 @@ double svt_av1_compute_cross_correlation_avx2(unsigned char *im1, int stride1, i
     aom_clear_system_state();
     return cov / sqrt((double)var2);
 }
+
+/* Batched version of svt_av1_compute_cross_correlation_avx2(). The rows of the
+window of im1 and their sum are loaded once and reused for every window of im2.
+*/
+void svt_av1_compute_cross_correlation_multi_avx2(unsigned char *im1, int stride1, int x1, int y1,
+                                                  unsigned char *im2, int stride2,
+                                                  const int *points2, int num_points,
+                                                  double *corr) {
+    const __m128i mask = _mm_loadu_si128((__m128i *)byte_mask);
+    const __m128i zero = _mm_setzero_si128();
+    __m256i       v1[MATCH_SZ];
+    __m128i       sum1_vec = zero;
+
+    im1 += (y1 - MATCH_SZ_BY2) * stride1 + (x1 - MATCH_SZ_BY2);
+    for (int i = 0; i < MATCH_SZ; ++i) {
+        const __m128i v = _mm_and_si128(_mm_loadu_si128((__m128i *)&im1[i * stride1]), mask);
+        v1[i]           = _mm256_cvtepu8_epi16(v);
+        sum1_vec        = _mm_add_epi32(sum1_vec, _mm_sad_epu8(v, zero));
+    }
+    const int sum1_acc = _mm_cvtsi128_si32(_mm_add_epi32(sum1_vec, _mm_srli_si128(sum1_vec, 8)));
+
+    for (int n = 0; n < num_points; ++n) {
+        const unsigned char *src2 = im2 + (points2[2 * n + 1] - MATCH_SZ_BY2) * stride2 +
+            (points2[2 * n] - MATCH_SZ_BY2);
+        __m256i sumsq2_vec = _mm256_setzero_si256();
+        __m256i cross_vec  = _mm256_setzero_si256();
+        __m128i sum2_vec   = zero;
+
+        for (int i = 0; i < MATCH_SZ; ++i) {
+            const __m128i v2   = _mm_and_si128(_mm_loadu_si128((__m128i *)src2), mask);
+            const __m256i v2_1 = _mm256_cvtepu8_epi16(v2);
+            sumsq2_vec         = _mm256_add_epi32(sumsq2_vec, _mm256_madd_epi16(v2_1, v2_1));
+            cross_vec          = _mm256_add_epi32(cross_vec, _mm256_madd_epi16(v1[i], v2_1));
+            sum2_vec           = _mm_add_epi32(sum2_vec, _mm_sad_epu8(v2, zero));
+            src2 += stride2;
+        }
+        const int sum2_acc = _mm_cvtsi128_si32(
+            _mm_add_epi32(sum2_vec, _mm_srli_si128(sum2_vec, 8)));
+
+        const __m256i unp_low = _mm256_unpacklo_epi64(sumsq2_vec, cross_vec);
+        const __m256i unp_hig = _mm256_unpackhi_epi64(sumsq2_vec, cross_vec);
+        const __m256i temp1   = _mm256_add_epi32(unp_low, unp_hig);
+
+        __m128i low_sumsq = _mm256_castsi256_si128(temp1);
+        low_sumsq         = _mm_add_epi32(low_sumsq, _mm256_extractf128_si256(temp1, 1));
+        low_sumsq         = _mm_add_epi32(low_sumsq, _mm_srli_epi64(low_sumsq, 32));
+
+        const int sumsq2_acc = _mm_cvtsi128_si32(low_sumsq);
+        const int cross_acc  = _mm_extract_epi32(low_sumsq, 2);
+
+        const int var2 = sumsq2_acc * MATCH_SZ_SQ - sum2_acc * sum2_acc;
+        const int cov  = cross_acc * MATCH_SZ_SQ - sum1_acc * sum2_acc;
+        corr[n]        = cov / sqrt((double)var2);
+    }
+    aom_clear_system_state();
+}
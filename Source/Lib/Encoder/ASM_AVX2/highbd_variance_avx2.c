@@ -144,6 +144,74 @@ VAR_FN(64, 16, 16, 10);
 
 #undef VAR_FN
 
+static INLINE __m256i load_4x4_avx2(const uint16_t *p, int stride) {
+    const __m128i lo = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)p),
+                                          _mm_loadl_epi64((const __m128i *)(p + stride)));
+    const __m128i hi = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(p + 2 * stride)),
+                                          _mm_loadl_epi64((const __m128i *)(p + 3 * stride)));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+static INLINE __m256i load_8x2_avx2(const uint16_t *p, int stride) {
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)p)),
+                                   _mm_loadu_si128((const __m128i *)(p + stride)),
+                                   1);
+}
+
+/*
+* Sum and sum of square differences of the 4xh and 8x4 blocks, 4 rows of 4 or
+* 2 rows of 8 samples per iteration.
+*/
+static void highbd_calc_small_var_avx2(const uint16_t *src, int src_stride, const uint16_t *ref,
+                                       int ref_stride, int w, int h, uint32_t *sse, int *sum) {
+    const __m256i one     = _mm256_set1_epi16(1);
+    __m256i       v_sum_d = _mm256_setzero_si256();
+    __m256i       v_sse_d = _mm256_setzero_si256();
+    const int     rows    = w == 4 ? 4 : 2;
+
+    for (int i = 0; i < h; i += rows) {
+        const __m256i v_p_a  = w == 4 ? load_4x4_avx2(src, src_stride)
+                                      : load_8x2_avx2(src, src_stride);
+        const __m256i v_p_b  = w == 4 ? load_4x4_avx2(ref, ref_stride)
+                                      : load_8x2_avx2(ref, ref_stride);
+        const __m256i v_diff = _mm256_sub_epi16(v_p_a, v_p_b);
+        v_sum_d              = _mm256_add_epi32(v_sum_d, _mm256_madd_epi16(v_diff, one));
+        v_sse_d              = _mm256_add_epi32(v_sse_d, _mm256_madd_epi16(v_diff, v_diff));
+        src += rows * src_stride;
+        ref += rows * ref_stride;
+    }
+    __m256i       v_d_l  = _mm256_unpacklo_epi32(v_sum_d, v_sse_d);
+    __m256i       v_d_h  = _mm256_unpackhi_epi32(v_sum_d, v_sse_d);
+    __m256i       v_d_lh = _mm256_add_epi32(v_d_l, v_d_h);
+    const __m128i v_d0_d = _mm256_castsi256_si128(v_d_lh);
+    const __m128i v_d1_d = _mm256_extracti128_si256(v_d_lh, 1);
+    __m128i       v_d    = _mm_add_epi32(v_d0_d, v_d1_d);
+    v_d                  = _mm_add_epi32(v_d, _mm_srli_si128(v_d, 8));
+    *sum                 = _mm_extract_epi32(v_d, 0);
+    *sse                 = _mm_extract_epi32(v_d, 1);
+}
+
+#define VAR_FN_SMALL(w, h, shift)                                                                  \
+    uint32_t svt_aom_highbd_10_variance##w##x##h##_avx2(                                           \
+        const uint8_t *src8, int src_stride, const uint8_t *ref8, int ref_stride, uint32_t *sse) { \
+        int       sum;                                                                             \
+        int64_t   var;                                                                             \
+        uint16_t *src = CONVERT_TO_SHORTPTR(src8);                                                 \
+        uint16_t *ref = CONVERT_TO_SHORTPTR(ref8);                                                 \
+        highbd_calc_small_var_avx2(src, src_stride, ref, ref_stride, w, h, sse, &sum);             \
+        sum  = ROUND_POWER_OF_TWO(sum, 2);                                                         \
+        *sse = ROUND_POWER_OF_TWO(*sse, 4);                                                        \
+        var  = (int64_t)(*sse) - (((int64_t)sum * sum) >> shift);                                  \
+        return (var >= 0) ? (uint32_t)var : 0;                                                     \
+    }
+
+VAR_FN_SMALL(4, 4, 4);
+VAR_FN_SMALL(4, 8, 5);
+VAR_FN_SMALL(4, 16, 6);
+VAR_FN_SMALL(8, 4, 5);
+
+#undef VAR_FN_SMALL
+
 /*
 * Compute variance for 16bit input, only for blocks 32x32
 * This kernel is only used by variance_highbd_avx2()
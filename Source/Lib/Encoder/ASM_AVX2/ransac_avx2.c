@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <immintrin.h>
+#include <math.h>
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+// Splits 4 interleaved (x, y) points into their x and y coordinates.
+static INLINE void load_points_4(const double *pts, __m256d *x, __m256d *y) {
+    const __m256d p01 = _mm256_loadu_pd(pts);
+    const __m256d p23 = _mm256_loadu_pd(pts + 4);
+    // x0 x2 x1 x3 and y0 y2 y1 y3, then back to point order
+    *x = _mm256_permute4x64_pd(_mm256_unpacklo_pd(p01, p23), 0xd8);
+    *y = _mm256_permute4x64_pd(_mm256_unpackhi_pd(p01, p23), 0xd8);
+}
+
+// The distances of 4 points at a time are computed with the same operations,
+// in the same order, as the C code, and the inliers are then accumulated one by
+// one so that the sums match it bit for bit.
+int svt_av1_ransac_find_inliers_avx2(const double *mat, const double *corners1,
+                                     const double *corners2, int npoints, double threshold,
+                                     int *inlier_indices, double *sum_distance,
+                                     double *sum_distance_squared) {
+    const __m256d m0  = _mm256_set1_pd(mat[0]);
+    const __m256d m1  = _mm256_set1_pd(mat[1]);
+    const __m256d m2  = _mm256_set1_pd(mat[2]);
+    const __m256d m3  = _mm256_set1_pd(mat[3]);
+    const __m256d m4  = _mm256_set1_pd(mat[4]);
+    const __m256d m5  = _mm256_set1_pd(mat[5]);
+    const __m256d thr = _mm256_set1_pd(threshold);
+    DECLARE_ALIGNED(32, double, distance[4]);
+    int num_inliers = 0;
+    int i;
+
+    for (i = 0; i + 4 <= npoints; i += 4) {
+        __m256d x, y, x2, y2;
+        load_points_4(corners1 + 2 * i, &x, &y);
+        load_points_4(corners2 + 2 * i, &x2, &y2);
+
+        const __m256d px = _mm256_add_pd(
+            _mm256_add_pd(_mm256_mul_pd(m2, x), _mm256_mul_pd(m3, y)), m0);
+        const __m256d py = _mm256_add_pd(
+            _mm256_add_pd(_mm256_mul_pd(m4, x), _mm256_mul_pd(m5, y)), m1);
+        const __m256d dx = _mm256_sub_pd(px, x2);
+        const __m256d dy = _mm256_sub_pd(py, y2);
+
+        const __m256d dist = _mm256_sqrt_pd(
+            _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)));
+        int           mask = _mm256_movemask_pd(_mm256_cmp_pd(dist, thr, _CMP_LT_OQ));
+        if (!mask)
+            continue;
+
+        _mm256_store_pd(distance, dist);
+        for (int k = 0; k < 4; k++, mask >>= 1) {
+            if (!(mask & 1))
+                continue;
+            inlier_indices[num_inliers++] = i + k;
+            *sum_distance += distance[k];
+            *sum_distance_squared += distance[k] * distance[k];
+        }
+    }
+
+    for (; i < npoints; ++i) {
+        const double x  = corners1[i * 2];
+        const double y  = corners1[i * 2 + 1];
+        const double dx = mat[2] * x + mat[3] * y + mat[0] - corners2[i * 2];
+        const double dy = mat[4] * x + mat[5] * y + mat[1] - corners2[i * 2 + 1];
+        const double d  = sqrt(dx * dx + dy * dy);
+
+        if (d < threshold) {
+            inlier_indices[num_inliers++] = i;
+            *sum_distance += d;
+            *sum_distance_squared += d * d;
+        }
+    }
+    return num_inliers;
+}
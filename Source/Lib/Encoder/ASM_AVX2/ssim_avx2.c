@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <immintrin.h>
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+static INLINE uint32_t hadd_epi32_avx2(const __m256i v) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    s         = _mm_add_epi32(s, _mm_srli_si128(s, 8));
+    return (uint32_t)_mm_cvtsi128_si32(_mm_add_epi32(s, _mm_srli_si128(s, 4)));
+}
+
+// Two rows of 8 pixels are processed at a time, one in each 128 bit lane.
+static INLINE void ssim_parms_2rows_avx2(const __m256i s, const __m256i r, __m256i *sum_s,
+                                         __m256i *sum_r, __m256i *sum_sq_s, __m256i *sum_sq_r,
+                                         __m256i *sum_sxr) {
+    const __m256i one = _mm256_set1_epi16(1);
+    *sum_s            = _mm256_add_epi32(*sum_s, _mm256_madd_epi16(s, one));
+    *sum_r            = _mm256_add_epi32(*sum_r, _mm256_madd_epi16(r, one));
+    *sum_sq_s         = _mm256_add_epi32(*sum_sq_s, _mm256_madd_epi16(s, s));
+    *sum_sq_r         = _mm256_add_epi32(*sum_sq_r, _mm256_madd_epi16(r, r));
+    *sum_sxr          = _mm256_add_epi32(*sum_sxr, _mm256_madd_epi16(s, r));
+}
+
+static INLINE void ssim_parms_store_avx2(const __m256i v_sum_s, const __m256i v_sum_r,
+                                         const __m256i v_sum_sq_s, const __m256i v_sum_sq_r,
+                                         const __m256i v_sum_sxr, uint32_t *sum_s,
+                                         uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                                         uint32_t *sum_sxr) {
+    *sum_s += hadd_epi32_avx2(v_sum_s);
+    *sum_r += hadd_epi32_avx2(v_sum_r);
+    *sum_sq_s += hadd_epi32_avx2(v_sum_sq_s);
+    *sum_sq_r += hadd_epi32_avx2(v_sum_sq_r);
+    *sum_sxr += hadd_epi32_avx2(v_sum_sxr);
+}
+
+static INLINE __m256i load_8bit_2rows_avx2(const uint8_t *p, int stride) {
+    const __m128i r0 = _mm_loadl_epi64((const __m128i *)p);
+    const __m128i r1 = _mm_loadl_epi64((const __m128i *)(p + stride));
+    return _mm256_cvtepu8_epi16(_mm_unpacklo_epi64(r0, r1));
+}
+
+static INLINE __m256i load_16bit_2rows_avx2(const uint16_t *p, int stride) {
+    const __m128i r0 = _mm_loadu_si128((const __m128i *)p);
+    const __m128i r1 = _mm_loadu_si128((const __m128i *)(p + stride));
+    return _mm256_insertf128_si256(_mm256_castsi128_si256(r0), r1, 1);
+}
+
+void svt_aom_ssim_parms_8x8_avx2(const uint8_t *s, int sp, const uint8_t *r, int rp,
+                                 uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s,
+                                 uint32_t *sum_sq_r, uint32_t *sum_sxr) {
+    __m256i v_sum_s  = _mm256_setzero_si256();
+    __m256i v_sum_r  = _mm256_setzero_si256();
+    __m256i v_sq_s   = _mm256_setzero_si256();
+    __m256i v_sq_r   = _mm256_setzero_si256();
+    __m256i v_sum_sr = _mm256_setzero_si256();
+
+    for (int i = 0; i < 8; i += 2, s += 2 * sp, r += 2 * rp) {
+        ssim_parms_2rows_avx2(load_8bit_2rows_avx2(s, sp),
+                              load_8bit_2rows_avx2(r, rp),
+                              &v_sum_s,
+                              &v_sum_r,
+                              &v_sq_s,
+                              &v_sq_r,
+                              &v_sum_sr);
+    }
+    ssim_parms_store_avx2(
+        v_sum_s, v_sum_r, v_sq_s, v_sq_r, v_sum_sr, sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr);
+}
+
+// The pixels are at most 12 bit, so that the products of pmaddwd and their
+// sums over the 64 pixels stay within 32 bits.
+void svt_aom_highbd_ssim_parms_8x8_avx2(const uint16_t *s, int sp, const uint16_t *r, int rp,
+                                        uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s,
+                                        uint32_t *sum_sq_r, uint32_t *sum_sxr) {
+    __m256i v_sum_s  = _mm256_setzero_si256();
+    __m256i v_sum_r  = _mm256_setzero_si256();
+    __m256i v_sq_s   = _mm256_setzero_si256();
+    __m256i v_sq_r   = _mm256_setzero_si256();
+    __m256i v_sum_sr = _mm256_setzero_si256();
+
+    for (int i = 0; i < 8; i += 2, s += 2 * sp, r += 2 * rp) {
+        ssim_parms_2rows_avx2(load_16bit_2rows_avx2(s, sp),
+                              load_16bit_2rows_avx2(r, rp),
+                              &v_sum_s,
+                              &v_sum_r,
+                              &v_sq_s,
+                              &v_sq_r,
+                              &v_sum_sr);
+    }
+    ssim_parms_store_avx2(
+        v_sum_s, v_sum_r, v_sq_s, v_sq_r, v_sum_sr, sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr);
+}
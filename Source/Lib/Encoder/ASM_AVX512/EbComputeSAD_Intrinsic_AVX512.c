@@ -4930,4 +4930,140 @@ void svt_sad_loop_kernel_avx512_intrin(
     *x_search_center = (int16_t)best_x;
     *y_search_center = (int16_t)best_y;
 }
+
+/*******************************************************************************
+* Full pel search of a 16xh block in one search area, the pairs of source rows
+* are permuted once in ss[] by the caller
+* Requirement: width = 16
+* Requirement: height <= 16
+*******************************************************************************/
+static INLINE void sad_loop_kernel_16xh_preloaded_avx512(const uint8_t *const src,
+                                                         const uint32_t src_stride,
+                                                         const __m512i ss[][4],
+                                                         const uint32_t     height,
+                                                         SadLoopSearchArea *const area) {
+    const uint8_t *ref        = area->ref;
+    const uint32_t ref_stride = area->ref_stride;
+    const int16_t  width      = area->width;
+    const uint8_t *s, *r;
+    __m128i        mask128 = _mm_set1_epi32(-1);
+    uint32_t       best_s  = 0xffffff;
+    int32_t        best_x = 0, best_y = 0;
+    int32_t        x, y;
+    uint32_t       h;
+
+    for (x = 0; x < (width & 7); x++) mask128 = _mm_slli_si128(mask128, 2);
+
+    for (y = 0; y < area->height; y++) {
+        for (x = 0; x <= width - 16; x += 16) {
+            __m512i sum512 = _mm512_setzero_si512();
+
+            r = ref + x;
+            for (h = 0; h < height; h += 2) {
+                const __m256i r0  = _mm256_loadu_si256((__m256i *)r);
+                const __m256i r1  = (h + 1 < height)
+                     ? _mm256_loadu_si256((__m256i *)(r + ref_stride))
+                     : _mm256_setzero_si256();
+                const __m512i rr  = _mm512_inserti64x4(_mm512_castsi256_si512(r0), r1, 1);
+                const __m512i rr0 = _mm512_permutexvar_epi64(
+                    _mm512_setr_epi64(0, 1, 1, 2, 4, 5, 5, 6), rr);
+                const __m512i rr1 = _mm512_permutexvar_epi64(
+                    _mm512_setr_epi64(1, 2, 2, 3, 5, 6, 6, 7), rr);
+
+                sum512 = _mm512_adds_epu16(sum512, _mm512_dbsad_epu8(ss[h >> 1][0], rr0, 0x94));
+                sum512 = _mm512_adds_epu16(sum512, _mm512_dbsad_epu8(ss[h >> 1][1], rr0, 0xE9));
+                sum512 = _mm512_adds_epu16(sum512, _mm512_dbsad_epu8(ss[h >> 1][2], rr1, 0x94));
+                sum512 = _mm512_adds_epu16(sum512, _mm512_dbsad_epu8(ss[h >> 1][3], rr1, 0xE9));
+                r += 2 * ref_stride;
+            }
+
+            update_256_pel(sum512, x, y, &best_s, &best_x, &best_y);
+        }
+
+        // leftover
+        for (; x < width; x += 8) {
+            __m256i sum256 = _mm256_setzero_si256();
+
+            s = src;
+            r = ref + x;
+
+            h = height;
+            while (h >= 2) {
+                sad_loop_kernel_16_avx2(s, src_stride, r, ref_stride, &sum256);
+                s += 2 * src_stride;
+                r += 2 * ref_stride;
+                h -= 2;
+            }
+
+            if (h) {
+                sad_loop_kernel_16_oneline_avx2(s, r, &sum256);
+            }
+
+            update_leftover_256_pel(sum256, width, x, y, mask128, &best_s, &best_x, &best_y);
+        }
+
+        ref += area->ref_stride_raw;
+    }
+
+    area->best_sad = best_s;
+    area->x_best   = (int16_t)best_x;
+    area->y_best   = (int16_t)best_y;
+}
+
+/*******************************************************************************
+* Full pel search of one source block in several search areas. The 16xh blocks
+* of the HME level 0 permute the source once for all the search areas, the
+* other sizes use svt_sad_loop_kernel_avx512_intrin() for each area.
+*******************************************************************************/
+void svt_sad_loop_kernel_multi_avx512_intrin(uint8_t *src, uint32_t src_stride,
+                                             uint32_t block_height, uint32_t block_width,
+                                             SadLoopSearchArea *search_areas,
+                                             uint32_t           num_search_areas) {
+    uint32_t i;
+
+    if (block_width == 16 && block_height <= 16) {
+        __m512i ss[8][4];
+
+        for (uint32_t h = 0; h < block_height; h += 2) {
+            const __m128i s0  = _mm_loadu_si128((__m128i *)(src + h * src_stride));
+            const __m128i s1  = (h + 1 < block_height)
+                 ? _mm_loadu_si128((__m128i *)(src + (h + 1) * src_stride))
+                 : _mm_setzero_si128();
+            const __m256i s01 = _mm256_insertf128_si256(_mm256_castsi128_si256(s0), s1, 1);
+            const __m512i s   = _mm512_castsi256_si512(s01);
+            ss[h >> 1][0]     = _mm512_permutexvar_epi32(
+                _mm512_setr_epi32(0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4), s);
+            ss[h >> 1][1] = _mm512_permutexvar_epi32(
+                _mm512_setr_epi32(1, 1, 1, 1, 1, 1, 1, 1, 5, 5, 5, 5, 5, 5, 5, 5), s);
+            ss[h >> 1][2] = _mm512_permutexvar_epi32(
+                _mm512_setr_epi32(2, 2, 2, 2, 2, 2, 2, 2, 6, 6, 6, 6, 6, 6, 6, 6), s);
+            ss[h >> 1][3] = _mm512_permutexvar_epi32(
+                _mm512_setr_epi32(3, 3, 3, 3, 3, 3, 3, 3, 7, 7, 7, 7, 7, 7, 7, 7), s);
+        }
+
+        for (i = 0; i < num_search_areas; i++)
+            sad_loop_kernel_16xh_preloaded_avx512(
+                src, src_stride, (const __m512i(*)[4])ss, block_height, &search_areas[i]);
+        return;
+    }
+
+    for (i = 0; i < num_search_areas; i++) {
+        SadLoopSearchArea *const area = &search_areas[i];
+
+        area->x_best = 0;
+        area->y_best = 0;
+        svt_sad_loop_kernel_avx512_intrin(src,
+                                          src_stride,
+                                          area->ref,
+                                          area->ref_stride,
+                                          block_height,
+                                          block_width,
+                                          &area->best_sad,
+                                          &area->x_best,
+                                          &area->y_best,
+                                          area->ref_stride_raw,
+                                          area->width,
+                                          area->height);
+    }
+}
 #endif // EN_AVX512_SUPPORT
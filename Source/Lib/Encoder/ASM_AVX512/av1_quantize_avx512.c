@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2017, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "EbDefinitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+// Quantizer parameters of 16 coefficients, the DC is in the lane 0 of the
+// first group of a block.
+typedef struct QuantParamAvx512 {
+    __m512i thr; // smallest absolute coefficient which is not zeroed
+    __m512i round;
+    __m512i quant;
+    __m512i dequant;
+} QuantParamAvx512;
+
+static INLINE __m512i dc_ac_epi32(int32_t dc, int32_t ac) {
+    return _mm512_mask_set1_epi32(_mm512_set1_epi32(ac), 1, dc);
+}
+
+static INLINE void init_qp(const int16_t *round_ptr, const int16_t *quant_ptr,
+                           const int16_t *dequant_ptr, int log_scale, QuantParamAvx512 *qp) {
+    // (abs << (1 + log_scale)) >= dequant <=> abs >= ceil(dequant / 2^(1 + log_scale))
+    const int32_t thr_rnd = (1 << (1 + log_scale)) - 1;
+    qp->thr               = dc_ac_epi32((dequant_ptr[0] + thr_rnd) >> (1 + log_scale),
+                          (dequant_ptr[1] + thr_rnd) >> (1 + log_scale));
+    qp->round             = dc_ac_epi32(ROUND_POWER_OF_TWO(round_ptr[0], log_scale),
+                            ROUND_POWER_OF_TWO(round_ptr[1], log_scale));
+    qp->quant             = dc_ac_epi32(quant_ptr[0], quant_ptr[1]);
+    qp->dequant           = dc_ac_epi32(dequant_ptr[0], dequant_ptr[1]);
+}
+
+static INLINE void update_qp(QuantParamAvx512 *qp) {
+    const __m512i ac = _mm512_set1_epi32(1);
+    qp->thr          = _mm512_permutexvar_epi32(ac, qp->thr);
+    qp->round        = _mm512_permutexvar_epi32(ac, qp->round);
+    qp->quant        = _mm512_permutexvar_epi32(ac, qp->quant);
+    qp->dequant      = _mm512_permutexvar_epi32(ac, qp->dequant);
+}
+
+static INLINE void quantize_16(const QuantParamAvx512 *qp, const TranLow *coeff_ptr,
+                               const int16_t *iscan_ptr, TranLow *qcoeff_ptr,
+                               TranLow *dqcoeff_ptr, const int log_scale, __m512i *eob) {
+    const __m512i   coeff = _mm512_loadu_si512((const __m512i *)coeff_ptr);
+    const __m512i   abs   = _mm512_abs_epi32(coeff);
+    const __mmask16 mask  = _mm512_cmpge_epi32_mask(abs, qp->thr);
+
+    if (mask) {
+        const __m512i zero = _mm512_setzero_si512();
+        __m512i       q    = _mm512_min_epi32(_mm512_add_epi32(abs, qp->round),
+                                     _mm512_set1_epi32(INT16_MAX));
+        q                  = _mm512_maskz_srli_epi32(
+            mask, _mm512_mullo_epi32(q, qp->quant), 16 - log_scale);
+        __m512i dq = _mm512_srli_epi32(_mm512_mullo_epi32(q, qp->dequant), log_scale);
+
+        const __mmask16 neg = _mm512_movepi32_mask(coeff);
+        q                   = _mm512_mask_sub_epi32(q, neg, zero, q);
+        dq                  = _mm512_mask_sub_epi32(dq, neg, zero, dq);
+        _mm512_storeu_si512((__m512i *)qcoeff_ptr, q);
+        _mm512_storeu_si512((__m512i *)dqcoeff_ptr, dq);
+
+        const __mmask16 nz    = _mm512_test_epi32_mask(q, q);
+        const __m512i   iscan = _mm512_cvtepi16_epi32(
+            _mm256_loadu_si256((const __m256i *)iscan_ptr));
+        *eob = _mm512_mask_max_epi32(*eob, nz, *eob, _mm512_add_epi32(iscan, _mm512_set1_epi32(1)));
+    } else {
+        _mm512_storeu_si512((__m512i *)qcoeff_ptr, _mm512_setzero_si512());
+        _mm512_storeu_si512((__m512i *)dqcoeff_ptr, _mm512_setzero_si512());
+    }
+}
+
+static INLINE void quantize_fp_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                                      const int16_t *round_ptr, const int16_t *quant_ptr,
+                                      TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                      const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                      const int16_t *iscan_ptr, const int log_scale) {
+    QuantParamAvx512 qp;
+    __m512i          eob = _mm512_setzero_si512();
+
+    init_qp(round_ptr, quant_ptr, dequant_ptr, log_scale, &qp);
+    quantize_16(&qp, coeff_ptr, iscan_ptr, qcoeff_ptr, dqcoeff_ptr, log_scale, &eob);
+    update_qp(&qp);
+    for (intptr_t i = 16; i < n_coeffs; i += 16)
+        quantize_16(&qp,
+                    coeff_ptr + i,
+                    iscan_ptr + i,
+                    qcoeff_ptr + i,
+                    dqcoeff_ptr + i,
+                    log_scale,
+                    &eob);
+    *eob_ptr = (uint16_t)_mm512_reduce_max_epi32(eob);
+}
+
+void svt_av1_quantize_fp_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                                const int16_t *zbin_ptr, const int16_t *round_ptr,
+                                const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                const int16_t *scan_ptr, const int16_t *iscan_ptr) {
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    (void)scan_ptr;
+    quantize_fp_avx512(coeff_ptr,
+                       n_coeffs,
+                       round_ptr,
+                       quant_ptr,
+                       qcoeff_ptr,
+                       dqcoeff_ptr,
+                       dequant_ptr,
+                       eob_ptr,
+                       iscan_ptr,
+                       0);
+}
+
+void svt_av1_quantize_fp_32x32_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                                      const int16_t *zbin_ptr, const int16_t *round_ptr,
+                                      const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                      TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                      const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                      const int16_t *scan_ptr, const int16_t *iscan_ptr) {
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    (void)scan_ptr;
+    quantize_fp_avx512(coeff_ptr,
+                       n_coeffs,
+                       round_ptr,
+                       quant_ptr,
+                       qcoeff_ptr,
+                       dqcoeff_ptr,
+                       dequant_ptr,
+                       eob_ptr,
+                       iscan_ptr,
+                       1);
+}
+
+void svt_av1_quantize_fp_64x64_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                                      const int16_t *zbin_ptr, const int16_t *round_ptr,
+                                      const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                      TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                      const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                      const int16_t *scan_ptr, const int16_t *iscan_ptr) {
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    (void)scan_ptr;
+    quantize_fp_avx512(coeff_ptr,
+                       n_coeffs,
+                       round_ptr,
+                       quant_ptr,
+                       qcoeff_ptr,
+                       dqcoeff_ptr,
+                       dequant_ptr,
+                       eob_ptr,
+                       iscan_ptr,
+                       2);
+}
+
+#endif // EN_AVX512_SUPPORT
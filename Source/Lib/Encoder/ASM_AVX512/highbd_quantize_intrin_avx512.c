@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2017, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "EbDefinitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+static INLINE __m512i dc_ac_epi32(int32_t dc, int32_t ac) {
+    return _mm512_mask_set1_epi32(_mm512_set1_epi32(ac), 1, dc);
+}
+
+static INLINE void update_qp(__m512i *qp, int n) {
+    const __m512i ac = _mm512_set1_epi32(1);
+    for (int i = 0; i < n; ++i) qp[i] = _mm512_permutexvar_epi32(ac, qp[i]);
+}
+
+// Low 32 bits of (x * y) >> shift of 16 int32 products which may exceed 32 bits
+static INLINE __m512i mul_shift_epi32(const __m512i x, const __m512i y, const int shift) {
+    const __m512i prod_lo = _mm512_srli_epi64(_mm512_mul_epi32(x, y), shift);
+    const __m512i prod_hi = _mm512_srli_epi64(
+        _mm512_mul_epi32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(y, 32)), shift);
+    return _mm512_mask_blend_epi32(0xAAAA, prod_lo, _mm512_slli_epi64(prod_hi, 32));
+}
+
+static INLINE void store_quant_eob(__m512i q, __m512i dq, const __m512i coeff,
+                                   const int16_t *iscan_ptr, TranLow *qcoeff_ptr,
+                                   TranLow *dqcoeff_ptr, __m512i *eob) {
+    const __m512i   zero = _mm512_setzero_si512();
+    const __mmask16 neg  = _mm512_movepi32_mask(coeff);
+    q                    = _mm512_mask_sub_epi32(q, neg, zero, q);
+    dq                   = _mm512_mask_sub_epi32(dq, neg, zero, dq);
+    _mm512_storeu_si512((__m512i *)qcoeff_ptr, q);
+    _mm512_storeu_si512((__m512i *)dqcoeff_ptr, dq);
+
+    const __mmask16 nz    = _mm512_test_epi32_mask(q, q);
+    const __m512i   iscan = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)iscan_ptr));
+    *eob = _mm512_mask_max_epi32(*eob, nz, *eob, _mm512_add_epi32(iscan, _mm512_set1_epi32(1)));
+}
+
+static INLINE void store_zero(TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr) {
+    _mm512_storeu_si512((__m512i *)qcoeff_ptr, _mm512_setzero_si512());
+    _mm512_storeu_si512((__m512i *)dqcoeff_ptr, _mm512_setzero_si512());
+}
+
+/*
+ * quantize_b: qp[] holds zbin, round, quant, dequant and quant_shift, the zbin
+ * and round already scaled by log_scale.
+ */
+static INLINE void init_qp_b(const int16_t *zbin_ptr, const int16_t *round_ptr,
+                             const int16_t *quant_ptr, const int16_t *dequant_ptr,
+                             const int16_t *quant_shift_ptr, int log_scale, __m512i *qp) {
+    qp[0] = dc_ac_epi32(ROUND_POWER_OF_TWO(zbin_ptr[0], log_scale),
+                        ROUND_POWER_OF_TWO(zbin_ptr[1], log_scale));
+    qp[1] = dc_ac_epi32(ROUND_POWER_OF_TWO(round_ptr[0], log_scale),
+                        ROUND_POWER_OF_TWO(round_ptr[1], log_scale));
+    qp[2] = dc_ac_epi32(quant_ptr[0], quant_ptr[1]);
+    qp[3] = dc_ac_epi32(dequant_ptr[0], dequant_ptr[1]);
+    qp[4] = dc_ac_epi32(quant_shift_ptr[0], quant_shift_ptr[1]);
+}
+
+static INLINE void quantize_b_16(const __m512i *qp, const TranLow *coeff_ptr,
+                                 const int16_t *iscan_ptr, TranLow *qcoeff_ptr,
+                                 TranLow *dqcoeff_ptr, const int log_scale, const int clamp,
+                                 __m512i *eob) {
+    const __m512i   coeff = _mm512_loadu_si512((const __m512i *)coeff_ptr);
+    const __m512i   abs   = _mm512_abs_epi32(coeff);
+    const __mmask16 mask  = _mm512_cmpge_epi32_mask(abs, qp[0]);
+
+    if (mask) {
+        __m512i q = _mm512_add_epi32(abs, qp[1]);
+        if (clamp) q = _mm512_min_epi32(q, _mm512_set1_epi32(INT16_MAX));
+        q = _mm512_add_epi32(mul_shift_epi32(q, qp[2], 16), q);
+        q = _mm512_maskz_mov_epi32(mask, mul_shift_epi32(q, qp[4], 16 - log_scale));
+        const __m512i dq = _mm512_srli_epi32(_mm512_mullo_epi32(q, qp[3]), log_scale);
+        store_quant_eob(q, dq, coeff, iscan_ptr, qcoeff_ptr, dqcoeff_ptr, eob);
+    } else
+        store_zero(qcoeff_ptr, dqcoeff_ptr);
+}
+
+static INLINE void quantize_b_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                                     const int16_t *zbin_ptr, const int16_t *round_ptr,
+                                     const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                     TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                     const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                     const int16_t *iscan, const int log_scale, const int clamp) {
+    __m512i qp[5];
+    __m512i eob = _mm512_setzero_si512();
+
+    init_qp_b(zbin_ptr, round_ptr, quant_ptr, dequant_ptr, quant_shift_ptr, log_scale, qp);
+    quantize_b_16(qp, coeff_ptr, iscan, qcoeff_ptr, dqcoeff_ptr, log_scale, clamp, &eob);
+    update_qp(qp, 5);
+    for (intptr_t i = 16; i < n_coeffs; i += 16)
+        quantize_b_16(qp,
+                      coeff_ptr + i,
+                      iscan + i,
+                      qcoeff_ptr + i,
+                      dqcoeff_ptr + i,
+                      log_scale,
+                      clamp,
+                      &eob);
+    *eob_ptr = (uint16_t)_mm512_reduce_max_epi32(eob);
+}
+
+void svt_aom_quantize_b_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                               const int16_t *zbin_ptr, const int16_t *round_ptr,
+                               const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                               TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                               const int16_t *dequant_ptr, uint16_t *eob_ptr, const int16_t *scan,
+                               const int16_t *iscan, const QmVal *qm_ptr, const QmVal *iqm_ptr,
+                               const int32_t log_scale) {
+    (void)qm_ptr;
+    (void)iqm_ptr;
+    (void)scan;
+    quantize_b_avx512(coeff_ptr,
+                      n_coeffs,
+                      zbin_ptr,
+                      round_ptr,
+                      quant_ptr,
+                      quant_shift_ptr,
+                      qcoeff_ptr,
+                      dqcoeff_ptr,
+                      dequant_ptr,
+                      eob_ptr,
+                      iscan,
+                      log_scale,
+                      1);
+}
+
+void svt_aom_highbd_quantize_b_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                                      const int16_t *zbin_ptr, const int16_t *round_ptr,
+                                      const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                      TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                      const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                      const int16_t *scan, const int16_t *iscan,
+                                      const QmVal *qm_ptr, const QmVal *iqm_ptr,
+                                      const int32_t log_scale) {
+    (void)qm_ptr;
+    (void)iqm_ptr;
+    (void)scan;
+    quantize_b_avx512(coeff_ptr,
+                      n_coeffs,
+                      zbin_ptr,
+                      round_ptr,
+                      quant_ptr,
+                      quant_shift_ptr,
+                      qcoeff_ptr,
+                      dqcoeff_ptr,
+                      dequant_ptr,
+                      eob_ptr,
+                      iscan,
+                      log_scale,
+                      0);
+}
+
+/*
+ * highbd quantize_fp: qp[] holds the threshold, round, quant and dequant.
+ */
+static INLINE void init_qp_fp(const int16_t *round_ptr, const int16_t *quant_ptr,
+                              const int16_t *dequant_ptr, int log_scale, __m512i *qp) {
+    // (abs << (1 + log_scale)) >= dequant <=> abs >= ceil(dequant / 2^(1 + log_scale))
+    const int32_t thr_rnd = (1 << (1 + log_scale)) - 1;
+    qp[0]                 = dc_ac_epi32((dequant_ptr[0] + thr_rnd) >> (1 + log_scale),
+                        (dequant_ptr[1] + thr_rnd) >> (1 + log_scale));
+    qp[1]                 = dc_ac_epi32(ROUND_POWER_OF_TWO(round_ptr[0], log_scale),
+                        ROUND_POWER_OF_TWO(round_ptr[1], log_scale));
+    qp[2]                 = dc_ac_epi32(quant_ptr[0], quant_ptr[1]);
+    qp[3]                 = dc_ac_epi32(dequant_ptr[0], dequant_ptr[1]);
+}
+
+static INLINE void quantize_highbd_fp_16(const __m512i *qp, const TranLow *coeff_ptr,
+                                         const int16_t *iscan_ptr, TranLow *qcoeff_ptr,
+                                         TranLow *dqcoeff_ptr, const int log_scale,
+                                         __m512i *eob) {
+    const __m512i   coeff = _mm512_loadu_si512((const __m512i *)coeff_ptr);
+    const __m512i   abs   = _mm512_abs_epi32(coeff);
+    const __mmask16 mask  = _mm512_cmpge_epi32_mask(abs, qp[0]);
+
+    if (mask) {
+        const __m512i q  = _mm512_maskz_mov_epi32(
+            mask, mul_shift_epi32(_mm512_add_epi32(abs, qp[1]), qp[2], 16 - log_scale));
+        const __m512i dq = _mm512_srai_epi32(_mm512_mullo_epi32(q, qp[3]), log_scale);
+        store_quant_eob(q, dq, coeff, iscan_ptr, qcoeff_ptr, dqcoeff_ptr, eob);
+    } else
+        store_zero(qcoeff_ptr, dqcoeff_ptr);
+}
+
+void svt_av1_highbd_quantize_fp_avx512(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                                       const int16_t *zbin_ptr, const int16_t *round_ptr,
+                                       const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                       TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                       const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                       const int16_t *scan, const int16_t *iscan,
+                                       int16_t log_scale) {
+    (void)scan;
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    __m512i qp[4];
+    __m512i eob = _mm512_setzero_si512();
+
+    init_qp_fp(round_ptr, quant_ptr, dequant_ptr, log_scale, qp);
+    quantize_highbd_fp_16(qp, coeff_ptr, iscan, qcoeff_ptr, dqcoeff_ptr, log_scale, &eob);
+    update_qp(qp, 4);
+    for (intptr_t i = 16; i < n_coeffs; i += 16)
+        quantize_highbd_fp_16(qp,
+                              coeff_ptr + i,
+                              iscan + i,
+                              qcoeff_ptr + i,
+                              dqcoeff_ptr + i,
+                              log_scale,
+                              &eob);
+    *eob_ptr = (uint16_t)_mm512_reduce_max_epi32(eob);
+}
+
+#endif // EN_AVX512_SUPPORT
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2018, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "EbDefinitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// 8 bit
+////////////////////////////////////////////////////////////////////////////////
+
+static INLINE unsigned int obmc_sad_w16n_avx512(const uint8_t *pre, const int pre_stride,
+                                                const int32_t *wsrc, const int32_t *mask,
+                                                const int width, const int height) {
+    const __m512i v_bias_d = _mm512_set1_epi32((1 << 12) >> 1);
+    __m512i       v_sad_d  = _mm512_setzero_si512();
+    assert(width >= 16);
+    assert(IS_POWER_OF_TWO(width));
+
+    for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j += 16) {
+            const __m128i v_p_b = _mm_loadu_si128((const __m128i *)(pre + j));
+            const __m512i v_m_d = _mm512_loadu_si512((const __m512i *)(mask + j));
+            const __m512i v_w_d = _mm512_loadu_si512((const __m512i *)(wsrc + j));
+            const __m512i v_p_d = _mm512_cvtepu8_epi32(v_p_b);
+
+            // Values in both pre and mask fit in 15 bits, and are packed at 32 bit
+            // boundaries, so pmaddwd gives the same result as pmulld.
+            const __m512i v_pm_d      = _mm512_madd_epi16(v_p_d, v_m_d);
+            const __m512i v_absdiff_d = _mm512_abs_epi32(_mm512_sub_epi32(v_w_d, v_pm_d));
+
+            // Rounded absolute difference
+            const __m512i v_rad_d = _mm512_srli_epi32(_mm512_add_epi32(v_absdiff_d, v_bias_d),
+                                                      12);
+
+            v_sad_d = _mm512_add_epi32(v_sad_d, v_rad_d);
+        }
+        pre += pre_stride;
+        wsrc += width;
+        mask += width;
+    }
+
+    return (unsigned int)_mm512_reduce_add_epi32(v_sad_d);
+}
+
+#define OBMCSADWXH(w, h)                                                               \
+    unsigned int svt_aom_obmc_sad##w##x##h##_avx512(                                   \
+        const uint8_t *pre, int pre_stride, const int32_t *wsrc, const int32_t *msk) { \
+        return obmc_sad_w16n_avx512(pre, pre_stride, wsrc, msk, w, h);                 \
+    }
+
+OBMCSADWXH(128, 128)
+OBMCSADWXH(128, 64)
+OBMCSADWXH(64, 128)
+OBMCSADWXH(64, 64)
+OBMCSADWXH(64, 32)
+OBMCSADWXH(64, 16)
+
+#endif // EN_AVX512_SUPPORT
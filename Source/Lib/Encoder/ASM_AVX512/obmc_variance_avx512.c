@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2018, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "EbDefinitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <assert.h>
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// 8 bit
+////////////////////////////////////////////////////////////////////////////////
+
+static INLINE __m512i obmc_rdiff_avx512(const uint8_t *pre, const int32_t *wsrc,
+                                        const int32_t *mask) {
+    const __m512i v_bias_d = _mm512_set1_epi32((1 << 12) >> 1);
+    const __m512i v_p_d    = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)pre));
+    const __m512i v_m_d    = _mm512_loadu_si512((const __m512i *)mask);
+    const __m512i v_w_d    = _mm512_loadu_si512((const __m512i *)wsrc);
+
+    // Values in both pre and mask fit in 15 bits, and are packed at 32 bit
+    // boundaries, so pmaddwd gives the same result as pmulld.
+    const __m512i v_pm_d   = _mm512_madd_epi16(v_p_d, v_m_d);
+    const __m512i v_diff_d = _mm512_sub_epi32(v_w_d, v_pm_d);
+
+    // Signed rounding: (diff + bias - (diff < 0)) >> 12
+    const __m512i v_sign_d = _mm512_srai_epi32(v_diff_d, 31);
+    const __m512i v_tmp_d  = _mm512_add_epi32(_mm512_add_epi32(v_diff_d, v_bias_d), v_sign_d);
+    return _mm512_srai_epi32(v_tmp_d, 12);
+}
+
+static INLINE void obmc_variance_w32n_avx512(const uint8_t *pre, const int pre_stride,
+                                             const int32_t *wsrc, const int32_t *mask,
+                                             unsigned int *const sse, int *const sum, const int w,
+                                             const int h) {
+    __m512i v_sum_d = _mm512_setzero_si512();
+    __m512i v_sse_d = _mm512_setzero_si512();
+
+    assert(w >= 32);
+    assert(IS_POWER_OF_TWO(w));
+    assert(IS_POWER_OF_TWO(h));
+
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < w; j += 32) {
+            const __m512i v_rdiff0_d = obmc_rdiff_avx512(pre + j, wsrc + j, mask + j);
+            const __m512i v_rdiff1_d = obmc_rdiff_avx512(
+                pre + j + 16, wsrc + j + 16, mask + j + 16);
+
+            // The rounded differences fit in 16 bits, so the squares can be
+            // summed in pairs after packing.
+            const __m512i v_rdiff01_w = _mm512_packs_epi32(v_rdiff0_d, v_rdiff1_d);
+            const __m512i v_sqrdiff_d = _mm512_madd_epi16(v_rdiff01_w, v_rdiff01_w);
+
+            v_sum_d = _mm512_add_epi32(v_sum_d, _mm512_add_epi32(v_rdiff0_d, v_rdiff1_d));
+            v_sse_d = _mm512_add_epi32(v_sse_d, v_sqrdiff_d);
+        }
+        pre += pre_stride;
+        wsrc += w;
+        mask += w;
+    }
+
+    *sum = _mm512_reduce_add_epi32(v_sum_d);
+    *sse = (unsigned int)_mm512_reduce_add_epi32(v_sse_d);
+}
+
+#define OBMCVARWXH(W, H)                                                                   \
+    unsigned int svt_aom_obmc_variance##W##x##H##_avx512(const uint8_t *pre,               \
+                                                         int            pre_stride,        \
+                                                         const int32_t *wsrc,              \
+                                                         const int32_t *mask,              \
+                                                         unsigned int  *sse) {             \
+        int sum;                                                                           \
+        obmc_variance_w32n_avx512(pre, pre_stride, wsrc, mask, sse, &sum, W, H);           \
+        return *sse - (unsigned int)(((int64_t)sum * sum) / (W * H));                      \
+    }
+
+OBMCVARWXH(128, 128)
+OBMCVARWXH(128, 64)
+OBMCVARWXH(64, 128)
+OBMCVARWXH(64, 64)
+OBMCVARWXH(64, 32)
+OBMCVARWXH(64, 16)
+
+#endif // EN_AVX512_SUPPORT
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "EbDefinitions.h"
+
+#if EN_AVX512_SUPPORT
+
+#include <immintrin.h>
+
+#include "aom_dsp_rtcd.h"
+
+static INLINE void variance64_kernel_avx512(const uint8_t *const src, const uint8_t *const ref,
+                                            __m512i *const sse, __m512i *const sum) {
+    const __m512i adj_sub = _mm512_set1_epi16(0xff01); // (1,-1)
+    const __m512i s       = _mm512_loadu_si512((const __m512i *)src);
+    const __m512i r       = _mm512_loadu_si512((const __m512i *)ref);
+
+    // unpack into pairs of source and reference values
+    const __m512i src_ref0 = _mm512_unpacklo_epi8(s, r);
+    const __m512i src_ref1 = _mm512_unpackhi_epi8(s, r);
+
+    // subtract adjacent elements using src*1 + ref*-1
+    const __m512i diff0 = _mm512_maddubs_epi16(src_ref0, adj_sub);
+    const __m512i diff1 = _mm512_maddubs_epi16(src_ref1, adj_sub);
+    const __m512i madd0 = _mm512_madd_epi16(diff0, diff0);
+    const __m512i madd1 = _mm512_madd_epi16(diff1, diff1);
+
+    // add to the running totals
+    *sum = _mm512_add_epi16(*sum, _mm512_add_epi16(diff0, diff1));
+    *sse = _mm512_add_epi32(*sse, _mm512_add_epi32(madd0, madd1));
+}
+
+static INLINE void variance64_avx512(const uint8_t *src, const int src_stride, const uint8_t *ref,
+                                     const int ref_stride, const int h, __m512i *const vsse,
+                                     __m512i *const vsum) {
+    *vsum = _mm512_setzero_si512();
+
+    for (int i = 0; i < h; i++) {
+        variance64_kernel_avx512(src, ref, vsse, vsum);
+        src += src_stride;
+        ref += ref_stride;
+    }
+}
+
+static INLINE void variance128_avx512(const uint8_t *src, const int src_stride, const uint8_t *ref,
+                                      const int ref_stride, const int h, __m512i *const vsse,
+                                      __m512i *const vsum) {
+    *vsum = _mm512_setzero_si512();
+
+    for (int i = 0; i < h; i++) {
+        variance64_kernel_avx512(src + 0, ref + 0, vsse, vsum);
+        variance64_kernel_avx512(src + 64, ref + 64, vsse, vsum);
+        src += src_stride;
+        ref += ref_stride;
+    }
+}
+
+static INLINE __m512i sum_to_32bit_avx512(const __m512i sum) {
+    return _mm512_madd_epi16(sum, _mm512_set1_epi16(1));
+}
+
+// Each 16 bit lane of the partial sum gathers 2 differences per kernel call, so
+// uh rows are chosen to keep it within 64 calls (|sum| <= 64 * 2 * 255).
+#define AOM_VAR_LOOP_AVX512(bw, bh, bits, uh)                                                \
+    unsigned int svt_aom_variance##bw##x##bh##_avx512(const uint8_t *src,                    \
+                                                      int            src_stride,             \
+                                                      const uint8_t *ref,                    \
+                                                      int            ref_stride,             \
+                                                      unsigned int  *sse) {                  \
+        __m512i vsse = _mm512_setzero_si512();                                               \
+        __m512i vsum = _mm512_setzero_si512();                                               \
+        for (int i = 0; i < (bh / uh); i++) {                                                \
+            __m512i vsum16;                                                                  \
+            variance##bw##_avx512(src, src_stride, ref, ref_stride, uh, &vsse, &vsum16);     \
+            vsum = _mm512_add_epi32(vsum, sum_to_32bit_avx512(vsum16));                      \
+            src += uh * src_stride;                                                          \
+            ref += uh * ref_stride;                                                          \
+        }                                                                                    \
+        const int sum = _mm512_reduce_add_epi32(vsum);                                       \
+        *sse          = (unsigned int)_mm512_reduce_add_epi32(vsse);                         \
+        return *sse - (unsigned int)(((int64_t)sum * sum) >> bits);                          \
+    }
+
+AOM_VAR_LOOP_AVX512(64, 16, 10, 16);
+AOM_VAR_LOOP_AVX512(64, 32, 11, 32);
+AOM_VAR_LOOP_AVX512(64, 64, 12, 64);
+AOM_VAR_LOOP_AVX512(64, 128, 13, 64); // 64x64 * (128/64)
+AOM_VAR_LOOP_AVX512(128, 64, 13, 32); // 128x32 * ( 64/32)
+AOM_VAR_LOOP_AVX512(128, 128, 14, 32); // 128x32 * (128/32)
+
+#endif // EN_AVX512_SUPPORT
@@ -0,0 +1,165 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include "aom_dsp_rtcd.h"
+#include "EbComputeSAD_C.h"
+#include "EbUtility.h"
+#include "synonyms_neon.h"
+
+// Absolute differences of the first (width & ~3) pixels of a row added to the
+// 16 bit sums. A lane gains at most 2 * 255 per 16 pixels.
+static INLINE uint16x8_t sad_row_neon(uint16x8_t sum, const uint8_t *src, const uint8_t *ref,
+                                      uint32_t width) {
+    uint32_t x = 0;
+    for (; x + 16 <= width; x += 16)
+        sum = vpadalq_u8(sum, vabdq_u8(vld1q_u8(src + x), vld1q_u8(ref + x)));
+    if (x + 8 <= width) {
+        sum = vabal_u8(sum, vld1_u8(src + x), vld1_u8(ref + x));
+        x += 8;
+    }
+    if (x + 4 <= width)
+        sum = vabal_u8(sum, load_u8_4x1(src + x), load_u8_4x1(ref + x));
+    return sum;
+}
+
+static INLINE uint32_t sad_neon(const uint8_t *src, uint32_t src_stride, const uint8_t *ref,
+                                uint32_t ref_stride, uint32_t height, uint32_t width) {
+    const uint32_t width4 = width & ~3;
+    uint32x4_t     sum    = vdupq_n_u32(0);
+    uint32_t       tail   = 0;
+    // 64 rows of up to 16 pixels, or a row of up to 128 pixels, fit in the
+    // 16 bit sums
+    const uint32_t rows = width <= 16 ? 64 : 1;
+    for (uint32_t y = 0; y < height; y += rows) {
+        uint16x8_t     sum16 = vdupq_n_u16(0);
+        const uint32_t n     = AOMMIN(rows, height - y);
+        for (uint32_t r = 0; r < n; r++, src += src_stride, ref += ref_stride) {
+            sum16 = sad_row_neon(sum16, src, ref, width4);
+            for (uint32_t x = width4; x < width; x++) tail += EB_ABS_DIFF(src[x], ref[x]);
+        }
+        sum = vpadalq_u16(sum, sum16);
+    }
+    return horizontal_add_u32x4(sum) + tail;
+}
+
+uint32_t svt_nxm_sad_kernel_helper_neon(const uint8_t *src, uint32_t src_stride,
+                                        const uint8_t *ref, uint32_t ref_stride, uint32_t height,
+                                        uint32_t width) {
+    return sad_neon(src, src_stride, ref, ref_stride, height, width);
+}
+
+void svt_sad_loop_kernel_neon(uint8_t *src, uint32_t src_stride, uint8_t *ref,
+                              uint32_t ref_stride, uint32_t block_height, uint32_t block_width,
+                              uint64_t *best_sad, int16_t *x_search_center,
+                              int16_t *y_search_center, uint32_t src_stride_raw,
+                              int16_t search_area_width, int16_t search_area_height) {
+    *best_sad = 0xffffff;
+
+    for (int16_t y_search_index = 0; y_search_index < search_area_height; y_search_index++) {
+        for (int16_t x_search_index = 0; x_search_index < search_area_width; x_search_index++) {
+            const uint32_t sad = sad_neon(
+                src, src_stride, ref + x_search_index, ref_stride, block_height, block_width);
+            if (sad < *best_sad) {
+                *best_sad        = sad;
+                *x_search_center = x_search_index;
+                *y_search_center = y_search_index;
+            }
+        }
+        ref += src_stride_raw;
+    }
+}
+
+void svt_sad_loop_kernel_multi_neon(uint8_t *src, uint32_t src_stride, uint32_t block_height,
+                                    uint32_t block_width, SadLoopSearchArea *search_areas,
+                                    uint32_t num_search_areas) {
+    for (uint32_t i = 0; i < num_search_areas; i++) {
+        SadLoopSearchArea *const area = &search_areas[i];
+
+        area->x_best = 0;
+        area->y_best = 0;
+        svt_sad_loop_kernel_neon(src,
+                                 src_stride,
+                                 area->ref,
+                                 area->ref_stride,
+                                 block_height,
+                                 block_width,
+                                 &area->best_sad,
+                                 &area->x_best,
+                                 &area->y_best,
+                                 area->ref_stride_raw,
+                                 area->width,
+                                 area->height);
+    }
+}
+
+// Sums of the 4 references, the source rows are loaded once
+static INLINE void sad_x4d_neon(const uint8_t *src, int src_stride, const uint8_t *const ref[],
+                                int ref_stride, uint32_t width, uint32_t height,
+                                uint32_t *sad_array) {
+    uint32x4_t sum[4];
+    for (int i = 0; i < 4; i++) sum[i] = vdupq_n_u32(0);
+
+    for (uint32_t y = 0; y < height; y++) {
+        const uint8_t *s = src + y * src_stride;
+        uint16x8_t     sum16[4];
+        for (int i = 0; i < 4; i++) sum16[i] = vdupq_n_u16(0);
+        if (width >= 16) {
+            for (uint32_t x = 0; x < width; x += 16) {
+                const uint8x16_t s16 = vld1q_u8(s + x);
+                for (int i = 0; i < 4; i++) {
+                    const uint8x16_t r16 = vld1q_u8(ref[i] + y * ref_stride + x);
+                    sum16[i]             = vpadalq_u8(sum16[i], vabdq_u8(s16, r16));
+                }
+            }
+        } else {
+            for (int i = 0; i < 4; i++)
+                sum16[i] = sad_row_neon(sum16[i], s, ref[i] + y * ref_stride, width);
+        }
+        for (int i = 0; i < 4; i++) sum[i] = vpadalq_u16(sum[i], sum16[i]);
+    }
+    for (int i = 0; i < 4; i++) sad_array[i] = horizontal_add_u32x4(sum[i]);
+}
+
+#define SAD_NXM_NEON(m, n)                                                        \
+    uint32_t svt_aom_sad##m##x##n##_neon(                                         \
+        const uint8_t *src, int src_stride, const uint8_t *ref, int ref_stride) { \
+        return sad_neon(src, src_stride, ref, ref_stride, n, m);                  \
+    }                                                                             \
+    void svt_aom_sad##m##x##n##x4d_neon(const uint8_t *src,                       \
+                                        int            src_stride,                \
+                                        const uint8_t *const ref[],               \
+                                        int            ref_stride,                \
+                                        uint32_t *     sad_array) {               \
+        sad_x4d_neon(src, src_stride, ref, ref_stride, m, n, sad_array);          \
+    }
+
+SAD_NXM_NEON(4, 4)
+SAD_NXM_NEON(4, 8)
+SAD_NXM_NEON(4, 16)
+SAD_NXM_NEON(8, 4)
+SAD_NXM_NEON(8, 8)
+SAD_NXM_NEON(8, 16)
+SAD_NXM_NEON(8, 32)
+SAD_NXM_NEON(16, 4)
+SAD_NXM_NEON(16, 8)
+SAD_NXM_NEON(16, 16)
+SAD_NXM_NEON(16, 32)
+SAD_NXM_NEON(16, 64)
+SAD_NXM_NEON(32, 8)
+SAD_NXM_NEON(32, 16)
+SAD_NXM_NEON(32, 32)
+SAD_NXM_NEON(32, 64)
+SAD_NXM_NEON(64, 16)
+SAD_NXM_NEON(64, 32)
+SAD_NXM_NEON(64, 64)
+SAD_NXM_NEON(64, 128)
+SAD_NXM_NEON(128, 64)
+SAD_NXM_NEON(128, 128)
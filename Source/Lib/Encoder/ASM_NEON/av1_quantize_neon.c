@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "aom_dsp_rtcd.h"
+#include "synonyms_neon.h"
+
+// Quantizer parameters of 4 coefficients, the DC is in the lane 0 of the
+// first group of a block.
+typedef struct QuantParamNeon {
+    int32x4_t thr; // dequant, compared with the coefficient << (1 + log_scale)
+    int32x4_t round;
+    int32x4_t quant;
+    int32x4_t dequant;
+} QuantParamNeon;
+
+static INLINE int32x4_t dc_ac_s32(int32_t dc, int32_t ac) {
+    return vsetq_lane_s32(dc, vdupq_n_s32(ac), 0);
+}
+
+static INLINE void init_qp(const int16_t *round_ptr, const int16_t *quant_ptr,
+                           const int16_t *dequant_ptr, int log_scale, QuantParamNeon *qp) {
+    qp->thr     = dc_ac_s32(dequant_ptr[0], dequant_ptr[1]);
+    qp->round   = dc_ac_s32(ROUND_POWER_OF_TWO(round_ptr[0], log_scale),
+                          ROUND_POWER_OF_TWO(round_ptr[1], log_scale));
+    qp->quant   = dc_ac_s32(quant_ptr[0], quant_ptr[1]);
+    qp->dequant = dc_ac_s32(dequant_ptr[0], dequant_ptr[1]);
+}
+
+static INLINE void update_qp(QuantParamNeon *qp) {
+    qp->thr     = vdupq_laneq_s32(qp->thr, 1);
+    qp->round   = vdupq_laneq_s32(qp->round, 1);
+    qp->quant   = vdupq_laneq_s32(qp->quant, 1);
+    qp->dequant = vdupq_laneq_s32(qp->dequant, 1);
+}
+
+// Returns the largest iscan + 1 of the non zero quantized coefficients
+static INLINE int32x4_t quantize_4_neon(const TranLow *coeff_ptr, const int16_t *iscan_ptr,
+                                        TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                        const QuantParamNeon *qp, int log_scale,
+                                        int32x4_t eob) {
+    const int32x4_t coeff = vld1q_s32(coeff_ptr);
+    const int32x4_t sign  = vshrq_n_s32(coeff, 31);
+    const int32x4_t abs   = vabsq_s32(coeff);
+    const uint32x4_t mask =
+        vcgeq_s32(vshlq_s32(abs, vdupq_n_s32(1 + log_scale)), qp->thr);
+    const int32x4_t a   = vminq_s32(vaddq_s32(abs, qp->round), vdupq_n_s32(INT16_MAX));
+    const int32x4_t tmp = vandq_s32(
+        vshlq_s32(vmulq_s32(a, qp->quant), vdupq_n_s32(log_scale - 16)),
+        vreinterpretq_s32_u32(mask));
+    const int32x4_t dq = vshlq_s32(vmulq_s32(tmp, qp->dequant), vdupq_n_s32(-log_scale));
+
+    vst1q_s32(qcoeff_ptr, vsubq_s32(veorq_s32(tmp, sign), sign));
+    vst1q_s32(dqcoeff_ptr, vsubq_s32(veorq_s32(dq, sign), sign));
+
+    const uint32x4_t nz   = vtstq_s32(tmp, tmp);
+    const int32x4_t  scan = vaddq_s32(vmovl_s16(vld1_s16(iscan_ptr)), vdupq_n_s32(1));
+    return vmaxq_s32(eob, vandq_s32(scan, vreinterpretq_s32_u32(nz)));
+}
+
+static INLINE void quantize_fp_neon(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                                    const int16_t *round_ptr, const int16_t *quant_ptr,
+                                    TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                    const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                    const int16_t *iscan_ptr, int log_scale) {
+    QuantParamNeon qp;
+    int32x4_t      eob = vdupq_n_s32(0);
+
+    init_qp(round_ptr, quant_ptr, dequant_ptr, log_scale, &qp);
+    eob = quantize_4_neon(coeff_ptr, iscan_ptr, qcoeff_ptr, dqcoeff_ptr, &qp, log_scale, eob);
+    update_qp(&qp);
+    for (intptr_t i = 4; i < n_coeffs; i += 4)
+        eob = quantize_4_neon(coeff_ptr + i,
+                              iscan_ptr + i,
+                              qcoeff_ptr + i,
+                              dqcoeff_ptr + i,
+                              &qp,
+                              log_scale,
+                              eob);
+    *eob_ptr = (uint16_t)vmaxvq_s32(eob);
+}
+
+void svt_av1_quantize_fp_neon(const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+                              const int16_t *round_ptr, const int16_t *quant_ptr,
+                              const int16_t *quant_shift_ptr, TranLow *qcoeff_ptr,
+                              TranLow *dqcoeff_ptr, const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                              const int16_t *scan_ptr, const int16_t *iscan_ptr) {
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    (void)scan_ptr;
+    quantize_fp_neon(coeff_ptr,
+                     n_coeffs,
+                     round_ptr,
+                     quant_ptr,
+                     qcoeff_ptr,
+                     dqcoeff_ptr,
+                     dequant_ptr,
+                     eob_ptr,
+                     iscan_ptr,
+                     0);
+}
+
+void svt_av1_quantize_fp_32x32_neon(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                                    const int16_t *zbin_ptr, const int16_t *round_ptr,
+                                    const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                    TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                    const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                    const int16_t *scan_ptr, const int16_t *iscan_ptr) {
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    (void)scan_ptr;
+    quantize_fp_neon(coeff_ptr,
+                     n_coeffs,
+                     round_ptr,
+                     quant_ptr,
+                     qcoeff_ptr,
+                     dqcoeff_ptr,
+                     dequant_ptr,
+                     eob_ptr,
+                     iscan_ptr,
+                     1);
+}
+
+void svt_av1_quantize_fp_64x64_neon(const TranLow *coeff_ptr, intptr_t n_coeffs,
+                                    const int16_t *zbin_ptr, const int16_t *round_ptr,
+                                    const int16_t *quant_ptr, const int16_t *quant_shift_ptr,
+                                    TranLow *qcoeff_ptr, TranLow *dqcoeff_ptr,
+                                    const int16_t *dequant_ptr, uint16_t *eob_ptr,
+                                    const int16_t *scan_ptr, const int16_t *iscan_ptr) {
+    (void)zbin_ptr;
+    (void)quant_shift_ptr;
+    (void)scan_ptr;
+    quantize_fp_neon(coeff_ptr,
+                     n_coeffs,
+                     round_ptr,
+                     quant_ptr,
+                     qcoeff_ptr,
+                     dqcoeff_ptr,
+                     dequant_ptr,
+                     eob_ptr,
+                     iscan_ptr,
+                     2);
+}
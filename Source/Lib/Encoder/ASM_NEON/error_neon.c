@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "aom_dsp_rtcd.h"
+#include "synonyms_neon.h"
+
+int svt_aom_satd_neon(const TranLow *coeff, int length) {
+    int32x4_t satd = vdupq_n_s32(0);
+    for (int i = 0; i < length; i += 4) satd = vaddq_s32(satd, vabsq_s32(vld1q_s32(coeff + i)));
+    return horizontal_add_s32x4(satd);
+}
+
+int64_t svt_av1_block_error_neon(const TranLow *coeff, const TranLow *dqcoeff,
+                                 intptr_t block_size, int64_t *ssz) {
+    int64x2_t error   = vdupq_n_s64(0);
+    int64x2_t sqcoeff = vdupq_n_s64(0);
+
+    for (intptr_t i = 0; i < block_size; i += 4) {
+        const int32x4_t c    = vld1q_s32(coeff + i);
+        const int32x4_t diff = vsubq_s32(c, vld1q_s32(dqcoeff + i));
+        error                = vmlal_s32(error, vget_low_s32(diff), vget_low_s32(diff));
+        error                = vmlal_high_s32(error, diff, diff);
+        sqcoeff              = vmlal_s32(sqcoeff, vget_low_s32(c), vget_low_s32(c));
+        sqcoeff              = vmlal_high_s32(sqcoeff, c, c);
+    }
+
+    *ssz = horizontal_add_s64x2(sqcoeff);
+    return horizontal_add_s64x2(error);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include "aom_dsp_rtcd.h"
+#include "synonyms_neon.h"
+
+// Sum and sum of squares of the 8 differences
+static INLINE void variance_8_neon(const uint8x8_t a, const uint8x8_t b, int16x8_t *sum,
+                                   int32x4_t *sse) {
+    const int16x8_t diff = vreinterpretq_s16_u16(vsubl_u8(a, b));
+    *sum                 = vaddq_s16(*sum, diff);
+    *sse = vmlal_s16(*sse, vget_low_s16(diff), vget_low_s16(diff));
+    *sse = vmlal_s16(*sse, vget_high_s16(diff), vget_high_s16(diff));
+}
+
+// The 16 bit sums gain at most 255 per 8 pixels of a lane, they are widened
+// every 8 rows of up to 128 pixels.
+static INLINE void variance_neon(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride,
+                                 int w, int h, uint32_t *sse, int *sum) {
+    int32x4_t sum32 = vdupq_n_s32(0);
+    int32x4_t sse32 = vdupq_n_s32(0);
+
+    for (int i = 0; i < h; i += 8) {
+        int16x8_t sum16 = vdupq_n_s16(0);
+        const int rows  = AOMMIN(8, h - i);
+        if (w == 4) {
+            for (int r = 0; r < rows; r += 2, a += 2 * a_stride, b += 2 * b_stride)
+                variance_8_neon(
+                    load_u8_4x2(a, a_stride), load_u8_4x2(b, b_stride), &sum16, &sse32);
+        } else {
+            for (int r = 0; r < rows; r++, a += a_stride, b += b_stride)
+                for (int j = 0; j < w; j += 8)
+                    variance_8_neon(vld1_u8(a + j), vld1_u8(b + j), &sum16, &sse32);
+        }
+        sum32 = vpadalq_s16(sum32, sum16);
+    }
+    *sum = horizontal_add_s32x4(sum32);
+    *sse = (uint32_t)horizontal_add_s32x4(sse32);
+}
+
+#define VAR_NEON(W, H)                                                                       \
+    uint32_t svt_aom_variance##W##x##H##_neon(                                               \
+        const uint8_t *a, int a_stride, const uint8_t *b, int b_stride, uint32_t *sse) {     \
+        int sum;                                                                             \
+        variance_neon(a, a_stride, b, b_stride, W, H, sse, &sum);                            \
+        return *sse - (uint32_t)(((int64_t)sum * sum) / (W * H));                            \
+    }
+
+VAR_NEON(4, 4)
+VAR_NEON(4, 8)
+VAR_NEON(4, 16)
+VAR_NEON(8, 4)
+VAR_NEON(8, 8)
+VAR_NEON(8, 16)
+VAR_NEON(8, 32)
+VAR_NEON(16, 4)
+VAR_NEON(16, 8)
+VAR_NEON(16, 16)
+VAR_NEON(16, 32)
+VAR_NEON(16, 64)
+VAR_NEON(32, 8)
+VAR_NEON(32, 16)
+VAR_NEON(32, 32)
+VAR_NEON(32, 64)
+VAR_NEON(64, 16)
+VAR_NEON(64, 32)
+VAR_NEON(64, 64)
+VAR_NEON(64, 128)
+VAR_NEON(128, 64)
+VAR_NEON(128, 128)
+
+uint32_t svt_aom_mse16x16_neon(const uint8_t *src_ptr, int32_t source_stride,
+                               const uint8_t *ref_ptr, int32_t recon_stride, uint32_t *sse) {
+    return svt_aom_variance16x16_neon(src_ptr, source_stride, ref_ptr, recon_stride, sse);
+}
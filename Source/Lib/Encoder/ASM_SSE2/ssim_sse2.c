@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <emmintrin.h>
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+static INLINE uint32_t hadd_epi32_sse2(const __m128i v) {
+    const __m128i s = _mm_add_epi32(v, _mm_srli_si128(v, 8));
+    return (uint32_t)_mm_cvtsi128_si32(_mm_add_epi32(s, _mm_srli_si128(s, 4)));
+}
+
+// Adds the sums of the 16 bit pixels s and r of one 8 pixel row to the totals.
+static INLINE void ssim_parms_row_sse2(const __m128i s, const __m128i r, __m128i *sum_s,
+                                       __m128i *sum_r, __m128i *sum_sq_s, __m128i *sum_sq_r,
+                                       __m128i *sum_sxr) {
+    const __m128i one = _mm_set1_epi16(1);
+    *sum_s            = _mm_add_epi32(*sum_s, _mm_madd_epi16(s, one));
+    *sum_r            = _mm_add_epi32(*sum_r, _mm_madd_epi16(r, one));
+    *sum_sq_s         = _mm_add_epi32(*sum_sq_s, _mm_madd_epi16(s, s));
+    *sum_sq_r         = _mm_add_epi32(*sum_sq_r, _mm_madd_epi16(r, r));
+    *sum_sxr          = _mm_add_epi32(*sum_sxr, _mm_madd_epi16(s, r));
+}
+
+static INLINE void ssim_parms_store_sse2(const __m128i v_sum_s, const __m128i v_sum_r,
+                                         const __m128i v_sum_sq_s, const __m128i v_sum_sq_r,
+                                         const __m128i v_sum_sxr, uint32_t *sum_s,
+                                         uint32_t *sum_r, uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                                         uint32_t *sum_sxr) {
+    *sum_s += hadd_epi32_sse2(v_sum_s);
+    *sum_r += hadd_epi32_sse2(v_sum_r);
+    *sum_sq_s += hadd_epi32_sse2(v_sum_sq_s);
+    *sum_sq_r += hadd_epi32_sse2(v_sum_sq_r);
+    *sum_sxr += hadd_epi32_sse2(v_sum_sxr);
+}
+
+void svt_aom_ssim_parms_8x8_sse2(const uint8_t *s, int sp, const uint8_t *r, int rp,
+                                 uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s,
+                                 uint32_t *sum_sq_r, uint32_t *sum_sxr) {
+    const __m128i zero     = _mm_setzero_si128();
+    __m128i       v_sum_s  = _mm_setzero_si128();
+    __m128i       v_sum_r  = _mm_setzero_si128();
+    __m128i       v_sq_s   = _mm_setzero_si128();
+    __m128i       v_sq_r   = _mm_setzero_si128();
+    __m128i       v_sum_sr = _mm_setzero_si128();
+
+    for (int i = 0; i < 8; i++, s += sp, r += rp) {
+        const __m128i vs = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)s), zero);
+        const __m128i vr = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)r), zero);
+        ssim_parms_row_sse2(vs, vr, &v_sum_s, &v_sum_r, &v_sq_s, &v_sq_r, &v_sum_sr);
+    }
+    ssim_parms_store_sse2(
+        v_sum_s, v_sum_r, v_sq_s, v_sq_r, v_sum_sr, sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr);
+}
+
+// The pixels are at most 12 bit, so that the products of pmaddwd and their
+// sums over the 64 pixels stay within 32 bits.
+void svt_aom_highbd_ssim_parms_8x8_sse2(const uint16_t *s, int sp, const uint16_t *r, int rp,
+                                        uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s,
+                                        uint32_t *sum_sq_r, uint32_t *sum_sxr) {
+    __m128i v_sum_s  = _mm_setzero_si128();
+    __m128i v_sum_r  = _mm_setzero_si128();
+    __m128i v_sq_s   = _mm_setzero_si128();
+    __m128i v_sq_r   = _mm_setzero_si128();
+    __m128i v_sum_sr = _mm_setzero_si128();
+
+    for (int i = 0; i < 8; i++, s += sp, r += rp) {
+        const __m128i vs = _mm_loadu_si128((const __m128i *)s);
+        const __m128i vr = _mm_loadu_si128((const __m128i *)r);
+        ssim_parms_row_sse2(vs, vr, &v_sum_s, &v_sum_r, &v_sq_s, &v_sq_r, &v_sum_sr);
+    }
+    ssim_parms_store_sse2(
+        v_sum_s, v_sum_r, v_sq_s, v_sq_r, v_sum_sr, sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr);
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2016, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <smmintrin.h> /* SSE4.1 */
+
+#include "EbDefinitions.h"
+#include "aom_dsp_rtcd.h"
+
+static INLINE void variance_accumulate_sse4_1(const __m128i a, const __m128i b, __m128i *sum,
+                                              __m128i *sse) {
+    const __m128i diff = _mm_sub_epi16(a, b);
+    *sum               = _mm_add_epi32(*sum, _mm_madd_epi16(diff, _mm_set1_epi16(1)));
+    *sse               = _mm_add_epi32(*sse, _mm_madd_epi16(diff, diff));
+}
+
+/*
+* Sum and sum of square differences of 4xh and 8xh blocks of up to 12 bit
+* samples, the 32 bit lanes can't overflow for these sizes.
+*/
+static INLINE void highbd_calc_var_sse4_1(const uint16_t *src, int src_stride, const uint16_t *ref,
+                                          int ref_stride, int w, int h, uint32_t *sse, int *sum) {
+    __m128i v_sum = _mm_setzero_si128();
+    __m128i v_sse = _mm_setzero_si128();
+
+    if (w == 4) {
+        for (int i = 0; i < h; i += 2) {
+            const __m128i a = _mm_unpacklo_epi64(
+                _mm_loadl_epi64((const __m128i *)src),
+                _mm_loadl_epi64((const __m128i *)(src + src_stride)));
+            const __m128i b = _mm_unpacklo_epi64(
+                _mm_loadl_epi64((const __m128i *)ref),
+                _mm_loadl_epi64((const __m128i *)(ref + ref_stride)));
+            variance_accumulate_sse4_1(a, b, &v_sum, &v_sse);
+            src += 2 * src_stride;
+            ref += 2 * ref_stride;
+        }
+    } else {
+        assert(w == 8);
+        for (int i = 0; i < h; i++) {
+            variance_accumulate_sse4_1(_mm_loadu_si128((const __m128i *)src),
+                                       _mm_loadu_si128((const __m128i *)ref),
+                                       &v_sum,
+                                       &v_sse);
+            src += src_stride;
+            ref += ref_stride;
+        }
+    }
+
+    // lanes 0, 1: sum, lanes 2, 3: sse
+    __m128i v_d = _mm_hadd_epi32(v_sum, v_sse);
+    v_d         = _mm_hadd_epi32(v_d, v_d);
+    *sum        = _mm_extract_epi32(v_d, 0);
+    *sse        = (uint32_t)_mm_extract_epi32(v_d, 1);
+}
+
+#define VAR_FN(w, h, shift)                                                                        \
+    uint32_t svt_aom_highbd_10_variance##w##x##h##_sse4_1(                                         \
+        const uint8_t *src8, int src_stride, const uint8_t *ref8, int ref_stride, uint32_t *sse) { \
+        int       sum;                                                                             \
+        int64_t   var;                                                                             \
+        uint16_t *src = CONVERT_TO_SHORTPTR(src8);                                                 \
+        uint16_t *ref = CONVERT_TO_SHORTPTR(ref8);                                                 \
+        highbd_calc_var_sse4_1(src, src_stride, ref, ref_stride, w, h, sse, &sum);                 \
+        sum  = ROUND_POWER_OF_TWO(sum, 2);                                                         \
+        *sse = ROUND_POWER_OF_TWO(*sse, 4);                                                        \
+        var  = (int64_t)(*sse) - (((int64_t)sum * sum) >> shift);                                  \
+        return (var >= 0) ? (uint32_t)var : 0;                                                     \
+    }
+
+VAR_FN(4, 4, 4);
+VAR_FN(4, 8, 5);
+VAR_FN(4, 16, 6);
+VAR_FN(8, 4, 5);
+
+#undef VAR_FN
@@ -95,6 +95,31 @@ void svt_sad_loop_kernel_c(
     return;
 }
 
+/* Full pel search of one source block in several search areas, e.g. the search
+ * regions of all the references of a HME level. */
+void svt_sad_loop_kernel_multi_c(uint8_t *src, uint32_t src_stride, uint32_t block_height,
+                                 uint32_t block_width, SadLoopSearchArea *search_areas,
+                                 uint32_t num_search_areas) {
+    for (uint32_t i = 0; i < num_search_areas; i++) {
+        SadLoopSearchArea *const area = &search_areas[i];
+
+        area->x_best = 0;
+        area->y_best = 0;
+        svt_sad_loop_kernel_c(src,
+                              src_stride,
+                              area->ref,
+                              area->ref_stride,
+                              block_height,
+                              block_width,
+                              &area->best_sad,
+                              &area->x_best,
+                              &area->y_best,
+                              area->ref_stride_raw,
+                              area->width,
+                              area->height);
+    }
+}
+
 /* Sum the difference between every corresponding element of the buffers. */
 static INLINE uint32_t sad_inline_c(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride,
                                     int width, int height) {
@@ -33,6 +33,9 @@ void     svt_sad_loop_kernel_c(
         uint64_t *best_sad, int16_t *x_search_center, int16_t *y_search_center,
         uint32_t src_stride_raw, // input parameter, source stride (no line skipping)
         int16_t search_area_width, int16_t search_area_height);
+void svt_sad_loop_kernel_multi_c(uint8_t *src, uint32_t src_stride, uint32_t block_height,
+                                 uint32_t block_width, SadLoopSearchArea *search_areas,
+                                 uint32_t num_search_areas);
 
 uint32_t svt_nxm_sad_kernel_helper_c(const uint8_t *src, uint32_t src_stride, const uint8_t *ref,
                                      uint32_t ref_stride, uint32_t height, uint32_t width);
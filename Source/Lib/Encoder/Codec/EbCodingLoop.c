@@ -1296,6 +1296,143 @@ void store16bit_input_src(EbPictureBufferDesc *input_sample16bit_buffer, Picture
                sb_w * 2);
 }
 
+/*
+ * Packs the 8 bit and the 2 bit planes of the SB input into the 16 bit source,
+ * written to both input_sample16bit_buffer and input_frame16bit. Done once per
+ * SB, before the MD passes, which read input_frame16bit, and the encode pass,
+ * which reads input_sample16bit_buffer.
+ */
+void pack16bit_input_src(SequenceControlSet *scs_ptr, PictureControlSet *pcs_ptr,
+                         EbPictureBufferDesc *input_sample16bit_buffer, uint32_t sb_origin_x,
+                         uint32_t sb_origin_y) {
+    EbPictureBufferDesc *input_picture = pcs_ptr->parent_pcs_ptr->enhanced_picture_ptr;
+    const uint32_t       sb_width =
+        MIN(scs_ptr->sb_size_pix, pcs_ptr->parent_pcs_ptr->aligned_width - sb_origin_x);
+    const uint32_t sb_height =
+        MIN(scs_ptr->sb_size_pix, pcs_ptr->parent_pcs_ptr->aligned_height - sb_origin_y);
+
+    if ((scs_ptr->static_config.ten_bit_format == 1) ||
+        (scs_ptr->static_config.compressed_ten_bit_format == 1)) {
+        const uint32_t input_luma_offset =
+            ((sb_origin_y + input_picture->origin_y) * input_picture->stride_y) +
+            (sb_origin_x + input_picture->origin_x);
+        const uint32_t input_cb_offset =
+            (((sb_origin_y + input_picture->origin_y) >> 1) * input_picture->stride_cb) +
+            ((sb_origin_x + input_picture->origin_x) >> 1);
+        const uint32_t input_cr_offset =
+            (((sb_origin_y + input_picture->origin_y) >> 1) * input_picture->stride_cr) +
+            ((sb_origin_x + input_picture->origin_x) >> 1);
+        const uint16_t luma_2bit_width = input_picture->width / 4;
+        const uint16_t chroma_2bit_width = input_picture->width / 8;
+
+        compressed_pack_sb(input_picture->buffer_y + input_luma_offset,
+                           input_picture->stride_y,
+                           input_picture->buffer_bit_inc_y + sb_origin_y * luma_2bit_width +
+                               (sb_origin_x / 4) * sb_height,
+                           sb_width / 4,
+                           (uint16_t *)input_sample16bit_buffer->buffer_y,
+                           input_sample16bit_buffer->stride_y,
+                           sb_width,
+                           sb_height);
+
+        compressed_pack_sb(input_picture->buffer_cb + input_cb_offset,
+                           input_picture->stride_cb,
+                           input_picture->buffer_bit_inc_cb +
+                               sb_origin_y / 2 * chroma_2bit_width +
+                               (sb_origin_x / 8) * (sb_height / 2),
+                           sb_width / 8,
+                           (uint16_t *)input_sample16bit_buffer->buffer_cb,
+                           input_sample16bit_buffer->stride_cb,
+                           sb_width >> 1,
+                           sb_height >> 1);
+
+        compressed_pack_sb(input_picture->buffer_cr + input_cr_offset,
+                           input_picture->stride_cr,
+                           input_picture->buffer_bit_inc_cr +
+                               sb_origin_y / 2 * chroma_2bit_width +
+                               (sb_origin_x / 8) * (sb_height / 2),
+                           sb_width / 8,
+                           (uint16_t *)input_sample16bit_buffer->buffer_cr,
+                           input_sample16bit_buffer->stride_cr,
+                           sb_width >> 1,
+                           sb_height >> 1);
+    } else {
+        const uint32_t input_luma_offset =
+            ((sb_origin_y + input_picture->origin_y) * input_picture->stride_y) +
+            (sb_origin_x + input_picture->origin_x);
+        const uint32_t input_bit_inc_luma_offset =
+            ((sb_origin_y + input_picture->origin_y) * input_picture->stride_bit_inc_y) +
+            (sb_origin_x + input_picture->origin_x);
+        const uint32_t input_cb_offset =
+            (((sb_origin_y + input_picture->origin_y) >> 1) * input_picture->stride_cb) +
+            ((sb_origin_x + input_picture->origin_x) >> 1);
+        const uint32_t input_bit_inc_cb_offset =
+            (((sb_origin_y + input_picture->origin_y) >> 1) *
+             input_picture->stride_bit_inc_cb) +
+            ((sb_origin_x + input_picture->origin_x) >> 1);
+        const uint32_t input_cr_offset =
+            (((sb_origin_y + input_picture->origin_y) >> 1) * input_picture->stride_cr) +
+            ((sb_origin_x + input_picture->origin_x) >> 1);
+        const uint32_t input_bit_inc_cr_offset =
+            (((sb_origin_y + input_picture->origin_y) >> 1) *
+             input_picture->stride_bit_inc_cr) +
+            ((sb_origin_x + input_picture->origin_x) >> 1);
+
+        pack2d_src(input_picture->buffer_y + input_luma_offset,
+                   input_picture->stride_y,
+                   input_picture->buffer_bit_inc_y + input_bit_inc_luma_offset,
+                   input_picture->stride_bit_inc_y,
+                   (uint16_t *)input_sample16bit_buffer->buffer_y,
+                   input_sample16bit_buffer->stride_y,
+                   sb_width,
+                   sb_height);
+
+        pack2d_src(input_picture->buffer_cb + input_cb_offset,
+                   input_picture->stride_cr,
+                   input_picture->buffer_bit_inc_cb + input_bit_inc_cb_offset,
+                   input_picture->stride_bit_inc_cr,
+                   (uint16_t *)input_sample16bit_buffer->buffer_cb,
+                   input_sample16bit_buffer->stride_cb,
+                   sb_width >> 1,
+                   sb_height >> 1);
+
+        pack2d_src(input_picture->buffer_cr + input_cr_offset,
+                   input_picture->stride_cr,
+                   input_picture->buffer_bit_inc_cr + input_bit_inc_cr_offset,
+                   input_picture->stride_bit_inc_cr,
+                   (uint16_t *)input_sample16bit_buffer->buffer_cr,
+                   input_sample16bit_buffer->stride_cr,
+                   sb_width >> 1,
+                   sb_height >> 1);
+        // PAD the packed source in incomplete sb up to max SB size
+        pad_input_picture_16bit((uint16_t *)input_sample16bit_buffer->buffer_y,
+                                input_sample16bit_buffer->stride_y,
+                                sb_width,
+                                sb_height,
+                                scs_ptr->sb_size_pix - sb_width,
+                                scs_ptr->sb_size_pix - sb_height);
+        pad_input_picture_16bit((uint16_t *)input_sample16bit_buffer->buffer_cb,
+                                input_sample16bit_buffer->stride_cb,
+                                sb_width >> 1,
+                                sb_height >> 1,
+                                (scs_ptr->sb_size_pix - sb_width) >> 1,
+                                (scs_ptr->sb_size_pix - sb_height) >> 1);
+        pad_input_picture_16bit((uint16_t *)input_sample16bit_buffer->buffer_cr,
+                                input_sample16bit_buffer->stride_cr,
+                                sb_width >> 1,
+                                sb_height >> 1,
+                                (scs_ptr->sb_size_pix - sb_width) >> 1,
+                                (scs_ptr->sb_size_pix - sb_height) >> 1);
+    }
+
+    store16bit_input_src(input_sample16bit_buffer,
+                         pcs_ptr,
+                         sb_origin_x,
+                         sb_origin_y,
+                         scs_ptr->sb_size_pix,
+                         scs_ptr->sb_size_pix);
+}
+
 void update_av1_mi_map(BlkStruct *blk_ptr, uint32_t blk_origin_x, uint32_t blk_origin_y,
                        const BlockGeom *blk_geom, PictureControlSet *pcs_ptr);
 
@@ -2050,135 +2187,6 @@ EB_EXTERN void av1_encode_decode(SequenceControlSet *scs_ptr, PictureControlSet
     else // non ref pictures
         recon_buffer = is_16bit ? pcs_ptr->recon_picture16bit_ptr : pcs_ptr->recon_picture_ptr;
 
-    if (is_16bit && scs_ptr->static_config.encoder_bit_depth > EB_8BIT) {
-        //SB128_TODO change 10bit SB creation
-
-        if ((scs_ptr->static_config.ten_bit_format == 1) ||
-            (scs_ptr->static_config.compressed_ten_bit_format == 1)) {
-            const uint32_t input_luma_offset =
-                ((sb_origin_y + input_picture->origin_y) * input_picture->stride_y) +
-                (sb_origin_x + input_picture->origin_x);
-            const uint32_t input_cb_offset =
-                (((sb_origin_y + input_picture->origin_y) >> 1) * input_picture->stride_cb) +
-                ((sb_origin_x + input_picture->origin_x) >> 1);
-            const uint32_t input_cr_offset =
-                (((sb_origin_y + input_picture->origin_y) >> 1) * input_picture->stride_cr) +
-                ((sb_origin_x + input_picture->origin_x) >> 1);
-            const uint16_t luma_2bit_width = input_picture->width / 4;
-            const uint16_t chroma_2bit_width = input_picture->width / 8;
-
-            compressed_pack_sb(input_picture->buffer_y + input_luma_offset,
-                               input_picture->stride_y,
-                               input_picture->buffer_bit_inc_y + sb_origin_y * luma_2bit_width +
-                                   (sb_origin_x / 4) * sb_height,
-                               sb_width / 4,
-                               (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_y,
-                               context_ptr->input_sample16bit_buffer->stride_y,
-                               sb_width,
-                               sb_height);
-
-            compressed_pack_sb(input_picture->buffer_cb + input_cb_offset,
-                               input_picture->stride_cb,
-                               input_picture->buffer_bit_inc_cb +
-                                   sb_origin_y / 2 * chroma_2bit_width +
-                                   (sb_origin_x / 8) * (sb_height / 2),
-                               sb_width / 8,
-                               (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_cb,
-                               context_ptr->input_sample16bit_buffer->stride_cb,
-                               sb_width >> 1,
-                               sb_height >> 1);
-
-            compressed_pack_sb(input_picture->buffer_cr + input_cr_offset,
-                               input_picture->stride_cr,
-                               input_picture->buffer_bit_inc_cr +
-                                   sb_origin_y / 2 * chroma_2bit_width +
-                                   (sb_origin_x / 8) * (sb_height / 2),
-                               sb_width / 8,
-                               (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_cr,
-                               context_ptr->input_sample16bit_buffer->stride_cr,
-                               sb_width >> 1,
-                               sb_height >> 1);
-        } else {
-            const uint32_t input_luma_offset =
-                ((sb_origin_y + input_picture->origin_y) * input_picture->stride_y) +
-                (sb_origin_x + input_picture->origin_x);
-            const uint32_t input_bit_inc_luma_offset =
-                ((sb_origin_y + input_picture->origin_y) * input_picture->stride_bit_inc_y) +
-                (sb_origin_x + input_picture->origin_x);
-            const uint32_t input_cb_offset =
-                (((sb_origin_y + input_picture->origin_y) >> 1) * input_picture->stride_cb) +
-                ((sb_origin_x + input_picture->origin_x) >> 1);
-            const uint32_t input_bit_inc_cb_offset =
-                (((sb_origin_y + input_picture->origin_y) >> 1) *
-                 input_picture->stride_bit_inc_cb) +
-                ((sb_origin_x + input_picture->origin_x) >> 1);
-            const uint32_t input_cr_offset =
-                (((sb_origin_y + input_picture->origin_y) >> 1) * input_picture->stride_cr) +
-                ((sb_origin_x + input_picture->origin_x) >> 1);
-            const uint32_t input_bit_inc_cr_offset = (((sb_origin_y + input_picture->origin_y) >> 1) *
-                                                  input_picture->stride_bit_inc_cr) +
-                                                 ((sb_origin_x + input_picture->origin_x) >> 1);
-
-            pack2d_src(input_picture->buffer_y + input_luma_offset,
-                       input_picture->stride_y,
-                       input_picture->buffer_bit_inc_y + input_bit_inc_luma_offset,
-                       input_picture->stride_bit_inc_y,
-                       (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_y,
-                       context_ptr->input_sample16bit_buffer->stride_y,
-                       sb_width,
-                       sb_height);
-
-            pack2d_src(input_picture->buffer_cb + input_cb_offset,
-                       input_picture->stride_cr,
-                       input_picture->buffer_bit_inc_cb + input_bit_inc_cb_offset,
-                       input_picture->stride_bit_inc_cr,
-                       (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_cb,
-                       context_ptr->input_sample16bit_buffer->stride_cb,
-                       sb_width >> 1,
-                       sb_height >> 1);
-
-            pack2d_src(input_picture->buffer_cr + input_cr_offset,
-                       input_picture->stride_cr,
-                       input_picture->buffer_bit_inc_cr + input_bit_inc_cr_offset,
-                       input_picture->stride_bit_inc_cr,
-                       (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_cr,
-                       context_ptr->input_sample16bit_buffer->stride_cr,
-                       sb_width >> 1,
-                       sb_height >> 1);
-        // PAD the packed source in incomplete sb up to max SB size
-        pad_input_picture_16bit(
-                (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_y,
-                context_ptr->input_sample16bit_buffer->stride_y,
-                sb_width,
-                sb_height,
-                scs_ptr->sb_size_pix - sb_width,
-                scs_ptr->sb_size_pix - sb_height);
-        pad_input_picture_16bit(
-                (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_cb,
-                context_ptr->input_sample16bit_buffer->stride_cb,
-                sb_width >> 1,
-                sb_height >> 1,
-                (scs_ptr->sb_size_pix- sb_width  )>>1,
-                (scs_ptr->sb_size_pix - sb_height)>>1);
-
-        pad_input_picture_16bit(
-                (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_cr,
-                context_ptr->input_sample16bit_buffer->stride_cr,
-                sb_width >> 1,
-                sb_height >> 1,
-                (scs_ptr->sb_size_pix - sb_width  )>>1,
-                (scs_ptr->sb_size_pix  - sb_height)>>1);
-        }
-
-        if (context_ptr->md_context->hbd_mode_decision == 0)
-            store16bit_input_src(context_ptr->input_sample16bit_buffer,
-                                 pcs_ptr,
-                                 sb_origin_x,
-                                 sb_origin_y,
-                                 scs_ptr->sb_size_pix,
-                                 scs_ptr->sb_size_pix);
-    }
-
     if (is_16bit && scs_ptr->static_config.encoder_bit_depth == EB_8BIT) {
         const uint32_t input_luma_offset =
             ((sb_origin_y + input_picture->origin_y) * input_picture->stride_y) +
@@ -40,6 +40,9 @@ void no_enc_dec_pass(SequenceControlSet *scs_ptr, PictureControlSet *pcs_ptr, Su
 
 void store16bit_input_src(EbPictureBufferDesc *input_sample16bit_buffer, PictureControlSet *pcs_ptr,
                           uint32_t sb_x, uint32_t sb_y, uint32_t sb_w, uint32_t sb_h);
+void pack16bit_input_src(SequenceControlSet *scs_ptr, PictureControlSet *pcs_ptr,
+                         EbPictureBufferDesc *input_sample16bit_buffer, uint32_t sb_origin_x,
+                         uint32_t sb_origin_y);
 
 void residual_kernel(uint8_t *input, uint32_t input_offset, uint32_t input_stride, uint8_t *pred,
                      uint32_t pred_offset, uint32_t pred_stride, int16_t *residual,
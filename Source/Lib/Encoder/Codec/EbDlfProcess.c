@@ -109,6 +109,7 @@ void *dlf_kernel(void *input_ptr) {
         enc_dec_results_ptr = (EncDecResults *)enc_dec_results_wrapper_ptr->object_ptr;
         pcs_ptr             = (PictureControlSet *)enc_dec_results_ptr->pcs_wrapper_ptr->object_ptr;
         scs_ptr             = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+        svt_aom_mark_frame_stats_stage(pcs_ptr->parent_pcs_ptr, EB_FRAME_STATS_LOOP_FILTER);
 
         EbBool is_16bit = (EbBool)(scs_ptr->static_config.encoder_bit_depth > EB_8BIT);
 
@@ -574,882 +574,6 @@ void recon_output(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr) {
     svt_release_mutex(encode_context_ptr->total_number_of_recon_frame_mutex);
 }
 
-//************************************/
-// Calculate Frame SSIM
-/************************************/
-
-void aom_ssim_parms_8x8_c(const uint8_t *s, int sp, const uint8_t *r, int rp,
-                          uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s,
-                          uint32_t *sum_sq_r, uint32_t *sum_sxr) {
-  int i, j;
-  for (i = 0; i < 8; i++, s += sp, r += rp) {
-    for (j = 0; j < 8; j++) {
-      *sum_s += s[j];
-      *sum_r += r[j];
-      *sum_sq_s += s[j] * s[j];
-      *sum_sq_r += r[j] * r[j];
-      *sum_sxr += s[j] * r[j];
-    }
-  }
-}
-
-void aom_highbd_ssim_parms_8x8_c(const uint8_t *s, int sp, const uint8_t *sinc, int spinc, const uint16_t *r,
-                                 int rp, uint32_t *sum_s, uint32_t *sum_r,
-                                 uint32_t *sum_sq_s, uint32_t *sum_sq_r,
-                                 uint32_t *sum_sxr) {
-  int i, j;
-  uint32_t ss;
-  for (i = 0; i < 8; i++, s += sp, sinc += spinc, r += rp) {
-    for (j = 0; j < 8; j++) {
-      ss = (int64_t)(s[j] << 2) + ((sinc[j]>>6)&0x3);
-      *sum_s += ss;
-      *sum_r += r[j];
-      *sum_sq_s += ss * ss;
-      *sum_sq_r += r[j] * r[j];
-      *sum_sxr += ss * r[j];
-    }
-  }
-}
-
-static const int64_t cc1 = 26634;        // (64^2*(.01*255)^2
-static const int64_t cc2 = 239708;       // (64^2*(.03*255)^2
-static const int64_t cc1_10 = 428658;    // (64^2*(.01*1023)^2
-static const int64_t cc2_10 = 3857925;   // (64^2*(.03*1023)^2
-static const int64_t cc1_12 = 6868593;   // (64^2*(.01*4095)^2
-static const int64_t cc2_12 = 61817334;  // (64^2*(.03*4095)^2
-
-static double similarity(uint32_t sum_s, uint32_t sum_r, uint32_t sum_sq_s,
-                         uint32_t sum_sq_r, uint32_t sum_sxr, int count,
-                         uint32_t bd) {
-  double ssim_n, ssim_d;
-  int64_t c1, c2;
-
-  if (bd == 8) {
-    // scale the constants by number of pixels
-    c1 = (cc1 * count * count) >> 12;
-    c2 = (cc2 * count * count) >> 12;
-  } else if (bd == 10) {
-    c1 = (cc1_10 * count * count) >> 12;
-    c2 = (cc2_10 * count * count) >> 12;
-  } else if (bd == 12) {
-    c1 = (cc1_12 * count * count) >> 12;
-    c2 = (cc2_12 * count * count) >> 12;
-  } else {
-    c1 = c2 = 0;
-    assert(0);
-  }
-
-  ssim_n = (2.0 * sum_s * sum_r + c1) *
-           (2.0 * count * sum_sxr - 2.0 * sum_s * sum_r + c2);
-
-  ssim_d = ((double)sum_s * sum_s + (double)sum_r * sum_r + c1) *
-           ((double)count * sum_sq_s - (double)sum_s * sum_s +
-            (double)count * sum_sq_r - (double)sum_r * sum_r + c2);
-
-  return ssim_n / ssim_d;
-}
-
-static double ssim_8x8(const uint8_t *s, int sp, const uint8_t *r, int rp) {
-  uint32_t sum_s = 0, sum_r = 0, sum_sq_s = 0, sum_sq_r = 0, sum_sxr = 0;
-  aom_ssim_parms_8x8_c(s, sp, r, rp, &sum_s, &sum_r, &sum_sq_s, &sum_sq_r, &sum_sxr);
-  return similarity(sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr, 64, 8);
-}
-
-static double highbd_ssim_8x8(const uint8_t *s, int sp, const uint8_t *sinc, int spinc, const uint16_t *r,
-                              int rp, uint32_t bd, uint32_t shift) {
-  uint32_t sum_s = 0, sum_r = 0, sum_sq_s = 0, sum_sq_r = 0, sum_sxr = 0;
-  aom_highbd_ssim_parms_8x8_c(s, sp, sinc, spinc, r, rp, &sum_s, &sum_r, &sum_sq_s, &sum_sq_r, &sum_sxr);
-  return similarity(sum_s >> shift, sum_r >> shift, sum_sq_s >> (2 * shift),
-                    sum_sq_r >> (2 * shift), sum_sxr >> (2 * shift), 64, bd);
-}
-
-// We are using a 8x8 moving window with starting location of each 8x8 window
-// on the 4x4 pixel grid. Such arrangement allows the windows to overlap
-// block boundaries to penalize blocking artifacts.
-static double aom_ssim2(const uint8_t *img1, int stride_img1,
-                        const uint8_t *img2, int stride_img2,
-                        int width, int height) {
-    int i, j;
-    int samples = 0;
-    double ssim_total = 0;
-
-    // sample point start with each 4x4 location
-    for (i = 0; i <= height - 8;
-        i += 4, img1 += stride_img1 * 4, img2 += stride_img2 * 4) {
-        for (j = 0; j <= width - 8; j += 4) {
-            double v = ssim_8x8(img1 + j, stride_img1, img2 + j, stride_img2);
-            ssim_total += v;
-            samples++;
-        }
-    }
-    assert(samples > 0);
-    ssim_total /= samples;
-    return ssim_total;
-}
-
-static double aom_highbd_ssim2(const uint8_t *img1, int stride_img1,
-                               const uint8_t *img1inc, int stride_img1inc,
-                               const uint16_t *img2, int stride_img2,
-                               int width, int height, uint32_t bd, uint32_t shift) {
-  int i, j;
-  int samples = 0;
-  double ssim_total = 0;
-
-  // sample point start with each 4x4 location
-  for (i = 0; i <= height - 8;
-       i += 4, img1 += stride_img1 * 4, img1inc += stride_img1inc * 4, img2 += stride_img2 * 4) {
-    for (j = 0; j <= width - 8; j += 4) {
-      double v = highbd_ssim_8x8((img1 + j), stride_img1,
-                                 (img1inc + j), stride_img1inc,
-                                 (img2 + j), stride_img2, bd,
-                                 shift);
-      ssim_total += v;
-      samples++;
-    }
-  }
-  assert(samples > 0);
-  ssim_total /= samples;
-  return ssim_total;
-}
-
-void ssim_calculations(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr, EbBool free_memory) {
-    EbBool is_16bit = (scs_ptr->static_config.encoder_bit_depth > EB_8BIT);
-
-    const uint32_t ss_x = scs_ptr->subsampling_x;
-    const uint32_t ss_y = scs_ptr->subsampling_y;
-
-    if (!is_16bit) {
-        EbPictureBufferDesc *recon_ptr;
-
-        if (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
-            recon_ptr = ((EbReferenceObject*)pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)->reference_picture;
-        else
-            recon_ptr = pcs_ptr->recon_picture_ptr;
-
-        EbPictureBufferDesc *input_picture_ptr = (EbPictureBufferDesc*)pcs_ptr->parent_pcs_ptr->enhanced_picture_ptr;
-
-        EbByte  input_buffer;
-        EbByte  recon_coeff_buffer;
-
-        EbByte buffer_y;
-        EbByte buffer_cb;
-        EbByte buffer_cr;
-
-        double luma_ssim = 0.0;
-        double cb_ssim = 0.0;
-        double cr_ssim = 0.0;
-
-        // if current source picture was temporally filtered, use an alternative buffer which stores
-        // the original source picture
-        if(pcs_ptr->parent_pcs_ptr->temporal_filtering_on == EB_TRUE){
-            buffer_y = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[0];
-            buffer_cb = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[1];
-            buffer_cr = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[2];
-        }
-        else {
-            buffer_y = input_picture_ptr->buffer_y;
-            buffer_cb = input_picture_ptr->buffer_cb;
-            buffer_cr = input_picture_ptr->buffer_cr;
-        }
-
-        recon_coeff_buffer = &((recon_ptr->buffer_y)[recon_ptr->origin_x + recon_ptr->origin_y * recon_ptr->stride_y]);
-        input_buffer = &(buffer_y[input_picture_ptr->origin_x + input_picture_ptr->origin_y * input_picture_ptr->stride_y]);
-        luma_ssim = aom_ssim2(input_buffer, input_picture_ptr->stride_y, recon_coeff_buffer, recon_ptr->stride_y,
-                              scs_ptr->seq_header.max_frame_width, scs_ptr->seq_header.max_frame_height);
-
-        recon_coeff_buffer = &((recon_ptr->buffer_cb)[recon_ptr->origin_x / 2 + recon_ptr->origin_y / 2 * recon_ptr->stride_cb]);
-        input_buffer = &(buffer_cb[input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cb]);
-        cb_ssim = aom_ssim2(input_buffer, input_picture_ptr->stride_cb, recon_coeff_buffer, recon_ptr->stride_cb,
-                            scs_ptr->chroma_width, scs_ptr->chroma_height);
-
-        recon_coeff_buffer = &((recon_ptr->buffer_cr)[recon_ptr->origin_x / 2 + recon_ptr->origin_y / 2 * recon_ptr->stride_cr]);
-        input_buffer = &(buffer_cr[input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cr]);
-        cr_ssim = aom_ssim2(input_buffer, input_picture_ptr->stride_cr, recon_coeff_buffer, recon_ptr->stride_cr,
-                            scs_ptr->chroma_width, scs_ptr->chroma_height);
-
-        pcs_ptr->parent_pcs_ptr->luma_ssim = luma_ssim;
-        pcs_ptr->parent_pcs_ptr->cb_ssim = cb_ssim;
-        pcs_ptr->parent_pcs_ptr->cr_ssim = cr_ssim;
-
-        if (free_memory && pcs_ptr->parent_pcs_ptr->temporal_filtering_on == EB_TRUE) {
-            EB_FREE_ARRAY(buffer_y);
-            EB_FREE_ARRAY(buffer_cb);
-            EB_FREE_ARRAY(buffer_cr);
-        }
-    }
-    else {
-      EbPictureBufferDesc *recon_ptr;
-
-        if (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
-            recon_ptr = ((EbReferenceObject*)pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)->reference_picture16bit;
-        else
-            recon_ptr = pcs_ptr->recon_picture16bit_ptr;
-        EbPictureBufferDesc *input_picture_ptr = (EbPictureBufferDesc*)pcs_ptr->parent_pcs_ptr->enhanced_picture_ptr;
-
-        EbByte    input_buffer;
-        uint16_t *recon_coeff_buffer;
-
-        double luma_ssim = 0.0;
-        double cb_ssim = 0.0;
-        double cr_ssim = 0.0;
-
-        if (scs_ptr->static_config.ten_bit_format == 1) {
-
-            /* SSIM calculation for compressed 10-bit format has not been verified and debugged,
-               since this format is not supported elsewhere in this version. See verify_settings(),
-               which exits with an error if compressed 10-bit format is enabled. To avoid
-               extra complexity of unpacking into a temporary buffer, or having to write
-               new core SSIM functions, we ignore the two least signifcant bits in this
-               case, and set these to zero. One test shows a difference in SSIM
-               of 0.00085 setting the two least significant bits to zero. */
-
-            const uint32_t luma_width        = input_picture_ptr->width - scs_ptr->max_input_pad_right;
-            const uint32_t luma_height       = input_picture_ptr->height - scs_ptr->max_input_pad_bottom;
-            const uint32_t chroma_width      = luma_width >> ss_x;
-            const uint32_t pic_width_in_sb   = (luma_width + 64 - 1) / 64;
-            const uint32_t pic_height_in_sb  = (luma_height + 64 - 1) / 64;
-            const uint32_t chroma_height     = luma_height >> ss_y;
-            uint32_t       sb_num_in_height, sb_num_in_width, bd, shift;
-            uint8_t        zero_buffer[64*64];
-
-            bd = 10;
-            shift = 0 ; // both input and output are 10 bit (bitdepth - input_bd)
-            memset(&zero_buffer[0], 0, sizeof(uint8_t)*64*64);
-
-            EbByte input_buffer_org =
-                &((input_picture_ptr
-                       ->buffer_y)[input_picture_ptr->origin_x +
-                                   input_picture_ptr->origin_y * input_picture_ptr->stride_y]);
-            uint16_t *recon_buffer_org = (uint16_t *)(&(
-                (recon_ptr->buffer_y)[(recon_ptr->origin_x << is_16bit) +
-                                      (recon_ptr->origin_y << is_16bit) * recon_ptr->stride_y]));
-            ;
-
-            EbByte input_buffer_org_u = &(
-                (input_picture_ptr
-                     ->buffer_cb)[input_picture_ptr->origin_x / 2 +
-                                  input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cb]);
-            ;
-            uint16_t *recon_buffer_org_u = recon_coeff_buffer =
-                (uint16_t *)(&((recon_ptr->buffer_cb)[(recon_ptr->origin_x << is_16bit) / 2 +
-                                                      (recon_ptr->origin_y << is_16bit) / 2 *
-                                                          recon_ptr->stride_cb]));
-            ;
-
-            EbByte input_buffer_org_v = &(
-                (input_picture_ptr
-                     ->buffer_cr)[input_picture_ptr->origin_x / 2 +
-                                  input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cr]);
-            ;
-            uint16_t *recon_buffer_org_v = recon_coeff_buffer =
-                (uint16_t *)(&((recon_ptr->buffer_cr)[(recon_ptr->origin_x << is_16bit) / 2 +
-                                                      (recon_ptr->origin_y << is_16bit) / 2 *
-                                                          recon_ptr->stride_cr]));
-            ;
-
-           for (sb_num_in_height = 0; sb_num_in_height < pic_height_in_sb; ++sb_num_in_height) {
-                for (sb_num_in_width = 0; sb_num_in_width < pic_width_in_sb; ++sb_num_in_width) {
-                    uint32_t tb_origin_x = sb_num_in_width * 64;
-                    uint32_t tb_origin_y = sb_num_in_height * 64;
-                    uint32_t sb_width =
-                        (luma_width - tb_origin_x) < 64 ? (luma_width - tb_origin_x) : 64;
-                    uint32_t sb_height =
-                        (luma_height - tb_origin_y) < 64 ? (luma_height - tb_origin_y) : 64;
-
-                    input_buffer =
-                        input_buffer_org + tb_origin_y * input_picture_ptr->stride_y + tb_origin_x;
-                    recon_coeff_buffer =
-                        recon_buffer_org + tb_origin_y * recon_ptr->stride_y + tb_origin_x;
-
-                    luma_ssim += aom_highbd_ssim2(input_buffer, input_picture_ptr->stride_y, &zero_buffer[0], 64,
-                                                  recon_coeff_buffer, recon_ptr->stride_y, sb_width, sb_height, bd, shift);
-
-                    //U+V
-                    tb_origin_x = sb_num_in_width * 32;
-                    tb_origin_y = sb_num_in_height * 32;
-                    sb_width =
-                        (chroma_width - tb_origin_x) < 32 ? (chroma_width - tb_origin_x) : 32;
-                    sb_height =
-                        (chroma_height - tb_origin_y) < 32 ? (chroma_height - tb_origin_y) : 32;
-
-                    input_buffer = input_buffer_org_u + tb_origin_y * input_picture_ptr->stride_cb +
-                                   tb_origin_x;
-                    recon_coeff_buffer =
-                        recon_buffer_org_u + tb_origin_y * recon_ptr->stride_cb + tb_origin_x;
-
-                    cb_ssim += aom_highbd_ssim2(input_buffer, input_picture_ptr->stride_cb, &zero_buffer[0], 64,
-                                                recon_coeff_buffer, recon_ptr->stride_cb, sb_width, sb_height, bd, shift);
-
-                    input_buffer = input_buffer_org_v + tb_origin_y * input_picture_ptr->stride_cr +
-                                   tb_origin_x;
-                    recon_coeff_buffer =
-                        recon_buffer_org_v + tb_origin_y * recon_ptr->stride_cr + tb_origin_x;
-
-                    cr_ssim += aom_highbd_ssim2(input_buffer, input_picture_ptr->stride_cr, &zero_buffer[0], 64,
-                                                recon_coeff_buffer, recon_ptr->stride_cr, sb_width, sb_height, bd, shift);
-                }
-            }
-
-            luma_ssim /= pic_height_in_sb * pic_width_in_sb;
-            cb_ssim   /= pic_height_in_sb * pic_width_in_sb;
-            cr_ssim   /= pic_height_in_sb * pic_width_in_sb;
-
-            pcs_ptr->parent_pcs_ptr->luma_ssim = luma_ssim;
-            pcs_ptr->parent_pcs_ptr->cb_ssim = cb_ssim;
-            pcs_ptr->parent_pcs_ptr->cr_ssim = cr_ssim;
-        }
-        else {
-            recon_coeff_buffer = (uint16_t*)(&((recon_ptr->buffer_y)[(recon_ptr->origin_x << is_16bit) + (recon_ptr->origin_y << is_16bit) * recon_ptr->stride_y]));
-
-            // if current source picture was temporally filtered, use an alternative buffer which stores
-            // the original source picture
-            EbByte buffer_y, buffer_bit_inc_y;
-            EbByte buffer_cb, buffer_bit_inc_cb;
-            EbByte buffer_cr, buffer_bit_inc_cr;
-            int bd, shift;
-
-            if(pcs_ptr->parent_pcs_ptr->temporal_filtering_on == EB_TRUE){
-                buffer_y = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[0];
-                buffer_bit_inc_y = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_bit_inc_ptr[0];
-                buffer_cb = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[1];
-                buffer_bit_inc_cb = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_bit_inc_ptr[1];
-                buffer_cr = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[2];
-                buffer_bit_inc_cr = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_bit_inc_ptr[2];
-            }else{
-                buffer_y = input_picture_ptr->buffer_y;
-                buffer_bit_inc_y = input_picture_ptr->buffer_bit_inc_y;
-                buffer_cb = input_picture_ptr->buffer_cb;
-                buffer_bit_inc_cb = input_picture_ptr->buffer_bit_inc_cb;
-                buffer_cr = input_picture_ptr->buffer_cr;
-                buffer_bit_inc_cr = input_picture_ptr->buffer_bit_inc_cr;
-            }
-
-            bd = 10;
-            shift = 0 ; // both input and output are 10 bit (bitdepth - input_bd)
-
-            input_buffer = &((buffer_y)[input_picture_ptr->origin_x + input_picture_ptr->origin_y * input_picture_ptr->stride_y]);
-            EbByte input_buffer_bit_inc = &(
-                (buffer_bit_inc_y)[input_picture_ptr->origin_x +
-                                   input_picture_ptr->origin_y *
-                                       input_picture_ptr->stride_bit_inc_y]);
-            luma_ssim = aom_highbd_ssim2(input_buffer, input_picture_ptr->stride_y, input_buffer_bit_inc, input_picture_ptr->stride_bit_inc_y,
-                                         recon_coeff_buffer, recon_ptr->stride_y, scs_ptr->seq_header.max_frame_width, scs_ptr->seq_header.max_frame_height, bd, shift);
-
-            recon_coeff_buffer = (uint16_t*)(&((recon_ptr->buffer_cb)[(recon_ptr->origin_x << is_16bit) / 2 + (recon_ptr->origin_y << is_16bit) / 2 * recon_ptr->stride_cb]));
-            input_buffer = &((buffer_cb)[input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cb]);
-            input_buffer_bit_inc = &((buffer_bit_inc_cb)[input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_bit_inc_cb]);
-            cb_ssim = aom_highbd_ssim2(input_buffer, input_picture_ptr->stride_cb, input_buffer_bit_inc, input_picture_ptr->stride_bit_inc_cb,
-                                       recon_coeff_buffer, recon_ptr->stride_cb, scs_ptr->chroma_width, scs_ptr->chroma_height, bd, shift);
-
-            recon_coeff_buffer = (uint16_t*)(&((recon_ptr->buffer_cr)[(recon_ptr->origin_x << is_16bit) / 2 + (recon_ptr->origin_y << is_16bit) / 2 * recon_ptr->stride_cr]));
-            input_buffer = &((buffer_cr)[input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cr]);
-            input_buffer_bit_inc = &((buffer_bit_inc_cr)[input_picture_ptr->origin_x / 2 + input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_bit_inc_cr]);
-            cr_ssim = aom_highbd_ssim2(input_buffer, input_picture_ptr->stride_cr, input_buffer_bit_inc, input_picture_ptr->stride_bit_inc_cr,
-                                    recon_coeff_buffer, recon_ptr->stride_cr, scs_ptr->chroma_width, scs_ptr->chroma_height, bd, shift);
-
-            pcs_ptr->parent_pcs_ptr->luma_ssim = luma_ssim;
-            pcs_ptr->parent_pcs_ptr->cb_ssim = cb_ssim;
-            pcs_ptr->parent_pcs_ptr->cr_ssim = cr_ssim;
-
-            if (free_memory && pcs_ptr->parent_pcs_ptr->temporal_filtering_on == EB_TRUE) {
-                EB_FREE_ARRAY(buffer_y);
-                EB_FREE_ARRAY(buffer_cb);
-                EB_FREE_ARRAY(buffer_cr);
-                EB_FREE_ARRAY(buffer_bit_inc_y);
-                EB_FREE_ARRAY(buffer_bit_inc_cb);
-                EB_FREE_ARRAY(buffer_bit_inc_cr);
-            }
-        }
-    }
-
-}
-
-void psnr_calculations(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr, EbBool free_memory) {
-    EbBool is_16bit = (scs_ptr->static_config.encoder_bit_depth > EB_8BIT);
-
-    const uint32_t ss_x = scs_ptr->subsampling_x;
-    const uint32_t ss_y = scs_ptr->subsampling_y;
-
-    if (!is_16bit) {
-        EbPictureBufferDesc *recon_ptr;
-
-        if (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
-            recon_ptr = ((EbReferenceObject *)
-                             pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)
-                            ->reference_picture;
-        else
-            recon_ptr = pcs_ptr->recon_picture_ptr;
-
-        EbPictureBufferDesc *input_picture_ptr =
-            (EbPictureBufferDesc *)pcs_ptr->parent_pcs_ptr->enhanced_unscaled_picture_ptr;
-
-        uint64_t sse_total[3] = {0};
-        uint64_t residual_distortion = 0;
-        EbByte   input_buffer;
-        EbByte   recon_coeff_buffer;
-
-        EbByte buffer_y;
-        EbByte buffer_cb;
-        EbByte buffer_cr;
-
-        // if current source picture was temporally filtered, use an alternative buffer which stores
-        // the original source picture
-        if (pcs_ptr->parent_pcs_ptr->temporal_filtering_on == EB_TRUE) {
-            buffer_y  = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[0];
-            buffer_cb = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[1];
-            buffer_cr = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[2];
-        } else {
-            buffer_y  = input_picture_ptr->buffer_y;
-            buffer_cb = input_picture_ptr->buffer_cb;
-            buffer_cr = input_picture_ptr->buffer_cr;
-        }
-
-        recon_coeff_buffer = &(
-            (recon_ptr->buffer_y)[recon_ptr->origin_x + recon_ptr->origin_y * recon_ptr->stride_y]);
-        input_buffer = &(buffer_y[input_picture_ptr->origin_x +
-                                  input_picture_ptr->origin_y * input_picture_ptr->stride_y]);
-
-        residual_distortion = 0;
-
-        for (int row_index = 0;
-             row_index < input_picture_ptr->height - scs_ptr->max_input_pad_bottom;
-             ++row_index) {
-            for (int column_index = 0;
-                 column_index < input_picture_ptr->width - scs_ptr->max_input_pad_right;
-                 ++column_index) {
-                residual_distortion += (int64_t)SQR((int64_t)(input_buffer[column_index]) -
-                                                    (recon_coeff_buffer[column_index]));
-            }
-
-            input_buffer += input_picture_ptr->stride_y;
-            recon_coeff_buffer += recon_ptr->stride_y;
-        }
-
-        sse_total[0] = residual_distortion;
-
-        recon_coeff_buffer =
-            &((recon_ptr->buffer_cb)[recon_ptr->origin_x / 2 +
-                                     recon_ptr->origin_y / 2 * recon_ptr->stride_cb]);
-        input_buffer = &(buffer_cb[input_picture_ptr->origin_x / 2 +
-                                   input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cb]);
-
-        residual_distortion = 0;
-        for (int row_index = 0; row_index <
-             (input_picture_ptr->height - scs_ptr->max_input_pad_bottom) >> ss_y;
-             ++row_index) {
-            for (int column_index = 0; column_index <
-                 (input_picture_ptr->width - scs_ptr->max_input_pad_right) >> ss_x;
-                 ++column_index) {
-                residual_distortion += (int64_t)SQR((int64_t)(input_buffer[column_index]) -
-                                                    (recon_coeff_buffer[column_index]));
-            }
-
-            input_buffer += input_picture_ptr->stride_cb;
-            recon_coeff_buffer += recon_ptr->stride_cb;
-        }
-
-        sse_total[1] = residual_distortion;
-
-        recon_coeff_buffer =
-            &((recon_ptr->buffer_cr)[recon_ptr->origin_x / 2 +
-                                     recon_ptr->origin_y / 2 * recon_ptr->stride_cr]);
-        input_buffer        = &(buffer_cr[input_picture_ptr->origin_x / 2 +
-                                   input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cr]);
-        residual_distortion = 0;
-
-        for (int row_index = 0; row_index <
-             (input_picture_ptr->height - scs_ptr->max_input_pad_bottom) >> ss_y;
-             ++row_index) {
-            for (int column_index = 0; column_index <
-                 (input_picture_ptr->width - scs_ptr->max_input_pad_right) >> ss_x;
-                 ++column_index) {
-                residual_distortion += (int64_t)SQR((int64_t)(input_buffer[column_index]) -
-                                                    (recon_coeff_buffer[column_index]));
-            }
-
-            input_buffer += input_picture_ptr->stride_cr;
-            recon_coeff_buffer += recon_ptr->stride_cr;
-        }
-
-        sse_total[2]                      = residual_distortion;
-        pcs_ptr->parent_pcs_ptr->luma_sse = (uint32_t)sse_total[0];
-        pcs_ptr->parent_pcs_ptr->cb_sse   = (uint32_t)sse_total[1];
-        pcs_ptr->parent_pcs_ptr->cr_sse   = (uint32_t)sse_total[2];
-
-        if(free_memory && pcs_ptr->parent_pcs_ptr->temporal_filtering_on == EB_TRUE) {
-            EB_FREE_ARRAY(buffer_y);
-            EB_FREE_ARRAY(buffer_cb);
-            EB_FREE_ARRAY(buffer_cr);
-        }
-    }
-    else {
-        EbPictureBufferDesc *recon_ptr;
-
-        if (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
-            recon_ptr = ((EbReferenceObject *)
-                             pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)
-                            ->reference_picture16bit;
-        else
-            recon_ptr = pcs_ptr->recon_picture16bit_ptr;
-        EbPictureBufferDesc *input_picture_ptr =
-            (EbPictureBufferDesc *)pcs_ptr->parent_pcs_ptr->enhanced_unscaled_picture_ptr;
-
-        uint64_t  sse_total[3] = {0};
-        uint64_t  residual_distortion = 0;
-        EbByte    input_buffer;
-        EbByte    input_buffer_bit_inc;
-        uint16_t *recon_coeff_buffer;
-
-        if (scs_ptr->static_config.ten_bit_format == 1) {
-            const uint32_t luma_width        = input_picture_ptr->width - scs_ptr->max_input_pad_right;
-            const uint32_t luma_height       = input_picture_ptr->height - scs_ptr->max_input_pad_bottom;
-            const uint32_t chroma_width      = luma_width >> ss_x;
-            const uint32_t pic_width_in_sb   = (luma_width + 64 - 1) / 64;
-            const uint32_t pic_height_in_sb  = (luma_height + 64 - 1) / 64;
-            const uint32_t luma_2bit_width   = luma_width / 4;
-            const uint32_t chroma_height     = luma_height >> ss_y;
-            const uint32_t chroma_2bit_width = chroma_width / 4;
-            uint32_t       sb_num_in_height, sb_num_in_width;
-
-            EbByte input_buffer_org =
-                &((input_picture_ptr
-                       ->buffer_y)[input_picture_ptr->origin_x +
-                                   input_picture_ptr->origin_y * input_picture_ptr->stride_y]);
-            uint16_t *recon_buffer_org = (uint16_t *)(&(
-                (recon_ptr->buffer_y)[(recon_ptr->origin_x << is_16bit) +
-                                      (recon_ptr->origin_y << is_16bit) * recon_ptr->stride_y]));
-            ;
-
-            EbByte input_buffer_org_u = &(
-                (input_picture_ptr
-                     ->buffer_cb)[input_picture_ptr->origin_x / 2 +
-                                  input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cb]);
-            ;
-            uint16_t *recon_buffer_org_u = recon_coeff_buffer =
-                (uint16_t *)(&((recon_ptr->buffer_cb)[(recon_ptr->origin_x << is_16bit) / 2 +
-                                                      (recon_ptr->origin_y << is_16bit) / 2 *
-                                                          recon_ptr->stride_cb]));
-            ;
-
-            EbByte input_buffer_org_v = &(
-                (input_picture_ptr
-                     ->buffer_cr)[input_picture_ptr->origin_x / 2 +
-                                  input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cr]);
-            ;
-            uint16_t *recon_buffer_org_v = recon_coeff_buffer =
-                (uint16_t *)(&((recon_ptr->buffer_cr)[(recon_ptr->origin_x << is_16bit) / 2 +
-                                                      (recon_ptr->origin_y << is_16bit) / 2 *
-                                                          recon_ptr->stride_cr]));
-            ;
-
-            residual_distortion            = 0;
-            uint64_t residual_distortion_u = 0;
-            uint64_t residual_distortion_v = 0;
-
-            for (sb_num_in_height = 0; sb_num_in_height < pic_height_in_sb; ++sb_num_in_height) {
-                for (sb_num_in_width = 0; sb_num_in_width < pic_width_in_sb; ++sb_num_in_width) {
-                    uint32_t tb_origin_x = sb_num_in_width * 64;
-                    uint32_t tb_origin_y = sb_num_in_height * 64;
-                    uint32_t sb_width =
-                        (luma_width - tb_origin_x) < 64 ? (luma_width - tb_origin_x) : 64;
-                    uint32_t sb_height =
-                        (luma_height - tb_origin_y) < 64 ? (luma_height - tb_origin_y) : 64;
-
-                    input_buffer =
-                        input_buffer_org + tb_origin_y * input_picture_ptr->stride_y + tb_origin_x;
-                    input_buffer_bit_inc = input_picture_ptr->buffer_bit_inc_y +
-                                           tb_origin_y * luma_2bit_width +
-                                           (tb_origin_x / 4) * sb_height;
-                    recon_coeff_buffer =
-                        recon_buffer_org + tb_origin_y * recon_ptr->stride_y + tb_origin_x;
-
-                    uint64_t j, k;
-                    uint16_t out_pixel;
-                    uint8_t  n_bit_pixel;
-                    uint8_t  four_2bit_pels;
-                    uint32_t inn_stride = sb_width / 4;
-
-                    for (j = 0; j < sb_height; j++) {
-                        for (k = 0; k < sb_width / 4; k++) {
-                            four_2bit_pels = input_buffer_bit_inc[k + j * inn_stride];
-
-                            n_bit_pixel = (four_2bit_pels >> 6) & 3;
-                            out_pixel   = input_buffer[k * 4 + 0 + j * input_picture_ptr->stride_y]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 0 + j * recon_ptr->stride_y]);
-
-                            n_bit_pixel = (four_2bit_pels >> 4) & 3;
-                            out_pixel   = input_buffer[k * 4 + 1 + j * input_picture_ptr->stride_y]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 1 + j * recon_ptr->stride_y]);
-
-                            n_bit_pixel = (four_2bit_pels >> 2) & 3;
-                            out_pixel   = input_buffer[k * 4 + 2 + j * input_picture_ptr->stride_y]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 2 + j * recon_ptr->stride_y]);
-
-                            n_bit_pixel = (four_2bit_pels >> 0) & 3;
-                            out_pixel   = input_buffer[k * 4 + 3 + j * input_picture_ptr->stride_y]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 3 + j * recon_ptr->stride_y]);
-                        }
-                    }
-
-                    //U+V
-
-                    tb_origin_x = sb_num_in_width * 32;
-                    tb_origin_y = sb_num_in_height * 32;
-                    sb_width =
-                        (chroma_width - tb_origin_x) < 32 ? (chroma_width - tb_origin_x) : 32;
-                    sb_height =
-                        (chroma_height - tb_origin_y) < 32 ? (chroma_height - tb_origin_y) : 32;
-
-                    inn_stride = sb_width / 4;
-
-                    input_buffer = input_buffer_org_u + tb_origin_y * input_picture_ptr->stride_cb +
-                                   tb_origin_x;
-
-                    input_buffer_bit_inc = input_picture_ptr->buffer_bit_inc_cb +
-                                           tb_origin_y * chroma_2bit_width +
-                                           (tb_origin_x / 4) * sb_height;
-
-                    recon_coeff_buffer =
-                        recon_buffer_org_u + tb_origin_y * recon_ptr->stride_cb + tb_origin_x;
-
-                    for (j = 0; j < sb_height; j++) {
-                        for (k = 0; k < sb_width / 4; k++) {
-                            four_2bit_pels = input_buffer_bit_inc[k + j * inn_stride];
-
-                            n_bit_pixel = (four_2bit_pels >> 6) & 3;
-                            out_pixel   = input_buffer[k * 4 + 0 + j * input_picture_ptr->stride_cb]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion_u += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 0 + j * recon_ptr->stride_cb]);
-
-                            n_bit_pixel = (four_2bit_pels >> 4) & 3;
-                            out_pixel   = input_buffer[k * 4 + 1 + j * input_picture_ptr->stride_cb]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion_u += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 1 + j * recon_ptr->stride_cb]);
-
-                            n_bit_pixel = (four_2bit_pels >> 2) & 3;
-                            out_pixel   = input_buffer[k * 4 + 2 + j * input_picture_ptr->stride_cb]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion_u += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 2 + j * recon_ptr->stride_cb]);
-
-                            n_bit_pixel = (four_2bit_pels >> 0) & 3;
-                            out_pixel   = input_buffer[k * 4 + 3 + j * input_picture_ptr->stride_cb]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion_u += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 3 + j * recon_ptr->stride_cb]);
-                        }
-                    }
-
-                    input_buffer = input_buffer_org_v + tb_origin_y * input_picture_ptr->stride_cr +
-                                   tb_origin_x;
-                    input_buffer_bit_inc = input_picture_ptr->buffer_bit_inc_cr +
-                                           tb_origin_y * chroma_2bit_width +
-                                           (tb_origin_x / 4) * sb_height;
-                    recon_coeff_buffer =
-                        recon_buffer_org_v + tb_origin_y * recon_ptr->stride_cr + tb_origin_x;
-
-                    for (j = 0; j < sb_height; j++) {
-                        for (k = 0; k < sb_width / 4; k++) {
-                            four_2bit_pels = input_buffer_bit_inc[k + j * inn_stride];
-
-                            n_bit_pixel = (four_2bit_pels >> 6) & 3;
-                            out_pixel   = input_buffer[k * 4 + 0 + j * input_picture_ptr->stride_cr]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion_v += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 0 + j * recon_ptr->stride_cr]);
-
-                            n_bit_pixel = (four_2bit_pels >> 4) & 3;
-                            out_pixel   = input_buffer[k * 4 + 1 + j * input_picture_ptr->stride_cr]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion_v += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 1 + j * recon_ptr->stride_cr]);
-
-                            n_bit_pixel = (four_2bit_pels >> 2) & 3;
-                            out_pixel   = input_buffer[k * 4 + 2 + j * input_picture_ptr->stride_cr]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion_v += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 2 + j * recon_ptr->stride_cr]);
-
-                            n_bit_pixel = (four_2bit_pels >> 0) & 3;
-                            out_pixel   = input_buffer[k * 4 + 3 + j * input_picture_ptr->stride_cr]
-                                        << 2;
-                            out_pixel = out_pixel | n_bit_pixel;
-                            residual_distortion_v += (int64_t)SQR(
-                                (int64_t)out_pixel -
-                                (int64_t)recon_coeff_buffer[k * 4 + 3 + j * recon_ptr->stride_cr]);
-                        }
-                    }
-                }
-            }
-
-            sse_total[0] = residual_distortion;
-            sse_total[1] = residual_distortion_u;
-            sse_total[2] = residual_distortion_v;
-        } else {
-            recon_coeff_buffer = (uint16_t *)(&(
-                (recon_ptr->buffer_y)[(recon_ptr->origin_x << is_16bit) +
-                                      (recon_ptr->origin_y << is_16bit) * recon_ptr->stride_y]));
-
-            // if current source picture was temporally filtered, use an alternative buffer which stores
-            // the original source picture
-            EbByte buffer_y, buffer_bit_inc_y;
-            EbByte buffer_cb, buffer_bit_inc_cb;
-            EbByte buffer_cr, buffer_bit_inc_cr;
-
-            if (pcs_ptr->parent_pcs_ptr->temporal_filtering_on == EB_TRUE) {
-                buffer_y          = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[0];
-                buffer_bit_inc_y  = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_bit_inc_ptr[0];
-                buffer_cb         = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[1];
-                buffer_bit_inc_cb = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_bit_inc_ptr[1];
-                buffer_cr         = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_ptr[2];
-                buffer_bit_inc_cr = pcs_ptr->parent_pcs_ptr->save_enhanced_picture_bit_inc_ptr[2];
-            } else {
-                buffer_y          = input_picture_ptr->buffer_y;
-                buffer_bit_inc_y  = input_picture_ptr->buffer_bit_inc_y;
-                buffer_cb         = input_picture_ptr->buffer_cb;
-                buffer_bit_inc_cb = input_picture_ptr->buffer_bit_inc_cb;
-                buffer_cr         = input_picture_ptr->buffer_cr;
-                buffer_bit_inc_cr = input_picture_ptr->buffer_bit_inc_cr;
-            }
-
-            input_buffer         = &((buffer_y)[input_picture_ptr->origin_x +
-                                        input_picture_ptr->origin_y * input_picture_ptr->stride_y]);
-            input_buffer_bit_inc = &((buffer_bit_inc_y)[input_picture_ptr->origin_x +
-                                                        input_picture_ptr->origin_y *
-                                                            input_picture_ptr->stride_bit_inc_y]);
-
-            residual_distortion = 0;
-
-            for (int row_index = 0;
-                 row_index < input_picture_ptr->height - scs_ptr->max_input_pad_bottom;
-                 ++row_index) {
-                for (int column_index = 0; column_index <
-                     input_picture_ptr->width - scs_ptr->max_input_pad_right;
-                     ++column_index) {
-                    residual_distortion +=
-                        (int64_t)SQR((int64_t)((((input_buffer[column_index]) << 2) |
-                                                ((input_buffer_bit_inc[column_index] >> 6) & 3))) -
-                                     (recon_coeff_buffer[column_index]));
-                }
-
-                input_buffer += input_picture_ptr->stride_y;
-                input_buffer_bit_inc += input_picture_ptr->stride_bit_inc_y;
-                recon_coeff_buffer += recon_ptr->stride_y;
-            }
-
-            sse_total[0] = residual_distortion;
-
-            recon_coeff_buffer =
-                (uint16_t *)(&((recon_ptr->buffer_cb)[(recon_ptr->origin_x << is_16bit) / 2 +
-                                                      (recon_ptr->origin_y << is_16bit) / 2 *
-                                                          recon_ptr->stride_cb]));
-            input_buffer =
-                &((buffer_cb)[input_picture_ptr->origin_x / 2 +
-                              input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cb]);
-            input_buffer_bit_inc = &((buffer_bit_inc_cb)[input_picture_ptr->origin_x / 2 +
-                                                         input_picture_ptr->origin_y / 2 *
-                                                             input_picture_ptr->stride_bit_inc_cb]);
-
-            residual_distortion = 0;
-            for (int row_index = 0; row_index <
-                 (input_picture_ptr->height - scs_ptr->max_input_pad_bottom) >> ss_y;
-                 ++row_index) {
-                for (int column_index = 0; column_index <
-                     (input_picture_ptr->width - scs_ptr->max_input_pad_right) >> ss_x;
-                     ++column_index) {
-                    residual_distortion +=
-                        (int64_t)SQR((int64_t)((((input_buffer[column_index]) << 2) |
-                                                ((input_buffer_bit_inc[column_index] >> 6) & 3))) -
-                                     (recon_coeff_buffer[column_index]));
-                }
-
-                input_buffer += input_picture_ptr->stride_cb;
-                input_buffer_bit_inc += input_picture_ptr->stride_bit_inc_cb;
-                recon_coeff_buffer += recon_ptr->stride_cb;
-            }
-
-            sse_total[1] = residual_distortion;
-
-            recon_coeff_buffer =
-                (uint16_t *)(&((recon_ptr->buffer_cr)[(recon_ptr->origin_x << is_16bit) / 2 +
-                                                      (recon_ptr->origin_y << is_16bit) / 2 *
-                                                          recon_ptr->stride_cr]));
-            input_buffer =
-                &((buffer_cr)[input_picture_ptr->origin_x / 2 +
-                              input_picture_ptr->origin_y / 2 * input_picture_ptr->stride_cr]);
-            input_buffer_bit_inc = &((buffer_bit_inc_cr)[input_picture_ptr->origin_x / 2 +
-                                                         input_picture_ptr->origin_y / 2 *
-                                                             input_picture_ptr->stride_bit_inc_cr]);
-
-            residual_distortion = 0;
-
-            for (int row_index = 0; row_index <
-                 (input_picture_ptr->height - scs_ptr->max_input_pad_bottom) >> ss_y;
-                 ++row_index) {
-                for (int column_index = 0; column_index <
-                     (input_picture_ptr->width - scs_ptr->max_input_pad_right) >> ss_x;
-                     ++column_index) {
-                    residual_distortion +=
-                        (int64_t)SQR((int64_t)((((input_buffer[column_index]) << 2) |
-                                                ((input_buffer_bit_inc[column_index] >> 6) & 3))) -
-                                     (recon_coeff_buffer[column_index]));
-                }
-
-                input_buffer += input_picture_ptr->stride_cr;
-                input_buffer_bit_inc += input_picture_ptr->stride_bit_inc_cr;
-                recon_coeff_buffer += recon_ptr->stride_cr;
-            }
-
-            sse_total[2] = residual_distortion;
-
-            if (free_memory && pcs_ptr->parent_pcs_ptr->temporal_filtering_on == EB_TRUE) {
-                EB_FREE_ARRAY(buffer_y);
-                EB_FREE_ARRAY(buffer_cb);
-                EB_FREE_ARRAY(buffer_cr);
-                EB_FREE_ARRAY(buffer_bit_inc_y);
-                EB_FREE_ARRAY(buffer_bit_inc_cb);
-                EB_FREE_ARRAY(buffer_bit_inc_cr);
-           }
-        }
-
-        pcs_ptr->parent_pcs_ptr->luma_sse = (uint32_t)sse_total[0];
-        pcs_ptr->parent_pcs_ptr->cb_sse   = (uint32_t)sse_total[1];
-        pcs_ptr->parent_pcs_ptr->cr_sse   = (uint32_t)sse_total[2];
-    }
-}
-
 void pad_ref_and_set_flags(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr) {
     EbReferenceObject *reference_object =
         (EbReferenceObject *)pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr;
@@ -4528,6 +3652,13 @@ void *mode_decision_kernel(void *input_ptr) {
                         context_ptr->md_context->md_rate_estimation_ptr =
                             &context_ptr->md_context->rate_est_table;
                     }
+                    // Pack the 16 bit source of the SB once for all the MD passes and the encode pass
+                    if (scs_ptr->static_config.encoder_bit_depth > EB_8BIT)
+                        pack16bit_input_src(scs_ptr,
+                                            pcs_ptr,
+                                            context_ptr->input_sample16bit_buffer,
+                                            sb_origin_x,
+                                            sb_origin_y);
                     // Configure the SB
                     mode_decision_configure_sb(
                         context_ptr->md_context, pcs_ptr, (uint8_t)sb_ptr->qindex);
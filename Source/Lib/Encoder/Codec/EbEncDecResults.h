@@ -48,6 +48,12 @@ typedef struct RestResults {
     uint16_t         tile_index;
 } RestResults;
 
+typedef struct MetricsTasks {
+    EbDctor          dctor;
+    EbObjectWrapper *pcs_wrapper_ptr;
+    uint32_t         band_index;
+} MetricsTasks;
+
 typedef struct EncDecResultsInitData {
     uint32_t junk;
 } EncDecResultsInitData;
@@ -29,6 +29,7 @@
 #include "EbObject.h"
 #include "encoder.h"
 #include "firstpass.h"
+#include "EbLadderAnalysis.h"
 
 // *Note - the queues are small for testing purposes.  They should be increased when they are done.
 #define PRE_ASSIGNMENT_MAX_DEPTH 128 // should be large enough to hold an entire prediction period
@@ -205,6 +206,10 @@ typedef struct EncodeContext {
     // This feature controls the tolerence vs target used in deciding whether to
     // recode a frame. It has no meaning if recode is disabled.
     int recode_tolerance;
+    // Ladder analysis of the shared context, NULL when ladder_analysis is off
+    LadderAnalysis *ladder;
+    LadderRole      ladder_role;
+    uint8_t         ladder_slot;
 } EncodeContext;
 
 typedef struct EncodeContextInitData {
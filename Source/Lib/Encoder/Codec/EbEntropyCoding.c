@@ -4295,6 +4295,62 @@ EbErrorType write_frame_header_av1(Bitstream *bitstream_ptr, SequenceControlSet
     return return_error;
 }
 
+/**************************************************
+* write_frame_header_only_av1
+*
+* Writes the frame header as a standalone OBU_FRAME_HEADER so that the tiles
+* of the picture can follow in their own tile group OBUs (low latency mode).
+**************************************************/
+EbErrorType write_frame_header_only_av1(Bitstream *bitstream_ptr, SequenceControlSet *scs_ptr,
+                                        PictureControlSet *pcs_ptr) {
+    OutputBitstreamUnit *output_bitstream_ptr = (OutputBitstreamUnit *)
+                                                    bitstream_ptr->output_bitstream_ptr;
+    uint8_t *data            = output_bitstream_ptr->buffer_av1;
+    uint32_t obu_header_size = write_obu_header(OBU_FRAME_HEADER, 0, data);
+
+    const uint32_t obu_payload_size = write_frame_header_obu(
+        scs_ptr, pcs_ptr->parent_pcs_ptr, data + obu_header_size, 0, 1);
+    const size_t length_field_size = obu_mem_move(obu_header_size, obu_payload_size, data);
+    if (write_uleb_obu_size(obu_header_size, obu_payload_size, data) != AOM_CODEC_OK) {
+        assert(0);
+    }
+    data += obu_header_size + obu_payload_size + length_field_size;
+
+    output_bitstream_ptr->buffer_av1 = data;
+    return EB_ErrorNone;
+}
+
+/**************************************************
+* write_tile_group_obu_av1
+*
+* Writes the coded data of one tile as an OBU_TILE_GROUP holding that tile
+* only. dst must have room for the tile data plus TILE_GROUP_OBU_MAX_OVERHEAD
+* bytes. Returns the number of bytes written.
+**************************************************/
+uint32_t write_tile_group_obu_av1(PictureControlSet *pcs_ptr, uint16_t tile_idx, uint8_t *dst) {
+    const Av1Common *const cm           = pcs_ptr->parent_pcs_ptr->av1_cm;
+    const int              n_log2_tiles = cm->log2_tile_rows + cm->log2_tile_cols;
+    EntropyCoder *         ec_ptr       = pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr;
+    OutputBitstreamUnit *  ec_output_bitstream_ptr = (OutputBitstreamUnit *)
+                                                        ec_ptr->ec_output_bitstream_ptr;
+    const uint32_t tile_size       = ec_ptr->ec_writer.pos;
+    const uint32_t obu_header_size = write_obu_header(OBU_TILE_GROUP, 0, dst);
+
+    uint32_t obu_payload_size = write_tile_group_header(
+        dst + obu_header_size, tile_idx, tile_idx, n_log2_tiles, 1);
+    // The last tile of a tile group carries no tile size field
+    svt_memcpy(dst + obu_header_size + obu_payload_size,
+               ec_output_bitstream_ptr->buffer_begin_av1,
+               tile_size);
+    obu_payload_size += tile_size;
+
+    const size_t length_field_size = obu_mem_move(obu_header_size, obu_payload_size, dst);
+    if (write_uleb_obu_size(obu_header_size, obu_payload_size, dst) != AOM_CODEC_OK) {
+        assert(0);
+    }
+    return obu_header_size + obu_payload_size + (uint32_t)length_field_size;
+}
+
 /**************************************************
 * encode_sps_av1
 **************************************************/
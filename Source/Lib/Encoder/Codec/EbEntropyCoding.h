@@ -35,6 +35,9 @@ extern "C" {
 struct ModeDecisionCandidateBuffer;
 struct ModeDecisionCandidate;
 
+// Upper bound of the OBU header, size field and tile group header of a tile group OBU
+#define TILE_GROUP_OBU_MAX_OVERHEAD 16
+
 /**************************************
      * Extern Function Declarations
      **************************************/
@@ -201,6 +204,10 @@ extern EbErrorType write_frame_header_av1(Bitstream *bitstream_ptr, SequenceCont
                                           PictureControlSet *pcs_ptr, uint8_t show_existing);
 extern EbErrorType encode_td_av1(uint8_t *bitstream_ptr);
 extern EbErrorType encode_sps_av1(Bitstream *bitstream_ptr, SequenceControlSet *scs_ptr);
+extern EbErrorType write_frame_header_only_av1(Bitstream *bitstream_ptr, SequenceControlSet *scs_ptr,
+                                               PictureControlSet *pcs_ptr);
+extern uint32_t    write_tile_group_obu_av1(PictureControlSet *pcs_ptr, uint16_t tile_idx,
+                                            uint8_t *dst);
 
 //*******************************************************************************************//
 
@@ -220,6 +220,15 @@ static void reset_entropy_coding_picture(EntropyCodingContext *context_ptr,
 
         entropy_coding_reset_neighbor_arrays(pcs_ptr, tile_idx);
     }
+
+    // In low latency mode the headers are ready before the tiles, so that each
+    // tile can be output as soon as it is coded
+    if (scs_ptr->static_config.low_latency_mode) {
+        bitstream_reset(pcs_ptr->bitstream_ptr);
+        if (frm_hdr->frame_type == KEY_FRAME)
+            encode_sps_av1(pcs_ptr->bitstream_ptr, scs_ptr);
+        write_frame_header_only_av1(pcs_ptr->bitstream_ptr, scs_ptr, pcs_ptr);
+    }
     return;
 }
 
@@ -383,6 +392,8 @@ void *entropy_coding_kernel(void *input_ptr) {
                     svt_block_on_mutex(pcs_ptr->entropy_coding_pic_mutex);
                     if (pcs_ptr->entropy_coding_pic_reset_flag) {
                         pcs_ptr->entropy_coding_pic_reset_flag = EB_FALSE;
+                        svt_aom_mark_frame_stats_stage(pcs_ptr->parent_pcs_ptr,
+                                                       EB_FRAME_STATS_ENTROPY_CODING);
 
                         reset_entropy_coding_picture(context_ptr, pcs_ptr, scs_ptr);
                     }
@@ -464,6 +475,12 @@ void *entropy_coding_kernel(void *input_ptr) {
                         encode_slice_finish(
                             pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr);
 
+                        // In low latency mode every coded tile is reported. The results object
+                        // is taken before the picture lock, which packetization also takes.
+                        if (scs_ptr->static_config.low_latency_mode)
+                            svt_get_empty_object(context_ptr->entropy_coding_output_fifo_ptr,
+                                                 &entropy_coding_results_wrapper_ptr);
+
                         svt_block_on_mutex(pcs_ptr->entropy_coding_pic_mutex);
                         pcs_ptr->entropy_coding_info[tile_idx]->entropy_coding_tile_done = EB_TRUE;
                         for (uint16_t i = 0; i < tile_cnt; i++) {
@@ -473,6 +490,16 @@ void *entropy_coding_kernel(void *input_ptr) {
                                 break;
                             }
                         }
+                        // Post the partial picture under the lock so that it always
+                        // reaches packetization before the complete picture
+                        if (scs_ptr->static_config.low_latency_mode && !pic_ready) {
+                            entropy_coding_results_ptr = (EntropyCodingResults *)
+                                entropy_coding_results_wrapper_ptr->object_ptr;
+                            entropy_coding_results_ptr->pcs_wrapper_ptr =
+                                rest_results_ptr->pcs_wrapper_ptr;
+                            entropy_coding_results_ptr->partial_picture = EB_TRUE;
+                            svt_post_full_object(entropy_coding_results_wrapper_ptr);
+                        }
                         svt_release_mutex(pcs_ptr->entropy_coding_pic_mutex);
                         if (pic_ready) {
                             // Release the List 0 Reference Pictures
@@ -506,11 +533,13 @@ void *entropy_coding_kernel(void *input_ptr) {
             // In some cases, PAK ends fast, pcs will be released before we quit the while-loop
             if (frame_entropy_done) {
                 // Get Empty Entropy Coding Results
-                svt_get_empty_object(context_ptr->entropy_coding_output_fifo_ptr,
-                                     &entropy_coding_results_wrapper_ptr);
+                if (!scs_ptr->static_config.low_latency_mode)
+                    svt_get_empty_object(context_ptr->entropy_coding_output_fifo_ptr,
+                                         &entropy_coding_results_wrapper_ptr);
                 entropy_coding_results_ptr = (EntropyCodingResults *)
                                                  entropy_coding_results_wrapper_ptr->object_ptr;
                 entropy_coding_results_ptr->pcs_wrapper_ptr = rest_results_ptr->pcs_wrapper_ptr;
+                entropy_coding_results_ptr->partial_picture = EB_FALSE;
 
                 // Post EntropyCoding Results
                 svt_post_full_object(entropy_coding_results_wrapper_ptr);
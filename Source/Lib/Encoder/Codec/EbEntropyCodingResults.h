@@ -24,6 +24,8 @@ extern "C" {
 typedef struct EntropyCodingResults {
     EbDctor          dctor;
     EbObjectWrapper *pcs_wrapper_ptr;
+    // Low latency mode: some tiles of the picture are coded, the picture is not complete yet
+    EbBool partial_picture;
 } EntropyCodingResults;
 
 typedef struct EntropyCodingResultsInitData {
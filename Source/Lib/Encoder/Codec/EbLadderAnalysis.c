@@ -0,0 +1,278 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "EbLadderAnalysis.h"
+#include "EbPictureControlSet.h"
+#include "EbRateDistortionCost.h"
+#include "EbLog.h"
+
+/* The records are shared by handles created and destroyed independently, so
+ * they are not tracked by the memory map of any of them */
+static void free_record(LadderRecord *record) {
+    free(record->tpl.intra_cost);
+    free(record->tpl.mc_dep_cost);
+    free(record);
+}
+
+static LadderRecord *find_record(const LadderAnalysis *ladder, uint64_t picture_number) {
+    LadderRecord *record = ladder->head;
+    while (record && record->picture_number < picture_number) record = record->next;
+    return record && record->picture_number == picture_number ? record : NULL;
+}
+
+// Frees the records the source and all the renditions are done with
+static void remove_done_records(LadderAnalysis *ladder) {
+    LadderRecord **link = &ladder->head;
+    LadderRecord * prev = NULL;
+    while (*link) {
+        LadderRecord *record = *link;
+        if (record->tpl_done && record->pending_mask == 0) {
+            *link = record->next;
+            free_record(record);
+        } else {
+            prev = record;
+            link = &record->next;
+        }
+    }
+    ladder->tail = prev;
+}
+
+/* Waits until the record of picture_number is there, or cannot come anymore,
+ * and returns it with the mutex held. Returns NULL when the rendition has no
+ * record to use for the picture */
+static LadderRecord *wait_record(LadderAnalysis *ladder, uint8_t slot, uint64_t picture_number,
+                                 EbBool wait_tpl) {
+    const uint64_t bit = (uint64_t)1 << slot;
+    for (;;) {
+        const int32_t seq = svt_begin_wait_cond_var(&ladder->cond_var);
+        svt_block_on_mutex(ladder->mutex);
+        LadderRecord *record = (ladder->rendition_mask & bit) ? find_record(ladder, picture_number)
+                                                              : NULL;
+        if (record && !(record->pending_mask & bit))
+            record = NULL;
+        EbBool ready;
+        if (record)
+            ready = !wait_tpl || record->tpl_done;
+        else
+            ready = !(ladder->rendition_mask & bit) ||
+                ladder->source_state != LADDER_SOURCE_ATTACHED ||
+                picture_number < ladder->next_picture ||
+                (ladder->end_of_sequence && picture_number > ladder->last_picture);
+        if (ready) {
+            svt_end_wait_cond_var(&ladder->cond_var, seq, EB_FALSE);
+            return record;
+        }
+        svt_release_mutex(ladder->mutex);
+        svt_end_wait_cond_var(&ladder->cond_var, seq, EB_TRUE);
+    }
+}
+
+EbErrorType svt_ladder_analysis_init(LadderAnalysis *ladder) {
+    memset(ladder, 0, sizeof(*ladder));
+    svt_create_cond_var(&ladder->cond_var);
+    ladder->mutex = svt_create_mutex();
+    return ladder->mutex ? EB_ErrorNone : EB_ErrorInsufficientResources;
+}
+
+void svt_ladder_analysis_deinit(LadderAnalysis *ladder) {
+    while (ladder->head) {
+        LadderRecord *record = ladder->head;
+        ladder->head         = record->next;
+        free_record(record);
+    }
+    ladder->tail = NULL;
+    if (ladder->mutex)
+        svt_destroy_mutex(ladder->mutex);
+    ladder->mutex = NULL;
+}
+
+EbErrorType svt_ladder_attach(LadderAnalysis *ladder, LadderRole role, uint8_t *slot) {
+    EbErrorType return_error = EB_ErrorNone;
+    *slot                    = 0;
+    svt_block_on_mutex(ladder->mutex);
+    if (role == LADDER_SOURCE) {
+        if (ladder->source_state != LADDER_SOURCE_NONE) {
+            SVT_ERROR("A shared context has a single ladder analysis source\n");
+            return_error = EB_ErrorBadParameter;
+        } else
+            ladder->source_state = LADDER_SOURCE_ATTACHED;
+    } else {
+        while (*slot < LADDER_MAX_RENDITIONS && (ladder->rendition_mask & ((uint64_t)1 << *slot)))
+            (*slot)++;
+        if (*slot == LADDER_MAX_RENDITIONS) {
+            SVT_ERROR("A shared context has at most %d ladder analysis renditions\n",
+                      LADDER_MAX_RENDITIONS);
+            return_error = EB_ErrorInsufficientResources;
+        } else
+            ladder->rendition_mask |= (uint64_t)1 << *slot;
+    }
+    svt_release_mutex(ladder->mutex);
+    return return_error;
+}
+
+void svt_ladder_detach(LadderAnalysis *ladder, LadderRole role, uint8_t slot) {
+    svt_block_on_mutex(ladder->mutex);
+    if (role == LADDER_SOURCE) {
+        ladder->source_state = LADDER_SOURCE_DETACHED;
+        for (LadderRecord *record = ladder->head; record; record = record->next)
+            record->tpl_done = EB_TRUE;
+    } else {
+        const uint64_t bit = (uint64_t)1 << slot;
+        ladder->rendition_mask &= ~bit;
+        for (LadderRecord *record = ladder->head; record; record = record->next)
+            record->pending_mask &= ~bit;
+    }
+    remove_done_records(ladder);
+    svt_release_mutex(ladder->mutex);
+    svt_notify_cond_var(&ladder->cond_var);
+}
+
+void svt_ladder_publish_scene_change(LadderAnalysis *ladder, uint64_t picture_number,
+                                     int8_t scene_change, EbBool end_of_sequence) {
+    svt_block_on_mutex(ladder->mutex);
+    // Renditions attached later run their own analysis
+    if (ladder->source_state == LADDER_SOURCE_ATTACHED && ladder->rendition_mask) {
+        LadderRecord *record = (LadderRecord *)calloc(1, sizeof(*record));
+        if (record) {
+            record->picture_number = picture_number;
+            record->pending_mask   = ladder->rendition_mask;
+            record->scene_change   = scene_change;
+            if (ladder->tail)
+                ladder->tail->next = record;
+            else
+                ladder->head = record;
+            ladder->tail = record;
+        }
+    }
+    ladder->next_picture = picture_number + 1;
+    if (end_of_sequence) {
+        ladder->end_of_sequence = EB_TRUE;
+        ladder->last_picture    = picture_number;
+    }
+    svt_release_mutex(ladder->mutex);
+    svt_notify_cond_var(&ladder->cond_var);
+}
+
+int8_t svt_ladder_get_scene_change(LadderAnalysis *ladder, uint8_t slot, uint64_t picture_number) {
+    LadderRecord *record       = wait_record(ladder, slot, picture_number, EB_FALSE);
+    const int8_t  scene_change = record ? record->scene_change : -1;
+    svt_release_mutex(ladder->mutex);
+    return scene_change;
+}
+
+void svt_ladder_export_tpl(LadderAnalysis *ladder, PictureParentControlSet *pcs_ptr) {
+    Av1Common *  cm         = pcs_ptr->av1_cm;
+    const int    step       = 1 << (pcs_ptr->is_720p_or_larger ? 2 : 1);
+    const int    shift      = pcs_ptr->is_720p_or_larger ? 2 : 1;
+    const int    mi_cols_sr = ((pcs_ptr->aligned_width + 15) / 16) << 2;
+    LadderTplMap map;
+    map.width    = pcs_ptr->enhanced_picture_ptr->width;
+    map.height   = pcs_ptr->enhanced_picture_ptr->height;
+    map.blk_size = (uint32_t)step << MI_SIZE_LOG2;
+    map.cols     = (uint32_t)(mi_cols_sr >> shift);
+    map.rows     = (uint32_t)((cm->mi_rows + step - 1) / step);
+    // Copied outside of the lock, the source owns its tpl_stats
+    map.intra_cost  = (int64_t *)malloc(map.cols * map.rows * sizeof(int64_t));
+    map.mc_dep_cost = (int64_t *)malloc(map.cols * map.rows * sizeof(int64_t));
+    if (map.intra_cost && map.mc_dep_cost) {
+        for (uint32_t i = 0; i < map.cols * map.rows; i++) {
+            const TplStats *tpl_stats_ptr = pcs_ptr->tpl_stats[i];
+            map.intra_cost[i]             = tpl_stats_ptr->recrf_dist;
+            map.mc_dep_cost[i]            = RDCOST(
+                pcs_ptr->base_rdmult, tpl_stats_ptr->mc_dep_rate, tpl_stats_ptr->mc_dep_dist);
+        }
+        svt_block_on_mutex(ladder->mutex);
+        LadderRecord *record = find_record(ladder, pcs_ptr->picture_number);
+        if (record && !record->tpl_done && record->tpl.intra_cost == NULL) {
+            record->tpl     = map;
+            map.intra_cost  = NULL;
+            map.mc_dep_cost = NULL;
+        }
+        svt_release_mutex(ladder->mutex);
+    }
+    free(map.intra_cost);
+    free(map.mc_dep_cost);
+}
+
+/* Sums the costs of the source blocks under each TPL block of pcs_ptr,
+ * weighted by the overlap, and scales them to the area of the block */
+static void project_tpl_map(const LadderTplMap *map, PictureParentControlSet *pcs_ptr) {
+    Av1Common *    cm                   = pcs_ptr->av1_cm;
+    const int      step                 = 1 << (pcs_ptr->is_720p_or_larger ? 2 : 1);
+    const int      shift                = pcs_ptr->is_720p_or_larger ? 2 : 1;
+    const int      mi_cols_sr           = ((pcs_ptr->aligned_width + 15) / 16) << 2;
+    const uint32_t picture_width_in_mb  = (pcs_ptr->enhanced_picture_ptr->width + 16 - 1) / 16;
+    const uint32_t picture_height_in_mb = (pcs_ptr->enhanced_picture_ptr->height + 16 - 1) / 16;
+    const uint32_t mb_shift             = pcs_ptr->is_720p_or_larger ? 0 : 1;
+    // Source blocks per pixel of pcs_ptr
+    const double sx   = (double)map->width / pcs_ptr->enhanced_picture_ptr->width / map->blk_size;
+    const double sy   = (double)map->height / pcs_ptr->enhanced_picture_ptr->height / map->blk_size;
+    const double area = 1.0 / (sx * sy * map->blk_size * map->blk_size);
+
+    for (uint32_t blky = 0; blky < (picture_height_in_mb << mb_shift); blky++)
+        memset(pcs_ptr->tpl_stats[blky * (picture_width_in_mb << mb_shift)],
+               0,
+               (picture_width_in_mb << mb_shift) * sizeof(TplStats));
+
+    for (int row = 0; row < cm->mi_rows; row += step) {
+        const double y0 = (row << MI_SIZE_LOG2) * sy;
+        const double y1 = ((row + step) << MI_SIZE_LOG2) * sy;
+        for (int col = 0; col < mi_cols_sr; col += step) {
+            const double x0          = (col << MI_SIZE_LOG2) * sx;
+            const double x1          = ((col + step) << MI_SIZE_LOG2) * sx;
+            double       intra_cost  = 0;
+            double       mc_dep_cost = 0;
+            for (uint32_t r = (uint32_t)y0; r < map->rows && r < y1; r++) {
+                const double wy = MIN(y1, r + 1) - MAX(y0, r);
+                for (uint32_t c = (uint32_t)x0; c < map->cols && c < x1; c++) {
+                    const double w = wy * (MIN(x1, c + 1) - MAX(x0, c));
+                    intra_cost += w * map->intra_cost[r * map->cols + c];
+                    mc_dep_cost += w * map->mc_dep_cost[r * map->cols + c];
+                }
+            }
+            TplStats *tpl_stats_ptr =
+                pcs_ptr->tpl_stats[(row >> shift) * (mi_cols_sr >> shift) + (col >> shift)];
+            // No rate: RDCOST() of the dependency is its distortion alone
+            tpl_stats_ptr->recrf_dist  = (int64_t)(intra_cost * area + 0.5);
+            tpl_stats_ptr->mc_dep_dist = (int64_t)(mc_dep_cost * area / (1 << RDDIV_BITS) + 0.5);
+        }
+    }
+}
+
+EbBool svt_ladder_import_tpl(LadderAnalysis *ladder, uint8_t slot,
+                             PictureParentControlSet *pcs_ptr) {
+    LadderRecord *record   = wait_record(ladder, slot, pcs_ptr->picture_number, EB_TRUE);
+    const EbBool  imported = record && record->tpl.intra_cost ? EB_TRUE : EB_FALSE;
+    if (imported)
+        project_tpl_map(&record->tpl, pcs_ptr);
+    svt_release_mutex(ladder->mutex);
+    return imported;
+}
+
+void svt_ladder_finish_picture(LadderAnalysis *ladder, LadderRole role, uint8_t slot,
+                               uint64_t picture_number) {
+    if (role == LADDER_SOURCE) {
+        svt_block_on_mutex(ladder->mutex);
+        LadderRecord *record = find_record(ladder, picture_number);
+        if (record)
+            record->tpl_done = EB_TRUE;
+    } else {
+        LadderRecord *record = wait_record(ladder, slot, picture_number, EB_FALSE);
+        if (record)
+            record->pending_mask &= ~((uint64_t)1 << slot);
+    }
+    remove_done_records(ladder);
+    svt_release_mutex(ladder->mutex);
+    if (role == LADDER_SOURCE)
+        svt_notify_cond_var(&ladder->cond_var);
+}
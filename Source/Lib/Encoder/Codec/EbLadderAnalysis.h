@@ -0,0 +1,119 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#ifndef EbLadderAnalysis_h
+#define EbLadderAnalysis_h
+
+#include "EbDefinitions.h"
+#include "EbThreads.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************************************************************
+ * Ladder analysis
+ *   Shares the look-ahead analysis of the source rendition of an ABR
+ *   ladder with the other renditions attached to the same shared
+ *   encoder context. The source creates a record per picture in
+ *   picture decision holding its scene change decision, and completes
+ *   it in source based operations with the TPL costs of the base layer
+ *   pictures. A rendition waits for the record of each picture it
+ *   needs, and runs its own analysis when the source has nothing for
+ *   the picture: no source attached, source past its end of sequence,
+ *   or a different prediction structure.
+ *********************************************************************/
+#define LADDER_MAX_RENDITIONS 64
+
+typedef enum LadderRole {
+    LADDER_OFF,
+    LADDER_SOURCE,
+    LADDER_RENDITION,
+} LadderRole;
+
+typedef enum LadderSourceState {
+    LADDER_SOURCE_NONE,
+    LADDER_SOURCE_ATTACHED,
+    LADDER_SOURCE_DETACHED,
+} LadderSourceState;
+
+// TPL costs of a base layer picture of the source, on its TPL block grid
+typedef struct LadderTplMap {
+    uint32_t width; // picture size, in pixels
+    uint32_t height;
+    uint32_t blk_size; // TPL block size, in pixels
+    uint32_t cols;
+    uint32_t rows;
+    int64_t *intra_cost; // recrf_dist of each block, NULL when there are no costs
+    int64_t *mc_dep_cost; // RDCOST() of the propagated dependency of each block
+} LadderTplMap;
+
+typedef struct LadderRecord {
+    struct LadderRecord *next;
+    uint64_t             picture_number;
+    // Renditions which did not release the record yet
+    uint64_t pending_mask;
+    // Scene change decision of the source, -1 when it did not run the detection
+    int8_t scene_change;
+    // Set once the source went through source based operations
+    EbBool       tpl_done;
+    LadderTplMap tpl;
+} LadderRecord;
+
+typedef struct LadderAnalysis {
+    EbHandle          mutex;
+    CondVar           cond_var;
+    LadderSourceState source_state;
+    uint64_t          rendition_mask;
+    // Picture number of the next record of the source
+    uint64_t next_picture;
+    EbBool   end_of_sequence;
+    uint64_t last_picture;
+    // Records in picture number order
+    LadderRecord *head;
+    LadderRecord *tail;
+} LadderAnalysis;
+
+struct PictureParentControlSet;
+
+extern EbErrorType svt_ladder_analysis_init(LadderAnalysis *ladder);
+extern void        svt_ladder_analysis_deinit(LadderAnalysis *ladder);
+
+/* Attaches an encoder handle with role, returns the slot of a rendition */
+extern EbErrorType svt_ladder_attach(LadderAnalysis *ladder, LadderRole role, uint8_t *slot);
+/* Detaches an encoder handle. The waits of a detached handle return at once */
+extern void svt_ladder_detach(LadderAnalysis *ladder, LadderRole role, uint8_t slot);
+
+/* Source: creates the record of picture_number, in picture number order */
+extern void svt_ladder_publish_scene_change(LadderAnalysis *ladder, uint64_t picture_number,
+                                            int8_t scene_change, EbBool end_of_sequence);
+/* Rendition: scene change decision of the source, -1 when there is none */
+extern int8_t svt_ladder_get_scene_change(LadderAnalysis *ladder, uint8_t slot,
+                                          uint64_t picture_number);
+
+/* Source: copies the TPL costs of a base layer picture to its record */
+extern void svt_ladder_export_tpl(LadderAnalysis *ladder, struct PictureParentControlSet *pcs_ptr);
+/* Rendition: projects the TPL costs of the source onto the tpl_stats of
+ * pcs_ptr, returns EB_FALSE when the source has none */
+extern EbBool svt_ladder_import_tpl(LadderAnalysis *ladder, uint8_t slot,
+                                    struct PictureParentControlSet *pcs_ptr);
+
+/* Called by both roles for every picture once source based operations are
+ * done with it: the source completes the record, the rendition releases it */
+extern void svt_ladder_finish_picture(LadderAnalysis *ladder, LadderRole role, uint8_t slot,
+                                      uint64_t picture_number);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EbLadderAnalysis_h
+/* File EOF */
@@ -0,0 +1,443 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+* Copyright (c) 2016, Alliance for Open Media. All rights reserved
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#include <stdlib.h>
+#include "aom_dsp_rtcd.h"
+#include "EbDefinitions.h"
+#include "EbEncHandle.h"
+#include "EbMetricsProcess.h"
+#include "EbEncDecResults.h"
+#include "EbThreads.h"
+#include "EbReferenceObject.h"
+#include "EbPictureOperators.h"
+#include "EbUtility.h"
+#include "EbSequenceControlSet.h"
+#include "EbPictureControlSet.h"
+
+/**************************************
+ * Metrics Context
+ **************************************/
+typedef struct MetricsContext {
+    EbFifo *metrics_input_fifo_ptr;
+
+    // 10 bit source rows of the band being measured, packed from the 8 bit and 2 bit planes
+    uint16_t *input_16bit;
+    uint32_t  input_16bit_stride;
+} MetricsContext;
+
+/* Source and recon of one plane, at the origin of the picture, with the
+ * dimensions over which its PSNR and SSIM are measured. */
+typedef struct MetricsPlane {
+    EbByte   src;
+    EbByte   src_bit_inc;
+    uint32_t src_stride;
+    uint32_t src_bit_inc_stride;
+    EbByte   recon; // uint16_t samples in 10 bit
+    uint32_t recon_stride;
+    int32_t  psnr_width;
+    int32_t  psnr_height;
+    int32_t  ssim_width;
+    int32_t  ssim_height;
+    int32_t  band_height;
+} MetricsPlane;
+
+static void metrics_context_dctor(EbPtr p) {
+    EbThreadContext *thread_context_ptr = (EbThreadContext *)p;
+    MetricsContext * obj                = (MetricsContext *)thread_context_ptr->priv;
+    EB_FREE_ARRAY(obj->input_16bit);
+    EB_FREE_ARRAY(obj);
+}
+
+/******************************************************
+ * Metrics Context Constructor
+ ******************************************************/
+EbErrorType metrics_context_ctor(EbThreadContext *  thread_context_ptr,
+                                 const EbEncHandle *enc_handle_ptr, int index) {
+    const SequenceControlSet *scs_ptr = enc_handle_ptr->scs_instance_array[0]->scs_ptr;
+    MetricsContext *          context_ptr;
+    EB_CALLOC_ARRAY(context_ptr, 1);
+    thread_context_ptr->priv  = context_ptr;
+    thread_context_ptr->dctor = metrics_context_dctor;
+
+    // Input System Resource Manager FIFO
+    context_ptr->metrics_input_fifo_ptr = svt_system_resource_get_consumer_fifo(
+        enc_handle_ptr->metrics_tasks_resource_ptr, index);
+
+    if (scs_ptr->static_config.encoder_bit_depth > EB_8BIT) {
+        // A band, the 4 rows below it read by its last SSIM windows, or a 64x64 SB
+        context_ptr->input_16bit_stride = MAX(scs_ptr->max_input_luma_width, 64);
+        EB_MALLOC_ARRAY(context_ptr->input_16bit,
+                        context_ptr->input_16bit_stride * (METRICS_BAND_HEIGHT + 8));
+    }
+
+    return EB_ErrorNone;
+}
+
+//************************************/
+// Calculate Frame SSIM
+/************************************/
+
+void svt_aom_ssim_parms_8x8_c(const uint8_t *s, int sp, const uint8_t *r, int rp,
+                              uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s,
+                              uint32_t *sum_sq_r, uint32_t *sum_sxr) {
+    for (int i = 0; i < 8; i++, s += sp, r += rp) {
+        for (int j = 0; j < 8; j++) {
+            *sum_s += s[j];
+            *sum_r += r[j];
+            *sum_sq_s += s[j] * s[j];
+            *sum_sq_r += r[j] * r[j];
+            *sum_sxr += s[j] * r[j];
+        }
+    }
+}
+
+void svt_aom_highbd_ssim_parms_8x8_c(const uint16_t *s, int sp, const uint16_t *r, int rp,
+                                     uint32_t *sum_s, uint32_t *sum_r, uint32_t *sum_sq_s,
+                                     uint32_t *sum_sq_r, uint32_t *sum_sxr) {
+    for (int i = 0; i < 8; i++, s += sp, r += rp) {
+        for (int j = 0; j < 8; j++) {
+            *sum_s += s[j];
+            *sum_r += r[j];
+            *sum_sq_s += s[j] * s[j];
+            *sum_sq_r += r[j] * r[j];
+            *sum_sxr += s[j] * r[j];
+        }
+    }
+}
+
+static const int64_t cc1    = 26634; // (64^2*(.01*255)^2
+static const int64_t cc2    = 239708; // (64^2*(.03*255)^2
+static const int64_t cc1_10 = 428658; // (64^2*(.01*1023)^2
+static const int64_t cc2_10 = 3857925; // (64^2*(.03*1023)^2
+static const int64_t cc1_12 = 6868593; // (64^2*(.01*4095)^2
+static const int64_t cc2_12 = 61817334; // (64^2*(.03*4095)^2
+
+static double similarity(uint32_t sum_s, uint32_t sum_r, uint32_t sum_sq_s, uint32_t sum_sq_r,
+                         uint32_t sum_sxr, int count, uint32_t bd) {
+    double  ssim_n, ssim_d;
+    int64_t c1, c2;
+
+    if (bd == 8) {
+        // scale the constants by number of pixels
+        c1 = (cc1 * count * count) >> 12;
+        c2 = (cc2 * count * count) >> 12;
+    } else if (bd == 10) {
+        c1 = (cc1_10 * count * count) >> 12;
+        c2 = (cc2_10 * count * count) >> 12;
+    } else if (bd == 12) {
+        c1 = (cc1_12 * count * count) >> 12;
+        c2 = (cc2_12 * count * count) >> 12;
+    } else {
+        c1 = c2 = 0;
+        assert(0);
+    }
+
+    ssim_n = (2.0 * sum_s * sum_r + c1) * (2.0 * count * sum_sxr - 2.0 * sum_s * sum_r + c2);
+
+    ssim_d = ((double)sum_s * sum_s + (double)sum_r * sum_r + c1) *
+        ((double)count * sum_sq_s - (double)sum_s * sum_s + (double)count * sum_sq_r -
+         (double)sum_r * sum_r + c2);
+
+    return ssim_n / ssim_d;
+}
+
+static double ssim_8x8(const uint8_t *s, int sp, const uint8_t *r, int rp) {
+    uint32_t sum_s = 0, sum_r = 0, sum_sq_s = 0, sum_sq_r = 0, sum_sxr = 0;
+    svt_aom_ssim_parms_8x8(s, sp, r, rp, &sum_s, &sum_r, &sum_sq_s, &sum_sq_r, &sum_sxr);
+    return similarity(sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr, 64, 8);
+}
+
+static double highbd_ssim_8x8(const uint16_t *s, int sp, const uint16_t *r, int rp, uint32_t bd) {
+    uint32_t sum_s = 0, sum_r = 0, sum_sq_s = 0, sum_sq_r = 0, sum_sxr = 0;
+    svt_aom_highbd_ssim_parms_8x8(s, sp, r, rp, &sum_s, &sum_r, &sum_sq_s, &sum_sq_r, &sum_sxr);
+    return similarity(sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr, 64, bd);
+}
+
+// We are using a 8x8 moving window with starting location of each 8x8 window
+// on the 4x4 pixel grid. Such arrangement allows the windows to overlap
+// block boundaries to penalize blocking artifacts. Only the windows starting
+// in the first 'rows' rows are summed, so that the bands of a picture add up
+// to the windows of the whole picture.
+static double ssim_sum(const uint8_t *img1, int stride_img1, const uint8_t *img2, int stride_img2,
+                       int width, int height, int rows) {
+    double ssim_total = 0;
+    for (int i = 0; i < rows && i <= height - 8;
+         i += 4, img1 += stride_img1 * 4, img2 += stride_img2 * 4) {
+        for (int j = 0; j <= width - 8; j += 4)
+            ssim_total += ssim_8x8(img1 + j, stride_img1, img2 + j, stride_img2);
+    }
+    return ssim_total;
+}
+
+static double highbd_ssim_sum(const uint16_t *img1, int stride_img1, const uint16_t *img2,
+                              int stride_img2, int width, int height, int rows, uint32_t bd) {
+    double ssim_total = 0;
+    for (int i = 0; i < rows && i <= height - 8;
+         i += 4, img1 += stride_img1 * 4, img2 += stride_img2 * 4) {
+        for (int j = 0; j <= width - 8; j += 4)
+            ssim_total += highbd_ssim_8x8(img1 + j, stride_img1, img2 + j, stride_img2, bd);
+    }
+    return ssim_total;
+}
+
+static uint32_t ssim_window_count(int width, int height) {
+    if (width < 8 || height < 8)
+        return 0;
+    return (uint32_t)(((height - 8) / 4 + 1) * ((width - 8) / 4 + 1));
+}
+
+//************************************/
+// Calculate Frame SSE
+/************************************/
+
+// The kernels are used on whole tiles of tile_width columns, which they
+// support for any number of rows, and the C code on the last partial tile.
+static uint64_t sse_rows(const uint8_t *a, int a_stride, const uint8_t *b, int b_stride, int width,
+                         int height, int tile_width) {
+    uint64_t sse = 0;
+    for (int x = 0; x < width; x += tile_width) {
+        const int w = MIN(tile_width, width - x);
+        sse += w == tile_width ? svt_aom_sse(a + x, a_stride, b + x, b_stride, w, height)
+                               : svt_aom_sse_c(a + x, a_stride, b + x, b_stride, w, height);
+    }
+    return sse;
+}
+
+static uint64_t highbd_sse_rows(const uint16_t *a, int a_stride, const uint16_t *b, int b_stride,
+                                int width, int height, int tile_width) {
+    uint64_t sse = 0;
+    for (int x = 0; x < width; x += tile_width) {
+        const int w = MIN(tile_width, width - x);
+        sse += w == tile_width
+            ? svt_aom_highbd_sse(
+                  (const uint8_t *)(a + x), a_stride, (const uint8_t *)(b + x), b_stride, w, height)
+            : svt_aom_highbd_sse_c(
+                  (const uint8_t *)(a + x), a_stride, (const uint8_t *)(b + x), b_stride, w, height);
+    }
+    return sse;
+}
+
+static EbPictureBufferDesc *get_metrics_recon(PictureControlSet *pcs_ptr, EbBool is_16bit) {
+    PictureParentControlSet *ppcs_ptr = pcs_ptr->parent_pcs_ptr;
+    if (ppcs_ptr->is_used_as_reference_flag == EB_TRUE) {
+        EbReferenceObject *ref_obj = (EbReferenceObject *)
+                                         ppcs_ptr->reference_picture_wrapper_ptr->object_ptr;
+        return is_16bit ? ref_obj->reference_picture16bit : ref_obj->reference_picture;
+    }
+    return is_16bit ? pcs_ptr->recon_picture16bit_ptr : pcs_ptr->recon_picture_ptr;
+}
+
+static void get_metrics_plane(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr,
+                              int plane, MetricsPlane *p) {
+    PictureParentControlSet *ppcs_ptr  = pcs_ptr->parent_pcs_ptr;
+    const EbBool             is_16bit  = scs_ptr->static_config.encoder_bit_depth > EB_8BIT;
+    EbPictureBufferDesc *    recon_ptr = get_metrics_recon(pcs_ptr, is_16bit);
+    // The superres recon is upscaled, so it is compared to the unscaled source
+    EbPictureBufferDesc *input_picture_ptr = ppcs_ptr->enhanced_unscaled_picture_ptr;
+    const uint32_t       ss_x              = plane ? scs_ptr->subsampling_x : 0;
+    const uint32_t       ss_y              = plane ? scs_ptr->subsampling_y : 0;
+    const uint32_t       div               = plane ? 2 : 1;
+    const uint32_t       in_offset         = input_picture_ptr->origin_x / div +
+        input_picture_ptr->origin_y / div *
+            (plane == 0 ? input_picture_ptr->stride_y
+                        : plane == 1 ? input_picture_ptr->stride_cb : input_picture_ptr->stride_cr);
+    EbByte buffers[3]         = {input_picture_ptr->buffer_y,
+                         input_picture_ptr->buffer_cb,
+                         input_picture_ptr->buffer_cr};
+    EbByte bit_inc_buffers[3] = {input_picture_ptr->buffer_bit_inc_y,
+                                 input_picture_ptr->buffer_bit_inc_cb,
+                                 input_picture_ptr->buffer_bit_inc_cr};
+    const uint32_t bit_inc_strides[3] = {input_picture_ptr->stride_bit_inc_y,
+                                         input_picture_ptr->stride_bit_inc_cb,
+                                         input_picture_ptr->stride_bit_inc_cr};
+    const uint32_t src_strides[3]     = {
+        input_picture_ptr->stride_y, input_picture_ptr->stride_cb, input_picture_ptr->stride_cr};
+    EbByte         recon_buffers[3] = {recon_ptr->buffer_y, recon_ptr->buffer_cb, recon_ptr->buffer_cr};
+    const uint32_t recon_strides[3] = {recon_ptr->stride_y, recon_ptr->stride_cb, recon_ptr->stride_cr};
+
+    // if current source picture was temporally filtered, use an alternative buffer which stores
+    // the original source picture
+    if (ppcs_ptr->temporal_filtering_on == EB_TRUE) {
+        buffers[plane] = ppcs_ptr->save_enhanced_picture_ptr[plane];
+        if (is_16bit)
+            bit_inc_buffers[plane] = ppcs_ptr->save_enhanced_picture_bit_inc_ptr[plane];
+    }
+
+    p->src_stride         = src_strides[plane];
+    p->src                = buffers[plane] + in_offset;
+    p->src_bit_inc_stride = bit_inc_strides[plane];
+    p->src_bit_inc        = is_16bit ? bit_inc_buffers[plane] + input_picture_ptr->origin_x / div +
+            input_picture_ptr->origin_y / div * p->src_bit_inc_stride
+                                     : NULL;
+    p->recon_stride = recon_strides[plane];
+    p->recon        = recon_buffers[plane] +
+        ((recon_ptr->origin_x / div + recon_ptr->origin_y / div * p->recon_stride) << is_16bit);
+    p->psnr_width  = (input_picture_ptr->width - scs_ptr->max_input_pad_right) >> ss_x;
+    p->psnr_height = (input_picture_ptr->height - scs_ptr->max_input_pad_bottom) >> ss_y;
+    p->ssim_width  = plane ? scs_ptr->chroma_width : scs_ptr->seq_header.max_frame_width;
+    p->ssim_height = plane ? scs_ptr->chroma_height : scs_ptr->seq_header.max_frame_height;
+    p->band_height = METRICS_BAND_HEIGHT >> ss_y;
+}
+
+/* SSE of the rows of the band, and sum of the SSIM of the 8x8 windows starting in them */
+static void measure_band_plane(MetricsContext *context_ptr, const MetricsPlane *p, uint32_t band,
+                               EbBool is_16bit, uint32_t bd, int tile_width, uint64_t *sse,
+                               double *ssim) {
+    const int y0       = band * p->band_height;
+    const int y1       = y0 + p->band_height;
+    const int psnr_end = MIN(y1, p->psnr_height);
+    // the last windows of the band read 4 rows of the next one
+    const int ssim_end = MIN(y1 + 4, p->ssim_height);
+
+    *sse  = 0;
+    *ssim = 0;
+    if (!is_16bit) {
+        const uint8_t *src   = p->src + y0 * p->src_stride;
+        const uint8_t *recon = p->recon + y0 * p->recon_stride;
+        if (psnr_end > y0)
+            *sse = sse_rows(
+                src, p->src_stride, recon, p->recon_stride, p->psnr_width, psnr_end - y0, tile_width);
+        if (ssim_end > y0)
+            *ssim = ssim_sum(src,
+                             p->src_stride,
+                             recon,
+                             p->recon_stride,
+                             p->ssim_width,
+                             p->ssim_height - y0,
+                             p->band_height);
+        return;
+    }
+
+    const int rows = MAX(psnr_end, ssim_end) - y0;
+    if (rows <= 0)
+        return;
+    const uint16_t *recon = (const uint16_t *)p->recon + y0 * p->recon_stride;
+    pack2d_src(p->src + y0 * p->src_stride,
+               p->src_stride,
+               p->src_bit_inc + y0 * p->src_bit_inc_stride,
+               p->src_bit_inc_stride,
+               context_ptr->input_16bit,
+               context_ptr->input_16bit_stride,
+               MAX(p->psnr_width, p->ssim_width),
+               rows);
+    if (psnr_end > y0)
+        *sse = highbd_sse_rows(context_ptr->input_16bit,
+                               context_ptr->input_16bit_stride,
+                               recon,
+                               p->recon_stride,
+                               p->psnr_width,
+                               psnr_end - y0,
+                               tile_width);
+    if (ssim_end > y0)
+        *ssim = highbd_ssim_sum(context_ptr->input_16bit,
+                                context_ptr->input_16bit_stride,
+                                recon,
+                                p->recon_stride,
+                                p->ssim_width,
+                                p->ssim_height - y0,
+                                p->band_height,
+                                bd);
+}
+
+/* Called by the metrics process completing the last band of a picture: sums
+ * the bands in order, so that the result does not depend on the scheduling,
+ * and hands the picture back to packetization. */
+static void metrics_finish_picture(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr) {
+    PictureParentControlSet *ppcs_ptr = pcs_ptr->parent_pcs_ptr;
+    const EbBool             is_16bit = scs_ptr->static_config.encoder_bit_depth > EB_8BIT;
+    uint64_t                 sse[3]   = {0};
+    double                   ssim[3]  = {0};
+    double                   ssim_count[3];
+
+    for (uint32_t band = 0; band < ppcs_ptr->metrics_band_count; band++) {
+        for (int plane = 0; plane < 3; plane++) {
+            sse[plane] += ppcs_ptr->metrics_bands[band].sse[plane];
+            ssim[plane] += ppcs_ptr->metrics_bands[band].ssim[plane];
+        }
+    }
+    ssim_count[0] = ssim_window_count(scs_ptr->seq_header.max_frame_width,
+                                      scs_ptr->seq_header.max_frame_height);
+    ssim_count[1] = ssim_count[2] = ssim_window_count(scs_ptr->chroma_width,
+                                                      scs_ptr->chroma_height);
+    assert(ssim_count[0] > 0 && ssim_count[1] > 0);
+
+    ppcs_ptr->luma_sse  = (uint32_t)sse[0];
+    ppcs_ptr->cb_sse    = (uint32_t)sse[1];
+    ppcs_ptr->cr_sse    = (uint32_t)sse[2];
+    ppcs_ptr->luma_ssim = ssim[0] / ssim_count[0];
+    ppcs_ptr->cb_ssim   = ssim[1] / ssim_count[1];
+    ppcs_ptr->cr_ssim   = ssim[2] / ssim_count[2];
+
+    // the original source picture saved before temporal filtering is not needed anymore
+    if (ppcs_ptr->temporal_filtering_on == EB_TRUE) {
+        for (int plane = 0; plane < 3; plane++) {
+            EB_FREE_ARRAY(ppcs_ptr->save_enhanced_picture_ptr[plane]);
+            if (is_16bit)
+                EB_FREE_ARRAY(ppcs_ptr->save_enhanced_picture_bit_inc_ptr[plane]);
+        }
+    }
+    // Release the hold of the rest process on the reference picture
+    if (ppcs_ptr->is_used_as_reference_flag == EB_TRUE)
+        svt_release_object(ppcs_ptr->reference_picture_wrapper_ptr);
+    svt_post_semaphore(ppcs_ptr->metrics_done_semaphore);
+}
+
+/******************************************************
+ * Metrics Kernel
+ *   Measures the PSNR and SSIM of a band of a picture,
+ *   after the rest process has filtered the picture.
+ ******************************************************/
+void *metrics_kernel(void *input_ptr) {
+    // Context & SCS & PCS
+    EbThreadContext *thread_context_ptr = (EbThreadContext *)input_ptr;
+    MetricsContext * context_ptr        = (MetricsContext *)thread_context_ptr->priv;
+
+    // Input
+    EbObjectWrapper *metrics_tasks_wrapper_ptr;
+
+    for (;;) {
+        // Get Metrics Task
+        EB_GET_FULL_OBJECT(context_ptr->metrics_input_fifo_ptr, &metrics_tasks_wrapper_ptr);
+
+        MetricsTasks *metrics_tasks_ptr = (MetricsTasks *)metrics_tasks_wrapper_ptr->object_ptr;
+        PictureControlSet *pcs_ptr      = (PictureControlSet *)
+                                         metrics_tasks_ptr->pcs_wrapper_ptr->object_ptr;
+        SequenceControlSet *scs_ptr  = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+        PictureParentControlSet *ppcs_ptr = pcs_ptr->parent_pcs_ptr;
+        const uint32_t           band     = metrics_tasks_ptr->band_index;
+        const EbBool   is_16bit = scs_ptr->static_config.encoder_bit_depth > EB_8BIT;
+        const uint32_t bd       = scs_ptr->static_config.encoder_bit_depth;
+        MetricsBand *  result   = &ppcs_ptr->metrics_bands[band];
+
+        for (int plane = 0; plane < 3; plane++) {
+            MetricsPlane p;
+            get_metrics_plane(pcs_ptr, scs_ptr, plane, &p);
+            measure_band_plane(context_ptr,
+                               &p,
+                               band,
+                               is_16bit,
+                               bd,
+                               plane ? 64 >> scs_ptr->subsampling_x : 64,
+                               &result->sse[plane],
+                               &result->ssim[plane]);
+        }
+
+        if (svt_atomic_fetch_add_u32(&ppcs_ptr->metrics_bands_done, 1) ==
+            ppcs_ptr->metrics_band_count - 1)
+            metrics_finish_picture(pcs_ptr, scs_ptr);
+
+        // Release Metrics Task
+        svt_release_object(metrics_tasks_wrapper_ptr);
+    }
+
+    return NULL;
+}
@@ -0,0 +1,29 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+#ifndef EbMetricsProcess_h
+#define EbMetricsProcess_h
+
+#include "EbSystemResourceManager.h"
+#include "EbObject.h"
+
+// The PSNR and SSIM of a picture are measured in bands of 64 luma rows
+#define METRICS_BAND_HEIGHT 64
+
+/**************************************
+ * Extern Function Declarations
+ **************************************/
+extern EbErrorType metrics_context_ctor(EbThreadContext *  thread_context_ptr,
+                                        const EbEncHandle *enc_handle_ptr, int index);
+
+extern void *metrics_kernel(void *input_ptr);
+
+#endif
@@ -828,6 +828,7 @@ void *mode_decision_configuration_kernel(void *input_ptr) {
         PictureControlSet *pcs_ptr = (PictureControlSet *)
                                          rate_control_results_ptr->pcs_wrapper_ptr->object_ptr;
         SequenceControlSet *scs_ptr = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+        svt_aom_mark_frame_stats_stage(pcs_ptr->parent_pcs_ptr, EB_FRAME_STATS_ENC_DEC);
 
         // -------
         // Scale references if resolution of the reference is different than the input
@@ -849,6 +849,76 @@ static void open_loop_me_fullpel_search_sblock(MeContext *context_ptr, uint32_t
     }
 }
 
+// Search areas of all the references and search regions of a HME level, they
+// are searched with one svt_sad_loop_kernel_multi() call by hme_search_batch()
+#define HME_MAX_SEARCH_AREAS                                                        \
+    (MAX_NUM_OF_REF_PIC_LIST * MAX_REF_IDX * EB_HME_SEARCH_AREA_COLUMN_MAX_COUNT * \
+     EB_HME_SEARCH_AREA_ROW_MAX_COUNT)
+
+typedef struct HmeSearchBatch {
+    uint8_t *         src;
+    uint32_t          src_stride;
+    uint32_t          block_height;
+    uint32_t          block_width;
+    uint32_t          num_search_areas;
+    SadLoopSearchArea search_areas[HME_MAX_SEARCH_AREAS];
+    // Origin of the search areas, and where their results go in the ME context
+    int16_t   x_search_area_origin[HME_MAX_SEARCH_AREAS];
+    int16_t   y_search_area_origin[HME_MAX_SEARCH_AREAS];
+    uint64_t *best_sad[HME_MAX_SEARCH_AREAS];
+    int16_t * x_search_center[HME_MAX_SEARCH_AREAS];
+    int16_t * y_search_center[HME_MAX_SEARCH_AREAS];
+} HmeSearchBatch;
+
+static void hme_queue_search_area(HmeSearchBatch *batch, uint8_t *ref, uint32_t ref_stride,
+                                  uint32_t ref_stride_raw, int16_t search_area_width,
+                                  int16_t search_area_height, int16_t x_search_area_origin,
+                                  int16_t y_search_area_origin, uint64_t *best_sad,
+                                  int16_t *x_search_center, int16_t *y_search_center) {
+    const uint32_t n = batch->num_search_areas++;
+
+    assert(n < HME_MAX_SEARCH_AREAS);
+    batch->search_areas[n].ref            = ref;
+    batch->search_areas[n].ref_stride     = ref_stride;
+    batch->search_areas[n].ref_stride_raw = ref_stride_raw;
+    batch->search_areas[n].width          = search_area_width;
+    batch->search_areas[n].height         = search_area_height;
+    batch->x_search_area_origin[n]        = x_search_area_origin;
+    batch->y_search_area_origin[n]        = y_search_area_origin;
+    batch->best_sad[n]                    = best_sad;
+    batch->x_search_center[n]             = x_search_center;
+    batch->y_search_center[n]             = y_search_center;
+}
+
+/*******************************************
+ * hme_search_batch
+ *   searches the queued search areas of a
+ *   HME level and stores the best MVs, scaled
+ *   by mv_scale to the full resolution
+ *******************************************/
+static void hme_search_batch(MeContext *context_ptr, HmeSearchBatch *batch, int16_t mv_scale) {
+    if (!batch->num_search_areas)
+        return;
+    svt_sad_loop_kernel_multi(batch->src,
+                              batch->src_stride,
+                              batch->block_height,
+                              batch->block_width,
+                              batch->search_areas,
+                              batch->num_search_areas);
+
+    for (uint32_t i = 0; i < batch->num_search_areas; i++) {
+        const SadLoopSearchArea *area = &batch->search_areas[i];
+
+        *batch->best_sad[i] = (context_ptr->hme_search_method == FULL_SAD_SEARCH)
+            ? area->best_sad
+            : area->best_sad * 2; // Multiply by 2 because considered only ever other line
+        *batch->x_search_center[i] =
+            (int16_t)((area->x_best + batch->x_search_area_origin[i]) * mv_scale);
+        *batch->y_search_center[i] =
+            (int16_t)((area->y_best + batch->y_search_area_origin[i]) * mv_scale);
+    }
+}
+
 void hme_level_0(
     PictureParentControlSet *pcs_ptr,
     MeContext *              context_ptr, // input/output parameter, ME context Ptr, used to
@@ -877,7 +947,8 @@ void hme_level_0(
     int16_t *yLevel0SearchCenter, // output parameter, Level0 yMV at
     // (search_region_number_in_width,
     // search_region_number_in_height)
-    uint32_t searchAreaMultiplierX, uint32_t searchAreaMultiplierY) {
+    uint32_t searchAreaMultiplierX, uint32_t searchAreaMultiplierY,
+    HmeSearchBatch *batch) { // output parameter, batch of the level0 search areas
     int16_t  x_top_left_search_region;
     int16_t  y_top_left_search_region;
     uint32_t search_region_index;
@@ -994,35 +1065,26 @@ void hme_level_0(
     search_region_index =
         x_top_left_search_region + y_top_left_search_region * sixteenth_ref_pic_ptr->stride_y;
 
-    // Put the first search location into level0 results
-    svt_sad_loop_kernel(
-                &context_ptr->sixteenth_sb_buffer[0],
-                context_ptr->sixteenth_sb_buffer_stride,
-                &sixteenth_ref_pic_ptr->buffer_y[search_region_index],
-                (context_ptr->hme_search_method == FULL_SAD_SEARCH)
-                    ? sixteenth_ref_pic_ptr->stride_y
-                    : sixteenth_ref_pic_ptr->stride_y * 2,
-                (context_ptr->hme_search_method == FULL_SAD_SEARCH) ? sb_height : sb_height >> 1,
-                sb_width,
-                /* results */
-                level0Bestsad_,
-                xLevel0SearchCenter,
-                yLevel0SearchCenter,
-                /* range */
-                sixteenth_ref_pic_ptr->stride_y,
-                search_area_width,
-                search_area_height);
-
-    *level0Bestsad_ =
-        (context_ptr->hme_search_method == FULL_SAD_SEARCH)
-            ? *level0Bestsad_
-            : *level0Bestsad_ * 2; // Multiply by 2 because considered only ever other line
-    *xLevel0SearchCenter += x_search_area_origin;
-    *xLevel0SearchCenter *= 4; // Multiply by 4 because operating on 1/4 resolution
-    *yLevel0SearchCenter += y_search_area_origin;
-    *yLevel0SearchCenter *= 4; // Multiply by 4 because operating on 1/4 resolution
-
-    return;
+    // The search area is searched with the other references and search regions
+    // of the level
+    batch->src          = &context_ptr->sixteenth_sb_buffer[0];
+    batch->src_stride   = context_ptr->sixteenth_sb_buffer_stride;
+    batch->block_height = (context_ptr->hme_search_method == FULL_SAD_SEARCH) ? sb_height
+                                                                              : sb_height >> 1;
+    batch->block_width  = sb_width;
+    hme_queue_search_area(batch,
+                          &sixteenth_ref_pic_ptr->buffer_y[search_region_index],
+                          (context_ptr->hme_search_method == FULL_SAD_SEARCH)
+                              ? sixteenth_ref_pic_ptr->stride_y
+                              : sixteenth_ref_pic_ptr->stride_y * 2,
+                          sixteenth_ref_pic_ptr->stride_y,
+                          search_area_width,
+                          search_area_height,
+                          x_search_area_origin,
+                          y_search_area_origin,
+                          level0Bestsad_,
+                          xLevel0SearchCenter,
+                          yLevel0SearchCenter);
 }
 
 void hme_level_1(
@@ -1055,9 +1117,10 @@ void hme_level_1(
     int16_t *xLevel1SearchCenter, // output parameter, Level1 xMV at
     // (search_region_number_in_width,
     // search_region_number_in_height)
-    int16_t *yLevel1SearchCenter // output parameter, Level1 yMV at
+    int16_t *yLevel1SearchCenter, // output parameter, Level1 yMV at
     // (search_region_number_in_width,
     // search_region_number_in_height)
+    HmeSearchBatch *batch // output parameter, batch of the level1 search areas
 ) {
     int16_t  x_top_left_search_region;
     int16_t  y_top_left_search_region;
@@ -1142,36 +1205,28 @@ void hme_level_1(
     search_region_index =
         x_top_left_search_region + y_top_left_search_region * quarter_ref_pic_ptr->stride_y;
 
-    // Put the first search location into level0 results
-    svt_sad_loop_kernel(
-        &context_ptr->quarter_sb_buffer[0],
-        (context_ptr->hme_search_method == FULL_SAD_SEARCH)
-            ? context_ptr->quarter_sb_buffer_stride
-            : context_ptr->quarter_sb_buffer_stride * 2,
-        &quarter_ref_pic_ptr->buffer_y[search_region_index],
-        (context_ptr->hme_search_method == FULL_SAD_SEARCH) ? quarter_ref_pic_ptr->stride_y
-                                                            : quarter_ref_pic_ptr->stride_y * 2,
-        (context_ptr->hme_search_method == FULL_SAD_SEARCH) ? sb_height : sb_height >> 1,
-        sb_width,
-        /* results */
-        level1Bestsad_,
-        xLevel1SearchCenter,
-        yLevel1SearchCenter,
-        /* range */
-        quarter_ref_pic_ptr->stride_y,
-        search_area_width,
-        search_area_height);
-
-    *level1Bestsad_ =
-        (context_ptr->hme_search_method == FULL_SAD_SEARCH)
-            ? *level1Bestsad_
-            : *level1Bestsad_ * 2; // Multiply by 2 because considered only ever other line
-    *xLevel1SearchCenter += x_search_area_origin;
-    *xLevel1SearchCenter *= 2; // Multiply by 2 because operating on 1/2 resolution
-    *yLevel1SearchCenter += y_search_area_origin;
-    *yLevel1SearchCenter *= 2; // Multiply by 2 because operating on 1/2 resolution
-
-    return;
+    // The search area is searched with the other references and search regions
+    // of the level
+    batch->src          = &context_ptr->quarter_sb_buffer[0];
+    batch->src_stride   = (context_ptr->hme_search_method == FULL_SAD_SEARCH)
+          ? context_ptr->quarter_sb_buffer_stride
+          : context_ptr->quarter_sb_buffer_stride * 2;
+    batch->block_height = (context_ptr->hme_search_method == FULL_SAD_SEARCH) ? sb_height
+                                                                              : sb_height >> 1;
+    batch->block_width  = sb_width;
+    hme_queue_search_area(batch,
+                          &quarter_ref_pic_ptr->buffer_y[search_region_index],
+                          (context_ptr->hme_search_method == FULL_SAD_SEARCH)
+                              ? quarter_ref_pic_ptr->stride_y
+                              : quarter_ref_pic_ptr->stride_y * 2,
+                          quarter_ref_pic_ptr->stride_y,
+                          search_area_width,
+                          search_area_height,
+                          x_search_area_origin,
+                          y_search_area_origin,
+                          level1Bestsad_,
+                          xLevel1SearchCenter,
+                          yLevel1SearchCenter);
 }
 
 void hme_level_2(PictureParentControlSet *pcs_ptr, // input parameter, Picture control set Ptr
@@ -1201,9 +1256,10 @@ void hme_level_2(PictureParentControlSet *pcs_ptr, // input parameter, Picture c
                  int16_t *xLevel2SearchCenter, // output parameter, Level2 xMV at
                  // (search_region_number_in_width,
                  // search_region_number_in_height)
-                 int16_t *yLevel2SearchCenter // output parameter, Level2 yMV at
+                 int16_t *yLevel2SearchCenter, // output parameter, Level2 yMV at
                  // (search_region_number_in_width,
                  // search_region_number_in_height)
+                 HmeSearchBatch *batch // output parameter, batch of the level2 search areas
 ) {
     int16_t  x_top_left_search_region;
     int16_t  y_top_left_search_region;
@@ -1287,33 +1343,28 @@ void hme_level_2(PictureParentControlSet *pcs_ptr, // input parameter, Picture c
     search_region_index =
         x_top_left_search_region + y_top_left_search_region * ref_pic_ptr->stride_y;
 
-    // Put the first search location into level0 results
-    svt_sad_loop_kernel(
-        context_ptr->sb_src_ptr,
-        (context_ptr->hme_search_method == FULL_SAD_SEARCH) ? context_ptr->sb_src_stride
-                                                            : context_ptr->sb_src_stride * 2,
-        &ref_pic_ptr->buffer_y[search_region_index],
-        (context_ptr->hme_search_method == FULL_SAD_SEARCH) ? ref_pic_ptr->stride_y
-                                                            : ref_pic_ptr->stride_y * 2,
-        (context_ptr->hme_search_method == FULL_SAD_SEARCH) ? sb_height : sb_height >> 1,
-        sb_width,
-        /* results */
-        level2Bestsad_,
-        xLevel2SearchCenter,
-        yLevel2SearchCenter,
-        /* range */
-        ref_pic_ptr->stride_y,
-        search_area_width,
-        search_area_height);
-
-    *level2Bestsad_ =
-        (context_ptr->hme_search_method == FULL_SAD_SEARCH)
-            ? *level2Bestsad_
-            : *level2Bestsad_ * 2; // Multiply by 2 because considered only ever other line
-    *xLevel2SearchCenter += x_search_area_origin;
-    *yLevel2SearchCenter += y_search_area_origin;
-
-    return;
+    // The search area is searched with the other references and search regions
+    // of the level
+    batch->src          = context_ptr->sb_src_ptr;
+    batch->src_stride   = (context_ptr->hme_search_method == FULL_SAD_SEARCH)
+          ? context_ptr->sb_src_stride
+          : context_ptr->sb_src_stride * 2;
+    batch->block_height = (context_ptr->hme_search_method == FULL_SAD_SEARCH) ? sb_height
+                                                                              : sb_height >> 1;
+    batch->block_width  = sb_width;
+    hme_queue_search_area(batch,
+                          &ref_pic_ptr->buffer_y[search_region_index],
+                          (context_ptr->hme_search_method == FULL_SAD_SEARCH)
+                              ? ref_pic_ptr->stride_y
+                              : ref_pic_ptr->stride_y * 2,
+                          ref_pic_ptr->stride_y,
+                          search_area_width,
+                          search_area_height,
+                          x_search_area_origin,
+                          y_search_area_origin,
+                          level2Bestsad_,
+                          xLevel2SearchCenter,
+                          yLevel2SearchCenter);
 }
 
 // Nader - to be replaced by loock-up table
@@ -2222,6 +2273,8 @@ static void hme_level0_sb(PictureParentControlSet *pcs_ptr, uint32_t sb_origin_x
     // HME
     uint32_t search_region_number_in_width  = 0;
     uint32_t search_region_number_in_height = 0;
+    HmeSearchBatch batch;
+    batch.num_search_areas = 0;
 
     // Uni-Prediction motion estimation loop
     // List Loop
@@ -2305,7 +2358,8 @@ static void hme_level0_sb(PictureParentControlSet *pcs_ptr, uint32_t sb_origin_x
                                           [list_index][ref_pic_index][search_region_number_in_width]
                                           [search_region_number_in_height]),
                                     hme_sr_factor_x,
-                                    hme_sr_factor_y);
+                                    hme_sr_factor_y,
+                                    &batch);
                                 search_region_number_in_width++;
                             }
                             search_region_number_in_width = 0;
@@ -2325,6 +2379,9 @@ static void hme_level0_sb(PictureParentControlSet *pcs_ptr, uint32_t sb_origin_x
             }
         }
     }
+
+    // Search the level0 search areas of all the references at once
+    hme_search_batch(context_ptr, &batch, 4);
 }
 
 /*******************************************
@@ -2349,6 +2406,8 @@ void hme_level1_sb(
     // HME
     uint32_t search_region_number_in_width = 0;
     uint32_t search_region_number_in_height = 0;
+    HmeSearchBatch batch;
+    batch.num_search_areas = 0;
     // Configure HME level 0, level 1 and level 2 from static config parameters
     const uint8_t enable_hme_level1_flag = context_ptr->hme_decimation == ONE_DECIMATION_HME
         ? context_ptr->enable_hme_level0_flag
@@ -2420,7 +2479,8 @@ void hme_level1_sb(
                                     context_ptr->y_hme_level0_search_center[list_index][ref_pic_index][search_region_number_in_width][search_region_number_in_height] >> 1,
                                     &(context_ptr->hme_level1_sad[list_index][ref_pic_index][search_region_number_in_width][search_region_number_in_height]),
                                     &(context_ptr->x_hme_level1_search_center[list_index][ref_pic_index][search_region_number_in_width][search_region_number_in_height]),
-                                    &(context_ptr->y_hme_level1_search_center[list_index][ref_pic_index][search_region_number_in_width][search_region_number_in_height]));
+                                    &(context_ptr->y_hme_level1_search_center[list_index][ref_pic_index][search_region_number_in_width][search_region_number_in_height]),
+                                    &batch);
 
                                 search_region_number_in_width++;
                             }
@@ -2436,6 +2496,9 @@ void hme_level1_sb(
             }
         }
     }
+
+    // Search the level1 search areas of all the references at once
+    hme_search_batch(context_ptr, &batch, 2);
 }
 
 /*******************************************
@@ -2454,6 +2517,8 @@ static void hme_level2_sb(PictureParentControlSet *pcs_ptr, uint32_t sb_origin_x
     // HME
     uint32_t search_region_number_in_width  = 0;
     uint32_t search_region_number_in_height = 0;
+    HmeSearchBatch batch;
+    batch.num_search_areas = 0;
 
     // Configure HME level 0, level 1 and level 2 from static config parameters
     const EbBool enable_hme_level2_flag = context_ptr->hme_decimation == ZERO_DECIMATION_HME
@@ -2549,7 +2614,8 @@ static void hme_level2_sb(PictureParentControlSet *pcs_ptr, uint32_t sb_origin_x
                                                                   [search_region_number_in_height]),
                                 &(context_ptr->y_hme_level2_search_center
                                       [list_index][ref_pic_index][search_region_number_in_width]
-                                      [search_region_number_in_height]));
+                                      [search_region_number_in_height]),
+                                &batch);
 
                             search_region_number_in_width++;
                         }
@@ -2567,6 +2633,9 @@ static void hme_level2_sb(PictureParentControlSet *pcs_ptr, uint32_t sb_origin_x
             }
         }
     }
+
+    // Search the level2 search areas of all the references at once
+    hme_search_batch(context_ptr, &batch, 1);
 }
 
 /*******************************************
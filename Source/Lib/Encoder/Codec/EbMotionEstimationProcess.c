@@ -723,6 +723,7 @@ EbErrorType compute_zz_ssd(/*MotionEstimationContext_t *context_ptr, */PicturePa
     return return_error;
 }
 
+void tpl_mc_flow_dispenser_sb_rows(PictureParentControlSet *pcs_ptr);
 /************************************************
  * Motion Analysis Kernel
  * The Motion Analysis performs  Motion Estimation
@@ -1103,6 +1104,12 @@ void *motion_estimation_kernel(void *input_ptr) {
             svt_av1_init_temporal_filtering(
                 pcs_ptr->temp_filt_pcs_list, pcs_ptr, context_ptr, in_results_ptr->segment_index);
 
+            // Release the Input Results
+            svt_release_object(in_results_wrapper_ptr);
+        } else if (in_results_ptr->task_type == 3) {
+            // TPL dispenser SB rows, posted by the source based operations
+            tpl_mc_flow_dispenser_sb_rows(pcs_ptr);
+
             // Release the Input Results
             svt_release_object(in_results_wrapper_ptr);
         }
@@ -23,6 +23,7 @@
 #include "EbPictureDemuxResults.h"
 #include "EbLog.h"
 #include "EbSvtAv1ErrorCodes.h"
+#include "EbPsnr.h"
 
 /**************************************
  * Type Declarations
@@ -493,11 +494,14 @@ static void collect_frames_info(PacketizationContext* context_ptr, const EncodeC
         uint64_t finish_time_u_seconds = 0;
         svt_av1_get_time(&finish_time_seconds, &finish_time_u_seconds);
 
-        output_stream_ptr->n_tick_count = (uint32_t)svt_av1_compute_overall_elapsed_time_ms(
+        const double latency = svt_av1_compute_overall_elapsed_time_ms(
             queue_entry_ptr->start_time_seconds,
             queue_entry_ptr->start_time_u_seconds,
             finish_time_seconds,
             finish_time_u_seconds);
+        output_stream_ptr->n_tick_count = (uint32_t)latency;
+        if (output_stream_ptr->frame_stats)
+            output_stream_ptr->frame_stats->output_us = (uint32_t)(latency * 1000);
         output_stream_ptr->p_app_private = queue_entry_ptr->out_meta_data;
         if (queue_entry_ptr->is_alt_ref)
             output_stream_ptr->flags |= (uint32_t)EB_BUFFERFLAG_IS_ALT_REF;
@@ -565,6 +569,53 @@ static EbErrorType copy_data_from_bitstream(EncodeContext *encode_context_ptr, B
     return return_error;
 }
 
+void svt_aom_free_frame_stats(EbBufferHeaderType *output_stream_ptr) {
+    if (output_stream_ptr->frame_stats) {
+        for (uint32_t i = 0; i < output_stream_ptr->frame_stats_count; i++)
+            if (output_stream_ptr->frame_stats[i].sb_stats)
+                EB_FREE(output_stream_ptr->frame_stats[i].sb_stats);
+        EB_FREE(output_stream_ptr->frame_stats);
+    }
+    output_stream_ptr->frame_stats       = NULL;
+    output_stream_ptr->frame_stats_count = 0;
+}
+
+/* Moves the statistics of the frames of a temporal unit to the packet that carries the unit */
+static EbErrorType collect_frame_stats(EncodeContext *encode_context_ptr, int frames,
+                                       EbBufferHeaderType *output_stream_ptr) {
+    uint32_t      count = 0;
+    EbFrameStats *stats;
+
+    for (int i = 0; i < frames; i++) {
+        PacketizationReorderEntry *queue_entry_ptr = get_reorder_queue_entry(encode_context_ptr, i);
+        count += ((EbBufferHeaderType *)queue_entry_ptr->output_stream_wrapper_ptr->object_ptr)
+                     ->frame_stats_count;
+    }
+    if (count == output_stream_ptr->frame_stats_count)
+        return EB_ErrorNone;
+
+    EB_MALLOC(stats, count * sizeof(*stats));
+    count = 0;
+    for (int i = 0; i < frames; i++) {
+        PacketizationReorderEntry *queue_entry_ptr = get_reorder_queue_entry(encode_context_ptr, i);
+        EbBufferHeaderType *       src_stream_ptr  = (EbBufferHeaderType *)
+                                                  queue_entry_ptr->output_stream_wrapper_ptr->object_ptr;
+        if (!src_stream_ptr->frame_stats_count)
+            continue;
+        // the superblock maps move along with their frames
+        svt_memcpy(stats + count,
+                   src_stream_ptr->frame_stats,
+                   src_stream_ptr->frame_stats_count * sizeof(*stats));
+        count += src_stream_ptr->frame_stats_count;
+        EB_FREE(src_stream_ptr->frame_stats);
+        src_stream_ptr->frame_stats       = NULL;
+        src_stream_ptr->frame_stats_count = 0;
+    }
+    output_stream_ptr->frame_stats       = stats;
+    output_stream_ptr->frame_stats_count = count;
+    return EB_ErrorNone;
+}
+
 static void encode_show_existing(EncodeContext *encode_context_ptr,
                                  PacketizationReorderEntry *queue_entry_ptr,
                                  EbBufferHeaderType        *output_stream_ptr) {
@@ -605,6 +656,341 @@ static inline EbErrorType malloc_p_buffer(EbBufferHeaderType *output_stream_ptr)
     return EB_ErrorNone;
 }
 
+/* Waits for the metrics processes to measure the PSNR and SSIM of the picture,
+ * which also ends their use of its source and recon buffers, and copies them to
+ * the output buffer of the picture (of its last packet in low latency mode). */
+static void set_output_metrics(PictureControlSet *pcs_ptr, EbBufferHeaderType *output_stream_ptr) {
+    PictureParentControlSet *ppcs_ptr = pcs_ptr->parent_pcs_ptr;
+    SequenceControlSet *     scs_ptr  = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+    if (!scs_ptr->static_config.stat_report)
+        return;
+    svt_block_on_semaphore(ppcs_ptr->metrics_done_semaphore);
+    output_stream_ptr->luma_sse  = ppcs_ptr->luma_sse;
+    output_stream_ptr->cr_sse    = ppcs_ptr->cr_sse;
+    output_stream_ptr->cb_sse    = ppcs_ptr->cb_sse;
+    output_stream_ptr->luma_ssim = ppcs_ptr->luma_ssim;
+    output_stream_ptr->cr_ssim   = ppcs_ptr->cr_ssim;
+    output_stream_ptr->cb_ssim   = ppcs_ptr->cb_ssim;
+}
+
+/* Fills in the picture properties of an output buffer, the metrics are set by
+ * set_output_metrics() */
+static void init_output_stream(PictureControlSet *pcs_ptr, EbBufferHeaderType *output_stream_ptr) {
+    PictureParentControlSet *ppcs_ptr = pcs_ptr->parent_pcs_ptr;
+    SequenceControlSet *     scs_ptr  = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+    EncodeContext *          encode_context_ptr = scs_ptr->encode_context_ptr;
+
+    output_stream_ptr->flags = 0;
+    output_stream_ptr->flags |=
+        (encode_context_ptr->terminating_sequence_flag_received == EB_TRUE &&
+         ppcs_ptr->decode_order == encode_context_ptr->terminating_picture_number)
+            ? EB_BUFFERFLAG_EOS
+            : 0;
+    output_stream_ptr->n_filled_len = 0;
+    output_stream_ptr->pts          = ppcs_ptr->input_ptr->pts;
+    //we output one temporal unit a time, so dts alwasy equals to pts.
+    output_stream_ptr->dts          = output_stream_ptr->pts;
+    output_stream_ptr->pic_type =
+        ppcs_ptr->is_used_as_reference_flag
+            ? ppcs_ptr->idr_flag ? EB_AV1_KEY_PICTURE : pcs_ptr->slice_type
+            : EB_AV1_NON_REF_PICTURE;
+    output_stream_ptr->p_app_private = ppcs_ptr->input_ptr->p_app_private;
+    output_stream_ptr->qp            = ppcs_ptr->picture_qp;
+    output_stream_ptr->frame_stats       = NULL;
+    output_stream_ptr->frame_stats_count = 0;
+    output_stream_ptr->luma_sse          = 0;
+    output_stream_ptr->cr_sse            = 0;
+    output_stream_ptr->cb_sse            = 0;
+    output_stream_ptr->luma_ssim         = 0;
+    output_stream_ptr->cr_ssim           = 0;
+    output_stream_ptr->cb_ssim           = 0;
+}
+
+/* Attaches the statistics of a coded picture to its output buffer, see EbFrameStats */
+static EbErrorType set_frame_stats(PictureControlSet *pcs_ptr, EbBufferHeaderType *output_stream_ptr) {
+    PictureParentControlSet *ppcs_ptr = pcs_ptr->parent_pcs_ptr;
+    SequenceControlSet *     scs_ptr  = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+    EbFrameStats *           stats;
+
+    svt_aom_mark_frame_stats_stage(ppcs_ptr, EB_FRAME_STATS_PACKETIZATION);
+    EB_CALLOC(stats, 1, sizeof(*stats));
+    output_stream_ptr->frame_stats       = stats;
+    output_stream_ptr->frame_stats_count = 1;
+
+    stats->picture_number       = ppcs_ptr->picture_number;
+    stats->decode_order         = ppcs_ptr->decode_order;
+    stats->pts                  = output_stream_ptr->pts;
+    stats->pic_type             = output_stream_ptr->pic_type;
+    stats->temporal_layer_index = pcs_ptr->temporal_layer_index;
+    stats->show_frame           = ppcs_ptr->frm_hdr.show_frame;
+    stats->qp                   = ppcs_ptr->picture_qp;
+    stats->base_qindex          = ppcs_ptr->frm_hdr.quantization_params.base_q_idx;
+    stats->bits                 = ppcs_ptr->total_num_bits;
+    if (scs_ptr->static_config.stat_report) {
+        const uint32_t width          = scs_ptr->seq_header.max_frame_width;
+        const uint32_t height         = scs_ptr->seq_header.max_frame_height;
+        const double   peak           = (1 << scs_ptr->static_config.encoder_bit_depth) - 1;
+        const double   luma_samples   = (double)width * height;
+        const double   chroma_samples = (double)((width + scs_ptr->subsampling_x) >>
+                                               scs_ptr->subsampling_x) *
+            ((height + scs_ptr->subsampling_y) >> scs_ptr->subsampling_y);
+        stats->luma_sse  = ppcs_ptr->luma_sse;
+        stats->cb_sse    = ppcs_ptr->cb_sse;
+        stats->cr_sse    = ppcs_ptr->cr_sse;
+        stats->luma_psnr = svt_aom_sse_to_psnr(luma_samples, peak, (double)stats->luma_sse);
+        stats->cb_psnr   = svt_aom_sse_to_psnr(chroma_samples, peak, (double)stats->cb_sse);
+        stats->cr_psnr   = svt_aom_sse_to_psnr(chroma_samples, peak, (double)stats->cr_sse);
+        stats->luma_ssim = ppcs_ptr->luma_ssim;
+        stats->cb_ssim   = ppcs_ptr->cb_ssim;
+        stats->cr_ssim   = ppcs_ptr->cr_ssim;
+    }
+    svt_memcpy(stats->stage_start_us,
+               ppcs_ptr->frame_stats_stage_us,
+               sizeof(stats->stage_start_us));
+
+    if (scs_ptr->static_config.frame_stats > 1) {
+        const uint32_t sb_size = scs_ptr->sb_size_pix;
+        stats->sb_size         = sb_size;
+        stats->sb_cols         = (ppcs_ptr->aligned_width + sb_size - 1) / sb_size;
+        stats->sb_rows         = (ppcs_ptr->aligned_height + sb_size - 1) / sb_size;
+        EB_MALLOC(stats->sb_stats, stats->sb_cols * stats->sb_rows * sizeof(EbSbStats));
+        for (uint32_t sb_index = 0; sb_index < stats->sb_cols * stats->sb_rows; sb_index++) {
+            const SuperBlock *sb_ptr         = pcs_ptr->sb_ptr_array[sb_index];
+            stats->sb_stats[sb_index].bits   = sb_ptr->total_bits;
+            stats->sb_stats[sb_index].qindex = sb_ptr->qindex;
+        }
+    }
+    return EB_ErrorNone;
+}
+
+/* Sends the coded size of a picture to rate control and its feedback to picture manager,
+ * and moves the picture output meta data to its reorder queue entry. */
+static void send_picture_feedback(PacketizationContext *context_ptr, PictureControlSet *pcs_ptr,
+                                  PacketizationReorderEntry *queue_entry_ptr,
+                                  uint32_t                   picture_bytes) {
+    SequenceControlSet *scs_ptr = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+    EncodeContext *     encode_context_ptr = scs_ptr->encode_context_ptr;
+    FrameHeader *       frm_hdr            = &pcs_ptr->parent_pcs_ptr->frm_hdr;
+    Av1Common *const    cm                 = pcs_ptr->parent_pcs_ptr->av1_cm;
+    uint16_t            tile_cnt = cm->tiles_info.tile_rows * cm->tiles_info.tile_cols;
+    EbObjectWrapper *   rate_control_tasks_wrapper_ptr;
+    EbObjectWrapper *   picture_manager_results_wrapper_ptr = NULL;
+
+    // Get Empty Rate Control Input Tasks
+    svt_get_empty_object(context_ptr->rate_control_tasks_output_fifo_ptr,
+                         &rate_control_tasks_wrapper_ptr);
+    RateControlTasks *rate_control_tasks_ptr = (RateControlTasks *)
+                                                   rate_control_tasks_wrapper_ptr->object_ptr;
+    rate_control_tasks_ptr->pcs_wrapper_ptr = pcs_ptr->picture_parent_control_set_wrapper_ptr;
+    rate_control_tasks_ptr->task_type       = RC_PACKETIZATION_FEEDBACK_RESULT;
+
+    if(use_input_stat(scs_ptr) ||
+        scs_ptr->lap_enabled ||
+        (scs_ptr->enable_dec_order) ||
+        (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE &&
+        pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr)) {
+        if (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE &&
+            pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr &&
+            pcs_ptr->parent_pcs_ptr->frame_end_cdf_update_mode) {
+            for (uint16_t tile_idx = 0; tile_idx < tile_cnt; tile_idx++) {
+                svt_av1_reset_cdf_symbol_counters(
+                    pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->fc);
+                ((EbReferenceObject *)
+                     pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)
+                    ->frame_context =
+                    (*pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->fc);
+            }
+        }
+        // Get Empty Results Object
+        svt_get_empty_object(context_ptr->picture_manager_input_fifo_ptr,
+                             &picture_manager_results_wrapper_ptr);
+
+        PictureDemuxResults *picture_manager_results_ptr =
+            (PictureDemuxResults *)picture_manager_results_wrapper_ptr->object_ptr;
+        picture_manager_results_ptr->picture_number  = pcs_ptr->picture_number;
+        picture_manager_results_ptr->picture_type    = EB_PIC_FEEDBACK;
+        picture_manager_results_ptr->decode_order = pcs_ptr->parent_pcs_ptr->decode_order;
+        picture_manager_results_ptr->scs_wrapper_ptr = pcs_ptr->scs_wrapper_ptr;
+    }
+    // Send the number of bytes per frame to RC
+    pcs_ptr->parent_pcs_ptr->total_num_bits = picture_bytes << 3;
+    queue_entry_ptr->total_num_bits         = pcs_ptr->parent_pcs_ptr->total_num_bits;
+    if (scs_ptr->static_config.rate_control_mode && !use_input_stat(scs_ptr) && !scs_ptr->lap_enabled)
+        // update the rate tables used in RC based on the encoded bits of each sb
+        update_rc_rate_tables(pcs_ptr, scs_ptr);
+    queue_entry_ptr->frame_type = frm_hdr->frame_type;
+    queue_entry_ptr->poc        = pcs_ptr->picture_number;
+    svt_memcpy(&queue_entry_ptr->av1_ref_signal,
+           &pcs_ptr->parent_pcs_ptr->av1_ref_signal,
+           sizeof(Av1RpsNode));
+
+    queue_entry_ptr->slice_type = pcs_ptr->slice_type;
+#if DETAILED_FRAME_OUTPUT
+    queue_entry_ptr->ref_poc_list0 = pcs_ptr->parent_pcs_ptr->ref_pic_poc_array[REF_LIST_0][0];
+    queue_entry_ptr->ref_poc_list1 = pcs_ptr->parent_pcs_ptr->ref_pic_poc_array[REF_LIST_1][0];
+    svt_memcpy(queue_entry_ptr->ref_poc_array,
+           pcs_ptr->parent_pcs_ptr->av1_ref_signal.ref_poc_array,
+           7 * sizeof(uint64_t));
+#endif
+    queue_entry_ptr->show_frame          = frm_hdr->show_frame;
+    queue_entry_ptr->has_show_existing   = pcs_ptr->parent_pcs_ptr->has_show_existing;
+    queue_entry_ptr->show_existing_frame = frm_hdr->show_existing_frame;
+
+    // Note: last chance here to add more output meta data for an encoded picture -->
+
+    // collect output meta data
+    queue_entry_ptr->out_meta_data = concat_eb_linked_list(
+        extract_passthrough_data(&(pcs_ptr->parent_pcs_ptr->data_ll_head_ptr)),
+        pcs_ptr->parent_pcs_ptr->app_out_data_ll_head_ptr);
+    pcs_ptr->parent_pcs_ptr->app_out_data_ll_head_ptr = (EbLinkedListNode *)NULL;
+
+    // Calling callback functions to release the memory allocated for data linked list in the application
+    while (pcs_ptr->parent_pcs_ptr->data_ll_head_ptr != NULL) {
+        EbLinkedListNode *app_data_ll_head_temp_ptr =
+            pcs_ptr->parent_pcs_ptr->data_ll_head_ptr->next;
+        if (pcs_ptr->parent_pcs_ptr->data_ll_head_ptr->release_cb_fnc_ptr != NULL)
+            pcs_ptr->parent_pcs_ptr->data_ll_head_ptr->release_cb_fnc_ptr(
+                pcs_ptr->parent_pcs_ptr->data_ll_head_ptr);
+        pcs_ptr->parent_pcs_ptr->data_ll_head_ptr = app_data_ll_head_temp_ptr;
+    }
+
+    if (scs_ptr->static_config.speed_control_flag) {
+        // update speed control variables
+        svt_block_on_mutex(encode_context_ptr->sc_buffer_mutex);
+        encode_context_ptr->sc_frame_out++;
+        svt_release_mutex(encode_context_ptr->sc_buffer_mutex);
+    }
+
+    // Post Rate Control Taks
+    svt_post_full_object(rate_control_tasks_wrapper_ptr);
+    if (use_input_stat(scs_ptr) ||
+        scs_ptr->lap_enabled ||
+        (scs_ptr->enable_dec_order) ||
+        (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE &&
+        pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr))
+        // Post the Full Results Object
+        svt_post_full_object(picture_manager_results_wrapper_ptr);
+    else
+        // Since feedback is not set to PM, life count of is reduced here instead of PM
+        svt_release_object(pcs_ptr->scs_wrapper_ptr);
+}
+
+/* Low latency mode: outputs the coded tiles of the picture at the head of the reorder queue.
+ * The first packet of a picture starts with the temporal delimiter and the picture headers,
+ * and every packet but the last one of the picture is flagged EB_BUFFERFLAG_PARTIAL.
+ * Returns EB_TRUE when the head picture is complete and has left the queue. */
+static EbBool output_head_picture_tiles(PacketizationContext *context_ptr,
+                                        EncodeContext *       encode_context_ptr) {
+    PacketizationReorderEntry *queue_entry_ptr = get_reorder_queue_entry(encode_context_ptr, 0);
+    if (!queue_entry_ptr->pcs_wrapper_ptr)
+        return EB_FALSE;
+    PictureControlSet * pcs_ptr  = (PictureControlSet *)queue_entry_ptr->pcs_wrapper_ptr->object_ptr;
+    SequenceControlSet *scs_ptr  = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+    Av1Common *const    cm       = pcs_ptr->parent_pcs_ptr->av1_cm;
+    const uint16_t      tile_cnt = cm->tiles_info.tile_rows * cm->tiles_info.tile_cols;
+    const EbBool        first    = queue_entry_ptr->tiles_emitted == 0;
+    // The last tile goes out with the complete picture
+    const uint16_t tile_end = queue_entry_ptr->picture_done ? tile_cnt : tile_cnt - 1;
+    uint16_t       ready_end = queue_entry_ptr->tiles_emitted;
+
+    svt_block_on_mutex(pcs_ptr->entropy_coding_pic_mutex);
+    while (ready_end < tile_end && pcs_ptr->entropy_coding_info[ready_end]->entropy_coding_tile_done)
+        ready_end++;
+    svt_release_mutex(pcs_ptr->entropy_coding_pic_mutex);
+    if (ready_end == queue_entry_ptr->tiles_emitted)
+        return EB_FALSE;
+
+    EbObjectWrapper *output_stream_wrapper_ptr;
+    svt_get_empty_object(encode_context_ptr->stream_output_fifo_ptr, &output_stream_wrapper_ptr);
+    EbBufferHeaderType *output_stream_ptr = (EbBufferHeaderType *)
+                                                output_stream_wrapper_ptr->object_ptr;
+    init_output_stream(pcs_ptr, output_stream_ptr);
+
+    output_stream_ptr->n_alloc_len = first
+        ? TD_SIZE + bitstream_get_bytes_count(pcs_ptr->bitstream_ptr)
+        : 0;
+    for (uint16_t tile_idx = queue_entry_ptr->tiles_emitted; tile_idx < ready_end; tile_idx++)
+        output_stream_ptr->n_alloc_len +=
+            pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->ec_writer.pos +
+            TILE_GROUP_OBU_MAX_OVERHEAD;
+    malloc_p_buffer(output_stream_ptr);
+    assert(output_stream_ptr->p_buffer != NULL && "bit-stream memory allocation failure");
+
+    if (first) {
+        encode_td_av1(output_stream_ptr->p_buffer);
+        output_stream_ptr->n_filled_len = TD_SIZE;
+        copy_data_from_bitstream(encode_context_ptr, pcs_ptr->bitstream_ptr, output_stream_ptr);
+        output_stream_ptr->flags |= EB_BUFFERFLAG_HAS_TD;
+    }
+    for (uint16_t tile_idx = queue_entry_ptr->tiles_emitted; tile_idx < ready_end; tile_idx++)
+        output_stream_ptr->n_filled_len += write_tile_group_obu_av1(
+            pcs_ptr, tile_idx, output_stream_ptr->p_buffer + output_stream_ptr->n_filled_len);
+    queue_entry_ptr->bytes_emitted += output_stream_ptr->n_filled_len - (first ? TD_SIZE : 0);
+    queue_entry_ptr->tiles_emitted = ready_end;
+
+    uint64_t finish_time_seconds   = 0;
+    uint64_t finish_time_u_seconds = 0;
+    svt_av1_get_time(&finish_time_seconds, &finish_time_u_seconds);
+    const double latency = svt_av1_compute_overall_elapsed_time_ms(
+        queue_entry_ptr->start_time_seconds,
+        queue_entry_ptr->start_time_u_seconds,
+        finish_time_seconds,
+        finish_time_u_seconds);
+    output_stream_ptr->n_tick_count = (uint32_t)latency;
+
+    if (queue_entry_ptr->tiles_emitted < tile_cnt) {
+        clear_eos_flag(output_stream_ptr);
+        output_stream_ptr->flags |= EB_BUFFERFLAG_PARTIAL;
+        output_stream_ptr->p_app_private = NULL;
+        svt_post_full_object(output_stream_wrapper_ptr);
+        return EB_FALSE;
+    }
+
+    // Only the last packet of the picture waits for its metrics
+    set_output_metrics(pcs_ptr, output_stream_ptr);
+    send_picture_feedback(context_ptr, pcs_ptr, queue_entry_ptr, queue_entry_ptr->bytes_emitted);
+    if (scs_ptr->static_config.frame_stats &&
+        set_frame_stats(pcs_ptr, output_stream_ptr) == EB_ErrorNone)
+        output_stream_ptr->frame_stats->output_us = (uint32_t)(latency * 1000);
+    output_stream_ptr->p_app_private = queue_entry_ptr->out_meta_data;
+    if (queue_entry_ptr->is_alt_ref)
+        output_stream_ptr->flags |= (uint32_t)EB_BUFFERFLAG_IS_ALT_REF;
+    svt_post_full_object(output_stream_wrapper_ptr);
+
+    //Release the Child PCS
+    svt_release_object(queue_entry_ptr->pcs_wrapper_ptr);
+    queue_entry_ptr->pcs_wrapper_ptr = (EbObjectWrapper *)NULL;
+    queue_entry_ptr->picture_done    = EB_FALSE;
+    queue_entry_ptr->tiles_emitted   = 0;
+    queue_entry_ptr->bytes_emitted   = 0;
+    release_frames(encode_context_ptr, 1);
+    return EB_TRUE;
+}
+
+/* Low latency mode: records the coded tiles of a picture and outputs what is ready */
+static void packetize_low_latency(PacketizationContext *context_ptr,
+                                  EntropyCodingResults *entropy_coding_results_ptr) {
+    PictureControlSet *pcs_ptr = (PictureControlSet *)
+                                     entropy_coding_results_ptr->pcs_wrapper_ptr->object_ptr;
+    SequenceControlSet *scs_ptr = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
+    EncodeContext *     encode_context_ptr = scs_ptr->encode_context_ptr;
+    PacketizationReorderEntry *queue_entry_ptr =
+        encode_context_ptr->packetization_reorder_queue[pcs_ptr->parent_pcs_ptr->decode_order %
+                                                        PACKETIZATION_REORDER_QUEUE_MAX_DEPTH];
+
+    if (!queue_entry_ptr->pcs_wrapper_ptr) {
+        queue_entry_ptr->pcs_wrapper_ptr      = entropy_coding_results_ptr->pcs_wrapper_ptr;
+        queue_entry_ptr->start_time_seconds   = pcs_ptr->parent_pcs_ptr->start_time_seconds;
+        queue_entry_ptr->start_time_u_seconds = pcs_ptr->parent_pcs_ptr->start_time_u_seconds;
+        queue_entry_ptr->is_alt_ref           = pcs_ptr->parent_pcs_ptr->is_alt_ref;
+    }
+    if (!entropy_coding_results_ptr->partial_picture)
+        queue_entry_ptr->picture_done = EB_TRUE;
+
+    while (output_head_picture_tiles(context_ptr, encode_context_ptr))
+        ;
+}
+
 void *packetization_kernel(void *input_ptr) {
     // Context
     EbThreadContext *     thread_context_ptr = (EbThreadContext *)input_ptr;
@@ -613,10 +999,6 @@ void *packetization_kernel(void *input_ptr) {
     // Input
     EbObjectWrapper *     entropy_coding_results_wrapper_ptr;
 
-    // Output
-    EbObjectWrapper *    rate_control_tasks_wrapper_ptr;
-    EbObjectWrapper *    picture_manager_results_wrapper_ptr;
-
     context_ptr->tot_shown_frames            = 0;
     context_ptr->disp_order_continuity_count = 0;
 
@@ -632,8 +1014,13 @@ void *packetization_kernel(void *input_ptr) {
         SequenceControlSet *scs_ptr = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
         EncodeContext *     encode_context_ptr = scs_ptr->encode_context_ptr;
         FrameHeader *    frm_hdr    = &pcs_ptr->parent_pcs_ptr->frm_hdr;
-        Av1Common *const cm = pcs_ptr->parent_pcs_ptr->av1_cm;
-        uint16_t            tile_cnt = cm->tiles_info.tile_rows * cm->tiles_info.tile_cols;
+
+        if (scs_ptr->static_config.low_latency_mode) {
+            packetize_low_latency(context_ptr, entropy_coding_results_ptr);
+            // Release the Entropy Coding Result
+            svt_release_object(entropy_coding_results_wrapper_ptr);
+            continue;
+        }
         //****************************************************
         // Input Entropy Results into Reordering Queue
         //****************************************************
@@ -652,76 +1039,9 @@ void *packetization_kernel(void *input_ptr) {
         EbBufferHeaderType *output_stream_ptr = (EbBufferHeaderType *)
                                                     output_stream_wrapper_ptr->object_ptr;
 
-        output_stream_ptr->flags = 0;
-        output_stream_ptr->flags |=
-            (encode_context_ptr->terminating_sequence_flag_received == EB_TRUE &&
-             pcs_ptr->parent_pcs_ptr->decode_order ==
-                 encode_context_ptr->terminating_picture_number)
-                ? EB_BUFFERFLAG_EOS
-                : 0;
-        output_stream_ptr->n_filled_len = 0;
-        output_stream_ptr->pts          = pcs_ptr->parent_pcs_ptr->input_ptr->pts;
-        //we output one temporal unit a time, so dts alwasy equals to pts.
-        output_stream_ptr->dts          = output_stream_ptr->pts;
-        output_stream_ptr->pic_type =
-            pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag
-                ? pcs_ptr->parent_pcs_ptr->idr_flag ? EB_AV1_KEY_PICTURE : pcs_ptr->slice_type
-                : EB_AV1_NON_REF_PICTURE;
-        output_stream_ptr->p_app_private = pcs_ptr->parent_pcs_ptr->input_ptr->p_app_private;
-        output_stream_ptr->qp            = pcs_ptr->parent_pcs_ptr->picture_qp;
-
-        if (scs_ptr->static_config.stat_report) {
-            output_stream_ptr->luma_sse = pcs_ptr->parent_pcs_ptr->luma_sse;
-            output_stream_ptr->cr_sse   = pcs_ptr->parent_pcs_ptr->cr_sse;
-            output_stream_ptr->cb_sse   = pcs_ptr->parent_pcs_ptr->cb_sse;
-            output_stream_ptr->luma_ssim = pcs_ptr->parent_pcs_ptr->luma_ssim;
-            output_stream_ptr->cr_ssim   = pcs_ptr->parent_pcs_ptr->cr_ssim;
-            output_stream_ptr->cb_ssim   = pcs_ptr->parent_pcs_ptr->cb_ssim;
-        } else {
-            output_stream_ptr->luma_sse = 0;
-            output_stream_ptr->cr_sse   = 0;
-            output_stream_ptr->cb_sse   = 0;
-            output_stream_ptr->luma_ssim = 0;
-            output_stream_ptr->cr_ssim   = 0;
-            output_stream_ptr->cb_ssim   = 0;
-        }
+        init_output_stream(pcs_ptr, output_stream_ptr);
+        set_output_metrics(pcs_ptr, output_stream_ptr);
 
-        // Get Empty Rate Control Input Tasks
-        svt_get_empty_object(context_ptr->rate_control_tasks_output_fifo_ptr,
-                             &rate_control_tasks_wrapper_ptr);
-        RateControlTasks *rate_control_tasks_ptr = (RateControlTasks *)
-                                                       rate_control_tasks_wrapper_ptr->object_ptr;
-        rate_control_tasks_ptr->pcs_wrapper_ptr = pcs_ptr->picture_parent_control_set_wrapper_ptr;
-        rate_control_tasks_ptr->task_type       = RC_PACKETIZATION_FEEDBACK_RESULT;
-
-        if(use_input_stat(scs_ptr) ||
-            scs_ptr->lap_enabled ||
-            (scs_ptr->enable_dec_order) ||
-            (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE &&
-            pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr)) {
-            if (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE &&
-                pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr &&
-                pcs_ptr->parent_pcs_ptr->frame_end_cdf_update_mode) {
-                for (uint16_t tile_idx = 0; tile_idx < tile_cnt; tile_idx++) {
-                    svt_av1_reset_cdf_symbol_counters(
-                        pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->fc);
-                    ((EbReferenceObject *)
-                         pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr->object_ptr)
-                        ->frame_context =
-                        (*pcs_ptr->entropy_coding_info[tile_idx]->entropy_coder_ptr->fc);
-                }
-            }
-            // Get Empty Results Object
-            svt_get_empty_object(context_ptr->picture_manager_input_fifo_ptr,
-                                 &picture_manager_results_wrapper_ptr);
-
-            PictureDemuxResults *picture_manager_results_ptr =
-                (PictureDemuxResults *)picture_manager_results_wrapper_ptr->object_ptr;
-            picture_manager_results_ptr->picture_number  = pcs_ptr->picture_number;
-            picture_manager_results_ptr->picture_type    = EB_PIC_FEEDBACK;
-            picture_manager_results_ptr->decode_order = pcs_ptr->parent_pcs_ptr->decode_order;
-            picture_manager_results_ptr->scs_wrapper_ptr = pcs_ptr->scs_wrapper_ptr;
-        }
         // Reset the Bitstream before writing to it
         bitstream_reset(pcs_ptr->bitstream_ptr);
 
@@ -745,72 +1065,16 @@ void *packetization_kernel(void *input_ptr) {
             write_frame_header_av1(queue_entry_ptr->bitstream_ptr, scs_ptr, pcs_ptr, 1);
         }
 
-        // Send the number of bytes per frame to RC
-        pcs_ptr->parent_pcs_ptr->total_num_bits = output_stream_ptr->n_filled_len << 3;
-        queue_entry_ptr->total_num_bits         = pcs_ptr->parent_pcs_ptr->total_num_bits;
-        if (scs_ptr->static_config.rate_control_mode && !use_input_stat(scs_ptr) && !scs_ptr->lap_enabled)
-            // update the rate tables used in RC based on the encoded bits of each sb
-            update_rc_rate_tables(pcs_ptr, scs_ptr);
-        queue_entry_ptr->frame_type = frm_hdr->frame_type;
-        queue_entry_ptr->poc        = pcs_ptr->picture_number;
-        svt_memcpy(&queue_entry_ptr->av1_ref_signal,
-               &pcs_ptr->parent_pcs_ptr->av1_ref_signal,
-               sizeof(Av1RpsNode));
-
-        queue_entry_ptr->slice_type = pcs_ptr->slice_type;
-#if DETAILED_FRAME_OUTPUT
-        queue_entry_ptr->ref_poc_list0 = pcs_ptr->parent_pcs_ptr->ref_pic_poc_array[REF_LIST_0][0];
-        queue_entry_ptr->ref_poc_list1 = pcs_ptr->parent_pcs_ptr->ref_pic_poc_array[REF_LIST_1][0];
-        svt_memcpy(queue_entry_ptr->ref_poc_array,
-               pcs_ptr->parent_pcs_ptr->av1_ref_signal.ref_poc_array,
-               7 * sizeof(uint64_t));
-#endif
-        queue_entry_ptr->show_frame          = frm_hdr->show_frame;
-        queue_entry_ptr->has_show_existing   = pcs_ptr->parent_pcs_ptr->has_show_existing;
-        queue_entry_ptr->show_existing_frame = frm_hdr->show_existing_frame;
+        send_picture_feedback(
+            context_ptr, pcs_ptr, queue_entry_ptr, output_stream_ptr->n_filled_len);
+        if (scs_ptr->static_config.frame_stats)
+            set_frame_stats(pcs_ptr, output_stream_ptr);
 
         //Store the output buffer in the Queue
         queue_entry_ptr->output_stream_wrapper_ptr = output_stream_wrapper_ptr;
 
-        // Note: last chance here to add more output meta data for an encoded picture -->
-
-        // collect output meta data
-        queue_entry_ptr->out_meta_data = concat_eb_linked_list(
-            extract_passthrough_data(&(pcs_ptr->parent_pcs_ptr->data_ll_head_ptr)),
-            pcs_ptr->parent_pcs_ptr->app_out_data_ll_head_ptr);
-        pcs_ptr->parent_pcs_ptr->app_out_data_ll_head_ptr = (EbLinkedListNode *)NULL;
-
-        // Calling callback functions to release the memory allocated for data linked list in the application
-        while (pcs_ptr->parent_pcs_ptr->data_ll_head_ptr != NULL) {
-            EbLinkedListNode *app_data_ll_head_temp_ptr =
-                pcs_ptr->parent_pcs_ptr->data_ll_head_ptr->next;
-            if (pcs_ptr->parent_pcs_ptr->data_ll_head_ptr->release_cb_fnc_ptr != NULL)
-                pcs_ptr->parent_pcs_ptr->data_ll_head_ptr->release_cb_fnc_ptr(
-                    pcs_ptr->parent_pcs_ptr->data_ll_head_ptr);
-            pcs_ptr->parent_pcs_ptr->data_ll_head_ptr = app_data_ll_head_temp_ptr;
-        }
-
-        if (scs_ptr->static_config.speed_control_flag) {
-            // update speed control variables
-            svt_block_on_mutex(encode_context_ptr->sc_buffer_mutex);
-            encode_context_ptr->sc_frame_out++;
-            svt_release_mutex(encode_context_ptr->sc_buffer_mutex);
-        }
-
-        // Post Rate Control Taks
-        svt_post_full_object(rate_control_tasks_wrapper_ptr);
-        if (use_input_stat(scs_ptr) ||
-            scs_ptr->lap_enabled ||
-            (scs_ptr->enable_dec_order) ||
-            (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE &&
-            pcs_ptr->parent_pcs_ptr->reference_picture_wrapper_ptr))
-            // Post the Full Results Object
-            svt_post_full_object(picture_manager_results_wrapper_ptr);
-        else
-            // Since feedback is not set to PM, life count of is reduced here instead of PM
-            svt_release_object(pcs_ptr->scs_wrapper_ptr);
-        //Release the Parent PCS then the Child PCS
-        svt_release_object(entropy_coding_results_ptr->pcs_wrapper_ptr); //Child
+        //Release the Child PCS
+        svt_release_object(entropy_coding_results_ptr->pcs_wrapper_ptr);
 
         // Release the Entropy Coding Result
         svt_release_object(entropy_coding_results_wrapper_ptr);
@@ -830,6 +1094,8 @@ void *packetization_kernel(void *input_ptr) {
             EbBool eos                = output_stream_ptr->flags &  EB_BUFFERFLAG_EOS;
 
             encode_tu(encode_context_ptr, frames, total_bytes, output_stream_ptr);
+            if (scs_ptr->static_config.frame_stats)
+                collect_frame_stats(encode_context_ptr, frames, output_stream_ptr);
 
             if (eos && queue_entry_ptr->has_show_existing)
                 clear_eos_flag(output_stream_ptr);
@@ -25,6 +25,8 @@ EbErrorType packetization_context_ctor(EbThreadContext *  thread_context_ptr,
                                        int demux_index);
 
 extern void *packetization_kernel(void *input_ptr);
+
+extern void svt_aom_free_frame_stats(EbBufferHeaderType *output_stream_ptr);
 #ifdef __cplusplus
 }
 #endif
@@ -49,6 +49,11 @@ typedef struct PacketizationReorderEntry {
     //valid when has_show_existing is true
     int64_t next_pts;
     uint8_t is_alt_ref;
+    // low latency mode: picture whose tiles are being output
+    EbObjectWrapper *pcs_wrapper_ptr;
+    EbBool           picture_done;
+    uint16_t         tiles_emitted;
+    uint32_t         bytes_emitted;
 } PacketizationReorderEntry;
 
 extern EbErrorType packetization_reorder_entry_ctor(PacketizationReorderEntry *entry_ptr,
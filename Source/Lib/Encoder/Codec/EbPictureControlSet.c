@@ -17,6 +17,8 @@
 #include "EbSequenceControlSet.h"
 #include "EbPictureBufferDesc.h"
 #include "EbUtility.h"
+#include "EbMetricsProcess.h"
+#include "EbTime.h"
 
 void set_tile_info(PictureParentControlSet *pcs_ptr);
 
@@ -1153,6 +1155,11 @@ static void picture_parent_control_set_dctor(EbPtr ptr) {
     EB_FREE_ARRAY(obj->tile_group_info);
     EB_DESTROY_SEMAPHORE(obj->tpl_me_done_semaphore);
     EB_DESTROY_MUTEX(obj->tpl_me_mutex);
+    EB_DESTROY_SEMAPHORE(obj->tpl_disp_done_semaphore);
+    EB_DESTROY_MUTEX(obj->tpl_disp_mutex);
+    EB_FREE_ARRAY(obj->tpl_disp_sb_row_progress);
+    EB_DESTROY_SEMAPHORE(obj->metrics_done_semaphore);
+    EB_FREE_ARRAY(obj->metrics_bands);
     //  EB_DESTROY_SEMAPHORE(obj->pame_done_semaphore);
     EB_DESTROY_MUTEX(obj->pame_done.mutex);
     EB_DESTROY_SEMAPHORE(obj->first_pass_done_semaphore);
@@ -1297,6 +1304,16 @@ EbErrorType picture_parent_control_set_ctor(PictureParentControlSet *object_ptr,
     EB_CREATE_SEMAPHORE(object_ptr->tpl_me_done_semaphore, 0, 1);
     EB_CREATE_MUTEX(object_ptr->tpl_me_mutex);
 
+    EB_CREATE_SEMAPHORE(object_ptr->tpl_disp_done_semaphore, 0, 1);
+    EB_CREATE_MUTEX(object_ptr->tpl_disp_mutex);
+    EB_CALLOC_ARRAY(object_ptr->tpl_disp_sb_row_progress, picture_sb_height);
+    svt_create_cond_var(&object_ptr->tpl_disp_sb_row_cond);
+
+    object_ptr->metrics_band_count = (init_data_ptr->picture_height + METRICS_BAND_HEIGHT - 1) /
+        METRICS_BAND_HEIGHT;
+    EB_CALLOC_ARRAY(object_ptr->metrics_bands, object_ptr->metrics_band_count);
+    EB_CREATE_SEMAPHORE(object_ptr->metrics_done_semaphore, 0, 1);
+
     EB_CREATE_MUTEX(object_ptr->pame_done.mutex);
     EB_CREATE_SEMAPHORE(object_ptr->first_pass_done_semaphore, 0, 1);
     EB_CREATE_MUTEX(object_ptr->first_pass_mutex);
@@ -1588,3 +1605,15 @@ EbErrorType me_creator(EbPtr *object_dbl_ptr, EbPtr object_init_data_ptr) {
 
     return EB_ErrorNone;
 }
+
+/* Records the time at which the picture enters a stage of the pipeline */
+void svt_aom_mark_frame_stats_stage(PictureParentControlSet *ppcs_ptr, EbFrameStatsStage stage) {
+    if (!ppcs_ptr->scs_ptr->static_config.frame_stats)
+        return;
+    uint64_t seconds, u_seconds;
+    svt_av1_get_time(&seconds, &u_seconds);
+    ppcs_ptr->frame_stats_stage_us[stage] = (uint32_t)(
+        svt_av1_compute_overall_elapsed_time_ms(
+            ppcs_ptr->start_time_seconds, ppcs_ptr->start_time_u_seconds, seconds, u_seconds) *
+        1000);
+}
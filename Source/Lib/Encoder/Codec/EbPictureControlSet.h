@@ -511,6 +511,11 @@ typedef struct GmControls {
     uint8_t rotzoom_model_only; // 0: use both rotzoom and affine models, 1:use rotzoom model only
     uint8_t bipred_only; // 0: test both unipred and bipred, 1: test bipred only
 } GmControls;
+// SSE and sum of the SSIM of the 8x8 windows of the Y, Cb and Cr planes in a band of a picture
+typedef struct MetricsBand {
+    uint64_t sse[3];
+    double   ssim[3];
+} MetricsBand;
 //CHKN
 // Add the concept of PictureParentControlSet which is a subset of the old PictureControlSet.
 // It actually holds only high level Picture based control data:(GOP management,when to start a picture, when to release the PCS, ....).
@@ -601,12 +606,19 @@ typedef struct PictureParentControlSet {
     uint64_t last_idr_picture;
     uint64_t start_time_seconds;
     uint64_t start_time_u_seconds;
+    // microseconds from start_time to the start of each stage, when frame_stats is enabled
+    uint32_t frame_stats_stage_us[EB_FRAME_STATS_STAGE_COUNT];
     uint32_t luma_sse;
     uint32_t cr_sse;
     uint32_t cb_sse;
     double   luma_ssim;
     double   cr_ssim;
     double   cb_ssim;
+    // PSNR and SSIM of the bands of 64 luma rows, measured in the metrics processes
+    MetricsBand *     metrics_bands;
+    uint32_t          metrics_band_count;
+    volatile uint32_t metrics_bands_done;
+    EbHandle          metrics_done_semaphore;
 
     EbObjectWrapper *           down_scaled_picture_wrapper_ptr;
     EbDownScaledBufDescPtrArray ds_pics; // Pointer array for down scaled pictures
@@ -835,6 +847,15 @@ typedef struct PictureParentControlSet {
     uint8_t      tpl_me_segments_column_count;
     uint8_t      tpl_me_segments_row_count;
     uint8_t      tpl_me_done;
+    // TPL dispenser (SB rows processed in the ME processes)
+    EbHandle  tpl_disp_done_semaphore;
+    EbHandle  tpl_disp_mutex;
+    uint16_t  tpl_disp_seg_acc;
+    uint16_t  tpl_disp_segments_total_count;
+    int32_t   tpl_disp_frame_idx;
+    uint16_t  tpl_disp_next_row; // next SB row to start
+    uint32_t *tpl_disp_sb_row_progress; // number of SBs done per SB row
+    CondVar   tpl_disp_sb_row_cond;
     AtomicVarU32 pame_done; //set when PA ME is done.
 #if FIX_DDL
     CondVar me_ready;
@@ -972,6 +993,8 @@ extern EbErrorType picture_control_set_creator(EbPtr *object_dbl_ptr, EbPtr obje
 extern EbErrorType picture_parent_control_set_creator(EbPtr *object_dbl_ptr,
                                                       EbPtr  object_init_data_ptr);
 extern EbErrorType me_creator(EbPtr *object_dbl_ptr, EbPtr object_init_data_ptr);
+extern void        svt_aom_mark_frame_stats_stage(PictureParentControlSet *ppcs_ptr,
+                                                  EbFrameStatsStage        stage);
 extern EbErrorType me_sb_results_ctor(MeSbResults *obj_ptr);
 #ifdef __cplusplus
 }
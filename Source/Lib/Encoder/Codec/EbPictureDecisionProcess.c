@@ -3987,6 +3987,7 @@ void send_picture_out(
     EbObjectWrapper               *me_wrapper;
     EbObjectWrapper               *out_results_wrapper;
 
+    svt_aom_mark_frame_stats_stage(pcs, EB_FRAME_STATS_MOTION_ESTIMATION);
 
     if (scs->static_config.look_ahead_distance == 0) {
         if (pcs->is_used_as_reference_flag) {
@@ -4718,10 +4719,16 @@ void* picture_decision_kernel(void *input_ptr)
                 context_ptr->last_solid_color_frame_poc = 0xFFFFFFFF;
             if (window_avail == EB_TRUE && queue_entry_ptr->picture_number > 0) {
                 if (scs_ptr->static_config.scene_change_detection) {
-                    pcs_ptr->scene_change_flag = scene_transition_detector(
-                        context_ptr,
-                        scs_ptr,
-                        (PictureParentControlSet **)pcs_ptr->pd_window);
+                    // A rendition takes the decision of the ladder source when there is one
+                    const int8_t ladder_scene_change = encode_context_ptr->ladder_role == LADDER_RENDITION
+                        ? svt_ladder_get_scene_change(encode_context_ptr->ladder, encode_context_ptr->ladder_slot, pcs_ptr->picture_number)
+                        : -1;
+                    pcs_ptr->scene_change_flag = ladder_scene_change >= 0
+                        ? (EbBool)ladder_scene_change
+                        : scene_transition_detector(
+                            context_ptr,
+                            scs_ptr,
+                            (PictureParentControlSet **)pcs_ptr->pd_window);
                 }
                 else
                     pcs_ptr->scene_change_flag = EB_FALSE;
@@ -4735,6 +4742,14 @@ void* picture_decision_kernel(void *input_ptr)
 
             if (window_avail == EB_TRUE || frame_passthrough == EB_TRUE)
             {
+                if (encode_context_ptr->ladder_role == LADDER_SOURCE)
+                    svt_ladder_publish_scene_change(
+                        encode_context_ptr->ladder,
+                        pcs_ptr->picture_number,
+                        window_avail == EB_TRUE && queue_entry_ptr->picture_number > 0 && scs_ptr->static_config.scene_change_detection
+                            ? (int8_t)pcs_ptr->scene_change_flag
+                            : -1,
+                        pcs_ptr->end_of_sequence_flag);
                 // Place the PCS into the Pre-Assignment Buffer
                 // P.S. The Pre-Assignment Buffer is used to store a whole pre-structure
                 encode_context_ptr->pre_assignment_buffer[encode_context_ptr->pre_assignment_buffer_count] = queue_entry_ptr->parent_pcs_wrapper_ptr;
@@ -23,7 +23,7 @@ typedef struct PictureDecisionResults {
     EbDctor          dctor;
     EbObjectWrapper *pcs_wrapper_ptr;
     uint32_t         segment_index;
-    uint8_t          task_type; //0:ME   1:Temporal Filtering
+    uint8_t          task_type; //0:ME   1:Temporal Filtering   2:First Pass   3:TPL Dispenser
 } PictureDecisionResults;
 
 typedef struct PictureDecisionResultInitData {
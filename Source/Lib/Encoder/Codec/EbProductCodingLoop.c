@@ -8102,88 +8102,7 @@ EB_EXTERN EbErrorType mode_decision_sb(SequenceControlSet *scs_ptr, PictureContr
     uint32_t             d1_first_block    = 1;
     EbPictureBufferDesc *input_picture_ptr = pcs_ptr->parent_pcs_ptr->enhanced_picture_ptr;
     if (context_ptr->hbd_mode_decision) {
-        const uint32_t input_luma_offset = ((sb_origin_y + input_picture_ptr->origin_y) *
-                                            input_picture_ptr->stride_y) +
-            (sb_origin_x + input_picture_ptr->origin_x);
-        const uint32_t input_bit_inc_luma_offset = ((sb_origin_y + input_picture_ptr->origin_y) *
-                                                    input_picture_ptr->stride_bit_inc_y) +
-            (sb_origin_x + input_picture_ptr->origin_x);
-        const uint32_t input_cb_offset = (((sb_origin_y + input_picture_ptr->origin_y) >> 1) *
-                                          input_picture_ptr->stride_cb) +
-            ((sb_origin_x + input_picture_ptr->origin_x) >> 1);
-        const uint32_t input_bit_inc_cb_offset = (((sb_origin_y + input_picture_ptr->origin_y) >>
-                                                   1) *
-                                                  input_picture_ptr->stride_bit_inc_cb) +
-            ((sb_origin_x + input_picture_ptr->origin_x) >> 1);
-        const uint32_t input_cr_offset = (((sb_origin_y + input_picture_ptr->origin_y) >> 1) *
-                                          input_picture_ptr->stride_cr) +
-            ((sb_origin_x + input_picture_ptr->origin_x) >> 1);
-        const uint32_t input_bit_inc_cr_offset = (((sb_origin_y + input_picture_ptr->origin_y) >>
-                                                   1) *
-                                                  input_picture_ptr->stride_bit_inc_cr) +
-            ((sb_origin_x + input_picture_ptr->origin_x) >> 1);
-
-        uint32_t sb_width  = MIN(scs_ptr->sb_size_pix,
-                                pcs_ptr->parent_pcs_ptr->aligned_width - sb_origin_x);
-        uint32_t sb_height = MIN(scs_ptr->sb_size_pix,
-                                 pcs_ptr->parent_pcs_ptr->aligned_height - sb_origin_y);
-
-        pack2d_src(input_picture_ptr->buffer_y + input_luma_offset,
-                   input_picture_ptr->stride_y,
-                   input_picture_ptr->buffer_bit_inc_y + input_bit_inc_luma_offset,
-                   input_picture_ptr->stride_bit_inc_y,
-                   (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_y,
-                   context_ptr->input_sample16bit_buffer->stride_y,
-                   sb_width,
-                   sb_height);
-
-        pack2d_src(input_picture_ptr->buffer_cb + input_cb_offset,
-                   input_picture_ptr->stride_cb,
-                   input_picture_ptr->buffer_bit_inc_cb + input_bit_inc_cb_offset,
-                   input_picture_ptr->stride_bit_inc_cb,
-                   (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_cb,
-                   context_ptr->input_sample16bit_buffer->stride_cb,
-                   sb_width >> 1,
-                   sb_height >> 1);
-
-        pack2d_src(input_picture_ptr->buffer_cr + input_cr_offset,
-                   input_picture_ptr->stride_cr,
-                   input_picture_ptr->buffer_bit_inc_cr + input_bit_inc_cr_offset,
-                   input_picture_ptr->stride_bit_inc_cr,
-                   (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_cr,
-                   context_ptr->input_sample16bit_buffer->stride_cr,
-                   sb_width >> 1,
-                   sb_height >> 1);
-        // PAD the packed source in incomplete sb up to max SB size
-        pad_input_picture_16bit(
-                (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_y,
-                context_ptr->input_sample16bit_buffer->stride_y,
-                sb_width,
-                sb_height,
-                scs_ptr->sb_size_pix - sb_width,
-                scs_ptr->sb_size_pix - sb_height);
-
-        pad_input_picture_16bit(
-                (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_cb,
-                context_ptr->input_sample16bit_buffer->stride_cb,
-                sb_width >> 1,
-                sb_height >> 1,
-                (scs_ptr->sb_size_pix- sb_width  )>>1,
-                (scs_ptr->sb_size_pix - sb_height)>>1);
-
-        pad_input_picture_16bit(
-                (uint16_t *)context_ptr->input_sample16bit_buffer->buffer_cr,
-                context_ptr->input_sample16bit_buffer->stride_cr,
-                sb_width >> 1,
-                sb_height >> 1,
-                (scs_ptr->sb_size_pix - sb_width  )>>1,
-                (scs_ptr->sb_size_pix  - sb_height)>>1);
-        store16bit_input_src(context_ptr->input_sample16bit_buffer,
-                             pcs_ptr,
-                             sb_origin_x,
-                             sb_origin_y,
-                             scs_ptr->sb_size_pix,
-                             scs_ptr->sb_size_pix);
+        // The 16 bit source of the SB is packed by pack16bit_input_src()
         //input_picture_ptr = context_ptr->input_sample16bit_buffer;
         if(!use_output_stat(scs_ptr))
             input_picture_ptr = pcs_ptr->input_frame16bit;
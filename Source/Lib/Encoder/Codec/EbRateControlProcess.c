@@ -22,6 +22,7 @@
 
 #include "EbRateControlResults.h"
 #include "EbRateControlTasks.h"
+#include "EbPictureDecisionResults.h"
 
 #include "EbSegmentation.h"
 #include "EbLog.h"
@@ -338,36 +339,11 @@ void get_best_reference(PictureParentControlSet *pcs_ptr, uint32_t sb_index, uin
     return;
 }
 /************************************************
-* Genrate TPL MC Flow Dispenser  Based on Lookahead
-** LAD Window: sliding window size
+* Get the TPL quantizer of a picture and set its base rdmult
 ************************************************/
-void tpl_mc_flow_dispenser(EncodeContext *encode_context_ptr, SequenceControlSet *scs_ptr,
-                           PictureParentControlSet *pcs_ptr, int32_t frame_idx) {
-    uint32_t             picture_width_in_mb = (pcs_ptr->enhanced_picture_ptr->width + 16 - 1) / 16;
-    int16_t              x_curr_mv           = 0;
-    int16_t              y_curr_mv           = 0;
-    uint32_t             me_mb_offset        = 0;
-    TxSize               tx_size             = TX_16X16;
-    EbPictureBufferDesc *ref_pic_ptr;
-    BlockGeom            blk_geom;
-    EbPictureBufferDesc *input_picture_ptr = pcs_ptr->enhanced_picture_ptr;
-    EbPictureBufferDesc *recon_picture_ptr =
-        encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx];
-    TplStats tpl_stats;
-
-    DECLARE_ALIGNED(32, uint8_t, predictor8[256 * 2]);
-    DECLARE_ALIGNED(32, int16_t, src_diff[256]);
-    DECLARE_ALIGNED(32, TranLow, coeff[256]);
-    DECLARE_ALIGNED(32, TranLow, qcoeff[256]);
-    DECLARE_ALIGNED(32, TranLow, dqcoeff[256]);
-    DECLARE_ALIGNED(32, TranLow, best_coeff[256]);
-    uint8_t *predictor = predictor8;
-
-    blk_geom.bwidth  = 16;
-    blk_geom.bheight = 16;
-
-    MacroblockPlane mb_plane;
-    int32_t         qIndex = quantizer_to_qindex[(uint8_t)scs_ptr->static_config.qp];
+static void tpl_setup_mb_plane(SequenceControlSet *scs_ptr, PictureParentControlSet *pcs_ptr,
+                               MacroblockPlane *mb_plane) {
+    int32_t qIndex = quantizer_to_qindex[(uint8_t)scs_ptr->static_config.qp];
     if (pcs_ptr->tpl_data.tpl_ctrls.enable_tpl_qps) {
         const double delta_rate_new[7][6] = {
             {1.0, 1.0, 1.0, 1.0, 1.0, 1.0}, // 1L
@@ -391,351 +367,189 @@ void tpl_mc_flow_dispenser(EncodeContext *encode_context_ptr, SequenceControlSet
                 8);
         qIndex = (qIndex + delta_qindex);
     }
-    mb_plane.quant_qtx       = scs_ptr->quants_8bit.y_quant[qIndex];
-    mb_plane.quant_fp_qtx    = scs_ptr->quants_8bit.y_quant_fp[qIndex];
-    mb_plane.round_fp_qtx    = scs_ptr->quants_8bit.y_round_fp[qIndex];
-    mb_plane.quant_shift_qtx = scs_ptr->quants_8bit.y_quant_shift[qIndex];
-    mb_plane.zbin_qtx        = scs_ptr->quants_8bit.y_zbin[qIndex];
-    mb_plane.round_qtx       = scs_ptr->quants_8bit.y_round[qIndex];
-    mb_plane.dequant_qtx     = scs_ptr->deq_8bit.y_dequant_qtx[qIndex];
-    pcs_ptr->base_rdmult     = svt_av1_compute_rd_mult_based_on_qindex(
+    mb_plane->quant_qtx       = scs_ptr->quants_8bit.y_quant[qIndex];
+    mb_plane->quant_fp_qtx    = scs_ptr->quants_8bit.y_quant_fp[qIndex];
+    mb_plane->round_fp_qtx    = scs_ptr->quants_8bit.y_round_fp[qIndex];
+    mb_plane->quant_shift_qtx = scs_ptr->quants_8bit.y_quant_shift[qIndex];
+    mb_plane->zbin_qtx        = scs_ptr->quants_8bit.y_zbin[qIndex];
+    mb_plane->round_qtx       = scs_ptr->quants_8bit.y_round[qIndex];
+    mb_plane->dequant_qtx     = scs_ptr->deq_8bit.y_dequant_qtx[qIndex];
+    pcs_ptr->base_rdmult      = svt_av1_compute_rd_mult_based_on_qindex(
                                (AomBitDepth)8 /*scs_ptr->static_config.encoder_bit_depth*/,
                                qIndex) /
         6;
+}
+
+/************************************************
+* Genrate TPL MC Flow Dispenser for one SB
+************************************************/
+static void tpl_mc_flow_dispenser_sb(EncodeContext *encode_context_ptr, SequenceControlSet *scs_ptr,
+                                     PictureParentControlSet *pcs_ptr, int32_t frame_idx,
+                                     uint32_t sb_index, MacroblockPlane *mb_plane) {
+    uint32_t             picture_width_in_mb = (pcs_ptr->enhanced_picture_ptr->width + 16 - 1) / 16;
+    int16_t              x_curr_mv           = 0;
+    int16_t              y_curr_mv           = 0;
+    uint32_t             me_mb_offset        = 0;
+    TxSize               tx_size             = TX_16X16;
+    EbPictureBufferDesc *ref_pic_ptr;
+    BlockGeom            blk_geom;
+    EbPictureBufferDesc *input_picture_ptr = pcs_ptr->enhanced_picture_ptr;
+    EbPictureBufferDesc *recon_picture_ptr =
+        encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx];
+    TplStats tpl_stats;
+
+    DECLARE_ALIGNED(32, uint8_t, predictor8[256 * 2]);
+    DECLARE_ALIGNED(32, int16_t, src_diff[256]);
+    DECLARE_ALIGNED(32, TranLow, coeff[256]);
+    DECLARE_ALIGNED(32, TranLow, qcoeff[256]);
+    DECLARE_ALIGNED(32, TranLow, dqcoeff[256]);
+    DECLARE_ALIGNED(32, TranLow, best_coeff[256]);
+    uint8_t *predictor = predictor8;
+
+    blk_geom.bwidth  = 16;
+    blk_geom.bheight = 16;
 
     EbPictureBufferDesc *input_ptr = pcs_ptr->enhanced_picture_ptr;
 
-    // Walk the first N entries in the sliding window
-    for (uint32_t sb_index = 0; sb_index < pcs_ptr->sb_total_count; ++sb_index) {
+    SbParams *sb_params    = &scs_ptr->sb_params_array[sb_index];
+    uint32_t  pa_blk_index = 0;
+    while (pa_blk_index < CU_MAX_COUNT) {
+        const CodedBlockStats *blk_stats_ptr;
+        blk_stats_ptr              = get_coded_blk_stats(pa_blk_index);
+        uint8_t bsize              = blk_stats_ptr->size;
+        EbBool  small_boundary_blk = EB_FALSE;
+
+        //if(sb_params->raster_scan_blk_validity[md_scan_to_raster_scan[pa_blk_index]])
         {
-            SbParams *sb_params    = &scs_ptr->sb_params_array[sb_index];
-            uint32_t  pa_blk_index = 0;
-            while (pa_blk_index < CU_MAX_COUNT) {
-                const CodedBlockStats *blk_stats_ptr;
-                blk_stats_ptr              = get_coded_blk_stats(pa_blk_index);
-                uint8_t bsize              = blk_stats_ptr->size;
-                EbBool  small_boundary_blk = EB_FALSE;
-
-                //if(sb_params->raster_scan_blk_validity[md_scan_to_raster_scan[pa_blk_index]])
-                {
-                    uint32_t cu_origin_x = sb_params->origin_x + blk_stats_ptr->origin_x;
-                    uint32_t cu_origin_y = sb_params->origin_y + blk_stats_ptr->origin_y;
-                    if ((blk_stats_ptr->origin_x % 16) == 0 &&
-                        (blk_stats_ptr->origin_y % 16) == 0 &&
-                        ((pcs_ptr->enhanced_picture_ptr->width - cu_origin_x) < 16 ||
-                         (pcs_ptr->enhanced_picture_ptr->height - cu_origin_y) < 16))
-                        small_boundary_blk = EB_TRUE;
-                }
-                if (bsize != 16 && !small_boundary_blk) {
-                    pa_blk_index++;
-                    continue;
-                }
-                if (sb_params->raster_scan_blk_validity[md_scan_to_raster_scan[pa_blk_index]]) {
-                    uint32_t  mb_origin_x       = sb_params->origin_x + blk_stats_ptr->origin_x;
-                    uint32_t  mb_origin_y       = sb_params->origin_y + blk_stats_ptr->origin_y;
-                    const int dst_buffer_stride = recon_picture_ptr->stride_y;
-                    const int dst_mb_offset     = mb_origin_y * dst_buffer_stride + mb_origin_x;
-                    const int dst_basic_offset  = recon_picture_ptr->origin_y *
-                            recon_picture_ptr->stride_y +
-                        recon_picture_ptr->origin_x;
-                    uint8_t *dst_buffer = recon_picture_ptr->buffer_y + dst_basic_offset +
-                        dst_mb_offset;
-
-                    int64_t  inter_cost;
-                    int64_t  recon_error = 1, sse = 1;
-                    uint64_t best_ref_poc    = 0;
-                    int32_t  best_rf_idx     = -1;
-                    int64_t  best_inter_cost = INT64_MAX;
-                    MV       final_best_mv   = {0, 0};
-                    uint32_t max_inter_ref   = MAX_PA_ME_MV;
-
-                    PredictionMode best_intra_mode = DC_PRED;
-                    int64_t        best_intra_cost = INT64_MAX;
-                    // Disable intra prediction
-                    uint8_t disable_intra_pred =
-                        pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nref ||
-                        pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nbase;
-                    if (!disable_intra_pred ||
-                        (pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nref &&
-                         pcs_ptr->tpl_data.is_used_as_reference_flag) ||
-                        (pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nbase &&
-                         pcs_ptr->tpl_data.tpl_temporal_layer_index == 0)) {
-                        if (scs_ptr->in_loop_ois == 0) {
-                            OisMbResults *ois_mb_results_ptr =
-                                pcs_ptr->ois_mb_results[(mb_origin_y >> 4) * picture_width_in_mb +
-                                                        (mb_origin_x >> 4)];
-                            best_intra_mode = ois_mb_results_ptr->intra_mode;
-                            best_intra_cost = ois_mb_results_ptr->intra_cost;
-
-                        } else { // ois
-                            // always process as block16x16 even bsize or tx_size is 8x8
-                            bsize = 16;
-                            DECLARE_ALIGNED(16, uint8_t, left0_data[MAX_TX_SIZE * 2 + 32]);
-                            DECLARE_ALIGNED(16, uint8_t, above0_data[MAX_TX_SIZE * 2 + 32]);
-                            DECLARE_ALIGNED(16, uint8_t, left_data[MAX_TX_SIZE * 2 + 32]);
-                            DECLARE_ALIGNED(16, uint8_t, above_data[MAX_TX_SIZE * 2 + 32]);
-
-                            uint8_t *above_row;
-                            uint8_t *left_col;
-                            uint8_t *above0_row;
-                            uint8_t *left0_col;
-                            above0_row = above0_data + 16;
-                            left0_col  = left0_data + 16;
-                            above_row  = above_data + 16;
-                            left_col   = left_data + 16;
-
-                            uint8_t *src = input_ptr->buffer_y +
-                                pcs_ptr->enhanced_picture_ptr->origin_x + mb_origin_x +
-                                (pcs_ptr->enhanced_picture_ptr->origin_y + mb_origin_y) *
-                                    input_ptr->stride_y;
-
-                            // Fill Neighbor Arrays
-                            update_neighbor_samples_array_open_loop_mb(above0_row - 1,
-                                                                       left0_col - 1,
-                                                                       input_ptr,
-                                                                       input_ptr->stride_y,
-                                                                       mb_origin_x,
-                                                                       mb_origin_y,
-                                                                       bsize,
-                                                                       bsize);
-                            uint8_t ois_intra_mode;
-                            uint8_t intra_mode_start = DC_PRED;
-                            EbBool  enable_paeth  = pcs_ptr->scs_ptr->static_config.enable_paeth ==
-                                    DEFAULT
-                                  ? EB_TRUE
-                                  : (EbBool)pcs_ptr->scs_ptr->static_config.enable_paeth;
-                            EbBool  enable_smooth = pcs_ptr->scs_ptr->static_config.enable_smooth ==
-                                    DEFAULT
-                                 ? EB_TRUE
-                                 : (EbBool)pcs_ptr->scs_ptr->static_config.enable_smooth;
-                            uint8_t intra_mode_end =
-
-                                pcs_ptr->tpl_data.tpl_ctrls.tpl_opt_flag
-
-                                ? DC_PRED
-                                : enable_paeth      ? PAETH_PRED
-                                    : enable_smooth ? SMOOTH_H_PRED
-                                                    : D67_PRED;
-
-                            for (ois_intra_mode = intra_mode_start;
-                                 ois_intra_mode <= intra_mode_end;
-                                 ++ois_intra_mode) {
-                                int32_t p_angle = av1_is_directional_mode(
-                                                      (PredictionMode)ois_intra_mode)
-                                    ? mode_to_angle_map[(PredictionMode)ois_intra_mode]
-                                    : 0;
-                                // Edge filter
-                                if (av1_is_directional_mode((PredictionMode)ois_intra_mode) &&
-                                    1 /*scs_ptr->seq_header.enable_intra_edge_filter*/) {
-                                    EB_MEMCPY(left_data,
-                                              left0_data,
-                                              sizeof(uint8_t) * (MAX_TX_SIZE * 2 + 32));
-                                    EB_MEMCPY(above_data,
-                                              above0_data,
-                                              sizeof(uint8_t) * (MAX_TX_SIZE * 2 + 32));
-                                    above_row = above_data + 16;
-                                    left_col  = left_data + 16;
-                                    filter_intra_edge(NULL,
-                                                      ois_intra_mode,
-                                                      scs_ptr->seq_header.max_frame_width,
-                                                      scs_ptr->seq_header.max_frame_height,
-                                                      p_angle,
-                                                      (int32_t)mb_origin_x,
-                                                      (int32_t)mb_origin_y,
-                                                      above_row,
-                                                      left_col);
-                                } else {
-                                    above_row = above0_row;
-                                    left_col  = left0_col;
-                                }
-                                // PRED
-                                intra_prediction_open_loop_mb(p_angle,
-                                                              ois_intra_mode,
-                                                              mb_origin_x,
-                                                              mb_origin_y,
-                                                              tx_size,
-                                                              above_row,
-                                                              left_col,
-                                                              predictor,
-                                                              16);
-
-                                // Distortion
-                                svt_aom_subtract_block(
-                                    16, 16, src_diff, 16, src, input_ptr->stride_y, predictor, 16);
-                                svt_av1_wht_fwd_txfm(src_diff, 16, coeff, 2 /*TX_16X16*/, 8, 0);
-                                int64_t intra_cost = svt_aom_satd(coeff, 16 * 16);
-
-                                if (intra_cost < best_intra_cost) {
-                                    best_intra_cost = intra_cost;
-                                    best_intra_mode = ois_intra_mode;
-                                }
-                            }
-                        }
-                    }
-                    uint8_t  best_mode = DC_PRED;
-                    uint8_t *src_mb    = input_picture_ptr->buffer_y + input_picture_ptr->origin_x +
-                        mb_origin_x +
-                        (input_picture_ptr->origin_y + mb_origin_y) * input_picture_ptr->stride_y;
-                    memset(&tpl_stats, 0, sizeof(tpl_stats));
-                    blk_geom.origin_x = blk_stats_ptr->origin_x;
-                    blk_geom.origin_y = blk_stats_ptr->origin_y;
-                    me_mb_offset      = get_me_info_index(
-                        pcs_ptr->max_number_of_pus_per_sb, &blk_geom, 0, 0);
-
-                    uint32_t best_reference = 0;
-                    if (pcs_ptr->tpl_data.tpl_ctrls.get_best_ref)
-                        // Reference pruning
-                        get_best_reference(pcs_ptr,
-                                           sb_index,
-                                           me_mb_offset,
-                                           mb_origin_x,
-                                           mb_origin_y,
-                                           &best_reference);
-
-                    for (uint32_t rf_idx = 0; rf_idx < max_inter_ref; rf_idx++) {
-                        if (pcs_ptr->tpl_data.tpl_ctrls.get_best_ref)
-                            if (rf_idx != best_reference)
-                                continue;
-                        uint32_t list_index    = rf_idx < 4 ? 0 : 1;
-                        uint32_t ref_pic_index = rf_idx >= 4 ? (rf_idx - 4) : rf_idx;
-                        if ((list_index == 0 &&
-                             (ref_pic_index + 1) > pcs_ptr->tpl_data.tpl_ref0_count) ||
-                            (list_index == 1 &&
-                             (ref_pic_index + 1) > pcs_ptr->tpl_data.tpl_ref1_count))
-                            continue;
-                        if (!is_me_data_valid(pcs_ptr->pa_me_data->me_results[sb_index],
-                                              me_mb_offset,
-                                              list_index,
-                                              ref_pic_index))
-                            continue;
-                        ref_pic_ptr = (EbPictureBufferDesc *)pcs_ptr->tpl_data
-                                          .tpl_ref_ds_ptr_array[list_index][ref_pic_index]
-                                          .picture_ptr;
-                        const MeSbResults *me_results = pcs_ptr->pa_me_data->me_results[sb_index];
-                        x_curr_mv                     = me_results
-                                        ->me_mv_array[me_mb_offset * MAX_PA_ME_MV +
-                                                      (list_index ? 4 : 0) + ref_pic_index]
-                                        .x_mv
-                            << 1;
-                        y_curr_mv = me_results
-                                        ->me_mv_array[me_mb_offset * MAX_PA_ME_MV +
-                                                      (list_index ? 4 : 0) + ref_pic_index]
-                                        .y_mv
-                            << 1;
-
-                        MV      best_mv          = {y_curr_mv, x_curr_mv};
-                        int32_t ref_origin_index = ref_pic_ptr->origin_x +
-                            (mb_origin_x + (best_mv.col >> 3)) +
-                            (mb_origin_y + (best_mv.row >> 3) + ref_pic_ptr->origin_y) *
-                                ref_pic_ptr->stride_y;
-
-                        svt_aom_subtract_block(16,
-                                               16,
-                                               src_diff,
-                                               16,
-                                               src_mb,
-                                               input_picture_ptr->stride_y,
-                                               ref_pic_ptr->buffer_y + ref_origin_index,
-                                               ref_pic_ptr->stride_y);
-                        svt_av1_wht_fwd_txfm(src_diff, 16, coeff, tx_size, 8, 0);
-
-                        inter_cost = svt_aom_satd(coeff, 256);
-                        if (inter_cost < best_inter_cost) {
-                            EB_MEMCPY(best_coeff, coeff, sizeof(best_coeff));
-                            best_ref_poc = pcs_ptr->tpl_data
-                                               .tpl_ref_ds_ptr_array[list_index][ref_pic_index]
-                                               .picture_number;
-
-                            best_rf_idx     = rf_idx;
-                            best_inter_cost = inter_cost;
-                            final_best_mv   = best_mv;
-
-                            if (best_inter_cost < best_intra_cost)
-                                best_mode = NEWMV;
-                        }
-                    } // rf_idx
-
-                    if (best_mode == NEWMV) {
-                        uint16_t eob = 0;
-                        get_quantize_error(&mb_plane,
-                                           best_coeff,
-                                           qcoeff,
-                                           dqcoeff,
-                                           tx_size,
-                                           &eob,
-                                           &recon_error,
-                                           &sse);
-                        int rate_cost        = pcs_ptr->tpl_data.tpl_ctrls.tpl_opt_flag
-                                   ? 0
-                                   : rate_estimator(qcoeff, eob, tx_size);
-                        tpl_stats.srcrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
-                    }
-                    tpl_stats.srcrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
-
-                    if (best_mode == NEWMV) {
-                        // inter recon with rec_picture as reference pic
-                        uint64_t ref_poc       = best_ref_poc;
-                        uint32_t list_index    = best_rf_idx < 4 ? 0 : 1;
-                        uint32_t ref_pic_index = best_rf_idx >= 4 ? (best_rf_idx - 4) : best_rf_idx;
-                        if (pcs_ptr->tpl_data.ref_in_slide_window[list_index][ref_pic_index]) {
-                            uint32_t ref_frame_idx = 0;
-                            while (ref_frame_idx < MAX_TPL_LA_SW &&
-                                   encode_context_ptr->poc_map_idx[ref_frame_idx] != ref_poc)
-                                ref_frame_idx++;
-                            assert(ref_frame_idx != MAX_TPL_LA_SW);
-                            ref_pic_ptr =
-                                encode_context_ptr->mc_flow_rec_picture_buffer[ref_frame_idx];
-                        } else
-                            ref_pic_ptr = (EbPictureBufferDesc *)pcs_ptr->tpl_data
-                                              .tpl_ref_ds_ptr_array[list_index][ref_pic_index]
-                                              .picture_ptr;
-                        int32_t ref_origin_index = ref_pic_ptr->origin_x +
-                            (mb_origin_x + (final_best_mv.col >> 3)) +
-                            (mb_origin_y + (final_best_mv.row >> 3) + ref_pic_ptr->origin_y) *
-                                ref_pic_ptr->stride_y;
-                        for (int i = 0; i < 16; ++i)
-                            EB_MEMCPY(dst_buffer + i * dst_buffer_stride,
-                                      ref_pic_ptr->buffer_y + ref_origin_index +
-                                          i * ref_pic_ptr->stride_y,
-                                      sizeof(uint8_t) * (16));
-                    } else {
-                        // intra recon
-
-                        uint8_t *above_row;
-                        uint8_t *left_col;
-                        DECLARE_ALIGNED(16, uint8_t, left_data[MAX_TX_SIZE * 2 + 32]);
-                        DECLARE_ALIGNED(16, uint8_t, above_data[MAX_TX_SIZE * 2 + 32]);
-
-                        above_row             = above_data + 16;
-                        left_col              = left_data + 16;
-                        uint8_t *recon_buffer = recon_picture_ptr->buffer_y + dst_basic_offset;
-
-                        update_neighbor_samples_array_open_loop_mb_recon(above_row - 1,
-                                                                         left_col - 1,
-                                                                         recon_buffer,
-                                                                         dst_buffer_stride,
-                                                                         mb_origin_x,
-                                                                         mb_origin_y,
-                                                                         16,
-                                                                         16,
-                                                                         input_picture_ptr->width,
-                                                                         input_picture_ptr->height);
-                        uint8_t ois_intra_mode = best_intra_mode; // ois_mb_results_ptr->intra_mode;
-                        int32_t p_angle = av1_is_directional_mode((PredictionMode)ois_intra_mode)
+            uint32_t cu_origin_x = sb_params->origin_x + blk_stats_ptr->origin_x;
+            uint32_t cu_origin_y = sb_params->origin_y + blk_stats_ptr->origin_y;
+            if ((blk_stats_ptr->origin_x % 16) == 0 &&
+                (blk_stats_ptr->origin_y % 16) == 0 &&
+                ((pcs_ptr->enhanced_picture_ptr->width - cu_origin_x) < 16 ||
+                 (pcs_ptr->enhanced_picture_ptr->height - cu_origin_y) < 16))
+                small_boundary_blk = EB_TRUE;
+        }
+        if (bsize != 16 && !small_boundary_blk) {
+            pa_blk_index++;
+            continue;
+        }
+        if (sb_params->raster_scan_blk_validity[md_scan_to_raster_scan[pa_blk_index]]) {
+            uint32_t  mb_origin_x       = sb_params->origin_x + blk_stats_ptr->origin_x;
+            uint32_t  mb_origin_y       = sb_params->origin_y + blk_stats_ptr->origin_y;
+            const int dst_buffer_stride = recon_picture_ptr->stride_y;
+            const int dst_mb_offset     = mb_origin_y * dst_buffer_stride + mb_origin_x;
+            const int dst_basic_offset  = recon_picture_ptr->origin_y *
+                    recon_picture_ptr->stride_y +
+                recon_picture_ptr->origin_x;
+            uint8_t *dst_buffer = recon_picture_ptr->buffer_y + dst_basic_offset +
+                dst_mb_offset;
+
+            int64_t  inter_cost;
+            int64_t  recon_error = 1, sse = 1;
+            uint64_t best_ref_poc    = 0;
+            int32_t  best_rf_idx     = -1;
+            int64_t  best_inter_cost = INT64_MAX;
+            MV       final_best_mv   = {0, 0};
+            uint32_t max_inter_ref   = MAX_PA_ME_MV;
+
+            PredictionMode best_intra_mode = DC_PRED;
+            int64_t        best_intra_cost = INT64_MAX;
+            // Disable intra prediction
+            uint8_t disable_intra_pred =
+                pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nref ||
+                pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nbase;
+            if (!disable_intra_pred ||
+                (pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nref &&
+                 pcs_ptr->tpl_data.is_used_as_reference_flag) ||
+                (pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nbase &&
+                 pcs_ptr->tpl_data.tpl_temporal_layer_index == 0)) {
+                if (scs_ptr->in_loop_ois == 0) {
+                    OisMbResults *ois_mb_results_ptr =
+                        pcs_ptr->ois_mb_results[(mb_origin_y >> 4) * picture_width_in_mb +
+                                                (mb_origin_x >> 4)];
+                    best_intra_mode = ois_mb_results_ptr->intra_mode;
+                    best_intra_cost = ois_mb_results_ptr->intra_cost;
+
+                } else { // ois
+                    // always process as block16x16 even bsize or tx_size is 8x8
+                    bsize = 16;
+                    DECLARE_ALIGNED(16, uint8_t, left0_data[MAX_TX_SIZE * 2 + 32]);
+                    DECLARE_ALIGNED(16, uint8_t, above0_data[MAX_TX_SIZE * 2 + 32]);
+                    DECLARE_ALIGNED(16, uint8_t, left_data[MAX_TX_SIZE * 2 + 32]);
+                    DECLARE_ALIGNED(16, uint8_t, above_data[MAX_TX_SIZE * 2 + 32]);
+
+                    uint8_t *above_row;
+                    uint8_t *left_col;
+                    uint8_t *above0_row;
+                    uint8_t *left0_col;
+                    above0_row = above0_data + 16;
+                    left0_col  = left0_data + 16;
+                    above_row  = above_data + 16;
+                    left_col   = left_data + 16;
+
+                    uint8_t *src = input_ptr->buffer_y +
+                        pcs_ptr->enhanced_picture_ptr->origin_x + mb_origin_x +
+                        (pcs_ptr->enhanced_picture_ptr->origin_y + mb_origin_y) *
+                            input_ptr->stride_y;
+
+                    // Fill Neighbor Arrays
+                    update_neighbor_samples_array_open_loop_mb(above0_row - 1,
+                                                               left0_col - 1,
+                                                               input_ptr,
+                                                               input_ptr->stride_y,
+                                                               mb_origin_x,
+                                                               mb_origin_y,
+                                                               bsize,
+                                                               bsize);
+                    uint8_t ois_intra_mode;
+                    uint8_t intra_mode_start = DC_PRED;
+                    EbBool  enable_paeth  = pcs_ptr->scs_ptr->static_config.enable_paeth ==
+                            DEFAULT
+                          ? EB_TRUE
+                          : (EbBool)pcs_ptr->scs_ptr->static_config.enable_paeth;
+                    EbBool  enable_smooth = pcs_ptr->scs_ptr->static_config.enable_smooth ==
+                            DEFAULT
+                         ? EB_TRUE
+                         : (EbBool)pcs_ptr->scs_ptr->static_config.enable_smooth;
+                    uint8_t intra_mode_end =
+
+                        pcs_ptr->tpl_data.tpl_ctrls.tpl_opt_flag
+
+                        ? DC_PRED
+                        : enable_paeth      ? PAETH_PRED
+                            : enable_smooth ? SMOOTH_H_PRED
+                                            : D67_PRED;
+
+                    for (ois_intra_mode = intra_mode_start;
+                         ois_intra_mode <= intra_mode_end;
+                         ++ois_intra_mode) {
+                        int32_t p_angle = av1_is_directional_mode(
+                                              (PredictionMode)ois_intra_mode)
                             ? mode_to_angle_map[(PredictionMode)ois_intra_mode]
                             : 0;
                         // Edge filter
                         if (av1_is_directional_mode((PredictionMode)ois_intra_mode) &&
                             1 /*scs_ptr->seq_header.enable_intra_edge_filter*/) {
+                            EB_MEMCPY(left_data,
+                                      left0_data,
+                                      sizeof(uint8_t) * (MAX_TX_SIZE * 2 + 32));
+                            EB_MEMCPY(above_data,
+                                      above0_data,
+                                      sizeof(uint8_t) * (MAX_TX_SIZE * 2 + 32));
+                            above_row = above_data + 16;
+                            left_col  = left_data + 16;
                             filter_intra_edge(NULL,
                                               ois_intra_mode,
                                               scs_ptr->seq_header.max_frame_width,
                                               scs_ptr->seq_header.max_frame_height,
                                               p_angle,
-                                              mb_origin_x,
-                                              mb_origin_y,
+                                              (int32_t)mb_origin_x,
+                                              (int32_t)mb_origin_y,
                                               above_row,
                                               left_col);
+                        } else {
+                            above_row = above0_row;
+                            left_col  = left0_col;
                         }
                         // PRED
                         intra_prediction_open_loop_mb(p_angle,
@@ -745,64 +559,269 @@ void tpl_mc_flow_dispenser(EncodeContext *encode_context_ptr, SequenceControlSet
                                                       tx_size,
                                                       above_row,
                                                       left_col,
-                                                      dst_buffer,
-                                                      dst_buffer_stride);
+                                                      predictor,
+                                                      16);
+
+                        // Distortion
+                        svt_aom_subtract_block(
+                            16, 16, src_diff, 16, src, input_ptr->stride_y, predictor, 16);
+                        svt_av1_wht_fwd_txfm(src_diff, 16, coeff, 2 /*TX_16X16*/, 8, 0);
+                        int64_t intra_cost = svt_aom_satd(coeff, 16 * 16);
+
+                        if (intra_cost < best_intra_cost) {
+                            best_intra_cost = intra_cost;
+                            best_intra_mode = ois_intra_mode;
+                        }
                     }
+                }
+            }
+            uint8_t  best_mode = DC_PRED;
+            uint8_t *src_mb    = input_picture_ptr->buffer_y + input_picture_ptr->origin_x +
+                mb_origin_x +
+                (input_picture_ptr->origin_y + mb_origin_y) * input_picture_ptr->stride_y;
+            memset(&tpl_stats, 0, sizeof(tpl_stats));
+            blk_geom.origin_x = blk_stats_ptr->origin_x;
+            blk_geom.origin_y = blk_stats_ptr->origin_y;
+            me_mb_offset      = get_me_info_index(
+                pcs_ptr->max_number_of_pus_per_sb, &blk_geom, 0, 0);
+
+            uint32_t best_reference = 0;
+            if (pcs_ptr->tpl_data.tpl_ctrls.get_best_ref)
+                // Reference pruning
+                get_best_reference(pcs_ptr,
+                                   sb_index,
+                                   me_mb_offset,
+                                   mb_origin_x,
+                                   mb_origin_y,
+                                   &best_reference);
+
+            for (uint32_t rf_idx = 0; rf_idx < max_inter_ref; rf_idx++) {
+                if (pcs_ptr->tpl_data.tpl_ctrls.get_best_ref)
+                    if (rf_idx != best_reference)
+                        continue;
+                uint32_t list_index    = rf_idx < 4 ? 0 : 1;
+                uint32_t ref_pic_index = rf_idx >= 4 ? (rf_idx - 4) : rf_idx;
+                if ((list_index == 0 &&
+                     (ref_pic_index + 1) > pcs_ptr->tpl_data.tpl_ref0_count) ||
+                    (list_index == 1 &&
+                     (ref_pic_index + 1) > pcs_ptr->tpl_data.tpl_ref1_count))
+                    continue;
+                if (!is_me_data_valid(pcs_ptr->pa_me_data->me_results[sb_index],
+                                      me_mb_offset,
+                                      list_index,
+                                      ref_pic_index))
+                    continue;
+                ref_pic_ptr = (EbPictureBufferDesc *)pcs_ptr->tpl_data
+                                  .tpl_ref_ds_ptr_array[list_index][ref_pic_index]
+                                  .picture_ptr;
+                const MeSbResults *me_results = pcs_ptr->pa_me_data->me_results[sb_index];
+                x_curr_mv                     = me_results
+                                ->me_mv_array[me_mb_offset * MAX_PA_ME_MV +
+                                              (list_index ? 4 : 0) + ref_pic_index]
+                                .x_mv
+                    << 1;
+                y_curr_mv = me_results
+                                ->me_mv_array[me_mb_offset * MAX_PA_ME_MV +
+                                              (list_index ? 4 : 0) + ref_pic_index]
+                                .y_mv
+                    << 1;
+
+                MV      best_mv          = {y_curr_mv, x_curr_mv};
+                int32_t ref_origin_index = ref_pic_ptr->origin_x +
+                    (mb_origin_x + (best_mv.col >> 3)) +
+                    (mb_origin_y + (best_mv.row >> 3) + ref_pic_ptr->origin_y) *
+                        ref_pic_ptr->stride_y;
+
+                svt_aom_subtract_block(16,
+                                       16,
+                                       src_diff,
+                                       16,
+                                       src_mb,
+                                       input_picture_ptr->stride_y,
+                                       ref_pic_ptr->buffer_y + ref_origin_index,
+                                       ref_pic_ptr->stride_y);
+                svt_av1_wht_fwd_txfm(src_diff, 16, coeff, tx_size, 8, 0);
+
+                inter_cost = svt_aom_satd(coeff, 256);
+                if (inter_cost < best_inter_cost) {
+                    EB_MEMCPY(best_coeff, coeff, sizeof(best_coeff));
+                    best_ref_poc = pcs_ptr->tpl_data
+                                       .tpl_ref_ds_ptr_array[list_index][ref_pic_index]
+                                       .picture_number;
+
+                    best_rf_idx     = rf_idx;
+                    best_inter_cost = inter_cost;
+                    final_best_mv   = best_mv;
+
+                    if (best_inter_cost < best_intra_cost)
+                        best_mode = NEWMV;
+                }
+            } // rf_idx
+
+            if (best_mode == NEWMV) {
+                uint16_t eob = 0;
+                get_quantize_error(mb_plane,
+                                   best_coeff,
+                                   qcoeff,
+                                   dqcoeff,
+                                   tx_size,
+                                   &eob,
+                                   &recon_error,
+                                   &sse);
+                int rate_cost        = pcs_ptr->tpl_data.tpl_ctrls.tpl_opt_flag
+                           ? 0
+                           : rate_estimator(qcoeff, eob, tx_size);
+                tpl_stats.srcrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
+            }
+            tpl_stats.srcrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
+
+            if (best_mode == NEWMV) {
+                // inter recon with rec_picture as reference pic
+                uint64_t ref_poc       = best_ref_poc;
+                uint32_t list_index    = best_rf_idx < 4 ? 0 : 1;
+                uint32_t ref_pic_index = best_rf_idx >= 4 ? (best_rf_idx - 4) : best_rf_idx;
+                if (pcs_ptr->tpl_data.ref_in_slide_window[list_index][ref_pic_index]) {
+                    uint32_t ref_frame_idx = 0;
+                    while (ref_frame_idx < MAX_TPL_LA_SW &&
+                           encode_context_ptr->poc_map_idx[ref_frame_idx] != ref_poc)
+                        ref_frame_idx++;
+                    assert(ref_frame_idx != MAX_TPL_LA_SW);
+                    ref_pic_ptr =
+                        encode_context_ptr->mc_flow_rec_picture_buffer[ref_frame_idx];
+                } else
+                    ref_pic_ptr = (EbPictureBufferDesc *)pcs_ptr->tpl_data
+                                      .tpl_ref_ds_ptr_array[list_index][ref_pic_index]
+                                      .picture_ptr;
+                int32_t ref_origin_index = ref_pic_ptr->origin_x +
+                    (mb_origin_x + (final_best_mv.col >> 3)) +
+                    (mb_origin_y + (final_best_mv.row >> 3) + ref_pic_ptr->origin_y) *
+                        ref_pic_ptr->stride_y;
+                for (int i = 0; i < 16; ++i)
+                    EB_MEMCPY(dst_buffer + i * dst_buffer_stride,
+                              ref_pic_ptr->buffer_y + ref_origin_index +
+                                  i * ref_pic_ptr->stride_y,
+                              sizeof(uint8_t) * (16));
+            } else {
+                // intra recon
+
+                uint8_t *above_row;
+                uint8_t *left_col;
+                DECLARE_ALIGNED(16, uint8_t, left_data[MAX_TX_SIZE * 2 + 32]);
+                DECLARE_ALIGNED(16, uint8_t, above_data[MAX_TX_SIZE * 2 + 32]);
+
+                above_row             = above_data + 16;
+                left_col              = left_data + 16;
+                uint8_t *recon_buffer = recon_picture_ptr->buffer_y + dst_basic_offset;
+
+                update_neighbor_samples_array_open_loop_mb_recon(above_row - 1,
+                                                                 left_col - 1,
+                                                                 recon_buffer,
+                                                                 dst_buffer_stride,
+                                                                 mb_origin_x,
+                                                                 mb_origin_y,
+                                                                 16,
+                                                                 16,
+                                                                 input_picture_ptr->width,
+                                                                 input_picture_ptr->height);
+                uint8_t ois_intra_mode = best_intra_mode; // ois_mb_results_ptr->intra_mode;
+                int32_t p_angle = av1_is_directional_mode((PredictionMode)ois_intra_mode)
+                    ? mode_to_angle_map[(PredictionMode)ois_intra_mode]
+                    : 0;
+                // Edge filter
+                if (av1_is_directional_mode((PredictionMode)ois_intra_mode) &&
+                    1 /*scs_ptr->seq_header.enable_intra_edge_filter*/) {
+                    filter_intra_edge(NULL,
+                                      ois_intra_mode,
+                                      scs_ptr->seq_header.max_frame_width,
+                                      scs_ptr->seq_header.max_frame_height,
+                                      p_angle,
+                                      mb_origin_x,
+                                      mb_origin_y,
+                                      above_row,
+                                      left_col);
+                }
+                // PRED
+                intra_prediction_open_loop_mb(p_angle,
+                                              ois_intra_mode,
+                                              mb_origin_x,
+                                              mb_origin_y,
+                                              tx_size,
+                                              above_row,
+                                              left_col,
+                                              dst_buffer,
+                                              dst_buffer_stride);
+            }
 
-                    svt_aom_subtract_block(16,
-                                           16,
-                                           src_diff,
-                                           16,
-                                           src_mb,
-                                           input_picture_ptr->stride_y,
-                                           dst_buffer,
-                                           dst_buffer_stride);
-                    svt_av1_wht_fwd_txfm(src_diff, 16, coeff, tx_size, 8, 0);
-
-                    uint16_t eob = 0;
-
-                    get_quantize_error(
-                        &mb_plane, coeff, qcoeff, dqcoeff, tx_size, &eob, &recon_error, &sse);
-
-                    int rate_cost = pcs_ptr->tpl_data.tpl_ctrls.tpl_opt_flag
-                        ? 0
-                        : rate_estimator(qcoeff, eob, tx_size);
-                    // Disable intra prediction
-                    disable_intra_pred = pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nref ||
-                        pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nbase;
-                    if (!disable_intra_pred || (pcs_ptr->tpl_data.is_used_as_reference_flag))
-                        if (eob) {
-                            av1_inv_transform_recon8bit((int32_t *)dqcoeff,
-                                                        dst_buffer,
-                                                        dst_buffer_stride,
-                                                        dst_buffer,
-                                                        dst_buffer_stride,
-                                                        TX_16X16,
-                                                        DCT_DCT,
-                                                        PLANE_TYPE_Y,
-                                                        eob,
-                                                        0);
-                        }
+            svt_aom_subtract_block(16,
+                                   16,
+                                   src_diff,
+                                   16,
+                                   src_mb,
+                                   input_picture_ptr->stride_y,
+                                   dst_buffer,
+                                   dst_buffer_stride);
+            svt_av1_wht_fwd_txfm(src_diff, 16, coeff, tx_size, 8, 0);
 
-                    tpl_stats.recrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
-                    tpl_stats.recrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
-                    if (best_mode != NEWMV) {
-                        tpl_stats.srcrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
-                        tpl_stats.srcrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
-                    }
-                    tpl_stats.recrf_dist = AOMMAX(tpl_stats.srcrf_dist, tpl_stats.recrf_dist);
-                    tpl_stats.recrf_rate = AOMMAX(tpl_stats.srcrf_rate, tpl_stats.recrf_rate);
-                    if (pcs_ptr->tpl_data.tpl_slice_type != I_SLICE && best_rf_idx != -1) {
-                        tpl_stats.mv            = final_best_mv;
-                        tpl_stats.ref_frame_poc = best_ref_poc;
-                    }
-                    // Motion flow dependency dispenser.
-                    result_model_store(pcs_ptr, &tpl_stats, mb_origin_x, mb_origin_y);
+            uint16_t eob = 0;
+
+            get_quantize_error(
+                mb_plane, coeff, qcoeff, dqcoeff, tx_size, &eob, &recon_error, &sse);
+
+            int rate_cost = pcs_ptr->tpl_data.tpl_ctrls.tpl_opt_flag
+                ? 0
+                : rate_estimator(qcoeff, eob, tx_size);
+            // Disable intra prediction
+            disable_intra_pred = pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nref ||
+                pcs_ptr->tpl_data.tpl_ctrls.disable_intra_pred_nbase;
+            if (!disable_intra_pred || (pcs_ptr->tpl_data.is_used_as_reference_flag))
+                if (eob) {
+                    av1_inv_transform_recon8bit((int32_t *)dqcoeff,
+                                                dst_buffer,
+                                                dst_buffer_stride,
+                                                dst_buffer,
+                                                dst_buffer_stride,
+                                                TX_16X16,
+                                                DCT_DCT,
+                                                PLANE_TYPE_Y,
+                                                eob,
+                                                0);
                 }
-                pa_blk_index++;
+
+            tpl_stats.recrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
+            tpl_stats.recrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
+            if (best_mode != NEWMV) {
+                tpl_stats.srcrf_dist = recon_error << (TPL_DEP_COST_SCALE_LOG2);
+                tpl_stats.srcrf_rate = rate_cost << TPL_DEP_COST_SCALE_LOG2;
+            }
+            tpl_stats.recrf_dist = AOMMAX(tpl_stats.srcrf_dist, tpl_stats.recrf_dist);
+            tpl_stats.recrf_rate = AOMMAX(tpl_stats.srcrf_rate, tpl_stats.recrf_rate);
+            if (pcs_ptr->tpl_data.tpl_slice_type != I_SLICE && best_rf_idx != -1) {
+                tpl_stats.mv            = final_best_mv;
+                tpl_stats.ref_frame_poc = best_ref_poc;
             }
+            // Motion flow dependency dispenser.
+            result_model_store(pcs_ptr, &tpl_stats, mb_origin_x, mb_origin_y);
         }
+        pa_blk_index++;
     }
+}
+
+/************************************************
+* Genrate TPL MC Flow Dispenser  Based on Lookahead
+** LAD Window: sliding window size
+************************************************/
+void tpl_mc_flow_dispenser(EncodeContext *encode_context_ptr, SequenceControlSet *scs_ptr,
+                           PictureParentControlSet *pcs_ptr, int32_t frame_idx) {
+    EbPictureBufferDesc *recon_picture_ptr =
+        encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx];
+    MacroblockPlane mb_plane;
+
+    tpl_setup_mb_plane(scs_ptr, pcs_ptr, &mb_plane);
+
+    // Walk the first N entries in the sliding window
+    for (uint32_t sb_index = 0; sb_index < pcs_ptr->sb_total_count; ++sb_index)
+        tpl_mc_flow_dispenser_sb(
+            encode_context_ptr, scs_ptr, pcs_ptr, frame_idx, sb_index, &mb_plane);
 
     // padding current recon picture
     generate_padding(recon_picture_ptr->buffer_y,
@@ -815,6 +834,134 @@ void tpl_mc_flow_dispenser(EncodeContext *encode_context_ptr, SequenceControlSet
     return;
 }
 
+/************************************************
+* Genrate TPL MC Flow Dispenser for one SB row.
+* The SB rows of a picture are processed as a wavefront : the intra
+* recon of a SB uses the top, top-left and top-right recon samples.
+* A SB waits for the row above to be about one SB of TPL work ahead,
+* which is long next to a wake-up, so the wait blocks at once instead of
+* spinning on a core another row could use.
+************************************************/
+static void tpl_mc_flow_dispenser_sb_row(PictureParentControlSet *pcs_ptr, uint32_t sb_row) {
+    SequenceControlSet *scs_ptr            = pcs_ptr->scs_ptr;
+    EncodeContext *     encode_context_ptr = scs_ptr->encode_context_ptr;
+    const uint32_t      sb_cols            = scs_ptr->pic_width_in_sb;
+    const uint32_t      sb_start           = sb_row * sb_cols;
+    const uint32_t      sb_end             = MIN(sb_start + sb_cols, pcs_ptr->sb_total_count);
+    MacroblockPlane     mb_plane;
+
+    tpl_setup_mb_plane(scs_ptr, pcs_ptr, &mb_plane);
+
+    for (uint32_t sb_index = sb_start; sb_index < sb_end; ++sb_index) {
+        uint32_t sb_col = sb_index - sb_start;
+        if (sb_row) {
+            volatile uint32_t *above_progress =
+                (volatile uint32_t *)&pcs_ptr->tpl_disp_sb_row_progress[sb_row - 1];
+            while (*above_progress < MIN(sb_col + 2, sb_cols)) {
+                int32_t wait_seq = svt_begin_wait_cond_var(&pcs_ptr->tpl_disp_sb_row_cond);
+                svt_end_wait_cond_var(&pcs_ptr->tpl_disp_sb_row_cond,
+                                      wait_seq,
+                                      (EbBool)(*above_progress < MIN(sb_col + 2, sb_cols)));
+            }
+        }
+        svt_memory_barrier();
+
+        tpl_mc_flow_dispenser_sb(encode_context_ptr,
+                                 scs_ptr,
+                                 pcs_ptr,
+                                 pcs_ptr->tpl_disp_frame_idx,
+                                 sb_index,
+                                 &mb_plane);
+
+        svt_memory_barrier();
+        pcs_ptr->tpl_disp_sb_row_progress[sb_row] = sb_col + 1;
+        svt_notify_cond_var(&pcs_ptr->tpl_disp_sb_row_cond);
+    }
+
+    svt_block_on_mutex(pcs_ptr->tpl_disp_mutex);
+    pcs_ptr->tpl_disp_seg_acc++;
+    if (pcs_ptr->tpl_disp_seg_acc == pcs_ptr->tpl_disp_segments_total_count)
+        svt_post_semaphore(pcs_ptr->tpl_disp_done_semaphore);
+    svt_release_mutex(pcs_ptr->tpl_disp_mutex);
+}
+
+/************************************************
+* Genrate TPL MC Flow Dispenser for the SB rows of the picture nobody
+* started yet, in the ME processes and in the thread dispensing them.
+* Rows are started in order, so a row only waits on rows being processed.
+* A task of a dispense already done finds no row left and returns.
+************************************************/
+void tpl_mc_flow_dispenser_sb_rows(PictureParentControlSet *pcs_ptr) {
+    while (1) {
+        uint32_t sb_row;
+        svt_block_on_mutex(pcs_ptr->tpl_disp_mutex);
+        const EbBool row_left = pcs_ptr->tpl_disp_next_row <
+            pcs_ptr->tpl_disp_segments_total_count;
+        sb_row = pcs_ptr->tpl_disp_next_row;
+        if (row_left)
+            pcs_ptr->tpl_disp_next_row++;
+        svt_release_mutex(pcs_ptr->tpl_disp_mutex);
+        if (!row_left)
+            break;
+        tpl_mc_flow_dispenser_sb_row(pcs_ptr, sb_row);
+    }
+}
+
+/************************************************
+* Genrate TPL MC Flow Dispenser with the SB rows spread over the ME
+* processes and the calling thread. The calling thread runs the rows no ME
+* process took, so it never waits on tasks queued behind other ME or
+* temporal filtering work, only on rows in progress. The frames of the TPL
+* group and the synthesizer still run one after the other.
+************************************************/
+static void tpl_mc_flow_dispenser_mt(EncodeContext *encode_context_ptr, SequenceControlSet *scs_ptr,
+                                     PictureParentControlSet *pcs_ptr, int32_t frame_idx,
+                                     EbFifo *tpl_disp_fifo_ptr) {
+    EbPictureBufferDesc *recon_picture_ptr =
+        encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx];
+    const uint32_t sb_cols = scs_ptr->pic_width_in_sb;
+    MacroblockPlane mb_plane;
+
+    // Sets the base rdmult of the picture
+    tpl_setup_mb_plane(scs_ptr, pcs_ptr, &mb_plane);
+
+    svt_block_on_mutex(pcs_ptr->tpl_disp_mutex);
+    pcs_ptr->tpl_disp_frame_idx            = frame_idx;
+    pcs_ptr->tpl_disp_seg_acc              = 0;
+    pcs_ptr->tpl_disp_segments_total_count = (uint16_t)(
+        (pcs_ptr->sb_total_count + sb_cols - 1) / sb_cols);
+    for (uint32_t sb_row = 0; sb_row < pcs_ptr->tpl_disp_segments_total_count; ++sb_row)
+        pcs_ptr->tpl_disp_sb_row_progress[sb_row] = 0;
+    pcs_ptr->tpl_disp_next_row = 0;
+    svt_release_mutex(pcs_ptr->tpl_disp_mutex);
+
+    // One task per ME process at most, the calling thread takes a row too
+    const uint32_t task_count = MIN((uint32_t)pcs_ptr->tpl_disp_segments_total_count - 1,
+                                    scs_ptr->motion_estimation_process_init_count);
+    for (uint32_t task = 0; task < task_count; ++task) {
+        EbObjectWrapper *       out_results_wrapper_ptr;
+        PictureDecisionResults *out_results_ptr;
+
+        svt_get_empty_object(tpl_disp_fifo_ptr, &out_results_wrapper_ptr);
+        out_results_ptr                  = (PictureDecisionResults *)out_results_wrapper_ptr->object_ptr;
+        out_results_ptr->pcs_wrapper_ptr = pcs_ptr->p_pcs_wrapper_ptr;
+        out_results_ptr->segment_index   = task;
+        out_results_ptr->task_type       = 3;
+        svt_post_full_object(out_results_wrapper_ptr);
+    }
+
+    tpl_mc_flow_dispenser_sb_rows(pcs_ptr);
+    svt_block_on_semaphore(pcs_ptr->tpl_disp_done_semaphore);
+
+    // padding current recon picture
+    generate_padding(recon_picture_ptr->buffer_y,
+                     recon_picture_ptr->stride_y,
+                     recon_picture_ptr->width,
+                     recon_picture_ptr->height,
+                     recon_picture_ptr->origin_x,
+                     recon_picture_ptr->origin_y);
+}
+
 static int get_overlap_area(int grid_pos_row, int grid_pos_col, int ref_pos_row, int ref_pos_col,
                             int block, int /*BLOCK_SIZE*/ bsize) {
     int width = 0, height = 0;
@@ -1115,9 +1262,11 @@ EbErrorType init_tpl_buffers(EncodeContext *encode_context_ptr, PictureParentCon
 }
 /************************************************
 * Genrate TPL MC Flow Based on frames in the tpl group
+** tpl_disp_fifo_ptr: ME processes input fifo used to dispense the SB rows
+** of each frame in parallel, NULL to run the dispenser on the calling thread
 ************************************************/
 EbErrorType tpl_mc_flow(EncodeContext *encode_context_ptr, SequenceControlSet *scs_ptr,
-                        PictureParentControlSet *pcs_ptr) {
+                        PictureParentControlSet *pcs_ptr, EbFifo *tpl_disp_fifo_ptr) {
     PictureParentControlSet *pcs_array[MAX_TPL_LA_SW] = {
         NULL,
     };
@@ -1149,9 +1298,19 @@ EbErrorType tpl_mc_flow(EncodeContext *encode_context_ptr, SequenceControlSet *s
         }
     }
 
-    init_tpl_buffers(encode_context_ptr, pcs_ptr, pcs_array);
+    // A rendition projects the costs of the ladder source instead of running
+    // the dispenser and the synthesizer
+    const EbBool ladder_tpl = encode_context_ptr->ladder_role == LADDER_RENDITION &&
+        pcs_array[0]->tpl_data.tpl_temporal_layer_index == 0 &&
+        svt_ladder_import_tpl(encode_context_ptr->ladder, encode_context_ptr->ladder_slot, pcs_array[0]);
+    if (ladder_tpl) {
+        for (frame_idx = 0; frame_idx < frames_in_sw; frame_idx++)
+            pcs_array[frame_idx]->num_tpl_processed++;
+        generate_r0beta(pcs_array[0]);
+    } else
+        init_tpl_buffers(encode_context_ptr, pcs_ptr, pcs_array);
 
-    if (pcs_array[0]->tpl_data.tpl_temporal_layer_index == 0) {
+    if (!ladder_tpl && pcs_array[0]->tpl_data.tpl_temporal_layer_index == 0) {
         uint8_t tpl_on;
         encode_context_ptr->poc_map_idx[0] = pcs_array[0]->picture_number;
         for (frame_idx = 0; frame_idx < frames_in_sw; frame_idx++) {
@@ -1171,8 +1330,17 @@ EbErrorType tpl_mc_flow(EncodeContext *encode_context_ptr, SequenceControlSet *s
                     ? 1
                     : tpl_on;
             }
-            if (tpl_on)
-                tpl_mc_flow_dispenser(encode_context_ptr, scs_ptr, pcs_array[frame_idx], frame_idx);
+            if (tpl_on) {
+                if (tpl_disp_fifo_ptr && scs_ptr->motion_estimation_process_init_count > 1)
+                    tpl_mc_flow_dispenser_mt(encode_context_ptr,
+                                             scs_ptr,
+                                             pcs_array[frame_idx],
+                                             frame_idx,
+                                             tpl_disp_fifo_ptr);
+                else
+                    tpl_mc_flow_dispenser(
+                        encode_context_ptr, scs_ptr, pcs_array[frame_idx], frame_idx);
+            }
 
             pcs_array[frame_idx]->num_tpl_processed++;
         }
@@ -1195,6 +1363,8 @@ EbErrorType tpl_mc_flow(EncodeContext *encode_context_ptr, SequenceControlSet *s
 
         // generate tpl stats
         generate_r0beta(pcs_array[0]);
+        if (encode_context_ptr->ladder_role == LADDER_SOURCE)
+            svt_ladder_export_tpl(encode_context_ptr->ladder, pcs_array[0]);
 
 #if DEBUG_TPL
         SVT_LOG("LOG displayorder:%ld\n", pcs_array[0]->picture_number);
@@ -1232,13 +1402,15 @@ EbErrorType tpl_mc_flow(EncodeContext *encode_context_ptr, SequenceControlSet *s
 #endif
     }
 
-    for (frame_idx = 0; frame_idx < frames_in_sw; frame_idx++) {
-        if (encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx] &&
-            encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx] !=
-                encode_context_ptr->mc_flow_rec_picture_buffer_noref)
-            EB_DELETE(encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx]);
+    if (!ladder_tpl) {
+        for (frame_idx = 0; frame_idx < frames_in_sw; frame_idx++) {
+            if (encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx] &&
+                encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx] !=
+                    encode_context_ptr->mc_flow_rec_picture_buffer_noref)
+                EB_DELETE(encode_context_ptr->mc_flow_rec_picture_buffer[frame_idx]);
+        }
+        EB_DELETE(encode_context_ptr->mc_flow_rec_picture_buffer_noref);
     }
-    EB_DELETE(encode_context_ptr->mc_flow_rec_picture_buffer_noref);
     if (scs_ptr->in_loop_me == 0) {
         for (uint32_t i = 0; i < pcs_ptr->tpl_group_size; i++) {
             if (pcs_ptr->tpl_group[i]->num_tpl_processed == pcs_ptr->tpl_group[i]->num_tpl_grps) {
@@ -7172,6 +7344,24 @@ void recode_loop_update_q(PictureParentControlSet *ppcs_ptr, int *const loop, in
     *loop = (*q != last_q);
 }
 
+/*
+ * Call the release callback of a picture sent in zero-copy mode and drop the
+ * references to its planes. The end of sequence buffer carries no planes.
+ */
+static void release_zero_copy_input(SequenceControlSet *scs_ptr, EbBufferHeaderType *input_ptr) {
+    EbPictureBufferDesc *input_picture_ptr = (EbPictureBufferDesc *)input_ptr->p_buffer;
+    if (input_picture_ptr->buffer_y == NULL)
+        return;
+    input_picture_ptr->buffer_y          = NULL;
+    input_picture_ptr->buffer_cb         = NULL;
+    input_picture_ptr->buffer_cr         = NULL;
+    input_picture_ptr->buffer_bit_inc_y  = NULL;
+    input_picture_ptr->buffer_bit_inc_cb = NULL;
+    input_picture_ptr->buffer_bit_inc_cr = NULL;
+    scs_ptr->static_config.input_release_cb(scs_ptr->static_config.input_release_cb_data,
+                                            input_ptr->p_app_private);
+}
+
 void *rate_control_kernel(void *input_ptr) {
     // Context
     EbThreadContext *   thread_context_ptr = (EbThreadContext *)input_ptr;
@@ -7230,12 +7420,14 @@ void *rate_control_kernel(void *input_ptr) {
             scs_ptr = (SequenceControlSet *)pcs_ptr->scs_wrapper_ptr->object_ptr;
             FrameHeader *frm_hdr                       = &pcs_ptr->parent_pcs_ptr->frm_hdr;
             pcs_ptr->parent_pcs_ptr->blk_lambda_tuning = EB_FALSE;
+            svt_aom_mark_frame_stats_stage(pcs_ptr->parent_pcs_ptr, EB_FRAME_STATS_RATE_CONTROL);
 
             if (scs_ptr->in_loop_me)
 
                 if (/*scs_ptr->in_loop_me &&*/ scs_ptr->static_config.enable_tpl_la &&
                     pcs_ptr->temporal_layer_index == 0) {
-                    tpl_mc_flow(scs_ptr->encode_context_ptr, scs_ptr, pcs_ptr->parent_pcs_ptr);
+                    tpl_mc_flow(
+                        scs_ptr->encode_context_ptr, scs_ptr, pcs_ptr->parent_pcs_ptr, NULL);
                 }
 
             // Release the down scaled input
@@ -7815,6 +8007,11 @@ void *rate_control_kernel(void *input_ptr) {
 #else
             EB_DESTROY_SEMAPHORE(parentpicture_control_set_ptr->pame_done_semaphore);
 #endif
+            // Give the planes of a zero-copy input picture back to the caller
+            if (parentpicture_control_set_ptr->scs_ptr->static_config.zero_copy_input &&
+                !parentpicture_control_set_ptr->is_overlay)
+                release_zero_copy_input(parentpicture_control_set_ptr->scs_ptr,
+                                        parentpicture_control_set_ptr->input_ptr);
             // Release the SequenceControlSet
             svt_release_object(parentpicture_control_set_ptr->scs_wrapper_ptr);
             // Release the ParentPictureControlSet
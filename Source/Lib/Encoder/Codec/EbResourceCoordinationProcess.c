@@ -957,6 +957,7 @@ void *resource_coordination_kernel(void *input_ptr) {
             end_of_sequence_flag = (pcs_ptr->input_ptr->flags & EB_BUFFERFLAG_EOS) ? EB_TRUE
                                                                                    : EB_FALSE;
             svt_av1_get_time(&pcs_ptr->start_time_seconds, &pcs_ptr->start_time_u_seconds);
+            memset(pcs_ptr->frame_stats_stage_us, 0, sizeof(pcs_ptr->frame_stats_stage_us));
 
             pcs_ptr->scs_wrapper_ptr =
                 context_ptr->sequence_control_set_active_array[instance_index];
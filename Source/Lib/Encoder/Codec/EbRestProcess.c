@@ -19,6 +19,7 @@
 #include "EbPictureDemuxResults.h"
 #include "EbReferenceObject.h"
 #include "EbPictureControlSet.h"
+#include "EbMetricsProcess.h"
 
 #define DEBUG_UPSCALING 0
 
@@ -30,6 +31,7 @@ typedef struct RestContext {
     EbFifo *rest_input_fifo_ptr;
     EbFifo *rest_output_fifo_ptr;
     EbFifo *picture_demux_fifo_ptr;
+    EbFifo *metrics_output_fifo_ptr;
 
     EbPictureBufferDesc *trial_frame_rst;
 
@@ -51,8 +53,6 @@ void recon_output(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr);
 void svt_av1_loop_restoration_filter_frame(Yv12BufferConfig *frame, Av1Common *cm,
                                            int32_t optimized_lr);
 void copy_statistics_to_ref_obj_ect(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr);
-void psnr_calculations(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr, EbBool free_memory);
-void ssim_calculations(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr, EbBool free_memory);
 void pad_ref_and_set_flags(PictureControlSet *pcs_ptr, SequenceControlSet *scs_ptr);
 void generate_padding(EbByte src_pic, uint32_t src_stride, uint32_t original_src_width,
                       uint32_t original_src_height, uint32_t padding_width,
@@ -84,6 +84,26 @@ static void rest_context_dctor(EbPtr p) {
     EB_FREE_ARRAY(obj);
 }
 
+/* Splits the PSNR and SSIM measurement of the filtered picture into one task
+ * per band of 64 luma rows. The reference picture is held until the last band
+ * is measured, and packetization waits for it on metrics_done_semaphore. */
+static void post_metrics_tasks(RestContext *context_ptr, PictureControlSet *pcs_ptr,
+                               EbObjectWrapper *pcs_wrapper_ptr) {
+    PictureParentControlSet *ppcs_ptr = pcs_ptr->parent_pcs_ptr;
+
+    svt_atomic_store_u32(&ppcs_ptr->metrics_bands_done, 0);
+    if (ppcs_ptr->is_used_as_reference_flag == EB_TRUE)
+        svt_object_inc_live_count(ppcs_ptr->reference_picture_wrapper_ptr, 1);
+    for (uint32_t band = 0; band < ppcs_ptr->metrics_band_count; band++) {
+        EbObjectWrapper *metrics_tasks_wrapper_ptr;
+        svt_get_empty_object(context_ptr->metrics_output_fifo_ptr, &metrics_tasks_wrapper_ptr);
+        MetricsTasks *metrics_tasks_ptr = (MetricsTasks *)metrics_tasks_wrapper_ptr->object_ptr;
+        metrics_tasks_ptr->pcs_wrapper_ptr = pcs_wrapper_ptr;
+        metrics_tasks_ptr->band_index      = band;
+        svt_post_full_object(metrics_tasks_wrapper_ptr);
+    }
+}
+
 /******************************************************
  * Rest Context Constructor
  ******************************************************/
@@ -106,6 +126,9 @@ EbErrorType rest_context_ctor(EbThreadContext *  thread_context_ptr,
         enc_handle_ptr->rest_results_resource_ptr, index);
     context_ptr->picture_demux_fifo_ptr = svt_system_resource_get_producer_fifo(
         enc_handle_ptr->picture_demux_results_resource_ptr, demux_index);
+    if (config->stat_report)
+        context_ptr->metrics_output_fifo_ptr = svt_system_resource_get_producer_fifo(
+            enc_handle_ptr->metrics_tasks_resource_ptr, index);
 
     {
         EbPictureBufferDescInitData init_data;
@@ -568,16 +591,13 @@ void *rest_kernel(void *input_ptr) {
                 copy_statistics_to_ref_obj_ect(pcs_ptr, scs_ptr);
             }
 
-            // PSNR and SSIM Calculation.
-            // Note: if temporal_filtering is used, memory needs to be freed in the last of these calls
-            if (scs_ptr->static_config.stat_report) {
-                psnr_calculations(pcs_ptr, scs_ptr, EB_FALSE);
-                ssim_calculations(pcs_ptr, scs_ptr, EB_TRUE /* free memory here */);
-            }
-
             // Pad the reference picture and set ref POC
             if (pcs_ptr->parent_pcs_ptr->is_used_as_reference_flag == EB_TRUE)
                 pad_ref_and_set_flags(pcs_ptr, scs_ptr);
+            // PSNR and SSIM Calculation, in the metrics processes, once the
+            // reference picture is not written anymore
+            if (scs_ptr->static_config.stat_report)
+                post_metrics_tasks(context_ptr, pcs_ptr, cdef_results_ptr->pcs_wrapper_ptr);
             if (scs_ptr->static_config.recon_enabled) {
                 recon_output(pcs_ptr, scs_ptr);
             }
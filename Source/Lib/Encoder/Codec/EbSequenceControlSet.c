@@ -281,6 +281,7 @@ EbErrorType copy_sequence_control_set(SequenceControlSet *dst, SequenceControlSe
     dst->enc_dec_process_init_count        = src->enc_dec_process_init_count;
     dst->entropy_coding_process_init_count = src->entropy_coding_process_init_count;
     dst->total_process_init_count          = src->total_process_init_count;
+    dst->core_count                        = src->core_count;
     dst->left_padding                      = src->left_padding;
     dst->right_padding                     = src->right_padding;
     dst->top_padding                       = src->top_padding;
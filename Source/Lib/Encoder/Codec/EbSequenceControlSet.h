@@ -168,6 +168,8 @@ typedef struct SequenceControlSet {
     uint32_t overlay_input_picture_buffer_init_count;
     uint32_t output_stream_buffer_fifo_init_count;
     uint32_t output_recon_buffer_fifo_init_count;
+    /*!< Estimated size of the picture buffer pools, set with max_memory_mb */
+    uint64_t picture_pools_size;
 
     /*!< Inter processes fifos count */
     uint32_t resource_coordination_fifo_init_count;
@@ -185,6 +187,7 @@ typedef struct SequenceControlSet {
     uint32_t dlf_fifo_init_count;
     uint32_t cdef_fifo_init_count;
     uint32_t rest_fifo_init_count;
+    uint32_t metrics_fifo_init_count;
 
     /*!< Thread count for each process */
     uint32_t picture_analysis_process_init_count;
@@ -196,8 +199,10 @@ typedef struct SequenceControlSet {
     uint32_t dlf_process_init_count;
     uint32_t cdef_process_init_count;
     uint32_t rest_process_init_count;
+    uint32_t metrics_process_init_count;
     uint32_t inlme_process_init_count;
     uint32_t total_process_init_count;
+    uint32_t core_count; // logical processors the processing threads are sized for
     int32_t  lap_enabled;
     TWO_PASS twopass;
     double   double_frame_rate;
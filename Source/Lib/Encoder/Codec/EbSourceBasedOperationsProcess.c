@@ -30,6 +30,7 @@ typedef struct SourceBasedOperationsContext {
     EbDctor dctor;
     EbFifo *initial_rate_control_results_input_fifo_ptr;
     EbFifo *picture_demux_results_output_fifo_ptr;
+    EbFifo *picture_decision_results_output_fifo_ptr;
     // local zz cost array
     uint32_t complete_sb_count;
     uint8_t *y_mean_ptr;
@@ -47,7 +48,8 @@ static void source_based_operations_context_dctor(EbPtr p) {
 * Source Based Operation Context Constructor
 ************************************************/
 EbErrorType source_based_operations_context_ctor(EbThreadContext *  thread_context_ptr,
-                                                 const EbEncHandle *enc_handle_ptr, int index) {
+                                                 const EbEncHandle *enc_handle_ptr, int index,
+                                                 int tpl_disp_index) {
     SourceBasedOperationsContext *context_ptr;
     EB_CALLOC_ARRAY(context_ptr, 1);
     thread_context_ptr->priv  = context_ptr;
@@ -58,6 +60,9 @@ EbErrorType source_based_operations_context_ctor(EbThreadContext *  thread_conte
             enc_handle_ptr->initial_rate_control_results_resource_ptr, index);
     context_ptr->picture_demux_results_output_fifo_ptr = svt_system_resource_get_producer_fifo(
         enc_handle_ptr->picture_demux_results_resource_ptr, index);
+    // The TPL dispenser SB rows are processed in the ME processes
+    context_ptr->picture_decision_results_output_fifo_ptr = svt_system_resource_get_producer_fifo(
+        enc_handle_ptr->picture_decision_results_resource_ptr, tpl_disp_index);
     return EB_ErrorNone;
 }
 
@@ -106,7 +111,7 @@ void derive_picture_activity_statistics(PictureParentControlSet *pcs_ptr)
 EbErrorType tpl_get_open_loop_me(PictureManagerContext *context_ptr, SequenceControlSet *scs_ptr,
                                  PictureParentControlSet *pcs_tpl_base_ptr);
 EbErrorType tpl_mc_flow(EncodeContext *encode_context_ptr, SequenceControlSet *scs_ptr,
-                        PictureParentControlSet *pcs_ptr);
+                        PictureParentControlSet *pcs_ptr, EbFifo *tpl_disp_fifo_ptr);
 /************************************************
  * Source Based Operations Kernel
  * Source-based operations process involves a number of analysis algorithms
@@ -140,13 +145,21 @@ void *source_based_operations_kernel(void *input_ptr) {
 
             if (/*scs_ptr->in_loop_me &&*/ scs_ptr->static_config.enable_tpl_la &&
                 pcs_ptr->temporal_layer_index == 0) {
-                tpl_mc_flow(scs_ptr->encode_context_ptr, scs_ptr, pcs_ptr);
+                tpl_mc_flow(scs_ptr->encode_context_ptr,
+                            scs_ptr,
+                            pcs_ptr,
+                            context_ptr->picture_decision_results_output_fifo_ptr);
             }
             //any picture not belonging to any TPL group should release its PA references
             if (pcs_ptr->num_tpl_grps == 0) {
                 release_pa_reference_objects(scs_ptr, pcs_ptr);
             }
         }
+        if (scs_ptr->encode_context_ptr->ladder)
+            svt_ladder_finish_picture(scs_ptr->encode_context_ptr->ladder,
+                                      scs_ptr->encode_context_ptr->ladder_role,
+                                      scs_ptr->encode_context_ptr->ladder_slot,
+                                      pcs_ptr->picture_number);
 
         /***********************************************SB-based operations************************************************************/
         for (sb_index = 0; sb_index < sb_total_count; ++sb_index) {
@@ -19,7 +19,8 @@
  * Extern Function Declaration
  ***************************************/
 EbErrorType source_based_operations_context_ctor(EbThreadContext *  thread_context_ptr,
-                                                 const EbEncHandle *enc_handle_ptr, int index);
+                                                 const EbEncHandle *enc_handle_ptr, int index,
+                                                 int tpl_disp_index);
 
 extern void *source_based_operations_kernel(void *input_ptr);
 
@@ -76,12 +76,21 @@
 #define SET_AVX2(ptr, c, avx2)                              SET_FUNCTIONS(ptr, c, 0, 0, 0, 0, 0, 0, 0, 0, avx2, 0)
 #define SET_AVX2_AVX512(ptr, c, avx2, avx512)               SET_FUNCTIONS(ptr, c, 0, 0, 0, 0, 0, 0, 0, 0, avx2, avx512)
 
+#ifdef ARCH_AARCH64
+/* Replaces the C function set by the SET_* macros above */
+#define SET_NEON(ptr, c, neon)                                                                    \
+    do {                                                                                          \
+        assert(ptr == c);                                                                         \
+        if (flags & HAS_NEON) ptr = neon;                                                         \
+    } while (0)
+#endif /* ARCH_AARCH64 */
+
 void setup_rtcd_internal(CPU_FLAGS flags) {
     /* Avoid check that pointer is set double, after first  setup. */
     static EbBool first_call_setup      = EB_TRUE;
     EbBool        check_pointer_was_set = first_call_setup;
     first_call_setup                    = EB_FALSE;
-#ifdef ARCH_X86_64
+#if defined(ARCH_X86_64) || defined(ARCH_AARCH64)
     /** Should be done during library initialization,
         but for safe limiting cpu flags again. */
     flags &= get_cpu_flags_to_use();
@@ -103,12 +112,12 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     SET_AVX2(svt_av1_calc_frame_error, svt_av1_calc_frame_error_c, svt_av1_calc_frame_error_avx2);
     SET_AVX2(svt_subtract_average, svt_subtract_average_c, svt_subtract_average_avx2);
     SET_AVX2(svt_get_proj_subspace, svt_get_proj_subspace_c, svt_get_proj_subspace_avx2);
-    SET_AVX2(svt_aom_quantize_b, svt_aom_quantize_b_c_ii, svt_aom_quantize_b_avx2);
-    SET_AVX2(svt_aom_highbd_quantize_b, svt_aom_highbd_quantize_b_c, svt_aom_highbd_quantize_b_avx2);
-    SET_AVX2(svt_av1_quantize_fp, svt_av1_quantize_fp_c, svt_av1_quantize_fp_avx2);
-    SET_AVX2(svt_av1_quantize_fp_32x32, svt_av1_quantize_fp_32x32_c, svt_av1_quantize_fp_32x32_avx2);
-    SET_AVX2(svt_av1_quantize_fp_64x64, svt_av1_quantize_fp_64x64_c, svt_av1_quantize_fp_64x64_avx2);
-    SET_AVX2(svt_av1_highbd_quantize_fp, svt_av1_highbd_quantize_fp_c, svt_av1_highbd_quantize_fp_avx2);
+    SET_AVX2_AVX512(svt_aom_quantize_b, svt_aom_quantize_b_c_ii, svt_aom_quantize_b_avx2, svt_aom_quantize_b_avx512);
+    SET_AVX2_AVX512(svt_aom_highbd_quantize_b, svt_aom_highbd_quantize_b_c, svt_aom_highbd_quantize_b_avx2, svt_aom_highbd_quantize_b_avx512);
+    SET_AVX2_AVX512(svt_av1_quantize_fp, svt_av1_quantize_fp_c, svt_av1_quantize_fp_avx2, svt_av1_quantize_fp_avx512);
+    SET_AVX2_AVX512(svt_av1_quantize_fp_32x32, svt_av1_quantize_fp_32x32_c, svt_av1_quantize_fp_32x32_avx2, svt_av1_quantize_fp_32x32_avx512);
+    SET_AVX2_AVX512(svt_av1_quantize_fp_64x64, svt_av1_quantize_fp_64x64_c, svt_av1_quantize_fp_64x64_avx2, svt_av1_quantize_fp_64x64_avx512);
+    SET_AVX2_AVX512(svt_av1_highbd_quantize_fp, svt_av1_highbd_quantize_fp_c, svt_av1_highbd_quantize_fp_avx2, svt_av1_highbd_quantize_fp_avx512);
     SET_SSE2(svt_aom_highbd_8_mse16x16, svt_aom_highbd_8_mse16x16_c, svt_aom_highbd_8_mse16x16_sse2);
 
     //SAD
@@ -178,12 +187,12 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     SET_AVX2(svt_aom_obmc_sad32x16, svt_aom_obmc_sad32x16_c, svt_aom_obmc_sad32x16_avx2);
     SET_AVX2(svt_aom_obmc_sad32x32, svt_aom_obmc_sad32x32_c, svt_aom_obmc_sad32x32_avx2);
     SET_AVX2(svt_aom_obmc_sad32x64, svt_aom_obmc_sad32x64_c, svt_aom_obmc_sad32x64_avx2);
-    SET_AVX2(svt_aom_obmc_sad64x16, svt_aom_obmc_sad64x16_c, svt_aom_obmc_sad64x16_avx2);
-    SET_AVX2(svt_aom_obmc_sad64x32, svt_aom_obmc_sad64x32_c, svt_aom_obmc_sad64x32_avx2);
-    SET_AVX2(svt_aom_obmc_sad64x64, svt_aom_obmc_sad64x64_c, svt_aom_obmc_sad64x64_avx2);
-    SET_AVX2(svt_aom_obmc_sad64x128, svt_aom_obmc_sad64x128_c, svt_aom_obmc_sad64x128_avx2);
-    SET_AVX2(svt_aom_obmc_sad128x64, svt_aom_obmc_sad128x64_c, svt_aom_obmc_sad128x64_avx2);
-    SET_AVX2(svt_aom_obmc_sad128x128, svt_aom_obmc_sad128x128_c, svt_aom_obmc_sad128x128_avx2);
+    SET_AVX2_AVX512(svt_aom_obmc_sad64x16, svt_aom_obmc_sad64x16_c, svt_aom_obmc_sad64x16_avx2, svt_aom_obmc_sad64x16_avx512);
+    SET_AVX2_AVX512(svt_aom_obmc_sad64x32, svt_aom_obmc_sad64x32_c, svt_aom_obmc_sad64x32_avx2, svt_aom_obmc_sad64x32_avx512);
+    SET_AVX2_AVX512(svt_aom_obmc_sad64x64, svt_aom_obmc_sad64x64_c, svt_aom_obmc_sad64x64_avx2, svt_aom_obmc_sad64x64_avx512);
+    SET_AVX2_AVX512(svt_aom_obmc_sad64x128, svt_aom_obmc_sad64x128_c, svt_aom_obmc_sad64x128_avx2, svt_aom_obmc_sad64x128_avx512);
+    SET_AVX2_AVX512(svt_aom_obmc_sad128x64, svt_aom_obmc_sad128x64_c, svt_aom_obmc_sad128x64_avx2, svt_aom_obmc_sad128x64_avx512);
+    SET_AVX2_AVX512(svt_aom_obmc_sad128x128, svt_aom_obmc_sad128x128_c, svt_aom_obmc_sad128x128_avx2, svt_aom_obmc_sad128x128_avx512);
 
     SET_SSE41(svt_aom_obmc_sub_pixel_variance4x4, svt_aom_obmc_sub_pixel_variance4x4_c, svt_aom_obmc_sub_pixel_variance4x4_sse4_1);
     SET_SSE41(svt_aom_obmc_sub_pixel_variance4x8, svt_aom_obmc_sub_pixel_variance4x8_c, svt_aom_obmc_sub_pixel_variance4x8_sse4_1);
@@ -224,12 +233,12 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     SET_AVX2(svt_aom_obmc_variance32x16, svt_aom_obmc_variance32x16_c, svt_aom_obmc_variance32x16_avx2);
     SET_AVX2(svt_aom_obmc_variance32x32, svt_aom_obmc_variance32x32_c, svt_aom_obmc_variance32x32_avx2);
     SET_AVX2(svt_aom_obmc_variance32x64, svt_aom_obmc_variance32x64_c, svt_aom_obmc_variance32x64_avx2);
-    SET_AVX2(svt_aom_obmc_variance64x16, svt_aom_obmc_variance64x16_c, svt_aom_obmc_variance64x16_avx2);
-    SET_AVX2(svt_aom_obmc_variance64x32, svt_aom_obmc_variance64x32_c, svt_aom_obmc_variance64x32_avx2);
-    SET_AVX2(svt_aom_obmc_variance64x64, svt_aom_obmc_variance64x64_c, svt_aom_obmc_variance64x64_avx2);
-    SET_AVX2(svt_aom_obmc_variance64x128, svt_aom_obmc_variance64x128_c, svt_aom_obmc_variance64x128_avx2);
-    SET_AVX2(svt_aom_obmc_variance128x64, svt_aom_obmc_variance128x64_c, svt_aom_obmc_variance128x64_avx2);
-    SET_AVX2(svt_aom_obmc_variance128x128, svt_aom_obmc_variance128x128_c, svt_aom_obmc_variance128x128_avx2);
+    SET_AVX2_AVX512(svt_aom_obmc_variance64x16, svt_aom_obmc_variance64x16_c, svt_aom_obmc_variance64x16_avx2, svt_aom_obmc_variance64x16_avx512);
+    SET_AVX2_AVX512(svt_aom_obmc_variance64x32, svt_aom_obmc_variance64x32_c, svt_aom_obmc_variance64x32_avx2, svt_aom_obmc_variance64x32_avx512);
+    SET_AVX2_AVX512(svt_aom_obmc_variance64x64, svt_aom_obmc_variance64x64_c, svt_aom_obmc_variance64x64_avx2, svt_aom_obmc_variance64x64_avx512);
+    SET_AVX2_AVX512(svt_aom_obmc_variance64x128, svt_aom_obmc_variance64x128_c, svt_aom_obmc_variance64x128_avx2, svt_aom_obmc_variance64x128_avx512);
+    SET_AVX2_AVX512(svt_aom_obmc_variance128x64, svt_aom_obmc_variance128x64_c, svt_aom_obmc_variance128x64_avx2, svt_aom_obmc_variance128x64_avx512);
+    SET_AVX2_AVX512(svt_aom_obmc_variance128x128, svt_aom_obmc_variance128x128_c, svt_aom_obmc_variance128x128_avx2, svt_aom_obmc_variance128x128_avx512);
 
     //VARIANCE
     SET_SSE2(svt_aom_variance4x4, svt_aom_variance4x4_c, svt_aom_variance4x4_sse2);
@@ -248,18 +257,18 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     SET_AVX2(svt_aom_variance32x16, svt_aom_variance32x16_c, svt_aom_variance32x16_avx2);
     SET_AVX2(svt_aom_variance32x32, svt_aom_variance32x32_c, svt_aom_variance32x32_avx2);
     SET_AVX2(svt_aom_variance32x64, svt_aom_variance32x64_c, svt_aom_variance32x64_avx2);
-    SET_AVX2(svt_aom_variance64x16, svt_aom_variance64x16_c, svt_aom_variance64x16_avx2);
-    SET_AVX2(svt_aom_variance64x32, svt_aom_variance64x32_c, svt_aom_variance64x32_avx2);
-    SET_AVX2(svt_aom_variance64x64, svt_aom_variance64x64_c, svt_aom_variance64x64_avx2);
-    SET_AVX2(svt_aom_variance64x128, svt_aom_variance64x128_c, svt_aom_variance64x128_avx2);
-    SET_AVX2(svt_aom_variance128x64, svt_aom_variance128x64_c, svt_aom_variance128x64_avx2);
-    SET_AVX2(svt_aom_variance128x128, svt_aom_variance128x128_c, svt_aom_variance128x128_avx2);
+    SET_AVX2_AVX512(svt_aom_variance64x16, svt_aom_variance64x16_c, svt_aom_variance64x16_avx2, svt_aom_variance64x16_avx512);
+    SET_AVX2_AVX512(svt_aom_variance64x32, svt_aom_variance64x32_c, svt_aom_variance64x32_avx2, svt_aom_variance64x32_avx512);
+    SET_AVX2_AVX512(svt_aom_variance64x64, svt_aom_variance64x64_c, svt_aom_variance64x64_avx2, svt_aom_variance64x64_avx512);
+    SET_AVX2_AVX512(svt_aom_variance64x128, svt_aom_variance64x128_c, svt_aom_variance64x128_avx2, svt_aom_variance64x128_avx512);
+    SET_AVX2_AVX512(svt_aom_variance128x64, svt_aom_variance128x64_c, svt_aom_variance128x64_avx2, svt_aom_variance128x64_avx512);
+    SET_AVX2_AVX512(svt_aom_variance128x128, svt_aom_variance128x128_c, svt_aom_variance128x128_avx2, svt_aom_variance128x128_avx512);
 
     //VARIANCEHBP
-    SET_ONLY_C(svt_aom_highbd_10_variance4x4, svt_aom_highbd_10_variance4x4_c);
-    SET_ONLY_C(svt_aom_highbd_10_variance4x8, svt_aom_highbd_10_variance4x8_c);
-    SET_ONLY_C(svt_aom_highbd_10_variance4x16, svt_aom_highbd_10_variance4x16_c);
-    SET_ONLY_C(svt_aom_highbd_10_variance8x4, svt_aom_highbd_10_variance8x4_c);
+    SET_SSE41_AVX2(svt_aom_highbd_10_variance4x4, svt_aom_highbd_10_variance4x4_c, svt_aom_highbd_10_variance4x4_sse4_1, svt_aom_highbd_10_variance4x4_avx2);
+    SET_SSE41_AVX2(svt_aom_highbd_10_variance4x8, svt_aom_highbd_10_variance4x8_c, svt_aom_highbd_10_variance4x8_sse4_1, svt_aom_highbd_10_variance4x8_avx2);
+    SET_SSE41_AVX2(svt_aom_highbd_10_variance4x16, svt_aom_highbd_10_variance4x16_c, svt_aom_highbd_10_variance4x16_sse4_1, svt_aom_highbd_10_variance4x16_avx2);
+    SET_SSE41_AVX2(svt_aom_highbd_10_variance8x4, svt_aom_highbd_10_variance8x4_c, svt_aom_highbd_10_variance8x4_sse4_1, svt_aom_highbd_10_variance8x4_avx2);
     SET_SSE2_AVX2(svt_aom_highbd_10_variance8x8, svt_aom_highbd_10_variance8x8_c, svt_aom_highbd_10_variance8x8_sse2, svt_aom_highbd_10_variance8x8_avx2);
     SET_SSE2_AVX2(svt_aom_highbd_10_variance8x16, svt_aom_highbd_10_variance8x16_c, svt_aom_highbd_10_variance8x16_sse2, svt_aom_highbd_10_variance8x16_avx2);
     SET_SSE2_AVX2(svt_aom_highbd_10_variance8x32, svt_aom_highbd_10_variance8x32_c, svt_aom_highbd_10_variance8x32_sse2, svt_aom_highbd_10_variance8x32_avx2);
@@ -362,6 +371,7 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     SET_SSE2(svt_av1_get_nz_map_contexts, svt_av1_get_nz_map_contexts_c, svt_av1_get_nz_map_contexts_sse2);
     SET_AVX2_AVX512(svt_search_one_dual, svt_search_one_dual_c, svt_search_one_dual_avx2, svt_search_one_dual_avx512);
     SET_SSE41_AVX2_AVX512(svt_sad_loop_kernel, svt_sad_loop_kernel_c, svt_sad_loop_kernel_sse4_1_intrin, svt_sad_loop_kernel_avx2_intrin, svt_sad_loop_kernel_avx512_intrin);
+    SET_AVX2_AVX512(svt_sad_loop_kernel_multi, svt_sad_loop_kernel_multi_c, svt_sad_loop_kernel_multi_avx2_intrin, svt_sad_loop_kernel_multi_avx512_intrin);
     SET_AVX2(svt_av1_apply_temporal_filter_planewise, svt_av1_apply_temporal_filter_planewise_c, svt_av1_apply_temporal_filter_planewise_avx2);
     SET_AVX2(svt_av1_apply_temporal_filter_planewise_hbd, svt_av1_apply_temporal_filter_planewise_hbd_c, svt_av1_apply_temporal_filter_planewise_hbd_avx2);
     SET_AVX2(svt_ext_sad_calculation_8x8_16x16, svt_ext_sad_calculation_8x8_16x16_c, svt_ext_sad_calculation_8x8_16x16_avx2_intrin);
@@ -376,11 +386,95 @@ void setup_rtcd_internal(CPU_FLAGS flags) {
     SET_SSE2_AVX2(svt_compute_interm_var_four8x8, svt_compute_interm_var_four8x8_c, svt_compute_interm_var_four8x8_helper_sse2, svt_compute_interm_var_four8x8_avx2_intrin);
     SET_AVX2(sad_16b_kernel, sad_16b_kernel_c, sad_16bit_kernel_avx2);
     SET_AVX2(svt_av1_compute_cross_correlation, svt_av1_compute_cross_correlation_c, svt_av1_compute_cross_correlation_avx2);
+    SET_AVX2(svt_av1_compute_cross_correlation_multi, svt_av1_compute_cross_correlation_multi_c, svt_av1_compute_cross_correlation_multi_avx2);
+    SET_AVX2(svt_av1_fast9_detect_row, svt_av1_fast9_detect_row_c, svt_av1_fast9_detect_row_avx2);
+    SET_AVX2(svt_av1_ransac_find_inliers, svt_av1_ransac_find_inliers_c, svt_av1_ransac_find_inliers_avx2);
+    SET_SSE2_AVX2(svt_aom_ssim_parms_8x8, svt_aom_ssim_parms_8x8_c, svt_aom_ssim_parms_8x8_sse2, svt_aom_ssim_parms_8x8_avx2);
+    SET_SSE2_AVX2(svt_aom_highbd_ssim_parms_8x8, svt_aom_highbd_ssim_parms_8x8_c, svt_aom_highbd_ssim_parms_8x8_sse2, svt_aom_highbd_ssim_parms_8x8_avx2);
     SET_AVX2(svt_av1_k_means_dim1, svt_av1_k_means_dim1_c, svt_av1_k_means_dim1_avx2);
     SET_AVX2(svt_av1_k_means_dim2, svt_av1_k_means_dim2_c, svt_av1_k_means_dim2_avx2);
     SET_AVX2(svt_av1_calc_indices_dim1, svt_av1_calc_indices_dim1_c, svt_av1_calc_indices_dim1_avx2);
     SET_AVX2(svt_av1_calc_indices_dim2, svt_av1_calc_indices_dim2_c, svt_av1_calc_indices_dim2_avx2);
     SET_AVX2(variance_highbd, variance_highbd_c, variance_highbd_avx2);
     SET_AVX2(svt_av1_haar_ac_sad_8x8_uint8_input, svt_av1_haar_ac_sad_8x8_uint8_input_c, svt_av1_haar_ac_sad_8x8_uint8_input_avx2);
+
+#ifdef ARCH_AARCH64
+    SET_NEON(svt_aom_sad4x4, svt_aom_sad4x4_c, svt_aom_sad4x4_neon);
+    SET_NEON(svt_aom_sad4x4x4d, svt_aom_sad4x4x4d_c, svt_aom_sad4x4x4d_neon);
+    SET_NEON(svt_aom_sad4x8, svt_aom_sad4x8_c, svt_aom_sad4x8_neon);
+    SET_NEON(svt_aom_sad4x8x4d, svt_aom_sad4x8x4d_c, svt_aom_sad4x8x4d_neon);
+    SET_NEON(svt_aom_sad4x16, svt_aom_sad4x16_c, svt_aom_sad4x16_neon);
+    SET_NEON(svt_aom_sad4x16x4d, svt_aom_sad4x16x4d_c, svt_aom_sad4x16x4d_neon);
+    SET_NEON(svt_aom_sad8x4, svt_aom_sad8x4_c, svt_aom_sad8x4_neon);
+    SET_NEON(svt_aom_sad8x4x4d, svt_aom_sad8x4x4d_c, svt_aom_sad8x4x4d_neon);
+    SET_NEON(svt_aom_sad8x8, svt_aom_sad8x8_c, svt_aom_sad8x8_neon);
+    SET_NEON(svt_aom_sad8x8x4d, svt_aom_sad8x8x4d_c, svt_aom_sad8x8x4d_neon);
+    SET_NEON(svt_aom_sad8x16, svt_aom_sad8x16_c, svt_aom_sad8x16_neon);
+    SET_NEON(svt_aom_sad8x16x4d, svt_aom_sad8x16x4d_c, svt_aom_sad8x16x4d_neon);
+    SET_NEON(svt_aom_sad8x32, svt_aom_sad8x32_c, svt_aom_sad8x32_neon);
+    SET_NEON(svt_aom_sad8x32x4d, svt_aom_sad8x32x4d_c, svt_aom_sad8x32x4d_neon);
+    SET_NEON(svt_aom_sad16x4, svt_aom_sad16x4_c, svt_aom_sad16x4_neon);
+    SET_NEON(svt_aom_sad16x4x4d, svt_aom_sad16x4x4d_c, svt_aom_sad16x4x4d_neon);
+    SET_NEON(svt_aom_sad16x8, svt_aom_sad16x8_c, svt_aom_sad16x8_neon);
+    SET_NEON(svt_aom_sad16x8x4d, svt_aom_sad16x8x4d_c, svt_aom_sad16x8x4d_neon);
+    SET_NEON(svt_aom_sad16x16, svt_aom_sad16x16_c, svt_aom_sad16x16_neon);
+    SET_NEON(svt_aom_sad16x16x4d, svt_aom_sad16x16x4d_c, svt_aom_sad16x16x4d_neon);
+    SET_NEON(svt_aom_sad16x32, svt_aom_sad16x32_c, svt_aom_sad16x32_neon);
+    SET_NEON(svt_aom_sad16x32x4d, svt_aom_sad16x32x4d_c, svt_aom_sad16x32x4d_neon);
+    SET_NEON(svt_aom_sad16x64, svt_aom_sad16x64_c, svt_aom_sad16x64_neon);
+    SET_NEON(svt_aom_sad16x64x4d, svt_aom_sad16x64x4d_c, svt_aom_sad16x64x4d_neon);
+    SET_NEON(svt_aom_sad32x8, svt_aom_sad32x8_c, svt_aom_sad32x8_neon);
+    SET_NEON(svt_aom_sad32x8x4d, svt_aom_sad32x8x4d_c, svt_aom_sad32x8x4d_neon);
+    SET_NEON(svt_aom_sad32x16, svt_aom_sad32x16_c, svt_aom_sad32x16_neon);
+    SET_NEON(svt_aom_sad32x16x4d, svt_aom_sad32x16x4d_c, svt_aom_sad32x16x4d_neon);
+    SET_NEON(svt_aom_sad32x32, svt_aom_sad32x32_c, svt_aom_sad32x32_neon);
+    SET_NEON(svt_aom_sad32x32x4d, svt_aom_sad32x32x4d_c, svt_aom_sad32x32x4d_neon);
+    SET_NEON(svt_aom_sad32x64, svt_aom_sad32x64_c, svt_aom_sad32x64_neon);
+    SET_NEON(svt_aom_sad32x64x4d, svt_aom_sad32x64x4d_c, svt_aom_sad32x64x4d_neon);
+    SET_NEON(svt_aom_sad64x16, svt_aom_sad64x16_c, svt_aom_sad64x16_neon);
+    SET_NEON(svt_aom_sad64x16x4d, svt_aom_sad64x16x4d_c, svt_aom_sad64x16x4d_neon);
+    SET_NEON(svt_aom_sad64x32, svt_aom_sad64x32_c, svt_aom_sad64x32_neon);
+    SET_NEON(svt_aom_sad64x32x4d, svt_aom_sad64x32x4d_c, svt_aom_sad64x32x4d_neon);
+    SET_NEON(svt_aom_sad64x64, svt_aom_sad64x64_c, svt_aom_sad64x64_neon);
+    SET_NEON(svt_aom_sad64x64x4d, svt_aom_sad64x64x4d_c, svt_aom_sad64x64x4d_neon);
+    SET_NEON(svt_aom_sad64x128, svt_aom_sad64x128_c, svt_aom_sad64x128_neon);
+    SET_NEON(svt_aom_sad64x128x4d, svt_aom_sad64x128x4d_c, svt_aom_sad64x128x4d_neon);
+    SET_NEON(svt_aom_sad128x64, svt_aom_sad128x64_c, svt_aom_sad128x64_neon);
+    SET_NEON(svt_aom_sad128x64x4d, svt_aom_sad128x64x4d_c, svt_aom_sad128x64x4d_neon);
+    SET_NEON(svt_aom_sad128x128, svt_aom_sad128x128_c, svt_aom_sad128x128_neon);
+    SET_NEON(svt_aom_sad128x128x4d, svt_aom_sad128x128x4d_c, svt_aom_sad128x128x4d_neon);
+    SET_NEON(svt_aom_variance4x4, svt_aom_variance4x4_c, svt_aom_variance4x4_neon);
+    SET_NEON(svt_aom_variance4x8, svt_aom_variance4x8_c, svt_aom_variance4x8_neon);
+    SET_NEON(svt_aom_variance4x16, svt_aom_variance4x16_c, svt_aom_variance4x16_neon);
+    SET_NEON(svt_aom_variance8x4, svt_aom_variance8x4_c, svt_aom_variance8x4_neon);
+    SET_NEON(svt_aom_variance8x8, svt_aom_variance8x8_c, svt_aom_variance8x8_neon);
+    SET_NEON(svt_aom_variance8x16, svt_aom_variance8x16_c, svt_aom_variance8x16_neon);
+    SET_NEON(svt_aom_variance8x32, svt_aom_variance8x32_c, svt_aom_variance8x32_neon);
+    SET_NEON(svt_aom_variance16x4, svt_aom_variance16x4_c, svt_aom_variance16x4_neon);
+    SET_NEON(svt_aom_variance16x8, svt_aom_variance16x8_c, svt_aom_variance16x8_neon);
+    SET_NEON(svt_aom_variance16x16, svt_aom_variance16x16_c, svt_aom_variance16x16_neon);
+    SET_NEON(svt_aom_variance16x32, svt_aom_variance16x32_c, svt_aom_variance16x32_neon);
+    SET_NEON(svt_aom_variance16x64, svt_aom_variance16x64_c, svt_aom_variance16x64_neon);
+    SET_NEON(svt_aom_variance32x8, svt_aom_variance32x8_c, svt_aom_variance32x8_neon);
+    SET_NEON(svt_aom_variance32x16, svt_aom_variance32x16_c, svt_aom_variance32x16_neon);
+    SET_NEON(svt_aom_variance32x32, svt_aom_variance32x32_c, svt_aom_variance32x32_neon);
+    SET_NEON(svt_aom_variance32x64, svt_aom_variance32x64_c, svt_aom_variance32x64_neon);
+    SET_NEON(svt_aom_variance64x16, svt_aom_variance64x16_c, svt_aom_variance64x16_neon);
+    SET_NEON(svt_aom_variance64x32, svt_aom_variance64x32_c, svt_aom_variance64x32_neon);
+    SET_NEON(svt_aom_variance64x64, svt_aom_variance64x64_c, svt_aom_variance64x64_neon);
+    SET_NEON(svt_aom_variance64x128, svt_aom_variance64x128_c, svt_aom_variance64x128_neon);
+    SET_NEON(svt_aom_variance128x64, svt_aom_variance128x64_c, svt_aom_variance128x64_neon);
+    SET_NEON(svt_aom_variance128x128, svt_aom_variance128x128_c, svt_aom_variance128x128_neon);
+    SET_NEON(svt_aom_mse16x16, svt_aom_mse16x16_c, svt_aom_mse16x16_neon);
+    SET_NEON(svt_av1_quantize_fp, svt_av1_quantize_fp_c, svt_av1_quantize_fp_neon);
+    SET_NEON(svt_av1_quantize_fp_32x32, svt_av1_quantize_fp_32x32_c, svt_av1_quantize_fp_32x32_neon);
+    SET_NEON(svt_av1_quantize_fp_64x64, svt_av1_quantize_fp_64x64_c, svt_av1_quantize_fp_64x64_neon);
+    SET_NEON(svt_aom_satd, svt_aom_satd_c, svt_aom_satd_neon);
+    SET_NEON(svt_av1_block_error, svt_av1_block_error_c, svt_av1_block_error_neon);
+    SET_NEON(svt_sad_loop_kernel, svt_sad_loop_kernel_c, svt_sad_loop_kernel_neon);
+    SET_NEON(svt_sad_loop_kernel_multi, svt_sad_loop_kernel_multi_c, svt_sad_loop_kernel_multi_neon);
+    SET_NEON(svt_nxm_sad_kernel_sub_sampled, svt_nxm_sad_kernel_helper_c, svt_nxm_sad_kernel_helper_neon);
+    SET_NEON(svt_nxm_sad_kernel, svt_nxm_sad_kernel_helper_c, svt_nxm_sad_kernel_helper_neon);
+#endif
 }
 // clang-format on
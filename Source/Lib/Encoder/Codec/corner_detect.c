@@ -13,20 +13,85 @@
 #include "fast.h"
 
 #include "corner_detect.h"
+#include "aom_dsp_rtcd.h"
+
+/* Find the FAST-9 corners at threshold b among the width pixels starting at
+   src. The offsets of the corners within the row are written to corner_x[] and
+   their strengths to strength[], and their number is returned. The strength is
+   the largest t such that 9 contiguous pixels of the circle are all brighter
+   than the center by t or more, or all darker by t or more, so a pixel is a
+   corner when its strength is above b and its FAST score is strength - 1.
+*/
+int svt_av1_fast9_detect_row_c(const uint8_t *src, int stride, int width, int b, int *corner_x,
+                               uint8_t *strength) {
+    const uint8_t *const im          = src - 3 * stride - 3;
+    int                  num_corners = 0;
+    // The fastfeat detector run on the 7 rows around this one only tests this one.
+    xy *const  corners = svt_aom_fast9_detect(im, width + 6, 7, stride, b, &num_corners);
+    int *const scores  = corners ? svt_aom_fast9_score(im, stride, corners, num_corners, b) : NULL;
+    if (!scores)
+        num_corners = 0;
+    for (int i = 0; i < num_corners; i++) {
+        corner_x[i] = corners[i].x - 3;
+        strength[i] = (uint8_t)(scores[i] + 1);
+    }
+    free(corners);
+    free(scores);
+    return num_corners;
+}
 
 // Fast_9 wrapper
 #define FAST_BARRIER 18
 int svt_av1_fast_corner_detect(unsigned char *buf, int width, int height, int stride, int *points,
                                int max_points) {
-    int       num_points;
-    xy *const frm_corners_xy = svt_aom_fast9_detect_nonmax(
-        buf, width, height, stride, FAST_BARRIER, &num_points);
-    num_points = (num_points <= max_points ? num_points : max_points);
-    if (num_points > 0 && frm_corners_xy) {
-        svt_memcpy(points, frm_corners_xy, sizeof(*frm_corners_xy) * num_points);
-        free(frm_corners_xy);
-        return num_points;
+    int      num_points   = 0;
+    int      num_corners  = 0;
+    int      rsize        = 512;
+    xy *     corners      = (xy *)malloc(sizeof(*corners) * rsize);
+    int *    scores       = (int *)malloc(sizeof(*scores) * rsize);
+    int *    row_x        = (int *)malloc(sizeof(*row_x) * width);
+    uint8_t *row_strength = (uint8_t *)malloc(sizeof(*row_strength) * width);
+    xy *     nonmax       = NULL;
+
+    if (!corners || !scores || !row_x || !row_strength)
+        goto done;
+
+    // Corners are gathered in raster order, as svt_aom_nonmax_suppression() expects.
+    for (int y = 3; y < height - 3 && width > 6; y++) {
+        const int num_row = svt_av1_fast9_detect_row(
+            buf + y * stride + 3, stride, width - 6, FAST_BARRIER, row_x, row_strength);
+        if (num_corners + num_row > rsize) {
+            while (num_corners + num_row > rsize) rsize *= 2;
+            xy * temp_corners = (xy *)realloc(corners, sizeof(*corners) * rsize);
+            int *temp_scores  = (int *)realloc(scores, sizeof(*scores) * rsize);
+            if (temp_corners)
+                corners = temp_corners;
+            if (temp_scores)
+                scores = temp_scores;
+            if (!temp_corners || !temp_scores) {
+                num_corners = 0;
+                goto done;
+            }
+        }
+        for (int i = 0; i < num_row; i++) {
+            corners[num_corners].x = row_x[i] + 3;
+            corners[num_corners].y = y;
+            scores[num_corners++]  = row_strength[i] - 1;
+        }
     }
-    free(frm_corners_xy);
-    return 0;
+
+    nonmax     = svt_aom_nonmax_suppression(corners, scores, num_corners, &num_points);
+    num_points = (num_points <= max_points ? num_points : max_points);
+    if (num_points > 0 && nonmax)
+        svt_memcpy(points, nonmax, sizeof(*nonmax) * num_points);
+    else
+        num_points = 0;
+
+done:
+    free(nonmax);
+    free(corners);
+    free(scores);
+    free(row_x);
+    free(row_strength);
+    return num_points;
 }
@@ -63,6 +63,19 @@ double svt_av1_compute_cross_correlation_c(unsigned char *im1, int stride1, int
     return cov / sqrt((double)var2);
 }
 
+/* Compute the cross correlation of the window of im1 centered at (x1, y1)
+   with the windows of im2 centered at each of the num_points (x, y) pairs of
+   points2, as svt_av1_compute_cross_correlation() does for a single pair.
+*/
+void svt_av1_compute_cross_correlation_multi_c(unsigned char *im1, int stride1, int x1, int y1,
+                                               unsigned char *im2, int stride2,
+                                               const int *points2, int num_points,
+                                               double *corr) {
+    for (int i = 0; i < num_points; ++i)
+        corr[i] = svt_av1_compute_cross_correlation_c(
+            im1, stride1, x1, y1, im2, stride2, points2[2 * i], points2[2 * i + 1]);
+}
+
 static INLINE int is_eligible_point(int pointx, int pointy, int width, int height) {
     return (pointx >= MATCH_SZ_BY2 && pointy >= MATCH_SZ_BY2 && pointx + MATCH_SZ_BY2 < width &&
             pointy + MATCH_SZ_BY2 < height);
@@ -75,18 +88,32 @@ static INLINE int is_eligible_distance(int point1x, int point1y, int point2x, in
     return (xdist * xdist + ydist * ydist) <= threshSqr;
 }
 
+// Keeps the first best candidate, as the one at a time search did.
+static INLINE int find_best_match(const double *match_ncc, int num, double *best_match_ncc) {
+    int best = -1;
+    for (int k = 0; k < num; ++k) {
+        if (match_ncc[k] > *best_match_ncc) {
+            *best_match_ncc = match_ncc[k];
+            best            = k;
+        }
+    }
+    return best;
+}
+
 static void improve_correspondence(unsigned char *frm, unsigned char *ref, int width, int height,
                                    int frm_stride, int ref_stride, Correspondence *correspondences,
                                    int num_correspondences) {
     int       i;
     const int thresh    = (width < height ? height : width) >> 4;
     const int threshSqr = thresh * thresh;
+    int       points[2 * SEARCH_SZ * SEARCH_SZ];
+    int       offsets[2 * SEARCH_SZ * SEARCH_SZ];
+    double    match_ncc[SEARCH_SZ * SEARCH_SZ];
     for (i = 0; i < num_correspondences; ++i) {
-        int    x, y, best_x = 0, best_y = 0;
+        int    x, y, num = 0, best;
         double best_match_ncc = 0.0;
         for (y = -SEARCH_SZ_BY2; y <= SEARCH_SZ_BY2; ++y) {
             for (x = -SEARCH_SZ_BY2; x <= SEARCH_SZ_BY2; ++x) {
-                double match_ncc;
                 if (!is_eligible_point(
                         correspondences[i].rx + x, correspondences[i].ry + y, width, height))
                     continue;
@@ -96,30 +123,33 @@ static void improve_correspondence(unsigned char *frm, unsigned char *ref, int w
                                           correspondences[i].ry + y,
                                           threshSqr))
                     continue;
-                match_ncc = svt_av1_compute_cross_correlation(frm,
-                                                              frm_stride,
-                                                              correspondences[i].x,
-                                                              correspondences[i].y,
-                                                              ref,
-                                                              ref_stride,
-                                                              correspondences[i].rx + x,
-                                                              correspondences[i].ry + y);
-                if (match_ncc > best_match_ncc) {
-                    best_match_ncc = match_ncc;
-                    best_y         = y;
-                    best_x         = x;
-                }
+                points[2 * num]      = correspondences[i].rx + x;
+                points[2 * num + 1]  = correspondences[i].ry + y;
+                offsets[2 * num]     = x;
+                offsets[2 * num + 1] = y;
+                num++;
             }
         }
-        correspondences[i].rx += best_x;
-        correspondences[i].ry += best_y;
+        svt_av1_compute_cross_correlation_multi(frm,
+                                                frm_stride,
+                                                correspondences[i].x,
+                                                correspondences[i].y,
+                                                ref,
+                                                ref_stride,
+                                                points,
+                                                num,
+                                                match_ncc);
+        best = find_best_match(match_ncc, num, &best_match_ncc);
+        if (best >= 0) {
+            correspondences[i].rx += offsets[2 * best];
+            correspondences[i].ry += offsets[2 * best + 1];
+        }
     }
     for (i = 0; i < num_correspondences; ++i) {
-        int    x, y, best_x = 0, best_y = 0;
+        int    x, y, num = 0, best;
         double best_match_ncc = 0.0;
         for (y = -SEARCH_SZ_BY2; y <= SEARCH_SZ_BY2; ++y)
             for (x = -SEARCH_SZ_BY2; x <= SEARCH_SZ_BY2; ++x) {
-                double match_ncc;
                 if (!is_eligible_point(
                         correspondences[i].x + x, correspondences[i].y + y, width, height))
                     continue;
@@ -129,22 +159,26 @@ static void improve_correspondence(unsigned char *frm, unsigned char *ref, int w
                                           correspondences[i].ry,
                                           threshSqr))
                     continue;
-                match_ncc = svt_av1_compute_cross_correlation(ref,
-                                                              ref_stride,
-                                                              correspondences[i].rx,
-                                                              correspondences[i].ry,
-                                                              frm,
-                                                              frm_stride,
-                                                              correspondences[i].x + x,
-                                                              correspondences[i].y + y);
-                if (match_ncc > best_match_ncc) {
-                    best_match_ncc = match_ncc;
-                    best_y         = y;
-                    best_x         = x;
-                }
+                points[2 * num]      = correspondences[i].x + x;
+                points[2 * num + 1]  = correspondences[i].y + y;
+                offsets[2 * num]     = x;
+                offsets[2 * num + 1] = y;
+                num++;
             }
-        correspondences[i].x += best_x;
-        correspondences[i].y += best_y;
+        svt_av1_compute_cross_correlation_multi(ref,
+                                                ref_stride,
+                                                correspondences[i].rx,
+                                                correspondences[i].ry,
+                                                frm,
+                                                frm_stride,
+                                                points,
+                                                num,
+                                                match_ncc);
+        best = find_best_match(match_ncc, num, &best_match_ncc);
+        if (best >= 0) {
+            correspondences[i].x += offsets[2 * best];
+            correspondences[i].y += offsets[2 * best + 1];
+        }
     }
 }
 
@@ -155,37 +189,58 @@ int svt_av1_determine_correspondence(unsigned char *frm, int *frm_corners, int n
     int             i, j;
     Correspondence *correspondences     = (Correspondence *)correspondence_pts;
     int             num_correspondences = 0;
+    int             num_eligible_ref    = 0;
     const int       thresh              = (width < height ? height : width) >> 4;
     const int       threshSqr           = thresh * thresh;
+
+    // The ref corners which pass the distance check of a frm corner are
+    // gathered and correlated against it in a single batch.
+    int *const    eligible_ref = (int *)malloc(sizeof(*eligible_ref) * 2 * num_ref_corners);
+    int *const    points       = (int *)malloc(sizeof(*points) * 2 * num_ref_corners);
+    double *const match_ncc    = (double *)malloc(sizeof(*match_ncc) * num_ref_corners);
+    if (!eligible_ref || !points || !match_ncc) {
+        free(eligible_ref);
+        free(points);
+        free(match_ncc);
+        return 0;
+    }
+
+    for (j = 0; j < num_ref_corners; ++j) {
+        if (!is_eligible_point(ref_corners[2 * j], ref_corners[2 * j + 1], width, height))
+            continue;
+        eligible_ref[2 * num_eligible_ref]     = ref_corners[2 * j];
+        eligible_ref[2 * num_eligible_ref + 1] = ref_corners[2 * j + 1];
+        num_eligible_ref++;
+    }
+
     for (i = 0; i < num_frm_corners; ++i) {
         double best_match_ncc = 0.0;
         double template_norm;
-        int    best_match_j = -1;
+        int    best_match_j;
+        int    num = 0;
         if (!is_eligible_point(frm_corners[2 * i], frm_corners[2 * i + 1], width, height))
             continue;
-        for (j = 0; j < num_ref_corners; ++j) {
-            double match_ncc;
-            if (!is_eligible_point(ref_corners[2 * j], ref_corners[2 * j + 1], width, height))
-                continue;
+        for (j = 0; j < num_eligible_ref; ++j) {
             if (!is_eligible_distance(frm_corners[2 * i],
                                       frm_corners[2 * i + 1],
-                                      ref_corners[2 * j],
-                                      ref_corners[2 * j + 1],
+                                      eligible_ref[2 * j],
+                                      eligible_ref[2 * j + 1],
                                       threshSqr))
                 continue;
-            match_ncc = svt_av1_compute_cross_correlation(frm,
-                                                          frm_stride,
-                                                          frm_corners[2 * i],
-                                                          frm_corners[2 * i + 1],
-                                                          ref,
-                                                          ref_stride,
-                                                          ref_corners[2 * j],
-                                                          ref_corners[2 * j + 1]);
-            if (match_ncc > best_match_ncc) {
-                best_match_ncc = match_ncc;
-                best_match_j   = j;
-            }
+            points[2 * num]     = eligible_ref[2 * j];
+            points[2 * num + 1] = eligible_ref[2 * j + 1];
+            num++;
         }
+        svt_av1_compute_cross_correlation_multi(frm,
+                                                frm_stride,
+                                                frm_corners[2 * i],
+                                                frm_corners[2 * i + 1],
+                                                ref,
+                                                ref_stride,
+                                                points,
+                                                num,
+                                                match_ncc);
+        best_match_j = find_best_match(match_ncc, num, &best_match_ncc);
         // Note: We want to test if the best correlation is >= THRESHOLD_NCC,
         // but need to account for the normalization in
         // av1_compute_cross_correlation.
@@ -194,8 +249,8 @@ int svt_av1_determine_correspondence(unsigned char *frm, int *frm_corners, int n
         if (best_match_ncc > THRESHOLD_NCC * sqrt(template_norm)) {
             correspondences[num_correspondences].x  = frm_corners[2 * i];
             correspondences[num_correspondences].y  = frm_corners[2 * i + 1];
-            correspondences[num_correspondences].rx = ref_corners[2 * best_match_j];
-            correspondences[num_correspondences].ry = ref_corners[2 * best_match_j + 1];
+            correspondences[num_correspondences].rx = points[2 * best_match_j];
+            correspondences[num_correspondences].ry = points[2 * best_match_j + 1];
 
             /*SVT_LOG("corresp: %d %d - %d %d\n",
              correspondences[num_correspondences].x,
@@ -206,6 +261,9 @@ int svt_av1_determine_correspondence(unsigned char *frm, int *frm_corners, int n
             num_correspondences++;
         }
     }
+    free(eligible_ref);
+    free(points);
+    free(match_ncc);
     improve_correspondence(
         frm, ref, width, height, frm_stride, ref_stride, correspondences, num_correspondences);
     return num_correspondences;
@@ -17,6 +17,7 @@
 #include "mathutils.h"
 #include "random.h"
 #include "common_dsp_rtcd.h"
+#include "aom_dsp_rtcd.h"
 #define MAX_MINPTS 4
 #define MAX_DEGENERATE_ITER 10
 #define MINPTS_MULTIPLIER 5
@@ -28,43 +29,30 @@
 // ransac
 typedef int (*IsDegenerateFunc)(double *p);
 typedef int (*FindTransformationFunc)(int points, double *points1, double *points2, double *params);
-typedef void (*ProjectPointsDoubleFunc)(double *mat, double *points, double *proj, int n,
-                                        int stride_points, int stride_proj);
-
-static void project_points_double_translation(double *mat, double *points, double *proj, int n,
-                                              int stride_points, int stride_proj) {
-    int i;
-    for (i = 0; i < n; ++i) {
-        const double x = *(points++), y = *(points++);
-        *(proj++) = x + mat[0];
-        *(proj++) = y + mat[1];
-        points += stride_points - 2;
-        proj += stride_proj - 2;
-    }
-}
-
-static void project_points_double_rotzoom(double *mat, double *points, double *proj, int n,
-                                          int stride_points, int stride_proj) {
-    int i;
-    for (i = 0; i < n; ++i) {
-        const double x = *(points++), y = *(points++);
-        *(proj++) = mat[2] * x + mat[3] * y + mat[0];
-        *(proj++) = -mat[3] * x + mat[2] * y + mat[1];
-        points += stride_points - 2;
-        proj += stride_proj - 2;
-    }
-}
 
-static void project_points_double_affine(double *mat, double *points, double *proj, int n,
-                                         int stride_points, int stride_proj) {
-    int i;
-    for (i = 0; i < n; ++i) {
-        const double x = *(points++), y = *(points++);
-        *(proj++) = mat[2] * x + mat[3] * y + mat[0];
-        *(proj++) = mat[4] * x + mat[5] * y + mat[1];
-        points += stride_points - 2;
-        proj += stride_proj - 2;
+// Project corners1 by the affine model mat (translation and rotzoom models are
+// stored in the same form) and gather the indices of the points which land
+// within threshold of corners2, with the sum and the sum of squares of their
+// distances accumulated in index order.
+int svt_av1_ransac_find_inliers_c(const double *mat, const double *corners1,
+                                  const double *corners2, int npoints, double threshold,
+                                  int *inlier_indices, double *sum_distance,
+                                  double *sum_distance_squared) {
+    int num_inliers = 0;
+    for (int i = 0; i < npoints; ++i) {
+        const double x        = corners1[i * 2];
+        const double y        = corners1[i * 2 + 1];
+        const double dx       = mat[2] * x + mat[3] * y + mat[0] - corners2[i * 2];
+        const double dy       = mat[4] * x + mat[5] * y + mat[1] - corners2[i * 2 + 1];
+        const double distance = sqrt(dx * dx + dy * dy);
+
+        if (distance < threshold) {
+            inlier_indices[num_inliers++] = i;
+            *sum_distance += distance;
+            *sum_distance_squared += distance * distance;
+        }
     }
+    return num_inliers;
 }
 
 static void normalize_homography(double *pts, int n, double *T) {
@@ -358,8 +346,7 @@ static void clear_motion(RANSAC_MOTION *motion, int num_points) {
 
 static int ransac(const int *matched_points, int npoints, int *num_inliers_by_motion,
                   MotionModel *params_by_motion, int num_desired_motions, int minpts,
-                  IsDegenerateFunc is_degenerate, FindTransformationFunc find_transformation,
-                  ProjectPointsDoubleFunc projectpoints) {
+                  IsDegenerateFunc is_degenerate, FindTransformationFunc find_transformation) {
     int trial_count = 0;
     int ret_val     = 0;
 
@@ -369,7 +356,6 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
 
     double *points1, *points2;
     double *corners1, *corners2;
-    double *image1_coord;
 
     // Store information for the num_desired_motions best transformations found
     // and the worst motion among them, as well as the motion currently under
@@ -388,11 +374,10 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
     if (npoints < minpts * MINPTS_MULTIPLIER || npoints == 0)
         return 1;
 
-    points1      = (double *)malloc(sizeof(*points1) * npoints * 2);
-    points2      = (double *)malloc(sizeof(*points2) * npoints * 2);
-    corners1     = (double *)malloc(sizeof(*corners1) * npoints * 2);
-    corners2     = (double *)malloc(sizeof(*corners2) * npoints * 2);
-    image1_coord = (double *)malloc(sizeof(*image1_coord) * npoints * 2);
+    points1  = (double *)malloc(sizeof(*points1) * npoints * 2);
+    points2  = (double *)malloc(sizeof(*points2) * npoints * 2);
+    corners1 = (double *)malloc(sizeof(*corners1) * npoints * 2);
+    corners2 = (double *)malloc(sizeof(*corners2) * npoints * 2);
 
     motions = (RANSAC_MOTION *)malloc(sizeof(RANSAC_MOTION) * num_desired_motions);
     assert(motions != NULL);
@@ -405,8 +390,7 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
 
     worst_kept_motion = motions;
 
-    if (!(points1 && points2 && corners1 && corners2 && image1_coord && motions &&
-          current_motion.inlier_indices)) {
+    if (!(points1 && points2 && corners1 && corners2 && motions && current_motion.inlier_indices)) {
         ret_val = 1;
         goto finish_ransac;
     }
@@ -451,19 +435,14 @@ static int ransac(const int *matched_points, int npoints, int *num_inliers_by_mo
             continue;
         }
 
-        projectpoints(params_this_motion, corners1, image1_coord, npoints, 2, 2);
-
-        for (int i = 0; i < npoints; ++i) {
-            double dx       = image1_coord[i * 2] - corners2[i * 2];
-            double dy       = image1_coord[i * 2 + 1] - corners2[i * 2 + 1];
-            double distance = sqrt(dx * dx + dy * dy);
-
-            if (distance < INLIER_THRESHOLD) {
-                current_motion.inlier_indices[current_motion.num_inliers++] = i;
-                sum_distance += distance;
-                sum_distance_squared += distance * distance;
-            }
-        }
+        current_motion.num_inliers = svt_av1_ransac_find_inliers(params_this_motion,
+                                                                 corners1,
+                                                                 corners2,
+                                                                 npoints,
+                                                                 INLIER_THRESHOLD,
+                                                                 current_motion.inlier_indices,
+                                                                 &sum_distance,
+                                                                 &sum_distance_squared);
 
         if (current_motion.num_inliers >= worst_kept_motion->num_inliers &&
             current_motion.num_inliers > 1) {
@@ -531,7 +510,6 @@ finish_ransac:
     free(points2);
     free(corners1);
     free(corners2);
-    free(image1_coord);
     free(current_motion.inlier_indices);
     if (motions) {
         for (int i = 0; i < num_desired_motions; ++i) free(motions[i].inlier_indices);
@@ -543,9 +521,8 @@ finish_ransac:
 
 static int ransac_double_prec(const double *matched_points, int npoints, int *num_inliers_by_motion,
                               MotionModel *params_by_motion, int num_desired_motions, int minpts,
-                              IsDegenerateFunc        is_degenerate,
-                              FindTransformationFunc  find_transformation,
-                              ProjectPointsDoubleFunc projectpoints) {
+                              IsDegenerateFunc       is_degenerate,
+                              FindTransformationFunc find_transformation) {
     int trial_count = 0;
     int ret_val     = 0;
 
@@ -555,7 +532,6 @@ static int ransac_double_prec(const double *matched_points, int npoints, int *nu
 
     double *points1, *points2;
     double *corners1, *corners2;
-    double *image1_coord;
 
     // Store information for the num_desired_motions best transformations found
     // and the worst motion among them, as well as the motion currently under
@@ -574,11 +550,10 @@ static int ransac_double_prec(const double *matched_points, int npoints, int *nu
     if (npoints < minpts * MINPTS_MULTIPLIER || npoints == 0)
         return 1;
 
-    points1      = (double *)malloc(sizeof(*points1) * npoints * 2);
-    points2      = (double *)malloc(sizeof(*points2) * npoints * 2);
-    corners1     = (double *)malloc(sizeof(*corners1) * npoints * 2);
-    corners2     = (double *)malloc(sizeof(*corners2) * npoints * 2);
-    image1_coord = (double *)malloc(sizeof(*image1_coord) * npoints * 2);
+    points1  = (double *)malloc(sizeof(*points1) * npoints * 2);
+    points2  = (double *)malloc(sizeof(*points2) * npoints * 2);
+    corners1 = (double *)malloc(sizeof(*corners1) * npoints * 2);
+    corners2 = (double *)malloc(sizeof(*corners2) * npoints * 2);
 
     motions = (RANSAC_MOTION *)malloc(sizeof(RANSAC_MOTION) * num_desired_motions);
     assert(motions != NULL);
@@ -591,8 +566,7 @@ static int ransac_double_prec(const double *matched_points, int npoints, int *nu
 
     worst_kept_motion = motions;
 
-    if (!(points1 && points2 && corners1 && corners2 && image1_coord && motions &&
-          current_motion.inlier_indices)) {
+    if (!(points1 && points2 && corners1 && corners2 && motions && current_motion.inlier_indices)) {
         ret_val = 1;
         goto finish_ransac;
     }
@@ -637,19 +611,14 @@ static int ransac_double_prec(const double *matched_points, int npoints, int *nu
             continue;
         }
 
-        projectpoints(params_this_motion, corners1, image1_coord, npoints, 2, 2);
-
-        for (int i = 0; i < npoints; ++i) {
-            double dx       = image1_coord[i * 2] - corners2[i * 2];
-            double dy       = image1_coord[i * 2 + 1] - corners2[i * 2 + 1];
-            double distance = sqrt(dx * dx + dy * dy);
-
-            if (distance < INLIER_THRESHOLD) {
-                current_motion.inlier_indices[current_motion.num_inliers++] = i;
-                sum_distance += distance;
-                sum_distance_squared += distance * distance;
-            }
-        }
+        current_motion.num_inliers = svt_av1_ransac_find_inliers(params_this_motion,
+                                                                 corners1,
+                                                                 corners2,
+                                                                 npoints,
+                                                                 INLIER_THRESHOLD,
+                                                                 current_motion.inlier_indices,
+                                                                 &sum_distance,
+                                                                 &sum_distance_squared);
 
         if (current_motion.num_inliers >= worst_kept_motion->num_inliers &&
             current_motion.num_inliers > 1) {
@@ -715,7 +684,6 @@ finish_ransac:
     free(points2);
     free(corners1);
     free(corners2);
-    free(image1_coord);
     free(current_motion.inlier_indices);
     if (motions) {
         for (int i = 0; i < num_desired_motions; ++i) free(motions[i].inlier_indices);
@@ -746,8 +714,7 @@ static int ransac_translation(int *matched_points, int npoints, int *num_inliers
                   num_desired_motions,
                   3,
                   is_degenerate_translation,
-                  find_translation,
-                  project_points_double_translation);
+                  find_translation);
 }
 
 static int ransac_rotzoom(int *matched_points, int npoints, int *num_inliers_by_motion,
@@ -759,8 +726,7 @@ static int ransac_rotzoom(int *matched_points, int npoints, int *num_inliers_by_
                   num_desired_motions,
                   3,
                   is_degenerate_affine,
-                  find_rotzoom,
-                  project_points_double_rotzoom);
+                  find_rotzoom);
 }
 
 static int ransac_affine(int *matched_points, int npoints, int *num_inliers_by_motion,
@@ -772,8 +738,7 @@ static int ransac_affine(int *matched_points, int npoints, int *num_inliers_by_m
                   num_desired_motions,
                   3,
                   is_degenerate_affine,
-                  find_affine,
-                  project_points_double_affine);
+                  find_affine);
 }
 
 RansacFunc svt_av1_get_ransac_type(TransformationType type) {
@@ -795,8 +760,7 @@ static int ransac_translation_double_prec(double *matched_points, int npoints,
                               num_desired_motions,
                               3,
                               is_degenerate_translation,
-                              find_translation,
-                              project_points_double_translation);
+                              find_translation);
 }
 
 static int ransac_rotzoom_double_prec(double *matched_points, int npoints,
@@ -809,8 +773,7 @@ static int ransac_rotzoom_double_prec(double *matched_points, int npoints,
                               num_desired_motions,
                               3,
                               is_degenerate_affine,
-                              find_rotzoom,
-                              project_points_double_rotzoom);
+                              find_rotzoom);
 }
 
 static int ransac_affine_double_prec(double *matched_points, int npoints,
@@ -823,8 +786,7 @@ static int ransac_affine_double_prec(double *matched_points, int npoints,
                               num_desired_motions,
                               3,
                               is_degenerate_affine,
-                              find_affine,
-                              project_points_double_affine);
+                              find_affine);
 }
 
 RansacFuncDouble svt_av1_get_ransac_double_prec_type(TransformationType type) {
@@ -21,6 +21,8 @@
 
 #include "EbVersion.h"
 #include "EbThreads.h"
+#include "EbNuma.h"
+#include "EbProfiler.h"
 #include "EbUtility.h"
 #include "EbEncHandle.h"
 #include "EbPictureControlSet.h"
@@ -52,6 +54,7 @@
 #include "EbRestProcess.h"
 #include "EbCdefProcess.h"
 #include "EbDlfProcess.h"
+#include "EbMetricsProcess.h"
 #include "EbRateControlResults.h"
 #ifdef ARCH_X86_64
 #include <immintrin.h>
@@ -130,7 +133,8 @@ static const char *get_asm_level_name_str(CPU_FLAGS cpu_flags) {
         {"sse4_2",  CPU_FLAGS_SSE4_2},
         {"avx",     CPU_FLAGS_AVX},
         {"avx2",    CPU_FLAGS_AVX2},
-        {"avx512",  CPU_FLAGS_AVX512F}
+        {"avx512",  CPU_FLAGS_AVX512F},
+        {"neon",    CPU_FLAGS_NEON}
     };
     const uint32_t para_map_size = sizeof(param_maps) / sizeof(param_maps[0]);
     int32_t i;
@@ -287,6 +291,203 @@ void svt_set_thread_management_parameters(EbSvtAv1EncConfiguration *config_ptr)
 #endif
 }
 
+/* Names of the pipeline stages in the profile */
+static const char *const pipeline_stage_names[NUMA_STAGE_COUNT] = {
+    "resource_coordination",
+    "picture_analysis",
+    "picture_decision",
+    "motion_estimation",
+    "initial_rate_control",
+    "source_based_operations",
+    "picture_manager",
+    "inloop_me",
+    "rate_control",
+    "mode_decision_configuration",
+    "enc_dec",
+    "dlf",
+    "cdef",
+    "rest",
+    "metrics",
+    "entropy_coding",
+    "packetization",
+};
+
+/**************************************
+ * NUMA placement
+ **************************************/
+static void get_stage_thread_counts(const SequenceControlSet *scs_ptr, uint32_t *counts) {
+    counts[NUMA_STAGE_RESOURCE_COORDINATION]       = 1;
+    counts[NUMA_STAGE_PICTURE_ANALYSIS]            = scs_ptr->picture_analysis_process_init_count;
+    counts[NUMA_STAGE_PICTURE_DECISION]            = 1;
+    counts[NUMA_STAGE_MOTION_ESTIMATION]           = scs_ptr->motion_estimation_process_init_count;
+    counts[NUMA_STAGE_INITIAL_RATE_CONTROL]        = 1;
+    counts[NUMA_STAGE_SOURCE_BASED_OPERATIONS]     = scs_ptr->source_based_operations_process_init_count;
+    counts[NUMA_STAGE_PICTURE_MANAGER]             = 1;
+    counts[NUMA_STAGE_INLOOP_ME]                   = scs_ptr->inlme_process_init_count;
+    counts[NUMA_STAGE_RATE_CONTROL]                = 1;
+    counts[NUMA_STAGE_MODE_DECISION_CONFIGURATION] = scs_ptr->mode_decision_configuration_process_init_count;
+    counts[NUMA_STAGE_ENC_DEC]                     = scs_ptr->enc_dec_process_init_count;
+    counts[NUMA_STAGE_DLF]                         = scs_ptr->dlf_process_init_count;
+    counts[NUMA_STAGE_CDEF]                        = scs_ptr->cdef_process_init_count;
+    counts[NUMA_STAGE_REST]                        = scs_ptr->rest_process_init_count;
+    counts[NUMA_STAGE_METRICS]                     = scs_ptr->metrics_process_init_count;
+    counts[NUMA_STAGE_ENTROPY_CODING]              = scs_ptr->entropy_coding_process_init_count;
+    counts[NUMA_STAGE_PACKETIZATION]               = 1;
+}
+
+/* Assigns a NUMA node to each pipeline stage. With numa_policy 2 the stages
+ * are cut, in pipeline order, into one run per node with about the same
+ * number of threads, so that most of the pictures handed from a stage to the
+ * next one stay on the same node. */
+static void numa_assign_stages(EbEncHandle *enc_handle_ptr) {
+    const EbSvtAv1EncConfiguration *config_ptr = &enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config;
+    uint32_t counts[NUMA_STAGE_COUNT];
+    uint32_t total_count = 0;
+    get_stage_thread_counts(enc_handle_ptr->scs_instance_array[0]->scs_ptr, counts);
+    for (int stage = 0; stage < NUMA_STAGE_COUNT; stage++)
+        total_count += counts[stage];
+
+    const uint32_t num_nodes = svt_numa_node_count();
+    uint32_t threads_before = 0;
+    for (int stage = 0; stage < NUMA_STAGE_COUNT; stage++) {
+        enc_handle_ptr->numa_stage_node[stage] = config_ptr->numa_policy == 1 ?
+            (uint32_t)config_ptr->numa_node :
+            (threads_before + counts[stage] / 2) * num_nodes / total_count;
+        threads_before += counts[stage];
+    }
+}
+
+/* Places the memory first touched from now on by the calling thread on the
+ * node of stage, and counts the threads of the stage on the node when threads
+ * is set. */
+static void numa_place_stage(EbEncHandle *enc_handle_ptr, NumaStage stage, EbBool threads) {
+    const SequenceControlSet *scs_ptr = enc_handle_ptr->scs_instance_array[0]->scs_ptr;
+    if (scs_ptr->static_config.numa_policy == 0)
+        return;
+    const uint32_t node = enc_handle_ptr->numa_stage_node[stage];
+    if (scs_ptr->static_config.numa_policy == 2)
+        svt_numa_prefer_node(node);
+    if (!threads)
+        return;
+    uint32_t counts[NUMA_STAGE_COUNT];
+    get_stage_thread_counts(scs_ptr, counts);
+    if (node < SVT_AV1_MAX_NUMA_NODES)
+        enc_handle_ptr->numa_threads[node] += counts[stage];
+}
+
+/* Runs the count threads of stage on the logical processors of its node, the
+ * logical_processors limit being shared between the nodes in use. The
+ * affinity is set on the threads only, so that encoders initialized at the
+ * same time do not see each other's placement. */
+static void numa_pin_stage_threads(const EbEncHandle *enc_handle_ptr, NumaStage stage,
+                                   EbHandle *threads, uint32_t count) {
+    const SequenceControlSet *scs_ptr = enc_handle_ptr->scs_instance_array[0]->scs_ptr;
+    if (scs_ptr->static_config.numa_policy == 0)
+        return;
+#if defined(__linux__)
+    const uint32_t node     = enc_handle_ptr->numa_stage_node[stage];
+    uint32_t       num_cpus = svt_numa_node_cpus(node, NULL, 0);
+    uint32_t       max_cpus = scs_ptr->static_config.logical_processors;
+    if (max_cpus && scs_ptr->static_config.numa_policy == 2) {
+        const uint32_t num_nodes = svt_numa_node_count();
+        max_cpus = (max_cpus + num_nodes - 1) / num_nodes;
+    }
+    if (max_cpus && max_cpus < num_cpus)
+        num_cpus = max_cpus;
+    if (num_cpus == 0)
+        return;
+    uint32_t *cpus = (uint32_t *)malloc(num_cpus * sizeof(*cpus));
+    if (!cpus)
+        return;
+    const uint32_t filled = svt_numa_node_cpus(node, cpus, num_cpus);
+    if (filled < num_cpus)
+        num_cpus = filled;
+    cpu_set_t affinity;
+    CPU_ZERO(&affinity);
+    for (uint32_t i = 0; i < num_cpus; i++) {
+        if (cpus[i] < CPU_SETSIZE)
+            CPU_SET(cpus[i], &affinity);
+    }
+    free(cpus);
+    if (CPU_COUNT(&affinity) == 0)
+        return;
+    for (uint32_t i = 0; i < count; i++) {
+        if (threads[i])
+            pthread_setaffinity_np(*((pthread_t *)threads[i]), sizeof(cpu_set_t), &affinity);
+    }
+#else
+    UNUSED(enc_handle_ptr);
+    UNUSED(stage);
+    UNUSED(threads);
+    UNUSED(count);
+#endif
+}
+
+/* Counts the pages of a picture buffer on each NUMA node */
+static void count_picture_pages(const EbPictureBufferDesc *pic, SvtAv1MemoryLocality *locality,
+                                uint64_t *other_pages) {
+    if (!pic)
+        return;
+    const uint32_t bytes_per_pixel = pic->bit_depth == EB_8BIT ||
+        (pic->bit_depth > EB_8BIT && pic->buffer_bit_inc_y) ? 1 : 2;
+    const size_t luma_size   = (size_t)pic->luma_size * bytes_per_pixel;
+    const size_t chroma_size = (size_t)pic->chroma_size * bytes_per_pixel;
+    const EbByte buffers[6]  = {pic->buffer_y, pic->buffer_cb, pic->buffer_cr,
+        pic->buffer_bit_inc_y, pic->buffer_bit_inc_cb, pic->buffer_bit_inc_cr};
+    for (int i = 0; i < 6; i++)
+        svt_numa_count_pages(buffers[i], i % 3 ? chroma_size : luma_size, locality->pages,
+            SVT_AV1_MAX_NUMA_NODES, other_pages, &locality->unplaced_pages);
+}
+
+/* Fills locality with the placement of the threads and of the pages of the
+ * input, reference and PA reference picture pools */
+static void get_memory_locality(EbEncHandle *enc_handle_ptr, SvtAv1MemoryLocality *locality) {
+    const EbSvtAv1EncConfiguration *config_ptr = &enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config;
+    uint64_t other_pages = 0;
+    memset(locality, 0, sizeof(*locality));
+    locality->num_nodes   = svt_numa_node_count();
+    locality->numa_policy = config_ptr->numa_policy;
+    for (int node = 0; node < SVT_AV1_MAX_NUMA_NODES; node++)
+        locality->threads[node] = enc_handle_ptr->numa_threads[node];
+
+    EbSystemResource *input_pool = enc_handle_ptr->input_buffer_resource_ptr;
+    if (!config_ptr->zero_copy_input) {
+        for (uint32_t i = 0; i < input_pool->object_total_count; i++) {
+            EbBufferHeaderType *header = (EbBufferHeaderType *)input_pool->wrapper_ptr_pool[i]->object_ptr;
+            count_picture_pages((EbPictureBufferDesc *)header->p_buffer, locality, &other_pages);
+        }
+    }
+    for (uint32_t instance_index = 0; instance_index < enc_handle_ptr->encode_instance_total_count; instance_index++) {
+        EbSystemResource *ref_pool = enc_handle_ptr->reference_picture_pool_ptr_array[instance_index];
+        for (uint32_t i = 0; i < ref_pool->object_total_count; i++) {
+            EbReferenceObject *ref = (EbReferenceObject *)ref_pool->wrapper_ptr_pool[i]->object_ptr;
+            count_picture_pages(ref->reference_picture, locality, &other_pages);
+            count_picture_pages(ref->reference_picture16bit, locality, &other_pages);
+        }
+        EbSystemResource *pa_ref_pool = enc_handle_ptr->pa_reference_picture_pool_ptr_array[instance_index];
+        for (uint32_t i = 0; i < pa_ref_pool->object_total_count; i++) {
+            EbPaReferenceObject *pa_ref = (EbPaReferenceObject *)pa_ref_pool->wrapper_ptr_pool[i]->object_ptr;
+            count_picture_pages(pa_ref->input_padded_picture_ptr, locality, &other_pages);
+            count_picture_pages(pa_ref->quarter_decimated_picture_ptr, locality, &other_pages);
+            count_picture_pages(pa_ref->sixteenth_decimated_picture_ptr, locality, &other_pages);
+            count_picture_pages(pa_ref->quarter_filtered_picture_ptr, locality, &other_pages);
+            count_picture_pages(pa_ref->sixteenth_filtered_picture_ptr, locality, &other_pages);
+        }
+    }
+
+    // Without placement, the threads may run on any node
+    EbBool node_in_use[SVT_AV1_MAX_NUMA_NODES];
+    for (int node = 0; node < SVT_AV1_MAX_NUMA_NODES; node++)
+        node_in_use[node] = config_ptr->numa_policy == 0 || locality->threads[node] != 0;
+    for (int node = 0; node < SVT_AV1_MAX_NUMA_NODES; node++) {
+        if (node_in_use[node])
+            locality->local_pages += locality->pages[node];
+        else
+            locality->remote_pages += locality->pages[node];
+    }
+    locality->remote_pages += other_pages;
+}
+
 void asm_set_convolve_asm_table(void);
 void asm_set_convolve_hbd_asm_table(void);
 void init_intra_dc_predictors_c_internal(void);
@@ -360,6 +561,74 @@ int32_t set_parent_pcs(EbSvtAv1EncConfiguration*   config, uint32_t core_count,
         return -1;
     }
 }
+/*
+* Fits the picture buffer pools in the max_memory_mb budget. The size of the
+* pictures is estimated from the picture dimensions and the pools above their
+* minimum count are reduced in proportion until the estimate fits the budget.
+*/
+static void set_picture_pools_memory_budget(SequenceControlSet *scs_ptr, uint32_t min_input,
+    uint32_t min_parent, uint32_t min_me, uint32_t min_paref, uint32_t min_ref, uint32_t min_overlay) {
+    const uint64_t budget = (uint64_t)scs_ptr->static_config.max_memory_mb << 20;
+    const uint64_t width = scs_ptr->max_input_luma_width;
+    const uint64_t height = scs_ptr->max_input_luma_height;
+    const uint64_t sb_count = ((width + 63) / 64) * ((height + 63) / 64);
+    const uint64_t mb_count = ((width + 15) / 16) * ((height + 15) / 16);
+    const uint32_t bytes_per_sample = scs_ptr->static_config.encoder_bit_depth > EB_8BIT ? 2 : 1;
+    const EbColorFormat color_format = scs_ptr->static_config.encoder_color_format;
+    const uint32_t chroma_shift = color_format == EB_YUV444 ? 0 : color_format == EB_YUV422 ? 1 : 2;
+    const uint64_t input_luma = (width + scs_ptr->left_padding + scs_ptr->right_padding) *
+        (height + scs_ptr->top_padding + scs_ptr->bot_padding);
+    const uint64_t pa_luma = (width + 2 * (scs_ptr->sb_sz + ME_FILTER_TAP)) *
+        (height + 2 * (scs_ptr->sb_sz + ME_FILTER_TAP));
+    const uint64_t ref_luma = (width + 2 * PAD_VALUE) * (height + 2 * PAD_VALUE);
+
+    uint32_t *count[] = {
+        &scs_ptr->input_buffer_fifo_init_count,
+        &scs_ptr->picture_control_set_pool_init_count,
+        &scs_ptr->me_pool_init_count,
+        &scs_ptr->pa_reference_picture_buffer_init_count,
+        &scs_ptr->reference_picture_buffer_init_count,
+        &scs_ptr->overlay_input_picture_buffer_init_count };
+    const uint32_t min_count[] = { min_input, min_parent, min_me, min_paref, min_ref, min_overlay };
+    const uint64_t size[] = {
+        // Input picture
+        (input_luma + 2 * (input_luma >> chroma_shift)) * bytes_per_sample,
+        // Parent PCS: ME variance and mean, TPL stats
+        sb_count * MAX_ME_PU_COUNT * (sizeof(uint16_t) + sizeof(uint8_t)) +
+            (scs_ptr->static_config.enable_tpl_la ?
+                mb_count * (4 * sizeof(TplStats) + sizeof(OisMbResults)) : 0),
+        // ME results
+        sb_count * SQUARE_PU_COUNT *
+            (MAX_PA_ME_MV * sizeof(MvCandidate) + MAX_PA_ME_CAND * sizeof(MeCandidate)),
+        // PA reference: full, quarter and sixteenth luma
+        pa_luma + (pa_luma >> 2) + (pa_luma >> 4),
+        // Reference picture
+        (ref_luma + 2 * (ref_luma >> chroma_shift)) * bytes_per_sample,
+        // Overlay input picture
+        (input_luma + 2 * (input_luma >> chroma_shift)) * bytes_per_sample };
+    uint64_t total_size = 0;
+    uint64_t min_total_size = 0;
+
+    for (int i = 0; i < (int)(sizeof(min_count) / sizeof(min_count[0])); i++) {
+        total_size += size[i] * *count[i];
+        min_total_size += size[i] * MIN(min_count[i], *count[i]);
+    }
+    scs_ptr->picture_pools_size = total_size;
+    if (total_size <= budget)
+        return;
+    if (min_total_size >= budget)
+        SVT_WARN("MaxMemory %u MB is below the %u MB needed by the picture buffers, the minimum buffer counts are used\n",
+            scs_ptr->static_config.max_memory_mb, (uint32_t)((min_total_size + (1 << 20) - 1) >> 20));
+    scs_ptr->picture_pools_size = 0;
+    for (int i = 0; i < (int)(sizeof(min_count) / sizeof(min_count[0])); i++) {
+        if (*count[i] > min_count[i])
+            *count[i] = min_count[i] + (min_total_size >= budget ? 0 :
+                (uint32_t)((*count[i] - min_count[i]) * (budget - min_total_size) / (total_size - min_total_size)));
+        scs_ptr->picture_pools_size += size[i] * *count[i];
+    }
+    scs_ptr->output_recon_buffer_fifo_init_count = scs_ptr->reference_picture_buffer_init_count;
+}
+
 EbErrorType load_default_buffer_configuration_settings(
     SequenceControlSet       *scs_ptr){
     EbErrorType           return_error = EB_ErrorNone;
@@ -368,6 +637,14 @@ EbErrorType load_default_buffer_configuration_settings(
 #if defined(_WIN32) || defined(__linux__)
     if (scs_ptr->static_config.target_socket != -1)
         core_count /= num_groups;
+#endif
+#if defined(__linux__)
+    // An encoder pinned to a NUMA node runs on the logical processors of the node
+    if (scs_ptr->static_config.numa_policy == 1) {
+        const uint32_t node_lp_count = svt_numa_node_cpus((uint32_t)scs_ptr->static_config.numa_node, NULL, 0);
+        if (node_lp_count)
+            core_count = node_lp_count;
+    }
 #endif
     if (scs_ptr->static_config.logical_processors != 0)
         core_count = scs_ptr->static_config.logical_processors < core_count ?
@@ -386,6 +663,7 @@ EbErrorType load_default_buffer_configuration_settings(
         scs_ptr->static_config.logical_processors > lp_count / num_groups)
         core_count = lp_count;
 #endif
+    scs_ptr->core_count = core_count;
     int32_t return_ppcs = set_parent_pcs(&scs_ptr->static_config,
         core_count, scs_ptr->input_resolution);
     if (return_ppcs == -1)
@@ -599,8 +877,11 @@ EbErrorType load_default_buffer_configuration_settings(
             scs_ptr->me_pool_init_count = MAX(min_me, scs_ptr->picture_control_set_pool_init_count);
         }
     }
+    if (scs_ptr->static_config.max_memory_mb)
+        set_picture_pools_memory_budget(scs_ptr, min_input, min_parent, min_me, min_paref, min_ref, min_overlay);
 
     //#====================== Inter process Fifos ======================
+    // The fifos start with one object per producer and consumer process and grow on demand up to the counts below
     scs_ptr->resource_coordination_fifo_init_count       = 300;
     scs_ptr->picture_analysis_fifo_init_count            = 300;
     scs_ptr->picture_decision_fifo_init_count            = 300;
@@ -617,6 +898,7 @@ EbErrorType load_default_buffer_configuration_settings(
     scs_ptr->dlf_fifo_init_count                         = 300;
     scs_ptr->cdef_fifo_init_count                        = 300;
     scs_ptr->rest_fifo_init_count                        = 300;
+    scs_ptr->metrics_fifo_init_count                     = 300;
     //#====================== Processes number ======================
     scs_ptr->total_process_init_count                    = 0;
     if (core_count > 1){
@@ -631,6 +913,7 @@ EbErrorType load_default_buffer_configuration_settings(
         scs_ptr->total_process_init_count += (scs_ptr->dlf_process_init_count                         = MAX(MIN(40, core_count >> 1), core_count));
         scs_ptr->total_process_init_count += (scs_ptr->cdef_process_init_count                        = MAX(MIN(40, core_count >> 1), core_count));
         scs_ptr->total_process_init_count += (scs_ptr->rest_process_init_count                        = MAX(MIN(40, core_count >> 1), core_count));
+        scs_ptr->total_process_init_count += (scs_ptr->metrics_process_init_count                     = scs_ptr->static_config.stat_report ? MAX(MIN(8, core_count >> 2), 1) : 0);
         if (core_count < (CONS_CORE_COUNT >> 2)) {
 
             scs_ptr->total_process_init_count += (scs_ptr->motion_estimation_process_init_count = MAX(core_count, MAX(MIN(20, core_count >> 1), core_count / 3)));
@@ -646,6 +929,7 @@ EbErrorType load_default_buffer_configuration_settings(
         scs_ptr->total_process_init_count += (scs_ptr->dlf_process_init_count                         = 1);
         scs_ptr->total_process_init_count += (scs_ptr->cdef_process_init_count                        = 1);
         scs_ptr->total_process_init_count += (scs_ptr->rest_process_init_count                        = 1);
+        scs_ptr->total_process_init_count += (scs_ptr->metrics_process_init_count                     = scs_ptr->static_config.stat_report ? 1 : 0);
     }
 
     scs_ptr->total_process_init_count += 6; // single processes count
@@ -654,7 +938,7 @@ EbErrorType load_default_buffer_configuration_settings(
     /******************************************************************
     * Platform detection, limit cpu flags to hardware available CPU
     ******************************************************************/
-#ifdef ARCH_X86_64
+#if defined(ARCH_X86_64) || defined(ARCH_AARCH64)
     const CPU_FLAGS cpu_flags = get_cpu_flags();
     const CPU_FLAGS cpu_flags_to_use = get_cpu_flags_to_use();
     scs_ptr->static_config.use_cpu_flags &= cpu_flags_to_use;
@@ -781,6 +1065,9 @@ static void svt_enc_handle_stop_threads(EbEncHandle *enc_handle_ptr)
     // Rest Process
     EB_DESTROY_THREAD_ARRAY(enc_handle_ptr->rest_thread_handle_array, control_set_ptr->rest_process_init_count);
 
+    // Metrics Process
+    EB_DESTROY_THREAD_ARRAY(enc_handle_ptr->metrics_thread_handle_array, control_set_ptr->metrics_process_init_count);
+
     // Entropy Coding Process
     EB_DESTROY_THREAD_ARRAY(enc_handle_ptr->entropy_coding_thread_handle_array, control_set_ptr->entropy_coding_process_init_count);
 
@@ -795,6 +1082,17 @@ static void svt_enc_handle_dctor(EbPtr p)
     EbEncHandle *enc_handle_ptr = (EbEncHandle *)p;
 
     svt_enc_handle_stop_threads(enc_handle_ptr);
+    if (enc_handle_ptr->worker_group)
+        svt_destroy_worker_group(enc_handle_ptr->worker_group);
+    if (enc_handle_ptr->worker_pool)
+        svt_destroy_worker_pool(enc_handle_ptr->worker_pool);
+    if (enc_handle_ptr->shared_context) {
+        SvtAv1EncContext *context = enc_handle_ptr->shared_context;
+        svt_block_on_mutex(context->mutex);
+        context->handle_count--;
+        svt_release_mutex(context->mutex);
+    }
+    EB_DELETE(enc_handle_ptr->profiler);
     EB_FREE_PTR_ARRAY(enc_handle_ptr->app_callback_ptr_array, enc_handle_ptr->encode_instance_total_count);
     EB_DELETE(enc_handle_ptr->scs_pool_ptr);
     EB_DELETE_PTR_ARRAY(enc_handle_ptr->picture_parent_control_set_pool_ptr_array, enc_handle_ptr->encode_instance_total_count);
@@ -820,6 +1118,7 @@ static void svt_enc_handle_dctor(EbPtr p)
     EB_DELETE(enc_handle_ptr->dlf_results_resource_ptr);
     EB_DELETE(enc_handle_ptr->cdef_results_resource_ptr);
     EB_DELETE(enc_handle_ptr->rest_results_resource_ptr);
+    EB_DELETE(enc_handle_ptr->metrics_tasks_resource_ptr);
     EB_DELETE(enc_handle_ptr->entropy_coding_results_resource_ptr);
 
     EB_DELETE(enc_handle_ptr->resource_coordination_context_ptr);
@@ -832,6 +1131,7 @@ static void svt_enc_handle_dctor(EbPtr p)
     EB_DELETE_PTR_ARRAY(enc_handle_ptr->dlf_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->dlf_process_init_count);
     EB_DELETE_PTR_ARRAY(enc_handle_ptr->cdef_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->cdef_process_init_count);
     EB_DELETE_PTR_ARRAY(enc_handle_ptr->rest_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->rest_process_init_count);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->metrics_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->metrics_process_init_count);
     EB_DELETE_PTR_ARRAY(enc_handle_ptr->entropy_coding_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->entropy_coding_process_init_count);
     EB_DELETE_PTR_ARRAY(enc_handle_ptr->scs_instance_array, enc_handle_ptr->encode_instance_total_count);
     EB_DELETE(enc_handle_ptr->picture_decision_context_ptr);
@@ -875,6 +1175,10 @@ EbErrorType svt_input_buffer_header_creator(
     EbPtr *object_dbl_ptr,
     EbPtr  object_init_data_ptr);
 
+EbErrorType svt_zero_copy_input_buffer_header_creator(
+    EbPtr *object_dbl_ptr,
+    EbPtr  object_init_data_ptr);
+
 EbErrorType svt_output_recon_buffer_header_creator(
     EbPtr *object_dbl_ptr,
     EbPtr  object_init_data_ptr);
@@ -884,6 +1188,7 @@ EbErrorType svt_output_buffer_header_creator(
     EbPtr object_init_data_ptr);
 
 void svt_input_buffer_header_destroyer(    EbPtr p);
+void svt_zero_copy_input_buffer_header_destroyer(    EbPtr p);
 void svt_output_recon_buffer_header_destroyer(    EbPtr p);
 void svt_output_buffer_header_destroyer(    EbPtr p);
 
@@ -957,6 +1262,29 @@ EbErrorType rest_results_creator(
     return EB_ErrorNone;
 }
 
+EbErrorType metrics_tasks_ctor(
+    MetricsTasks *context_ptr,
+    EbPtr object_init_data_ptr)
+{
+    (void)context_ptr;
+    (void)object_init_data_ptr;
+
+    return EB_ErrorNone;
+}
+
+EbErrorType metrics_tasks_creator(
+    EbPtr *object_dbl_ptr,
+    EbPtr object_init_data_ptr)
+{
+    MetricsTasks* obj;
+
+    *object_dbl_ptr = NULL;
+    EB_NEW(obj, metrics_tasks_ctor, object_init_data_ptr);
+    *object_dbl_ptr = obj;
+
+    return EB_ErrorNone;
+}
+
 static int create_down_scaled_buf_descs(EbEncHandle *enc_handle_ptr, uint32_t instance_index)
 {
     SequenceControlSet* scs_ptr = enc_handle_ptr->scs_instance_array[instance_index]->scs_ptr;
@@ -1127,22 +1455,13 @@ static int create_ref_buf_descs(EbEncHandle *enc_handle_ptr, uint32_t instance_i
 void init_fn_ptr(void);
 void svt_av1_init_wedge_masks(void);
 /**********************************
-* Initialize Encoder Library
+* Set up the CPU dispatch and the static
+* tables, shared by all the encoders
 **********************************/
-EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
+static void init_encoder_tables(CPU_FLAGS use_cpu_flags)
 {
-    if(svt_enc_component == NULL)
-        return EB_ErrorBadParameter;
-    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
-    EbErrorType return_error = EB_ErrorNone;
-    uint32_t instance_index;
-    uint32_t process_index;
-    uint32_t max_picture_width;
-    EbColorFormat color_format = enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.encoder_color_format;
-    SequenceControlSet* control_set_ptr;
-
-    setup_common_rtcd_internal(enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.use_cpu_flags);
-    setup_rtcd_internal(enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.use_cpu_flags);
+    setup_common_rtcd_internal(use_cpu_flags);
+    setup_rtcd_internal(use_cpu_flags);
 
     asm_set_convolve_asm_table();
 
@@ -1151,14 +1470,71 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     asm_set_convolve_hbd_asm_table();
 
     init_intra_predictors_internal();
-    EbSequenceControlSetInitData scs_init;
-    scs_init.sb_size = enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.super_block_size;
-
-    build_blk_geom(scs_init.sb_size == 128);
 
     svt_av1_init_me_luts();
     init_fn_ptr();
     svt_av1_init_wedge_masks();
+}
+/**********************************
+* Attach the handle to its shared context
+*
+* The tables are set up by the context, the
+* block geometry, which depends on the super
+* block size, by the first handle attached
+**********************************/
+static EbErrorType attach_shared_context(EbEncHandle *enc_handle_ptr, SvtAv1EncContext *context, uint16_t sb_size)
+{
+    EbErrorType return_error = EB_ErrorNone;
+    svt_block_on_mutex(context->mutex);
+    if (context->handle_count && context->sb_size != sb_size) {
+        SVT_ERROR("The handles attached to a shared context must use the same super block size: %u != %u\n",
+            sb_size, context->sb_size);
+        return_error = EB_ErrorBadParameter;
+    } else {
+        if (context->handle_count == 0) {
+            build_blk_geom(sb_size == 128);
+            context->sb_size = sb_size;
+        }
+        context->handle_count++;
+        enc_handle_ptr->shared_context = context;
+    }
+    svt_release_mutex(context->mutex);
+    return return_error;
+}
+/**********************************
+* Build the Encoder Pipeline
+**********************************/
+static EbErrorType init_encoder(EbEncHandle *enc_handle_ptr)
+{
+    EbErrorType return_error = EB_ErrorNone;
+    uint32_t instance_index;
+    uint32_t process_index;
+    uint32_t max_picture_width;
+    EbColorFormat color_format = enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.encoder_color_format;
+    SequenceControlSet* control_set_ptr;
+    SvtAv1EncContext *shared_context = enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.shared_context;
+
+    EbSequenceControlSetInitData scs_init;
+    scs_init.sb_size = enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.super_block_size;
+
+    if (shared_context) {
+        return_error = attach_shared_context(enc_handle_ptr, shared_context, scs_init.sb_size);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+        const uint8_t ladder_analysis = enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.ladder_analysis;
+        if (ladder_analysis) {
+            EncodeContext *encode_context_ptr = enc_handle_ptr->scs_instance_array[0]->encode_context_ptr;
+            const LadderRole role = ladder_analysis == 1 ? LADDER_SOURCE : LADDER_RENDITION;
+            return_error = svt_ladder_attach(&shared_context->ladder, role, &encode_context_ptr->ladder_slot);
+            if (return_error != EB_ErrorNone)
+                return return_error;
+            encode_context_ptr->ladder      = &shared_context->ladder;
+            encode_context_ptr->ladder_role = role;
+        }
+    } else {
+        init_encoder_tables(enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.use_cpu_flags);
+        build_blk_geom(scs_init.sb_size == 128);
+    }
     /************************************
     * Sequence Control Set
     ************************************/
@@ -1329,15 +1705,28 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     ************************************/
 
     // EbBufferHeaderType Input
-    EB_NEW(
-        enc_handle_ptr->input_buffer_resource_ptr,
-        svt_system_resource_ctor,
-        enc_handle_ptr->scs_instance_array[0]->scs_ptr->input_buffer_fifo_init_count,
-        1,
-        EB_ResourceCoordinationProcessInitCount,
-        svt_input_buffer_header_creator,
-        enc_handle_ptr->scs_instance_array[0]->scs_ptr,
-        svt_input_buffer_header_destroyer);
+    if (enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.zero_copy_input) {
+        // The planes are the caller's ones, referenced by svt_av1_enc_send_picture
+        EB_NEW(
+            enc_handle_ptr->input_buffer_resource_ptr,
+            svt_system_resource_ctor,
+            enc_handle_ptr->scs_instance_array[0]->scs_ptr->input_buffer_fifo_init_count,
+            1,
+            EB_ResourceCoordinationProcessInitCount,
+            svt_zero_copy_input_buffer_header_creator,
+            enc_handle_ptr->scs_instance_array[0]->scs_ptr,
+            svt_zero_copy_input_buffer_header_destroyer);
+    } else {
+        EB_NEW(
+            enc_handle_ptr->input_buffer_resource_ptr,
+            svt_system_resource_ctor,
+            enc_handle_ptr->scs_instance_array[0]->scs_ptr->input_buffer_fifo_init_count,
+            1,
+            EB_ResourceCoordinationProcessInitCount,
+            svt_input_buffer_header_creator,
+            enc_handle_ptr->scs_instance_array[0]->scs_ptr,
+            svt_input_buffer_header_destroyer);
+    }
 
     enc_handle_ptr->input_buffer_producer_fifo_ptr = svt_system_resource_get_producer_fifo(enc_handle_ptr->input_buffer_resource_ptr, 0);
 
@@ -1381,12 +1770,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->resource_coordination_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->resource_coordination_fifo_init_count,
             EB_ResourceCoordinationProcessInitCount,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->picture_analysis_process_init_count,
             resource_coordination_result_creator,
             &resource_coordination_result_init_data,
+            sizeof(resource_coordination_result_init_data),
             NULL);
     }
 
@@ -1396,12 +1786,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->picture_analysis_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->picture_analysis_fifo_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->picture_analysis_process_init_count,
             EB_PictureDecisionProcessInitCount,
             picture_analysis_result_creator,
             &picture_analysis_result_init_data,
+            sizeof(picture_analysis_result_init_data),
             NULL);
     }
 
@@ -1411,12 +1802,14 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->picture_decision_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->picture_decision_fifo_init_count,
-            EB_PictureDecisionProcessInitCount,
+            // Source based operations post the TPL dispenser tasks
+            EB_PictureDecisionProcessInitCount + enc_handle_ptr->scs_instance_array[0]->scs_ptr->source_based_operations_process_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->motion_estimation_process_init_count,
             picture_decision_result_creator,
             &picture_decision_result_init_data,
+            sizeof(picture_decision_result_init_data),
             NULL);
     }
 
@@ -1426,12 +1819,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->motion_estimation_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->motion_estimation_fifo_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->motion_estimation_process_init_count,
             EB_InitialRateControlProcessInitCount,
             motion_estimation_results_creator,
             &motion_estimation_result_init_data,
+            sizeof(motion_estimation_result_init_data),
             NULL);
     }
 
@@ -1441,12 +1835,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->initial_rate_control_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->initial_rate_control_fifo_init_count,
             EB_InitialRateControlProcessInitCount,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->source_based_operations_process_init_count,
             initial_rate_control_results_creator,
             &initial_rate_control_result_init_data,
+            sizeof(initial_rate_control_result_init_data),
             NULL);
     }
 
@@ -1455,12 +1850,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
         PictureResultInitData picture_result_init_data;
         EB_NEW(
             enc_handle_ptr->picture_demux_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->picture_demux_fifo_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->source_based_operations_process_init_count + enc_handle_ptr->scs_instance_array[0]->scs_ptr->rest_process_init_count + 1, // 1 for packetization
             EB_PictureManagerProcessInitCount,
             picture_results_creator,
             &picture_result_init_data,
+            sizeof(picture_result_init_data),
             NULL);
 
     }
@@ -1470,12 +1866,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
         PictureManagerResultInitData picture_manager_result_init_data;
         EB_NEW(
             enc_handle_ptr->pic_mgr_res_srm,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->in_loop_me_fifo_init_count,
             1, // One Producer = PicMgr
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->inlme_process_init_count,
             picture_manager_result_creator,
             &picture_manager_result_init_data,
+            sizeof(picture_manager_result_init_data),
             NULL);
 
     }
@@ -1486,12 +1883,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->rate_control_tasks_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->rate_control_tasks_fifo_init_count,
             rate_control_port_total_count(),
             EB_RateControlProcessInitCount,
             rate_control_tasks_creator,
             &rate_control_tasks_init_data,
+            sizeof(rate_control_tasks_init_data),
             NULL);
     }
 
@@ -1501,12 +1899,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->rate_control_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->rate_control_fifo_init_count,
             EB_RateControlProcessInitCount,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->mode_decision_configuration_process_init_count,
             rate_control_results_creator,
             &rate_control_result_init_data,
+            sizeof(rate_control_result_init_data),
             NULL);
     }
     // EncDec Tasks
@@ -1524,12 +1923,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->enc_dec_tasks_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->mode_decision_configuration_fifo_init_count,
             enc_dec_port_total_count(),
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->enc_dec_process_init_count,
             enc_dec_tasks_creator,
             &mode_decision_result_init_data,
+            sizeof(mode_decision_result_init_data),
             NULL);
     }
 
@@ -1539,12 +1939,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->enc_dec_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->enc_dec_fifo_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->enc_dec_process_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->dlf_process_init_count,
             enc_dec_results_creator,
             &enc_dec_result_init_data,
+            sizeof(enc_dec_result_init_data),
             NULL);
    }
 
@@ -1554,12 +1955,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->dlf_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->dlf_fifo_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->dlf_process_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->cdef_process_init_count,
             dlf_results_creator,
             &delf_result_init_data,
+            sizeof(delf_result_init_data),
             NULL);
     }
     //CDEF results
@@ -1568,12 +1970,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->cdef_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->cdef_fifo_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->cdef_process_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->rest_process_init_count,
             cdef_results_creator,
             &cdef_result_init_data,
+            sizeof(cdef_result_init_data),
             NULL);
     }
     //REST results
@@ -1582,12 +1985,28 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->rest_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->rest_fifo_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->rest_process_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->entropy_coding_process_init_count,
             rest_results_creator,
             &rest_result_init_data,
+            sizeof(rest_result_init_data),
+            NULL);
+    }
+    //Metrics tasks
+    if (enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.stat_report) {
+        EntropyCodingResultsInitData metrics_tasks_init_data;
+
+        EB_NEW(
+            enc_handle_ptr->metrics_tasks_resource_ptr,
+            svt_system_resource_lazy_ctor,
+            enc_handle_ptr->scs_instance_array[0]->scs_ptr->metrics_fifo_init_count,
+            enc_handle_ptr->scs_instance_array[0]->scs_ptr->rest_process_init_count,
+            enc_handle_ptr->scs_instance_array[0]->scs_ptr->metrics_process_init_count,
+            metrics_tasks_creator,
+            &metrics_tasks_init_data,
+            sizeof(metrics_tasks_init_data),
             NULL);
     }
 
@@ -1597,12 +2016,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
         EB_NEW(
             enc_handle_ptr->entropy_coding_results_resource_ptr,
-            svt_system_resource_ctor,
+            svt_system_resource_lazy_ctor,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->entropy_coding_fifo_init_count,
             enc_handle_ptr->scs_instance_array[0]->scs_ptr->entropy_coding_process_init_count,
             EB_PacketizationProcessInitCount,
             entropy_coding_results_creator,
             &entropy_coding_results_init_data,
+            sizeof(entropy_coding_results_init_data),
             NULL);
     }
 
@@ -1621,14 +2041,17 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     /************************************
     * Contexts
     ************************************/
+    numa_assign_stages(enc_handle_ptr);
 
     // Resource Coordination Context
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_RESOURCE_COORDINATION, EB_FALSE);
     EB_NEW(
         enc_handle_ptr->resource_coordination_context_ptr,
         resource_coordination_context_ctor,
         enc_handle_ptr);
 
     // Picture Analysis Context
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_PICTURE_ANALYSIS, EB_FALSE);
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->picture_analysis_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->picture_analysis_process_init_count);
 
     for (process_index = 0; process_index < enc_handle_ptr->scs_instance_array[0]->scs_ptr->picture_analysis_process_init_count; ++process_index) {
@@ -1641,6 +2064,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
    }
 
     // Picture Decision Context
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_PICTURE_DECISION, EB_FALSE);
     {
         // Initialize the various Picture types
         instance_index = 0;
@@ -1652,6 +2076,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     }
 
     // Motion Analysis Context
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_MOTION_ESTIMATION, EB_FALSE);
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->motion_estimation_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->motion_estimation_process_init_count);
 
     for (process_index = 0; process_index < enc_handle_ptr->scs_instance_array[0]->scs_ptr->motion_estimation_process_init_count; ++process_index) {
@@ -1663,11 +2088,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     }
 
     // Initial Rate Control Context
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_INITIAL_RATE_CONTROL, EB_FALSE);
     EB_NEW(
         enc_handle_ptr->initial_rate_control_context_ptr,
         initial_rate_control_context_ctor,
         enc_handle_ptr);
     // Source Based Operations Context
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_SOURCE_BASED_OPERATIONS, EB_FALSE);
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->source_based_operations_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->source_based_operations_process_init_count);
 
     for (process_index = 0; process_index < enc_handle_ptr->scs_instance_array[0]->scs_ptr->source_based_operations_process_init_count; ++process_index) {
@@ -1675,10 +2102,12 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
             enc_handle_ptr->source_based_operations_context_ptr_array[process_index],
             source_based_operations_context_ctor,
             enc_handle_ptr,
-            process_index);
+            process_index,
+            EB_PictureDecisionProcessInitCount + process_index);
     }
 
     // Picture Manager Context
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_PICTURE_MANAGER, EB_FALSE);
     EB_NEW(
         enc_handle_ptr->picture_manager_context_ptr,
         picture_manager_context_ctor,
@@ -1686,6 +2115,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
         0);
 
     // In-Loop ME Context
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_INLOOP_ME, EB_FALSE);
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->inlme_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->inlme_process_init_count);
 
     for (process_index = 0; process_index < enc_handle_ptr->scs_instance_array[0]->scs_ptr->inlme_process_init_count; ++process_index) {
@@ -1697,12 +2127,14 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     }
 
     // Rate Control Context
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_RATE_CONTROL, EB_FALSE);
     EB_NEW(
         enc_handle_ptr->rate_control_context_ptr,
         rate_control_context_ctor,
         enc_handle_ptr);
 
     // Mode Decision Configuration Contexts
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_MODE_DECISION_CONFIGURATION, EB_FALSE);
     {
         // Mode Decision Configuration Contexts
         EB_ALLOC_PTR_ARRAY(enc_handle_ptr->mode_decision_configuration_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->mode_decision_configuration_process_init_count);
@@ -1724,6 +2156,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     }
 
     // EncDec Contexts
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_ENC_DEC, EB_FALSE);
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->enc_dec_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->enc_dec_process_init_count);
     for (process_index = 0; process_index < enc_handle_ptr->scs_instance_array[0]->scs_ptr->enc_dec_process_init_count; ++process_index) {
         EB_NEW(
@@ -1736,6 +2169,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     }
 
     // Dlf Contexts
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_DLF, EB_FALSE);
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->dlf_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->dlf_process_init_count);
 
     for (process_index = 0; process_index < enc_handle_ptr->scs_instance_array[0]->scs_ptr->dlf_process_init_count; ++process_index) {
@@ -1747,6 +2181,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     }
 
     //CDEF Contexts
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_CDEF, EB_FALSE);
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->cdef_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->cdef_process_init_count);
 
     for (process_index = 0; process_index < enc_handle_ptr->scs_instance_array[0]->scs_ptr->cdef_process_init_count; ++process_index) {
@@ -1757,6 +2192,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
             process_index);
     }
     //Rest Contexts
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_REST, EB_FALSE);
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->rest_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->rest_process_init_count);
 
     for (process_index = 0; process_index < enc_handle_ptr->scs_instance_array[0]->scs_ptr->rest_process_init_count; ++process_index) {
@@ -1768,7 +2204,22 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
             1 + process_index);
     }
 
+    //Metrics Contexts
+    if (enc_handle_ptr->scs_instance_array[0]->scs_ptr->metrics_process_init_count) {
+        numa_place_stage(enc_handle_ptr, NUMA_STAGE_METRICS, EB_FALSE);
+        EB_ALLOC_PTR_ARRAY(enc_handle_ptr->metrics_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->metrics_process_init_count);
+
+        for (process_index = 0; process_index < enc_handle_ptr->scs_instance_array[0]->scs_ptr->metrics_process_init_count; ++process_index) {
+            EB_NEW(
+                enc_handle_ptr->metrics_context_ptr_array[process_index],
+                metrics_context_ctor,
+                enc_handle_ptr,
+                process_index);
+        }
+    }
+
     // Entropy Coding Contexts
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_ENTROPY_CODING, EB_FALSE);
     EB_ALLOC_PTR_ARRAY(enc_handle_ptr->entropy_coding_context_ptr_array, enc_handle_ptr->scs_instance_array[0]->scs_ptr->entropy_coding_process_init_count);
 
     for (process_index = 0; process_index < enc_handle_ptr->scs_instance_array[0]->scs_ptr->entropy_coding_process_init_count; ++process_index) {
@@ -1781,6 +2232,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     }
 
     // Packetization Context
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_PACKETIZATION, EB_FALSE);
     EB_NEW(
         enc_handle_ptr->packetization_context_ptr,
         packetization_context_ctor,
@@ -1798,72 +2250,140 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
 
     control_set_ptr = enc_handle_ptr->scs_instance_array[0]->scs_ptr;
 
+    EbHandle worker_pool = NULL;
+    if (shared_context)
+        worker_pool = shared_context->worker_pool;
+    else if (config_ptr->enable_worker_pool) {
+        enc_handle_ptr->worker_pool = svt_create_worker_pool(control_set_ptr->core_count);
+        if (enc_handle_ptr->worker_pool == NULL)
+            return EB_ErrorInsufficientResources;
+        worker_pool = enc_handle_ptr->worker_pool;
+    }
+    if (worker_pool) {
+        enc_handle_ptr->worker_group = svt_create_worker_group(worker_pool);
+        if (enc_handle_ptr->worker_group == NULL)
+            return EB_ErrorInsufficientResources;
+    }
+    EbHandle worker_group = enc_handle_ptr->worker_group;
+
+    if (config_ptr->pipeline_profile) {
+        uint32_t counts[NUMA_STAGE_COUNT];
+        uint32_t total_count = 0;
+        get_stage_thread_counts(control_set_ptr, counts);
+        for (int stage = 0; stage < NUMA_STAGE_COUNT; stage++)
+            total_count += counts[stage];
+        EB_NEW(enc_handle_ptr->profiler, svt_profiler_ctor, config_ptr->pipeline_profile,
+            total_count, pipeline_stage_names, NUMA_STAGE_COUNT);
+    }
+    EbProfiler *profiler = enc_handle_ptr->profiler;
+
     // Resource Coordination
-    EB_CREATE_THREAD(enc_handle_ptr->resource_coordination_thread_handle, resource_coordination_kernel, enc_handle_ptr->resource_coordination_context_ptr);
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->picture_analysis_thread_handle_array,control_set_ptr->picture_analysis_process_init_count,
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_RESOURCE_COORDINATION, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD(enc_handle_ptr->resource_coordination_thread_handle, profiler, NUMA_STAGE_RESOURCE_COORDINATION, worker_group, resource_coordination_kernel, enc_handle_ptr->resource_coordination_context_ptr);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_RESOURCE_COORDINATION, &enc_handle_ptr->resource_coordination_thread_handle, 1);
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_PICTURE_ANALYSIS, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->picture_analysis_thread_handle_array, control_set_ptr->picture_analysis_process_init_count, profiler, NUMA_STAGE_PICTURE_ANALYSIS, worker_group,
         picture_analysis_kernel,
         enc_handle_ptr->picture_analysis_context_ptr_array);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_PICTURE_ANALYSIS, enc_handle_ptr->picture_analysis_thread_handle_array, control_set_ptr->picture_analysis_process_init_count);
 
     // Picture Decision
-    EB_CREATE_THREAD(enc_handle_ptr->picture_decision_thread_handle, picture_decision_kernel, enc_handle_ptr->picture_decision_context_ptr);
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_PICTURE_DECISION, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD(enc_handle_ptr->picture_decision_thread_handle, profiler, NUMA_STAGE_PICTURE_DECISION, worker_group, picture_decision_kernel, enc_handle_ptr->picture_decision_context_ptr);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_PICTURE_DECISION, &enc_handle_ptr->picture_decision_thread_handle, 1);
 
     // Motion Estimation
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->motion_estimation_thread_handle_array, control_set_ptr->motion_estimation_process_init_count,
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_MOTION_ESTIMATION, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->motion_estimation_thread_handle_array, control_set_ptr->motion_estimation_process_init_count, profiler, NUMA_STAGE_MOTION_ESTIMATION, worker_group,
         motion_estimation_kernel,
         enc_handle_ptr->motion_estimation_context_ptr_array);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_MOTION_ESTIMATION, enc_handle_ptr->motion_estimation_thread_handle_array, control_set_ptr->motion_estimation_process_init_count);
 
     // Initial Rate Control
-    EB_CREATE_THREAD(enc_handle_ptr->initial_rate_control_thread_handle, initial_rate_control_kernel, enc_handle_ptr->initial_rate_control_context_ptr);
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_INITIAL_RATE_CONTROL, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD(enc_handle_ptr->initial_rate_control_thread_handle, profiler, NUMA_STAGE_INITIAL_RATE_CONTROL, worker_group, initial_rate_control_kernel, enc_handle_ptr->initial_rate_control_context_ptr);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_INITIAL_RATE_CONTROL, &enc_handle_ptr->initial_rate_control_thread_handle, 1);
 
     // Source Based Oprations
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->source_based_operations_thread_handle_array, control_set_ptr->source_based_operations_process_init_count,
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_SOURCE_BASED_OPERATIONS, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->source_based_operations_thread_handle_array, control_set_ptr->source_based_operations_process_init_count, profiler, NUMA_STAGE_SOURCE_BASED_OPERATIONS, worker_group,
         source_based_operations_kernel,
         enc_handle_ptr->source_based_operations_context_ptr_array);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_SOURCE_BASED_OPERATIONS, enc_handle_ptr->source_based_operations_thread_handle_array, control_set_ptr->source_based_operations_process_init_count);
 
     // Picture Manager
-    EB_CREATE_THREAD(enc_handle_ptr->picture_manager_thread_handle, picture_manager_kernel, enc_handle_ptr->picture_manager_context_ptr);
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_PICTURE_MANAGER, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD(enc_handle_ptr->picture_manager_thread_handle, profiler, NUMA_STAGE_PICTURE_MANAGER, worker_group, picture_manager_kernel, enc_handle_ptr->picture_manager_context_ptr);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_PICTURE_MANAGER, &enc_handle_ptr->picture_manager_thread_handle, 1);
 
     // Close Loop Motion Estimation
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->ime_thread_handle_array, control_set_ptr->inlme_process_init_count,
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_INLOOP_ME, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->ime_thread_handle_array, control_set_ptr->inlme_process_init_count, profiler, NUMA_STAGE_INLOOP_ME, worker_group,
             inloop_me_kernel,
             enc_handle_ptr->inlme_context_ptr_array);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_INLOOP_ME, enc_handle_ptr->ime_thread_handle_array, control_set_ptr->inlme_process_init_count);
 
     // Rate Control
-    EB_CREATE_THREAD(enc_handle_ptr->rate_control_thread_handle, rate_control_kernel, enc_handle_ptr->rate_control_context_ptr);
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_RATE_CONTROL, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD(enc_handle_ptr->rate_control_thread_handle, profiler, NUMA_STAGE_RATE_CONTROL, worker_group, rate_control_kernel, enc_handle_ptr->rate_control_context_ptr);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_RATE_CONTROL, &enc_handle_ptr->rate_control_thread_handle, 1);
 
     // Mode Decision Configuration Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->mode_decision_configuration_thread_handle_array, control_set_ptr->mode_decision_configuration_process_init_count,
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_MODE_DECISION_CONFIGURATION, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->mode_decision_configuration_thread_handle_array, control_set_ptr->mode_decision_configuration_process_init_count, profiler, NUMA_STAGE_MODE_DECISION_CONFIGURATION, worker_group,
         mode_decision_configuration_kernel,
         enc_handle_ptr->mode_decision_configuration_context_ptr_array);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_MODE_DECISION_CONFIGURATION, enc_handle_ptr->mode_decision_configuration_thread_handle_array, control_set_ptr->mode_decision_configuration_process_init_count);
 
 
     // EncDec Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->enc_dec_thread_handle_array, control_set_ptr->enc_dec_process_init_count,
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_ENC_DEC, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->enc_dec_thread_handle_array, control_set_ptr->enc_dec_process_init_count, profiler, NUMA_STAGE_ENC_DEC, worker_group,
         mode_decision_kernel,
         enc_handle_ptr->enc_dec_context_ptr_array);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_ENC_DEC, enc_handle_ptr->enc_dec_thread_handle_array, control_set_ptr->enc_dec_process_init_count);
 
     // Dlf Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->dlf_thread_handle_array, control_set_ptr->dlf_process_init_count,
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_DLF, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->dlf_thread_handle_array, control_set_ptr->dlf_process_init_count, profiler, NUMA_STAGE_DLF, worker_group,
         dlf_kernel,
         enc_handle_ptr->dlf_context_ptr_array);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_DLF, enc_handle_ptr->dlf_thread_handle_array, control_set_ptr->dlf_process_init_count);
 
     // Cdef Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->cdef_thread_handle_array, control_set_ptr->cdef_process_init_count,
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_CDEF, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->cdef_thread_handle_array, control_set_ptr->cdef_process_init_count, profiler, NUMA_STAGE_CDEF, worker_group,
         cdef_kernel,
         enc_handle_ptr->cdef_context_ptr_array);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_CDEF, enc_handle_ptr->cdef_thread_handle_array, control_set_ptr->cdef_process_init_count);
 
     // Rest Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->rest_thread_handle_array, control_set_ptr->rest_process_init_count,
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_REST, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->rest_thread_handle_array, control_set_ptr->rest_process_init_count, profiler, NUMA_STAGE_REST, worker_group,
         rest_kernel,
         enc_handle_ptr->rest_context_ptr_array);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_REST, enc_handle_ptr->rest_thread_handle_array, control_set_ptr->rest_process_init_count);
+
+    // Metrics Process
+    if (control_set_ptr->metrics_process_init_count) {
+        numa_place_stage(enc_handle_ptr, NUMA_STAGE_METRICS, EB_TRUE);
+        EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->metrics_thread_handle_array, control_set_ptr->metrics_process_init_count, profiler, NUMA_STAGE_METRICS, worker_group,
+            metrics_kernel,
+            enc_handle_ptr->metrics_context_ptr_array);
+        numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_METRICS, enc_handle_ptr->metrics_thread_handle_array, control_set_ptr->metrics_process_init_count);
+    }
 
     // Entropy Coding Process
-    EB_CREATE_THREAD_ARRAY(enc_handle_ptr->entropy_coding_thread_handle_array, control_set_ptr->entropy_coding_process_init_count,
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_ENTROPY_CODING, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD_ARRAY(enc_handle_ptr->entropy_coding_thread_handle_array, control_set_ptr->entropy_coding_process_init_count, profiler, NUMA_STAGE_ENTROPY_CODING, worker_group,
         entropy_coding_kernel,
         enc_handle_ptr->entropy_coding_context_ptr_array);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_ENTROPY_CODING, enc_handle_ptr->entropy_coding_thread_handle_array, control_set_ptr->entropy_coding_process_init_count);
 
     // Packetization
-    EB_CREATE_THREAD(enc_handle_ptr->packetization_thread_handle, packetization_kernel, enc_handle_ptr->packetization_context_ptr);
+    numa_place_stage(enc_handle_ptr, NUMA_STAGE_PACKETIZATION, EB_TRUE);
+    EB_CREATE_PROFILED_THREAD(enc_handle_ptr->packetization_thread_handle, profiler, NUMA_STAGE_PACKETIZATION, worker_group, packetization_kernel, enc_handle_ptr->packetization_context_ptr);
+    numa_pin_stage_threads(enc_handle_ptr, NUMA_STAGE_PACKETIZATION, &enc_handle_ptr->packetization_thread_handle, 1);
 
 #if DISPLAY_MEMORY
     EB_MEMORY();
@@ -1873,6 +2393,73 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
     return return_error;
 }
 
+/**********************************
+* Initialize Encoder Library
+**********************************/
+EB_API EbErrorType svt_av1_enc_init(EbComponentType *svt_enc_component)
+{
+    if(svt_enc_component == NULL)
+        return EB_ErrorBadParameter;
+    EbEncHandle *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+    const uint32_t numa_policy = enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.numa_policy;
+    if (numa_policy == 0)
+        return init_encoder(enc_handle_ptr);
+
+    // The memory allocated by init_encoder() and by the threads it creates is
+    // placed on the encoder node, or the picture pools are interleaved across
+    // the nodes when the stages are sharded. The memory policy of the calling
+    // thread is restored afterwards.
+    SvtNumaPolicy policy;
+    svt_numa_get_policy(&policy);
+    if (numa_policy == 1)
+        svt_numa_prefer_node((uint32_t)enc_handle_ptr->scs_instance_array[0]->scs_ptr->static_config.numa_node);
+    else
+        svt_numa_interleave();
+    EbErrorType return_error = init_encoder(enc_handle_ptr);
+    svt_numa_set_policy(&policy);
+    return return_error;
+}
+
+/*
+* Prints what the encoder used of the max_memory_mb budget, in every build:
+* the estimate of the picture buffer pools, the objects the lazy fifos grew
+* to and the peak resident memory of the process.
+*/
+static void print_memory_budget_usage(EbEncHandle *enc_handle_ptr) {
+    const SequenceControlSet *scs_ptr = enc_handle_ptr->scs_instance_array[0]->scs_ptr;
+    const EbSystemResource *fifos[] = {
+        enc_handle_ptr->resource_coordination_results_resource_ptr,
+        enc_handle_ptr->picture_analysis_results_resource_ptr,
+        enc_handle_ptr->picture_decision_results_resource_ptr,
+        enc_handle_ptr->motion_estimation_results_resource_ptr,
+        enc_handle_ptr->initial_rate_control_results_resource_ptr,
+        enc_handle_ptr->picture_demux_results_resource_ptr,
+        enc_handle_ptr->pic_mgr_res_srm,
+        enc_handle_ptr->rate_control_tasks_resource_ptr,
+        enc_handle_ptr->rate_control_results_resource_ptr,
+        enc_handle_ptr->enc_dec_tasks_resource_ptr,
+        enc_handle_ptr->enc_dec_results_resource_ptr,
+        enc_handle_ptr->dlf_results_resource_ptr,
+        enc_handle_ptr->cdef_results_resource_ptr,
+        enc_handle_ptr->rest_results_resource_ptr,
+        enc_handle_ptr->metrics_tasks_resource_ptr,
+        enc_handle_ptr->entropy_coding_results_resource_ptr };
+    uint32_t fifo_objects = 0;
+    uint32_t fifo_max_objects = 0;
+
+    for (int i = 0; i < (int)(sizeof(fifos) / sizeof(fifos[0])); i++) {
+        if (!fifos[i])
+            continue;
+        fifo_objects += fifos[i]->object_total_count;
+        fifo_max_objects += fifos[i]->object_max_count;
+    }
+    SVT_LOG("SVT [memory]: MaxMemory %u MB, picture buffers %u MB, fifo objects %u of %u, peak resident memory %u MB\n",
+        scs_ptr->static_config.max_memory_mb,
+        (uint32_t)((scs_ptr->picture_pools_size + (1 << 20) - 1) >> 20),
+        fifo_objects, fifo_max_objects,
+        (uint32_t)((svt_get_peak_resident_memory() + (1 << 20) - 1) >> 20));
+}
+
 /**********************************
 * DeInitialize Encoder Library
 **********************************/
@@ -1882,6 +2469,17 @@ EB_API EbErrorType svt_av1_enc_deinit(EbComponentType *svt_enc_component){
 
     EbEncHandle *handle = (EbEncHandle*)svt_enc_component->p_component_private;
     if (handle) {
+        svt_print_memory_peak_usage();
+        if (handle->scs_instance_array && handle->scs_instance_array[0] &&
+            handle->scs_instance_array[0]->scs_ptr->static_config.max_memory_mb)
+            print_memory_budget_usage(handle);
+        // Releases the renditions waiting for the source, and the records
+        // waiting for this rendition
+        EncodeContext *encode_context_ptr = handle->scs_instance_array && handle->scs_instance_array[0]
+            ? handle->scs_instance_array[0]->encode_context_ptr
+            : NULL;
+        if (encode_context_ptr && encode_context_ptr->ladder)
+            svt_ladder_detach(encode_context_ptr->ladder, encode_context_ptr->ladder_role, encode_context_ptr->ladder_slot);
         svt_shutdown_process(handle->input_buffer_resource_ptr);
         svt_shutdown_process(handle->resource_coordination_results_resource_ptr);
         svt_shutdown_process(handle->picture_analysis_results_resource_ptr);
@@ -1898,8 +2496,68 @@ EB_API EbErrorType svt_av1_enc_deinit(EbComponentType *svt_enc_component){
         svt_shutdown_process(handle->dlf_results_resource_ptr);
         svt_shutdown_process(handle->cdef_results_resource_ptr);
         svt_shutdown_process(handle->rest_results_resource_ptr);
+        svt_shutdown_process(handle->metrics_tasks_resource_ptr);
+    }
+
+    return EB_ErrorNone;
+}
+
+/**********************************
+* Create a Shared Encoder Context
+**********************************/
+EB_API EbErrorType svt_av1_enc_context_create(
+    SvtAv1EncContext             **context_ptr,
+    const SvtAv1EncContextConfig  *config)
+{
+    if (context_ptr == NULL || config == NULL || (config->use_cpu_flags & CPU_FLAGS_INVALID))
+        return EB_ErrorBadParameter;
+    *context_ptr = NULL;
+    svt_log_init();
+
+    // The context outlives the handles, so it is not tracked by the memory map
+    SvtAv1EncContext *context = (SvtAv1EncContext*)calloc(1, sizeof(*context));
+    if (context == NULL)
+        return EB_ErrorInsufficientResources;
+#if defined(ARCH_X86_64) || defined(ARCH_AARCH64)
+    context->use_cpu_flags = config->use_cpu_flags & get_cpu_flags_to_use();
+#else
+    context->use_cpu_flags = 0;
+#endif
+    context->mutex = svt_create_mutex();
+    if (context->mutex && svt_ladder_analysis_init(&context->ladder) == EB_ErrorNone)
+        context->worker_pool = svt_create_worker_pool(config->worker_count ? config->worker_count : get_num_processors());
+    if (context->worker_pool == NULL) {
+        svt_ladder_analysis_deinit(&context->ladder);
+        if (context->mutex)
+            svt_destroy_mutex(context->mutex);
+        free(context);
+        return EB_ErrorInsufficientResources;
     }
+    // Set up once here: the attached handles do not rewrite the process wide
+    // tables while the others encode
+    init_encoder_tables(context->use_cpu_flags);
+    *context_ptr = context;
+    return EB_ErrorNone;
+}
 
+/**********************************
+* Destroy a Shared Encoder Context
+**********************************/
+EB_API EbErrorType svt_av1_enc_context_destroy(SvtAv1EncContext *context)
+{
+    if (context == NULL)
+        return EB_ErrorBadParameter;
+    svt_block_on_mutex(context->mutex);
+    const uint32_t handle_count = context->handle_count;
+    svt_release_mutex(context->mutex);
+    if (handle_count) {
+        SVT_ERROR("The shared context is destroyed while %u handles are attached to it\n", handle_count);
+        return EB_ErrorBadParameter;
+    }
+    svt_destroy_worker_pool(context->worker_pool);
+    svt_ladder_analysis_deinit(&context->ladder);
+    svt_destroy_mutex(context->mutex);
+    free(context);
     return EB_ErrorNone;
 }
 
@@ -2374,6 +3032,9 @@ void copy_api_from_app(
     scs_ptr->subsampling_y = (scs_ptr->chroma_format_idc >= EB_YUV422 ? 1 : 2) - 1;
     scs_ptr->static_config.ten_bit_format = ((EbSvtAv1EncConfiguration*)config_struct)->ten_bit_format;
     scs_ptr->static_config.compressed_ten_bit_format = ((EbSvtAv1EncConfiguration*)config_struct)->compressed_ten_bit_format;
+    scs_ptr->static_config.zero_copy_input = ((EbSvtAv1EncConfiguration*)config_struct)->zero_copy_input;
+    scs_ptr->static_config.input_release_cb = ((EbSvtAv1EncConfiguration*)config_struct)->input_release_cb;
+    scs_ptr->static_config.input_release_cb_data = ((EbSvtAv1EncConfiguration*)config_struct)->input_release_cb_data;
 
     // Thresholds
     scs_ptr->static_config.high_dynamic_range_input = ((EbSvtAv1EncConfiguration*)config_struct)->high_dynamic_range_input;
@@ -2386,6 +3047,7 @@ void copy_api_from_app(
     scs_ptr->static_config.tier = ((EbSvtAv1EncConfiguration*)config_struct)->tier;
     scs_ptr->static_config.level = ((EbSvtAv1EncConfiguration*)config_struct)->level;
     scs_ptr->static_config.stat_report = ((EbSvtAv1EncConfiguration*)config_struct)->stat_report;
+    scs_ptr->static_config.frame_stats = ((EbSvtAv1EncConfiguration*)config_struct)->frame_stats;
 
     scs_ptr->static_config.injector_frame_rate = ((EbSvtAv1EncConfiguration*)config_struct)->injector_frame_rate;
     scs_ptr->static_config.speed_control_flag = ((EbSvtAv1EncConfiguration*)config_struct)->speed_control_flag;
@@ -2402,8 +3064,25 @@ void copy_api_from_app(
         SVT_WARN("unpin 1 and ss %d is not a valid combination: unpin will be set to 0\n", scs_ptr->static_config.target_socket);
         scs_ptr->static_config.unpin = 0;
     }
+    scs_ptr->static_config.enable_worker_pool = ((EbSvtAv1EncConfiguration*)config_struct)->enable_worker_pool;
+    scs_ptr->static_config.shared_context = ((EbSvtAv1EncConfiguration*)config_struct)->shared_context;
+    // The CPU dispatch is set up by the shared context for all its handles
+    if (scs_ptr->static_config.shared_context)
+        scs_ptr->static_config.use_cpu_flags = scs_ptr->static_config.shared_context->use_cpu_flags;
+    scs_ptr->static_config.ladder_analysis = ((EbSvtAv1EncConfiguration*)config_struct)->ladder_analysis;
+    scs_ptr->static_config.numa_policy = ((EbSvtAv1EncConfiguration*)config_struct)->numa_policy;
+    scs_ptr->static_config.numa_node = ((EbSvtAv1EncConfiguration*)config_struct)->numa_node;
+    if (scs_ptr->static_config.numa_policy != 0 && !svt_numa_supported()) {
+        SVT_WARN("numa_policy %u is not supported on this system: numa_policy will be set to 0\n", scs_ptr->static_config.numa_policy);
+        scs_ptr->static_config.numa_policy = 0;
+    }
+    // The node of the calling thread is looked up once, so that the pipeline is sized and placed for the same node
+    if (scs_ptr->static_config.numa_policy == 1 && scs_ptr->static_config.numa_node == -1)
+        scs_ptr->static_config.numa_node = (int32_t)svt_numa_current_node();
+    scs_ptr->static_config.max_memory_mb = ((EbSvtAv1EncConfiguration*)config_struct)->max_memory_mb;
     scs_ptr->static_config.qp = ((EbSvtAv1EncConfiguration*)config_struct)->qp;
     scs_ptr->static_config.recon_enabled = ((EbSvtAv1EncConfiguration*)config_struct)->recon_enabled;
+    scs_ptr->static_config.pipeline_profile = ((EbSvtAv1EncConfiguration*)config_struct)->pipeline_profile;
     scs_ptr->static_config.enable_tpl_la = ((EbSvtAv1EncConfiguration*)config_struct)->enable_tpl_la;
     // Extract frame rate from Numerator and Denominator if not 0
     if (scs_ptr->static_config.frame_rate_numerator != 0 && scs_ptr->static_config.frame_rate_denominator != 0)
@@ -2467,6 +3146,18 @@ void copy_api_from_app(
         }
     }
 
+    // Low latency mode: code the pictures in input order as soon as they arrive
+    scs_ptr->static_config.low_latency_mode = config_struct->low_latency_mode;
+    if (scs_ptr->static_config.low_latency_mode) {
+        scs_ptr->static_config.hierarchical_levels = 0;
+        scs_ptr->max_temporal_layers = 0;
+        scs_ptr->static_config.look_ahead_distance = 0;
+        scs_ptr->static_config.enable_tpl_la = 0;
+        scs_ptr->static_config.scene_change_detection = 0;
+        scs_ptr->static_config.tf_level = 0;
+        scs_ptr->static_config.enable_overlays = EB_FALSE;
+    }
+
     return;
 }
 
@@ -2725,6 +3416,11 @@ static EbErrorType verify_settings(
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->frame_stats > 2) {
+        SVT_LOG("Error instance %u : Invalid FrameStats. FrameStats must be [0 - 2]\n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     if (config->high_dynamic_range_input > 1) {
         SVT_LOG("Error instance %u : Invalid HighDynamicRangeInput. HighDynamicRangeInput must be [0 - 1]\n", channel_number + 1);
         return_error = EB_ErrorBadParameter;
@@ -2805,6 +3501,61 @@ static EbErrorType verify_settings(
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->low_latency_mode != 0 && config->low_latency_mode != 1) {
+        SVT_LOG("Error instance %u: Invalid low_latency_mode. low_latency_mode must be [0 - 1] \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->low_latency_mode && (use_input_stat(scs_ptr) || use_output_stat(scs_ptr))) {
+        SVT_LOG("Error instance %u: low_latency_mode is not supported with multi-pass encoding \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->low_latency_mode && config->enable_manual_pred_struct) {
+        SVT_LOG("Error instance %u: low_latency_mode is not supported with a manual prediction structure \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->zero_copy_input != 0 && config->zero_copy_input != 1) {
+        SVT_LOG("Error instance %u: Invalid zero_copy_input. zero_copy_input must be [0 - 1] \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->zero_copy_input && config->input_release_cb == NULL) {
+        SVT_LOG("Error instance %u: zero_copy_input requires an input_release_cb \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->enable_worker_pool != 0 && config->enable_worker_pool != 1) {
+        SVT_LOG("Error instance %u: Invalid enable_worker_pool. enable_worker_pool must be [0 - 1] \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->ladder_analysis > 2) {
+        SVT_LOG("Error instance %u: Invalid ladder_analysis. ladder_analysis must be [0 - 2] \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->ladder_analysis && config->shared_context == NULL) {
+        SVT_LOG("Error instance %u: ladder_analysis requires a shared_context \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->pipeline_profile > 2) {
+        SVT_LOG("Error instance %u: Invalid pipeline_profile. pipeline_profile must be [0 - 2] \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
+    if (config->numa_policy > 2) {
+        SVT_LOG("Error instance %u: Invalid numa_policy. numa_policy must be [0 - 2] \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->numa_node < -1 || (config->numa_node != -1 && (uint32_t)config->numa_node >= svt_numa_node_count())) {
+        SVT_LOG("Error instance %u: Invalid numa_node. numa_node must be [-1 - %u] \n", channel_number + 1, svt_numa_node_count() - 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    if (config->numa_policy != 0 && config->target_socket != -1) {
+        SVT_LOG("Error instance %u: numa_policy and target_socket cannot be used together \n", channel_number + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
     // alt-ref frames related
     if (config->altref_strength > ALTREF_MAX_STRENGTH ) {
         SVT_LOG("Error instance %u: invalid altref-strength, should be in the range [0 - %d] \n", channel_number + 1, ALTREF_MAX_STRENGTH);
@@ -3069,9 +3820,13 @@ EbErrorType svt_svt_enc_init_parameter(
     config_ptr->encoder_bit_depth = 8;
     config_ptr->ten_bit_format = 0;
     config_ptr->compressed_ten_bit_format = 0;
+    config_ptr->zero_copy_input = EB_FALSE;
+    config_ptr->input_release_cb = NULL;
+    config_ptr->input_release_cb_data = NULL;
     config_ptr->source_width = 0;
     config_ptr->source_height = 0;
     config_ptr->stat_report = 0;
+    config_ptr->frame_stats = 0;
     config_ptr->tile_rows = 0;
     config_ptr->tile_columns = 0;
 
@@ -3098,6 +3853,7 @@ EbErrorType svt_svt_enc_init_parameter(
     config_ptr->intra_refresh_type = 2;
     config_ptr->hierarchical_levels = 4;
     config_ptr->pred_structure = EB_PRED_RANDOM_ACCESS;
+    config_ptr->low_latency_mode = EB_FALSE;
     config_ptr->disable_dlf_flag = EB_FALSE;
     config_ptr->enable_warped_motion = DEFAULT;
     config_ptr->enable_global_motion = EB_TRUE;
@@ -3197,11 +3953,18 @@ EbErrorType svt_svt_enc_init_parameter(
     config_ptr->logical_processors = 0;
     config_ptr->unpin = 1;
     config_ptr->target_socket = -1;
+    config_ptr->enable_worker_pool = EB_FALSE;
+    config_ptr->shared_context = NULL;
+    config_ptr->ladder_analysis = 0;
+    config_ptr->numa_policy = 0;
+    config_ptr->numa_node = -1;
+    config_ptr->max_memory_mb = 0;
     config_ptr->channel_id = 0;
     config_ptr->active_channel_count = 1;
 
     // Debug info
     config_ptr->recon_enabled = 0;
+    config_ptr->pipeline_profile = 0;
 
     // Alt-Ref default values
     config_ptr->tf_level = DEFAULT;
@@ -3217,6 +3980,72 @@ EbErrorType svt_svt_enc_init_parameter(
 
     return return_error;
 }
+/**************************************
+* Input picture buffer descriptor settings,
+* shared by the input buffers allocation and
+* the zero-copy input layout
+**************************************/
+static void init_input_pic_buf_desc_data(
+    SequenceControlSet          *scs_ptr,
+    EbPictureBufferDescInitData *input_pic_buf_desc_init_data)
+{
+    EbSvtAv1EncConfiguration   * config = &scs_ptr->static_config;
+    uint8_t is_16bit = config->encoder_bit_depth > 8 ? 1 : 0;
+
+    input_pic_buf_desc_init_data->max_width =
+        !(scs_ptr->max_input_luma_width % 8) ?
+        scs_ptr->max_input_luma_width :
+        scs_ptr->max_input_luma_width + (scs_ptr->max_input_luma_width % 8);
+
+    input_pic_buf_desc_init_data->max_height =
+        !(scs_ptr->max_input_luma_height % 8) ?
+        scs_ptr->max_input_luma_height :
+        scs_ptr->max_input_luma_height + (scs_ptr->max_input_luma_height % 8);
+
+    input_pic_buf_desc_init_data->bit_depth = (EbBitDepthEnum)config->encoder_bit_depth;
+    input_pic_buf_desc_init_data->color_format = (EbColorFormat)config->encoder_color_format;
+
+    input_pic_buf_desc_init_data->left_padding = scs_ptr->left_padding;
+    input_pic_buf_desc_init_data->right_padding = scs_ptr->right_padding;
+    input_pic_buf_desc_init_data->top_padding = scs_ptr->top_padding;
+    input_pic_buf_desc_init_data->bot_padding = scs_ptr->bot_padding;
+
+    input_pic_buf_desc_init_data->split_mode = is_16bit ? EB_TRUE : EB_FALSE;
+
+    input_pic_buf_desc_init_data->buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
+    input_pic_buf_desc_init_data->is_16bit_pipeline = 0;
+
+    if (is_16bit && config->compressed_ten_bit_format == 1)
+        //do special allocation for 2bit data down below.
+        input_pic_buf_desc_init_data->split_mode = EB_FALSE;
+}
+
+/**************************************
+* Layout of the caller planes in zero-copy
+* mode: the one of the input picture buffers
+**************************************/
+static void get_input_layout(
+    SequenceControlSet *scs_ptr,
+    SvtAv1InputLayout  *layout)
+{
+    EbPictureBufferDescInitData init_data;
+    init_input_pic_buf_desc_data(scs_ptr, &init_data);
+    const uint32_t ss_x = (init_data.color_format == EB_YUV444 ? 1 : 2) - 1;
+    const uint32_t ss_y = (init_data.color_format >= EB_YUV422 ? 1 : 2) - 1;
+
+    layout->y_stride = init_data.max_width + init_data.left_padding + init_data.right_padding;
+    layout->chroma_stride = layout->y_stride >> ss_x;
+    layout->luma_offset = layout->y_stride * init_data.top_padding + init_data.left_padding;
+    layout->chroma_offset = layout->chroma_stride * (init_data.top_padding >> ss_y) +
+        (init_data.left_padding >> ss_x);
+    layout->alignment = ALVALUE;
+    layout->luma_size = (uint64_t)layout->y_stride *
+        (init_data.max_height + init_data.top_padding + init_data.bot_padding);
+    layout->chroma_size = layout->luma_size >> (3 - init_data.color_format);
+    layout->luma_ext_size = init_data.split_mode ? layout->luma_size : 0;
+    layout->chroma_ext_size = init_data.split_mode ? layout->chroma_size : 0;
+}
+
 //#define DEBUG_BUFFERS
 static void print_lib_params(
     SequenceControlSet* scs) {
@@ -3265,6 +4094,42 @@ static void print_lib_params(
         SVT_LOG("\nSVT [config]: RCMode / TargetBitrate (kbps)/ LookaheadDistance / SceneChange\t\t: Constraint VBR / %d / %d / %d ", (int)config->target_bit_rate/1000, config->look_ahead_distance, config->scene_change_detection);
     else
         SVT_LOG("\nSVT [config]: BRC Mode / QP  / LookaheadDistance / SceneChange\t\t\t: CQP / %d / %d / %d ", scs->static_config.qp, config->look_ahead_distance, config->scene_change_detection);
+    if (config->low_latency_mode)
+        SVT_LOG("\nSVT [config]: LowLatencyMode (tiles per picture) \t\t\t\t\t: %d",
+            (1 << config->tile_rows) * (1 << config->tile_columns));
+    if (config->zero_copy_input) {
+        SvtAv1InputLayout layout;
+        get_input_layout(scs, &layout);
+        SVT_LOG("\nSVT [config]: ZeroCopyInput (luma stride / picture offset) \t\t\t\t: %d / %d",
+            layout.y_stride,
+            layout.luma_offset);
+    }
+    if (config->shared_context)
+        SVT_LOG("\nSVT [config]: SharedContext (threads) \t\t\t\t\t\t: %d",
+            scs->total_process_init_count);
+    else if (config->enable_worker_pool)
+        SVT_LOG("\nSVT [config]: WorkerPool (workers / threads) \t\t\t\t\t: %d / %d",
+            scs->core_count,
+            scs->total_process_init_count);
+    if (config->ladder_analysis)
+        SVT_LOG("\nSVT [config]: LadderAnalysis \t\t\t\t\t\t\t: %s",
+            config->ladder_analysis == 1 ? "Source" : "Rendition");
+    if (config->pipeline_profile)
+        SVT_LOG("\nSVT [config]: PipelineProfile \t\t\t\t\t\t\t: %s",
+            config->pipeline_profile == 1 ? "Counters" : "Counters and trace");
+    if (config->numa_policy == 1)
+        SVT_LOG("\nSVT [config]: NumaPolicy / NumaNode \t\t\t\t\t\t: Node / %d",
+            config->numa_node);
+    else if (config->numa_policy == 2)
+        SVT_LOG("\nSVT [config]: NumaPolicy / NumaNodes \t\t\t\t\t\t: Shard / %u",
+            svt_numa_node_count());
+    if (config->max_memory_mb)
+        SVT_LOG("\nSVT [config]: MaxMemory (MB) / INPUT / PCS / PAREF / REF \t\t\t\t: %d / %d / %d / %d / %d",
+            config->max_memory_mb,
+            scs->input_buffer_fifo_init_count,
+            scs->picture_control_set_pool_init_count,
+            scs->pa_reference_picture_buffer_init_count,
+            scs->reference_picture_buffer_init_count);
 #ifdef DEBUG_BUFFERS
     SVT_LOG("\nSVT [config]: INPUT / OUTPUT \t\t\t\t\t\t\t: %d / %d", scs->input_buffer_fifo_init_count, scs->output_stream_buffer_fifo_init_count);
     SVT_LOG("\nSVT [config]: CPCS / PAREF / REF \t\t\t\t\t\t: %d / %d / %d", scs->picture_control_set_pool_init_count_child, scs->pa_reference_picture_buffer_init_count, scs->reference_picture_buffer_init_count);
@@ -3295,10 +4160,11 @@ static void print_lib_params(
         scs->mode_decision_configuration_process_init_count,
         scs->enc_dec_process_init_count,
         scs->entropy_coding_process_init_count);
-    SVT_LOG("\nSVT [config]: DLF_P / CDEF_P / REST_P \t\t\t\t\t\t: %d / %d / %d",
+    SVT_LOG("\nSVT [config]: DLF_P / CDEF_P / REST_P / METRICS_P \t\t\t\t\t: %d / %d / %d / %d",
         scs->dlf_process_init_count,
         scs->cdef_process_init_count,
-        scs->rest_process_init_count);
+        scs->rest_process_init_count,
+        scs->metrics_process_init_count);
 #endif
     SVT_LOG("\n------------------------------------------- ");
     SVT_LOG("\n");
@@ -3623,6 +4489,78 @@ static void copy_input_buffer(
         copy_frame_buffer(sequenceControlSet, dst->p_buffer, src->p_buffer);
 }
 
+/***********************************************
+**** Check that the planes of a picture sent in
+**** zero-copy mode follow the input layout
+************************************************/
+static EbErrorType verify_zero_copy_frame_buffer(
+    SequenceControlSet *scs_ptr,
+    EbSvtIOFormat      *input_ptr)
+{
+    SvtAv1InputLayout layout;
+    EbBool            is_16bit_input = (EbBool)(scs_ptr->static_config.encoder_bit_depth > EB_8BIT);
+
+    get_input_layout(scs_ptr, &layout);
+    if (input_ptr->y_stride != layout.y_stride || input_ptr->cb_stride != layout.chroma_stride ||
+        input_ptr->cr_stride != layout.chroma_stride) {
+        SVT_LOG("Error: zero-copy input strides must be %u / %u\n", layout.y_stride, layout.chroma_stride);
+        return EB_ErrorBadParameter;
+    }
+    if (!input_ptr->luma || !input_ptr->cb || !input_ptr->cr ||
+        (is_16bit_input && (!input_ptr->luma_ext || !input_ptr->cb_ext || !input_ptr->cr_ext))) {
+        SVT_LOG("Error: zero-copy input plane missing\n");
+        return EB_ErrorBadParameter;
+    }
+    if (((uintptr_t)(input_ptr->luma - layout.luma_offset) |
+         (uintptr_t)(input_ptr->cb - layout.chroma_offset) |
+         (uintptr_t)(input_ptr->cr - layout.chroma_offset)) % layout.alignment ||
+        (is_16bit_input &&
+         ((uintptr_t)(input_ptr->luma_ext - layout.luma_offset) |
+          (uintptr_t)(input_ptr->cb_ext - layout.chroma_offset) |
+          (uintptr_t)(input_ptr->cr_ext - layout.chroma_offset)) % layout.alignment)) {
+        SVT_LOG("Error: zero-copy input buffers must be aligned on %u bytes\n", layout.alignment);
+        return EB_ErrorBadParameter;
+    }
+    return EB_ErrorNone;
+}
+
+/***********************************************
+**** Reference the caller planes from the
+**** library buffer in zero-copy mode
+************************************************/
+static void reference_input_buffer(
+    SequenceControlSet     *scs_ptr,
+    EbBufferHeaderType     *dst,
+    EbBufferHeaderType     *src)
+{
+    EbPictureBufferDesc *input_picture_ptr = (EbPictureBufferDesc*)dst->p_buffer;
+    EbSvtIOFormat       *input_ptr = (EbSvtIOFormat*)src->p_buffer;
+    SvtAv1InputLayout    layout;
+
+    // Copy the higher level structure
+    dst->n_alloc_len = src->n_alloc_len;
+    dst->n_filled_len = src->n_filled_len;
+    dst->flags = src->flags;
+    dst->pts = src->pts;
+    dst->n_tick_count = src->n_tick_count;
+    dst->size = src->size;
+    dst->qp = src->qp;
+    dst->pic_type = src->pic_type;
+    dst->p_app_private = src->p_app_private;
+
+    if (input_ptr == NULL)
+        return;
+    get_input_layout(scs_ptr, &layout);
+    input_picture_ptr->buffer_y = input_ptr->luma - layout.luma_offset;
+    input_picture_ptr->buffer_cb = input_ptr->cb - layout.chroma_offset;
+    input_picture_ptr->buffer_cr = input_ptr->cr - layout.chroma_offset;
+    if (scs_ptr->static_config.encoder_bit_depth > EB_8BIT) {
+        input_picture_ptr->buffer_bit_inc_y = input_ptr->luma_ext - layout.luma_offset;
+        input_picture_ptr->buffer_bit_inc_cb = input_ptr->cb_ext - layout.chroma_offset;
+        input_picture_ptr->buffer_bit_inc_cr = input_ptr->cr_ext - layout.chroma_offset;
+    }
+}
+
 /**********************************
 * Empty This Buffer
 **********************************/
@@ -3631,18 +4569,33 @@ EB_API EbErrorType svt_av1_enc_send_picture(
     EbBufferHeaderType   *p_buffer)
 {
     EbEncHandle          *enc_handle_ptr = (EbEncHandle*)svt_enc_component->p_component_private;
+    SequenceControlSet   *scs_ptr = enc_handle_ptr->scs_instance_array[0]->scs_ptr;
     EbObjectWrapper      *eb_wrapper_ptr;
 
+    // Reject the picture before taking an input buffer
+    if (scs_ptr->static_config.zero_copy_input && p_buffer != NULL && p_buffer->p_buffer != NULL) {
+        EbErrorType return_error = verify_zero_copy_frame_buffer(
+            scs_ptr, (EbSvtIOFormat*)p_buffer->p_buffer);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+    }
+
     // Take the buffer and put it into our internal queue structure
     svt_get_empty_object(
         enc_handle_ptr->input_buffer_producer_fifo_ptr,
         &eb_wrapper_ptr);
 
     if (p_buffer != NULL) {
-        copy_input_buffer(
-            enc_handle_ptr->scs_instance_array[0]->scs_ptr,
-            (EbBufferHeaderType*)eb_wrapper_ptr->object_ptr,
-            p_buffer);
+        if (scs_ptr->static_config.zero_copy_input)
+            reference_input_buffer(
+                scs_ptr,
+                (EbBufferHeaderType*)eb_wrapper_ptr->object_ptr,
+                p_buffer);
+        else
+            copy_input_buffer(
+                scs_ptr,
+                (EbBufferHeaderType*)eb_wrapper_ptr->object_ptr,
+                p_buffer);
     }
 
     svt_post_full_object(eb_wrapper_ptr);
@@ -3693,7 +4646,7 @@ EB_API EbErrorType svt_av1_enc_get_packet(
 
     if (eb_wrapper_ptr) {
         packet = (EbBufferHeaderType*)eb_wrapper_ptr->object_ptr;
-        if ( packet->flags & 0xfffffff0 )
+        if ( packet->flags & EB_BUFFERFLAG_ERROR_MASK )
             return_error = EB_ErrorMax;
         // return the output stream buffer
         *p_buffer = packet;
@@ -3713,6 +4666,7 @@ EB_API void svt_av1_enc_release_out_buffer(
     {
         if((*p_buffer)->p_buffer)
            EB_FREE((*p_buffer)->p_buffer);
+        svt_aom_free_frame_stats(*p_buffer);
         // Release out put buffer back into the pool
         svt_release_object((EbObjectWrapper  *)(*p_buffer)->wrapper_ptr);
      }
@@ -3777,6 +4731,8 @@ void lib_svt_encoder_send_error_exit(
     output_packet->size     = 0;
     output_packet->flags    = error_code;
     output_packet->p_buffer   = NULL;
+    output_packet->frame_stats = NULL;
+    output_packet->frame_stats_count = 0;
 
     svt_post_full_object(eb_wrapper_ptr);
 }
@@ -3821,39 +4777,18 @@ EbErrorType init_svt_av1_encoder_handle(
 
 static EbErrorType allocate_frame_buffer(
     SequenceControlSet       *scs_ptr,
-    EbBufferHeaderType        *input_buffer)
+    EbBufferHeaderType        *input_buffer,
+    EbBool                     zero_copy)
 {
     EbErrorType   return_error = EB_ErrorNone;
     EbPictureBufferDescInitData input_pic_buf_desc_init_data;
     EbSvtAv1EncConfiguration   * config = &scs_ptr->static_config;
     uint8_t is_16bit = config->encoder_bit_depth > 8 ? 1 : 0;
 
-    input_pic_buf_desc_init_data.max_width =
-        !(scs_ptr->max_input_luma_width % 8) ?
-        scs_ptr->max_input_luma_width :
-        scs_ptr->max_input_luma_width + (scs_ptr->max_input_luma_width % 8);
-
-    input_pic_buf_desc_init_data.max_height =
-        !(scs_ptr->max_input_luma_height % 8) ?
-        scs_ptr->max_input_luma_height :
-        scs_ptr->max_input_luma_height + (scs_ptr->max_input_luma_height % 8);
-
-    input_pic_buf_desc_init_data.bit_depth = (EbBitDepthEnum)config->encoder_bit_depth;
-    input_pic_buf_desc_init_data.color_format = (EbColorFormat)config->encoder_color_format;
-
-    input_pic_buf_desc_init_data.left_padding = scs_ptr->left_padding;
-    input_pic_buf_desc_init_data.right_padding = scs_ptr->right_padding;
-    input_pic_buf_desc_init_data.top_padding = scs_ptr->top_padding;
-    input_pic_buf_desc_init_data.bot_padding = scs_ptr->bot_padding;
-
-    input_pic_buf_desc_init_data.split_mode = is_16bit ? EB_TRUE : EB_FALSE;
-
-    input_pic_buf_desc_init_data.buffer_enable_mask = PICTURE_BUFFER_DESC_FULL_MASK;
-    input_pic_buf_desc_init_data.is_16bit_pipeline = 0;
-
-    if (is_16bit && config->compressed_ten_bit_format == 1)
-        //do special allocation for 2bit data down below.
-        input_pic_buf_desc_init_data.split_mode = EB_FALSE;
+    init_input_pic_buf_desc_data(scs_ptr, &input_pic_buf_desc_init_data);
+    // In zero-copy mode the planes are referenced by svt_av1_enc_send_picture
+    if (zero_copy)
+        input_pic_buf_desc_init_data.buffer_enable_mask = 0;
 
     // Enhanced Picture Buffer
     {
@@ -3864,7 +4799,7 @@ static EbErrorType allocate_frame_buffer(
             (EbPtr)&input_pic_buf_desc_init_data);
         input_buffer->p_buffer = (uint8_t*)buf;
 
-        if (is_16bit && config->compressed_ten_bit_format == 1) {
+        if (is_16bit && config->compressed_ten_bit_format == 1 && !zero_copy) {
             //pack 4 2bit pixels into 1Byte
             EB_MALLOC_ALIGNED_ARRAY(buf->buffer_bit_inc_y,
                  (input_pic_buf_desc_init_data.max_width / 4)*
@@ -3883,13 +4818,13 @@ static EbErrorType allocate_frame_buffer(
 /**************************************
 * EbBufferHeaderType Constructor
 **************************************/
-EbErrorType svt_input_buffer_header_creator(
-    EbPtr *object_dbl_ptr,
-    EbPtr  object_init_data_ptr)
+static EbErrorType create_input_buffer_header(
+    EbPtr              *object_dbl_ptr,
+    SequenceControlSet *scs_ptr,
+    EbBool              zero_copy)
 {
     EbErrorType return_error = EB_ErrorNone;
     EbBufferHeaderType* input_buffer;
-    SequenceControlSet        *scs_ptr = (SequenceControlSet*)object_init_data_ptr;
 
     *object_dbl_ptr = NULL;
     EB_CALLOC(input_buffer, 1, sizeof(EbBufferHeaderType));
@@ -3899,7 +4834,8 @@ EbErrorType svt_input_buffer_header_creator(
 
     return_error = allocate_frame_buffer(
         scs_ptr,
-        input_buffer);
+        input_buffer,
+        zero_copy);
     if (return_error != EB_ErrorNone)
         return return_error;
 
@@ -3908,6 +4844,26 @@ EbErrorType svt_input_buffer_header_creator(
     return EB_ErrorNone;
 }
 
+EbErrorType svt_input_buffer_header_creator(
+    EbPtr *object_dbl_ptr,
+    EbPtr  object_init_data_ptr)
+{
+    return create_input_buffer_header(
+        object_dbl_ptr, (SequenceControlSet*)object_init_data_ptr, EB_FALSE);
+}
+
+/**************************************
+* EbBufferHeaderType Constructor for the
+* zero-copy input: no plane is allocated
+**************************************/
+EbErrorType svt_zero_copy_input_buffer_header_creator(
+    EbPtr *object_dbl_ptr,
+    EbPtr  object_init_data_ptr)
+{
+    return create_input_buffer_header(
+        object_dbl_ptr, (SequenceControlSet*)object_init_data_ptr, EB_TRUE);
+}
+
 void svt_input_buffer_header_destroyer(    EbPtr p)
 {
     EbBufferHeaderType *obj = (EbBufferHeaderType*)p;
@@ -3922,6 +4878,16 @@ void svt_input_buffer_header_destroyer(    EbPtr p)
     EB_FREE(obj);
 }
 
+void svt_zero_copy_input_buffer_header_destroyer(    EbPtr p)
+{
+    // The planes belong to the caller
+    EbBufferHeaderType *obj = (EbBufferHeaderType*)p;
+    EbPictureBufferDesc* buf = (EbPictureBufferDesc*)obj->p_buffer;
+
+    EB_DELETE(buf);
+    EB_FREE(obj);
+}
+
 /**************************************
 * EbBufferHeaderType Constructor
 **************************************/
@@ -4001,6 +4967,31 @@ EB_API EbErrorType svt_av1_enc_get_stream_info(EbComponentType *    svt_enc_comp
         return EB_ErrorBadParameter;
     }
     EbEncHandle         *enc_handle = (EbEncHandle*)svt_enc_component->p_component_private;
+    if (stream_info_id == SVT_AV1_STREAM_INFO_INPUT_LAYOUT) {
+        get_input_layout(enc_handle->scs_instance_array[0]->scs_ptr, (SvtAv1InputLayout*)info);
+        return EB_ErrorNone;
+    }
+    if (stream_info_id == SVT_AV1_STREAM_INFO_MEMORY_LOCALITY) {
+        get_memory_locality(enc_handle, (SvtAv1MemoryLocality*)info);
+        return EB_ErrorNone;
+    }
+    if (stream_info_id == SVT_AV1_STREAM_INFO_PIPELINE_PROFILE) {
+        if (!enc_handle->profiler)
+            return EB_ErrorBadParameter;
+        svt_profiler_get_profile(enc_handle->profiler, (SvtAv1PipelineProfile*)info);
+        return EB_ErrorNone;
+    }
+    if (stream_info_id == SVT_AV1_STREAM_INFO_PIPELINE_TRACE) {
+        if (!enc_handle->profiler || enc_handle->profiler->level < 2)
+            return EB_ErrorBadParameter;
+        EbErrorType return_error = svt_profiler_build_trace(enc_handle->profiler);
+        if (return_error != EB_ErrorNone)
+            return return_error;
+        SvtAv1FixedBuf *trace = (SvtAv1FixedBuf*)info;
+        trace->buf = enc_handle->profiler->trace;
+        trace->sz = enc_handle->profiler->trace_size;
+        return EB_ErrorNone;
+    }
     if (stream_info_id == SVT_AV1_STREAM_INFO_FIRST_PASS_STATS_OUT) {
         EncodeContext*      context = enc_handle->scs_instance_array[0]->encode_context_ptr;
         SvtAv1FixedBuf*     first_pass_stats = (SvtAv1FixedBuf*)info;
@@ -18,12 +18,52 @@
 #include "EbSystemResourceManager.h"
 #include "EbSequenceControlSet.h"
 #include "EbObject.h"
+#include "EbLadderAnalysis.h"
+
+/* Pipeline stages, in the order pictures go through them, placed on a NUMA
+ * node each when numa_policy is 2 and profiled as a whole when
+ * pipeline_profile is set */
+typedef enum NumaStage {
+    NUMA_STAGE_RESOURCE_COORDINATION,
+    NUMA_STAGE_PICTURE_ANALYSIS,
+    NUMA_STAGE_PICTURE_DECISION,
+    NUMA_STAGE_MOTION_ESTIMATION,
+    NUMA_STAGE_INITIAL_RATE_CONTROL,
+    NUMA_STAGE_SOURCE_BASED_OPERATIONS,
+    NUMA_STAGE_PICTURE_MANAGER,
+    NUMA_STAGE_INLOOP_ME,
+    NUMA_STAGE_RATE_CONTROL,
+    NUMA_STAGE_MODE_DECISION_CONFIGURATION,
+    NUMA_STAGE_ENC_DEC,
+    NUMA_STAGE_DLF,
+    NUMA_STAGE_CDEF,
+    NUMA_STAGE_REST,
+    NUMA_STAGE_METRICS,
+    NUMA_STAGE_ENTROPY_CODING,
+    NUMA_STAGE_PACKETIZATION,
+    NUMA_STAGE_COUNT
+} NumaStage;
 
 struct _EbThreadContext {
     EbDctor dctor;
     EbPtr   priv;
 };
 
+/**************************************
+ * Shared Encoder Context
+ **************************************/
+struct SvtAv1EncContext {
+    EbHandle  worker_pool;
+    CPU_FLAGS use_cpu_flags;
+    EbHandle  mutex;
+    // Initialized handles attached to the context, and the super block size
+    // the block geometry was built for while there are any
+    uint32_t handle_count;
+    uint16_t sb_size;
+    // Analysis shared by the renditions set with ladder_analysis
+    LadderAnalysis ladder;
+};
+
 /**************************************
  * Component Private Data
  **************************************/
@@ -76,9 +116,25 @@ struct _EbEncHandle {
     EbHandle *dlf_thread_handle_array;
     EbHandle *cdef_thread_handle_array;
     EbHandle *rest_thread_handle_array;
+    EbHandle *metrics_thread_handle_array;
 
     EbHandle packetization_thread_handle;
 
+    // Workers owned by the handle when enable_worker_pool is set
+    EbHandle worker_pool;
+    // Group of the processing threads on the workers of the handle or of its
+    // shared context
+    EbHandle worker_group;
+    // Shared context the handle is attached to once initialized
+    SvtAv1EncContext *shared_context;
+    // Activity of the processing threads when pipeline_profile is set
+    struct EbProfiler *profiler;
+
+    // NUMA node of each pipeline stage and number of threads placed on each
+    // node, see numa_policy
+    uint32_t numa_stage_node[NUMA_STAGE_COUNT];
+    uint32_t numa_threads[SVT_AV1_MAX_NUMA_NODES];
+
     // Contexts
     EbThreadContext * resource_coordination_context_ptr;
     EbThreadContext **picture_analysis_context_ptr_array;
@@ -95,6 +151,7 @@ struct _EbEncHandle {
     EbThreadContext **dlf_context_ptr_array;
     EbThreadContext **cdef_context_ptr_array;
     EbThreadContext **rest_context_ptr_array;
+    EbThreadContext **metrics_context_ptr_array;
     EbThreadContext * packetization_context_ptr;
 
     // System Resource Managers
@@ -117,6 +174,7 @@ struct _EbEncHandle {
     EbSystemResource * dlf_results_resource_ptr;
     EbSystemResource * cdef_results_resource_ptr;
     EbSystemResource * rest_results_resource_ptr;
+    EbSystemResource * metrics_tasks_resource_ptr;
 
     // Callbacks
     EbCallback **app_callback_ptr_array;
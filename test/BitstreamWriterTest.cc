@@ -293,4 +293,67 @@ TEST(Entropy_BitstreamWriter, write_symbol_with_update) {
                   rnd(gen));
     }
 }
+TEST(Entropy_BitstreamWriter, write_multi_symbols_with_update) {
+    AomWriter bw;
+    memset(&bw, 0, sizeof(bw));
+
+    const int buffer_size = 16384;
+    uint8_t stream_buffer[buffer_size];
+    bw.allow_update_cdf = 1;
+
+    // get default cdf, the eob cdfs cover the alphabets of 5 to 11 symbols
+    const int base_qindex = 20;
+    FRAME_CONTEXT enc_fc, dec_fc;
+    memset(&enc_fc, 0, sizeof(enc_fc));
+    memset(&dec_fc, 0, sizeof(dec_fc));
+    svt_av1_default_coef_probs(&enc_fc, base_qindex);
+    svt_av1_default_coef_probs(&dec_fc, base_qindex);
+
+    const int num_cdfs = 9;
+    AomCdfProb *enc_cdfs[num_cdfs] = {enc_fc.coeff_base_eob_cdf[0][0][0],
+                                      enc_fc.coeff_base_cdf[0][0][0],
+                                      enc_fc.eob_flag_cdf16[0][0],
+                                      enc_fc.eob_flag_cdf32[0][0],
+                                      enc_fc.eob_flag_cdf64[0][0],
+                                      enc_fc.eob_flag_cdf128[0][0],
+                                      enc_fc.eob_flag_cdf256[0][0],
+                                      enc_fc.eob_flag_cdf512[0][0],
+                                      enc_fc.eob_flag_cdf1024[1][1]};
+    AomCdfProb *dec_cdfs[num_cdfs] = {dec_fc.coeff_base_eob_cdf[0][0][0],
+                                      dec_fc.coeff_base_cdf[0][0][0],
+                                      dec_fc.eob_flag_cdf16[0][0],
+                                      dec_fc.eob_flag_cdf32[0][0],
+                                      dec_fc.eob_flag_cdf64[0][0],
+                                      dec_fc.eob_flag_cdf128[0][0],
+                                      dec_fc.eob_flag_cdf256[0][0],
+                                      dec_fc.eob_flag_cdf512[0][0],
+                                      dec_fc.eob_flag_cdf1024[1][1]};
+    const int nsymbs[num_cdfs] = {3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    // skewed random symbols, so that the cdfs move away from the defaults
+    const int total_symbols = 4000;
+    int cdf_idx[total_symbols], symbols[total_symbols];
+    SVTRandom rnd_cdf(0, num_cdfs - 1), rnd_symb(0, 1 << 16);
+    for (int i = 0; i < total_symbols; ++i) {
+        cdf_idx[i] = rnd_cdf.random();
+        const int r = rnd_symb.random();
+        symbols[i] = (r & 1 ? r >> 1 : r >> 3) % nsymbs[cdf_idx[i]];
+    }
+
+    aom_start_encode(&bw, stream_buffer);
+    for (int i = 0; i < total_symbols; ++i)
+        aom_write_symbol(&bw, symbols[i], enc_cdfs[cdf_idx[i]], nsymbs[cdf_idx[i]]);
+    aom_stop_encode(&bw);
+
+    SvtReader br;
+    init_svt_reader(&br, stream_buffer, stream_buffer + buffer_size, bw.pos, 1);
+    for (int i = 0; i < total_symbols; ++i) {
+        ASSERT_EQ(svt_read_symbol(&br, dec_cdfs[cdf_idx[i]], nsymbs[cdf_idx[i]], nullptr),
+                  symbols[i])
+            << "pos: " << i << " nsymbs: " << nsymbs[cdf_idx[i]];
+    }
+
+    // the decoder adaptation must match the encoder one
+    EXPECT_EQ(memcmp(&enc_fc, &dec_fc, sizeof(enc_fc)), 0);
+}
 }  // namespace
@@ -232,6 +232,10 @@ TEST_CLASS(BlendA64MaskTest8B, svt_aom_blend_a64_mask_c, svt_aom_blend_a64_mask_
            Mask_Blend_SSE4_1)
 TEST_CLASS(BlendA64MaskTest8B, svt_aom_blend_a64_mask_sse4_1,
            svt_aom_blend_a64_mask_avx2, Mask_Blend_AVX2)
+#if EN_AVX512_SUPPORT
+TEST_CLASS(BlendA64MaskTest8B, svt_aom_blend_a64_mask_c,
+           svt_aom_blend_a64_mask_avx512, Mask_Blend_AVX512)
+#endif  // EN_AVX512_SUPPORT
 
 //////////////////////////////////////////////////////////////////////////////
 // 8 bit _d16 version
@@ -27,6 +27,11 @@
 #include "acm_random.h"
 #include "noise_model.h"
 #include "aom_dsp_rtcd.h"
+#include "common_dsp_rtcd.h"
+#include "random.h"
+#include "EbTime.h"
+
+using svt_av1_test_tool::SVTRandom;
 
 static AomFilmGrain film_grain_test_vectors[3] = {
     /* Test 1 */
@@ -205,6 +210,8 @@ class AddFilmGrainTest : public ::testing::Test {
     static const int chroma_size = luma_size >> 2;
 
     void SetUp() override {
+        // the grain is added by the common rtcd kernels
+        setup_common_rtcd_internal(get_cpu_flags_to_use());
         luma_ = (uint8_t *)svt_aom_malloc(luma_size);
         cb_ = (uint8_t *)svt_aom_malloc(chroma_size);
         cr_ = (uint8_t *)svt_aom_malloc(chroma_size);
@@ -267,6 +274,228 @@ TEST_F(AddFilmGrainTest, MatchTest) {
     }
 }
 
+// Kernels adding the film grain to the samples of a 32x32 block, the C and
+// the AVX2 version must be bit exact for all the bit depths.
+class FilmGrainKernelTest : public ::testing::TestWithParam<int> {
+  public:
+    static const int kMaxSize = 64;
+    static const int kStride  = 80;
+
+    FilmGrainKernelTest()
+        : bd_(GetParam()), sample_rnd_(0, (1 << GetParam()) - 1), lut_rnd_(0, 255) {
+    }
+
+    void SetUp() override {
+        setup_common_rtcd_internal(get_cpu_flags_to_use());
+    }
+
+  protected:
+    void prepare_data(int seed, int scaling_shift) {
+        const int grain_center = 128 << (bd_ - 8);
+        SVTRandom grain_rnd(-grain_center, grain_center - 1);
+        // alternate random data with the extreme values
+        for (int i = 0; i < kMaxSize * kStride; i++) {
+            const int v = seed == 0 ? (1 << bd_) - 1 : seed == 1 ? 0 : sample_rnd_.random();
+            luma_[i] = chroma_ref_[i] = chroma_tst_[i] = (uint16_t)v;
+            grain_[i] = seed == 0 ? grain_center - 1 : seed == 1 ? -grain_center
+                                                                 : grain_rnd.random();
+        }
+        for (int i = 0; i < 256; i++) lut_[i] = seed < 2 ? 255 : lut_rnd_.random();
+        scaling_.scaling_lut   = lut_;
+        scaling_.scaling_shift = scaling_shift;
+        scaling_.bit_depth     = bd_;
+        if (seed & 1) {
+            scaling_.min_val = 16 << (bd_ - 8);
+            scaling_.max_val = 235 << (bd_ - 8);
+        } else {
+            scaling_.min_val = 0;
+            scaling_.max_val = (256 << (bd_ - 8)) - 1;
+        }
+        if (seed % 3 == 2) {
+            // chroma scaling from luma
+            scaling_.mult      = 0;
+            scaling_.luma_mult = 64;
+            scaling_.offset    = 0;
+        } else {
+            SVTRandom mult_rnd(-128, 127), offset_rnd(0, 511);
+            scaling_.mult      = mult_rnd.random();
+            scaling_.luma_mult = mult_rnd.random();
+            scaling_.offset    = (offset_rnd.random() << (bd_ - 8)) - (1 << bd_);
+        }
+    }
+
+    void to_8bit(const uint16_t *src, uint8_t *dst) {
+        for (int i = 0; i < kMaxSize * kStride; i++) dst[i] = (uint8_t)src[i];
+    }
+
+    void check_equal(const uint16_t *ref, const uint16_t *tst, int w, int h) {
+        for (int i = 0; i < h; i++)
+            for (int j = 0; j < w; j++)
+                ASSERT_EQ(ref[i * kStride + j], tst[i * kStride + j])
+                    << "bd " << bd_ << " w " << w << " h " << h << " at " << i << "x" << j;
+        // nothing is written out of the block
+        for (int i = 0; i < kMaxSize * kStride; i++) ASSERT_EQ(ref[i], tst[i]);
+    }
+
+    void check_equal(const uint8_t *ref, const uint8_t *tst, int w, int h) {
+        for (int i = 0; i < h; i++)
+            for (int j = 0; j < w; j++)
+                ASSERT_EQ(ref[i * kStride + j], tst[i * kStride + j])
+                    << "w " << w << " h " << h << " at " << i << "x" << j;
+        for (int i = 0; i < kMaxSize * kStride; i++) ASSERT_EQ(ref[i], tst[i]);
+    }
+
+    void run_luma_test() {
+        const int sizes[] = {1, 2, 6, 8, 14, 16, 30, 32, 64};
+        for (int seed = 0; seed < 6; seed++) {
+            for (int shift = 8; shift <= 11; shift++) {
+                prepare_data(seed, shift);
+                for (int w : sizes) {
+                    for (int h : sizes) {
+                        memcpy(chroma_ref_, luma_, sizeof(luma_));
+                        memcpy(chroma_tst_, luma_, sizeof(luma_));
+                        svt_av1_highbd_add_luma_grain_c(
+                            chroma_ref_, kStride, grain_, kStride, w, h, &scaling_);
+                        svt_av1_highbd_add_luma_grain_avx2(
+                            chroma_tst_, kStride, grain_, kStride, w, h, &scaling_);
+                        check_equal(chroma_ref_, chroma_tst_, w, h);
+                        if (bd_ != 8)
+                            continue;
+                        to_8bit(luma_, luma8_ref_);
+                        to_8bit(luma_, luma8_tst_);
+                        svt_av1_add_luma_grain_c(
+                            luma8_ref_, kStride, grain_, kStride, w, h, &scaling_);
+                        svt_av1_add_luma_grain_avx2(
+                            luma8_tst_, kStride, grain_, kStride, w, h, &scaling_);
+                        check_equal(luma8_ref_, luma8_tst_, w, h);
+                    }
+                }
+            }
+        }
+    }
+
+    void run_chroma_test() {
+        const int sizes[]       = {1, 2, 7, 8, 15, 16, 31, 32};
+        const int subsamp[3][2] = {{1, 1}, {1, 0}, {0, 0}};
+        for (int seed = 0; seed < 6; seed++) {
+            prepare_data(seed, 8 + seed % 4);
+            for (int s = 0; s < 3; s++) {
+                const int ss_x = subsamp[s][0], ss_y = subsamp[s][1];
+                for (int w : sizes) {
+                    for (int h : sizes) {
+                        memcpy(chroma_tst_, chroma_ref_, sizeof(chroma_ref_));
+                        svt_av1_highbd_add_chroma_grain_c(
+                            chroma_ref_, kStride, luma_, kStride, grain_, kStride, w, h, ss_x,
+                            ss_y, &scaling_);
+                        svt_av1_highbd_add_chroma_grain_avx2(
+                            chroma_tst_, kStride, luma_, kStride, grain_, kStride, w, h, ss_x,
+                            ss_y, &scaling_);
+                        check_equal(chroma_ref_, chroma_tst_, w, h);
+                        if (bd_ != 8)
+                            continue;
+                        uint8_t luma8[kMaxSize * kStride];
+                        to_8bit(luma_, luma8);
+                        to_8bit(chroma_ref_, luma8_ref_);
+                        to_8bit(chroma_ref_, luma8_tst_);
+                        svt_av1_add_chroma_grain_c(luma8_ref_, kStride, luma8, kStride, grain_,
+                                                   kStride, w, h, ss_x, ss_y, &scaling_);
+                        svt_av1_add_chroma_grain_avx2(luma8_tst_, kStride, luma8, kStride,
+                                                      grain_, kStride, w, h, ss_x, ss_y,
+                                                      &scaling_);
+                        check_equal(luma8_ref_, luma8_tst_, w, h);
+                    }
+                }
+            }
+        }
+    }
+
+    void run_overlap_test() {
+        const int grain_min = -(128 << (bd_ - 8));
+        const int grain_max = (128 << (bd_ - 8)) - 1;
+        int32_t   dst_ref[2 * kStride], dst_tst[2 * kStride];
+        for (int seed = 0; seed < 3; seed++) {
+            prepare_data(seed, 8);
+            for (int h = 1; h <= 2; h++) {
+                for (int w = 1; w <= 34; w++) {
+                    memcpy(dst_ref, grain_ + 4 * kStride, sizeof(dst_ref));
+                    memcpy(dst_tst, grain_ + 4 * kStride, sizeof(dst_tst));
+                    svt_av1_grain_hor_boundary_overlap_c(grain_, kStride, grain_ + 2 * kStride,
+                                                         kStride, dst_ref, kStride, w, h,
+                                                         grain_min, grain_max);
+                    svt_av1_grain_hor_boundary_overlap_avx2(grain_, kStride,
+                                                            grain_ + 2 * kStride, kStride,
+                                                            dst_tst, kStride, w, h,
+                                                            grain_min, grain_max);
+                    for (int i = 0; i < 2 * kStride; i++)
+                        ASSERT_EQ(dst_ref[i], dst_tst[i]) << "w " << w << " h " << h;
+                }
+            }
+        }
+    }
+
+    void run_speed_test() {
+        const int num_loops = 200000;
+        uint64_t  start_time_seconds, start_time_useconds;
+        uint64_t  middle_time_seconds, middle_time_useconds;
+        uint64_t  finish_time_seconds, finish_time_useconds;
+
+        prepare_data(3, 10);
+        svt_av1_get_time(&start_time_seconds, &start_time_useconds);
+        for (int i = 0; i < num_loops; i++) {
+            svt_av1_highbd_add_chroma_grain_c(
+                chroma_ref_, kStride, luma_, kStride, grain_, kStride, 16, 16, 1, 1, &scaling_);
+            svt_av1_highbd_add_luma_grain_c(
+                chroma_ref_, kStride, grain_, kStride, 32, 32, &scaling_);
+        }
+        svt_av1_get_time(&middle_time_seconds, &middle_time_useconds);
+        for (int i = 0; i < num_loops; i++) {
+            svt_av1_highbd_add_chroma_grain_avx2(
+                chroma_tst_, kStride, luma_, kStride, grain_, kStride, 16, 16, 1, 1, &scaling_);
+            svt_av1_highbd_add_luma_grain_avx2(
+                chroma_tst_, kStride, grain_, kStride, 32, 32, &scaling_);
+        }
+        svt_av1_get_time(&finish_time_seconds, &finish_time_useconds);
+
+        const double time_c = svt_av1_compute_overall_elapsed_time_ms(
+            start_time_seconds, start_time_useconds, middle_time_seconds, middle_time_useconds);
+        const double time_o = svt_av1_compute_overall_elapsed_time_ms(
+            middle_time_seconds, middle_time_useconds, finish_time_seconds, finish_time_useconds);
+        printf("    bd %2d: add grain to 32x32 4:2:0 blocks, AVX2 %6.2fx faster than C\n",
+               bd_,
+               time_c / time_o);
+    }
+
+    const int    bd_;
+    SVTRandom    sample_rnd_;
+    SVTRandom    lut_rnd_;
+    GrainScaling scaling_;
+    int32_t      lut_[256];
+    int32_t      grain_[kMaxSize * kStride];
+    uint16_t     luma_[kMaxSize * kStride];
+    uint16_t     chroma_ref_[kMaxSize * kStride];
+    uint16_t     chroma_tst_[kMaxSize * kStride];
+    uint8_t      luma8_ref_[kMaxSize * kStride];
+    uint8_t      luma8_tst_[kMaxSize * kStride];
+};
+
+TEST_P(FilmGrainKernelTest, LumaMatchTest) {
+    run_luma_test();
+}
+
+TEST_P(FilmGrainKernelTest, ChromaMatchTest) {
+    run_chroma_test();
+}
+
+TEST_P(FilmGrainKernelTest, OverlapMatchTest) {
+    run_overlap_test();
+}
+
+TEST_P(FilmGrainKernelTest, DISABLED_speed) {
+    run_speed_test();
+}
+
+INSTANTIATE_TEST_CASE_P(AVX2, FilmGrainKernelTest, ::testing::Values(8, 10, 12));
+
 extern "C" {
 #include "EbPictureControlSet.h"
 #include "EbPictureBufferDesc.h"
@@ -19,6 +19,7 @@
  * - ransac_affine_double_prec
  * - ransac_rotzoom_double_prec
  * - ransac_translation_double_prec
+ * - svt_av1_ransac_find_inliers
  *
  * @author Cidana-Edmond
  *
@@ -35,12 +36,17 @@
 #endif
 #include "EbDefinitions.h"
 #include "EbUtility.h"
+#include "EbTime.h"
+#include "aom_dsp_rtcd.h"
 extern "C" {
 #include "ransac.h"
 }
 #include "random.h"
 #include "util.h"
 
+/** setup_test_env is implemented in test/TestEnv.c */
+extern "C" void setup_test_env();
+
 using std::tuple;
 using std::vector;
 using svt_av1_test_tool::SVTRandom;
@@ -96,6 +102,7 @@ class RansacTest : public ::testing::TestWithParam<TransformationType> {
         data_.clear();
         ref_.clear();
         memset(&mat_, 0, sizeof(mat_));
+        setup_test_env();
     }
 
     void generate_data(int count, int &inliers) {
@@ -381,4 +388,135 @@ TEST_P(RansacDoubleTest, CheckOutput) {
 INSTANTIATE_TEST_CASE_P(GlobalMotion, RansacDoubleTest,
                         ::testing::ValuesIn(transform_table));
 
+using RansacFindInliersFunc = int (*)(const double *mat, const double *corners1,
+                                      const double *corners2, int npoints,
+                                      double threshold, int *inlier_indices,
+                                      double *sum_distance,
+                                      double *sum_distance_squared);
+
+/**
+ * @brief Unit test for the inlier search of RANSAC:
+ * - svt_av1_ransac_find_inliers_avx2
+ *
+ * Test strategy:
+ * Project random points by random affine models, half of them near their
+ * matches, and search the inliers with the C and the optimized functions.
+ *
+ * Expected result:
+ * The inlier indices, their number and the sums of their distances are
+ * identical.
+ */
+class RansacFindInliersTest
+    : public ::testing::TestWithParam<RansacFindInliersFunc> {
+  protected:
+    RansacFindInliersTest() : rnd_(0, CoordinateMax) {
+        setup_test_env();
+    }
+
+    void prepare_data(int npoints) {
+        mat_[0] = (double)(rnd_.random() >> 6) - 512;
+        mat_[1] = (double)(rnd_.random() >> 6) - 512;
+        for (int i = 2; i < MAX_PARAMDIM; i++)
+            mat_[i] = (double)(rnd_.random() % 2000) / 1000.0 - 1.0;
+        for (int i = 0; i < npoints; i++) {
+            const double x = rnd_.random(), y = rnd_.random();
+            corners1_[2 * i] = x;
+            corners1_[2 * i + 1] = y;
+            if (rnd_.random() % 2) {
+                /** a match within about 2 pixels of the projection */
+                corners2_[2 * i] = mat_[2] * x + mat_[3] * y + mat_[0] +
+                                   (double)(rnd_.random() % 400) / 100 - 2;
+                corners2_[2 * i + 1] = mat_[4] * x + mat_[5] * y + mat_[1] +
+                                       (double)(rnd_.random() % 400) / 100 - 2;
+            } else {
+                corners2_[2 * i] = rnd_.random();
+                corners2_[2 * i + 1] = rnd_.random();
+            }
+        }
+    }
+
+    void run_test(int iterations, int run_times) {
+        const double threshold = 1.25;
+        RansacFindInliersFunc test_func = GetParam();
+        double time_c = 0, time_o = 0;
+        uint64_t start_seconds, start_useconds;
+        uint64_t middle_seconds, middle_useconds;
+        uint64_t finish_seconds, finish_useconds;
+
+        for (int i = 0; i < iterations; i++) {
+            const int npoints = run_times > 1
+                                    ? MAX_CORNERS
+                                    : 1 + (int)(rnd_.random() % MAX_CORNERS);
+            int num_ref = 0, num_tst = 0;
+            double sum_ref = 0, sum_sq_ref = 0, sum_tst = 0, sum_sq_tst = 0;
+            prepare_data(npoints);
+
+            svt_av1_get_time(&start_seconds, &start_useconds);
+            for (int r = 0; r < run_times; r++) {
+                sum_ref = sum_sq_ref = 0;
+                num_ref = svt_av1_ransac_find_inliers_c(mat_,
+                                                        corners1_,
+                                                        corners2_,
+                                                        npoints,
+                                                        threshold,
+                                                        inliers_ref_,
+                                                        &sum_ref,
+                                                        &sum_sq_ref);
+            }
+            svt_av1_get_time(&middle_seconds, &middle_useconds);
+            for (int r = 0; r < run_times; r++) {
+                sum_tst = sum_sq_tst = 0;
+                num_tst = test_func(mat_,
+                                    corners1_,
+                                    corners2_,
+                                    npoints,
+                                    threshold,
+                                    inliers_tst_,
+                                    &sum_tst,
+                                    &sum_sq_tst);
+            }
+            svt_av1_get_time(&finish_seconds, &finish_useconds);
+            time_c += svt_av1_compute_overall_elapsed_time_ms(
+                start_seconds, start_useconds, middle_seconds, middle_useconds);
+            time_o += svt_av1_compute_overall_elapsed_time_ms(middle_seconds,
+                                                              middle_useconds,
+                                                              finish_seconds,
+                                                              finish_useconds);
+
+            ASSERT_EQ(num_tst, num_ref) << "npoints " << npoints;
+            for (int k = 0; k < num_ref; k++)
+                ASSERT_EQ(inliers_tst_[k], inliers_ref_[k]) << "inlier " << k;
+            ASSERT_EQ(sum_tst, sum_ref);
+            ASSERT_EQ(sum_sq_tst, sum_sq_ref);
+        }
+
+        if (run_times > 1) {
+            printf("ransac_find_inliers (%d points): C %6.2f ms, opt %6.2f ms "
+                   "(%5.2fx)\n",
+                   MAX_CORNERS,
+                   time_c,
+                   time_o,
+                   time_c / time_o);
+        }
+    }
+
+    SVTRandom rnd_;
+    double mat_[MAX_PARAMDIM];
+    double corners1_[2 * MAX_CORNERS];
+    double corners2_[2 * MAX_CORNERS];
+    int inliers_ref_[MAX_CORNERS];
+    int inliers_tst_[MAX_CORNERS];
+};
+
+TEST_P(RansacFindInliersTest, CheckOutput) {
+    run_test(1000, 1);
+};
+
+TEST_P(RansacFindInliersTest, DISABLED_Speed) {
+    run_test(10, 1000);
+};
+
+INSTANTIATE_TEST_CASE_P(GlobalMotion, RansacFindInliersTest,
+                        ::testing::Values(svt_av1_ransac_find_inliers_avx2));
+
 }  // namespace
@@ -15,6 +15,7 @@
  * @brief Unit test for HBD variance
  * functions:
  * - svt_aom_highbd_BD{8,10,12}_varianceW{8,16,32,64}xH{4,8,16,32,64}_sse2
+ * - svt_aom_highbd_10_varianceW{4,8}xH{4,8,16}_{sse4_1,avx2}
  * - svt_aom_highbd_BD{8,10,12}_getS{8,16}xS{8,16}var_sse2
  *
  * @author  Cidana-Wenyao, Cidana-Edmond
@@ -138,6 +139,14 @@ unsigned int svt_aom_highbd_10_variance32x64_sse2(const uint8_t *src_ptr, int so
 unsigned int svt_aom_highbd_10_variance64x16_sse2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 unsigned int svt_aom_highbd_10_variance64x32_sse2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 unsigned int svt_aom_highbd_10_variance64x64_sse2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int svt_aom_highbd_10_variance4x4_sse4_1(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int svt_aom_highbd_10_variance4x8_sse4_1(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int svt_aom_highbd_10_variance4x16_sse4_1(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int svt_aom_highbd_10_variance8x4_sse4_1(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int svt_aom_highbd_10_variance4x4_avx2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int svt_aom_highbd_10_variance4x8_avx2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int svt_aom_highbd_10_variance4x16_avx2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
+unsigned int svt_aom_highbd_10_variance8x4_avx2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 unsigned int svt_aom_highbd_10_variance8x8_avx2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 unsigned int svt_aom_highbd_10_variance8x16_avx2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
 unsigned int svt_aom_highbd_10_variance8x32_avx2(const uint8_t *src_ptr, int source_stride, const uint8_t *ref_ptr, int ref_stride, unsigned int *sse);
@@ -336,6 +345,14 @@ static const HbdVarianceParam HbdTestVector[] = {
     HbdVarianceParam( 64, 16, 10, svt_aom_highbd_10_variance64x16_sse2),
     HbdVarianceParam( 64, 32, 10, svt_aom_highbd_10_variance64x32_sse2),
     HbdVarianceParam( 64, 64, 10, svt_aom_highbd_10_variance64x64_sse2),
+    HbdVarianceParam(  4,  4, 10, svt_aom_highbd_10_variance4x4_sse4_1),
+    HbdVarianceParam(  4,  8, 10, svt_aom_highbd_10_variance4x8_sse4_1),
+    HbdVarianceParam(  4, 16, 10, svt_aom_highbd_10_variance4x16_sse4_1),
+    HbdVarianceParam(  8,  4, 10, svt_aom_highbd_10_variance8x4_sse4_1),
+    HbdVarianceParam(  4,  4, 10, svt_aom_highbd_10_variance4x4_avx2),
+    HbdVarianceParam(  4,  8, 10, svt_aom_highbd_10_variance4x8_avx2),
+    HbdVarianceParam(  4, 16, 10, svt_aom_highbd_10_variance4x16_avx2),
+    HbdVarianceParam(  8,  4, 10, svt_aom_highbd_10_variance8x4_avx2),
     HbdVarianceParam(  8,  8, 10, svt_aom_highbd_10_variance8x8_avx2),
     HbdVarianceParam(  8, 16, 10, svt_aom_highbd_10_variance8x16_avx2),
     HbdVarianceParam(  8, 32, 10, svt_aom_highbd_10_variance8x32_avx2),
@@ -293,6 +293,220 @@ TEST(MotionEstimation_avx2, DISABLED_sadMxNx4d_speed) {
     sadMxNx4d_speed_test(aom_sad_4d_avx2_func_ptr_array);
 }
 
+typedef void (*SadLoopKernelFn)(uint8_t *src, uint32_t src_stride, uint8_t *ref,
+                                uint32_t ref_stride, uint32_t block_height,
+                                uint32_t block_width, uint64_t *best_sad,
+                                int16_t *x_search_center, int16_t *y_search_center,
+                                uint32_t src_stride_raw, int16_t search_area_width,
+                                int16_t search_area_height);
+
+typedef void (*SadLoopKernelMultiFn)(uint8_t *src, uint32_t src_stride,
+                                     uint32_t block_height,
+                                     uint32_t block_width,
+                                     SadLoopSearchArea *search_areas,
+                                     uint32_t num_search_areas);
+
+// HME blocks of the 3 levels, with the full and the sub-sampled search, and
+// their search areas
+static const int num_hme_level = 6;
+
+struct HmeLevelInfo {
+    uint32_t block_width;
+    uint32_t block_height;
+    int16_t search_area_width;
+    int16_t search_area_height;
+};
+
+const struct HmeLevelInfo hme_level_info[num_hme_level] = {{16, 16, 64, 32},
+                                                           {16, 8, 64, 32},
+                                                           {32, 32, 16, 16},
+                                                           {32, 16, 16, 16},
+                                                           {64, 64, 16, 16},
+                                                           {64, 32, 16, 16}};
+
+// Blocks of the SBs cut by the bottom of the picture, with the full and the
+// sub-sampled search: the heights of the last source row pair are odd
+static const int num_hme_cut_block = 6;
+
+const struct HmeLevelInfo hme_cut_block_info[num_hme_cut_block] = {
+    {16, 13, 64, 32},
+    {16, 7, 64, 32},
+    {32, 27, 16, 16},
+    {32, 5, 16, 16},
+    {64, 45, 16, 16},
+    {64, 1, 16, 16}};
+
+// 2 lists of 4 references with 2x2 search regions each
+static const uint32_t num_search_areas =
+    MAX_NUM_OF_REF_PIC_LIST * MAX_REF_IDX * EB_HME_SEARCH_AREA_COLUMN_MAX_COUNT *
+    EB_HME_SEARCH_AREA_ROW_MAX_COUNT;
+static const uint32_t sad_loop_ref_stride = 512;
+static const uint32_t sad_loop_ref_height = 256;
+
+static void init_data_sad_loop_multi(uint8_t **src_ptr, uint8_t **ref_ptr,
+                                     const HmeLevelInfo &info,
+                                     SadLoopSearchArea *areas,
+                                     const int sub_sampled) {
+    *src_ptr =
+        (uint8_t *)malloc(sizeof(**src_ptr) * MAX_SB_SIZE * MAX_SB_SIZE);
+    *ref_ptr = (uint8_t *)malloc(sizeof(**ref_ptr) * sad_loop_ref_height *
+                                 sad_loop_ref_stride);
+    svt_buf_random_u8(*src_ptr, MAX_SB_SIZE * MAX_SB_SIZE);
+    svt_buf_random_u8(*ref_ptr, sad_loop_ref_height * sad_loop_ref_stride);
+
+    for (uint32_t i = 0; i < num_search_areas; i++) {
+        // every search area of a reference at a different position
+        const uint32_t x = rand() % (sad_loop_ref_stride - 128 - 64);
+        const uint32_t y = rand() % (sad_loop_ref_height - 128 - 32);
+        areas[i].ref = *ref_ptr + y * sad_loop_ref_stride + x;
+        areas[i].ref_stride =
+            sub_sampled ? 2 * sad_loop_ref_stride : sad_loop_ref_stride;
+        areas[i].ref_stride_raw = sad_loop_ref_stride;
+        areas[i].width = info.search_area_width - (int16_t)(rand() % 8);
+        areas[i].height = info.search_area_height - (int16_t)(rand() % 4);
+    }
+}
+
+static void sad_loop_multi_match(const SadLoopKernelMultiFn func,
+                                 const HmeLevelInfo &info,
+                                 const int sub_sampled) {
+    SadLoopSearchArea areas_org[num_search_areas];
+    SadLoopSearchArea areas_opt[num_search_areas];
+    uint8_t *src_ptr, *ref_ptr;
+
+    init_data_sad_loop_multi(&src_ptr, &ref_ptr, info, areas_org, sub_sampled);
+    memcpy(areas_opt, areas_org, sizeof(areas_org));
+
+    svt_sad_loop_kernel_multi_c(src_ptr,
+                                MAX_SB_SIZE,
+                                info.block_height,
+                                info.block_width,
+                                areas_org,
+                                num_search_areas);
+    func(src_ptr,
+         MAX_SB_SIZE,
+         info.block_height,
+         info.block_width,
+         areas_opt,
+         num_search_areas);
+
+    for (uint32_t l = 0; l < num_search_areas; l++) {
+        EXPECT_EQ(areas_org[l].best_sad, areas_opt[l].best_sad)
+            << info.block_width << "x" << info.block_height;
+        EXPECT_EQ(areas_org[l].x_best, areas_opt[l].x_best)
+            << info.block_width << "x" << info.block_height;
+        EXPECT_EQ(areas_org[l].y_best, areas_opt[l].y_best)
+            << info.block_width << "x" << info.block_height;
+    }
+
+    uninit_data(src_ptr, ref_ptr);
+}
+
+void sad_loop_multi_match_test(const SadLoopKernelMultiFn func) {
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < num_hme_level; j++)
+            sad_loop_multi_match(func, hme_level_info[j], j & 1);
+        for (int j = 0; j < num_hme_cut_block; j++)
+            sad_loop_multi_match(func, hme_cut_block_info[j], j & 1);
+    }
+}
+
+// Compares the batched search of all the references and search regions with
+// a call of the single search area kernel for each of them
+void sad_loop_multi_speed_test(const SadLoopKernelFn func_single,
+                               const SadLoopKernelMultiFn func) {
+    SadLoopSearchArea areas_org[num_search_areas];
+    SadLoopSearchArea areas_opt[num_search_areas];
+    uint8_t *src_ptr, *ref_ptr;
+    double time_c, time_o;
+    uint64_t start_time_seconds, start_time_useconds;
+    uint64_t middle_time_seconds, middle_time_useconds;
+    uint64_t finish_time_seconds, finish_time_useconds;
+
+    for (int j = 0; j < num_hme_level; j++) {
+        const HmeLevelInfo &info = hme_level_info[j];
+        const int sub_sampled = j & 1;
+        const uint64_t num_loop =
+            20000000 / (info.block_width * info.block_height *
+                        info.search_area_width * info.search_area_height /
+                        64);
+
+        init_data_sad_loop_multi(
+            &src_ptr, &ref_ptr, info, areas_org, sub_sampled);
+        memcpy(areas_opt, areas_org, sizeof(areas_org));
+
+        svt_av1_get_time(&start_time_seconds, &start_time_useconds);
+
+        for (uint64_t i = 0; i < num_loop; i++) {
+            for (uint32_t l = 0; l < num_search_areas; l++) {
+                func_single(src_ptr,
+                            MAX_SB_SIZE,
+                            areas_org[l].ref,
+                            areas_org[l].ref_stride,
+                            info.block_height,
+                            info.block_width,
+                            &areas_org[l].best_sad,
+                            &areas_org[l].x_best,
+                            &areas_org[l].y_best,
+                            areas_org[l].ref_stride_raw,
+                            areas_org[l].width,
+                            areas_org[l].height);
+            }
+        }
+
+        svt_av1_get_time(&middle_time_seconds, &middle_time_useconds);
+
+        for (uint64_t i = 0; i < num_loop; i++)
+            func(src_ptr,
+                 MAX_SB_SIZE,
+                 info.block_height,
+                 info.block_width,
+                 areas_opt,
+                 num_search_areas);
+
+        svt_av1_get_time(&finish_time_seconds, &finish_time_useconds);
+        time_c = svt_av1_compute_overall_elapsed_time_ms(start_time_seconds,
+                                                         start_time_useconds,
+                                                         middle_time_seconds,
+                                                         middle_time_useconds);
+        time_o = svt_av1_compute_overall_elapsed_time_ms(middle_time_seconds,
+                                                         middle_time_useconds,
+                                                         finish_time_seconds,
+                                                         finish_time_useconds);
+
+        for (uint32_t l = 0; l < num_search_areas; l++) {
+            EXPECT_EQ(areas_org[l].best_sad, areas_opt[l].best_sad);
+            EXPECT_EQ(areas_org[l].x_best, areas_opt[l].x_best);
+            EXPECT_EQ(areas_org[l].y_best, areas_opt[l].y_best);
+        }
+
+        printf("Average Nanoseconds per Function Call (%u search areas)\n",
+               num_search_areas);
+        printf("    sad_loop_kernel(%2dx%2d)       : %8.2f\n",
+               info.block_width,
+               info.block_height,
+               1000000 * time_c / num_loop);
+        printf(
+            "    sad_loop_kernel_multi(%2dx%2d) : %8.2f   (Comparison: "
+            "%5.2fx)\n",
+            info.block_width,
+            info.block_height,
+            1000000 * time_o / num_loop,
+            time_c / time_o);
+
+        uninit_data(src_ptr, ref_ptr);
+    }
+}
+
+TEST(MotionEstimation_avx2, sad_loop_multi_match) {
+    sad_loop_multi_match_test(svt_sad_loop_kernel_multi_avx2_intrin);
+}
+
+TEST(MotionEstimation_avx2, DISABLED_sad_loop_multi_speed) {
+    sad_loop_multi_speed_test(svt_sad_loop_kernel_avx2_intrin,
+                              svt_sad_loop_kernel_multi_avx2_intrin);
+}
+
 #if EN_AVX512_SUPPORT
 
 //NULL means not implemented
@@ -333,4 +547,13 @@ TEST(MotionEstimation_avx512, DISABLED_sadMxNx4d_speed) {
     sadMxNx4d_speed_test(aom_sad_4d_avx512_func_ptr_array);
 }
 
+TEST(MotionEstimation_avx512, sad_loop_multi_match) {
+    sad_loop_multi_match_test(svt_sad_loop_kernel_multi_avx512_intrin);
+}
+
+TEST(MotionEstimation_avx512, DISABLED_sad_loop_multi_speed) {
+    sad_loop_multi_speed_test(svt_sad_loop_kernel_avx512_intrin,
+                              svt_sad_loop_kernel_multi_avx512_intrin);
+}
+
 #endif  // EN_AVX512_SUPPORT
@@ -0,0 +1,697 @@
+/*
+ * Copyright(c) 2019 Netflix, Inc.
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file NeonDspTest.cc
+ *
+ * @brief Unit test of the AArch64 Advanced SIMD kernels against the C:
+ * - svt_aom_{dc,dc_top,dc_left,dc_128,v,h}_predictor_{w}x{h}_neon
+ * - svt_av1_convolve_{2d_copy,x,y}_sr_neon, svt_av1_jnt_convolve_{2d_copy,x,y,2d}_neon,
+ *   also on source buffers ending with the last pixel the C reads
+ * - svt_residual_kernel8bit_neon
+ * - svt_aom_sad{w}x{h}_neon, svt_aom_sad{w}x{h}x4d_neon,
+ *   svt_nxm_sad_kernel_helper_neon, svt_sad_loop_kernel_neon
+ * - svt_aom_variance{w}x{h}_neon, svt_aom_mse16x16_neon
+ * - svt_av1_quantize_fp{,_32x32,_64x64}_neon
+ * - svt_aom_satd_neon, svt_av1_block_error_neon
+ *
+ ******************************************************************************/
+#include "gtest/gtest.h"
+
+#ifdef ARCH_AARCH64
+
+#include <stdlib.h>
+#include <string.h>
+#include "EbDefinitions.h"
+#include "EbComputeSAD_C.h"
+#include "EbInterPrediction.h"
+#include "aom_dsp_rtcd.h"
+#include "common_dsp_rtcd.h"
+#include "convolve.h"
+#include "random.h"
+#include "util.h"
+
+using svt_av1_test_tool::SVTRandom;
+
+namespace {
+
+const int kStride = 2 * MAX_SB_SIZE + 16;
+const int kBufSize = kStride * (2 * MAX_SB_SIZE + 16);
+
+static void fill_random_u8(uint8_t *buf, int size, SVTRandom &rnd) {
+    for (int i = 0; i < size; i++) buf[i] = (uint8_t)rnd.random();
+}
+
+// Intra predictors
+
+typedef void (*IntraPredFunc)(uint8_t *dst, ptrdiff_t stride,
+                              const uint8_t *above, const uint8_t *left);
+
+typedef struct {
+    IntraPredFunc ref_func;
+    IntraPredFunc tst_func;
+    int width;
+    int height;
+} IntraPredParam;
+
+#define INTRA_PARAM(type, W, H)                               \
+    {svt_aom_##type##_predictor_##W##x##H##_c,                \
+     svt_aom_##type##_predictor_##W##x##H##_neon,             \
+     W,                                                       \
+     H}
+
+#define INTRA_PARAMS_ALL_SIZES(type)                                         \
+    INTRA_PARAM(type, 4, 4), INTRA_PARAM(type, 4, 8),                        \
+        INTRA_PARAM(type, 4, 16), INTRA_PARAM(type, 8, 4),                   \
+        INTRA_PARAM(type, 8, 8), INTRA_PARAM(type, 8, 16),                   \
+        INTRA_PARAM(type, 8, 32), INTRA_PARAM(type, 16, 4),                  \
+        INTRA_PARAM(type, 16, 8), INTRA_PARAM(type, 16, 16),                 \
+        INTRA_PARAM(type, 16, 32), INTRA_PARAM(type, 16, 64),                \
+        INTRA_PARAM(type, 32, 8), INTRA_PARAM(type, 32, 16),                 \
+        INTRA_PARAM(type, 32, 32), INTRA_PARAM(type, 32, 64),                \
+        INTRA_PARAM(type, 64, 16), INTRA_PARAM(type, 64, 32),                \
+        INTRA_PARAM(type, 64, 64)
+
+const IntraPredParam intra_pred_params[] = {INTRA_PARAMS_ALL_SIZES(dc),
+                                            INTRA_PARAMS_ALL_SIZES(dc_top),
+                                            INTRA_PARAMS_ALL_SIZES(dc_left),
+                                            INTRA_PARAMS_ALL_SIZES(dc_128),
+                                            INTRA_PARAMS_ALL_SIZES(v),
+                                            INTRA_PARAMS_ALL_SIZES(h)};
+
+class NeonIntraPredTest : public ::testing::TestWithParam<IntraPredParam> {
+  public:
+    void SetUp() override {
+        // the C predictors copy with svt_memcpy
+        setup_common_rtcd_internal(get_cpu_flags_to_use());
+    }
+};
+
+TEST_P(NeonIntraPredTest, MatchTest) {
+    const IntraPredParam param = GetParam();
+    SVTRandom rnd(0, 255);
+    uint8_t above[2 * 64], left[2 * 64];
+    uint8_t dst_ref[64 * 64], dst_tst[64 * 64];
+
+    for (int i = 0; i < 100; i++) {
+        fill_random_u8(above, sizeof(above), rnd);
+        fill_random_u8(left, sizeof(left), rnd);
+        if (i == 0) {
+            memset(above, 255, sizeof(above));
+            memset(left, 255, sizeof(left));
+        }
+        memset(dst_ref, 0, sizeof(dst_ref));
+        memset(dst_tst, 0, sizeof(dst_tst));
+        param.ref_func(dst_ref, 64, above, left);
+        param.tst_func(dst_tst, 64, above, left);
+        ASSERT_EQ(0, memcmp(dst_ref, dst_tst, sizeof(dst_ref)))
+            << "intra predictor " << param.width << "x" << param.height
+            << " mismatch at iteration " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(NEON, NeonIntraPredTest,
+                        ::testing::ValuesIn(intra_pred_params));
+
+// Convolution
+
+typedef void (*ConvolveFunc)(const uint8_t *src, int32_t src_stride,
+                             uint8_t *dst, int32_t dst_stride, int32_t w,
+                             int32_t h, InterpFilterParams *filter_params_x,
+                             InterpFilterParams *filter_params_y,
+                             const int32_t subpel_x_q4,
+                             const int32_t subpel_y_q4,
+                             ConvolveParams *conv_params);
+
+typedef std::tuple<ConvolveFunc, ConvolveFunc, BlockSize> ConvolveParam;
+
+class NeonConvolveSrTest : public ::testing::TestWithParam<ConvolveParam> {
+  public:
+    void SetUp() override {
+        src_ = (uint8_t *)malloc(kBufSize);
+        dst_ref_ = (uint8_t *)malloc(kBufSize);
+        dst_tst_ = (uint8_t *)malloc(kBufSize);
+    }
+
+    void TearDown() override {
+        free(src_);
+        free(dst_ref_);
+        free(dst_tst_);
+    }
+
+  protected:
+    uint8_t *src_, *dst_ref_, *dst_tst_;
+};
+
+TEST_P(NeonConvolveSrTest, MatchTest) {
+    const ConvolveFunc ref_func = TEST_GET_PARAM(0);
+    const ConvolveFunc tst_func = TEST_GET_PARAM(1);
+    const BlockSize bsize = TEST_GET_PARAM(2);
+    const int w = block_size_wide[bsize];
+    const int h = block_size_high[bsize];
+    // the taps start 3 rows and columns before the block
+    const uint8_t *src = src_ + 3 * kStride + 3;
+    SVTRandom rnd(0, 255);
+
+    for (int sub_w = w; sub_w >= 2 && sub_w >= w / 2; sub_w >>= 1) {
+        for (int filter = EIGHTTAP_REGULAR; filter < INTERP_FILTERS_ALL;
+             filter++) {
+            InterpFilterParams filter_params_x =
+                av1_get_interp_filter_params_with_block_size(
+                    (InterpFilter)filter, sub_w);
+            InterpFilterParams filter_params_y =
+                av1_get_interp_filter_params_with_block_size(
+                    (InterpFilter)filter, h);
+            for (int subpel = 0; subpel < SUBPEL_SHIFTS; subpel++) {
+                fill_random_u8(src_, kBufSize, rnd);
+                memset(dst_ref_, 0, kBufSize);
+                memset(dst_tst_, 0, kBufSize);
+                ConvolveParams conv_params_ref =
+                    get_conv_params_no_round(0, 0, 0, nullptr, 0, 0, 8);
+                ConvolveParams conv_params_tst = conv_params_ref;
+                ref_func(src, kStride, dst_ref_, kStride, sub_w, h,
+                         &filter_params_x, &filter_params_y, subpel, subpel,
+                         &conv_params_ref);
+                tst_func(src, kStride, dst_tst_, kStride, sub_w, h,
+                         &filter_params_x, &filter_params_y, subpel, subpel,
+                         &conv_params_tst);
+                ASSERT_EQ(0, memcmp(dst_ref_, dst_tst_, kBufSize))
+                    << "convolve " << sub_w << "x" << h << " filter "
+                    << filter << " subpel " << subpel;
+            }
+        }
+    }
+}
+
+const BlockSize convolve_block_sizes[] = {BLOCK_4X4,
+                                          BLOCK_4X8,
+                                          BLOCK_8X8,
+                                          BLOCK_8X32,
+                                          BLOCK_16X4,
+                                          BLOCK_16X16,
+                                          BLOCK_32X8,
+                                          BLOCK_32X32,
+                                          BLOCK_64X64,
+                                          BLOCK_128X128};
+
+INSTANTIATE_TEST_CASE_P(
+    NEON, NeonConvolveSrTest,
+    ::testing::Combine(::testing::Values(svt_av1_convolve_2d_copy_sr_c),
+                       ::testing::Values(svt_av1_convolve_2d_copy_sr_neon),
+                       ::testing::ValuesIn(convolve_block_sizes)));
+
+INSTANTIATE_TEST_CASE_P(
+    NEON_X, NeonConvolveSrTest,
+    ::testing::Combine(::testing::Values(svt_av1_convolve_x_sr_c),
+                       ::testing::Values(svt_av1_convolve_x_sr_neon),
+                       ::testing::ValuesIn(convolve_block_sizes)));
+
+INSTANTIATE_TEST_CASE_P(
+    NEON_Y, NeonConvolveSrTest,
+    ::testing::Combine(::testing::Values(svt_av1_convolve_y_sr_c),
+                       ::testing::Values(svt_av1_convolve_y_sr_neon),
+                       ::testing::ValuesIn(convolve_block_sizes)));
+
+class NeonJntConvolveTest : public ::testing::TestWithParam<ConvolveParam> {};
+
+TEST_P(NeonJntConvolveTest, MatchTest) {
+    const ConvolveFunc ref_func = TEST_GET_PARAM(0);
+    const ConvolveFunc tst_func = TEST_GET_PARAM(1);
+    const BlockSize bsize = TEST_GET_PARAM(2);
+    const int w = block_size_wide[bsize];
+    const int h = block_size_high[bsize];
+    SVTRandom rnd(0, 255);
+    SVTRandom offset_rnd(0, 15);
+    uint8_t *src_buf = (uint8_t *)malloc(kBufSize);
+    uint8_t *dst_ref = (uint8_t *)malloc(MAX_SB_SQUARE);
+    uint8_t *dst_tst = (uint8_t *)malloc(MAX_SB_SQUARE);
+    ConvBufType *conv_ref =
+        (ConvBufType *)malloc(MAX_SB_SQUARE * sizeof(ConvBufType));
+    ConvBufType *conv_tst =
+        (ConvBufType *)malloc(MAX_SB_SQUARE * sizeof(ConvBufType));
+    // the taps start 3 rows and columns before the block
+    const uint8_t *src = src_buf + 3 * kStride + 3;
+
+    for (int filter = EIGHTTAP_REGULAR; filter < INTERP_FILTERS_ALL;
+         filter++) {
+        InterpFilterParams filter_params_x =
+            av1_get_interp_filter_params_with_block_size((InterpFilter)filter,
+                                                         w);
+        InterpFilterParams filter_params_y =
+            av1_get_interp_filter_params_with_block_size((InterpFilter)filter,
+                                                         h);
+        for (int subpel = 0; subpel < SUBPEL_SHIFTS; subpel += 3) {
+            for (int use_jnt = 0; use_jnt < 2; use_jnt++) {
+                fill_random_u8(src_buf, kBufSize, rnd);
+                memset(dst_ref, 0, MAX_SB_SQUARE);
+                memset(dst_tst, 0, MAX_SB_SQUARE);
+                // the first pass writes the compound buffer, the second
+                // averages
+                for (int do_average = 0; do_average < 2; do_average++) {
+                    ConvolveParams conv_params_ref = get_conv_params_no_round(
+                        0, do_average, 0, conv_ref, MAX_SB_SIZE, 1, 8);
+                    ConvolveParams conv_params_tst = get_conv_params_no_round(
+                        0, do_average, 0, conv_tst, MAX_SB_SIZE, 1, 8);
+                    conv_params_ref.use_jnt_comp_avg = use_jnt;
+                    conv_params_ref.fwd_offset = offset_rnd.random();
+                    conv_params_ref.bck_offset =
+                        16 - conv_params_ref.fwd_offset;
+                    conv_params_tst.use_jnt_comp_avg = use_jnt;
+                    conv_params_tst.fwd_offset = conv_params_ref.fwd_offset;
+                    conv_params_tst.bck_offset = conv_params_ref.bck_offset;
+                    ref_func(src, kStride, dst_ref, MAX_SB_SIZE, w, h,
+                             &filter_params_x, &filter_params_y, subpel,
+                             subpel, &conv_params_ref);
+                    tst_func(src, kStride, dst_tst, MAX_SB_SIZE, w, h,
+                             &filter_params_x, &filter_params_y, subpel,
+                             subpel, &conv_params_tst);
+                    for (int y = 0; y < h; y++) {
+                        ASSERT_EQ(0,
+                                  memcmp(conv_ref + y * MAX_SB_SIZE,
+                                         conv_tst + y * MAX_SB_SIZE,
+                                         w * sizeof(ConvBufType)))
+                            << "compound buffer mismatch, row " << y
+                            << " filter " << filter << " subpel " << subpel;
+                        ASSERT_EQ(0,
+                                  memcmp(dst_ref + y * MAX_SB_SIZE,
+                                         dst_tst + y * MAX_SB_SIZE,
+                                         w))
+                            << "average mismatch, row " << y << " filter "
+                            << filter << " subpel " << subpel;
+                    }
+                }
+            }
+        }
+    }
+
+    free(src_buf);
+    free(dst_ref);
+    free(dst_tst);
+    free(conv_ref);
+    free(conv_tst);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    NEON, NeonJntConvolveTest,
+    ::testing::Combine(::testing::Values(svt_av1_jnt_convolve_2d_copy_c),
+                       ::testing::Values(svt_av1_jnt_convolve_2d_copy_neon),
+                       ::testing::ValuesIn(convolve_block_sizes)));
+
+INSTANTIATE_TEST_CASE_P(
+    NEON_X, NeonJntConvolveTest,
+    ::testing::Combine(::testing::Values(svt_av1_jnt_convolve_x_c),
+                       ::testing::Values(svt_av1_jnt_convolve_x_neon),
+                       ::testing::ValuesIn(convolve_block_sizes)));
+
+INSTANTIATE_TEST_CASE_P(
+    NEON_Y, NeonJntConvolveTest,
+    ::testing::Combine(::testing::Values(svt_av1_jnt_convolve_y_c),
+                       ::testing::Values(svt_av1_jnt_convolve_y_neon),
+                       ::testing::ValuesIn(convolve_block_sizes)));
+
+INSTANTIATE_TEST_CASE_P(
+    NEON_2D, NeonJntConvolveTest,
+    ::testing::Combine(::testing::Values(svt_av1_jnt_convolve_2d_c),
+                       ::testing::Values(svt_av1_jnt_convolve_2d_neon),
+                       ::testing::ValuesIn(convolve_block_sizes)));
+
+// The convolutions on a source buffer which ends with the last pixel the C
+// reads: run under AddressSanitizer, a kernel loading past the footprint of
+// the C fails.
+typedef std::tuple<ConvolveFunc, ConvolveFunc, int, int, int>
+    ConvolveFootprintParam;
+
+class NeonConvolveFootprintTest
+    : public ::testing::TestWithParam<ConvolveFootprintParam> {};
+
+TEST_P(NeonConvolveFootprintTest, MatchTest) {
+    const ConvolveFunc ref_func = TEST_GET_PARAM(0);
+    const ConvolveFunc tst_func = TEST_GET_PARAM(1);
+    const int taps_x = TEST_GET_PARAM(2);
+    const int taps_y = TEST_GET_PARAM(3);
+    const int is_compound = TEST_GET_PARAM(4);
+    SVTRandom rnd(0, 255);
+    uint8_t *dst_ref = (uint8_t *)malloc(MAX_SB_SQUARE);
+    uint8_t *dst_tst = (uint8_t *)malloc(MAX_SB_SQUARE);
+    ConvBufType *conv_ref =
+        (ConvBufType *)malloc(MAX_SB_SQUARE * sizeof(ConvBufType));
+    ConvBufType *conv_tst =
+        (ConvBufType *)malloc(MAX_SB_SQUARE * sizeof(ConvBufType));
+
+    for (size_t b = 0; b < sizeof(convolve_block_sizes) /
+                               sizeof(convolve_block_sizes[0]);
+         b++) {
+        const int w = block_size_wide[convolve_block_sizes[b]];
+        const int h = block_size_high[convolve_block_sizes[b]];
+        const int stride = w + taps_x - 1;
+        const int size = stride * (h + taps_y - 1);
+        uint8_t *src_buf = (uint8_t *)malloc(size);
+        // the 8 taps start 3 rows or columns before the block
+        const int offset_x = taps_x > 1 ? taps_x / 2 - 1 : 0;
+        const int offset_y = taps_y > 1 ? taps_y / 2 - 1 : 0;
+        const uint8_t *src = src_buf + offset_y * stride + offset_x;
+        InterpFilterParams filter_params_x =
+            av1_get_interp_filter_params_with_block_size(EIGHTTAP_REGULAR, w);
+        InterpFilterParams filter_params_y =
+            av1_get_interp_filter_params_with_block_size(EIGHTTAP_REGULAR, h);
+        fill_random_u8(src_buf, size, rnd);
+        memset(dst_ref, 0, MAX_SB_SQUARE);
+        memset(dst_tst, 0, MAX_SB_SQUARE);
+        for (int do_average = 0; do_average <= is_compound; do_average++) {
+            ConvolveParams conv_params_ref = get_conv_params_no_round(
+                0, do_average, 0, conv_ref, MAX_SB_SIZE, is_compound, 8);
+            ConvolveParams conv_params_tst = get_conv_params_no_round(
+                0, do_average, 0, conv_tst, MAX_SB_SIZE, is_compound, 8);
+            ref_func(src, stride, dst_ref, MAX_SB_SIZE, w, h,
+                     &filter_params_x, &filter_params_y, 5, 11,
+                     &conv_params_ref);
+            tst_func(src, stride, dst_tst, MAX_SB_SIZE, w, h,
+                     &filter_params_x, &filter_params_y, 5, 11,
+                     &conv_params_tst);
+        }
+        for (int y = 0; y < h; y++) {
+            ASSERT_EQ(0, memcmp(dst_ref + y * MAX_SB_SIZE,
+                                dst_tst + y * MAX_SB_SIZE, w))
+                << "convolve " << w << "x" << h << " mismatch, row " << y;
+            if (is_compound)
+                ASSERT_EQ(0, memcmp(conv_ref + y * MAX_SB_SIZE,
+                                    conv_tst + y * MAX_SB_SIZE,
+                                    w * sizeof(ConvBufType)))
+                    << "convolve " << w << "x" << h
+                    << " compound buffer mismatch, row " << y;
+        }
+        free(src_buf);
+    }
+
+    free(dst_ref);
+    free(dst_tst);
+    free(conv_ref);
+    free(conv_tst);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    NEON, NeonConvolveFootprintTest,
+    ::testing::Values(
+        ConvolveFootprintParam(svt_av1_convolve_2d_copy_sr_c,
+                               svt_av1_convolve_2d_copy_sr_neon, 1, 1, 0),
+        ConvolveFootprintParam(svt_av1_convolve_x_sr_c,
+                               svt_av1_convolve_x_sr_neon, 8, 1, 0),
+        ConvolveFootprintParam(svt_av1_convolve_y_sr_c,
+                               svt_av1_convolve_y_sr_neon, 1, 8, 0),
+        ConvolveFootprintParam(svt_av1_jnt_convolve_2d_copy_c,
+                               svt_av1_jnt_convolve_2d_copy_neon, 1, 1, 1),
+        ConvolveFootprintParam(svt_av1_jnt_convolve_x_c,
+                               svt_av1_jnt_convolve_x_neon, 8, 1, 1),
+        ConvolveFootprintParam(svt_av1_jnt_convolve_y_c,
+                               svt_av1_jnt_convolve_y_neon, 1, 8, 1),
+        ConvolveFootprintParam(svt_av1_jnt_convolve_2d_c,
+                               svt_av1_jnt_convolve_2d_neon, 8, 8, 1)));
+
+// Residual
+
+TEST(NeonResidualTest, MatchTest) {
+    SVTRandom rnd(0, 255);
+    uint8_t *input = (uint8_t *)malloc(kBufSize);
+    uint8_t *pred = (uint8_t *)malloc(kBufSize);
+    int16_t *res_ref = (int16_t *)malloc(kBufSize * sizeof(int16_t));
+    int16_t *res_tst = (int16_t *)malloc(kBufSize * sizeof(int16_t));
+    const uint32_t widths[] = {4, 8, 12, 16, 24, 32, 64, 128};
+
+    for (uint32_t w : widths) {
+        for (uint32_t h = 4; h <= 128; h *= 2) {
+            fill_random_u8(input, kBufSize, rnd);
+            fill_random_u8(pred, kBufSize, rnd);
+            memset(res_ref, 0, kBufSize * sizeof(int16_t));
+            memset(res_tst, 0, kBufSize * sizeof(int16_t));
+            svt_residual_kernel8bit_c(
+                input, kStride, pred, kStride, res_ref, kStride, w, h);
+            svt_residual_kernel8bit_neon(
+                input, kStride, pred, kStride, res_tst, kStride, w, h);
+            ASSERT_EQ(0,
+                      memcmp(res_ref, res_tst, kBufSize * sizeof(int16_t)))
+                << "residual " << w << "x" << h;
+        }
+    }
+
+    free(input);
+    free(pred);
+    free(res_ref);
+    free(res_tst);
+}
+
+// SAD and variance
+
+typedef uint32_t (*SadFunc)(const uint8_t *src, int src_stride,
+                            const uint8_t *ref, int ref_stride);
+typedef void (*Sad4dFunc)(const uint8_t *src, int src_stride,
+                          const uint8_t *const ref[], int ref_stride,
+                          uint32_t *sad_array);
+typedef unsigned int (*VarianceFunc)(const uint8_t *src, int src_stride,
+                                     const uint8_t *ref, int ref_stride,
+                                     unsigned int *sse);
+
+typedef struct {
+    SadFunc sad_ref, sad_tst;
+    Sad4dFunc sad4d_ref, sad4d_tst;
+    VarianceFunc var_ref, var_tst;
+    int width;
+    int height;
+} BlockFuncParam;
+
+#define BLOCK_PARAM(W, H)                                              \
+    {svt_aom_sad##W##x##H##_c, svt_aom_sad##W##x##H##_neon,            \
+     svt_aom_sad##W##x##H##x4d_c, svt_aom_sad##W##x##H##x4d_neon,      \
+     svt_aom_variance##W##x##H##_c, svt_aom_variance##W##x##H##_neon,  \
+     W, H}
+
+const BlockFuncParam block_func_params[] = {
+    BLOCK_PARAM(4, 4),    BLOCK_PARAM(4, 8),    BLOCK_PARAM(4, 16),
+    BLOCK_PARAM(8, 4),    BLOCK_PARAM(8, 8),    BLOCK_PARAM(8, 16),
+    BLOCK_PARAM(8, 32),   BLOCK_PARAM(16, 4),   BLOCK_PARAM(16, 8),
+    BLOCK_PARAM(16, 16),  BLOCK_PARAM(16, 32),  BLOCK_PARAM(16, 64),
+    BLOCK_PARAM(32, 8),   BLOCK_PARAM(32, 16),  BLOCK_PARAM(32, 32),
+    BLOCK_PARAM(32, 64),  BLOCK_PARAM(64, 16),  BLOCK_PARAM(64, 32),
+    BLOCK_PARAM(64, 64),  BLOCK_PARAM(64, 128), BLOCK_PARAM(128, 64),
+    BLOCK_PARAM(128, 128)};
+
+class NeonBlockTest : public ::testing::TestWithParam<BlockFuncParam> {
+  public:
+    void SetUp() override {
+        src_ = (uint8_t *)malloc(kBufSize);
+        ref_ = (uint8_t *)malloc(kBufSize);
+    }
+
+    void TearDown() override {
+        free(src_);
+        free(ref_);
+    }
+
+  protected:
+    // random, maximum differences and identical blocks
+    void prepare_data(int iteration, SVTRandom &rnd) {
+        if (iteration == 0) {
+            memset(src_, 255, kBufSize);
+            memset(ref_, 0, kBufSize);
+        } else if (iteration == 1) {
+            fill_random_u8(src_, kBufSize, rnd);
+            memcpy(ref_, src_, kBufSize);
+        } else {
+            fill_random_u8(src_, kBufSize, rnd);
+            fill_random_u8(ref_, kBufSize, rnd);
+        }
+    }
+
+    uint8_t *src_, *ref_;
+};
+
+TEST_P(NeonBlockTest, SadMatchTest) {
+    const BlockFuncParam param = GetParam();
+    SVTRandom rnd(0, 255);
+
+    for (int i = 0; i < 10; i++) {
+        prepare_data(i, rnd);
+        EXPECT_EQ(param.sad_ref(src_, kStride, ref_, kStride),
+                  param.sad_tst(src_, kStride, ref_, kStride))
+            << "sad " << param.width << "x" << param.height;
+
+        const uint8_t *const refs[4] = {
+            ref_, ref_ + 1, ref_ + kStride, ref_ + 3 * kStride + 5};
+        uint32_t sad_ref[4], sad_tst[4];
+        param.sad4d_ref(src_, kStride, refs, kStride, sad_ref);
+        param.sad4d_tst(src_, kStride, refs, kStride, sad_tst);
+        for (int j = 0; j < 4; j++)
+            EXPECT_EQ(sad_ref[j], sad_tst[j])
+                << "sad x4d " << param.width << "x" << param.height
+                << " reference " << j;
+    }
+}
+
+TEST_P(NeonBlockTest, VarianceMatchTest) {
+    const BlockFuncParam param = GetParam();
+    SVTRandom rnd(0, 255);
+
+    for (int i = 0; i < 10; i++) {
+        prepare_data(i, rnd);
+        unsigned int sse_ref, sse_tst;
+        const unsigned int var_ref =
+            param.var_ref(src_, kStride, ref_, kStride, &sse_ref);
+        const unsigned int var_tst =
+            param.var_tst(src_, kStride, ref_, kStride, &sse_tst);
+        EXPECT_EQ(var_ref, var_tst)
+            << "variance " << param.width << "x" << param.height;
+        EXPECT_EQ(sse_ref, sse_tst)
+            << "sse " << param.width << "x" << param.height;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(NEON, NeonBlockTest,
+                        ::testing::ValuesIn(block_func_params));
+
+TEST(NeonSadKernelTest, MatchTest) {
+    SVTRandom rnd(0, 255);
+    uint8_t *src = (uint8_t *)malloc(kBufSize);
+    uint8_t *ref = (uint8_t *)malloc(kBufSize);
+    fill_random_u8(src, kBufSize, rnd);
+    fill_random_u8(ref, kBufSize, rnd);
+
+    // the helper handles any width, including the sub-sampled heights
+    for (uint32_t w = 1; w <= 128; w++) {
+        for (uint32_t h = 1; h <= 128; h = h * 2 + 1) {
+            EXPECT_EQ(
+                svt_nxm_sad_kernel_helper_c(src, kStride, ref, kStride, h, w),
+                svt_nxm_sad_kernel_helper_neon(
+                    src, kStride, ref, kStride, h, w))
+                << "nxm sad " << w << "x" << h;
+        }
+    }
+
+    const uint32_t sizes[][2] = {{8, 8}, {16, 16}, {24, 32}, {64, 64}};
+    for (const auto &size : sizes) {
+        uint64_t best_sad_ref, best_sad_tst;
+        int16_t x_ref = -1, y_ref = -1, x_tst = -1, y_tst = -1;
+        svt_sad_loop_kernel_c(src, kStride, ref, kStride, size[1], size[0],
+                              &best_sad_ref, &x_ref, &y_ref, kStride, 48,
+                              16);
+        svt_sad_loop_kernel_neon(src, kStride, ref, kStride, size[1],
+                                 size[0], &best_sad_tst, &x_tst, &y_tst,
+                                 kStride, 48, 16);
+        EXPECT_EQ(best_sad_ref, best_sad_tst);
+        EXPECT_EQ(x_ref, x_tst);
+        EXPECT_EQ(y_ref, y_tst);
+    }
+
+    unsigned int sse_ref, sse_tst;
+    EXPECT_EQ(svt_aom_mse16x16_c(src, kStride, ref, kStride, &sse_ref),
+              svt_aom_mse16x16_neon(src, kStride, ref, kStride, &sse_tst));
+    EXPECT_EQ(sse_ref, sse_tst);
+
+    free(src);
+    free(ref);
+}
+
+// Quantization and distortion
+
+typedef void (*QuantizeFpFunc)(
+    const TranLow *coeff_ptr, intptr_t n_coeffs, const int16_t *zbin_ptr,
+    const int16_t *round_ptr, const int16_t *quant_ptr,
+    const int16_t *quant_shift_ptr, TranLow *qcoeff_ptr,
+    TranLow *dqcoeff_ptr, const int16_t *dequant_ptr, uint16_t *eob_ptr,
+    const int16_t *scan, const int16_t *iscan);
+
+typedef std::tuple<QuantizeFpFunc, QuantizeFpFunc, int> QuantizeParam;
+
+class NeonQuantizeFpTest : public ::testing::TestWithParam<QuantizeParam> {};
+
+TEST_P(NeonQuantizeFpTest, MatchTest) {
+    const QuantizeFpFunc ref_func = TEST_GET_PARAM(0);
+    const QuantizeFpFunc tst_func = TEST_GET_PARAM(1);
+    const int n_coeffs = TEST_GET_PARAM(2);
+    SVTRandom rnd(0, 255);
+    SVTRandom coeff_rnd(-(1 << 15), (1 << 15) - 1);
+    SVTRandom dequant_rnd(4, 1800);
+    TranLow coeff[4096], qcoeff_ref[4096], qcoeff_tst[4096];
+    TranLow dqcoeff_ref[4096], dqcoeff_tst[4096];
+    int16_t scan[4096], iscan[4096];
+    int16_t zbin[2], round[2], quant[2], quant_shift[2], dequant[2];
+
+    for (int i = 0; i < n_coeffs; i++) scan[i] = iscan[i] = i;
+
+    for (int iter = 0; iter < 200; iter++) {
+        for (int j = 0; j < 2; j++) {
+            dequant[j] = dequant_rnd.random();
+            quant[j] = (1 << 16) / dequant[j];
+            round[j] = (dequant[j] * (rnd.random() % 128)) >> 7;
+            zbin[j] = quant_shift[j] = 0;
+        }
+        // mostly small coefficients, for a realistic end of block
+        const int range = iter % 4 == 0 ? (1 << 15) : 64 << (iter % 5);
+        for (int i = 0; i < n_coeffs; i++)
+            coeff[i] = (i < n_coeffs / (1 + iter % 8))
+                           ? coeff_rnd.random() % range
+                           : 0;
+        uint16_t eob_ref = 0, eob_tst = 0;
+        ref_func(coeff, n_coeffs, zbin, round, quant, quant_shift, qcoeff_ref,
+                 dqcoeff_ref, dequant, &eob_ref, scan, iscan);
+        tst_func(coeff, n_coeffs, zbin, round, quant, quant_shift, qcoeff_tst,
+                 dqcoeff_tst, dequant, &eob_tst, scan, iscan);
+        ASSERT_EQ(eob_ref, eob_tst) << "iteration " << iter;
+        ASSERT_EQ(0, memcmp(qcoeff_ref, qcoeff_tst, n_coeffs * sizeof(TranLow)))
+            << "iteration " << iter;
+        ASSERT_EQ(0,
+                  memcmp(dqcoeff_ref, dqcoeff_tst, n_coeffs * sizeof(TranLow)))
+            << "iteration " << iter;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+    NEON, NeonQuantizeFpTest,
+    ::testing::Values(
+        QuantizeParam(svt_av1_quantize_fp_c, svt_av1_quantize_fp_neon, 16),
+        QuantizeParam(svt_av1_quantize_fp_c, svt_av1_quantize_fp_neon, 64),
+        QuantizeParam(svt_av1_quantize_fp_c, svt_av1_quantize_fp_neon, 256),
+        QuantizeParam(svt_av1_quantize_fp_32x32_c,
+                      svt_av1_quantize_fp_32x32_neon, 1024),
+        QuantizeParam(svt_av1_quantize_fp_64x64_c,
+                      svt_av1_quantize_fp_64x64_neon, 4096)));
+
+TEST(NeonErrorTest, MatchTest) {
+    // the C squares the differences in 32 bits, the satd sums 4096 absolute
+    // values in an int
+    SVTRandom coeff_rnd(-(1 << 14), (1 << 14) - 1);
+    SVTRandom satd_rnd(-(1 << 18), (1 << 18) - 1);
+    TranLow coeff[4096], dqcoeff[4096];
+
+    for (int length = 16; length <= 4096; length *= 4) {
+        for (int iter = 0; iter < 20; iter++) {
+            for (int i = 0; i < length; i++) {
+                coeff[i] = satd_rnd.random();
+                dqcoeff[i] = 0;
+            }
+            EXPECT_EQ(svt_aom_satd_c(coeff, length),
+                      svt_aom_satd_neon(coeff, length));
+
+            for (int i = 0; i < length; i++) {
+                coeff[i] = coeff_rnd.random();
+                dqcoeff[i] = iter & 1 ? coeff[i] + coeff_rnd.random() % 256
+                                      : coeff_rnd.random();
+            }
+            int64_t ssz_ref, ssz_tst;
+            EXPECT_EQ(svt_av1_block_error_c(coeff, dqcoeff, length, &ssz_ref),
+                      svt_av1_block_error_neon(
+                          coeff, dqcoeff, length, &ssz_tst));
+            EXPECT_EQ(ssz_ref, ssz_tst);
+        }
+    }
+}
+
+}  // namespace
+
+#endif  // ARCH_AARCH64
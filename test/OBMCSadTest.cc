@@ -117,4 +117,21 @@ static const Obmcsad_Param obmc_sad_test_params[] = {
 INSTANTIATE_TEST_CASE_P(OBMC, OBMCsad_Test,
                         ::testing::ValuesIn(obmc_sad_test_params));
 
+#if EN_AVX512_SUPPORT
+#define OBMC_SAD_FUNC_AVX512(W, H) svt_aom_obmc_sad##W##x##H##_avx512
+#define GEN_OBMC_SAD_AVX512_TEST_PARAM(W, H) \
+    Obmcsad_Param(OBMC_SAD_FUNC_C(W, H), OBMC_SAD_FUNC_AVX512(W, H))
+
+static const Obmcsad_Param obmc_sad_avx512_test_params[] = {
+    GEN_OBMC_SAD_AVX512_TEST_PARAM(128, 128),
+    GEN_OBMC_SAD_AVX512_TEST_PARAM(128, 64),
+    GEN_OBMC_SAD_AVX512_TEST_PARAM(64, 128),
+    GEN_OBMC_SAD_AVX512_TEST_PARAM(64, 64),
+    GEN_OBMC_SAD_AVX512_TEST_PARAM(64, 32),
+    GEN_OBMC_SAD_AVX512_TEST_PARAM(64, 16)};
+
+INSTANTIATE_TEST_CASE_P(OBMC_AVX512, OBMCsad_Test,
+                        ::testing::ValuesIn(obmc_sad_avx512_test_params));
+#endif  // EN_AVX512_SUPPORT
+
 }  // namespace
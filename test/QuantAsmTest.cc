@@ -12,9 +12,11 @@
 /******************************************************************************
  * @file QuantAsmTest.c
  *
- * @brief Unit test for quantize avx2 functions:
+ * @brief Unit test for quantize avx2 and avx512 functions:
  * - svt_aom_highbd_quantize_b_avx2
  * - svt_aom_quantize_b_avx2
+ * - svt_aom_highbd_quantize_b_avx512
+ * - svt_aom_quantize_b_avx512
  *
  * @author Cidana-Zhengwen
  *
@@ -39,6 +41,7 @@
 #include "EbDefinitions.h"
 #include "EbTransforms.h"
 #include "EbPictureControlSet.h"
+#include "EbTime.h"
 #include "aom_dsp_rtcd.h"
 #include "util.h"
 #include "random.h"
@@ -60,14 +63,17 @@ using QuantizeFunc = void (*)(const TranLow *coeff_ptr, intptr_t n_coeffs,
                               const QmVal *qm_ptr, const QmVal *iqm_ptr,
                               const int32_t log_scale);
 
-using QuantizeParam = std::tuple<int, int>;
+/** tx_size, bit depth, 8 bit and high bit depth test functions */
+using QuantizeParam = std::tuple<int, int, QuantizeFunc, QuantizeFunc>;
 
 using svt_av1_test_tool::SVTRandom;  // to generate the random
 /**
- * @brief Unit test for quantize avx2 functions:
+ * @brief Unit test for quantize avx2 and avx512 functions:
  * - svt_aom_highbd_quantize_b_avx2
  * - svt_aom_quantize_b_avx2
-  *
+ * - svt_aom_highbd_quantize_b_avx512
+ * - svt_aom_quantize_b_avx512
+ *
  * Test strategy:
  * These tests use quantize C function as reference, input the same data and
  * compare C function output with avx2 function output, so as to check
@@ -84,6 +90,7 @@ using svt_av1_test_tool::SVTRandom;  // to generate the random
  * - AVX2/QuantizeBTest.input_dcac_minmax_q_n
  * - AVX2/QuantizeBTest.input_random_dc_only
  * - AVX2/QuantizeBTest.input_random_all_q_all
+ * - AVX2/QuantizeBTest.DISABLED_speed
  */
 class QuantizeBTest : public ::testing::TestWithParam<QuantizeParam> {
   protected:
@@ -135,10 +142,10 @@ class QuantizeBTest : public ::testing::TestWithParam<QuantizeParam> {
     void setup_func_ptrs() {
         if (bd_ == AOM_BITS_8) {
                 quant_ref_ = svt_aom_quantize_b_c_ii;
-                quant_test_ = svt_aom_quantize_b_avx2;
+                quant_test_ = TEST_GET_PARAM(2);
         } else {
                 quant_ref_ = svt_aom_highbd_quantize_b_c;
-                quant_test_ = svt_aom_highbd_quantize_b_avx2;
+                quant_test_ = TEST_GET_PARAM(3);
         }
         if (tx_size_ == TX_32X32) {
             log_scale = 1;
@@ -215,6 +222,76 @@ class QuantizeBTest : public ::testing::TestWithParam<QuantizeParam> {
         ASSERT_EQ(eob_ref_, eob_test_) << "eobs mismatch, Q: " << q;
     }
 
+    /*
+     * @brief time the C and the target quantize function with the same input
+     */
+    void run_speed(int q) {
+        const ScanOrder *const sc = &av1_scan_orders[tx_size_][DCT_DCT];
+        const int16_t *zbin = qtab_quants_.y_zbin[q];
+        const int16_t *round = qtab_quants_.y_round[q];
+        const int16_t *quant = qtab_quants_.y_quant[q];
+        const int16_t *quant_shift = qtab_quants_.y_quant_shift[q];
+        const int16_t *dequant = qtab_deq_.y_dequant_qtx[q];
+        const int num_loops = 100000000 / n_coeffs_;
+        uint64_t start_time_seconds, start_time_useconds;
+        uint64_t middle_time_seconds, middle_time_useconds;
+        uint64_t finish_time_seconds, finish_time_useconds;
+
+        svt_av1_get_time(&start_time_seconds, &start_time_useconds);
+        for (int i = 0; i < num_loops; ++i)
+            quant_ref_(coeff_in_,
+                       n_coeffs_,
+                       zbin,
+                       round,
+                       quant,
+                       quant_shift,
+                       qcoeff_ref_,
+                       dqcoeff_ref_,
+                       dequant,
+                       &eob_ref_,
+                       sc->scan,
+                       sc->iscan,
+                       NULL,
+                       NULL,
+                       log_scale);
+        svt_av1_get_time(&middle_time_seconds, &middle_time_useconds);
+        for (int i = 0; i < num_loops; ++i)
+            quant_test_(coeff_in_,
+                        n_coeffs_,
+                        zbin,
+                        round,
+                        quant,
+                        quant_shift,
+                        qcoeff_test_,
+                        dqcoeff_test_,
+                        dequant,
+                        &eob_test_,
+                        sc->scan,
+                        sc->iscan,
+                        NULL,
+                        NULL,
+                        log_scale);
+        svt_av1_get_time(&finish_time_seconds, &finish_time_useconds);
+
+        const double time_c =
+            svt_av1_compute_overall_elapsed_time_ms(start_time_seconds,
+                                                    start_time_useconds,
+                                                    middle_time_seconds,
+                                                    middle_time_useconds);
+        const double time_o =
+            svt_av1_compute_overall_elapsed_time_ms(middle_time_seconds,
+                                                    middle_time_useconds,
+                                                    finish_time_seconds,
+                                                    finish_time_useconds);
+        printf("quantize_b(%2dx%2d, %2d bit) c_time = %f \t simd_time = %f \t Gain = %f\n",
+               tx_size_wide[tx_size_],
+               tx_size_high[tx_size_],
+               static_cast<int>(bd_),
+               time_c,
+               time_o,
+               time_c / time_o);
+    }
+
     void fill_coeff_const(int i_begin, int i_end, TranLow c) {
         for (int i = i_begin; i < i_end; ++i) {
             coeff_in_[i] = c;
@@ -315,6 +392,18 @@ TEST_P(QuantizeBTest, input_random_all_q_all) {
     }
 }
 
+/**
+ * @brief AVX2/QuantizeBTest.DISABLED_speed
+ *
+ * compare the speed of quantize C and simd functions with
+ * input coef: dc random and ac all random
+ * q_index: 100
+ */
+TEST_P(QuantizeBTest, DISABLED_speed) {
+    fill_coeff_random(0, n_coeffs_);
+    run_speed(100);
+}
+
 #ifndef FULL_UNIT_TEST
 INSTANTIATE_TEST_CASE_P(
     Quant, QuantizeBTest,
@@ -322,14 +411,40 @@ INSTANTIATE_TEST_CASE_P(
                                          static_cast<int>(TX_32X32),
                                          static_cast<int>(TX_64X64)),
                        ::testing::Values(static_cast<int>(AOM_BITS_8),
-                                         static_cast<int>(AOM_BITS_10))));
+                                         static_cast<int>(AOM_BITS_10)),
+                       ::testing::Values(svt_aom_quantize_b_avx2),
+                       ::testing::Values(svt_aom_highbd_quantize_b_avx2)));
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(
+    QuantAVX512, QuantizeBTest,
+    ::testing::Combine(::testing::Values(static_cast<int>(TX_4X4),
+                                         static_cast<int>(TX_16X16),
+                                         static_cast<int>(TX_32X32),
+                                         static_cast<int>(TX_64X64)),
+                       ::testing::Values(static_cast<int>(AOM_BITS_8),
+                                         static_cast<int>(AOM_BITS_10)),
+                       ::testing::Values(svt_aom_quantize_b_avx512),
+                       ::testing::Values(svt_aom_highbd_quantize_b_avx512)));
+#endif  // EN_AVX512_SUPPORT
 #else
 INSTANTIATE_TEST_CASE_P(
     Quant, QuantizeBTest,
     ::testing::Combine(::testing::Range(static_cast<int>(TX_4X4),
                                         static_cast<int>(TX_SIZES_ALL), 1),
                        ::testing::Values(static_cast<int>(AOM_BITS_8),
-                                         static_cast<int>(AOM_BITS_10))));
+                                         static_cast<int>(AOM_BITS_10)),
+                       ::testing::Values(svt_aom_quantize_b_avx2),
+                       ::testing::Values(svt_aom_highbd_quantize_b_avx2)));
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(
+    QuantAVX512, QuantizeBTest,
+    ::testing::Combine(::testing::Range(static_cast<int>(TX_4X4),
+                                        static_cast<int>(TX_SIZES_ALL), 1),
+                       ::testing::Values(static_cast<int>(AOM_BITS_8),
+                                         static_cast<int>(AOM_BITS_10)),
+                       ::testing::Values(svt_aom_quantize_b_avx512),
+                       ::testing::Values(svt_aom_highbd_quantize_b_avx512)));
+#endif  // EN_AVX512_SUPPORT
 #endif  // FULL_UNIT_TEST
 
 }  // namespace QuantizeAsmTest
@@ -0,0 +1,228 @@
+/*
+ * Copyright(c) 2019 Intel Corporation
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file SsimTest.cc
+ *
+ * @brief Unit test of the SSIM statistics kernels:
+ * - svt_aom_ssim_parms_8x8_{sse2,avx2}
+ * - svt_aom_highbd_ssim_parms_8x8_{sse2,avx2}
+ *
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+// workaround to eliminate the compiling warning on linux
+// The macro will conflict with definition in gtest.h
+#ifdef __USE_GNU
+#undef __USE_GNU  // defined in EbThreads.h
+#endif
+#ifdef _GNU_SOURCE
+#undef _GNU_SOURCE  // defined in EbThreads.h
+#endif
+#include "aom_dsp_rtcd.h"
+#include "EbDefinitions.h"
+#include "EbTime.h"
+#include "random.h"
+#include "util.h"
+
+/** setup_test_env is implemented in test/TestEnv.c */
+extern "C" void setup_test_env();
+
+namespace {
+using svt_av1_test_tool::SVTRandom;
+
+#define SSIM_MAX_STRIDE 96
+#define SSIM_NUM_ITERS 1000
+
+typedef void (*SsimParmsFunc)(const uint8_t *s, int sp, const uint8_t *r,
+                              int rp, uint32_t *sum_s, uint32_t *sum_r,
+                              uint32_t *sum_sq_s, uint32_t *sum_sq_r,
+                              uint32_t *sum_sxr);
+typedef void (*HighbdSsimParmsFunc)(const uint16_t *s, int sp,
+                                    const uint16_t *r, int rp, uint32_t *sum_s,
+                                    uint32_t *sum_r, uint32_t *sum_sq_s,
+                                    uint32_t *sum_sq_r, uint32_t *sum_sxr);
+
+typedef struct {
+    uint32_t sum_s, sum_r, sum_sq_s, sum_sq_r, sum_sxr;
+} SsimParms;
+
+static void check_parms(const SsimParms &ref, const SsimParms &tst) {
+    ASSERT_EQ(ref.sum_s, tst.sum_s);
+    ASSERT_EQ(ref.sum_r, tst.sum_r);
+    ASSERT_EQ(ref.sum_sq_s, tst.sum_sq_s);
+    ASSERT_EQ(ref.sum_sq_r, tst.sum_sq_r);
+    ASSERT_EQ(ref.sum_sxr, tst.sum_sxr);
+}
+
+class SsimParmsTest : public ::testing::TestWithParam<SsimParmsFunc> {
+  public:
+    void SetUp() override {
+        setup_test_env();
+        func_tst_ = GetParam();
+    }
+
+  protected:
+    void run_test(int run_times) {
+        SVTRandom rnd(0, 255);
+        SVTRandom rnd_stride(8, SSIM_MAX_STRIDE);
+        uint8_t src[SSIM_MAX_STRIDE * 8], rec[SSIM_MAX_STRIDE * 8];
+        double time_c = 0, time_o = 0;
+
+        for (int iter = 0; iter < SSIM_NUM_ITERS; iter++) {
+            const int sp = rnd_stride.random(), rp = rnd_stride.random();
+            // the first iterations exercise the extremes of the range
+            for (int i = 0; i < SSIM_MAX_STRIDE * 8; i++) {
+                src[i] = iter == 0 ? 255 : iter == 1 ? 0 : rnd.random();
+                rec[i] = iter == 0 ? 255 : iter == 1 ? 255 : rnd.random();
+            }
+
+            // the kernels accumulate into the outputs
+            SsimParms ref = {1, 2, 3, 4, 5}, tst = {1, 2, 3, 4, 5};
+            svt_aom_ssim_parms_8x8_c(src, sp, rec, rp, &ref.sum_s, &ref.sum_r,
+                                     &ref.sum_sq_s, &ref.sum_sq_r,
+                                     &ref.sum_sxr);
+            func_tst_(src, sp, rec, rp, &tst.sum_s, &tst.sum_r, &tst.sum_sq_s,
+                      &tst.sum_sq_r, &tst.sum_sxr);
+            check_parms(ref, tst);
+
+            if (run_times > 1) {
+                uint64_t start_s, start_us, middle_s, middle_us, end_s, end_us;
+                svt_av1_get_time(&start_s, &start_us);
+                for (int j = 0; j < run_times; j++)
+                    svt_aom_ssim_parms_8x8_c(src, sp, rec, rp, &ref.sum_s,
+                                             &ref.sum_r, &ref.sum_sq_s,
+                                             &ref.sum_sq_r, &ref.sum_sxr);
+                svt_av1_get_time(&middle_s, &middle_us);
+                for (int j = 0; j < run_times; j++)
+                    func_tst_(src, sp, rec, rp, &tst.sum_s, &tst.sum_r,
+                              &tst.sum_sq_s, &tst.sum_sq_r, &tst.sum_sxr);
+                svt_av1_get_time(&end_s, &end_us);
+                time_c += svt_av1_compute_overall_elapsed_time_ms(
+                    start_s, start_us, middle_s, middle_us);
+                time_o += svt_av1_compute_overall_elapsed_time_ms(
+                    middle_s, middle_us, end_s, end_us);
+            }
+        }
+
+        if (run_times > 1) {
+            printf("    svt_aom_ssim_parms_8x8 c: %6.2f ms  simd: %6.2f ms  "
+                   "(Comparison: %5.2fx)\n",
+                   time_c,
+                   time_o,
+                   time_c / time_o);
+        }
+    }
+
+    SsimParmsFunc func_tst_;
+};
+
+TEST_P(SsimParmsTest, CheckOutput) {
+    run_test(1);
+}
+
+TEST_P(SsimParmsTest, DISABLED_Speed) {
+    run_test(1000);
+}
+
+INSTANTIATE_TEST_CASE_P(SSE2, SsimParmsTest,
+                        ::testing::Values(svt_aom_ssim_parms_8x8_sse2));
+
+INSTANTIATE_TEST_CASE_P(AVX2, SsimParmsTest,
+                        ::testing::Values(svt_aom_ssim_parms_8x8_avx2));
+
+typedef std::tuple<int, HighbdSsimParmsFunc> HighbdSsimParmsParam;
+
+class HighbdSsimParmsTest
+    : public ::testing::TestWithParam<HighbdSsimParmsParam> {
+  public:
+    void SetUp() override {
+        setup_test_env();
+        bd_ = TEST_GET_PARAM(0);
+        func_tst_ = TEST_GET_PARAM(1);
+    }
+
+  protected:
+    void run_test(int run_times) {
+        const uint16_t max_val = (1 << bd_) - 1;
+        SVTRandom rnd(0, max_val);
+        SVTRandom rnd_stride(8, SSIM_MAX_STRIDE);
+        uint16_t src[SSIM_MAX_STRIDE * 8], rec[SSIM_MAX_STRIDE * 8];
+        double time_c = 0, time_o = 0;
+
+        for (int iter = 0; iter < SSIM_NUM_ITERS; iter++) {
+            const int sp = rnd_stride.random(), rp = rnd_stride.random();
+            for (int i = 0; i < SSIM_MAX_STRIDE * 8; i++) {
+                src[i] = iter == 0 ? max_val : iter == 1 ? 0 : rnd.random();
+                rec[i] = iter == 0 ? max_val : iter == 1 ? max_val
+                                                         : rnd.random();
+            }
+
+            SsimParms ref = {1, 2, 3, 4, 5}, tst = {1, 2, 3, 4, 5};
+            svt_aom_highbd_ssim_parms_8x8_c(src, sp, rec, rp, &ref.sum_s,
+                                            &ref.sum_r, &ref.sum_sq_s,
+                                            &ref.sum_sq_r, &ref.sum_sxr);
+            func_tst_(src, sp, rec, rp, &tst.sum_s, &tst.sum_r, &tst.sum_sq_s,
+                      &tst.sum_sq_r, &tst.sum_sxr);
+            check_parms(ref, tst);
+
+            if (run_times > 1) {
+                uint64_t start_s, start_us, middle_s, middle_us, end_s, end_us;
+                svt_av1_get_time(&start_s, &start_us);
+                for (int j = 0; j < run_times; j++)
+                    svt_aom_highbd_ssim_parms_8x8_c(
+                        src, sp, rec, rp, &ref.sum_s, &ref.sum_r,
+                        &ref.sum_sq_s, &ref.sum_sq_r, &ref.sum_sxr);
+                svt_av1_get_time(&middle_s, &middle_us);
+                for (int j = 0; j < run_times; j++)
+                    func_tst_(src, sp, rec, rp, &tst.sum_s, &tst.sum_r,
+                              &tst.sum_sq_s, &tst.sum_sq_r, &tst.sum_sxr);
+                svt_av1_get_time(&end_s, &end_us);
+                time_c += svt_av1_compute_overall_elapsed_time_ms(
+                    start_s, start_us, middle_s, middle_us);
+                time_o += svt_av1_compute_overall_elapsed_time_ms(
+                    middle_s, middle_us, end_s, end_us);
+            }
+        }
+
+        if (run_times > 1) {
+            printf("    svt_aom_highbd_ssim_parms_8x8 (%d bit) c: %6.2f ms  "
+                   "simd: %6.2f ms  (Comparison: %5.2fx)\n",
+                   bd_,
+                   time_c,
+                   time_o,
+                   time_c / time_o);
+        }
+    }
+
+    int bd_;
+    HighbdSsimParmsFunc func_tst_;
+};
+
+TEST_P(HighbdSsimParmsTest, CheckOutput) {
+    run_test(1);
+}
+
+TEST_P(HighbdSsimParmsTest, DISABLED_Speed) {
+    run_test(1000);
+}
+
+INSTANTIATE_TEST_CASE_P(
+    SSE2, HighbdSsimParmsTest,
+    ::testing::Combine(::testing::Values(10, 12),
+                       ::testing::Values(svt_aom_highbd_ssim_parms_8x8_sse2)));
+
+INSTANTIATE_TEST_CASE_P(
+    AVX2, HighbdSsimParmsTest,
+    ::testing::Combine(::testing::Values(10, 12),
+                       ::testing::Values(svt_aom_highbd_ssim_parms_8x8_avx2)));
+
+}  // namespace
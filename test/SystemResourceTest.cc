@@ -0,0 +1,315 @@
+/*
+* Copyright(c) 2019 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+/******************************************************************************
+ * @file SystemResourceTest.cc
+ *
+ * @brief Unit test of the hand-offs between the encoder processes:
+ * - svt_get_empty_object
+ * - svt_post_full_object
+ * - svt_get_full_object
+ * - svt_release_object
+ * - svt_shutdown_process
+ *
+ * The speed tests measure the hand-off latency between two threads and the
+ * hand-off throughput with 8, 32 and 64 threads sharing a SystemResource.
+ * Build with ENABLE_LOCKFREE_FIFO on and off to compare the queue backends.
+ *
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+// workaround to eliminate the compiling warning on linux
+// The macro will conflict with definition in gtest.h
+#ifdef __USE_GNU
+#undef __USE_GNU  // defined in EbThreads.h
+#endif
+#ifdef _GNU_SOURCE
+#undef _GNU_SOURCE  // defined in EbThreads.h
+#endif
+#include "EbSystemResourceManager.h"
+#include "EbTime.h"
+
+namespace {
+
+typedef struct TestObject {
+    uint32_t producer_index;
+    uint32_t sequence;
+} TestObject;
+
+static EbErrorType test_object_creator(EbPtr *object_dbl_ptr, EbPtr object_init_data_ptr) {
+    (void)object_init_data_ptr;
+    *object_dbl_ptr = calloc(1, sizeof(TestObject));
+    return *object_dbl_ptr ? EB_ErrorNone : EB_ErrorInsufficientResources;
+}
+
+static void test_object_destroyer(EbPtr p) {
+    free(p);
+}
+
+static EbSystemResource *create_resource(uint32_t object_count, uint32_t producer_count,
+                                         uint32_t consumer_count, EbBool lazy) {
+    EbSystemResource *resource_ptr = (EbSystemResource *)calloc(1, sizeof(*resource_ptr));
+    EbErrorType       err;
+
+    if (!resource_ptr)
+        return NULL;
+    if (lazy)
+        err = svt_system_resource_lazy_ctor(resource_ptr,
+                                            object_count,
+                                            producer_count,
+                                            consumer_count,
+                                            test_object_creator,
+                                            NULL,
+                                            0,
+                                            test_object_destroyer);
+    else
+        err = svt_system_resource_ctor(resource_ptr,
+                                       object_count,
+                                       producer_count,
+                                       consumer_count,
+                                       test_object_creator,
+                                       NULL,
+                                       test_object_destroyer);
+    if (err != EB_ErrorNone) {
+        resource_ptr->dctor(resource_ptr);
+        free(resource_ptr);
+        return NULL;
+    }
+    return resource_ptr;
+}
+
+static void destroy_resource(EbSystemResource *resource_ptr) {
+    if (resource_ptr) {
+        resource_ptr->dctor(resource_ptr);
+        free(resource_ptr);
+    }
+}
+
+static const char *queue_backend() {
+    return EN_LOCKFREE_FIFO ? "lock-free" : "mutex";
+}
+
+static double elapsed_ms(uint64_t start_seconds, uint64_t start_useconds) {
+    uint64_t finish_seconds, finish_useconds;
+    svt_av1_get_time(&finish_seconds, &finish_useconds);
+    return svt_av1_compute_overall_elapsed_time_ms(
+        start_seconds, start_useconds, finish_seconds, finish_useconds);
+}
+
+class SystemResourceTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        resource_ = NULL;
+    }
+
+    void TearDown() override {
+        destroy_resource(resource_);
+    }
+
+    void construct(uint32_t object_count, uint32_t producer_count, uint32_t consumer_count,
+                   EbBool lazy) {
+        destroy_resource(resource_);
+        resource_ = create_resource(object_count, producer_count, consumer_count, lazy);
+        ASSERT_NE(resource_, nullptr);
+    }
+
+    // Posts item_count objects from each producer and checks that every
+    // object is received once, in posting order for a given producer
+    void run_hand_off(uint32_t object_count, uint32_t producer_count, uint32_t consumer_count,
+                      uint32_t item_count, EbBool lazy) {
+        construct(object_count, producer_count, consumer_count, lazy);
+        if (HasFatalFailure())
+            return;
+
+        std::vector<std::vector<uint8_t>> received(producer_count,
+                                                   std::vector<uint8_t>(item_count, 0));
+        std::atomic<uint32_t>             received_count(0);
+        std::atomic<uint32_t>             order_errors(0);
+        std::vector<std::thread>          consumers;
+        std::vector<std::thread>          producers;
+
+        for (uint32_t c = 0; c < consumer_count; c++) {
+            consumers.emplace_back([&, c]() {
+                EbFifo *             fifo_ptr = svt_system_resource_get_consumer_fifo(resource_, c);
+                std::vector<int64_t> last_sequence(producer_count, -1);
+                for (;;) {
+                    EbObjectWrapper *wrapper_ptr;
+                    if (svt_get_full_object(fifo_ptr, &wrapper_ptr) == EB_NoErrorFifoShutdown)
+                        break;
+                    TestObject *obj = (TestObject *)wrapper_ptr->object_ptr;
+                    if ((int64_t)obj->sequence <= last_sequence[obj->producer_index])
+                        order_errors++;
+                    last_sequence[obj->producer_index] = obj->sequence;
+                    received[obj->producer_index][obj->sequence]++;
+                    svt_release_object(wrapper_ptr);
+                    received_count++;
+                }
+            });
+        }
+        for (uint32_t p = 0; p < producer_count; p++) {
+            producers.emplace_back([&, p]() {
+                EbFifo *fifo_ptr = svt_system_resource_get_producer_fifo(resource_, p);
+                for (uint32_t i = 0; i < item_count; i++) {
+                    EbObjectWrapper *wrapper_ptr;
+                    svt_get_empty_object(fifo_ptr, &wrapper_ptr);
+                    TestObject *obj     = (TestObject *)wrapper_ptr->object_ptr;
+                    obj->producer_index = p;
+                    obj->sequence       = i;
+                    svt_post_full_object(wrapper_ptr);
+                }
+            });
+        }
+        for (auto &t : producers) t.join();
+        while (received_count < producer_count * item_count) std::this_thread::yield();
+        svt_shutdown_process(resource_);
+        for (auto &t : consumers) t.join();
+
+        EXPECT_EQ(order_errors, 0u);
+        for (uint32_t p = 0; p < producer_count; p++)
+            for (uint32_t i = 0; i < item_count; i++)
+                ASSERT_EQ(received[p][i], 1) << "producer " << p << " item " << i;
+        EXPECT_LE(resource_->object_total_count, object_count);
+    }
+
+    EbSystemResource *resource_;
+};
+
+TEST_F(SystemResourceTest, SingleProducerSingleConsumer) {
+    run_hand_off(4, 1, 1, 10000, EB_FALSE);
+}
+
+TEST_F(SystemResourceTest, MultipleProducersMultipleConsumers) {
+    run_hand_off(16, 4, 4, 5000, EB_FALSE);
+}
+
+TEST_F(SystemResourceTest, LazyResource) {
+    run_hand_off(64, 3, 2, 5000, EB_TRUE);
+}
+
+TEST_F(SystemResourceTest, NonBlockingGet) {
+    construct(2, 1, 1, EB_FALSE);
+    if (HasFatalFailure())
+        return;
+    EbFifo *         producer_fifo = svt_system_resource_get_producer_fifo(resource_, 0);
+    EbFifo *         consumer_fifo = svt_system_resource_get_consumer_fifo(resource_, 0);
+    EbObjectWrapper *wrapper_ptr;
+
+    svt_get_full_object_non_blocking(consumer_fifo, &wrapper_ptr);
+    EXPECT_EQ(wrapper_ptr, nullptr);
+
+    svt_get_empty_object(producer_fifo, &wrapper_ptr);
+    svt_post_full_object(wrapper_ptr);
+    svt_get_full_object_non_blocking(consumer_fifo, &wrapper_ptr);
+    ASSERT_NE(wrapper_ptr, nullptr);
+    svt_release_object(wrapper_ptr);
+
+    svt_shutdown_process(resource_);
+    svt_get_full_object_non_blocking(consumer_fifo, &wrapper_ptr);
+    EXPECT_EQ(wrapper_ptr, nullptr);
+}
+
+// Round trips of an object between two threads through two SystemResources
+TEST_F(SystemResourceTest, DISABLED_HandOffLatencySpeed) {
+    const uint32_t    round_trip_count = 200000;
+    EbSystemResource *echo_resource    = NULL;
+
+    construct(1, 1, 1, EB_FALSE);
+    if (HasFatalFailure())
+        return;
+    echo_resource = create_resource(1, 1, 1, EB_FALSE);
+    ASSERT_NE(echo_resource, nullptr);
+
+    std::thread echo([&]() {
+        EbFifo *in_fifo  = svt_system_resource_get_consumer_fifo(resource_, 0);
+        EbFifo *out_fifo = svt_system_resource_get_producer_fifo(echo_resource, 0);
+        for (uint32_t i = 0; i < round_trip_count; i++) {
+            EbObjectWrapper *wrapper_ptr;
+            svt_get_full_object(in_fifo, &wrapper_ptr);
+            svt_release_object(wrapper_ptr);
+            svt_get_empty_object(out_fifo, &wrapper_ptr);
+            svt_post_full_object(wrapper_ptr);
+        }
+    });
+
+    EbFifo * out_fifo = svt_system_resource_get_producer_fifo(resource_, 0);
+    EbFifo * in_fifo  = svt_system_resource_get_consumer_fifo(echo_resource, 0);
+    uint64_t start_seconds, start_useconds;
+    svt_av1_get_time(&start_seconds, &start_useconds);
+    for (uint32_t i = 0; i < round_trip_count; i++) {
+        EbObjectWrapper *wrapper_ptr;
+        svt_get_empty_object(out_fifo, &wrapper_ptr);
+        svt_post_full_object(wrapper_ptr);
+        svt_get_full_object(in_fifo, &wrapper_ptr);
+        svt_release_object(wrapper_ptr);
+    }
+    const double time = elapsed_ms(start_seconds, start_useconds);
+    echo.join();
+    destroy_resource(echo_resource);
+
+    printf("    %s fifo: hand-off latency %.3f us\n",
+           queue_backend(),
+           time * 1000 / (2.0 * round_trip_count));
+}
+
+// Half of the threads post objects, the other half consume them
+TEST_F(SystemResourceTest, DISABLED_HandOffContentionSpeed) {
+    const uint32_t thread_counts[] = {8, 32, 64};
+    const uint32_t hand_off_count  = 400000;
+
+    for (uint32_t thread_count : thread_counts) {
+        const uint32_t producer_count = thread_count / 2;
+        const uint32_t consumer_count = thread_count - producer_count;
+        const uint32_t item_count     = hand_off_count / producer_count;
+
+        construct(2 * thread_count, producer_count, consumer_count, EB_FALSE);
+        if (HasFatalFailure())
+            return;
+
+        std::atomic<uint32_t>    received_count(0);
+        std::vector<std::thread> threads;
+        uint64_t                 start_seconds, start_useconds;
+        svt_av1_get_time(&start_seconds, &start_useconds);
+        for (uint32_t c = 0; c < consumer_count; c++) {
+            threads.emplace_back([&, c]() {
+                EbFifo *fifo_ptr = svt_system_resource_get_consumer_fifo(resource_, c);
+                EbObjectWrapper *wrapper_ptr;
+                while (svt_get_full_object(fifo_ptr, &wrapper_ptr) != EB_NoErrorFifoShutdown) {
+                    svt_release_object(wrapper_ptr);
+                    received_count++;
+                }
+            });
+        }
+        for (uint32_t p = 0; p < producer_count; p++) {
+            threads.emplace_back([&, p]() {
+                EbFifo *fifo_ptr = svt_system_resource_get_producer_fifo(resource_, p);
+                for (uint32_t i = 0; i < item_count; i++) {
+                    EbObjectWrapper *wrapper_ptr;
+                    svt_get_empty_object(fifo_ptr, &wrapper_ptr);
+                    svt_post_full_object(wrapper_ptr);
+                }
+            });
+        }
+        while (received_count < producer_count * item_count) std::this_thread::yield();
+        const double time = elapsed_ms(start_seconds, start_useconds);
+        svt_shutdown_process(resource_);
+        for (auto &t : threads) t.join();
+
+        printf("    %s fifo, %2u threads: %.3f us per hand-off\n",
+               queue_backend(),
+               thread_count,
+               time * 1000 / (producer_count * item_count));
+    }
+}
+
+}  // namespace
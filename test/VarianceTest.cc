@@ -13,7 +13,7 @@
  * @file VarianceTest.cc
  *
  * @brief Unit test for variance, mse, sum square functions:
- * - svt_aom_variance{4-128}x{4-128}_{c,sse2,avx2}
+ * - svt_aom_variance{4-128}x{4-128}_{c,sse2,avx2,avx512}
  * - svt_aom_get_mb_ss_sse2
  * - aom_mse16x16_{c,avx2}
  * - highbd_variance64_{c,avx2}
@@ -38,6 +38,7 @@
 #include "util.h"
 #include "gtest/gtest.h"
 #include "EbUtility.h"
+#include "EbTime.h"
 
 using svt_av1_test_tool::SVTRandom;  // to generate the random
 namespace {
@@ -298,7 +299,7 @@ using VarianceParam =
 
 /**
  * @brief Unit test for variance functions, target functions include:
- *  - - svt_aom_variance{4-128}x{4-128}_{c,avx2}
+ *  - - svt_aom_variance{4-128}x{4-128}_{c,avx2,avx512}
  *
  * Test strategy:
  *  This test case contains zero test, random value test, one quarter test as
@@ -377,6 +378,47 @@ class VarianceTest : public ::testing::TestWithParam<VarianceParam> {
         ASSERT_EQ(var_asm, expected);
     }
 
+    void run_speed_test() {
+        SVTRandom rnd(0, (1 << 8) - 1);
+        for (int j = 0; j < MAX_BLOCK_SIZE; j++) {
+            src_data_[j] = rnd.random();
+            ref_data_[j] = rnd.random();
+        }
+
+        const uint64_t num_loops = 1000000000 / (width_ * height_);
+        uint32_t sse_c, sse_asm, var_c = 0, var_asm = 0;
+        double time_c, time_o;
+        uint64_t start_time_seconds, start_time_useconds;
+        uint64_t middle_time_seconds, middle_time_useconds;
+        uint64_t finish_time_seconds, finish_time_useconds;
+
+        svt_av1_get_time(&start_time_seconds, &start_time_useconds);
+        for (uint64_t i = 0; i < num_loops; i++)
+            var_c = func_c_(src_data_, width_, ref_data_, width_, &sse_c);
+        svt_av1_get_time(&middle_time_seconds, &middle_time_useconds);
+        for (uint64_t i = 0; i < num_loops; i++)
+            var_asm =
+                func_asm_(src_data_, width_, ref_data_, width_, &sse_asm);
+        svt_av1_get_time(&finish_time_seconds, &finish_time_useconds);
+
+        ASSERT_EQ(var_c, var_asm);
+
+        time_c = svt_av1_compute_overall_elapsed_time_ms(start_time_seconds,
+                                                         start_time_useconds,
+                                                         middle_time_seconds,
+                                                         middle_time_useconds);
+        time_o = svt_av1_compute_overall_elapsed_time_ms(middle_time_seconds,
+                                                         middle_time_useconds,
+                                                         finish_time_seconds,
+                                                         finish_time_useconds);
+        printf("    variance%ux%u: %6.2f    asm: %6.2f    (Comparison: %5.2fx)\n",
+               width_,
+               height_,
+               1000000 * time_c / num_loops,
+               1000000 * time_o / num_loops,
+               time_c / time_o);
+    }
+
   private:
     uint8_t *src_data_;
     uint8_t *ref_data_;
@@ -398,6 +440,10 @@ TEST_P(VarianceTest, OneQuarterTest) {
     run_one_quarter_test();
 };
 
+TEST_P(VarianceTest, DISABLED_Speed) {
+    run_speed_test();
+};
+
 INSTANTIATE_TEST_CASE_P(
     Variance, VarianceTest,
     ::testing::Values(
@@ -435,5 +481,22 @@ INSTANTIATE_TEST_CASE_P(
                       &svt_aom_variance128x64_avx2),
         VarianceParam(128, 128, &svt_aom_variance128x128_c,
                       &svt_aom_variance128x128_avx2)));
+
+#if EN_AVX512_SUPPORT
+INSTANTIATE_TEST_CASE_P(
+    AVX512, VarianceTest,
+    ::testing::Values(VarianceParam(64, 16, &svt_aom_variance64x16_c,
+                                    &svt_aom_variance64x16_avx512),
+                      VarianceParam(64, 32, &svt_aom_variance64x32_c,
+                                    &svt_aom_variance64x32_avx512),
+                      VarianceParam(64, 64, &svt_aom_variance64x64_c,
+                                    &svt_aom_variance64x64_avx512),
+                      VarianceParam(64, 128, &svt_aom_variance64x128_c,
+                                    &svt_aom_variance64x128_avx512),
+                      VarianceParam(128, 64, &svt_aom_variance128x64_c,
+                                    &svt_aom_variance128x64_avx512),
+                      VarianceParam(128, 128, &svt_aom_variance128x128_c,
+                                    &svt_aom_variance128x128_avx512)));
+#endif  // EN_AVX512_SUPPORT
 }  // namespace
 
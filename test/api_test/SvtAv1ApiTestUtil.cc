@@ -0,0 +1,140 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+/******************************************************************************
+ * @file SvtAv1ApiTestUtil.cc
+ *
+ * @brief Helpers of the api tests encoding synthetic pictures
+ *
+ ******************************************************************************/
+#include <string.h>
+#include "SvtAv1ApiTestUtil.h"
+
+namespace svt_av1_test {
+
+void fill_test_picture(uint8_t *luma, uint8_t *cb, uint8_t *cr, uint32_t width,
+                       uint32_t height, uint32_t y_stride,
+                       uint32_t chroma_stride, uint32_t frame) {
+    const uint32_t square = height / 4;
+    const uint32_t square_x = (frame * 3) % (width - square);
+    const uint32_t square_y = (frame * 2) % (height - square);
+
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t value = (uint8_t)(((x * 7) ^ (y * 5)) + frame);
+            if (x >= square_x && x < square_x + square && y >= square_y &&
+                y < square_y + square)
+                value = (uint8_t)(255 - ((x + y) & 31));
+            luma[y * y_stride + x] = value;
+        }
+    }
+    for (uint32_t y = 0; y < (height + 1) / 2; ++y) {
+        for (uint32_t x = 0; x < (width + 1) / 2; ++x) {
+            cb[y * chroma_stride + x] = (uint8_t)(128 + ((x + frame) & 15));
+            cr[y * chroma_stride + x] = (uint8_t)(128 - ((y + frame) & 15));
+        }
+    }
+}
+
+EbErrorType receive_packets(EbComponentType *enc_handle, uint8_t pic_send_done,
+                            const PacketHandler &on_packet) {
+    while (1) {
+        EbBufferHeaderType *packet = NULL;
+        EbErrorType status =
+            svt_av1_enc_get_packet(enc_handle, &packet, pic_send_done);
+        if (status == EB_NoErrorEmptyQueue)
+            return status;
+        if (status != EB_ErrorNone)
+            return status;
+        if (packet->flags & EB_BUFFERFLAG_ERROR_MASK) {
+            svt_av1_enc_release_out_buffer(&packet);
+            return EB_ErrorUndefined;
+        }
+        const uint32_t flags = packet->flags;
+        if (on_packet)
+            on_packet(packet);
+        svt_av1_enc_release_out_buffer(&packet);
+        if (flags & EB_BUFFERFLAG_EOS)
+            return EB_ErrorNone;
+    }
+}
+
+EbErrorType encode_test_pictures(EbComponentType *enc_handle, uint32_t width,
+                                 uint32_t height, uint32_t frame_count,
+                                 const PacketHandler &on_packet) {
+    const uint32_t chroma_width = (width + 1) / 2;
+    const uint32_t chroma_height = (height + 1) / 2;
+    std::vector<uint8_t> luma(width * height);
+    std::vector<uint8_t> cb(chroma_width * chroma_height);
+    std::vector<uint8_t> cr(chroma_width * chroma_height);
+
+    EbSvtIOFormat picture;
+    memset(&picture, 0, sizeof(picture));
+    picture.luma = luma.data();
+    picture.cb = cb.data();
+    picture.cr = cr.data();
+    picture.y_stride = width;
+    picture.cb_stride = chroma_width;
+    picture.cr_stride = chroma_width;
+    picture.width = width;
+    picture.height = height;
+    picture.color_fmt = EB_YUV420;
+
+    EbBufferHeaderType header;
+    memset(&header, 0, sizeof(header));
+    header.size = sizeof(header);
+    header.p_buffer = (uint8_t *)&picture;
+    header.n_alloc_len = (uint32_t)(luma.size() + cb.size() + cr.size());
+    header.pic_type = EB_AV1_INVALID_PICTURE;
+
+    EbErrorType status;
+    for (uint32_t frame = 0; frame < frame_count; ++frame) {
+        fill_test_picture(luma.data(), cb.data(), cr.data(), width, height,
+                          width, chroma_width, frame);
+        header.n_filled_len = header.n_alloc_len;
+        header.pts = frame;
+        status = svt_av1_enc_send_picture(enc_handle, &header);
+        if (status != EB_ErrorNone)
+            return status;
+        status = receive_packets(enc_handle, 0, on_packet);
+        if (status == EB_ErrorNone)
+            return EB_ErrorUndefined; /* end of stream before the last picture */
+        if (status != EB_NoErrorEmptyQueue)
+            return status;
+    }
+
+    return finish_encode(enc_handle, on_packet);
+}
+
+EbErrorType finish_encode(EbComponentType *enc_handle,
+                          const PacketHandler &on_packet) {
+    EbBufferHeaderType eos;
+    memset(&eos, 0, sizeof(eos));
+    eos.size = sizeof(eos);
+    eos.flags = EB_BUFFERFLAG_EOS;
+    eos.pic_type = EB_AV1_INVALID_PICTURE;
+    EbErrorType status = svt_av1_enc_send_picture(enc_handle, &eos);
+    if (status != EB_ErrorNone)
+        return status;
+    return receive_packets(enc_handle, 1, on_packet);
+}
+
+void TemporalUnitCollector::operator()(const EbBufferHeaderType *packet) {
+    pending_.insert(pending_.end(), packet->p_buffer,
+                    packet->p_buffer + packet->n_filled_len);
+    if (packet->flags & (EB_BUFFERFLAG_IS_ALT_REF | EB_BUFFERFLAG_PARTIAL))
+        return;
+    if (!pending_.empty())
+        units.push_back(pending_);
+    pending_.clear();
+}
+
+}  // namespace svt_av1_test
@@ -0,0 +1,68 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+/******************************************************************************
+ * @file SvtAv1ApiTestUtil.h
+ *
+ * @brief Helpers of the api tests encoding synthetic pictures
+ *
+ ******************************************************************************/
+#ifndef _SVT_AV1_API_TEST_UTIL_H_
+#define _SVT_AV1_API_TEST_UTIL_H_
+
+#include <functional>
+#include <vector>
+#include "EbSvtAv1Enc.h"
+
+namespace svt_av1_test {
+
+/** Called for each packet returned by svt_av1_enc_get_packet(), before the
+ * packet is released */
+typedef std::function<void(const EbBufferHeaderType *packet)> PacketHandler;
+
+/** 8-bit 4:2:0 synthetic picture, a textured background with a square
+ * moving across it */
+void fill_test_picture(uint8_t *luma, uint8_t *cb, uint8_t *cr, uint32_t width,
+                       uint32_t height, uint32_t y_stride,
+                       uint32_t chroma_stride, uint32_t frame);
+
+/** Sends frame_count synthetic pictures of width x height to an initialized
+ * encoder, then the end of stream, and passes every packet to on_packet
+ * until the last one. Returns EB_ErrorNone once the last packet is out. */
+EbErrorType encode_test_pictures(EbComponentType *enc_handle, uint32_t width,
+                                 uint32_t height, uint32_t frame_count,
+                                 const PacketHandler &on_packet);
+
+/** Passes the packets available to on_packet, waiting for them when
+ * pic_send_done is set. Returns EB_ErrorNone once the last packet is out,
+ * EB_NoErrorEmptyQueue while it is not. */
+EbErrorType receive_packets(EbComponentType *enc_handle, uint8_t pic_send_done,
+                            const PacketHandler &on_packet);
+
+/** Sends the end of stream and passes every packet left to on_packet until
+ * the last one */
+EbErrorType finish_encode(EbComponentType *enc_handle,
+                          const PacketHandler &on_packet);
+
+/** Collects the packets of an encode into temporal units: the packets of
+ * the frames which are not shown are merged with the next one */
+class TemporalUnitCollector {
+  public:
+    void operator()(const EbBufferHeaderType *packet);
+    std::vector<std::vector<uint8_t>> units;
+
+  private:
+    std::vector<uint8_t> pending_;
+};
+
+}  // namespace svt_av1_test
+
+#endif  // _SVT_AV1_API_TEST_UTIL_H_
@@ -0,0 +1,315 @@
+/*
+* Copyright(c) 2019 Netflix, Inc.
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+/******************************************************************************
+ * @file SvtAv1DecApiTest.cc
+ *
+ * @brief SVT-AV1 decoder api test, decodes streams of the encoder with the
+ * parse / reconstruction pipeline (num_p_frames > 1)
+ *
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <functional>
+#include <vector>
+#include "EbSvtAv1Dec.h"
+#include "gtest/gtest.h"
+#include "SvtAv1EncApiTest.h"
+#include "SvtAv1ApiTestUtil.h"
+
+using namespace svt_av1_test;
+
+namespace {
+
+typedef std::vector<std::vector<uint8_t>> TemporalUnits;
+
+/** Encodes frame_count synthetic pictures with a single tile */
+static void encode_stream(uint32_t width, uint32_t height, uint32_t frame_count,
+                          TemporalUnits *units) {
+    SvtAv1Context context;
+    memset(&context, 0, sizeof(context));
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_init_handle(
+                  &context.enc_handle, &context, &context.enc_params));
+    context.enc_params.source_width = width;
+    context.enc_params.source_height = height;
+    context.enc_params.enc_mode = 8;
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_set_parameter(context.enc_handle, &context.enc_params));
+    ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init(context.enc_handle));
+    TemporalUnitCollector collector;
+    EXPECT_EQ(EB_ErrorNone,
+              encode_test_pictures(context.enc_handle, width, height,
+                                   frame_count, std::ref(collector)));
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit(context.enc_handle));
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit_handle(context.enc_handle));
+    *units = collector.units;
+}
+
+/** Decoder of 8-bit 4:2:0 pictures keeping a copy of the output pictures */
+class TestDecoder {
+  public:
+    TestDecoder(uint32_t width, uint32_t height)
+        : width_(width), height_(height), handle_(NULL) {
+        // The decoder reallocates the planes with malloc() when the output
+        // picture does not match them
+        memset(&picture_, 0, sizeof(picture_));
+        picture_.luma = (uint8_t *)malloc(width * height);
+        picture_.cb = (uint8_t *)malloc(width * height / 4);
+        picture_.cr = (uint8_t *)malloc(width * height / 4);
+        picture_.y_stride = width;
+        picture_.cb_stride = width / 2;
+        picture_.cr_stride = width / 2;
+        picture_.width = width;
+        picture_.height = height;
+        picture_.color_fmt = EB_YUV420;
+        picture_.bit_depth = EB_EIGHT_BIT;
+        memset(&header_, 0, sizeof(header_));
+        header_.size = sizeof(header_);
+        header_.p_buffer = (uint8_t *)&picture_;
+    }
+
+    ~TestDecoder() {
+        free(picture_.luma);
+        free(picture_.cb);
+        free(picture_.cr);
+    }
+
+    EbErrorType open(uint32_t threads, uint32_t num_p_frames,
+                     EbBool parse_only = EB_FALSE) {
+        EbErrorType status = svt_av1_dec_init_handle(&handle_, NULL, &config_);
+        if (status != EB_ErrorNone)
+            return status;
+        config_.threads = threads;
+        config_.num_p_frames = num_p_frames;
+        config_.parse_only = parse_only;
+        config_.max_picture_width = width_;
+        config_.max_picture_height = height_;
+        status = svt_av1_dec_set_parameter(handle_, &config_);
+        if (status != EB_ErrorNone)
+            return status;
+        return svt_av1_dec_init(handle_);
+    }
+
+    void close() {
+        svt_av1_dec_deinit(handle_);
+        svt_av1_dec_deinit_handle(handle_);
+        handle_ = NULL;
+    }
+
+    EbErrorType decode(const std::vector<uint8_t> &unit) {
+        // The bit reader loads the bytes past the end of the data by words
+        data_.assign(unit.begin(), unit.end());
+        data_.resize(unit.size() + 8);
+        return svt_av1_dec_frame(handle_, data_.data(), unit.size(), 0);
+    }
+
+    EbErrorType flush() {
+        return svt_av1_dec_frame(handle_, NULL, 0, 0);
+    }
+
+    /* Returns false when there is no output picture */
+    bool get_picture(bool keep) {
+        if (svt_av1_dec_get_picture(handle_, &header_, &stream_info_,
+                                    &frame_info_) == EB_DecNoOutputPicture)
+            return false;
+        if (keep) {
+            std::vector<uint8_t> copy;
+            for (uint32_t y = 0; y < height_; ++y)
+                copy.insert(copy.end(), picture_.luma + y * picture_.y_stride,
+                            picture_.luma + y * picture_.y_stride + width_);
+            for (uint32_t y = 0; y < height_ / 2; ++y) {
+                copy.insert(copy.end(), picture_.cb + y * picture_.cb_stride,
+                            picture_.cb + y * picture_.cb_stride + width_ / 2);
+                copy.insert(copy.end(), picture_.cr + y * picture_.cr_stride,
+                            picture_.cr + y * picture_.cr_stride + width_ / 2);
+            }
+            pictures.push_back(copy);
+        }
+        return true;
+    }
+
+    std::vector<std::vector<uint8_t>> pictures;
+
+  private:
+    uint32_t width_;
+    uint32_t height_;
+    EbComponentType *handle_;
+    EbSvtAv1DecConfiguration config_;
+    std::vector<uint8_t> data_;
+    EbSvtIOFormat picture_;
+    EbBufferHeaderType header_;
+    EbAV1StreamInfo stream_info_;
+    EbAV1FrameInfo frame_info_;
+};
+
+/** @brief parallel_frames_output_queue is a api test case
+ * DecApiTest.parallel_frames_output_queue checks the output queue of the
+ * parse / reconstruction pipeline applies backpressure instead of dropping
+ * pictures
+ *
+ * Test strategy: <br>
+ * Decode a stream with num_p_frames 1, then with num_p_frames 4 without
+ * getting any picture until svt_av1_dec_frame() refuses the data, getting
+ * one picture and sending the same data again.
+ *
+ * Expected result: <br>
+ * svt_av1_dec_frame() returns EB_DecOutputQueueFull, and the pictures of
+ * the pipelined decode are the ones of the serial decode.
+ *
+ * Test coverage:
+ * svt_av1_dec_frame, svt_av1_dec_get_picture with num_p_frames > 1.
+ */
+TEST(DecApiTest, parallel_frames_output_queue) {
+    const uint32_t width = 192;
+    const uint32_t height = 128;
+    const uint32_t frame_count = 24;
+    TemporalUnits units;
+    encode_stream(width, height, frame_count, &units);
+    ASSERT_EQ(frame_count, units.size());
+
+    TestDecoder serial(width, height);
+    ASSERT_EQ(EB_ErrorNone, serial.open(1, 1));
+    for (size_t i = 0; i < units.size(); ++i) {
+        ASSERT_EQ(EB_ErrorNone, serial.decode(units[i]));
+        serial.get_picture(true);
+    }
+    serial.close();
+    ASSERT_EQ(frame_count, serial.pictures.size());
+
+    TestDecoder pipelined(width, height);
+    ASSERT_EQ(EB_ErrorNone, pipelined.open(1, 4));
+    uint32_t queue_full_count = 0;
+    for (size_t i = 0; i < units.size(); ++i) {
+        EbErrorType status = pipelined.decode(units[i]);
+        while (status == EB_DecOutputQueueFull) {
+            queue_full_count++;
+            ASSERT_TRUE(pipelined.get_picture(true));
+            status = pipelined.decode(units[i]);
+        }
+        ASSERT_EQ(EB_ErrorNone, status);
+    }
+    ASSERT_EQ(EB_ErrorNone, pipelined.flush());
+    while (pipelined.get_picture(true))
+        ;
+    pipelined.close();
+
+    EXPECT_LT(0u, queue_full_count);
+    ASSERT_EQ(serial.pictures.size(), pipelined.pictures.size());
+    for (size_t i = 0; i < serial.pictures.size(); ++i)
+        EXPECT_TRUE(serial.pictures[i] == pipelined.pictures[i])
+            << "picture " << i << " differs";
+}
+
+/** @brief parse_only is a api test case
+ * DecApiTest.parse_only checks the parse only mode releases the pictures of
+ * the frames it parses
+ *
+ * Test strategy: <br>
+ * Decode a stream of more than twice as many frames as the decoder has
+ * picture buffers with parse_only, asking for 4 threads and 4 parallel frames, then
+ * decode it again with the same decoder after an end of stream.
+ *
+ * Expected result: <br>
+ * Every frame is parsed without error, which needs the pictures of the
+ * replaced references and of the frames which are not references to be
+ * released, and no picture is output.
+ *
+ * Test coverage:
+ * svt_av1_dec_frame, svt_av1_dec_get_picture with parse_only.
+ */
+TEST(DecApiTest, parse_only) {
+    const uint32_t width = 192;
+    const uint32_t height = 128;
+    const uint32_t frame_count = 72;
+    TemporalUnits units;
+    encode_stream(width, height, frame_count, &units);
+    ASSERT_EQ(frame_count, units.size());
+
+    TestDecoder decoder(width, height);
+    ASSERT_EQ(EB_ErrorNone, decoder.open(4, 4, EB_TRUE));
+    for (int pass = 0; pass < 2; ++pass) {
+        for (size_t i = 0; i < units.size(); ++i) {
+            ASSERT_EQ(EB_ErrorNone, decoder.decode(units[i]))
+                << "pass " << pass << " frame " << i;
+            EXPECT_FALSE(decoder.get_picture(true));
+        }
+        ASSERT_EQ(EB_ErrorNone, decoder.flush());
+        EXPECT_FALSE(decoder.get_picture(true));
+    }
+    decoder.close();
+    EXPECT_TRUE(decoder.pictures.empty());
+}
+
+/** @brief throughput is a decoder benchmark
+ * DecApiTest.throughput prints the decoding speed of a single tile stream
+ * against the number of threads, with the tile / SB row threads and with
+ * the parse / reconstruction pipeline.
+ *
+ * Comments:
+ * Disabled as it is a benchmark, run it with
+ * --gtest_also_run_disabled_tests on an otherwise idle machine.
+ */
+TEST(DecApiTest, DISABLED_throughput) {
+    const uint32_t width = 1280;
+    const uint32_t height = 720;
+    const uint32_t frame_count = 60;
+    const int repeat = 3;
+    TemporalUnits units;
+    encode_stream(width, height, frame_count, &units);
+    ASSERT_EQ(frame_count, units.size());
+
+    const struct {
+        uint32_t threads;
+        uint32_t num_p_frames;
+    } setups[] = {{1, 1}, {2, 1}, {4, 1}, {8, 1}, {1, 2}, {1, 4}, {1, 8}};
+
+    printf("%dx%d, %u frames, 1 tile\n", width, height, frame_count);
+    printf("threads  parallel-frames      fps\n");
+    for (size_t s = 0; s < sizeof(setups) / sizeof(setups[0]); ++s) {
+        double best_fps = 0;
+        for (int r = 0; r < repeat; ++r) {
+            TestDecoder decoder(width, height);
+            ASSERT_EQ(EB_ErrorNone,
+                      decoder.open(setups[s].threads, setups[s].num_p_frames));
+            uint32_t out_count = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < units.size(); ++i) {
+                EbErrorType status = decoder.decode(units[i]);
+                while (status == EB_DecOutputQueueFull && decoder.get_picture(false)) {
+                    out_count++;
+                    status = decoder.decode(units[i]);
+                }
+                ASSERT_EQ(EB_ErrorNone, status);
+                if (decoder.get_picture(false))
+                    out_count++;
+            }
+            // Without the pipeline every picture is out already, and
+            // svt_av1_dec_get_picture() keeps returning the last one
+            if (setups[s].num_p_frames > 1) {
+                decoder.flush();
+                while (decoder.get_picture(false))
+                    out_count++;
+            }
+            std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+            decoder.close();
+            ASSERT_EQ(frame_count, out_count);
+            best_fps = std::max(best_fps, frame_count / elapsed.count());
+        }
+        printf("%7u  %15u  %7.2f\n", setups[s].threads, setups[s].num_p_frames,
+               best_fps);
+    }
+}
+
+}  // namespace
@@ -17,9 +17,14 @@
  * @author Cidana-Edmond, Cidana-Ryan, Cidana-Wenyao
  *
  ******************************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <vector>
 #include "EbSvtAv1Enc.h"
 #include "gtest/gtest.h"
 #include "SvtAv1EncApiTest.h"
+#include "SvtAv1ApiTestUtil.h"
 
 using namespace svt_av1_test;
 
@@ -106,6 +111,60 @@ TEST(EncApiTest, check_null_pointer) {
     SUCCEED();
 }
 
+/** @brief check_shared_context is a api test case
+ * EncApiTest.check_shared_context is a api test case for creating a shared
+ * encoder context and attaching handles to it
+ *
+ * Test strategy: <br>
+ * Create a context, set it in the parameters of two handles, the source and
+ * a rendition of a ladder analysis, and destroy it once the handles are
+ * deconstructed.
+ *
+ * Expected result: <br>
+ * Encoder API should not crash and report EB_ErrorNone, and
+ * EB_ErrorBadParameter for null pointers.
+ *
+ * Test coverage:
+ * svt_av1_enc_context_create, svt_av1_enc_context_destroy.
+ */
+TEST(EncApiTest, check_shared_context) {
+    SvtAv1EncContextConfig context_config;
+    context_config.worker_count = 2;
+    context_config.use_cpu_flags = CPU_FLAGS_ALL;
+    SvtAv1EncContext *shared_context = nullptr;
+
+    EXPECT_EQ(EB_ErrorBadParameter,
+              svt_av1_enc_context_create(nullptr, &context_config));
+    EXPECT_EQ(EB_ErrorBadParameter,
+              svt_av1_enc_context_create(&shared_context, nullptr));
+    EXPECT_EQ(EB_ErrorBadParameter, svt_av1_enc_context_destroy(nullptr));
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_context_create(&shared_context, &context_config));
+    ASSERT_NE(nullptr, shared_context);
+
+    SvtAv1Context context[2];
+    for (int i = 0; i < 2; ++i) {
+        memset(&context[i], 0, sizeof(context[i]));
+        ASSERT_EQ(EB_ErrorNone,
+                  svt_av1_enc_init_handle(
+                      &context[i].enc_handle, &context[i], &context[i].enc_params))
+            << "svt_av1_enc_init_handle failed";
+        EXPECT_EQ(nullptr, context[i].enc_params.shared_context);
+        context[i].enc_params.source_width = 640;
+        context[i].enc_params.source_height = 480;
+        context[i].enc_params.shared_context = shared_context;
+        context[i].enc_params.ladder_analysis = i + 1;
+        EXPECT_EQ(EB_ErrorNone,
+                  svt_av1_enc_set_parameter(context[i].enc_handle,
+                                            &context[i].enc_params))
+            << "svt_av1_enc_set_parameter failed";
+    }
+    for (int i = 0; i < 2; ++i)
+        EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit_handle(context[i].enc_handle))
+            << "svt_av1_enc_deinit_handle failed";
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_context_destroy(shared_context));
+}
+
 /** @brief check_normal_setup is a api test case
  * EncApiTest.check_normal_setup is a api test case with a normal setup
  * parameters into api functions and expect report for return EB_ErrorNone
@@ -201,4 +260,207 @@ TEST(EncApiTest, DISABLED_repeat_normal_setup) {
     }
 }
 
+/** Planes of one picture with the zero-copy input layout */
+class ZeroCopyPicture {
+  public:
+    ZeroCopyPicture(const SvtAv1InputLayout &layout)
+        : luma_buffer_(layout.luma_size + layout.alignment),
+          cb_buffer_(layout.chroma_size + layout.alignment),
+          cr_buffer_(layout.chroma_size + layout.alignment) {
+        memset(&io_, 0, sizeof(io_));
+        io_.luma = align(luma_buffer_, layout.alignment) + layout.luma_offset;
+        io_.cb = align(cb_buffer_, layout.alignment) + layout.chroma_offset;
+        io_.cr = align(cr_buffer_, layout.alignment) + layout.chroma_offset;
+        io_.y_stride = layout.y_stride;
+        io_.cb_stride = layout.chroma_stride;
+        io_.cr_stride = layout.chroma_stride;
+    }
+
+    EbSvtIOFormat *io() {
+        return &io_;
+    }
+
+    /* Copy of the width x height picture */
+    std::vector<uint8_t> picture(uint32_t width, uint32_t height) const {
+        std::vector<uint8_t> copy;
+        for (uint32_t y = 0; y < height; ++y)
+            copy.insert(copy.end(), io_.luma + y * io_.y_stride,
+                        io_.luma + y * io_.y_stride + width);
+        for (uint32_t y = 0; y < height / 2; ++y) {
+            copy.insert(copy.end(), io_.cb + y * io_.cb_stride,
+                        io_.cb + y * io_.cb_stride + width / 2);
+            copy.insert(copy.end(), io_.cr + y * io_.cr_stride,
+                        io_.cr + y * io_.cr_stride + width / 2);
+        }
+        return copy;
+    }
+
+  private:
+    static uint8_t *align(std::vector<uint8_t> &buffer, uint32_t alignment) {
+        uintptr_t address = (uintptr_t)buffer.data();
+        return buffer.data() + (alignment - address % alignment) % alignment;
+    }
+
+    std::vector<uint8_t> luma_buffer_;
+    std::vector<uint8_t> cb_buffer_;
+    std::vector<uint8_t> cr_buffer_;
+    EbSvtIOFormat io_;
+};
+
+static const uint32_t zero_copy_frame_count = 12;
+
+static void count_release(void *cb_data, void *p_app_private) {
+    std::atomic<uint32_t> *release_count = (std::atomic<uint32_t> *)cb_data;
+    const uintptr_t frame = (uintptr_t)p_app_private;
+    if (frame < zero_copy_frame_count)
+        release_count[frame]++;
+}
+
+/** @brief zero_copy_input is a api test case
+ * EncApiTest.zero_copy_input encodes pictures sent in zero-copy mode
+ *
+ * Test strategy: <br>
+ * Send pictures allocated with the layout of
+ * SVT_AV1_STREAM_INFO_INPUT_LAYOUT, with temporal filtering and film grain
+ * denoising off, and count the calls of input_release_cb for each picture.
+ *
+ * Expected result: <br>
+ * input_release_cb is called once for each picture by the end of the
+ * stream, and the pictures, padding excluded, are unchanged.
+ *
+ * Test coverage:
+ * zero_copy_input, input_release_cb, SVT_AV1_STREAM_INFO_INPUT_LAYOUT.
+ */
+TEST(EncApiTest, zero_copy_input) {
+    const uint32_t width = 192;
+    const uint32_t height = 128;
+    std::atomic<uint32_t> release_count[zero_copy_frame_count];
+    for (uint32_t i = 0; i < zero_copy_frame_count; ++i)
+        release_count[i] = 0;
+
+    SvtAv1Context context;
+    memset(&context, 0, sizeof(context));
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_init_handle(
+                  &context.enc_handle, &context, &context.enc_params));
+    context.enc_params.source_width = width;
+    context.enc_params.source_height = height;
+    context.enc_params.enc_mode = 8;
+    context.enc_params.tf_level = 0;
+    context.enc_params.zero_copy_input = 1;
+    context.enc_params.input_release_cb = count_release;
+    context.enc_params.input_release_cb_data = release_count;
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_set_parameter(context.enc_handle, &context.enc_params));
+    ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init(context.enc_handle));
+
+    SvtAv1InputLayout layout;
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_get_stream_info(context.enc_handle,
+                                          SVT_AV1_STREAM_INFO_INPUT_LAYOUT,
+                                          &layout));
+    std::vector<ZeroCopyPicture *> pictures;
+    std::vector<std::vector<uint8_t>> sent;
+    uint32_t packet_count = 0;
+    PacketHandler count_packets = [&](const EbBufferHeaderType *) {
+        packet_count++;
+    };
+    for (uint32_t frame = 0; frame < zero_copy_frame_count; ++frame) {
+        ZeroCopyPicture *picture = new ZeroCopyPicture(layout);
+        pictures.push_back(picture);
+        EbSvtIOFormat *io = picture->io();
+        fill_test_picture(io->luma, io->cb, io->cr, width, height,
+                          io->y_stride, io->cb_stride, frame);
+        sent.push_back(picture->picture(width, height));
+
+        EbBufferHeaderType header;
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(header);
+        header.p_buffer = (uint8_t *)io;
+        header.n_filled_len = (uint32_t)(width * height * 3 / 2);
+        header.n_alloc_len = header.n_filled_len;
+        header.pts = frame;
+        header.pic_type = EB_AV1_INVALID_PICTURE;
+        header.p_app_private = (void *)(uintptr_t)frame;
+        ASSERT_EQ(EB_ErrorNone,
+                  svt_av1_enc_send_picture(context.enc_handle, &header));
+        ASSERT_EQ(EB_NoErrorEmptyQueue,
+                  receive_packets(context.enc_handle, 0, count_packets));
+    }
+    EXPECT_EQ(EB_ErrorNone, finish_encode(context.enc_handle, count_packets));
+    EXPECT_LE(zero_copy_frame_count, packet_count);
+
+    for (uint32_t frame = 0; frame < zero_copy_frame_count; ++frame) {
+        EXPECT_EQ(1u, release_count[frame].load())
+            << "picture " << frame << " released " << release_count[frame]
+            << " times";
+        EXPECT_TRUE(sent[frame] == pictures[frame]->picture(width, height))
+            << "picture " << frame << " changed";
+    }
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit(context.enc_handle));
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit_handle(context.enc_handle));
+    for (uint32_t frame = 0; frame < zero_copy_frame_count; ++frame) {
+        EXPECT_EQ(1u, release_count[frame].load());
+        delete pictures[frame];
+    }
+}
+
+/** @brief low_latency_stat_report is a api test case
+ * EncApiTest.low_latency_stat_report checks the metrics of the stat report
+ * in low latency mode
+ *
+ * Test strategy: <br>
+ * Encode pictures of 2x2 tiles with low_latency_mode and stat_report.
+ *
+ * Expected result: <br>
+ * The packets flagged EB_BUFFERFLAG_PARTIAL, which do not wait for the
+ * metrics of their picture, carry no metrics, and the last packet of each
+ * picture carries its SSIM.
+ *
+ * Test coverage:
+ * low_latency_mode, stat_report.
+ */
+TEST(EncApiTest, low_latency_stat_report) {
+    const uint32_t width = 192;
+    const uint32_t height = 128;
+    const uint32_t frame_count = 8;
+
+    SvtAv1Context context;
+    memset(&context, 0, sizeof(context));
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_init_handle(
+                  &context.enc_handle, &context, &context.enc_params));
+    context.enc_params.source_width = width;
+    context.enc_params.source_height = height;
+    context.enc_params.enc_mode = 8;
+    context.enc_params.low_latency_mode = 1;
+    context.enc_params.tile_rows = 1;
+    context.enc_params.tile_columns = 1;
+    context.enc_params.stat_report = 1;
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_set_parameter(context.enc_handle, &context.enc_params));
+    ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init(context.enc_handle));
+
+    uint32_t partial_count = 0;
+    uint32_t picture_count = 0;
+    PacketHandler check_metrics = [&](const EbBufferHeaderType *packet) {
+        if (packet->flags & EB_BUFFERFLAG_PARTIAL) {
+            partial_count++;
+            EXPECT_EQ(0u, packet->luma_sse);
+            EXPECT_EQ(0.0, packet->luma_ssim);
+        } else {
+            picture_count++;
+            EXPECT_LT(0.0, packet->luma_ssim);
+            EXPECT_LT(0.0, packet->cb_ssim);
+        }
+    };
+    EXPECT_EQ(EB_ErrorNone,
+              encode_test_pictures(
+                  context.enc_handle, width, height, frame_count, check_metrics));
+    EXPECT_EQ(frame_count, picture_count);
+    EXPECT_LT(0u, partial_count);
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit(context.enc_handle));
+    EXPECT_EQ(EB_ErrorNone, svt_av1_enc_deinit_handle(context.enc_handle));
+}
+
 }  // namespace
@@ -233,6 +233,10 @@ PARAM_TEST(EncParamHierarchicalLvlTest);
 DEFINE_PARAM_TEST_CLASS(EncParamPredStructTest, pred_structure);
 PARAM_TEST(EncParamPredStructTest);
 
+/** Test case for low_latency_mode*/
+DEFINE_PARAM_TEST_CLASS(EncParamLowLatencyTest, low_latency_mode);
+PARAM_TEST(EncParamLowLatencyTest);
+
 /** Test case for source_width*/
 DEFINE_PARAM_TEST_CLASS(EncParamSrcWidthTest, source_width);
 PARAM_TEST(EncParamSrcWidthTest);
@@ -253,6 +257,10 @@ PARAM_TEST(EncParamEncBitDepthTest);
 DEFINE_PARAM_TEST_CLASS(EncParamCompr10BitFmtTest, compressed_ten_bit_format);
 PARAM_TEST(EncParamCompr10BitFmtTest);
 
+/** Test case for zero_copy_input*/
+DEFINE_PARAM_TEST_CLASS(EncParamZeroCopyInputTest, zero_copy_input);
+PARAM_TEST(EncParamZeroCopyInputTest);
+
 /** Test case for sb_sz*/
 DEFINE_PARAM_TEST_CLASS(EncParamSbSizeTest, sb_sz);
 PARAM_TEST(EncParamSbSizeTest);
@@ -395,10 +403,38 @@ PARAM_TEST(EncParamLogicalProcessorsTest);
 DEFINE_PARAM_TEST_CLASS(EncParamTargetSocketTest, target_socket);
 PARAM_TEST(EncParamTargetSocketTest);
 
+/** Test case for enable_worker_pool*/
+DEFINE_PARAM_TEST_CLASS(EncParamWorkerPoolTest, enable_worker_pool);
+PARAM_TEST(EncParamWorkerPoolTest);
+
+/** Test case for numa_policy*/
+DEFINE_PARAM_TEST_CLASS(EncParamNumaPolicyTest, numa_policy);
+PARAM_TEST(EncParamNumaPolicyTest);
+
+/** Test case for numa_node*/
+DEFINE_PARAM_TEST_CLASS(EncParamNumaNodeTest, numa_node);
+PARAM_TEST(EncParamNumaNodeTest);
+
+/** Test case for max_memory_mb*/
+DEFINE_PARAM_TEST_CLASS(EncParamMaxMemoryTest, max_memory_mb);
+PARAM_TEST(EncParamMaxMemoryTest);
+
 /** Test case for recon_enabled*/
 DEFINE_PARAM_TEST_CLASS(EncParamReconEnabledTest, recon_enabled);
 PARAM_TEST(EncParamReconEnabledTest);
 
+/** Test case for frame_stats*/
+DEFINE_PARAM_TEST_CLASS(EncParamFrameStatsTest, frame_stats);
+PARAM_TEST(EncParamFrameStatsTest);
+
+/** Test case for pipeline_profile*/
+DEFINE_PARAM_TEST_CLASS(EncParamPipelineProfileTest, pipeline_profile);
+PARAM_TEST(EncParamPipelineProfileTest);
+
+/** Test case for ladder_analysis*/
+DEFINE_PARAM_TEST_CLASS(EncParamLadderAnalysisTest, ladder_analysis);
+PARAM_TEST(EncParamLadderAnalysisTest);
+
 #if TILES
 /** Test case for tile_columns*/
 DEFINE_PARAM_TEST_CLASS(EncParamTileColsTest, tile_columns);
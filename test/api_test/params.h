@@ -167,6 +167,21 @@ static const vector<uint8_t> invalid_pred_structure = {
     /* _pred_structure override in code
     EB_PRED_TOTAL_COUNT, EB_PRED_TOTAL_COUNT + 1, EB_PRED_INVALID*/};
 
+/* Code the pictures in input order and output each tile as soon as it is
+ * coded.
+ *
+ * Default is 0. */
+static const vector<EbBool> default_low_latency_mode = {
+    EB_FALSE,
+};
+static const vector<EbBool> valid_low_latency_mode = {
+    EB_FALSE,
+    EB_TRUE,
+};
+static const vector<EbBool> invalid_low_latency_mode = {
+    2,
+};
+
 
 // Input Info
 /* The width of input source in units of picture luma pixels.
@@ -313,6 +328,21 @@ static const vector<uint32_t> invalid_compressed_ten_bit_format = {
     2, 10,  // ...
 };
 
+/* Reference the caller planes instead of copying them.
+ *
+ * Default is 0. */
+static const vector<EbBool> default_zero_copy_input = {
+    EB_FALSE,
+};
+static const vector<EbBool> valid_zero_copy_input = {
+    EB_FALSE,
+    // EB_TRUE, requires an input_release_cb
+};
+static const vector<EbBool> invalid_zero_copy_input = {
+    2,
+    EB_TRUE,  // without input_release_cb
+};
+
 /* Number of frames of sequence to be encoded. If number of frames is greater
  * than the number of frames in file, the encoder will loop to the beginning
  * and continue the encode.
@@ -986,6 +1016,70 @@ static const vector<int32_t> invalid_target_socket = {
     2,
 };
 
+/* Run the processing threads on a pool of one worker per logical processor.
+ *
+ * Default is 0. */
+static const vector<EbBool> default_enable_worker_pool = {
+    EB_FALSE,
+};
+static const vector<EbBool> valid_enable_worker_pool = {
+    EB_FALSE,
+    EB_TRUE,
+};
+static const vector<EbBool> invalid_enable_worker_pool = {
+    2,
+};
+
+/* NUMA placement of the encoder threads and memory.
+ *
+ * Default is 0. */
+static const vector<uint32_t> default_numa_policy = {
+    0,
+};
+static const vector<uint32_t> valid_numa_policy = {
+    0,
+    1,
+    2,
+};
+static const vector<uint32_t> invalid_numa_policy = {
+    3,
+};
+
+/* NUMA node the encoder runs on when numa_policy is 1.
+ *
+ * Default is -1. */
+static const vector<int32_t> default_numa_node = {
+    -1,
+};
+static const vector<int32_t> valid_numa_node = {
+    -1,
+    0,
+};
+static const vector<int32_t> invalid_numa_node = {
+    -2,
+    4096,
+};
+
+// Memory management
+
+/* Memory budget in MB for the picture buffer pools of the encoder.
+ *
+ * Default is 0. */
+static const vector<uint32_t> default_max_memory_mb = {
+    0,
+};
+static const vector<uint32_t> valid_max_memory_mb = {
+    0,
+    1,
+    64,
+    512,
+    4096,
+    0xFFFFFFFF,
+};
+static const vector<uint32_t> invalid_max_memory_mb = {
+    /** none */
+};
+
 // Debug tools
 
 /* Output reconstructed yuv used for debug purposes. The value is set through
@@ -996,6 +1090,30 @@ static const vector<uint32_t> default_recon_enabled = {EB_FALSE};
 static const vector<uint32_t> valid_recon_enabled = {EB_FALSE, EB_TRUE};
 static const vector<uint32_t> invalid_recon_enabled = {/** none */};
 
+/* Per-frame statistics attached to the output buffers, 0: OFF, 1: per frame,
+ * 2: per frame and per superblock.
+ *
+ * Default is 0. */
+static const vector<uint8_t> default_frame_stats = {0};
+static const vector<uint8_t> valid_frame_stats = {0, 1, 2};
+static const vector<uint8_t> invalid_frame_stats = {3};
+
+/* Pipeline profile, 0: OFF, 1: counters, 2: counters and trace.
+ *
+ * Default is 0. */
+static const vector<uint8_t> default_pipeline_profile = {0};
+static const vector<uint8_t> valid_pipeline_profile = {0, 1, 2};
+static const vector<uint8_t> invalid_pipeline_profile = {3};
+
+/* Ladder analysis, 0: OFF, 1: source, 2: rendition. The source and the
+ * renditions must be attached to a shared_context, which the parameter tests
+ * do not set.
+ *
+ * Default is 0. */
+static const vector<uint8_t> default_ladder_analysis = {0};
+static const vector<uint8_t> valid_ladder_analysis = {0};
+static const vector<uint8_t> invalid_ladder_analysis = {1, 2, 3};
+
 #if TILES
 /* Log 2 Tile Rows and colums . 0 means no tiling,1 means that we split the
  * dimension into 2 Default is 0. */
@@ -0,0 +1,530 @@
+/*
+* Copyright(c) 2020 Intel Corporation
+*
+* This source code is subject to the terms of the BSD 2 Clause License and
+* the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+* was not distributed with this source code in the LICENSE file, you can
+* obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+* Media Patent License 1.0 was not distributed with this source code in the
+* PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+*/
+
+/******************************************************************************
+ * @file convolve_2d_scale_test.cc
+ *
+ * @brief Unit test for interpolation from scaled references:
+ * - svt_av1_convolve_2d_scale_{avx2, avx512}
+ * - svt_av1_highbd_convolve_2d_scale_{avx2, avx512}
+ *
+ ******************************************************************************/
+#include <stdlib.h>
+#include "gtest/gtest.h"
+#include "aom_dsp_rtcd.h"
+#include "EbDefinitions.h"
+#include "random.h"
+#include "util.h"
+#include "EbTime.h"
+#include "EbUtility.h"
+#include "convolve.h"
+#include "filter.h"
+
+// the reference may be twice the size of the block, plus the filter taps
+const int kMaxScaleSize = 2 * MAX_SB_SIZE + 32;
+using svt_av1_test_tool::SVTRandom;
+namespace {
+using highbd_convolve_scale_func = void (*)(
+    const uint16_t *src, int src_stride, uint16_t *dst, int dst_stride, int w,
+    int h, const InterpFilterParams *filter_params_x,
+    const InterpFilterParams *filter_params_y, const int subpel_x_qn,
+    const int x_step_qn, const int subpel_y_qn, const int y_step_qn,
+    ConvolveParams *conv_params, int bd);
+
+using lowbd_convolve_scale_func = void (*)(
+    const uint8_t *src, int src_stride, uint8_t *dst, int dst_stride, int w,
+    int h, const InterpFilterParams *filter_params_x,
+    const InterpFilterParams *filter_params_y, const int subpel_x_qn,
+    const int x_step_qn, const int subpel_y_qn, const int y_step_qn,
+    ConvolveParams *conv_params);
+
+/**
+ * @brief Unit test for interpolation from scaled references:
+ * - svt_av1_{highbd_, }convolve_2d_scale_{avx2, avx512}
+ *
+ * Test strategy:
+ * Verify this assembly code by comparing with reference c implementation.
+ * Feed the same data and check test output and reference output.
+ *
+ * Expect result:
+ * Output from assemble functions should be the same with output from c.
+ *
+ * Test coverage:
+ * Test cases:
+ * input value: Fill with random values
+ * modes: single reference, compound, compound average and distance
+ * weighted compound average
+ * filters: all the filters, the 4-tap ones on the narrow blocks
+ * scale: 1:1, 1.25:1, 1.5:1, 2:1 and an odd step
+ * subpel position: random start positions
+ * BlockSize: all the BlockSize, and their chroma halves
+ * BitDepth: 8bit, 10bit, 12bit
+ *
+ */
+typedef ::testing::tuple<int, int, BlockSize> Convolve2DScaleParam;
+
+template <typename Sample, typename FuncType>
+class AV1Convolve2DScaleTest
+    : public ::testing::TestWithParam<Convolve2DScaleParam> {
+  public:
+    AV1Convolve2DScaleTest()
+        : bd_(TEST_GET_PARAM(0)),
+          x_step_qn_(TEST_GET_PARAM(1)),
+          block_idx_(TEST_GET_PARAM(2)) {
+    }
+
+    virtual ~AV1Convolve2DScaleTest() {
+    }
+
+    void SetUp() override {
+        input_ = reinterpret_cast<Sample *>(svt_aom_memalign(
+            32, kMaxScaleSize * kMaxScaleSize * sizeof(Sample)));
+        conv_buf_init_ = reinterpret_cast<ConvBufType *>(
+            svt_aom_memalign(32, MAX_SB_SQUARE * sizeof(ConvBufType)));
+        conv_buf_ref_ = reinterpret_cast<ConvBufType *>(
+            svt_aom_memalign(32, MAX_SB_SQUARE * sizeof(ConvBufType)));
+        conv_buf_tst_ = reinterpret_cast<ConvBufType *>(
+            svt_aom_memalign(32, MAX_SB_SQUARE * sizeof(ConvBufType)));
+        output_init_ = reinterpret_cast<Sample *>(
+            svt_aom_memalign(32, MAX_SB_SQUARE * sizeof(Sample)));
+        output_ref_ = reinterpret_cast<Sample *>(
+            svt_aom_memalign(32, MAX_SB_SQUARE * sizeof(Sample)));
+        output_tst_ = reinterpret_cast<Sample *>(
+            svt_aom_memalign(32, MAX_SB_SQUARE * sizeof(Sample)));
+        setup_common_rtcd_internal(get_cpu_flags_to_use());
+    }
+
+    void TearDown() override {
+        svt_aom_free(input_);
+        svt_aom_free(conv_buf_init_);
+        svt_aom_free(conv_buf_ref_);
+        svt_aom_free(conv_buf_tst_);
+        svt_aom_free(output_init_);
+        svt_aom_free(output_ref_);
+        svt_aom_free(output_tst_);
+        aom_clear_system_state();
+    }
+
+    virtual void run_convolve(FuncType func, const Sample *src, int src_stride,
+                              Sample *dst, int w, int h,
+                              const InterpFilterParams *filter_params_x,
+                              const InterpFilterParams *filter_params_y,
+                              int subpel_x_qn, int x_step_qn, int subpel_y_qn,
+                              int y_step_qn, ConvolveParams *conv_params) = 0;
+
+    void prepare_data() {
+        SVTRandom rnd_(bd_, false);
+        SVTRandom rnd12_(12, false);
+
+        for (int i = 0; i < kMaxScaleSize * kMaxScaleSize; ++i)
+            input_[i] = (Sample)rnd_.random();
+
+        for (int i = 0; i < MAX_SB_SQUARE; ++i) {
+            conv_buf_init_[i] = rnd12_.random();
+            output_init_[i] = (Sample)rnd_.random();
+        }
+    }
+
+    void reset_output() {
+        memcpy(conv_buf_ref_,
+               conv_buf_init_,
+               MAX_SB_SQUARE * sizeof(*conv_buf_init_));
+        memcpy(conv_buf_tst_,
+               conv_buf_init_,
+               MAX_SB_SQUARE * sizeof(*conv_buf_init_));
+        memcpy(
+            output_ref_, output_init_, MAX_SB_SQUARE * sizeof(*output_init_));
+        memcpy(
+            output_tst_, output_init_, MAX_SB_SQUARE * sizeof(*output_init_));
+    }
+
+    void test_convolve(int w, int h, const InterpFilterParams *filter_params_x,
+                       const InterpFilterParams *filter_params_y,
+                       ConvolveParams *conv_params_ref,
+                       ConvolveParams *conv_params_tst) {
+        SVTRandom rnd_subpel(0, SCALE_SUBPEL_SHIFTS - 1);
+        // the offset of the block in the reference keeps the filter taps
+        // inside the input
+        const Sample *src = input_ + 3 * kMaxScaleSize + 3;
+        const int y_step_qn = x_step_qn_;
+
+        for (int i = 0; i < 8; ++i) {
+            const int subpel_x_qn = i ? rnd_subpel.random() : 0;
+            const int subpel_y_qn = i ? rnd_subpel.random() : 0;
+
+            reset_output();
+            run_convolve(func_ref_,
+                         src,
+                         kMaxScaleSize,
+                         output_ref_,
+                         w,
+                         h,
+                         filter_params_x,
+                         filter_params_y,
+                         subpel_x_qn,
+                         x_step_qn_,
+                         subpel_y_qn,
+                         y_step_qn,
+                         conv_params_ref);
+            run_convolve(func_tst_,
+                         src,
+                         kMaxScaleSize,
+                         output_tst_,
+                         w,
+                         h,
+                         filter_params_x,
+                         filter_params_y,
+                         subpel_x_qn,
+                         x_step_qn_,
+                         subpel_y_qn,
+                         y_step_qn,
+                         conv_params_tst);
+
+            if (memcmp(output_ref_,
+                       output_tst_,
+                       MAX_SB_SQUARE * sizeof(output_ref_[0])) ||
+                memcmp(conv_buf_ref_,
+                       conv_buf_tst_,
+                       MAX_SB_SQUARE * sizeof(conv_buf_ref_[0]))) {
+                for (int j = 0; j < MAX_SB_SQUARE; ++j) {
+                    ASSERT_EQ(output_ref_[j], output_tst_[j])
+                        << w << "x" << h << " Pixel mismatch at ("
+                        << j % MAX_SB_SIZE << ", " << j / MAX_SB_SIZE
+                        << "), subpel = (" << subpel_x_qn << ", "
+                        << subpel_y_qn << "), step = " << x_step_qn_
+                        << " do_average: " << conv_params_tst->do_average
+                        << " use_dist_wtd_comp_avg: "
+                        << conv_params_tst->use_dist_wtd_comp_avg;
+                    ASSERT_EQ(conv_buf_ref_[j], conv_buf_tst_[j])
+                        << w << "x" << h << " Compound mismatch at ("
+                        << j % MAX_SB_SIZE << ", " << j / MAX_SB_SIZE
+                        << "), subpel = (" << subpel_x_qn << ", "
+                        << subpel_y_qn << "), step = " << x_step_qn_
+                        << " do_average: " << conv_params_tst->do_average
+                        << " use_dist_wtd_comp_avg: "
+                        << conv_params_tst->use_dist_wtd_comp_avg;
+                }
+            }
+        }
+    }
+
+    void run_test() {
+        const int quant_dist_lookup_table[2][4][2] = {
+            {{9, 7}, {11, 5}, {12, 4}, {13, 3}},
+            {{7, 9}, {5, 11}, {4, 12}, {3, 13}},
+        };
+
+        prepare_data();
+
+        for (int plane = 0; plane < 2; ++plane) {
+            const int w = block_size_wide[block_idx_] >> plane;
+            const int h = block_size_high[block_idx_] >> plane;
+            for (int hfilter = EIGHTTAP_REGULAR; hfilter < INTERP_FILTERS_ALL;
+                 ++hfilter) {
+                for (int vfilter = EIGHTTAP_REGULAR;
+                     vfilter < INTERP_FILTERS_ALL;
+                     ++vfilter) {
+                    const InterpFilterParams filter_params_x =
+                        av1_get_interp_filter_params_with_block_size(
+                            (InterpFilter)hfilter, w);
+                    const InterpFilterParams filter_params_y =
+                        av1_get_interp_filter_params_with_block_size(
+                            (InterpFilter)vfilter, h);
+
+                    // single reference, then compound without and with the
+                    // average
+                    for (int mode = 0; mode < 3; ++mode) {
+                        const int is_compound = mode > 0;
+                        const int do_average = mode > 1;
+                        ConvolveParams conv_params_ref =
+                            get_conv_params_no_round(0,
+                                                     do_average,
+                                                     0,
+                                                     conv_buf_ref_,
+                                                     MAX_SB_SIZE,
+                                                     is_compound,
+                                                     bd_);
+                        ConvolveParams conv_params_tst =
+                            get_conv_params_no_round(0,
+                                                     do_average,
+                                                     0,
+                                                     conv_buf_tst_,
+                                                     MAX_SB_SIZE,
+                                                     is_compound,
+                                                     bd_);
+                        conv_params_ref.use_dist_wtd_comp_avg = 0;
+                        conv_params_tst.use_dist_wtd_comp_avg = 0;
+
+                        test_convolve(w,
+                                      h,
+                                      &filter_params_x,
+                                      &filter_params_y,
+                                      &conv_params_ref,
+                                      &conv_params_tst);
+
+                        if (!do_average)
+                            continue;
+
+                        // Test different combination of fwd and bck offset
+                        // weights
+                        for (int k = 0; k < 2; ++k) {
+                            for (int l = 0; l < 4; ++l) {
+                                conv_params_ref.use_dist_wtd_comp_avg = 1;
+                                conv_params_tst.use_dist_wtd_comp_avg = 1;
+                                conv_params_ref.fwd_offset =
+                                    quant_dist_lookup_table[k][l][0];
+                                conv_params_ref.bck_offset =
+                                    quant_dist_lookup_table[k][l][1];
+                                conv_params_tst.fwd_offset =
+                                    quant_dist_lookup_table[k][l][0];
+                                conv_params_tst.bck_offset =
+                                    quant_dist_lookup_table[k][l][1];
+
+                                test_convolve(w,
+                                              h,
+                                              &filter_params_x,
+                                              &filter_params_y,
+                                              &conv_params_ref,
+                                              &conv_params_tst);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void speed_test() {
+        const int w = block_size_wide[block_idx_];
+        const int h = block_size_high[block_idx_];
+        const InterpFilterParams filter_params =
+            av1_get_interp_filter_params_with_block_size(EIGHTTAP_REGULAR, w);
+        const Sample *src = input_ + 3 * kMaxScaleSize + 3;
+        const uint64_t num_loop = 1000000 / (w * h);
+        double time_c, time_o;
+        uint64_t start_time_seconds, start_time_useconds;
+        uint64_t middle_time_seconds, middle_time_useconds;
+        uint64_t finish_time_seconds, finish_time_useconds;
+
+        prepare_data();
+        reset_output();
+        ConvolveParams conv_params =
+            get_conv_params_no_round(0, 0, 0, nullptr, 0, 0, bd_);
+
+        svt_av1_get_time(&start_time_seconds, &start_time_useconds);
+
+        for (uint64_t i = 0; i < num_loop; i++) {
+            run_convolve(func_ref_,
+                         src,
+                         kMaxScaleSize,
+                         output_ref_,
+                         w,
+                         h,
+                         &filter_params,
+                         &filter_params,
+                         (int)(i & SCALE_SUBPEL_MASK),
+                         x_step_qn_,
+                         (int)(i & SCALE_SUBPEL_MASK),
+                         x_step_qn_,
+                         &conv_params);
+        }
+
+        svt_av1_get_time(&middle_time_seconds, &middle_time_useconds);
+
+        for (uint64_t i = 0; i < num_loop; i++) {
+            run_convolve(func_tst_,
+                         src,
+                         kMaxScaleSize,
+                         output_tst_,
+                         w,
+                         h,
+                         &filter_params,
+                         &filter_params,
+                         (int)(i & SCALE_SUBPEL_MASK),
+                         x_step_qn_,
+                         (int)(i & SCALE_SUBPEL_MASK),
+                         x_step_qn_,
+                         &conv_params);
+        }
+
+        svt_av1_get_time(&finish_time_seconds, &finish_time_useconds);
+        time_c = svt_av1_compute_overall_elapsed_time_ms(start_time_seconds,
+                                                         start_time_useconds,
+                                                         middle_time_seconds,
+                                                         middle_time_useconds);
+        time_o = svt_av1_compute_overall_elapsed_time_ms(middle_time_seconds,
+                                                         middle_time_useconds,
+                                                         finish_time_seconds,
+                                                         finish_time_useconds);
+
+        printf("convolve_scale(%3dx%3d, bd %d, step %d): %6.2f\n",
+               w,
+               h,
+               bd_,
+               x_step_qn_,
+               time_c / time_o);
+    }
+
+  protected:
+    FuncType func_ref_;
+    FuncType func_tst_;
+    int bd_;
+    int x_step_qn_;
+    BlockSize block_idx_;
+    Sample *input_;               // aligned address
+    ConvBufType *conv_buf_init_;  // aligned address
+    ConvBufType *conv_buf_ref_;   // aligned address
+    ConvBufType *conv_buf_tst_;   // aligned address
+    Sample *output_init_;         // aligned address
+    Sample *output_ref_;          // aligned address
+    Sample *output_tst_;          // aligned address
+};
+
+// Steps of the scaled references in 1/1024 pel: 1:1, the superres
+// denominators 10 and 12, the 2:1 limit and an odd step
+::testing::internal::ParamGenerator<Convolve2DScaleParam> BuildParams(
+    int highbd) {
+    const int steps[] = {1024, 1280, 1536, 2048, 1663};
+    if (highbd)
+        return ::testing::Combine(::testing::Range(8, 13, 2),
+                                  ::testing::ValuesIn(steps),
+                                  ::testing::Range(BLOCK_4X4, BlockSizeS_ALL));
+    else
+        return ::testing::Combine(::testing::Values(8),
+                                  ::testing::ValuesIn(steps),
+                                  ::testing::Range(BLOCK_4X4, BlockSizeS_ALL));
+}
+
+class AV1LbdConvolve2DScaleTest
+    : public AV1Convolve2DScaleTest<uint8_t, lowbd_convolve_scale_func> {
+  public:
+    AV1LbdConvolve2DScaleTest() {
+        func_ref_ = svt_av1_convolve_2d_scale_c;
+        func_tst_ = svt_av1_convolve_2d_scale_avx2;
+    }
+    virtual ~AV1LbdConvolve2DScaleTest() {
+    }
+
+    void run_convolve(lowbd_convolve_scale_func func, const uint8_t *src,
+                      int src_stride, uint8_t *dst, int w, int h,
+                      const InterpFilterParams *filter_params_x,
+                      const InterpFilterParams *filter_params_y,
+                      int subpel_x_qn, int x_step_qn, int subpel_y_qn,
+                      int y_step_qn, ConvolveParams *conv_params) override {
+        func(src,
+             src_stride,
+             dst,
+             MAX_SB_SIZE,
+             w,
+             h,
+             filter_params_x,
+             filter_params_y,
+             subpel_x_qn,
+             x_step_qn,
+             subpel_y_qn,
+             y_step_qn,
+             conv_params);
+    }
+};
+
+TEST_P(AV1LbdConvolve2DScaleTest, MatchTest) {
+    run_test();
+}
+
+TEST_P(AV1LbdConvolve2DScaleTest, DISABLED_SpeedTest) {
+    speed_test();
+}
+
+INSTANTIATE_TEST_CASE_P(AVX2, AV1LbdConvolve2DScaleTest, BuildParams(0));
+
+#if EN_AVX512_SUPPORT
+class AV1LbdConvolve2DScaleTestAVX512 : public AV1LbdConvolve2DScaleTest {
+  public:
+    AV1LbdConvolve2DScaleTestAVX512() {
+        func_tst_ = svt_av1_convolve_2d_scale_avx512;
+    }
+};
+
+TEST_P(AV1LbdConvolve2DScaleTestAVX512, MatchTest) {
+    run_test();
+}
+
+TEST_P(AV1LbdConvolve2DScaleTestAVX512, DISABLED_SpeedTest) {
+    speed_test();
+}
+
+INSTANTIATE_TEST_CASE_P(AVX512, AV1LbdConvolve2DScaleTestAVX512,
+                        BuildParams(0));
+#endif
+
+class AV1HbdConvolve2DScaleTest
+    : public AV1Convolve2DScaleTest<uint16_t, highbd_convolve_scale_func> {
+  public:
+    AV1HbdConvolve2DScaleTest() {
+        func_ref_ = svt_av1_highbd_convolve_2d_scale_c;
+        func_tst_ = svt_av1_highbd_convolve_2d_scale_avx2;
+    }
+    virtual ~AV1HbdConvolve2DScaleTest() {
+    }
+
+    void run_convolve(highbd_convolve_scale_func func, const uint16_t *src,
+                      int src_stride, uint16_t *dst, int w, int h,
+                      const InterpFilterParams *filter_params_x,
+                      const InterpFilterParams *filter_params_y,
+                      int subpel_x_qn, int x_step_qn, int subpel_y_qn,
+                      int y_step_qn, ConvolveParams *conv_params) override {
+        func(src,
+             src_stride,
+             dst,
+             MAX_SB_SIZE,
+             w,
+             h,
+             filter_params_x,
+             filter_params_y,
+             subpel_x_qn,
+             x_step_qn,
+             subpel_y_qn,
+             y_step_qn,
+             conv_params,
+             bd_);
+    }
+};
+
+TEST_P(AV1HbdConvolve2DScaleTest, MatchTest) {
+    run_test();
+}
+
+TEST_P(AV1HbdConvolve2DScaleTest, DISABLED_SpeedTest) {
+    speed_test();
+}
+
+INSTANTIATE_TEST_CASE_P(AVX2, AV1HbdConvolve2DScaleTest, BuildParams(1));
+
+#if EN_AVX512_SUPPORT
+class AV1HbdConvolve2DScaleTestAVX512 : public AV1HbdConvolve2DScaleTest {
+  public:
+    AV1HbdConvolve2DScaleTestAVX512() {
+        func_tst_ = svt_av1_highbd_convolve_2d_scale_avx512;
+    }
+};
+
+TEST_P(AV1HbdConvolve2DScaleTestAVX512, MatchTest) {
+    run_test();
+}
+
+TEST_P(AV1HbdConvolve2DScaleTestAVX512, DISABLED_SpeedTest) {
+    speed_test();
+}
+
+INSTANTIATE_TEST_CASE_P(AVX512, AV1HbdConvolve2DScaleTestAVX512,
+                        BuildParams(1));
+#endif
+}  // namespace
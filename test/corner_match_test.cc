@@ -18,9 +18,16 @@
 #include "EbUnitTestUtility.h"
 #include "acm_random.h"
 #include "corner_match.h"
+#include "EbTime.h"
+extern "C" {
+#include "fast.h"
+}
 
 using libaom_test::ACMRandom;
 
+/** setup_test_env is implemented in test/TestEnv.c */
+extern "C" void setup_test_env();
+
 namespace {
 
 typedef double (*ComputeCrossCorrFunc)(unsigned char *im1, int stride1, int x1,
@@ -149,4 +156,260 @@ INSTANTIATE_TEST_CASE_P(
     ::testing::Values(make_tuple(0, &svt_av1_compute_cross_correlation_avx2),
                       make_tuple(1, &svt_av1_compute_cross_correlation_avx2)));
 
+typedef void (*ComputeCrossCorrMultiFunc)(unsigned char *im1, int stride1,
+                                          int x1, int y1, unsigned char *im2,
+                                          int stride2, const int *points2,
+                                          int num_points, double *corr);
+
+typedef tuple<int, ComputeCrossCorrMultiFunc> CornerMatchMultiParam;
+
+// Checks the batched cross correlation of one window against the candidate
+// windows of a reference, as svt_av1_determine_correspondence() issues it.
+class AV1CornerMatchMultiTest
+    : public ::testing::TestWithParam<CornerMatchMultiParam> {
+ public:
+  virtual void SetUp() {
+    rnd_.Reset(ACMRandom::DeterministicSeed());
+    target_func_ = TEST_GET_PARAM(1);
+    setup_test_env();
+  }
+
+ protected:
+  void RunCheckOutput(int run_times);
+
+  ComputeCrossCorrMultiFunc target_func_;
+  libaom_test::ACMRandom rnd_;
+};
+
+void AV1CornerMatchMultiTest::RunCheckOutput(int run_times) {
+  const int w = 128, h = 128;
+  const int num_iters = run_times > 1 ? 100 : 1000;
+  const int max_points = 256;
+  double time_single = 0, time_multi = 0;
+  uint64_t start_seconds, start_useconds;
+  uint64_t middle_seconds, middle_useconds;
+  uint64_t finish_seconds, finish_useconds;
+
+  uint8_t *input1 = new uint8_t[w * h];
+  uint8_t *input2 = new uint8_t[w * h];
+  int *points = new int[2 * max_points];
+  double *corr_ref = new double[max_points];
+  double *corr_tst = new double[max_points];
+
+  const int mode = TEST_GET_PARAM(0);
+  for (int i = 0; i < w * h; ++i) {
+    const int v = rnd_.Rand8();
+    input1[i] = v;
+    input2[i] = mode == 0 ? rnd_.Rand8() : (v / 2) + (rnd_.Rand8() & 15);
+  }
+
+  for (int iter = 0; iter < num_iters; ++iter) {
+    const int x1 = MATCH_SZ_BY2 + rnd_.PseudoUniform(w - 2 * MATCH_SZ_BY2);
+    const int y1 = MATCH_SZ_BY2 + rnd_.PseudoUniform(h - 2 * MATCH_SZ_BY2);
+    const int num_points =
+        run_times > 1 ? max_points : rnd_.PseudoUniform(max_points + 1);
+    for (int n = 0; n < num_points; ++n) {
+      points[2 * n] = MATCH_SZ_BY2 + rnd_.PseudoUniform(w - 2 * MATCH_SZ_BY2);
+      points[2 * n + 1] =
+          MATCH_SZ_BY2 + rnd_.PseudoUniform(h - 2 * MATCH_SZ_BY2);
+    }
+
+    svt_av1_get_time(&start_seconds, &start_useconds);
+    for (int r = 0; r < run_times; ++r) {
+      for (int n = 0; n < num_points; ++n) {
+        corr_ref[n] = svt_av1_compute_cross_correlation(
+            input1, w, x1, y1, input2, w, points[2 * n], points[2 * n + 1]);
+      }
+    }
+    svt_av1_get_time(&middle_seconds, &middle_useconds);
+    for (int r = 0; r < run_times; ++r)
+      target_func_(input1, w, x1, y1, input2, w, points, num_points, corr_tst);
+    svt_av1_get_time(&finish_seconds, &finish_useconds);
+
+    time_single += svt_av1_compute_overall_elapsed_time_ms(
+        start_seconds, start_useconds, middle_seconds, middle_useconds);
+    time_multi += svt_av1_compute_overall_elapsed_time_ms(
+        middle_seconds, middle_useconds, finish_seconds, finish_useconds);
+
+    for (int n = 0; n < num_points; ++n) {
+      ASSERT_EQ(corr_ref[n],
+                svt_av1_compute_cross_correlation_c(
+                    input1, w, x1, y1, input2, w, points[2 * n],
+                    points[2 * n + 1]));
+      ASSERT_EQ(corr_tst[n], corr_ref[n]) << "point " << n;
+    }
+  }
+
+  if (run_times > 1) {
+    printf("%d windows: one call per window %6.2f ms, batched %6.2f ms "
+           "(%5.2fx)\n",
+           max_points, time_single, time_multi, time_single / time_multi);
+  }
+
+  delete[] input1;
+  delete[] input2;
+  delete[] points;
+  delete[] corr_ref;
+  delete[] corr_tst;
+}
+
+TEST_P(AV1CornerMatchMultiTest, CheckOutput) { RunCheckOutput(1); }
+TEST_P(AV1CornerMatchMultiTest, DISABLED_Speed) { RunCheckOutput(100); }
+
+INSTANTIATE_TEST_CASE_P(
+    C, AV1CornerMatchMultiTest,
+    ::testing::Values(make_tuple(0, &svt_av1_compute_cross_correlation_multi_c),
+                      make_tuple(1, &svt_av1_compute_cross_correlation_multi_c)));
+
+INSTANTIATE_TEST_CASE_P(
+    AVX2, AV1CornerMatchMultiTest,
+    ::testing::Values(
+        make_tuple(0, &svt_av1_compute_cross_correlation_multi_avx2),
+        make_tuple(1, &svt_av1_compute_cross_correlation_multi_avx2)));
+
+typedef int (*Fast9DetectRowFunc)(const uint8_t *src, int stride, int width,
+                                  int b, int *corner_x, uint8_t *strength);
+
+typedef tuple<int, Fast9DetectRowFunc> FastCornerParam;
+
+// Checks that the corners and scores gathered from the row kernel match the
+// ones of the fastfeat detector, svt_aom_fast9_detect() and
+// svt_aom_fast9_score().
+class AV1FastCornerTest : public ::testing::TestWithParam<FastCornerParam> {
+ public:
+  virtual void SetUp() {
+    rnd_.Reset(ACMRandom::DeterministicSeed());
+    target_func_ = TEST_GET_PARAM(1);
+  }
+
+ protected:
+  // Pixels are drawn from 0, 1 or 2 random rectangles on a random background,
+  // with noise whose amplitude depends on the mode.
+  void FillImage(uint8_t *img, int w, int h, int stride) {
+    const int noise = TEST_GET_PARAM(0) == 0 ? 255 : 24;
+    const int base = rnd_.Rand8();
+    for (int y = 0; y < h; ++y)
+      for (int x = 0; x < w; ++x) img[y * stride + x] = base;
+    for (int r = 0; r < 20; ++r) {
+      const int x0 = rnd_.PseudoUniform(w), y0 = rnd_.PseudoUniform(h);
+      const int x1 = x0 + rnd_.PseudoUniform(w - x0) + 1;
+      const int y1 = y0 + rnd_.PseudoUniform(h - y0) + 1;
+      const int v = rnd_.Rand8();
+      for (int y = y0; y < y1; ++y)
+        for (int x = x0; x < x1; ++x) img[y * stride + x] = v;
+    }
+    for (int y = 0; y < h; ++y) {
+      for (int x = 0; x < w; ++x) {
+        const int v = img[y * stride + x] + rnd_.PseudoUniform(noise + 1) -
+                      noise / 2;
+        img[y * stride + x] = clip_pixel(v);
+      }
+    }
+  }
+
+  static uint8_t clip_pixel(int v) {
+    return (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+  }
+
+  // Runs the row kernel over the image and returns the corners it finds.
+  int DetectRows(const uint8_t *img, int w, int h, int stride, int b,
+                 int *row_x, uint8_t *row_strength, xy *corners, int *scores) {
+    int num = 0;
+    for (int y = 3; y < h - 3; ++y) {
+      const int num_row = target_func_(img + y * stride + 3, stride, w - 6, b,
+                                       row_x, row_strength);
+      for (int i = 0; i < num_row; ++i) {
+        corners[num].x = row_x[i] + 3;
+        corners[num].y = y;
+        scores[num++] = row_strength[i] - 1;
+      }
+    }
+    return num;
+  }
+
+  void RunCheckOutput(int run_times);
+
+  Fast9DetectRowFunc target_func_;
+  libaom_test::ACMRandom rnd_;
+};
+
+void AV1FastCornerTest::RunCheckOutput(int run_times) {
+  const int stride = 416;
+  const int max_h = 240;
+  const int num_iters = run_times > 1 ? 1 : 40;
+  uint8_t *img = new uint8_t[stride * max_h];
+  int *row_x = new int[stride];
+  uint8_t *row_strength = new uint8_t[stride];
+  xy *corners = new xy[stride * max_h];
+  int *scores = new int[stride * max_h];
+  double time_ref = 0, time_tst = 0;
+  uint64_t start_seconds, start_useconds;
+  uint64_t middle_seconds, middle_useconds;
+  uint64_t finish_seconds, finish_useconds;
+
+  for (int iter = 0; iter < num_iters; ++iter) {
+    // Odd sizes exercise the tails of the row kernel.
+    const int w = run_times > 1 ? stride : 7 + rnd_.PseudoUniform(stride - 6);
+    const int h = run_times > 1 ? max_h : 7 + rnd_.PseudoUniform(max_h - 6);
+    const int b = iter % 4 == 0 ? 18 : 1 + rnd_.PseudoUniform(100);
+    FillImage(img, w, h, stride);
+
+    int num_ref = 0;
+    xy *ref_corners = NULL;
+    int *ref_scores = NULL;
+    svt_av1_get_time(&start_seconds, &start_useconds);
+    for (int r = 0; r < run_times; ++r) {
+      free(ref_corners);
+      free(ref_scores);
+      ref_corners = svt_aom_fast9_detect(img, w, h, stride, b, &num_ref);
+      ref_scores = svt_aom_fast9_score(img, stride, ref_corners, num_ref, b);
+    }
+    svt_av1_get_time(&middle_seconds, &middle_useconds);
+    int num_tst = 0;
+    for (int r = 0; r < run_times; ++r)
+      num_tst = DetectRows(img, w, h, stride, b, row_x, row_strength, corners,
+                           scores);
+    svt_av1_get_time(&finish_seconds, &finish_useconds);
+
+    time_ref += svt_av1_compute_overall_elapsed_time_ms(
+        start_seconds, start_useconds, middle_seconds, middle_useconds);
+    time_tst += svt_av1_compute_overall_elapsed_time_ms(
+        middle_seconds, middle_useconds, finish_seconds, finish_useconds);
+
+    ASSERT_EQ(num_tst, num_ref) << "w " << w << " h " << h << " b " << b;
+    for (int n = 0; n < num_ref; ++n) {
+      ASSERT_EQ(corners[n].x, ref_corners[n].x) << "corner " << n;
+      ASSERT_EQ(corners[n].y, ref_corners[n].y) << "corner " << n;
+      ASSERT_EQ(scores[n], ref_scores[n]) << "corner " << n;
+    }
+    free(ref_corners);
+    free(ref_scores);
+  }
+
+  if (run_times > 1) {
+    printf("fastfeat detect and score %6.2f ms, row kernel %6.2f ms "
+           "(%5.2fx)\n",
+           time_ref, time_tst, time_ref / time_tst);
+  }
+
+  delete[] img;
+  delete[] row_x;
+  delete[] row_strength;
+  delete[] corners;
+  delete[] scores;
+}
+
+TEST_P(AV1FastCornerTest, CheckOutput) { RunCheckOutput(1); }
+TEST_P(AV1FastCornerTest, DISABLED_Speed) { RunCheckOutput(1000); }
+
+INSTANTIATE_TEST_CASE_P(
+    C, AV1FastCornerTest,
+    ::testing::Values(make_tuple(0, &svt_av1_fast9_detect_row_c),
+                      make_tuple(1, &svt_av1_fast9_detect_row_c)));
+
+INSTANTIATE_TEST_CASE_P(
+    AVX2, AV1FastCornerTest,
+    ::testing::Values(make_tuple(0, &svt_av1_fast9_detect_row_avx2),
+                      make_tuple(1, &svt_av1_fast9_detect_row_avx2)));
+
 }
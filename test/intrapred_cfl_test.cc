@@ -15,6 +15,7 @@
  * @brief Unit test for chroma from luma prediction:
  * - svt_cfl_predict_hbd_avx2
  * - svt_cfl_predict_lbd_avx2
+ * - svt_cfl_predict_lbd_avx512
  * - svt_cfl_luma_subsampling_420_lbd_avx2
  * - svt_cfl_luma_subsampling_420_hbd_avx2
  *
@@ -42,6 +43,7 @@ using CFL_PRED_LBD = void (*)(const int16_t *pred_buf_q3, uint8_t *pred,
  * @brief Unit test for chroma from luma prediction:
  * - svt_cfl_predict_hbd_avx2
  * - svt_cfl_predict_lbd_avx2
+ * - svt_cfl_predict_lbd_avx512
  *
  * Test strategy:
  * Verify this assembly code by comparing with reference c implementation.
@@ -160,6 +162,18 @@ class LbdCflPredTest : public CflPredTest<uint8_t, CFL_PRED_LBD> {
     }
 };
 
+#if EN_AVX512_SUPPORT
+class LbdCflPredAvx512Test : public CflPredTest<uint8_t, CFL_PRED_LBD> {
+  public:
+    LbdCflPredAvx512Test() {
+        bd_ = 8;
+        ref_func_ = svt_cfl_predict_lbd_c;
+        tst_func_ = svt_cfl_predict_lbd_avx512;
+        common_init();
+    }
+};
+#endif  // EN_AVX512_SUPPORT
+
 class HbdCflPredTest : public CflPredTest<uint16_t, CFL_PRED_HBD> {
   public:
     HbdCflPredTest() {
@@ -179,6 +193,9 @@ class HbdCflPredTest : public CflPredTest<uint16_t, CFL_PRED_HBD> {
 
 TEST_CLASS(LbdCflPredMatchTest, LbdCflPredTest)
 TEST_CLASS(HbdCflPredMatchTest, HbdCflPredTest)
+#if EN_AVX512_SUPPORT
+TEST_CLASS(LbdCflPredAvx512MatchTest, LbdCflPredAvx512Test)
+#endif  // EN_AVX512_SUPPORT
 
 typedef void (*AomUpsampledPredFunc)(MacroBlockD *,
                                      const struct AV1Common *const, int, int,
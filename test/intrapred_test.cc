@@ -13,8 +13,8 @@
  * @file intrapred_test.cc
  *
  * @brief Unit test for intra {h, v}_pred, dc_pred, smooth_{h, v}_pred :
- * - av1_highbd_{dc, h, v, smooth_h, smooth_v}_predictor_wxh_{sse2, avx2, ssse3}
- * - av1_{dc, h, v, smooth_h, smooth_v}_predictor_wxh_{sse2, avx2, ssse3}
+ * - av1_highbd_{dc, h, v, smooth_h, smooth_v}_predictor_wxh_{sse2, avx2, ssse3, sse4_1}
+ * - av1_{dc, h, v, smooth_h, smooth_v}_predictor_wxh_{sse2, avx2, ssse3, avx512}
  *
  * @author Cidana-Wenyao
  *
@@ -45,8 +45,8 @@ using HBD_PARAMS = tuple<INTRAPRED_HBD, INTRAPRED_HBD, int, int, int>;
 
 /**
  * @brief Unit test for intra prediction:
- * - av1_highbd_{dc, h, v, smooth_h, smooth_v}_predictor_wxh_{sse2, avx2, ssse3}
- * - av1_{dc, h, v, smooth_h, smooth_v}_predictor_wxh_{sse2, avx2, ssse3}
+ * - av1_highbd_{dc, h, v, smooth_h, smooth_v}_predictor_wxh_{sse2, avx2, ssse3, sse4_1}
+ * - av1_{dc, h, v, smooth_h, smooth_v}_predictor_wxh_{sse2, avx2, ssse3, avx512}
  *
  * Test strategy:
  * Verify this assembly code by comparing with reference c implementation.
@@ -224,7 +224,8 @@ const HBD_PARAMS HighbdIntraPredTestVectorAsm[] = {
     hbd_entry(dc_top, 4, 16, sse2),    hbd_entry(dc_top, 4, 4, sse2),
     hbd_entry(dc_top, 4, 8, sse2),     hbd_entry(dc_top, 64, 16, avx2),
     hbd_entry(dc_top, 64, 32, avx2),   hbd_entry(dc_top, 64, 64, avx2),
-    hbd_entry(dc_top, 8, 16, sse2),    hbd_entry(dc_top, 8, 4, sse2),
+    hbd_entry(dc_top, 8, 16, sse2),    hbd_entry(dc_top, 8, 32, sse2),
+    hbd_entry(dc_top, 8, 4, sse2),
     hbd_entry(dc_top, 8, 8, sse2),     hbd_entry(h, 16, 16, sse2),
     hbd_entry(h, 16, 32, sse2),        hbd_entry(h, 16, 4, avx2),
     hbd_entry(h, 16, 64, avx2),        hbd_entry(h, 16, 8, sse2),
@@ -283,6 +284,8 @@ const HBD_PARAMS HighbdIntraPredTestVectorAsm[] = {
     hbd_entry(paeth, 8, 16, avx2),     hbd_entry(paeth, 8, 32, avx2),
     hbd_entry(paeth, 4, 4, avx2),      hbd_entry(paeth, 4, 8, avx2),
     hbd_entry(paeth, 4, 16, avx2),     hbd_entry(paeth, 2, 2, avx2),
+    hbd_entry(dc, 2, 2, sse4_1),       hbd_entry(dc_left, 2, 2, sse4_1),
+    hbd_entry(smooth, 2, 2, sse4_1),   hbd_entry(smooth_v, 2, 2, sse4_1),
 };
 
 INSTANTIATE_TEST_CASE_P(intrapred, HighbdIntraPredTest,
@@ -402,4 +405,17 @@ const LBD_PARAMS LowbdIntraPredTestVectorAsm[] = {
 
 INSTANTIATE_TEST_CASE_P(intrapred, LowbdIntraPredTest,
                         ::testing::ValuesIn(LowbdIntraPredTestVectorAsm));
+
+#if EN_AVX512_SUPPORT
+const LBD_PARAMS LowbdIntraPredTestVectorAsmAvx512[] = {
+    lbd_entry(smooth, 64, 16, avx512),   lbd_entry(smooth, 64, 32, avx512),
+    lbd_entry(smooth, 64, 64, avx512),   lbd_entry(smooth_v, 64, 16, avx512),
+    lbd_entry(smooth_v, 64, 32, avx512), lbd_entry(smooth_v, 64, 64, avx512),
+    lbd_entry(smooth_h, 64, 16, avx512), lbd_entry(smooth_h, 64, 32, avx512),
+    lbd_entry(smooth_h, 64, 64, avx512),
+};
+
+INSTANTIATE_TEST_CASE_P(intrapred_avx512, LowbdIntraPredTest,
+                        ::testing::ValuesIn(LowbdIntraPredTestVectorAsmAvx512));
+#endif  // EN_AVX512_SUPPORT
 }  // namespace
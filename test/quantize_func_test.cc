@@ -655,4 +655,55 @@ INSTANTIATE_TEST_CASE_P(AVX2, QuantizeLbdTest,
 INSTANTIATE_TEST_CASE_P(AVX2, QuantizeHbdTest,
                         ::testing::ValuesIn(kQHbdParamArrayAvx2));
 #endif  // HAS_AVX2
+
+#if EN_AVX512_SUPPORT
+const QuantizeParam kQParamArrayAvx512[] = {
+    make_tuple(&svt_av1_quantize_fp_c, &svt_av1_quantize_fp_avx512,
+               static_cast<TxSize>(TX_4X4), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_quantize_fp_c, &svt_av1_quantize_fp_avx512,
+               static_cast<TxSize>(TX_16X16), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_quantize_fp_c, &svt_av1_quantize_fp_avx512,
+               static_cast<TxSize>(TX_4X16), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_quantize_fp_c, &svt_av1_quantize_fp_avx512,
+               static_cast<TxSize>(TX_16X4), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_quantize_fp_c, &svt_av1_quantize_fp_avx512,
+               static_cast<TxSize>(TX_32X8), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_quantize_fp_c, &svt_av1_quantize_fp_avx512,
+               static_cast<TxSize>(TX_8X32), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_quantize_fp_32x32_c, &svt_av1_quantize_fp_32x32_avx512,
+               static_cast<TxSize>(TX_32X32), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_quantize_fp_32x32_c, &svt_av1_quantize_fp_32x32_avx512,
+               static_cast<TxSize>(TX_16X64), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_quantize_fp_32x32_c, &svt_av1_quantize_fp_32x32_avx512,
+               static_cast<TxSize>(TX_64X16), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_quantize_fp_64x64_c, &svt_av1_quantize_fp_64x64_avx512,
+               static_cast<TxSize>(TX_64X64), TYPE_FP, AOM_BITS_8)};
+
+const QuantizeHbdParam kQHbdParamArrayAvx512[] = {
+    make_tuple(&svt_av1_highbd_quantize_fp_c, &svt_av1_highbd_quantize_fp_avx512,
+               static_cast<TxSize>(TX_4X4), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_highbd_quantize_fp_c, &svt_av1_highbd_quantize_fp_avx512,
+               static_cast<TxSize>(TX_16X16), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_highbd_quantize_fp_c, &svt_av1_highbd_quantize_fp_avx512,
+               static_cast<TxSize>(TX_32X32), TYPE_FP, AOM_BITS_8),
+    make_tuple(&svt_av1_highbd_quantize_fp_c, &svt_av1_highbd_quantize_fp_avx512,
+               static_cast<TxSize>(TX_4X16), TYPE_FP, AOM_BITS_10),
+    make_tuple(&svt_av1_highbd_quantize_fp_c, &svt_av1_highbd_quantize_fp_avx512,
+               static_cast<TxSize>(TX_16X16), TYPE_FP, AOM_BITS_10),
+    make_tuple(&svt_av1_highbd_quantize_fp_c, &svt_av1_highbd_quantize_fp_avx512,
+               static_cast<TxSize>(TX_32X32), TYPE_FP, AOM_BITS_10),
+    make_tuple(&svt_av1_highbd_quantize_fp_c, &svt_av1_highbd_quantize_fp_avx512,
+               static_cast<TxSize>(TX_64X64), TYPE_FP, AOM_BITS_10),
+    make_tuple(&svt_av1_highbd_quantize_fp_c, &svt_av1_highbd_quantize_fp_avx512,
+               static_cast<TxSize>(TX_16X4), TYPE_FP, AOM_BITS_12),
+    make_tuple(&svt_av1_highbd_quantize_fp_c, &svt_av1_highbd_quantize_fp_avx512,
+               static_cast<TxSize>(TX_16X16), TYPE_FP, AOM_BITS_12),
+    make_tuple(&svt_av1_highbd_quantize_fp_c, &svt_av1_highbd_quantize_fp_avx512,
+               static_cast<TxSize>(TX_32X32), TYPE_FP, AOM_BITS_12)};
+
+INSTANTIATE_TEST_CASE_P(AVX512, QuantizeLbdTest,
+                        ::testing::ValuesIn(kQParamArrayAvx512));
+INSTANTIATE_TEST_CASE_P(AVX512, QuantizeHbdTest,
+                        ::testing::ValuesIn(kQHbdParamArrayAvx512));
+#endif  // EN_AVX512_SUPPORT
 }  // namespace